@@ -19,6 +19,8 @@
 #include <openssl/x509.h>
 #include <openssl/pem.h>
 #include <openssl/hmac.h>
+#include <openssl/core_names.h>
+#include <openssl/thread.h>
 #include <ctype.h>
 
 #undef BUFSIZE
@@ -41,7 +43,7 @@ typedef enum OPTION_choice {
     OPT_C, OPT_R, OPT_OUT, OPT_SIGN, OPT_PASSIN, OPT_VERIFY,
     OPT_PRVERIFY, OPT_SIGNATURE, OPT_KEYFORM, OPT_ENGINE, OPT_ENGINE_IMPL,
     OPT_HEX, OPT_BINARY, OPT_DEBUG, OPT_FIPS_FINGERPRINT,
-    OPT_HMAC, OPT_MAC, OPT_SIGOPT, OPT_MACOPT, OPT_XOFLEN,
+    OPT_HMAC, OPT_MAC, OPT_SIGOPT, OPT_MACOPT, OPT_XOFLEN, OPT_THREADS,
     OPT_DIGEST,
     OPT_R_ENUM, OPT_PROV_ENUM
 } OPTION_CHOICE;
@@ -67,6 +69,8 @@ const OPTIONS dgst_options[] = {
     {"hex", OPT_HEX, '-', "Print as hex dump"},
     {"binary", OPT_BINARY, '-', "Print in binary form"},
     {"xoflen", OPT_XOFLEN, 'p', "Output length for XOF algorithms. To obtain the maximum security strength set this to 32 (or greater) for SHAKE128, and 64 (or greater) for SHAKE256"},
+    {"threads", OPT_THREADS, 'p',
+     "Number of threads to hash with (ParallelHash digests only)"},
     {"d", OPT_DEBUG, '-', "Print debug info"},
     {"debug", OPT_DEBUG, '-', "Print debug info"},
 
@@ -108,6 +112,7 @@ int dgst_main(int argc, char **argv)
     int separator = 0, debug = 0, keyform = FORMAT_UNDEF, siglen = 0;
     int i, ret = EXIT_FAILURE, out_bin = -1, want_pub = 0, do_verify = 0;
     int xoflen = 0;
+    int threads = 0;
     unsigned char *buf = NULL, *sigbuf = NULL;
     int engine_impl = 0;
     struct doall_dgst_digests dec;
@@ -188,6 +193,9 @@ int dgst_main(int argc, char **argv)
         case OPT_XOFLEN:
             xoflen = atoi(opt_arg());
             break;
+        case OPT_THREADS:
+            threads = atoi(opt_arg());
+            break;
         case OPT_DEBUG:
             debug = 1;
             break;
@@ -340,6 +348,10 @@ int dgst_main(int argc, char **argv)
         EVP_PKEY_CTX *pctx = NULL;
         int res;
 
+        if (threads > 0) {
+            BIO_printf(bio_err, "Threads cannot be used with a signing key\n");
+            goto end;
+        }
         if (BIO_get_md_ctx(bmd, &mctx) <= 0) {
             BIO_printf(bio_err, "Error getting context\n");
             goto end;
@@ -387,6 +399,30 @@ int dgst_main(int argc, char **argv)
             BIO_printf(bio_err, "Error setting digest\n");
             goto end;
         }
+        if (threads > 0) {
+            uint32_t nthreads = (uint32_t)threads;
+            OSSL_PARAM params[2];
+
+            params[0] = OSSL_PARAM_construct_uint32(OSSL_DIGEST_PARAM_THREADS,
+                                                    &nthreads);
+            params[1] = OSSL_PARAM_construct_end();
+            if (OSSL_PARAM_locate_const(EVP_MD_CTX_settable_params(mctx),
+                                        OSSL_DIGEST_PARAM_THREADS) == NULL) {
+                BIO_printf(bio_err,
+                           "Digest does not support multi-threaded hashing\n");
+                goto end;
+            }
+            /* The digest uses the calling thread plus threads - 1 others */
+            if (threads > 1
+                    && !OSSL_set_max_threads(app_get0_libctx(), threads - 1)) {
+                BIO_printf(bio_err, "Error setting up the thread pool\n");
+                goto end;
+            }
+            if (!EVP_MD_CTX_set_params(mctx, params)) {
+                BIO_printf(bio_err, "Error setting thread count\n");
+                goto end;
+            }
+        }
     }
 
     if (sigfile != NULL && sigkey != NULL) {
@@ -237,7 +237,8 @@ typedef enum OPTION_choice {
     OPT_COMMON,
     OPT_ELAPSED, OPT_EVP, OPT_HMAC, OPT_DECRYPT, OPT_ENGINE, OPT_MULTI,
     OPT_MR, OPT_MB, OPT_MISALIGN, OPT_ASYNCJOBS, OPT_R_ENUM, OPT_PROV_ENUM, OPT_CONFIG,
-    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD, OPT_CMAC, OPT_MLOCK, OPT_KEM, OPT_SIG
+    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD, OPT_CMAC, OPT_MLOCK, OPT_KEM, OPT_SIG,
+    OPT_RSA_BATCH
 } OPTION_CHOICE;
 
 const OPTIONS speed_options[] = {
@@ -258,6 +259,8 @@ const OPTIONS speed_options[] = {
 #ifndef OPENSSL_NO_ASYNC
     {"async_jobs", OPT_ASYNCJOBS, 'p',
      "Enable async mode and start specified number of jobs"},
+    {"rsa_batch", OPT_RSA_BATCH, '-',
+     "Batch the RSA private key operations of the async jobs"},
 #endif
 #ifndef OPENSSL_NO_ENGINE
     {"engine", OPT_ENGINE, 's', "Use engine, possibly a hardware device"},
@@ -1339,6 +1342,11 @@ static int run_benchmark(int async_jobs,
             break;
         }
     }
+    /*
+     * Jobs paused in a partial batch of RSA operations only become ready
+     * when it runs
+     */
+    RSA_batch_flush();
 
     while (num_inprogress > 0) {
 #if defined(OPENSSL_SYS_WINDOWS)
@@ -1445,6 +1453,7 @@ static int run_benchmark(int async_jobs,
                 break;
             }
         }
+        RSA_batch_flush();
     }
 
     return error ? -1 : total_op_count;
@@ -1648,6 +1657,7 @@ int speed_main(int argc, char **argv)
     unsigned int idx;
     int keylen;
     int buflen;
+    int rsa_batch = 0;
     BIGNUM *bn = NULL;
     EVP_PKEY_CTX *genctx = NULL;
 #ifndef NO_FORK
@@ -1865,6 +1875,11 @@ int speed_main(int argc, char **argv)
                 BIO_printf(bio_err, "%s: too many async_jobs\n", prog);
                 goto opterr;
             }
+#endif
+            break;
+        case OPT_RSA_BATCH:
+#ifndef OPENSSL_NO_ASYNC
+            rsa_batch = 1;
 #endif
             break;
         case OPT_MISALIGN:
@@ -2210,6 +2225,13 @@ int speed_main(int argc, char **argv)
             BIO_printf(bio_err, "Error creating the ASYNC job pool\n");
             goto end;
         }
+        if (rsa_batch && !RSA_batch_enable(1)) {
+            BIO_printf(bio_err, "Error enabling RSA batching\n");
+            goto end;
+        }
+    } else if (rsa_batch) {
+        BIO_printf(bio_err, "%s: -rsa_batch requires -async_jobs\n", prog);
+        goto end;
     }
 
     loopargs_len = (async_jobs == 0 ? 1 : async_jobs);
@@ -4232,6 +4254,8 @@ skip_hmac:
     for (k = 0; k < sigs_algs_len; k++)
         OPENSSL_free(sigs_algname[k]);
 
+    if (rsa_batch)
+        RSA_batch_enable(0);
     if (async_jobs > 0) {
         for (i = 0; i < loopargs_len; i++)
             ASYNC_WAIT_CTX_free(loopargs[i].wait_ctx);
@@ -0,0 +1,647 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+# AES-XTS and AES-CTR for x86_64 processors with VAES and VPCLMULQDQ.
+#
+# VAES applies an AES round to every 128-bit lane of a ymm or zmm register,
+# so that one instruction processes two or four blocks. There are two
+# flavours of each subroutine:
+#
+# - "avx512" works on zmm registers, sixteen blocks per iteration, and
+#   keeps the whole key schedule in %zmm16-%zmm30. It needs AVX512F, BW
+#   and VL on top of VAES and VPCLMULQDQ.
+# - "avx2" works on ymm registers, eight blocks per iteration, and reads
+#   the round keys from memory.
+#
+# Only registers that are volatile in both the SysV and the Win64 ABI are
+# used, i.e. %xmm0-%xmm5 and %xmm16-%xmm31, and no stack frame is set up.
+# The XTS tweaks are multiplied by powers of x with a VPCLMULQDQ reduction
+# and parked in the output buffer between the initial and the final
+# whitening.
+#
+# The subroutines are drop-in replacements for aesni_xts_[en|de]crypt and
+# aesni_ctr32_encrypt_blocks, ciphertext stealing included, and take the
+# same AES-NI key schedules:
+#
+# void ossl_aes_xts_encrypt_vaes_avx512(const unsigned char *in,
+#                                       unsigned char *out, size_t len,
+#                                       const AES_KEY *key1,
+#                                       const AES_KEY *key2,
+#                                       const unsigned char iv[16]);
+# void ossl_aes_xts_decrypt_vaes_avx512(...);
+# void ossl_aes_ctr32_encrypt_blocks_vaes_avx512(const unsigned char *in,
+#                                                unsigned char *out,
+#                                                size_t blocks,
+#                                                const void *key,
+#                                                const unsigned char ivec[16]);
+# int ossl_aes_vaes_avx512_capable(void);
+#
+# and the same with _avx2.
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+$vaes = 0;
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+		=~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+	$vaes = ($1>=2.30);
+}
+
+if (!$vaes && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+	    `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)(?:\.([0-9]+))?/) {
+	$vaes = ($1==2.13 && $2>=3) + ($1>=2.14);
+}
+
+if (!$vaes && `$ENV{CC} -v 2>&1`
+	    =~ /(Apple)?\s*((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)\.([0-9]+)?/) {
+	my $ver = $3 + $4/100.0 + $5/10000.0;	# 3.1.0->3.01, 3.10.1->3.1001
+	# Apple clang 10.0.1 is clang 7.0.0
+	$vaes = $1 ? ($ver>=10.0001) : ($ver>=7.0);
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+my @avx512_caps = (42, 41, 31, 30, 16);	# VPCLMULQDQ, VAES, VL, BW, F
+my @avx2_caps = (42, 41, 5);		# VPCLMULQDQ, VAES, AVX2
+
+if ($vaes) {
+
+my ($inp, $out, $len, $key, $key2, $ivp) =
+    ("%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9");
+my $rounds = "%eax";		# 9, 11 or 13 as in AES-NI key schedules
+my $last = "%r11";		# the last round key in the avx2 flavour
+my ($tw, $t1, $t2) = (4, 5, 31);	# tweak or counter, temporaries
+my $label = 0;
+
+# Register $n of the width given by the prefix $w, e.g. reg("zmm", 4)
+sub reg { my ($w, $n) = @_; return "%$w$n"; }
+
+# Emits the AES rounds that follow the addition of the first round key to
+# the blocks in the registers @s. $k->($i) returns the operand holding
+# round key $i, $k->() the one holding the last one, and may emit the
+# instructions that load them.
+sub aes_rounds {
+    my ($op, $k, @s) = @_;
+    my $done = ".Lrounds_done".$label++;
+    my $round = sub {
+	my $rk = $k->(@_);
+	$code.="	$op	$rk,$_,$_\n" for (@s);
+    };
+
+    $round->($_) for (1..9);
+    $code.=<<___;
+	cmp	\$11,$rounds
+	jb	$done
+___
+    $round->($_) for (10..11);
+    $code.="	je	$done\n";
+    $round->($_) for (12..13);
+    $code.="$done:\n";
+    $op .= "last";
+    $round->();
+}
+
+# Round keys in %zmm16-%zmm30, see load_keys_avx512, as operands of width $w
+sub keys_avx512 {
+    my ($w) = @_;
+    return sub { return @_ ? reg($w, 16 + $_[0]) : reg($w, 30); };
+}
+
+# Round keys broadcast to %ymm5 for each round, or memory operands for $w
+# "xmm"
+sub keys_avx2 {
+    my ($w) = @_;
+    return sub {
+	my $rk = @_ ? (16 * $_[0])."($key)" : "($last)";
+
+	return $rk if ($w eq "xmm");
+	$code.="	vbroadcasti128	$rk,%ymm$t1\n";
+	return "%ymm$t1";
+    };
+}
+
+# Loads the round keys of $k to %zmm16 and up, the last one to %zmm30,
+# and its number of rounds to $rounds.
+sub load_keys_avx512 {
+    my ($k) = @_;
+    my $done = ".Lkeys_done".$label++;
+
+    $code.="	mov	240($k),$rounds\n";
+    $code.="	vbroadcasti32x4	".(16 * $_)."($k),%zmm".(16 + $_)."\n"
+	for (0..9);
+    $code.=<<___;
+	cmp	\$11,$rounds
+	jb	$done
+	vbroadcasti32x4	160($k),%zmm26
+	vbroadcasti32x4	176($k),%zmm27
+	je	$done
+	vbroadcasti32x4	192($k),%zmm28
+	vbroadcasti32x4	208($k),%zmm29
+$done:
+	mov	$rounds,%r11d
+	shl	\$4,%r11
+	vbroadcasti32x4	16($k,%r11),%zmm30
+___
+}
+
+# Points $last at the last round key of $key and loads the number of rounds
+sub load_keys_avx2 {
+    $code.=<<___;
+	mov	240($key),$rounds
+	mov	$rounds,%r11d
+	shl	\$4,%r11
+	lea	16($key,%r11),$last
+___
+}
+
+# Encrypts the tweak at $ivp with $key2 into %xmm4
+sub xts_tweak {
+    my $loop = ".Ltweak".$label++;
+
+    $code.=<<___;
+	vmovdqu	($ivp),%xmm$tw
+	mov	240($key2),%r10d
+	vpxor	($key2),%xmm$tw,%xmm$tw
+	lea	16($key2),%r9
+$loop:
+	vaesenc	(%r9),%xmm$tw,%xmm$tw
+	lea	16(%r9),%r9
+	dec	%r10d
+	jnz	$loop
+	vaesenclast	(%r9),%xmm$tw,%xmm$tw
+___
+}
+
+# $x *= x^$k in each 128-bit lane of width $w, with $k < 64. The bits
+# shifted out at the top are reduced with VPCLMULQDQ. The temporaries are
+# %[xyz]mm5 and $b, which defaults to %zmm31 in the avx512 flavour.
+sub xts_mul {
+    my ($isa, $w, $x, $k, $b) = @_;
+    my ($a, $y) = (reg($w, $t1), reg($w, $x));
+
+    $b = reg($w, $b // $t2);
+    $code.=<<___;
+	vpsrlq	\$`64-$k`,$y,$a
+	vpsllq	\$$k,$y,$y
+	vpclmulqdq	\$0x01,.Lxts_poly(%rip),$a,$b
+	vpslldq	\$8,$a,$a
+___
+    if ($isa eq "avx512") {
+	$code.="	vpternlogq	\$0x96,$a,$b,$y\n";
+    } else {
+	$code.="	vpxor	$a,$y,$y\n";
+	$code.="	vpxor	$b,$y,$y\n";
+    }
+}
+
+# XTS on the $n registers of width $w from $inp to $out, the tweaks being
+# those in %[xyz]mm4, which is advanced past them.
+sub xts_blocks {
+    my ($isa, $dir, $w, $n) = @_;
+    my $lanes = { xmm => 1, ymm => 2, zmm => 4 }->{$w};
+    my $bytes = 16 * $lanes;
+    my $avx512 = $isa eq "avx512";
+    my @s = map { reg($w, $_) } (0..$n-1);
+    my $t = reg($w, $tw);
+    my $mov = $avx512 ? "vmovdqu8" : "vmovdqu";
+    my $xor = $avx512 ? "vpxorq" : "vpxor";
+
+    for (0..$n-1) {
+	my $ofs = $_ * $bytes;
+	$code.="	$mov	$ofs($inp),$s[$_]\n";
+	if ($avx512) {
+	    $code.="	vpternlogq	\$0x96,%${w}16,$t,$s[$_]\n";
+	} else {
+	    $code.="	vpxor	$t,$s[$_],$s[$_]\n";
+	}
+	$code.="	$mov	$t,$ofs($out)\n";
+	# in the avx2 flavour the next block register, if there is one,
+	# is still free to serve as temporary
+	xts_mul($isa, $w, $tw, $lanes, $avx512 ? undef : $_ + 1)
+	    if ($avx512 || $_ < $n - 1);
+    }
+    if (!$avx512) {
+	my $rk0 = keys_avx2($w)->(0);
+	$code.="	vpxor	$rk0,$_,$_\n" for (@s);
+    }
+    aes_rounds($dir eq "enc" ? "vaesenc" : "vaesdec",
+	       $avx512 ? keys_avx512($w) : keys_avx2($w), @s);
+    for (0..$n-1) {
+	my $ofs = $_ * $bytes;
+	$code.=<<___;
+	$xor	$ofs($out),$s[$_],$s[$_]
+	$mov	$s[$_],$ofs($out)
+___
+    }
+    xts_mul($isa, $w, $tw, $lanes, 0) if (!$avx512);
+}
+
+# XTS of the single block at $src to $dst with the tweak in %xmm$x
+sub xts_block {
+    my ($isa, $dir, $src, $dst, $x) = @_;
+    my $avx512 = $isa eq "avx512";
+    my $t = "%xmm$x";
+
+    if ($avx512) {
+	$code.=<<___;
+	vmovdqu8	$src,%xmm0
+	vpternlogq	\$0x96,%xmm16,$t,%xmm0
+___
+    } else {
+	$code.=<<___;
+	vmovdqu	$src,%xmm0
+	vpxor	$t,%xmm0,%xmm0
+	vpxor	($key),%xmm0,%xmm0
+___
+    }
+    aes_rounds($dir eq "enc" ? "vaesenc" : "vaesdec",
+	       $avx512 ? keys_avx512("xmm") : keys_avx2("xmm"), "%xmm0");
+    $code.=<<___;
+	vpxor	$t,%xmm0,%xmm0
+	vmovdqu	%xmm0,$dst
+___
+}
+
+# Clears the registers that held key material or data
+sub clear_regs {
+    my ($isa) = @_;
+
+    $code.="	vpxor	%xmm$_,%xmm$_,%xmm$_\n" for (0..5);
+    if ($isa eq "avx512") {
+	$code.="	vpxord	%xmm$_,%xmm$_,%xmm$_\n" for (16..31);
+    }
+    $code.="	vzeroupper\n";
+}
+
+sub xts {
+    my ($isa, $dir) = @_;
+    my $func = "ossl_aes_xts_${dir}rypt_vaes_$isa";
+    my ($w, $n) = $isa eq "avx512" ? ("zmm", 4) : ("ymm", 4);
+    my $lanes = $isa eq "avx512" ? 4 : 2;
+    my $bulk = 16 * $lanes * $n;
+    my $tmp = $isa eq "avx512" ? undef : 0;	# %xmm0 is free between blocks
+    my $L = ".Lxts_${dir}_$isa";
+
+    $code.=<<___;
+.globl	$func
+.type	$func,\@function,6
+.align	32
+$func:
+.cfi_startproc
+	endbranch
+___
+    xts_tweak();
+    if ($isa eq "avx512") {
+	load_keys_avx512($key);
+	# %zmm4 = [T, T*x, T*x^2, T*x^3]
+	$code.=<<___;
+	vshufi32x4	\$0,%zmm$tw,%zmm$tw,%zmm$tw
+	vpsrlvq	.Lxts_srlv(%rip),%zmm$tw,%zmm$t1
+	vpsllvq	.Lxts_sllv(%rip),%zmm$tw,%zmm$tw
+	vpclmulqdq	\$0x01,.Lxts_poly(%rip),%zmm$t1,%zmm$t2
+	vpslldq	\$8,%zmm$t1,%zmm$t1
+	vpternlogq	\$0x96,%zmm$t1,%zmm$t2,%zmm$tw
+___
+    } else {
+	load_keys_avx2();
+	# %ymm4 = [T, T*x]
+	$code.="	vmovdqa	%xmm$tw,%xmm3\n";
+	xts_mul($isa, "xmm", 3, 1, $tmp);
+	$code.="	vinserti128	\$1,%xmm3,%ymm$tw,%ymm$tw\n";
+    }
+    $code.=<<___;
+	mov	$len,%r9
+	and	\$-16,$len
+___
+    # the last full block takes part in the ciphertext stealing
+    $code.=<<___ if ($dir eq "dec");
+	test	\$15,%r9
+	jz	${L}_bulk
+	sub	\$16,$len
+${L}_bulk:
+___
+    $code.=<<___;
+	sub	\$$bulk,$len
+	jb	${L}_one_reg
+${L}_loop:
+___
+    xts_blocks($isa, $dir, $w, $n);
+    $code.=<<___;
+	lea	$bulk($inp),$inp
+	lea	$bulk($out),$out
+	sub	\$$bulk,$len
+	jae	${L}_loop
+${L}_one_reg:
+	add	\$`$bulk - 16 * $lanes`,$len
+	js	${L}_one_block
+${L}_loop_one_reg:
+___
+    xts_blocks($isa, $dir, $w, 1);
+    $code.=<<___;
+	lea	`16 * $lanes`($inp),$inp
+	lea	`16 * $lanes`($out),$out
+	sub	\$`16 * $lanes`,$len
+	jae	${L}_loop_one_reg
+${L}_one_block:
+	add	\$`16 * $lanes`,$len
+	jz	${L}_steal
+${L}_loop_one_block:
+___
+    xts_block($isa, $dir, "($inp)", "($out)", $tw);
+    xts_mul($isa, "xmm", $tw, 1, $tmp);
+    $code.=<<___;
+	lea	16($inp),$inp
+	lea	16($out),$out
+	sub	\$16,$len
+	jnz	${L}_loop_one_block
+${L}_steal:
+	and	\$15,%r9
+	jz	${L}_done
+	mov	%r9,%r8
+___
+    if ($dir eq "enc") {
+	# the partial block takes the head of the last ciphertext block,
+	# which is then encrypted again with what is left of the plaintext
+	$code.=<<___;
+${L}_steal_loop:
+	movzb	($inp),%r10d
+	movzb	-16($out),%edx
+	mov	%r10b,-16($out)
+	mov	%dl,($out)
+	lea	1($inp),$inp
+	lea	1($out),$out
+	dec	%r9
+	jnz	${L}_steal_loop
+	sub	%r8,$out
+___
+	xts_block($isa, $dir, "-16($out)", "-16($out)", $tw);
+    } else {
+	# the last full block is decrypted with the tweak after its own
+	$code.="	vmovdqa	%xmm$tw,%xmm3\n";
+	xts_mul($isa, "xmm", $tw, 1, $tmp);
+	xts_block($isa, $dir, "($inp)", "($out)", $tw);
+	$code.=<<___;
+${L}_steal_loop:
+	movzb	16($inp),%r10d
+	movzb	($out),%edx
+	mov	%dl,16($out)
+	mov	%r10b,($out)
+	lea	1($inp),$inp
+	lea	1($out),$out
+	dec	%r9
+	jnz	${L}_steal_loop
+	sub	%r8,$out
+___
+	xts_block($isa, $dir, "($out)", "($out)", 3);
+    }
+    $code.="${L}_done:\n";
+    clear_regs($isa);
+    $code.=<<___;
+	ret
+.cfi_endproc
+.size	$func,.-$func
+___
+}
+
+sub ctr32 {
+    my ($isa) = @_;
+    my $func = "ossl_aes_ctr32_encrypt_blocks_vaes_$isa";
+    my $avx512 = $isa eq "avx512";
+    my $w = $avx512 ? "zmm" : "ymm";
+    my $lanes = $avx512 ? 4 : 2;
+    my $n = 4;
+    my $keys = $avx512 ? keys_avx512($w) : keys_avx2($w);
+    my $mov = $avx512 ? "vmovdqu8" : "vmovdqu";
+    my $xor = $avx512 ? "vpxorq" : "vpxor";
+    my $c = reg($w, $tw);
+    my $L = ".Lctr32_$isa";
+    my $ivp = "%r8";
+
+    # $n registers of counter blocks, %[yz]mm4 holds the counters with
+    # their bytes reversed so that VPADDD increments them modulo 2^32
+    my $blocks = sub {
+	my ($n) = @_;
+	my @s = map { reg($w, $_) } (0..$n-1);
+
+	for (@s) {
+	    if ($avx512) {
+		$code.=<<___;
+	vpshufb	%zmm$t2,$c,$_
+	vpaddd	%zmm$t1,$c,$c
+___
+	    } else {
+		$code.=<<___;
+	vpshufb	.Lbswap_mask(%rip),$c,$_
+	vpaddd	.Lctr_two(%rip),$c,$c
+___
+	    }
+	}
+	my $rk0 = $keys->(0);
+	$code.="	$xor	$rk0,$_,$_\n" for (@s);
+	aes_rounds("vaesenc", $keys, @s);
+    };
+
+    $code.=<<___;
+.globl	$func
+.type	$func,\@function,5
+.align	32
+$func:
+.cfi_startproc
+	endbranch
+	test	$len,$len
+	jz	${L}_ret
+___
+    if ($avx512) {
+	load_keys_avx512($key);
+	$code.=<<___;
+	vbroadcasti32x4	.Lbswap_mask(%rip),%zmm$t2
+	vbroadcasti32x4	.Lctr_four(%rip),%zmm$t1
+	vbroadcasti32x4	($ivp),$c
+	vpshufb	%zmm$t2,$c,$c
+	vpaddd	.Lctr_lanes(%rip),$c,$c
+___
+    } else {
+	load_keys_avx2();
+	$code.=<<___;
+	vbroadcasti128	($ivp),$c
+	vpshufb	.Lbswap_mask(%rip),$c,$c
+	vpaddd	.Lctr_lanes(%rip),$c,$c
+___
+    }
+    $code.=<<___;
+	sub	\$`$n * $lanes`,$len
+	jb	${L}_one_reg
+${L}_loop:
+___
+    $blocks->($n);
+    for (0..$n-1) {
+	my $ofs = 16 * $lanes * $_;
+	$code.=<<___;
+	$xor	$ofs($inp),%$w$_,%$w$_
+	$mov	%$w$_,$ofs($out)
+___
+    }
+    $code.=<<___;
+	lea	`16 * $n * $lanes`($inp),$inp
+	lea	`16 * $n * $lanes`($out),$out
+	sub	\$`$n * $lanes`,$len
+	jae	${L}_loop
+${L}_one_reg:
+	add	\$`($n - 1) * $lanes`,$len
+	js	${L}_tail
+${L}_loop_one_reg:
+___
+    $blocks->(1);
+    $code.=<<___;
+	$xor	($inp),%${w}0,%${w}0
+	$mov	%${w}0,($out)
+	lea	`16 * $lanes`($inp),$inp
+	lea	`16 * $lanes`($out),$out
+	sub	\$$lanes,$len
+	jae	${L}_loop_one_reg
+${L}_tail:
+	add	\$$lanes,$len
+	jz	${L}_done
+___
+    if ($avx512) {
+	# one to three blocks left, load and store them with a byte mask
+	$code.=<<___;
+	mov	%edx,%ecx
+	shl	\$4,%ecx
+	mov	\$-1,%r10
+	shlq	%cl,%r10
+	not	%r10
+	kmovq	%r10,%k1
+	vmovdqu8	($inp),%zmm1{%k1}{z}
+___
+	$blocks->(1);
+	$code.=<<___;
+	vpxorq	%zmm1,%zmm0,%zmm0
+	vmovdqu8	%zmm0,($out){%k1}
+___
+    } else {
+	# one block left
+	$code.="	vpshufb	.Lbswap_mask(%rip),%xmm$tw,%xmm0\n";
+	$code.="	vpxor	($key),%xmm0,%xmm0\n";
+	aes_rounds("vaesenc", keys_avx2("xmm"), "%xmm0");
+	$code.=<<___;
+	vpxor	($inp),%xmm0,%xmm0
+	vmovdqu	%xmm0,($out)
+___
+    }
+    $code.="${L}_done:\n";
+    clear_regs($isa);
+    $code.=<<___;
+${L}_ret:
+	ret
+.cfi_endproc
+.size	$func,.-$func
+___
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+___
+
+for my $isa ("avx512", "avx2") {
+    my @caps = $isa eq "avx512" ? @avx512_caps : @avx2_caps;
+    my $mask = 0;
+
+    $mask |= 1 << $_ for (@caps);
+    $code.=<<___;
+.globl	ossl_aes_vaes_${isa}_capable
+.type	ossl_aes_vaes_${isa}_capable,\@abi-omnipotent
+.align	32
+ossl_aes_vaes_${isa}_capable:
+.cfi_startproc
+	mov	OPENSSL_ia32cap_P+8(%rip),%rcx
+	mov	\$$mask,%rdx
+	xor	%eax,%eax
+	and	%rdx,%rcx
+	cmp	%rdx,%rcx
+	cmove	%rcx,%rax
+	ret
+.cfi_endproc
+.size	ossl_aes_vaes_${isa}_capable,.-ossl_aes_vaes_${isa}_capable
+___
+    xts($isa, "enc");
+    xts($isa, "dec");
+    ctr32($isa);
+}
+
+$code.=<<___;
+.align	64
+.Lxts_poly:
+	.quad	0x87,0,0x87,0,0x87,0,0x87,0
+.Lxts_sllv:
+	.quad	0,0,1,1,2,2,3,3
+.Lxts_srlv:
+	.quad	64,64,63,63,62,62,61,61
+.Lbswap_mask:
+	.byte	15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0
+	.byte	15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0
+.Lctr_lanes:
+	.long	0,0,0,0,1,0,0,0,2,0,0,0,3,0,0,0
+.Lctr_two:
+	.long	2,0,0,0,2,0,0,0
+.Lctr_four:
+	.long	4,0,0,0
+.asciz	"AES-XTS and AES-CTR for x86_64 with VAES"
+.align	64
+___
+
+} else {
+# The assembler cannot encode VAES, the subroutines are never called.
+$code.=<<___;
+.text
+
+.globl	ossl_aes_vaes_avx512_capable
+.type	ossl_aes_vaes_avx512_capable,\@abi-omnipotent
+ossl_aes_vaes_avx512_capable:
+.globl	ossl_aes_vaes_avx2_capable
+ossl_aes_vaes_avx2_capable:
+	xor	%eax,%eax
+	ret
+.size	ossl_aes_vaes_avx512_capable,.-ossl_aes_vaes_avx512_capable
+
+.globl	ossl_aes_xts_encrypt_vaes_avx512
+.globl	ossl_aes_xts_decrypt_vaes_avx512
+.globl	ossl_aes_ctr32_encrypt_blocks_vaes_avx512
+.globl	ossl_aes_xts_encrypt_vaes_avx2
+.globl	ossl_aes_xts_decrypt_vaes_avx2
+.globl	ossl_aes_ctr32_encrypt_blocks_vaes_avx2
+.type	ossl_aes_xts_encrypt_vaes_avx512,\@abi-omnipotent
+ossl_aes_xts_encrypt_vaes_avx512:
+ossl_aes_xts_decrypt_vaes_avx512:
+ossl_aes_ctr32_encrypt_blocks_vaes_avx512:
+ossl_aes_xts_encrypt_vaes_avx2:
+ossl_aes_xts_decrypt_vaes_avx2:
+ossl_aes_ctr32_encrypt_blocks_vaes_avx2:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	ossl_aes_xts_encrypt_vaes_avx512,.-ossl_aes_xts_encrypt_vaes_avx512
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
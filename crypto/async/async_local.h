@@ -56,8 +56,16 @@ struct fd_lookup_st {
     struct fd_lookup_st *next;
 };
 
+struct async_wake_st {
+    const void *key;
+    void (*freed)(void *arg);
+    void *arg;
+    struct async_wake_st *next;
+};
+
 struct async_wait_ctx_st {
     struct fd_lookup_st *fds;
+    struct async_wake_st *wakes;
     size_t numadd;
     size_t numdel;
     ASYNC_callback_fn callback;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2020 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -11,6 +11,9 @@
 #include "async_local.h"
 
 #include <openssl/err.h>
+#if defined(ASYNC_POSIX)
+# include <fcntl.h>
+#endif
 
 ASYNC_WAIT_CTX *ASYNC_WAIT_CTX_new(void)
 {
@@ -21,10 +24,19 @@ void ASYNC_WAIT_CTX_free(ASYNC_WAIT_CTX *ctx)
 {
     struct fd_lookup_st *curr;
     struct fd_lookup_st *next;
+    struct async_wake_st *wake;
 
     if (ctx == NULL)
         return;
 
+    /* Tell the owners of the wake-up events first, the fds are still open */
+    while ((wake = ctx->wakes) != NULL) {
+        ctx->wakes = wake->next;
+        if (wake->freed != NULL)
+            wake->freed(wake->arg);
+        OPENSSL_free(wake);
+    }
+
     curr = ctx->fds;
     while (curr != NULL) {
         if (!curr->del) {
@@ -244,3 +256,162 @@ void async_wait_ctx_reset_counts(ASYNC_WAIT_CTX *ctx)
         curr = curr->next;
     }
 }
+
+/*
+ * Wake-up events for jobs that pause until some other job, or the code that
+ * runs the jobs, has done something on their behalf.  With a callback in
+ * the ASYNC_WAIT_CTX the callback is the event, otherwise a pipe is added
+ * under |key| for as long as the job is paused, and becomes readable on
+ * wake-up.  Either way |freed|, if not NULL, is called with |arg| when the
+ * wait context is freed while the event is still set.
+ */
+typedef struct {
+    OSSL_ASYNC_FD writefd;
+} async_wake_fd;
+
+static void async_wake_fd_cleanup(ASYNC_WAIT_CTX *ctx, const void *key,
+                                  OSSL_ASYNC_FD readfd, void *custom_data)
+{
+    async_wake_fd *wake = custom_data;
+
+#if defined(ASYNC_WIN)
+    CloseHandle(readfd);
+    CloseHandle(wake->writefd);
+#elif defined(ASYNC_POSIX)
+    close(readfd);
+    close(wake->writefd);
+#endif
+    OPENSSL_free(wake);
+}
+
+#if defined(ASYNC_POSIX)
+/*
+ * Neither end may leak into child processes, and a wake-up must not block
+ * the thread that runs the jobs.
+ */
+static int async_wake_pipe(OSSL_ASYNC_FD pipefds[2])
+{
+    int i, flags;
+
+    if (pipe(pipefds) != 0)
+        return 0;
+    for (i = 0; i < 2; i++) {
+        if (fcntl(pipefds[i], F_SETFD, FD_CLOEXEC) != 0
+            || (flags = fcntl(pipefds[i], F_GETFL)) == -1
+            || fcntl(pipefds[i], F_SETFL, flags | O_NONBLOCK) != 0) {
+            close(pipefds[0]);
+            close(pipefds[1]);
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
+static int async_wake_add_fd(ASYNC_WAIT_CTX *ctx, const void *key)
+{
+#if defined(ASYNC_WIN) || defined(ASYNC_POSIX)
+    OSSL_ASYNC_FD pipefds[2];
+    async_wake_fd *wake;
+
+    if ((wake = OPENSSL_malloc(sizeof(*wake))) == NULL)
+        return 0;
+# if defined(ASYNC_WIN)
+    /* Without security attributes the handles are not inherited */
+    if (CreatePipe(&pipefds[0], &pipefds[1], NULL, 256) == 0) {
+        OPENSSL_free(wake);
+        return 0;
+    }
+# else
+    if (!async_wake_pipe(pipefds)) {
+        OPENSSL_free(wake);
+        return 0;
+    }
+# endif
+    wake->writefd = pipefds[1];
+    if (!ASYNC_WAIT_CTX_set_wait_fd(ctx, key, pipefds[0], wake,
+                                    async_wake_fd_cleanup)) {
+        async_wake_fd_cleanup(ctx, key, pipefds[0], wake);
+        return 0;
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Called by a job right before it pauses to wait for its wake-up, which
+ * must be followed by ossl_async_wait_ctx_clear_wake_fd() once it runs
+ * again.
+ */
+int ossl_async_wait_ctx_set_wake_fd(ASYNC_WAIT_CTX *ctx, const void *key,
+                                    void (*freed)(void *arg), void *arg)
+{
+    struct async_wake_st *wake;
+
+    if ((wake = OPENSSL_malloc(sizeof(*wake))) == NULL)
+        return 0;
+    if (ctx->callback == NULL && !async_wake_add_fd(ctx, key)) {
+        OPENSSL_free(wake);
+        return 0;
+    }
+    wake->key = key;
+    wake->freed = freed;
+    wake->arg = arg;
+    wake->next = ctx->wakes;
+    ctx->wakes = wake;
+    return 1;
+}
+
+int ossl_async_wait_ctx_wake(ASYNC_WAIT_CTX *ctx, const void *key)
+{
+#if defined(ASYNC_WIN) || defined(ASYNC_POSIX)
+    OSSL_ASYNC_FD readfd;
+    async_wake_fd *wake;
+    char buf = 'X';
+# if defined(ASYNC_WIN)
+    DWORD numwritten;
+# endif
+#endif
+
+    if (ctx->callback != NULL)
+        return ctx->callback(ctx->callback_arg);
+#if defined(ASYNC_WIN) || defined(ASYNC_POSIX)
+    if (!ASYNC_WAIT_CTX_get_fd(ctx, key, &readfd, (void **)&wake))
+        return 0;
+# if defined(ASYNC_WIN)
+    return WriteFile(wake->writefd, &buf, 1, &numwritten, NULL) != 0;
+# else
+    return write(wake->writefd, &buf, 1) == 1;
+# endif
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Remove the event of a job that runs again from the wait context.  A
+ * pending wake-up goes away with the pipe, so there is nothing to read.
+ */
+void ossl_async_wait_ctx_clear_wake_fd(ASYNC_WAIT_CTX *ctx, const void *key)
+{
+    struct async_wake_st **pwake, *wake;
+#if defined(ASYNC_WIN) || defined(ASYNC_POSIX)
+    OSSL_ASYNC_FD readfd;
+    async_wake_fd *wakefd;
+
+    if (ASYNC_WAIT_CTX_get_fd(ctx, key, &readfd, (void **)&wakefd)) {
+        ASYNC_WAIT_CTX_clear_fd(ctx, key);
+        async_wake_fd_cleanup(ctx, key, readfd, wakefd);
+    }
+#endif
+
+    for (pwake = &ctx->wakes; (wake = *pwake) != NULL; pwake = &wake->next) {
+        if (wake->key == key) {
+            *pwake = wake->next;
+            OPENSSL_free(wake);
+            return;
+        }
+    }
+}
@@ -82,6 +82,21 @@
 #  define BIO_CMSG_LEN(x) CMSG_LEN(x)
 # endif
 
+/*
+ * UDP segmentation offload (UDP_SEGMENT) and receive coalescing (UDP_GRO) are
+ * Linux-specific and can only be used where we use msghdr-based I/O.
+ */
+# if (M_METHOD == M_METHOD_RECVMMSG || M_METHOD == M_METHOD_RECVMSG) \
+    && defined(OPENSSL_SYS_LINUX)
+#  include <netinet/udp.h>
+#  if defined(UDP_SEGMENT)
+#   define SUPPORT_SEG_TX
+#  endif
+#  if defined(UDP_GRO)
+#   define SUPPORT_SEG_RX
+#  endif
+# endif
+
 # if   M_METHOD == M_METHOD_RECVMMSG   \
     || M_METHOD == M_METHOD_RECVMSG    \
     || M_METHOD == M_METHOD_WSARECVMSG
@@ -107,10 +122,17 @@
 #   else
 #     define BIO_CMSG_ALLOC_LEN_3   0
 #   endif
+#   if defined(SUPPORT_SEG_TX) || defined(SUPPORT_SEG_RX)
+    /* UDP_SEGMENT takes a uint16_t, UDP_GRO returns an int. */
+#     define BIO_CMSG_ALLOC_LEN_SEG BIO_CMSG_SPACE(sizeof(int))
+#   else
+#     define BIO_CMSG_ALLOC_LEN_SEG 0
+#   endif
 #   define BIO_MAX(X,Y) ((X) > (Y) ? (X) : (Y))
 #   define BIO_CMSG_ALLOC_LEN                                        \
-        BIO_MAX(BIO_CMSG_ALLOC_LEN_1,                                \
-                BIO_MAX(BIO_CMSG_ALLOC_LEN_2, BIO_CMSG_ALLOC_LEN_3))
+        (BIO_MAX(BIO_CMSG_ALLOC_LEN_1,                               \
+                 BIO_MAX(BIO_CMSG_ALLOC_LEN_2, BIO_CMSG_ALLOC_LEN_3)) \
+         + BIO_CMSG_ALLOC_LEN_SEG)
 #  endif
 #  if (defined(IP_PKTINFO) || defined(IP_RECVDSTADDR)) && defined(IPV6_RECVPKTINFO)
 #   define SUPPORT_LOCAL_ADDR
@@ -196,6 +218,7 @@ typedef struct bio_dgram_data_st {
     OSSL_TIME socket_timeout;
     unsigned int peekmode;
     char local_addr_enabled;
+    char rx_seg_enabled;
 } bio_dgram_data;
 
 # ifndef OPENSSL_NO_SCTP
@@ -522,6 +545,37 @@ static int enable_local_addr(BIO *b, int enable) {
 }
 # endif
 
+/* Determines which of UDP_SEGMENT and UDP_GRO the socket supports. */
+static uint32_t dgram_get_seg_cap(BIO *b)
+{
+    uint32_t caps = 0;
+# if defined(SUPPORT_SEG_TX) || defined(SUPPORT_SEG_RX)
+    int val = 0;
+    socklen_t len;
+# endif
+
+# if defined(SUPPORT_SEG_TX)
+    len = sizeof(val);
+    if (getsockopt(b->num, IPPROTO_UDP, UDP_SEGMENT, &val, &len) == 0)
+        caps |= BIO_DGRAM_SEG_CAP_TX;
+# endif
+# if defined(SUPPORT_SEG_RX)
+    len = sizeof(val);
+    if (getsockopt(b->num, IPPROTO_UDP, UDP_GRO, &val, &len) == 0)
+        caps |= BIO_DGRAM_SEG_CAP_RX;
+# endif
+
+    return caps;
+}
+
+# if defined(SUPPORT_SEG_RX)
+static int enable_rx_seg(BIO *b, int enable)
+{
+    return setsockopt(b->num, IPPROTO_UDP, UDP_GRO,
+                      &enable, sizeof(enable)) == 0;
+}
+# endif
+
 static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
 {
     long ret = 1;
@@ -560,6 +614,10 @@ static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
             if (enable_local_addr(b, 1) < 1)
                 data->local_addr_enabled = 0;
         }
+# endif
+# if defined(SUPPORT_SEG_RX)
+        if (data->rx_seg_enabled && !enable_rx_seg(b, 1))
+            data->rx_seg_enabled = 0;
 # endif
         break;
     case BIO_C_GET_FD:
@@ -945,6 +1003,30 @@ static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
         *(int *)ptr = data->local_addr_enabled;
         break;
 
+    case BIO_CTRL_DGRAM_GET_SEG_CAP:
+        ret = (long)dgram_get_seg_cap(b);
+        break;
+
+    case BIO_CTRL_DGRAM_SET_RX_SEG_ENABLE:
+# if defined(SUPPORT_SEG_RX)
+        num = num > 0;
+        if (num != data->rx_seg_enabled) {
+            if (!enable_rx_seg(b, num)) {
+                ret = 0;
+                break;
+            }
+
+            data->rx_seg_enabled = (char)num;
+        }
+# else
+        ret = 0;
+# endif
+        break;
+
+    case BIO_CTRL_DGRAM_GET_RX_SEG_ENABLE:
+        *(int *)ptr = data->rx_seg_enabled;
+        break;
+
     case BIO_CTRL_GET_RPOLL_DESCRIPTOR:
     case BIO_CTRL_GET_WPOLL_DESCRIPTOR:
         {
@@ -1008,9 +1090,13 @@ static void translate_msg_win(BIO *b, WSAMSG *mh, WSABUF *iov,
 # endif
 
 # if M_METHOD == M_METHOD_RECVMMSG || M_METHOD == M_METHOD_RECVMSG
-/* Translates a BIO_MSG to a msghdr and iovec. */
+/*
+ * Translates a BIO_MSG to a msghdr and iovec. The control buffer is attached if
+ * a local address is requested or use_control is set.
+ */
 static void translate_msg(BIO *b, struct msghdr *mh, struct iovec *iov,
-                          unsigned char *control, BIO_MSG *msg)
+                          unsigned char *control, BIO_MSG *msg,
+                          int use_control)
 {
     iov->iov_base = msg->data;
     iov->iov_len  = msg->data_len;
@@ -1028,8 +1114,9 @@ static void translate_msg(BIO *b, struct msghdr *mh, struct iovec *iov,
 
     mh->msg_iov         = iov;
     mh->msg_iovlen      = 1;
-    mh->msg_control     = msg->local != NULL ? control : NULL;
-    mh->msg_controllen  = msg->local != NULL ? BIO_CMSG_ALLOC_LEN : 0;
+    use_control         = use_control || msg->local != NULL;
+    mh->msg_control     = use_control ? control : NULL;
+    mh->msg_controllen  = use_control ? BIO_CMSG_ALLOC_LEN : 0;
     mh->msg_flags       = 0;
 }
 # endif
@@ -1231,6 +1318,84 @@ static int pack_local(BIO *b, MSGHDR_TYPE *mh, const BIO_ADDR *local) {
 }
 # endif
 
+/*
+ * Returns the segment size with which a BIO_MSG passed to BIO_sendmmsg must be
+ * split into multiple datagrams, or 0 if it is sent as a single datagram. Only
+ * a BIO_MSG_SEG passed with BIO_MMSG_FLAG_SEG carries a segment size.
+ */
+static ossl_inline size_t msg_seg_len(const BIO_MSG *msg, size_t stride,
+                                      uint64_t flags)
+{
+    size_t seg_len;
+
+    if ((flags & BIO_MMSG_FLAG_SEG) == 0 || stride < sizeof(BIO_MSG_SEG))
+        return 0;
+
+    seg_len = ((const BIO_MSG_SEG *)msg)->seg_len;
+    return seg_len < msg->data_len ? seg_len : 0;
+}
+
+/* Writes the segment size of a received BIO_MSG_SEG, if the caller asked. */
+static ossl_inline void msg_set_seg_len(BIO_MSG *msg, size_t stride,
+                                        uint64_t flags, size_t seg_len)
+{
+    if ((flags & BIO_MMSG_FLAG_SEG) != 0 && stride >= sizeof(BIO_MSG_SEG))
+        ((BIO_MSG_SEG *)msg)->seg_len = seg_len;
+}
+
+# if defined(SUPPORT_SEG_TX)
+/*
+ * Appends a UDP_SEGMENT control message to a msghdr prepared by
+ * translate_msg() and, if have_local is set, pack_local().
+ */
+static int pack_seg(struct msghdr *mh, unsigned char *control,
+                    int have_local, size_t seg_len)
+{
+    struct cmsghdr *cmsg;
+    size_t off = have_local ? mh->msg_controllen : 0;
+    uint16_t v = (uint16_t)seg_len;
+
+    if (seg_len > UINT16_MAX
+        || off + BIO_CMSG_SPACE(sizeof(uint16_t)) > BIO_CMSG_ALLOC_LEN) {
+        ERR_raise(ERR_LIB_BIO, ERR_R_PASSED_INVALID_ARGUMENT);
+        return 0;
+    }
+
+    cmsg = (struct cmsghdr *)(control + off);
+    cmsg->cmsg_len   = BIO_CMSG_LEN(sizeof(uint16_t));
+    cmsg->cmsg_level = IPPROTO_UDP;
+    cmsg->cmsg_type  = UDP_SEGMENT;
+    memcpy(BIO_CMSG_DATA(cmsg), &v, sizeof(v));
+
+    mh->msg_control     = control;
+    mh->msg_controllen  = off + BIO_CMSG_SPACE(sizeof(uint16_t));
+    return 1;
+}
+# endif
+
+# if defined(SUPPORT_SEG_RX)
+/*
+ * Returns the segment size of a datagram coalesced by UDP_GRO, or 0 if the
+ * datagram was not coalesced.
+ */
+static size_t extract_seg(struct msghdr *mh)
+{
+    struct cmsghdr *cmsg;
+    int gso_size;
+
+    for (cmsg = BIO_CMSG_FIRSTHDR(mh); cmsg != NULL;
+         cmsg = BIO_CMSG_NXTHDR(mh, cmsg)) {
+        if (cmsg->cmsg_level != IPPROTO_UDP || cmsg->cmsg_type != UDP_GRO)
+            continue;
+
+        memcpy(&gso_size, BIO_CMSG_DATA(cmsg), sizeof(gso_size));
+        return gso_size > 0 ? (size_t)gso_size : 0;
+    }
+
+    return 0;
+}
+# endif
+
 /*
  * Converts flags passed to BIO_sendmmsg or BIO_recvmmsg to syscall flags. You
  * should mask out any system flags returned by this function you cannot support
@@ -1257,6 +1422,7 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     struct iovec iov[BIO_MAX_MSGS_PER_CALL];
     unsigned char control[BIO_MAX_MSGS_PER_CALL][BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+    size_t seg_len;
 # elif M_METHOD == M_METHOD_RECVMSG
     int sysflags;
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
@@ -1265,6 +1431,7 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     struct iovec iov;
     unsigned char control[BIO_CMSG_ALLOC_LEN];
     int have_local_enabled = data->local_addr_enabled;
+    size_t seg_len;
 # elif M_METHOD == M_METHOD_WSARECVMSG
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
     int have_local_enabled = data->local_addr_enabled;
@@ -1302,7 +1469,7 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
 
     for (i = 0; i < num_msg; ++i) {
         translate_msg(b, &mh[i].msg_hdr, &iov[i],
-                      control[i], &BIO_MSG_N(msg, stride, i));
+                      control[i], &BIO_MSG_N(msg, stride, i), 0);
 
         /* If local address was requested, it must have been enabled */
         if (BIO_MSG_N(msg, stride, i).local != NULL) {
@@ -1319,6 +1486,21 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
                 return 0;
             }
         }
+
+        seg_len = msg_seg_len(&BIO_MSG_N(msg, stride, i), stride, flags);
+        if (seg_len > 0) {
+#  if defined(SUPPORT_SEG_TX)
+            if (!pack_seg(&mh[i].msg_hdr, control[i],
+                          BIO_MSG_N(msg, stride, i).local != NULL, seg_len)) {
+                *num_processed = 0;
+                return 0;
+            }
+#  else
+            ERR_raise(ERR_LIB_BIO, BIO_R_UNSUPPORTED_METHOD);
+            *num_processed = 0;
+            return 0;
+#  endif
+        }
     }
 
     /* Do the batch */
@@ -1341,7 +1523,7 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     /*
      * If sendmsg is available, use it.
      */
-    translate_msg(b, &mh, &iov, control, msg);
+    translate_msg(b, &mh, &iov, control, msg, 0);
 
     if (msg->local != NULL) {
         if (!have_local_enabled) {
@@ -1357,6 +1539,20 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
         }
     }
 
+    seg_len = msg_seg_len(msg, stride, flags);
+    if (seg_len > 0) {
+#  if defined(SUPPORT_SEG_TX)
+        if (!pack_seg(&mh, control, msg->local != NULL, seg_len)) {
+            *num_processed = 0;
+            return 0;
+        }
+#  else
+        ERR_raise(ERR_LIB_BIO, BIO_R_UNSUPPORTED_METHOD);
+        *num_processed = 0;
+        return 0;
+#  endif
+    }
+
     l = sendmsg(b->num, &mh, sysflags);
     if (l < 0) {
         ERR_raise(ERR_LIB_SYS, get_last_socket_error());
@@ -1370,6 +1566,13 @@ static int dgram_sendmmsg(BIO *b, BIO_MSG *msg, size_t stride,
     return 1;
 
 # elif M_METHOD == M_METHOD_WSARECVMSG || M_METHOD == M_METHOD_RECVFROM
+    /* Segmentation offload is not available with these methods. */
+    if (msg_seg_len(msg, stride, flags) > 0) {
+        ERR_raise(ERR_LIB_BIO, BIO_R_UNSUPPORTED_METHOD);
+        *num_processed = 0;
+        return 0;
+    }
+
 #  if M_METHOD == M_METHOD_WSARECVMSG
     if (bio_WSASendMsg != NULL) {
         /* WSASendMsg-based implementation for Windows. */
@@ -1504,7 +1707,8 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
 
     for (i = 0; i < num_msg; ++i) {
         translate_msg(b, &mh[i].msg_hdr, &iov[i],
-                      control[i], &BIO_MSG_N(msg, stride, i));
+                      control[i], &BIO_MSG_N(msg, stride, i),
+                      data->rx_seg_enabled);
 
         /* If local address was requested, it must have been enabled */
         if (BIO_MSG_N(msg, stride, i).local != NULL && !have_local_enabled) {
@@ -1525,6 +1729,12 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
     for (i = 0; i < (size_t)ret; ++i) {
         BIO_MSG_N(msg, stride, i).data_len = mh[i].msg_len;
         BIO_MSG_N(msg, stride, i).flags    = 0;
+#  if defined(SUPPORT_SEG_RX)
+        msg_set_seg_len(&BIO_MSG_N(msg, stride, i), stride, flags,
+                        data->rx_seg_enabled ? extract_seg(&mh[i].msg_hdr) : 0);
+#  else
+        msg_set_seg_len(&BIO_MSG_N(msg, stride, i), stride, flags, 0);
+#  endif
         /*
          * *(msg->peer) will have been filled in by recvmmsg;
          * for msg->local we parse the control data returned
@@ -1548,7 +1758,7 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
     /*
      * If recvmsg is available, use it.
      */
-    translate_msg(b, &mh, &iov, control, msg);
+    translate_msg(b, &mh, &iov, control, msg, data->rx_seg_enabled);
 
     /* If local address was requested, it must have been enabled */
     if (msg->local != NULL && !have_local_enabled) {
@@ -1570,6 +1780,12 @@ static int dgram_recvmmsg(BIO *b, BIO_MSG *msg,
 
     msg->data_len   = (size_t)l;
     msg->flags      = 0;
+#  if defined(SUPPORT_SEG_RX)
+    msg_set_seg_len(msg, stride, flags,
+                    data->rx_seg_enabled ? extract_seg(&mh) : 0);
+#  else
+    msg_set_seg_len(msg, stride, flags, 0);
+#  endif
 
     if (msg->local != NULL)
         if (extract_local(b, &mh, msg->local) < 1)
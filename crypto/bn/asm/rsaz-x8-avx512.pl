@@ -0,0 +1,256 @@
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+#
+# Multi-lane Almost Montgomery Multiplication in 2^52 radix for 20-digit
+# (1024-bit) moduli, the CRT halves of RSA-2048.
+#
+# Unlike rsaz-2k-avx512.pl, which spreads the digits of one or two numbers
+# across vector registers, here each vector lane holds a different number:
+# register j holds digit j of every lane, with an independent modulus and
+# k0 per lane.  Lanes never interact, so the multiplication is the plain
+# digit-serial algorithm executed on vectors: no cross-lane shifts, no
+# scalar computation of y[i] and no carry propagation until the end.
+#
+# The accumulator lives in 20 registers which are renamed rather than
+# shifted after every digit of b[], so the loop is fully unrolled.  Each
+# digit collects at most four 52-bit products per iteration, 80 in all,
+# which fits in 64 bits.  Together with b[i] and y[i] this uses the 22
+# vector registers that are volatile in the Win64 ABI.
+#
+# Eight lanes of zmm registers measured about 4 times the throughput of
+# ossl_rsaz_amm52x20_x2_ifma256 per multiplication on Ice Lake server,
+# while four lanes of ymm registers gained less than half of that.
+#
+# [1] Gueron, S. Efficient software implementations of modular exponentiation.
+#     DOI: 10.1007/s13389-012-0031-5
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+$avx512ifma=0;
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+        =~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+    $avx512ifma = ($1>=2.26);
+}
+
+if (!$avx512ifma && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+       `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)(?:\.([0-9]+))?/) {
+    $avx512ifma = ($1==2.11 && $2>=8) + ($1>=2.12);
+}
+
+if (!$avx512ifma && `$ENV{CC} -v 2>&1`
+    =~ /(Apple)?\s*((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)\.([0-9]+)?/) {
+    my $ver = $3 + $4/100.0 + $5/10000.0; # 3.1.0->3.01, 3.10.1->3.1001
+    if ($1) {
+        # Apple conditions, they use a different version series, see
+        # https://en.wikipedia.org/wiki/Xcode#Xcode_7.0_-_10.x_(since_Free_On-Device_Development)_2
+        # clang 7.0.0 is Apple clang 10.0.1
+        $avx512ifma = ($ver>=10.0001)
+    } else {
+        $avx512ifma = ($ver>=7.0);
+    }
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+my $digits = 20;
+my $L = 8;                  # lanes
+my $stride = 8 * $L;        # bytes per digit of all lanes
+
+if ($avx512ifma>0) {{{
+my ($res,$a,$b,$m,$k0) = ("%rdi","%rsi","%rdx","%rcx","%r8");
+
+$code.=<<___;
+.text
+___
+
+# The 22 registers that are volatile in the Win64 ABI
+my @V = map("%zmm$_", (0..5, 16..31));
+my ($Bi, $Yi) = splice(@V, 0, 2);
+my @R = @V;				# 20 accumulator digits
+
+###############################################################################
+# void ossl_rsaz_amm52x20_x8_ifma512(BN_ULONG out[20][8],
+#                                    const BN_ULONG a[20][8],
+#                                    const BN_ULONG b[20][8],
+#                                    const BN_ULONG m[20][8],
+#                                    const BN_ULONG k0[8]);
+#
+# out = a * b / 2^1040 mod m in each lane, out < 2*m, for a, b < 2*m.
+# All arrays are digit-major and 64-byte aligned, digits are
+# normalized on input and output.  |out| may alias |a| or |b|.
+###############################################################################
+$code.=<<___;
+.globl  ossl_rsaz_amm52x20_x8_ifma512
+.type   ossl_rsaz_amm52x20_x8_ifma512,\@function,5
+.align 32
+ossl_rsaz_amm52x20_x8_ifma512:
+.cfi_startproc
+    endbranch
+___
+    foreach my $j (0..$digits-1) {
+$code.=<<___;
+    vpxorq  $R[$j], $R[$j], $R[$j]
+___
+    }
+    foreach my $i (0..$digits-1) {
+$code.=<<___;
+    vmovdqa64   `$stride*$i`($b), $Bi
+    vpxorq      $Yi, $Yi, $Yi
+___
+        # acc += lo(a * b[i]), then y[i] = acc[0] * k0 mod 2^52
+        foreach my $j (0..$digits-1) {
+$code.=<<___;
+    vpmadd52luq `$stride*$j`($a), $Bi, $R[$j]
+___
+        }
+$code.=<<___;
+    vpmadd52luq ($k0), $R[0], $Yi
+___
+        # acc += lo(m * y[i]), which clears the low 52 bits of acc[0]
+        foreach my $j (0..$digits-1) {
+$code.=<<___;
+    vpmadd52luq `$stride*$j`($m), $Yi, $R[$j]
+___
+        }
+        # Carry acc[0] into acc[1] and recycle its register as the new top
+        # digit, which receives only high halves
+$code.=<<___;
+    vpsrlq      \$52, $R[0], $R[0]
+    vpaddq      $R[0], $R[1], $R[1]
+    vpxorq      $R[0], $R[0], $R[0]
+___
+        push(@R, shift(@R));
+        foreach my $j (0..$digits-1) {
+$code.=<<___;
+    vpmadd52huq `$stride*$j`($a), $Bi, $R[$j]
+    vpmadd52huq `$stride*$j`($m), $Yi, $R[$j]
+___
+        }
+    }
+    # Normalize to 52-bit digits.  The result is below 2*m < 2^1025, so
+    # nothing is carried out of the top digit.
+    foreach my $j (0..$digits-2) {
+$code.=<<___;
+    vpsrlq      \$52, $R[$j], $Bi
+    vpandq      .Lmask52x8(%rip), $R[$j], $R[$j]
+    vpaddq      $Bi, $R[$j+1], $R[$j+1]
+    vmovdqu64   $R[$j], `$stride*$j`($res)
+___
+    }
+$code.=<<___;
+    vmovdqu64   $R[$digits-1], `$stride*($digits-1)`($res)
+
+    vzeroupper
+    ret
+.cfi_endproc
+.size   ossl_rsaz_amm52x20_x8_ifma512, .-ossl_rsaz_amm52x20_x8_ifma512
+___
+
+###############################################################################
+# Constant time extraction of one table entry per lane.
+#
+# void ossl_extract_multiplier_8x20_win5(BN_ULONG out[20][8],
+#                                        const BN_ULONG table[32][20][8],
+#                                        const BN_ULONG idx[8]);
+#
+# Every table entry is read in full whatever the indices are.  The digits
+# are gathered in two halves to leave registers for the comparison.
+###############################################################################
+my ($out,$tbl,$idx) = $win64 ? ("%rcx","%rdx","%r8") : ("%rdi","%rsi","%rdx");
+my ($Idx, $Cur, $T) = ($Bi, $Yi, $R[$digits-1]);
+my @D = @R[0..$digits/2-1];
+
+$code.=<<___;
+.globl  ossl_extract_multiplier_8x20_win5
+.type   ossl_extract_multiplier_8x20_win5,\@abi-omnipotent
+.align 32
+ossl_extract_multiplier_8x20_win5:
+.cfi_startproc
+    endbranch
+    vmovdqu64   ($idx), $Idx
+___
+    foreach my $h (0..1) {
+        my $off = $h * $stride * $digits / 2;
+$code.=<<___;
+    vpxorq      $Cur, $Cur, $Cur
+    lea         `$off`($tbl), %rax
+    mov         \$32, %r9d
+___
+        foreach my $j (0..$#D) {
+$code.=<<___;
+    vpxorq      $D[$j], $D[$j], $D[$j]
+___
+        }
+$code.=<<___;
+.Lextract_x8_loop$h:
+    vpcmpeqq    $Cur, $Idx, %k1
+___
+        foreach my $j (0..$#D) {
+$code.=<<___;
+    vmovdqu64   `$stride*$j`(%rax), $T
+    vmovdqa64   $T, $D[$j]\{%k1\}
+___
+        }
+$code.=<<___;
+    vpaddq      .Lones8(%rip), $Cur, $Cur
+    lea         `$stride*$digits`(%rax), %rax
+    dec         %r9d
+    jnz         .Lextract_x8_loop$h
+___
+        foreach my $j (0..$#D) {
+$code.=<<___;
+    vmovdqu64   $D[$j], `$off+$stride*$j`($out)
+___
+        }
+    }
+$code.=<<___;
+
+    vzeroupper
+    ret
+.cfi_endproc
+.size   ossl_extract_multiplier_8x20_win5, .-ossl_extract_multiplier_8x20_win5
+
+.data
+.align 64
+.Lmask52x8:
+    .quad   0xfffffffffffff,0xfffffffffffff,0xfffffffffffff,0xfffffffffffff
+    .quad   0xfffffffffffff,0xfffffffffffff,0xfffffffffffff,0xfffffffffffff
+.Lones8:
+    .quad   1,1,1,1,1,1,1,1
+___
+
+}}} else {{{                # fallback for old assembler
+$code.=<<___;
+.text
+
+.globl  ossl_rsaz_amm52x20_x8_ifma512
+.globl  ossl_extract_multiplier_8x20_win5
+.type   ossl_rsaz_amm52x20_x8_ifma512,\@abi-omnipotent
+ossl_rsaz_amm52x20_x8_ifma512:
+ossl_extract_multiplier_8x20_win5:
+    .byte   0x0f,0x0b    # ud2
+    ret
+.size   ossl_rsaz_amm52x20_x8_ifma512, .-ossl_rsaz_amm52x20_x8_ifma512
+___
+}}}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -9,6 +9,7 @@
 
 #include "internal/cryptlib.h"
 #include "internal/constant_time.h"
+#include "internal/tsan_assist.h"
 #include "bn_local.h"
 
 #include <stdlib.h>
@@ -33,6 +34,45 @@
 # define SPARC_T4_MONT
 #endif
 
+/*
+ * Per code path counts of constant time exponentiations, reported by
+ * BN_mod_exp_path_count().  The FIPS provider does not keep them, so
+ * exponentiations it performs are not counted in libcrypto either.
+ */
+#if !defined(FIPS_MODULE) && !defined(TSAN_REQUIRES_LOCKING)
+static TSAN_QUALIFIER size_t mod_exp_path_count[BN_MOD_EXP_PATH_NUM];
+
+# define MOD_EXP_PATH_ADD(path, n) tsan_add(&mod_exp_path_count[path], (n))
+# define MOD_EXP_PATH_LOAD(path)   tsan_load(&mod_exp_path_count[path])
+#else
+# define MOD_EXP_PATH_ADD(path, n) (void)0
+# define MOD_EXP_PATH_LOAD(path)   0
+#endif
+
+static const char *const mod_exp_path_names[BN_MOD_EXP_PATH_NUM] = {
+    "generic",
+    "mont5",
+    "sparc-t4",
+    "rsaz-512",
+    "rsaz-avx2",
+    "rsaz-x2-avx512-ifma",
+    "rsaz-x8-avx512-ifma"
+};
+
+size_t BN_mod_exp_path_count(int path)
+{
+    if (path < 0 || path >= BN_MOD_EXP_PATH_NUM)
+        return 0;
+    return MOD_EXP_PATH_LOAD(path);
+}
+
+const char *BN_mod_exp_path_name(int path)
+{
+    if (path < 0 || path >= BN_MOD_EXP_PATH_NUM)
+        return NULL;
+    return mod_exp_path_names[path];
+}
+
 /* maximum precomputation table size for *variable* sliding windows */
 #define TABLE_SIZE      32
 
@@ -603,7 +643,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
                               BN_MONT_CTX *in_mont)
 {
     int i, bits, ret = 0, window, wvalue, wmask, window0;
-    int top;
+    int top, path = BN_MOD_EXP_PATH_GENERIC;
     BN_MONT_CTX *mont = NULL;
 
     int numPowers;
@@ -686,6 +726,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
         rr->top = 16;
         rr->neg = 0;
         bn_correct_top(rr);
+        MOD_EXP_PATH_ADD(BN_MOD_EXP_PATH_RSAZ_AVX2, 1);
         ret = 1;
         goto err;
     } else if ((8 == a->top) && (8 == p->top) && (BN_num_bits(m) == 512)) {
@@ -695,6 +736,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
         rr->top = 8;
         rr->neg = 0;
         bn_correct_top(rr);
+        MOD_EXP_PATH_ADD(BN_MOD_EXP_PATH_RSAZ_512, 1);
         ret = 1;
         goto err;
     }
@@ -909,6 +951,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
         top *= 2;
         /* back to 32-bit domain */
         tmp.top = top;
+        path = BN_MOD_EXP_PATH_SPARC_T4;
         bn_correct_top(&tmp);
         OPENSSL_cleanse(np, top * sizeof(BN_ULONG));
     } else
@@ -1031,6 +1074,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
         }
 
         tmp.top = top;
+        path = BN_MOD_EXP_PATH_MONT5;
         /*
          * The result is now in |tmp| in Montgomery form, but it may not be
          * fully reduced. This is within bounds for |BN_from_montgomery|
@@ -1140,6 +1184,7 @@ int BN_mod_exp_mont_consttime(BIGNUM *rr, const BIGNUM *a, const BIGNUM *p,
 #endif
     if (!BN_from_montgomery(rr, &tmp, mont, ctx))
         goto err;
+    MOD_EXP_PATH_ADD(path, 1);
     ret = 1;
  err:
     if (in_mont == NULL)
@@ -1478,6 +1523,8 @@ int BN_mod_exp_mont_consttime_x2(BIGNUM *rr1, const BIGNUM *a1, const BIGNUM *p1
                                           rr2->d, a2->d, p2->d, m2->d,
                                           mont2->RR.d, mont2->n0[0],
                                           mod_bits);
+        if (ret)
+            MOD_EXP_PATH_ADD(BN_MOD_EXP_PATH_RSAZ_X2_AVX512_IFMA, 2);
 
         rr1->top = topn;
         rr1->neg = 0;
@@ -1508,3 +1555,81 @@ err:
 
     return ret;
 }
+
+/*
+ * The number of exponentiations modulo |m| that
+ * ossl_bn_mod_exp_mont_consttime_many() can run side by side in the lanes
+ * of one vector kernel, or 0 if there is no such kernel for |m|.
+ */
+int ossl_bn_mod_exp_mont_consttime_lanes(const BIGNUM *m)
+{
+#ifdef RSAZ_ENABLED
+    if (ossl_rsaz_avx512ifma_eligible() && BN_num_bits(m) == 1024)
+        return 8;
+#endif
+    return 0;
+}
+
+/*
+ * rr[i] = a[i]^p[i] mod m[i] for i = 0..num - 1 in constant time, with the
+ * moduli, exponents and Montgomery contexts all independent of each other.
+ * With AVX512_IFMA, 1024-bit moduli are processed eight at a time in the
+ * lanes of ossl_rsaz_mod_exp_avx512_x8(), which is worth padding for as soon
+ * as more than two remain.  The rest goes through
+ * BN_mod_exp_mont_consttime_x2() in pairs.
+ */
+int ossl_bn_mod_exp_mont_consttime_many(BIGNUM *rr[], const BIGNUM *a[],
+                                        const BIGNUM *p[], const BIGNUM *m[],
+                                        BN_MONT_CTX *mont[], size_t num,
+                                        BN_CTX *ctx)
+{
+    size_t i = 0;
+    int ret = 1;
+
+#ifdef RSAZ_ENABLED
+    while (num - i > 2) {
+        BN_ULONG *res[8];
+        const BN_ULONG *base[8], *exp[8], *mod[8], *RR[8];
+        BN_ULONG k0[8];
+        size_t j, n = num - i < 8 ? num - i : 8;
+
+        for (j = 0; j < n; j++) {
+            size_t k = i + j;
+
+            if (mont[k] == NULL || a[k]->top != 16 || p[k]->top != 16
+                || ossl_bn_mod_exp_mont_consttime_lanes(m[k]) == 0
+                || bn_wexpand(rr[k], 16) == NULL)
+                break;
+            res[j] = rr[k]->d;
+            base[j] = a[k]->d;
+            exp[j] = p[k]->d;
+            mod[j] = m[k]->d;
+            RR[j] = mont[k]->RR.d;
+            k0[j] = mont[k]->n0[0];
+        }
+        if (j < n || !ossl_rsaz_mod_exp_avx512_x8(res, base, exp, mod, RR,
+                                                  k0, (int)n))
+            break;
+
+        for (j = 0; j < n; j++) {
+            BIGNUM *r = rr[i + j];
+
+            r->top = 16;
+            r->neg = 0;
+            bn_correct_top(r);
+            bn_check_top(r);
+        }
+        MOD_EXP_PATH_ADD(BN_MOD_EXP_PATH_RSAZ_X8_AVX512_IFMA, n);
+        i += n;
+    }
+#endif
+
+    for (; i + 1 < num; i += 2)
+        ret &= BN_mod_exp_mont_consttime_x2(rr[i], a[i], p[i], m[i], mont[i],
+                                            rr[i + 1], a[i + 1], p[i + 1],
+                                            m[i + 1], mont[i + 1], ctx);
+    if (i < num)
+        ret &= BN_mod_exp_mont_consttime(rr[i], a[i], p[i], m[i], ctx,
+                                         mont[i]);
+    return ret;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <openssl/opensslconf.h>
+#include <openssl/crypto.h>
+#include "rsaz_exp.h"
+
+#ifndef RSAZ_ENABLED
+NON_EMPTY_TRANSLATION_UNIT
+#else
+# include <string.h>
+
+# define ALIGN_OF(ptr, boundary) \
+    ((unsigned char *)(ptr) + (boundary - (((size_t)(ptr)) & (boundary - 1))))
+
+/* Internal radix */
+# define DIGIT_SIZE (52)
+/* 52-bit mask */
+# define DIGIT_MASK ((uint64_t)0xFFFFFFFFFFFFF)
+
+/* Lanes of the kernel, one independent exponentiation each */
+# define LANES      8
+/* Digits of a 1024-bit modulus in 2^52 radix */
+# define RED_DIGITS 20
+/* Qwords of a 1024-bit modulus in 2^64 radix */
+# define WORDS      16
+
+/* Exponent window size */
+# define EXP_WIN_SIZE 5
+
+/*
+ * For details of the methods declared below please refer to
+ *    crypto/bn/asm/rsaz-x8-avx512.pl
+ *
+ * All operands are digit-major: digit j of lane l is at [j * LANES + l].
+ */
+void ossl_rsaz_amm52x20_x8_ifma512(BN_ULONG *out, const BN_ULONG *a,
+                                   const BN_ULONG *b, const BN_ULONG *m,
+                                   const BN_ULONG k0[LANES]);
+void ossl_extract_multiplier_8x20_win5(BN_ULONG *out,
+                                       const BN_ULONG *red_table,
+                                       const BN_ULONG idx[LANES]);
+
+# define AMM(r, a, b, m, k0) ossl_rsaz_amm52x20_x8_ifma512((r), (a), (b), (m), (k0))
+/* Squaring is done using multiplication */
+# define AMS(r, a, m, k0)    AMM((r), (a), (a), (m), (k0))
+
+/*
+ * Convert a 1024-bit number in 2^64 radix into lane |lane| of a digit-major
+ * array in 2^52 radix.  The memory access pattern only depends on the sizes.
+ */
+static void to_words52_lane(BN_ULONG *out, int lane, const BN_ULONG *in)
+{
+    int j;
+
+    for (j = 0; j < RED_DIGITS; j++) {
+        int bit = j * DIGIT_SIZE;
+        int w = bit / 64, sh = bit % 64;
+        uint64_t digit = in[w] >> sh;
+
+        if (sh > 64 - DIGIT_SIZE && w + 1 < WORDS)
+            digit |= in[w + 1] << (64 - sh);
+        out[j * LANES + lane] = digit & DIGIT_MASK;
+    }
+}
+
+/* The inverse of to_words52_lane() for normalized digits */
+static void from_words52_lane(BN_ULONG *out, const BN_ULONG *in, int lane)
+{
+    int j;
+
+    memset(out, 0, WORDS * sizeof(BN_ULONG));
+    for (j = 0; j < RED_DIGITS; j++) {
+        int bit = j * DIGIT_SIZE;
+        int w = bit / 64, sh = bit % 64;
+        uint64_t digit = in[j * LANES + lane];
+
+        out[w] |= digit << sh;
+        if (sh > 64 - DIGIT_SIZE && w + 1 < WORDS)
+            out[w + 1] |= digit >> (64 - sh);
+    }
+}
+
+/*
+ * Up to 8 independent Montgomery modular exponentiations with 1024-bit
+ * moduli, the CRT halves of RSA-2048, optimized with AVX512_IFMA in 512-bit
+ * registers.  Each exponentiation takes one lane, the moduli and exponents
+ * are unrelated.  Lanes past |num| replicate lane 0 and are discarded, so
+ * the cost is that of 8 exponentiations whatever |num| is.
+ *
+ * Input and output are all in regular 2^64 radix, 16 qwords per value.
+ *
+ *  [out] res[i] - result of modular exponentiation, i = 0..|num| - 1
+ *  [in]  base[i]- base, below m[i]
+ *  [in]  exp[i] - exponent
+ *  [in]  m[i]   - odd modulus of exactly 1024 bits
+ *  [in]  rr[i]  - Montgomery parameter RR = R^2 mod m[i], R = 2^1024
+ *  [in]  k0[i]  - Montgomery parameter k0 = -1/m[i] mod 2^64
+ *  [in]  num    - number of exponentiations, 1..8
+ *
+ * \return 0 in case of failure,
+ *         1 in case of success.
+ */
+int ossl_rsaz_mod_exp_avx512_x8(BN_ULONG *res[], const BN_ULONG *base[],
+                                const BN_ULONG *exp[], const BN_ULONG *m[],
+                                const BN_ULONG *rr[], const BN_ULONG k0[],
+                                int num)
+{
+    const int vec = RED_DIGITS * LANES;
+    BN_ULONG *storage, *aligned;
+    BN_ULONG *base_red, *m_red, *rr_red, *red_Y, *red_X, *red_table;
+    BN_ULONG *expz;     /* [LANES][WORDS + 1] */
+    BN_ULONG *idx;      /* [LANES] */
+    BN_ULONG *k0v;      /* [LANES] */
+    BN_ULONG tmp[WORDS];
+    size_t storage_len;
+    int i, l, exp_bit_no;
+
+    if (num < 1 || num > LANES)
+        return 0;
+
+    storage_len = ((5 + (1U << EXP_WIN_SIZE)) * vec      /* operands, table */
+                   + LANES * (WORDS + 1) + 2 * LANES)    /* expz, idx, k0 */
+                  * sizeof(BN_ULONG) + 64;               /* alignment */
+    storage = OPENSSL_zalloc(storage_len);
+    if (storage == NULL)
+        return 0;
+    aligned = (BN_ULONG *)ALIGN_OF(storage, 64);
+
+    base_red  = aligned;
+    m_red     = base_red + vec;
+    rr_red    = m_red + vec;
+    red_Y     = rr_red + vec;
+    red_X     = red_Y + vec;
+    red_table = red_X + vec;
+    expz      = red_table + (1U << EXP_WIN_SIZE) * vec;
+    idx       = expz + LANES * (WORDS + 1);
+    k0v       = idx + LANES;
+
+    for (l = 0; l < LANES; l++) {
+        i = l < num ? l : 0;
+        to_words52_lane(base_red, l, base[i]);
+        to_words52_lane(m_red, l, m[i]);
+        to_words52_lane(rr_red, l, rr[i]);
+        memcpy(expz + l * (WORDS + 1), exp[i], WORDS * sizeof(BN_ULONG));
+        k0v[l] = k0[i];
+    }
+
+    /*
+     * RR -> RR' = 2^2080 mod m as in ossl_rsaz_mod_exp_avx512_x2(), with
+     * coeff = 2^64, which is bit 12 of digit 1.
+     */
+    for (l = 0; l < LANES; l++)
+        red_X[1 * LANES + l] = (BN_ULONG)1 << (64 - DIGIT_SIZE);
+    AMS(rr_red, rr_red, m_red, k0v);
+    AMM(rr_red, rr_red, red_X, m_red, k0v);
+
+    /*
+     * Table of powers base^i, i = 0, ..., 2^EXP_WIN_SIZE - 1, in Montgomery
+     * domain
+     */
+    memset(red_X, 0, vec * sizeof(BN_ULONG));
+    for (l = 0; l < LANES; l++)
+        red_X[l] = 1;
+    AMM(&red_table[0 * vec], red_X, rr_red, m_red, k0v);
+    AMM(&red_table[1 * vec], base_red, rr_red, m_red, k0v);
+    for (i = 1; i < (1 << EXP_WIN_SIZE) / 2; i++) {
+        AMS(&red_table[(2 * i) * vec], &red_table[i * vec], m_red, k0v);
+        AMM(&red_table[(2 * i + 1) * vec], &red_table[(2 * i) * vec],
+            &red_table[1 * vec], m_red, k0v);
+    }
+
+    /*
+     * 1024 % EXP_WIN_SIZE = 4, so the first window has 4 bits and all the
+     * following ones are complete.
+     */
+    exp_bit_no = 1024 - 1024 % EXP_WIN_SIZE;
+    for (l = 0; l < LANES; l++)
+        idx[l] = expz[l * (WORDS + 1) + exp_bit_no / 64] >> (exp_bit_no % 64);
+    ossl_extract_multiplier_8x20_win5(red_Y, red_table, idx);
+
+    for (exp_bit_no -= EXP_WIN_SIZE; exp_bit_no >= 0;
+         exp_bit_no -= EXP_WIN_SIZE) {
+        int chunk = exp_bit_no / 64, shift = exp_bit_no % 64;
+
+        for (l = 0; l < LANES; l++) {
+            const BN_ULONG *e = expz + l * (WORDS + 1);
+            BN_ULONG t = e[chunk] >> shift;
+
+            /* Get additional bits from the next qword, expz[][WORDS] is 0 */
+            if (shift > 64 - EXP_WIN_SIZE)
+                t ^= e[chunk + 1] << (64 - shift);
+            idx[l] = t & ((1U << EXP_WIN_SIZE) - 1);
+        }
+        ossl_extract_multiplier_8x20_win5(red_X, red_table, idx);
+
+        AMS(red_Y, red_Y, m_red, k0v);
+        AMS(red_Y, red_Y, m_red, k0v);
+        AMS(red_Y, red_Y, m_red, k0v);
+        AMS(red_Y, red_Y, m_red, k0v);
+        AMS(red_Y, red_Y, m_red, k0v);
+        AMM(red_Y, red_Y, red_X, m_red, k0v);
+    }
+
+    /* Convert out of Montgomery domain, see RSAZ_mod_exp_x2() */
+    memset(red_X, 0, vec * sizeof(BN_ULONG));
+    for (l = 0; l < LANES; l++)
+        red_X[l] = 1;
+    AMM(red_Y, red_Y, red_X, m_red, k0v);
+
+    for (l = 0; l < num; l++) {
+        from_words52_lane(res[l], red_Y, l);
+        bn_reduce_once_in_place(res[l], /*carry=*/0, m[l], tmp, WORDS);
+    }
+
+    OPENSSL_cleanse(tmp, sizeof(tmp));
+    OPENSSL_clear_free(storage, storage_len);
+    return 1;
+}
+#endif
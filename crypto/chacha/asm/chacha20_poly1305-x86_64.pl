@@ -0,0 +1,771 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+# Stitched ChaCha20-Poly1305 for x86_64 processors with AVX2 and BMI2.
+#
+# Encrypting a record with ChaCha20_ctr32 and then hashing it with
+# Poly1305_Update reads the record through the cache twice, and leaves the
+# integer units idle while ChaCha20 runs and vice versa. The subroutines
+# below compute the key stream for eight blocks at a time, the same way as
+# ChaCha20_8x does, and interleave scalar Poly1305 with MULX between the
+# vector instructions, as aesni-gcm-x86_64.pl stitches AES-CTR with GHASH:
+#
+# void ossl_chacha20_poly1305_seal_avx2(unsigned char *out,
+#                                       const unsigned char *inp,
+#                                       size_t len,
+#                                       const unsigned int key[8],
+#                                       const unsigned int counter[4],
+#                                       void *poly);
+# void ossl_chacha20_poly1305_open_avx2(...);
+# int ossl_chacha20_poly1305_avx2_capable(void);
+#
+# |len| is a multiple of 512 and |counter| is the one of the first block,
+# which the caller advances by |len| / 64 afterwards. |poly| is the
+# Poly1305 state in the base 2^64 layout of poly1305_blocks() in
+# poly1305-x86_64.pl, i.e. h[0..2] followed by the clamped r[0..1]. The
+# ciphertext is hashed as full blocks and |h| is stored back, so the
+# caller can mix these calls with poly1305_blocks() and poly1305_emit()
+# on the same state to handle the additional data, the tail and the tag.
+#
+# Sealing hashes each 512-byte chunk of ciphertext while the key stream for
+# the following one is computed, opening hashes each chunk while the key
+# stream for it is computed.
+#
+# Scalar Poly1305 is bound by the latency of the multiplication chain, at
+# about 1 cycle per byte, which the AVX512 IFMA code path of
+# poly1305-x86_64.pl beats in a separate pass. So
+# ossl_chacha20_poly1305_avx2_capable() is false on processors with
+# AVX512F, AVX512VL and AVX512IFMA, and true on other processors with AVX2
+# and BMI2, including AVX512 ones where the vector Poly1305 works in base
+# 2^26.
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+		=~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+	$avx = ($1>=2.19) + ($1>=2.22);
+}
+
+if (!$avx && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+	   `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)/) {
+	$avx = ($1>=2.09) + ($1>=2.10);
+}
+
+if (!$avx && $win64 && ($flavour =~ /masm/ || $ENV{ASM} =~ /ml64/) &&
+	   `ml64 2>&1` =~ /Version ([0-9]+)\./) {
+	$avx = ($1>=10) + ($1>=11);
+}
+
+if (!$avx && `$ENV{CC} -v 2>&1` =~ /((?:clang|LLVM) version|.*based on LLVM) ([0-9]+\.[0-9]+)/) {
+	$avx = ($2>=3.0) + ($2>3.0);
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+# OPENSSL_ia32cap_P[2] bits: AVX2 and BMI2, and AVX512F, AVX512IFMA and
+# AVX512VL, with which poly1305-x86_64.pl uses base 2^44 vector code
+my $want = (1 << 5) | (1 << 8);
+my $ifma = (1 << 31) | (1 << 21) | (1 << 16);
+
+# input parameter block
+my ($out,$inp,$len,$key,$counter,$poly) =
+    ("%rdi","%rsi","%rdx","%rcx","%r8","%r9");
+# reassigned, %rax is the frame pointer and %rdx is taken by MULX
+my ($rem,$st,$pp) = ("%r15","%rbx","%rbp");
+my ($h0,$h1,$h2,$t1,$t2,$t3,$t4) =
+    ("%r8","%r9","%r10","%r11","%r12","%r13","%r14");
+
+# Stack frame, 32-byte aligned, below the six pushed registers:
+#
+#	0x000	rows 8-11 of the state, 'c's spilled in rounds
+#	0x080	initial state, row by row smashed by lanes
+#	0x200	... with the counters of the eight blocks
+#	0x280	r[2], s1 = r[1] + r[1] >> 2	Poly1305 key
+#
+# and %xmm6-%xmm15 above it on Win64
+my ($rkey,$frame) = (0x280,0x2a0);
+my $xframe = $win64 ? 0xa8 : 0;
+my $label = 0;
+
+my ($xb0,$xb1,$xb2,$xb3, $xd0,$xd1,$xd2,$xd3,
+    $xa0,$xa1,$xa2,$xa3, $xt0,$xt1,$xt2,$xt3)=map("%ymm$_",(0..15));
+my @xx=($xa0,$xa1,$xa2,$xa3, $xb0,$xb1,$xb2,$xb3,
+	"%nox","%nox","%nox","%nox", $xd0,$xd1,$xd2,$xd3);
+
+# One Poly1305 block at $off($base), h = (h + m + 2^128) * r mod 2^130 - 5,
+# h partially reduced to h[2] < 8
+sub poly_block {
+    my ($off, $base) = @_;
+    my ($m0, $m1) = ("$off($base)", ($off + 8)."($base)");
+    my ($r0, $r1, $s1) = map { ($rkey + $_)."(%rsp)" } (0, 8, 16);
+
+    return split /\n/, <<___;
+	add	$m0,$h0
+	adc	$m1,$h1
+	adc	\$1,$h2
+	mov	$h0,%rdx
+	mulx	$r0,$h0,$t1		# h0*r0
+	mulx	$r1,$t2,$t3		# h0*r1
+	mov	$h1,%rdx
+	mulx	$r0,$t4,$h1		# h1*r0
+	add	$t4,$t2
+	adc	$h1,$t3
+	mulx	$s1,$t4,$h1		# h1*s1
+	add	$t4,$h0
+	adc	$h1,$t1
+	mov	$h2,$t4
+	imul	$s1,$t4			# h2*s1
+	imul	$r0,$h2			# h2*r0
+	add	$t4,$t2
+	adc	$h2,$t3
+	mov	$t1,$h1
+	add	$t2,$h1
+	adc	\$0,$t3
+	mov	\$-4,$t4		# last reduction step
+	mov	$t3,$h2
+	and	$t3,$t4
+	shr	\$2,$t3
+	and	\$3,$h2
+	add	$t3,$t4
+	add	$t4,$h0
+	adc	\$0,$h1
+	adc	\$0,$h2
+___
+}
+
+# Emits the vector instructions @$v with the scalar ones @$p spread evenly
+# between them
+sub interleave {
+    my ($v, $p) = @_;
+    my ($nv, $np, $j) = (scalar(@$v), scalar(@$p), 0);
+
+    for my $i (0..$nv - 1) {
+	$code.="\t$v->[$i]\n";
+	$code.="$p->[$j++]\n" while ($j < $np && $j * $nv < ($i + 1) * $np);
+    }
+    $code.="$p->[$j++]\n" while ($j < $np);
+}
+
+# Quarter rounds on the columns or on the diagonals of eight states smashed
+# by lanes, starting at rows $a0, $b0, $c0 and $d0, returns the instructions.
+# As in ChaCha20_8x, 'a', 'b' and 'd' rows are kept in registers and 'c's
+# in memory, two at a time in $xt0 and $xt1, and $xt3 holds .Lrot16 on entry
+# and on exit.
+sub lane_round {
+    my ($a0,$b0,$c0,$d0)=@_;
+    my ($a1,$b1,$c1,$d1)=map(($_&~3)+(($_+1)&3),($a0,$b0,$c0,$d0));
+    my ($a2,$b2,$c2,$d2)=map(($_&~3)+(($_+1)&3),($a1,$b1,$c1,$d1));
+    my ($a3,$b3,$c3,$d3)=map(($_&~3)+(($_+1)&3),($a2,$b2,$c2,$d2));
+    my ($xc,$xc_,$t0,$t1)=($xt0,$xt1,$xt2,$xt3);
+    my @x=@xx;
+    my @v;
+
+    # two quarter rounds, on rows $i, $j, $xc, $k and $i_, $j_, $xc_, $k_
+    my $pair = sub {
+	my ($i,$j,$k,$i_,$j_,$k_)=@_;
+
+	push @v,
+	"vpaddd		$x[$j],$x[$i],$x[$i]",
+	"vpxor		$x[$i],$x[$k],$x[$k]",
+	"vpshufb	$t1,$x[$k],$x[$k]",
+	 "vpaddd	$x[$j_],$x[$i_],$x[$i_]",
+	 "vpxor		$x[$i_],$x[$k_],$x[$k_]",
+	 "vpshufb	$t1,$x[$k_],$x[$k_]",
+
+	"vpaddd		$x[$k],$xc,$xc",
+	"vpxor		$xc,$x[$j],$x[$j]",
+	"vpslld		\$12,$x[$j],$t0",
+	"vpsrld		\$20,$x[$j],$x[$j]",
+	"vpor		$t0,$x[$j],$x[$j]",
+	"vbroadcasti128	.Lrot8(%rip),$t0",
+	 "vpaddd	$x[$k_],$xc_,$xc_",
+	 "vpxor		$xc_,$x[$j_],$x[$j_]",
+	 "vpslld	\$12,$x[$j_],$t1",
+	 "vpsrld	\$20,$x[$j_],$x[$j_]",
+	 "vpor		$t1,$x[$j_],$x[$j_]",
+
+	"vpaddd		$x[$j],$x[$i],$x[$i]",
+	"vpxor		$x[$i],$x[$k],$x[$k]",
+	"vpshufb	$t0,$x[$k],$x[$k]",
+	 "vpaddd	$x[$j_],$x[$i_],$x[$i_]",
+	 "vpxor		$x[$i_],$x[$k_],$x[$k_]",
+	 "vpshufb	$t0,$x[$k_],$x[$k_]",
+
+	"vpaddd		$x[$k],$xc,$xc",
+	"vpxor		$xc,$x[$j],$x[$j]",
+	"vpslld		\$7,$x[$j],$t1",
+	"vpsrld		\$25,$x[$j],$x[$j]",
+	"vpor		$t1,$x[$j],$x[$j]",
+	"vbroadcasti128	.Lrot16(%rip),$t1",
+	 "vpaddd	$x[$k_],$xc_,$xc_",
+	 "vpxor		$xc_,$x[$j_],$x[$j_]",
+	 "vpslld	\$7,$x[$j_],$t0",
+	 "vpsrld	\$25,$x[$j_],$x[$j_]",
+	 "vpor		$t0,$x[$j_],$x[$j_]";
+    };
+
+    $pair->($a0,$b0,$d0,$a1,$b1,$d1);
+    push @v,
+	"vmovdqa	$xc,".(32*($c0-8))."(%rsp)",	# reload pair of 'c's
+	 "vmovdqa	$xc_,".(32*($c1-8))."(%rsp)",
+	"vmovdqa	".(32*($c2-8))."(%rsp),$xc",
+	 "vmovdqa	".(32*($c3-8))."(%rsp),$xc_";
+    $pair->($a2,$b2,$d2,$a3,$b3,$d3);
+
+    return @v;
+}
+
+# Loads the initial state of eight blocks from the stack
+sub init_lanes {
+    $code.=<<___;
+	vmovdqa		0x80(%rsp),$xa0
+	vmovdqa		0xa0(%rsp),$xa1
+	vmovdqa		0xc0(%rsp),$xa2
+	vmovdqa		0xe0(%rsp),$xa3
+	vmovdqa		0x100(%rsp),$xb0
+	vmovdqa		0x120(%rsp),$xb1
+	vmovdqa		0x140(%rsp),$xb2
+	vmovdqa		0x160(%rsp),$xb3
+	vmovdqa		0x180(%rsp),$xt0	# "xc0"
+	vmovdqa		0x1a0(%rsp),$xt1	# "xc1"
+	vmovdqa		0x1c0(%rsp),$xt2
+	vmovdqa		0x1e0(%rsp),$xt3
+	vmovdqa		$xt2,0x40(%rsp)		# "xc2"
+	vmovdqa		$xt3,0x60(%rsp)		# "xc3"
+	vmovdqa		0x200(%rsp),$xd0
+	vmovdqa		0x220(%rsp),$xd1
+	vmovdqa		0x240(%rsp),$xd2
+	vmovdqa		0x260(%rsp),$xd3
+	vbroadcasti128	.Lrot16(%rip),$xt3
+___
+}
+
+# Returns the instructions that add the initial state to the lanes and turn
+# them into blocks, and the ones that xor the blocks with the input, store
+# them to $out and advance the counters
+sub finish_lanes {
+    my ($xb0,$xb1,$xb2,$xb3, $xd0,$xd1,$xd2,$xd3,
+	$xa0,$xa1,$xa2,$xa3, $xt0,$xt1,$xt2,$xt3)=map("%ymm$_",(0..15));
+    my ($xc0,$xc1,$xc2,$xc3);
+    my (@v, @s);
+
+    # accumulate key and "de-interlace" rows of four states at a time
+    my $transpose = sub {
+	my ($off, @r) = @_;
+
+	push @v,
+	"vpaddd		".($off + 0x00)."(%rsp),$r[0],$r[0]",
+	"vpaddd		".($off + 0x20)."(%rsp),$r[1],$r[1]",
+	"vpaddd		".($off + 0x40)."(%rsp),$r[2],$r[2]",
+	"vpaddd		".($off + 0x60)."(%rsp),$r[3],$r[3]",
+	"vpunpckldq	$r[1],$r[0],$xt2",
+	"vpunpckldq	$r[3],$r[2],$xt3",
+	"vpunpckhdq	$r[1],$r[0],$r[0]",
+	"vpunpckhdq	$r[3],$r[2],$r[2]",
+	"vpunpcklqdq	$xt3,$xt2,$r[1]",
+	"vpunpckhqdq	$xt3,$xt2,$xt2",
+	"vpunpcklqdq	$r[2],$r[0],$r[3]",
+	"vpunpckhqdq	$r[2],$r[0],$r[0]";
+	return ($r[1],$xt2,$r[3],$r[0],$r[2]);
+    };
+
+    ($xa0,$xa1,$xa2,$xa3,$xt2)=$transpose->(0x80,$xa0,$xa1,$xa2,$xa3);
+    ($xb0,$xb1,$xb2,$xb3,$xt2)=$transpose->(0x100,$xb0,$xb1,$xb2,$xb3);
+    push @v,
+	"vperm2i128	\$0x20,$xb0,$xa0,$xt3",	# "de-interlace" further
+	"vperm2i128	\$0x31,$xb0,$xa0,$xb0",
+	"vperm2i128	\$0x20,$xb1,$xa1,$xa0",
+	"vperm2i128	\$0x31,$xb1,$xa1,$xb1",
+	"vperm2i128	\$0x20,$xb2,$xa2,$xa1",
+	"vperm2i128	\$0x31,$xb2,$xa2,$xb2",
+	"vperm2i128	\$0x20,$xb3,$xa3,$xa2",
+	"vperm2i128	\$0x31,$xb3,$xa3,$xb3";
+    ($xa0,$xa1,$xa2,$xa3,$xt3)=($xt3,$xa0,$xa1,$xa2,$xa3);
+    ($xc0,$xc1,$xc2,$xc3)=($xt0,$xt1,$xa0,$xa1);
+    push @v,
+	"vmovdqa	$xa0,0x00(%rsp)",	# offload $xaN
+	"vmovdqa	$xa1,0x20(%rsp)",
+	"vmovdqa	0x40(%rsp),$xc2",
+	"vmovdqa	0x60(%rsp),$xc3";
+    ($xc0,$xc1,$xc2,$xc3,$xt2)=$transpose->(0x180,$xc0,$xc1,$xc2,$xc3);
+    ($xd0,$xd1,$xd2,$xd3,$xt2)=$transpose->(0x200,$xd0,$xd1,$xd2,$xd3);
+    push @v,
+	"vperm2i128	\$0x20,$xd0,$xc0,$xt3",
+	"vperm2i128	\$0x31,$xd0,$xc0,$xd0",
+	"vperm2i128	\$0x20,$xd1,$xc1,$xc0",
+	"vperm2i128	\$0x31,$xd1,$xc1,$xd1",
+	"vperm2i128	\$0x20,$xd2,$xc2,$xc1",
+	"vperm2i128	\$0x31,$xd2,$xc2,$xd2",
+	"vperm2i128	\$0x20,$xd3,$xc3,$xc2",
+	"vperm2i128	\$0x31,$xd3,$xc3,$xd3";
+    ($xc0,$xc1,$xc2,$xc3,$xt3)=($xt3,$xc0,$xc1,$xc2,$xc3);
+    ($xb0,$xb1,$xb2,$xb3,$xc0,$xc1,$xc2,$xc3)=
+    ($xc0,$xc1,$xc2,$xc3,$xb0,$xb1,$xb2,$xb3);
+    ($xa0,$xa1)=($xt2,$xt3);
+    push @v,
+	"vmovdqa	0x00(%rsp),$xa0",
+	"vmovdqa	0x20(%rsp),$xa1";
+
+    my @blk = ($xa0,$xb0,$xc0,$xd0, $xa1,$xb1,$xc1,$xd1,
+	       $xa2,$xb2,$xc2,$xd2, $xa3,$xb3,$xc3,$xd3);
+    for my $i (0..15) {
+	push @s, "vpxor		".(32 * $i)."($inp),$blk[$i],$blk[$i]",
+		 "vmovdqu	$blk[$i],".(32 * $i)."($out)";
+    }
+    push @s,
+	"vmovdqa	0x200(%rsp),$xd0",	# next counters
+	"vpaddd		.Leight(%rip),$xd0,$xd0",
+	"vmovdqa	$xd0,0x200(%rsp)";
+
+    return (\@v, \@s);
+}
+
+# Encrypts or decrypts one chunk at $inp to $out, and with $stitch hashes
+# the chunk at $pp meanwhile, three blocks per double round and the last two
+# before the output is stored
+sub chunk {
+    my ($stitch) = @_;
+    my $loop = ".Loop_rounds".$label++;
+    my @p;
+
+    init_lanes();
+    $code.=<<___;
+	mov		\$10,%ecx
+	jmp		$loop
+
+.align	32
+$loop:
+___
+    @p = map { poly_block(16 * $_, $pp) } (0..2) if ($stitch);
+    interleave([lane_round(0,4,8,12), lane_round(0,5,10,15)], \@p);
+    $code.="	lea		48($pp),$pp\n" if ($stitch);
+    $code.=<<___;
+	dec		%ecx
+	jnz		$loop
+
+___
+    my ($v, $s) = finish_lanes();
+    @p = $stitch ? map { poly_block(16 * $_, $pp) } (0..1) : ();
+    interleave($v, \@p);
+    $code.="	lea		32($pp),$pp\n" if ($stitch);
+    interleave($s, []);
+    $code.=<<___;
+	lea		0x200($inp),$inp
+	lea		0x200($out),$out
+	sub		\$0x200,$rem
+___
+}
+
+# Hashes the 512 bytes at $pp
+sub hash_chunk {
+    my ($loop) = (".Lhash_".$label++);
+
+    $code.=<<___;
+	mov		\$32,%ecx
+$loop:
+___
+    $code.="$_\n" for (poly_block(0, $pp));
+    $code.=<<___;
+	lea		16($pp),$pp
+	dec		%ecx
+	jnz		$loop
+___
+}
+
+sub aead {
+    my ($dir) = @_;
+    my $func = "ossl_chacha20_poly1305_${dir}_avx2";
+    my $check = ".Lcheck_$dir";
+    my $loop = ".Lchunks_$dir";
+    my $done = ".Ldone_$dir";
+
+    $code.=<<___;
+.globl	$func
+.type	$func,\@function,6
+.align	32
+$func:
+.cfi_startproc
+	endbranch
+	mov	%rsp,%rax
+.cfi_def_cfa_register	%rax
+	push	%rbx
+.cfi_push	%rbx
+	push	%rbp
+.cfi_push	%rbp
+	push	%r12
+.cfi_push	%r12
+	push	%r13
+.cfi_push	%r13
+	push	%r14
+.cfi_push	%r14
+	push	%r15
+.cfi_push	%r15
+	sub	\$$frame+$xframe,%rsp
+	and	\$-32,%rsp
+___
+    $code.=<<___ if ($win64);
+	movaps	%xmm6,-0xd8(%rax)
+	movaps	%xmm7,-0xc8(%rax)
+	movaps	%xmm8,-0xb8(%rax)
+	movaps	%xmm9,-0xa8(%rax)
+	movaps	%xmm10,-0x98(%rax)
+	movaps	%xmm11,-0x88(%rax)
+	movaps	%xmm12,-0x78(%rax)
+	movaps	%xmm13,-0x68(%rax)
+	movaps	%xmm14,-0x58(%rax)
+	movaps	%xmm15,-0x48(%rax)
+___
+    $code.=<<___;
+.L${dir}_avx2_body:
+	vzeroupper
+	mov	$len,$rem
+	mov	$poly,$st
+
+	vbroadcasti128	.Lsigma(%rip),$xa3	# key[0]
+	vbroadcasti128	0($key),$xb3		# key[1]
+	vbroadcasti128	16($key),$xt3		# key[2]
+	vbroadcasti128	0($counter),$xd3	# key[3]
+
+	vpshufd		\$0x00,$xa3,$xa0	# smash key by lanes...
+	vpshufd		\$0x55,$xa3,$xa1
+	vmovdqa		$xa0,0x80(%rsp)		# ... and offload
+	vpshufd		\$0xaa,$xa3,$xa2
+	vmovdqa		$xa1,0xa0(%rsp)
+	vpshufd		\$0xff,$xa3,$xa3
+	vmovdqa		$xa2,0xc0(%rsp)
+	vmovdqa		$xa3,0xe0(%rsp)
+
+	vpshufd		\$0x00,$xb3,$xb0
+	vpshufd		\$0x55,$xb3,$xb1
+	vmovdqa		$xb0,0x100(%rsp)
+	vpshufd		\$0xaa,$xb3,$xb2
+	vmovdqa		$xb1,0x120(%rsp)
+	vpshufd		\$0xff,$xb3,$xb3
+	vmovdqa		$xb2,0x140(%rsp)
+	vmovdqa		$xb3,0x160(%rsp)
+
+	vpshufd		\$0x00,$xt3,$xt0
+	vpshufd		\$0x55,$xt3,$xt1
+	vmovdqa		$xt0,0x180(%rsp)
+	vpshufd		\$0xaa,$xt3,$xt2
+	vmovdqa		$xt1,0x1a0(%rsp)
+	vpshufd		\$0xff,$xt3,$xt3
+	vmovdqa		$xt2,0x1c0(%rsp)
+	vmovdqa		$xt3,0x1e0(%rsp)
+
+	vpshufd		\$0x00,$xd3,$xd0
+	vpshufd		\$0x55,$xd3,$xd1
+	vpaddd		.Lincy(%rip),$xd0,$xd0
+	vpshufd		\$0xaa,$xd3,$xd2
+	vmovdqa		$xd0,0x200(%rsp)
+	vpshufd		\$0xff,$xd3,$xd3
+	vmovdqa		$xd1,0x220(%rsp)
+	vmovdqa		$xd2,0x240(%rsp)
+	vmovdqa		$xd3,0x260(%rsp)
+
+	mov	24($st),$t1			# load r
+	mov	32($st),$t2
+	mov	$t2,$t3
+	shr	\$2,$t3
+	add	$t2,$t3
+	mov	$t1,$rkey+0(%rsp)
+	mov	$t2,$rkey+8(%rsp)
+	mov	$t3,$rkey+16(%rsp)
+	mov	0($st),$h0			# load hash value
+	mov	8($st),$h1
+	mov	16($st),$h2
+___
+
+    if ($dir eq "seal") {
+	$code.=<<___;
+	mov	$out,$pp
+	test	$rem,$rem
+	jz	$done
+___
+	chunk(0);
+	$code.=<<___;
+	jmp	$check
+
+.align	32
+$loop:
+___
+	chunk(1);
+	$code.=<<___;
+$check:
+	test	$rem,$rem
+	jnz	$loop
+___
+	hash_chunk();
+    } else {
+	$code.=<<___;
+	mov	$inp,$pp
+	jmp	$check
+
+.align	32
+$loop:
+___
+	chunk(1);
+	$code.=<<___;
+$check:
+	test	$rem,$rem
+	jnz	$loop
+___
+    }
+
+    $code.=<<___;
+$done:
+	mov	$h0,0($st)			# store hash value
+	mov	$h1,8($st)
+	mov	$h2,16($st)
+
+	vpxor	%ymm0,%ymm0,%ymm0		# wipe the key
+	vmovdqa	%ymm0,$rkey(%rsp)
+___
+    for (my $i = 0; $i < 0x280; $i += 0x20) {
+	$code.="	vmovdqa	%ymm0,$i(%rsp)\n";
+    }
+    $code.="	vzeroupper\n";
+    $code.=<<___ if ($win64);
+	movaps	-0xd8(%rax),%xmm6
+	movaps	-0xc8(%rax),%xmm7
+	movaps	-0xb8(%rax),%xmm8
+	movaps	-0xa8(%rax),%xmm9
+	movaps	-0x98(%rax),%xmm10
+	movaps	-0x88(%rax),%xmm11
+	movaps	-0x78(%rax),%xmm12
+	movaps	-0x68(%rax),%xmm13
+	movaps	-0x58(%rax),%xmm14
+	movaps	-0x48(%rax),%xmm15
+___
+    $code.=<<___;
+	mov	-48(%rax),%r15
+.cfi_restore	%r15
+	mov	-40(%rax),%r14
+.cfi_restore	%r14
+	mov	-32(%rax),%r13
+.cfi_restore	%r13
+	mov	-24(%rax),%r12
+.cfi_restore	%r12
+	mov	-16(%rax),%rbp
+.cfi_restore	%rbp
+	mov	-8(%rax),%rbx
+.cfi_restore	%rbx
+	lea	(%rax),%rsp
+.cfi_def_cfa_register	%rsp
+.L${dir}_avx2_epilogue:
+	ret
+.cfi_endproc
+.size	$func,.-$func
+___
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+___
+
+if ($avx>1) {
+$code.=<<___;
+
+.globl	ossl_chacha20_poly1305_avx2_capable
+.type	ossl_chacha20_poly1305_avx2_capable,\@abi-omnipotent
+.align	32
+ossl_chacha20_poly1305_avx2_capable:
+.cfi_startproc
+	mov	OPENSSL_ia32cap_P+8(%rip),%ecx
+	xor	%eax,%eax
+	mov	%ecx,%edx
+	and	\$$want,%ecx
+	cmp	\$$want,%ecx
+	jne	.Lno_stitch
+	and	\$$ifma,%edx
+	cmp	\$$ifma,%edx
+	setne	%al
+.Lno_stitch:
+	ret
+.cfi_endproc
+.size	ossl_chacha20_poly1305_avx2_capable,.-ossl_chacha20_poly1305_avx2_capable
+___
+aead("seal");
+aead("open");
+
+$code.=<<___;
+.align	64
+.Lincy:
+	.long	0,2,4,6,1,3,5,7
+.Leight:
+	.long	8,8,8,8,8,8,8,8
+.Lsigma:
+	.long	0x61707865,0x3320646e,0x79622d32,0x6b206574
+.Lrot16:
+	.byte	0x2,0x3,0x0,0x1, 0x6,0x7,0x4,0x5, 0xa,0xb,0x8,0x9, 0xe,0xf,0xc,0xd
+.Lrot8:
+	.byte	0x3,0x0,0x1,0x2, 0x7,0x4,0x5,0x6, 0xb,0x8,0x9,0xa, 0xf,0xc,0xd,0xe
+.asciz	"Stitched ChaCha20-Poly1305 for x86_64"
+.align	64
+___
+} else {
+# The assembler cannot encode AVX2, the functions are never called.
+$code.=<<___;
+
+.globl	ossl_chacha20_poly1305_avx2_capable
+.type	ossl_chacha20_poly1305_avx2_capable,\@abi-omnipotent
+ossl_chacha20_poly1305_avx2_capable:
+	xor	%eax,%eax
+	ret
+.size	ossl_chacha20_poly1305_avx2_capable,.-ossl_chacha20_poly1305_avx2_capable
+
+.globl	ossl_chacha20_poly1305_seal_avx2
+.globl	ossl_chacha20_poly1305_open_avx2
+.type	ossl_chacha20_poly1305_seal_avx2,\@abi-omnipotent
+ossl_chacha20_poly1305_seal_avx2:
+ossl_chacha20_poly1305_open_avx2:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	ossl_chacha20_poly1305_seal_avx2,.-ossl_chacha20_poly1305_seal_avx2
+___
+}
+
+if ($win64 && $avx>1) {
+$rec="%rcx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+.type	chacha20_poly1305_se_handler,\@abi-omnipotent
+.align	16
+chacha20_poly1305_se_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# prologue label
+	cmp	%r10,%rbx		# context->Rip<prologue label
+	jb	.Lcommon_seh_tail
+
+	mov	152($context),%rax	# pull context->Rsp
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=epilogue label
+	jae	.Lcommon_seh_tail
+
+	mov	120($context),%rax	# pull context->Rax
+
+	mov	-48(%rax),%r15
+	mov	-40(%rax),%r14
+	mov	-32(%rax),%r13
+	mov	-24(%rax),%r12
+	mov	-16(%rax),%rbp
+	mov	-8(%rax),%rbx
+	mov	%r15,240($context)
+	mov	%r14,232($context)
+	mov	%r13,224($context)
+	mov	%r12,216($context)
+	mov	%rbp,160($context)
+	mov	%rbx,144($context)
+
+	lea	-0xd8(%rax),%rsi	# %xmm save area
+	lea	512($context),%rdi	# & context.Xmm6
+	mov	\$20,%ecx		# 10*sizeof(%xmm0)/sizeof(%rax)
+	.long	0xa548f3fc		# cld; rep movsq
+
+.Lcommon_seh_tail:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	chacha20_poly1305_se_handler,.-chacha20_poly1305_se_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_ossl_chacha20_poly1305_seal_avx2
+	.rva	.LSEH_end_ossl_chacha20_poly1305_seal_avx2
+	.rva	.LSEH_info_seal_avx2
+
+	.rva	.LSEH_begin_ossl_chacha20_poly1305_open_avx2
+	.rva	.LSEH_end_ossl_chacha20_poly1305_open_avx2
+	.rva	.LSEH_info_open_avx2
+
+.section	.xdata
+.align	8
+.LSEH_info_seal_avx2:
+	.byte	9,0,0,0
+	.rva	chacha20_poly1305_se_handler
+	.rva	.Lseal_avx2_body,.Lseal_avx2_epilogue
+.LSEH_info_open_avx2:
+	.byte	9,0,0,0
+	.rva	chacha20_poly1305_se_handler
+	.rva	.Lopen_avx2_body,.Lopen_avx2_epilogue
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -33,6 +33,7 @@ struct ossl_lib_ctx_st {
     void *bio_core;
     void *child_provider;
     OSSL_METHOD_STORE *decoder_store;
+    void *decoder_cache;
     OSSL_METHOD_STORE *encoder_store;
     OSSL_METHOD_STORE *store_loader_store;
     void *self_test_cb;
@@ -115,6 +116,11 @@ static int context_init(OSSL_LIB_CTX *ctx)
     if (ctx->decoder_store == NULL)
         goto err;
 
+    /* P2. We want decoder_cache to be cleaned up before the provider store */
+    ctx->decoder_cache = ossl_decoder_cache_new(ctx);
+    if (ctx->decoder_cache == NULL)
+        goto err;
+
     /* P2. We want encoder_store to be cleaned up before the provider store */
     ctx->encoder_store = ossl_method_store_new(ctx);
     if (ctx->encoder_store == NULL)
@@ -232,6 +238,12 @@ static void context_deinit_objs(OSSL_LIB_CTX *ctx)
         ctx->decoder_store = NULL;
     }
 
+    /* P2. We want decoder_cache to be cleaned up before the provider store */
+    if (ctx->decoder_cache != NULL) {
+        ossl_decoder_cache_free(ctx->decoder_cache);
+        ctx->decoder_cache = NULL;
+    }
+
     /* P2. We want encoder_store to be cleaned up before the provider store */
     if (ctx->encoder_store != NULL) {
         ossl_method_store_free(ctx->encoder_store);
@@ -544,6 +556,8 @@ void *ossl_lib_ctx_get_data(OSSL_LIB_CTX *ctx, int index)
         return ctx->child_provider;
     case OSSL_LIB_CTX_DECODER_STORE_INDEX:
         return ctx->decoder_store;
+    case OSSL_LIB_CTX_DECODER_CACHE_INDEX:
+        return ctx->decoder_cache;
     case OSSL_LIB_CTX_ENCODER_STORE_INDEX:
         return ctx->encoder_store;
     case OSSL_LIB_CTX_STORE_LOADER_STORE_INDEX:
@@ -0,0 +1,403 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+# X448/Ed448 field multiplication and squaring for ARMv8.
+#
+# The field elements are those of crypto/ec/curve448/arch_64, eight limbs
+# in radix 2^56, and the subroutines compute exactly the same results as
+# gf_mul and gf_sqr in f_impl64.c, Karatsuba split included. Compared to
+# the compiled C code the operands stay in registers for the whole
+# computation and the 128-bit accumulators are shifted with EXTR.
+#
+# void ossl_gf448_mul_armv8(uint64_t c[8], const uint64_t a[8],
+#                           const uint64_t b[8]);
+# void ossl_gf448_sqr_armv8(uint64_t c[8], const uint64_t a[8]);
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}arm-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/arm-xlate.pl" and -f $xlate) or
+die "can't locate arm-xlate.pl";
+
+open OUT,"| \"$^X\" $xlate $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+my ($cp, $ap, $bp) = map("x$_", 0..2);
+# 128-bit accumulators, [low, high]
+my @acc0 = ("x20", "x21");
+my @acc1 = ("x22", "x23");
+my @acc2 = ("x24", "x25");
+my ($t0, $t1) = ("x26", "x27");
+# scratch registers for operands that are doubled or live in the stack
+# frame, $ap and $bp are free once the inputs are loaded
+my @scratch = ("x28", $ap);
+
+# Operands are named after the variables of f_impl64.c, e.g. "a3" or
+# "bbb1". a[] always lives in registers, so does b[] in the multiplication.
+# aa[] lives in registers in the squaring and in the stack frame, with
+# bb[] and bbb[], in the multiplication. A leading "2*" doubles the
+# operand.
+my %reg;
+my %frame = (aa => 96, bb => 128, bbb => 160);
+
+sub opnd {
+    my ($name, $k) = @_;
+    my $code = "";
+    my $r;
+
+    my $double = $name =~ s/^2\*//;
+    if (defined($reg{$name})) {
+	$r = $reg{$name};
+    } else {
+	my ($var, $i) = $name =~ /^(\D+)(\d)$/ or die "bad operand $name";
+
+	$r = $scratch[$k];
+	$code .= "\tldr\t$r,[sp,#".($frame{$var}+8*$i)."]\n";
+    }
+    if ($double) {
+	$code .= "\tadd\t$scratch[$k],$r,$r\n";
+	$r = $scratch[$k];
+    }
+    return ($code, $r);
+}
+
+# op is "mac" for acc += x * y, "msc" for acc -= x * y, "mul" for acc = x * y
+sub prod {
+    my ($op, $acc, $x, $y) = @_;
+    my ($code, $rx) = opnd($x, 0);
+    my ($cy, $ry) = opnd($y, 1);
+
+    $code .= $cy;
+    if ($op eq "mul") {
+	$code .= "\tmul\t$$acc[0],$rx,$ry\n";
+	$code .= "\tumulh\t$$acc[1],$rx,$ry\n";
+	return $code;
+    }
+    $code .= "\tmul\t$t0,$rx,$ry\n";
+    $code .= "\tumulh\t$t1,$rx,$ry\n";
+    if ($op eq "mac") {
+	$code .= "\tadds\t$$acc[0],$$acc[0],$t0\n";
+	$code .= "\tadc\t$$acc[1],$$acc[1],$t1\n";
+    } else {
+	$code .= "\tsubs\t$$acc[0],$$acc[0],$t0\n";
+	$code .= "\tsbc\t$$acc[1],$$acc[1],$t1\n";
+    }
+    return $code;
+}
+
+sub mac { return prod("mac", @_); }
+sub msc { return prod("msc", @_); }
+sub mul { return prod("mul", @_); }
+
+sub add128 {
+    my ($acc, $src) = @_;
+
+    return "\tadds\t$$acc[0],$$acc[0],$$src[0]\n"
+	   ."\tadc\t$$acc[1],$$acc[1],$$src[1]\n";
+}
+
+sub sub128 {
+    my ($acc, $src) = @_;
+
+    return "\tsubs\t$$acc[0],$$acc[0],$$src[0]\n"
+	   ."\tsbc\t$$acc[1],$$acc[1],$$src[1]\n";
+}
+
+sub shr128 {
+    my ($acc, $n) = @_;
+
+    return "\textr\t$$acc[0],$$acc[1],$$acc[0],#$n\n"
+	   ."\tlsr\t$$acc[1],$$acc[1],#$n\n";
+}
+
+# c[i] = (acc << shift) & mask
+sub store {
+    my ($i, $acc, $shift) = @_;
+    my $code;
+
+    if ($shift) {
+	$code = "\tlsl\t$t0,$$acc[0],#$shift\n";
+	$code .= "\tand\t$t0,$t0,#0x00ffffffffffffff\n";
+    } else {
+	$code = "\tand\t$t0,$$acc[0],#0x00ffffffffffffff\n";
+    }
+    $code .= "\tstr\t$t0,[$cp,#".8*$i."]\n";
+    return $code;
+}
+
+# acc += c[i]
+sub add_c {
+    my ($acc, $i) = @_;
+
+    return "\tldr\t$t0,[$cp,#".8*$i."]\n"
+	   ."\tadds\t$$acc[0],$$acc[0],$t0\n"
+	   ."\tadc\t$$acc[1],$$acc[1],xzr\n";
+}
+
+# c[i] += low half of acc
+sub add_to_c {
+    my ($i, $acc) = @_;
+
+    return "\tldr\t$t0,[$cp,#".8*$i."]\n"
+	   ."\tadd\t$t0,$t0,$$acc[0]\n"
+	   ."\tstr\t$t0,[$cp,#".8*$i."]\n";
+}
+
+sub prologue {
+    my ($name, $frame) = @_;
+
+    return <<___;
+.globl	$name
+.type	$name,%function
+.align	5
+$name:
+	AARCH64_SIGN_LINK_REGISTER
+	stp	x29,x30,[sp,#-$frame]!
+	add	x29,sp,#0
+	stp	x19,x20,[sp,#16]
+	stp	x21,x22,[sp,#32]
+	stp	x23,x24,[sp,#48]
+	stp	x25,x26,[sp,#64]
+	stp	x27,x28,[sp,#80]
+
+___
+}
+
+sub epilogue {
+    my ($name, $frame) = @_;
+
+    return <<___;
+
+	ldp	x19,x20,[x29,#16]
+	ldp	x21,x22,[x29,#32]
+	ldp	x23,x24,[x29,#48]
+	ldp	x25,x26,[x29,#64]
+	ldp	x27,x28,[x29,#80]
+	ldp	x29,x30,[sp],#$frame
+	AARCH64_VALIDATE_LINK_REGISTER
+	ret
+.size	$name,.-$name
+___
+}
+
+$code.=<<___;
+#include "arm_arch.h"
+
+.text
+
+___
+
+######################################################################
+# Multiplication
+
+%reg = ();
+$reg{"a$_"} = "x".(3 + $_) foreach (0..7);
+$reg{"b$_"} = "x".(11 + $_) foreach (0..6);
+$reg{"b7"} = "x19";
+
+$code.="// void ossl_gf448_mul_armv8(uint64_t c[8], const uint64_t a[8],\n";
+$code.="//                           const uint64_t b[8]);\n";
+$code.=prologue("ossl_gf448_mul_armv8", 192);
+$code.=<<___;
+	ldp	$reg{a0},$reg{a1},[$ap]
+	ldp	$reg{a2},$reg{a3},[$ap,#16]
+	ldp	$reg{a4},$reg{a5},[$ap,#32]
+	ldp	$reg{a6},$reg{a7},[$ap,#48]
+	ldp	$reg{b0},$reg{b1},[$bp]
+	ldp	$reg{b2},$reg{b3},[$bp,#16]
+	ldp	$reg{b4},$reg{b5},[$bp,#32]
+	ldp	$reg{b6},$reg{b7},[$bp,#48]
+
+___
+# aa[i] = a[i] + a[i + 4], bb[i] = b[i] + b[i + 4], bbb[i] = bb[i] + b[i + 4]
+for (my $i = 0; $i < 4; $i += 2) {
+    my $j = $i + 1;
+
+    $code.=<<___;
+	add	$t0,$reg{"a$i"},$reg{"a".($i+4)}
+	add	$t1,$reg{"a$j"},$reg{"a".($j+4)}
+	stp	$t0,$t1,[sp,#@{[$frame{aa}+8*$i]}]
+	add	$t0,$reg{"b$i"},$reg{"b".($i+4)}
+	add	$t1,$reg{"b$j"},$reg{"b".($j+4)}
+	stp	$t0,$t1,[sp,#@{[$frame{bb}+8*$i]}]
+	add	$t0,$t0,$reg{"b".($i+4)}
+	add	$t1,$t1,$reg{"b".($j+4)}
+	stp	$t0,$t1,[sp,#@{[$frame{bbb}+8*$i]}]
+___
+}
+$code.=<<___;
+	mov	$acc0[0],xzr
+	mov	$acc0[1],xzr
+	mov	$acc1[0],xzr
+	mov	$acc1[1],xzr
+___
+
+for (my $i = 0; $i < 4; $i++) {
+    $code.="\n";
+    for (my $j = 0; $j < 4; $j++) {
+	my $op = $j == 0 ? \&mul : \&mac;
+
+	if ($j <= $i) {
+	    $code.=&$op(\@acc2, "a$j", "b".($i - $j));
+	    $code.=mac(\@acc1, "aa$j", "bb".($i - $j));
+	    $code.=mac(\@acc0, "a".($j + 4), "b".($i - $j + 4));
+	} else {
+	    $code.=&$op(\@acc2, "a$j", "b".($i - $j + 8));
+	    $code.=mac(\@acc1, "aa$j", "bbb".($i - $j + 4));
+	    $code.=mac(\@acc0, "a".($j + 4), "bb".($i - $j + 4));
+	}
+    }
+    $code.=sub128(\@acc1, \@acc2);
+    $code.=add128(\@acc0, \@acc2);
+    $code.=store($i, \@acc0);
+    $code.=store($i + 4, \@acc1);
+    $code.=shr128(\@acc0, 56);
+    $code.=shr128(\@acc1, 56);
+}
+
+$code.="\n";
+$code.=add128(\@acc0, \@acc1);
+$code.=add_c(\@acc0, 4);
+$code.=add_c(\@acc1, 0);
+$code.=store(4, \@acc0);
+$code.=store(0, \@acc1);
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+$code.=add_to_c(5, \@acc0);
+$code.=add_to_c(1, \@acc1);
+$code.=epilogue("ossl_gf448_mul_armv8", 192);
+
+######################################################################
+# Squaring
+
+%reg = ();
+$reg{"a$_"} = "x".(3 + $_) foreach (0..7);
+$reg{"aa$_"} = "x".(11 + $_) foreach (0..3);
+
+$code.="\n// void ossl_gf448_sqr_armv8(uint64_t c[8], const uint64_t a[8]);\n";
+$code.=prologue("ossl_gf448_sqr_armv8", 96);
+$code.=<<___;
+	ldp	$reg{a0},$reg{a1},[$ap]
+	ldp	$reg{a2},$reg{a3},[$ap,#16]
+	ldp	$reg{a4},$reg{a5},[$ap,#32]
+	ldp	$reg{a6},$reg{a7},[$ap,#48]
+	add	$reg{aa0},$reg{a0},$reg{a4}
+	add	$reg{aa1},$reg{a1},$reg{a5}
+	add	$reg{aa2},$reg{a2},$reg{a6}
+	add	$reg{aa3},$reg{a3},$reg{a7}
+
+___
+
+$code.=mul(\@acc2, "a0", "a3");
+$code.=mul(\@acc0, "aa0", "aa3");
+$code.=mul(\@acc1, "a4", "a7");
+
+$code.=mac(\@acc2, "a1", "a2");
+$code.=mac(\@acc0, "aa1", "aa2");
+$code.=mac(\@acc1, "a5", "a6");
+
+$code.=sub128(\@acc0, \@acc2);
+$code.=add128(\@acc1, \@acc2);
+
+$code.=store(3, \@acc1, 1);
+$code.=store(7, \@acc0, 1);
+
+$code.=shr128(\@acc0, 55);
+$code.=shr128(\@acc1, 55);
+
+$code.=mac(\@acc0, "2*aa1", "aa3");
+$code.=mac(\@acc1, "2*a5", "a7");
+$code.=mac(\@acc0, "aa2", "aa2");
+$code.=add128(\@acc1, \@acc0);
+
+$code.=msc(\@acc0, "2*a1", "a3");
+$code.=mac(\@acc1, "a6", "a6");
+
+$code.=mul(\@acc2, "a0", "a0");
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=msc(\@acc0, "a2", "a2");
+$code.=mac(\@acc1, "aa0", "aa0");
+$code.=mac(\@acc0, "a4", "a4");
+
+$code.=store(0, \@acc0);
+$code.=store(4, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=mul(\@acc2, "2*aa2", "aa3");
+$code.=msc(\@acc0, "2*a2", "a3");
+$code.=mac(\@acc1, "2*a6", "a7");
+
+$code.=add128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=mul(\@acc2, "2*a0", "a1");
+$code.=mac(\@acc1, "2*aa0", "aa1");
+$code.=mac(\@acc0, "2*a4", "a5");
+
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=store(1, \@acc0);
+$code.=store(5, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=mul(\@acc2, "aa3", "aa3");
+$code.=msc(\@acc0, "a3", "a3");
+$code.=mac(\@acc1, "a7", "a7");
+
+$code.=add128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=mul(\@acc2, "2*a0", "a2");
+$code.=mac(\@acc1, "2*aa0", "aa2");
+$code.=mac(\@acc0, "2*a4", "a6");
+
+$code.=mac(\@acc2, "a1", "a1");
+$code.=mac(\@acc1, "aa1", "aa1");
+$code.=mac(\@acc0, "a5", "a5");
+
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=store(2, \@acc0);
+$code.=store(6, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=add_c(\@acc0, 3);
+$code.=add_c(\@acc1, 7);
+$code.=store(3, \@acc0);
+$code.=store(7, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+$code.=<<___;
+	add	$acc0[0],$acc0[0],$acc1[0]
+___
+$code.=add_to_c(4, \@acc0);
+$code.=add_to_c(0, \@acc1);
+$code.=epilogue("ossl_gf448_sqr_armv8", 96);
+
+$code.=<<___;
+.asciz	"X448 field multiplication for ARMv8"
+___
+
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -0,0 +1,631 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+# X448/Ed448 field multiplication and squaring for x86_64.
+#
+# The field elements are those of crypto/ec/curve448/arch_64, eight limbs
+# in radix 2^56, and the subroutines compute exactly the same results as
+# gf_mul and gf_sqr in f_impl64.c, Karatsuba split included. They only
+# differ in the use of MULX, which leaves the flags alone, and of the
+# independent ADCX and ADOX carry chains, which lets two of the 128-bit
+# accumulators be summed at the same time. Both instructions are needed,
+# so the code is only used on processors that advertise BMI2 and ADX,
+# see ossl_gf448_mulx_eligible.
+#
+# void ossl_gf448_mul_mulx(uint64_t c[8], const uint64_t a[8],
+#                          const uint64_t b[8]);
+# void ossl_gf448_sqr_mulx(uint64_t c[8], const uint64_t a[8]);
+# int ossl_gf448_mulx_eligible(void);
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+		=~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+	$addx = ($1>=2.23);
+}
+
+if (!$addx && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+	    `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)/) {
+	$addx = ($1>=2.10);
+}
+
+if (!$addx && $win64 && ($flavour =~ /masm/ || $ENV{ASM} =~ /ml64/) &&
+	    `ml64 2>&1` =~ /Version ([0-9]+)\./) {
+	$addx = ($1>=12);
+}
+
+if (!$addx && `$ENV{CC} -v 2>&1` =~ /((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)/) {
+	my $ver = $2 + $3/100.0;	# 3.1->3.01, 3.10->3.10
+	$addx = ($ver>=3.03);
+}
+
+# 128-bit accumulators, [low, high]
+my @acc0 = ("%r8", "%r9");
+my @acc1 = ("%r10", "%r11");
+my @acc2 = ("%r12", "%r13");
+# product halves for the CF and the OF chains
+my @tc = ("%rax", "%rbx");
+my @to = ("%r14", "%r15");
+my ($cp, $ap, $bp, $mask) = ("%rdi", "%rsi", "%rcx", "%rbp");
+
+# Operands are named after the variables of f_impl64.c, e.g. "a3" or
+# "bbb1"; the Karatsuba sums live in the stack frame. A leading "2*"
+# doubles the operand, which is only ever done to the one loaded into
+# %rdx.
+my %frame = (aa => 0, bb => 32, bbb => 64);
+
+sub opnd {
+    my ($name) = @_;
+    my ($var, $i) = $name =~ /^(\D+)(\d)$/ or die "bad operand $name";
+
+    return 8*$i."($ap)"	if ($var eq "a");
+    return 8*$i."($bp)"	if ($var eq "b");
+    return $frame{$var}+8*$i."(%rsp)";
+}
+
+sub load_rdx {
+    my ($name) = @_;
+    my $code;
+
+    if ($name =~ s/^2\*//) {
+	$code = "\tmov\t".opnd($name).",%rdx\n";
+	$code .= "\tlea\t(%rdx,%rdx),%rdx\n";
+    } else {
+	$code = "\tmov\t".opnd($name).",%rdx\n";
+    }
+    return $code;
+}
+
+# Whether CF and OF are known to be clear. Every accumulation leaves the
+# carry of its chain clear, so consecutive ones can alternate between the
+# chains no matter which accumulators they update.
+my $chains_clear = 0;
+my $next_chain = "c";
+
+# acc += x * y, on the CF chain, the OF chain or with plain ADD/ADC; "a"
+# picks a chain, clearing the flags first if anything clobbered them
+sub mac {
+    my ($acc, $x, $y, $chain) = @_;
+    my $code = "";
+
+    if ($chain eq "a") {
+	if (!$chains_clear) {
+	    $code .= "\txor\t%edx,%edx\t\t# clear CF and OF\n";
+	    $chains_clear = 1;
+	}
+	$chain = $next_chain;
+	$next_chain = $chain eq "c" ? "o" : "c";
+    } elsif ($chain eq "") {
+	$chains_clear = 0;
+    }
+    $code .= load_rdx($x);
+
+    if ($chain eq "c") {
+	$code .= "\tmulx\t".opnd($y).",$tc[0],$tc[1]\n";
+	$code .= "\tadcx\t$tc[0],$$acc[0]\n";
+	$code .= "\tadcx\t$tc[1],$$acc[1]\n";
+    } elsif ($chain eq "o") {
+	$code .= "\tmulx\t".opnd($y).",$to[0],$to[1]\n";
+	$code .= "\tadox\t$to[0],$$acc[0]\n";
+	$code .= "\tadox\t$to[1],$$acc[1]\n";
+    } else {
+	$code .= "\tmulx\t".opnd($y).",$tc[0],$tc[1]\n";
+	$code .= "\tadd\t$tc[0],$$acc[0]\n";
+	$code .= "\tadc\t$tc[1],$$acc[1]\n";
+    }
+    return $code;
+}
+
+# acc -= x * y
+sub msc {
+    my ($acc, $x, $y) = @_;
+    my $code = load_rdx($x);
+
+    $chains_clear = 0;
+
+    $code .= "\tmulx\t".opnd($y).",$tc[0],$tc[1]\n";
+    $code .= "\tsub\t$tc[0],$$acc[0]\n";
+    $code .= "\tsbb\t$tc[1],$$acc[1]\n";
+    return $code;
+}
+
+# acc = x * y
+sub mul {
+    my ($acc, $x, $y) = @_;
+
+    return load_rdx($x)."\tmulx\t".opnd($y).",$$acc[0],$$acc[1]\n";
+}
+
+sub add128 {
+    my ($acc, $src) = @_;
+
+    $chains_clear = 0;
+    return "\tadd\t$$src[0],$$acc[0]\n\tadc\t$$src[1],$$acc[1]\n";
+}
+
+sub sub128 {
+    my ($acc, $src) = @_;
+
+    $chains_clear = 0;
+    return "\tsub\t$$src[0],$$acc[0]\n\tsbb\t$$src[1],$$acc[1]\n";
+}
+
+sub shr128 {
+    my ($acc, $n) = @_;
+
+    $chains_clear = 0;
+    return "\tshrd\t\$$n,$$acc[1],$$acc[0]\n\tshr\t\$$n,$$acc[1]\n";
+}
+
+# c[i] = (acc << shift) & mask
+sub store {
+    my ($i, $acc, $shift) = @_;
+    my $code = "\tmov\t$$acc[0],%rdx\n";
+
+    $chains_clear = 0;
+    $code .= "\tshl\t\$$shift,%rdx\n" if ($shift);
+    $code .= "\tand\t$mask,%rdx\n";
+    $code .= "\tmov\t%rdx,".8*$i."($cp)\n";
+    return $code;
+}
+
+# acc += c[i]
+sub add_c {
+    my ($acc, $i) = @_;
+
+    $chains_clear = 0;
+    return "\tadd\t".8*$i."($cp),$$acc[0]\n\tadc\t\$0,$$acc[1]\n";
+}
+
+sub prologue {
+    my ($name, $frame, $nargs) = @_;
+    my $code = <<___;
+.globl	$name
+.type	$name,\@function,$nargs
+.align	32
+$name:
+.cfi_startproc
+	push	%rbp
+.cfi_push	%rbp
+	push	%rbx
+.cfi_push	%rbx
+	push	%r12
+.cfi_push	%r12
+	push	%r13
+.cfi_push	%r13
+	push	%r14
+.cfi_push	%r14
+	push	%r15
+.cfi_push	%r15
+	lea	-$frame(%rsp),%rsp
+.cfi_adjust_cfa_offset	$frame
+.L${name}_body:
+
+	mov	\$0x00ffffffffffffff,$mask
+___
+    $code .= "\tmov\t%rdx,$bp\n" if ($nargs == 3);
+    return $code;
+}
+
+sub epilogue {
+    my ($name, $frame) = @_;
+
+    return <<___;
+	mov	$frame+8*0(%rsp),%r15
+.cfi_restore	%r15
+	mov	$frame+8*1(%rsp),%r14
+.cfi_restore	%r14
+	mov	$frame+8*2(%rsp),%r13
+.cfi_restore	%r13
+	mov	$frame+8*3(%rsp),%r12
+.cfi_restore	%r12
+	mov	$frame+8*4(%rsp),%rbx
+.cfi_restore	%rbx
+	mov	$frame+8*5(%rsp),%rbp
+.cfi_restore	%rbp
+	lea	$frame+8*6(%rsp),%rsp
+.cfi_adjust_cfa_offset	-$frame-8*6
+.L${name}_epilogue:
+	ret
+.cfi_endproc
+.size	$name,.-$name
+___
+}
+
+$code.=<<___;
+.text
+
+___
+
+if ($addx) {
+$code.=<<___;
+.extern	OPENSSL_ia32cap_P
+.globl	ossl_gf448_mulx_eligible
+.type	ossl_gf448_mulx_eligible,\@abi-omnipotent
+.align	32
+ossl_gf448_mulx_eligible:
+.cfi_startproc
+	mov	OPENSSL_ia32cap_P+8(%rip),%ecx
+	xor	%eax,%eax
+	and	\$0x80100,%ecx
+	cmp	\$0x80100,%ecx
+	cmove	%ecx,%eax
+	ret
+.cfi_endproc
+.size	ossl_gf448_mulx_eligible,.-ossl_gf448_mulx_eligible
+
+___
+
+######################################################################
+# Multiplication
+#
+# For each column i the three Karatsuba accumulators are summed as in
+# gf_mul, two at a time on the CF and OF chains: first accum1, split in
+# two halves, then accum2 and accum0. The accumulators never exceed
+# 2^128, so the chains are clear after every high half and need no
+# flushing.
+
+$code.=prologue("ossl_gf448_mul_mulx", 96, 3);
+
+# aa[i] = a[i] + a[i + 4], bb[i] = b[i] + b[i + 4], bbb[i] = bb[i] + b[i + 4]
+for (my $i = 0; $i < 4; $i++) {
+    $code.=<<___;
+	mov	8*$i($ap),%rax
+	mov	8*$i($bp),%rbx
+	mov	8*($i+4)($bp),%rdx
+	add	8*($i+4)($ap),%rax
+	add	%rdx,%rbx
+	mov	%rax,@{[$frame{aa}+8*$i]}(%rsp)
+	add	%rbx,%rdx
+	mov	%rbx,@{[$frame{bb}+8*$i]}(%rsp)
+	mov	%rdx,@{[$frame{bbb}+8*$i]}(%rsp)
+___
+}
+$code.=<<___;
+	xor	$acc0[0],$acc0[0]
+	xor	$acc0[1],$acc0[1]
+	xor	$acc1[0],$acc1[0]
+	xor	$acc1[1],$acc1[1]
+___
+
+for (my $i = 0; $i < 4; $i++) {
+    # accum1, with the odd terms summed in accum2 on the OF chain
+    $code.=<<___;
+	xor	$acc2[0],$acc2[0]	# also clears CF and OF
+	xor	$acc2[1],$acc2[1]
+___
+    for (my $j = 0; $j < 4; $j++) {
+	my ($acc, $chain) = ($j & 1) ? (\@acc2, "o") : (\@acc1, "c");
+
+	if ($j <= $i) {
+	    $code.=mac($acc, "aa$j", "bb".($i - $j), $chain);
+	} else {
+	    $code.=mac($acc, "aa$j", "bbb".($i - $j + 4), $chain);
+	}
+    }
+    $code.=add128(\@acc1, \@acc2);
+
+    # accum2 and accum0
+    $code.=<<___;
+	xor	$acc2[0],$acc2[0]	# also clears CF and OF
+	xor	$acc2[1],$acc2[1]
+___
+    for (my $j = 0; $j < 4; $j++) {
+	if ($j <= $i) {
+	    $code.=mac(\@acc2, "a$j", "b".($i - $j), "c");
+	    $code.=mac(\@acc0, "a".($j + 4), "b".($i - $j + 4), "o");
+	} else {
+	    $code.=mac(\@acc2, "a$j", "b".($i - $j + 8), "c");
+	    $code.=mac(\@acc0, "a".($j + 4), "bb".($i - $j + 4), "o");
+	}
+    }
+    $code.=sub128(\@acc1, \@acc2);
+    $code.=add128(\@acc0, \@acc2);
+    $code.=store($i, \@acc0);
+    $code.=store($i + 4, \@acc1);
+    $code.=shr128(\@acc0, 56);
+    $code.=shr128(\@acc1, 56);
+}
+
+$code.=add128(\@acc0, \@acc1);
+$code.=add_c(\@acc0, 4);
+$code.=add_c(\@acc1, 0);
+$code.=store(4, \@acc0);
+$code.=store(0, \@acc1);
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+$code.=<<___;
+	add	$acc0[0],8*5($cp)
+	add	$acc1[0],8*1($cp)
+
+___
+$code.=epilogue("ossl_gf448_mul_mulx", 96);
+
+######################################################################
+# Squaring
+#
+# A transliteration of gf_sqr. Its subtractions need plain SUB/SBB, the
+# runs of additions in between alternate between the carry chains.
+
+$code.=prologue("ossl_gf448_sqr_mulx", 32, 2);
+
+for (my $i = 0; $i < 4; $i++) {
+    $code.=<<___;
+	mov	8*$i($ap),%rax
+	add	8*($i+4)($ap),%rax
+	mov	%rax,@{[$frame{aa}+8*$i]}(%rsp)
+___
+}
+
+$code.=mul(\@acc2, "a0", "a3");
+$code.=mul(\@acc0, "aa0", "aa3");
+$code.=mul(\@acc1, "a4", "a7");
+
+$code.=mac(\@acc2, "a1", "a2", "a");
+$code.=mac(\@acc0, "aa1", "aa2", "a");
+$code.=mac(\@acc1, "a5", "a6", "a");
+
+$code.=sub128(\@acc0, \@acc2);
+$code.=add128(\@acc1, \@acc2);
+
+$code.=store(3, \@acc1, 1);
+$code.=store(7, \@acc0, 1);
+
+$code.=shr128(\@acc0, 55);
+$code.=shr128(\@acc1, 55);
+
+$code.=mac(\@acc0, "2*aa1", "aa3", "a");
+$code.=mac(\@acc1, "2*a5", "a7", "a");
+$code.=mac(\@acc0, "aa2", "aa2", "a");
+$code.=add128(\@acc1, \@acc0);
+
+$code.=msc(\@acc0, "2*a1", "a3");
+$code.=mac(\@acc1, "a6", "a6", "a");
+
+$code.=mul(\@acc2, "a0", "a0");
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=msc(\@acc0, "a2", "a2");
+$code.=mac(\@acc1, "aa0", "aa0", "a");
+$code.=mac(\@acc0, "a4", "a4", "a");
+
+$code.=store(0, \@acc0);
+$code.=store(4, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=mul(\@acc2, "2*aa2", "aa3");
+$code.=msc(\@acc0, "2*a2", "a3");
+$code.=mac(\@acc1, "2*a6", "a7", "a");
+
+$code.=add128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=mul(\@acc2, "2*a0", "a1");
+$code.=mac(\@acc1, "2*aa0", "aa1", "a");
+$code.=mac(\@acc0, "2*a4", "a5", "a");
+
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=store(1, \@acc0);
+$code.=store(5, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=mul(\@acc2, "aa3", "aa3");
+$code.=msc(\@acc0, "a3", "a3");
+$code.=mac(\@acc1, "a7", "a7", "a");
+
+$code.=add128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=mul(\@acc2, "2*a0", "a2");
+$code.=mac(\@acc1, "2*aa0", "aa2", "a");
+$code.=mac(\@acc0, "2*a4", "a6", "a");
+
+$code.=mac(\@acc2, "a1", "a1", "a");
+$code.=mac(\@acc1, "aa1", "aa1", "a");
+$code.=mac(\@acc0, "a5", "a5", "a");
+
+$code.=sub128(\@acc1, \@acc2);
+$code.=add128(\@acc0, \@acc2);
+
+$code.=store(2, \@acc0);
+$code.=store(6, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+
+$code.=add_c(\@acc0, 3);
+$code.=add_c(\@acc1, 7);
+$code.=store(3, \@acc0);
+$code.=store(7, \@acc1);
+
+$code.=shr128(\@acc0, 56);
+$code.=shr128(\@acc1, 56);
+$code.=<<___;
+	add	$acc1[0],$acc0[0]
+	add	$acc0[0],8*4($cp)
+	add	$acc1[0],8*0($cp)
+
+___
+$code.=epilogue("ossl_gf448_sqr_mulx", 32);
+} else {
+$code.=<<___;
+.globl	ossl_gf448_mulx_eligible
+.type	ossl_gf448_mulx_eligible,\@abi-omnipotent
+.align	32
+ossl_gf448_mulx_eligible:
+.cfi_startproc
+	xor	%eax,%eax
+	ret
+.cfi_endproc
+.size	ossl_gf448_mulx_eligible,.-ossl_gf448_mulx_eligible
+
+.globl	ossl_gf448_mul_mulx
+.type	ossl_gf448_mul_mulx,\@abi-omnipotent
+.globl	ossl_gf448_sqr_mulx
+ossl_gf448_mul_mulx:
+ossl_gf448_sqr_mulx:
+.cfi_startproc
+	.byte	0x0f,0x0b	# ud2
+	ret
+.cfi_endproc
+.size	ossl_gf448_mul_mulx,.-ossl_gf448_mul_mulx
+___
+}
+
+# EXCEPTION_DISPOSITION handler (EXCEPTION_RECORD *rec,ULONG64 frame,
+#		CONTEXT *context,DISPATCHER_CONTEXT *disp)
+if ($win64 && $addx) {
+$rec="%rcx";
+$frame="%rdx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+
+.type	full_handler,\@abi-omnipotent
+.align	16
+full_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# end of prologue label
+	cmp	%r10,%rbx		# context->Rip<end of prologue label
+	jb	.Lcommon_seh_tail
+
+	mov	152($context),%rax	# pull context->Rsp
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=epilogue label
+	jae	.Lcommon_seh_tail
+
+	mov	8(%r11),%r10d		# HandlerData[2]
+	lea	(%rax,%r10),%rax
+
+	mov	-8(%rax),%rbp
+	mov	-16(%rax),%rbx
+	mov	-24(%rax),%r12
+	mov	-32(%rax),%r13
+	mov	-40(%rax),%r14
+	mov	-48(%rax),%r15
+	mov	%rbx,144($context)	# restore context->Rbx
+	mov	%rbp,160($context)	# restore context->Rbp
+	mov	%r12,216($context)	# restore context->R12
+	mov	%r13,224($context)	# restore context->R13
+	mov	%r14,232($context)	# restore context->R14
+	mov	%r15,240($context)	# restore context->R15
+
+.Lcommon_seh_tail:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	full_handler,.-full_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_ossl_gf448_mul_mulx
+	.rva	.LSEH_end_ossl_gf448_mul_mulx
+	.rva	.LSEH_info_ossl_gf448_mul_mulx
+
+	.rva	.LSEH_begin_ossl_gf448_sqr_mulx
+	.rva	.LSEH_end_ossl_gf448_sqr_mulx
+	.rva	.LSEH_info_ossl_gf448_sqr_mulx
+
+.section	.xdata
+.align	8
+.LSEH_info_ossl_gf448_mul_mulx:
+	.byte	9,0,0,0
+	.rva	full_handler
+	.rva	.Lossl_gf448_mul_mulx_body,.Lossl_gf448_mul_mulx_epilogue	# HandlerData[]
+	.long	96+48,0
+.LSEH_info_ossl_gf448_sqr_mulx:
+	.byte	9,0,0,0
+	.rva	full_handler
+	.rva	.Lossl_gf448_sqr_mulx_body,.Lossl_gf448_sqr_mulx_epilogue	# HandlerData[]
+	.long	32+48,0
+___
+}
+
+$code.=<<___;
+.asciz	"X448 field multiplication for x86_64"
+___
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -17,6 +17,7 @@
 #include "crypto/ecx.h"
 #include "ec_local.h"
 #include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/sha.h>
 
 #include "internal/numbers.h"
@@ -2058,6 +2059,53 @@ static void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q)
     fe_add(r->T, t0, r->T);
 }
 
+/*
+ * Is 8 * r the neutral element?  This holds iff r has small order.  |r| is
+ * overwritten with 8 * r.
+ */
+static int ge_p2_cofactor_is_neutral(ge_p2 *r)
+{
+    ge_p1p1 t;
+    fe ycheck;
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        ge_p2_dbl(&t, r);
+        ge_p1p1_to_p2(r, &t);
+    }
+    fe_sub(ycheck, r->Y, r->Z);
+    return !fe_isnonzero(r->X) && !fe_isnonzero(ycheck);
+}
+
+/*
+ * Like ge_frombytes_vartime(), but also rejects non-canonical encodings, i.e.
+ * y >= q, and points of small order.  The only points with x == 0 have small
+ * order, so the non-canonical encodings of x == 0 with the sign bit set are
+ * rejected too.
+ */
+static int ge_frombytes_strict_vartime(ge_p3 *h, const uint8_t *s)
+{
+    ge_p2 t;
+    int i;
+
+    /* Check y < q = 2^255 - 19, the sign bit of x is not part of y */
+    if ((s[31] & 0x7f) == 0x7f && s[0] >= 0xed) {
+        for (i = 30; i > 0; i--)
+            if (s[i] != 0xff)
+                break;
+        if (i == 0)
+            return -1;
+    }
+
+    if (ge_frombytes_vartime(h, s) != 0)
+        return -1;
+
+    ge_p3_to_p2(&t, h);
+    if (ge_p2_cofactor_is_neutral(&t))
+        return -1;
+    return 0;
+}
+
 static uint8_t equal(signed char b, signed char c)
 {
     uint8_t ub = b;
@@ -4222,21 +4270,14 @@ static void table_select(ge_precomp *t, int pos, signed char b)
 }
 
 /*
- * h = a * B
- *
- * where a = a[0]+256*a[1]+...+256^31 a[31]
- * B is the Ed25519 base point (x,4/5) with x positive.
+ * e[0]+16*e[1]+...+16^63*e[63] = a[0]+256*a[1]+...+256^31*a[31]
  *
  * Preconditions:
  *   a[31] <= 127
  */
-static void ge_scalarmult_base(ge_p3 *h, const uint8_t *a)
+static void radix16(signed char e[64], const uint8_t *a)
 {
-    signed char e[64];
     signed char carry;
-    ge_p1p1 r;
-    ge_p2 s;
-    ge_precomp t;
     int i;
 
     for (i = 0; i < 32; ++i) {
@@ -4255,6 +4296,26 @@ static void ge_scalarmult_base(ge_p3 *h, const uint8_t *a)
     }
     e[63] += carry;
     /* each e[i] is between -8 and 8 */
+}
+
+/*
+ * h = a * B
+ *
+ * where a = a[0]+256*a[1]+...+256^31 a[31]
+ * B is the Ed25519 base point (x,4/5) with x positive.
+ *
+ * Preconditions:
+ *   a[31] <= 127
+ */
+static void ge_scalarmult_base(ge_p3 *h, const uint8_t *a)
+{
+    signed char e[64];
+    ge_p1p1 r;
+    ge_p2 s;
+    ge_precomp t;
+    int i;
+
+    radix16(e, a);
 
     ge_p3_0(h);
     for (i = 1; i < 64; i += 2) {
@@ -4528,26 +4589,12 @@ static const ge_precomp Bi[8] = {
     },
 };
 
-/*
- * r = a * A + b * B
- *
- * where a = a[0]+256*a[1]+...+256^31 a[31].
- * and b = b[0]+256*b[1]+...+256^31 b[31].
- * B is the Ed25519 base point (x,4/5) with x positive.
- */
-static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
-                                         const ge_p3 *A, const uint8_t *b)
+/* Ai = A,3A,5A,7A,9A,11A,13A,15A */
+static void ge_cached_odd_multiples(ge_cached Ai[8], const ge_p3 *A)
 {
-    signed char aslide[256];
-    signed char bslide[256];
-    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
     ge_p1p1 t;
     ge_p3 u;
     ge_p3 A2;
-    int i;
-
-    slide(aslide, a);
-    slide(bslide, b);
 
     ge_p3_to_cached(&Ai[0], A);
     ge_p3_dbl(&t, A);
@@ -4573,6 +4620,29 @@ static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
     ge_add(&t, &A2, &Ai[6]);
     ge_p1p1_to_p3(&u, &t);
     ge_p3_to_cached(&Ai[7], &u);
+}
+
+/*
+ * r = a * A + b * B
+ *
+ * where a = a[0]+256*a[1]+...+256^31 a[31].
+ * and b = b[0]+256*b[1]+...+256^31 b[31].
+ * B is the Ed25519 base point (x,4/5) with x positive.
+ */
+static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
+                                         const ge_p3 *A, const uint8_t *b)
+{
+    signed char aslide[256];
+    signed char bslide[256];
+    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+    ge_p1p1 t;
+    ge_p3 u;
+    int i;
+
+    slide(aslide, a);
+    slide(bslide, b);
+
+    ge_cached_odd_multiples(Ai, A);
 
     ge_p2_0(r);
 
@@ -4605,6 +4675,194 @@ static void ge_double_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
     }
 }
 
+/*
+ * r = a * A + b * B + z[0] * R[0] + ... + z[num-1] * R[num-1]
+ *
+ * where the sliding window recodings of the scalars z[i] and the odd
+ * multiples of the points R[i] are passed in as zslide[i] and Ri[i].  Like
+ * ge_double_scalarmult_vartime(), all additions share the same doublings.
+ */
+static void ge_multi_scalarmult_vartime(ge_p2 *r, const uint8_t *a,
+                                        const ge_p3 *A, const uint8_t *b,
+                                        size_t num,
+                                        signed char (*zslide)[256],
+                                        ge_cached (*Ri)[8])
+{
+    signed char aslide[256];
+    signed char bslide[256];
+    ge_cached Ai[8];
+    ge_p1p1 t;
+    ge_p3 u;
+    size_t j;
+    int i;
+
+    slide(aslide, a);
+    slide(bslide, b);
+
+    ge_cached_odd_multiples(Ai, A);
+
+    ge_p2_0(r);
+
+    for (i = 255; i >= 0; --i) {
+        if (aslide[i] || bslide[i])
+            break;
+        for (j = 0; j < num; j++)
+            if (zslide[j][i])
+                break;
+        if (j < num)
+            break;
+    }
+
+    for (; i >= 0; --i) {
+        ge_p2_dbl(&t, r);
+
+        if (aslide[i] > 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_add(&t, &u, &Ai[aslide[i] / 2]);
+        } else if (aslide[i] < 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_sub(&t, &u, &Ai[(-aslide[i]) / 2]);
+        }
+
+        if (bslide[i] > 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_madd(&t, &u, &Bi[bslide[i] / 2]);
+        } else if (bslide[i] < 0) {
+            ge_p1p1_to_p3(&u, &t);
+            ge_msub(&t, &u, &Bi[(-bslide[i]) / 2]);
+        }
+
+        for (j = 0; j < num; j++) {
+            if (zslide[j][i] > 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_add(&t, &u, &Ri[j][zslide[j][i] / 2]);
+            } else if (zslide[j][i] < 0) {
+                ge_p1p1_to_p3(&u, &t);
+                ge_sub(&t, &u, &Ri[j][(-zslide[j][i]) / 2]);
+            }
+        }
+
+        ge_p1p1_to_p2(r, &t);
+    }
+}
+
+/*
+ * The multiples of a public key A needed to verify signatures with it
+ * without doublings, in the layout of k25519Precomp:
+ *
+ *   Ai[i][j] = (j+1)*256^i*(-A)
+ */
+struct ed25519_precomp_st {
+    ge_cached Ai[32][8];
+};
+
+ED25519_PRECOMP *ossl_ed25519_precomp_new(const uint8_t public_key[32])
+{
+    ED25519_PRECOMP *pre;
+    ge_p1p1 t;
+    ge_p3 A, u;
+    int i, j;
+
+    if (ge_frombytes_strict_vartime(&A, public_key) != 0)
+        return NULL;
+
+    fe_neg(A.X, A.X);
+    fe_neg(A.T, A.T);
+
+    if ((pre = OPENSSL_malloc(sizeof(*pre))) == NULL)
+        return NULL;
+
+    for (i = 0; i < 32; i++) {
+        ge_p3_to_cached(&pre->Ai[i][0], &A);
+        ge_p3_dbl(&t, &A);
+        ge_p1p1_to_p3(&u, &t);
+        ge_p3_to_cached(&pre->Ai[i][1], &u);
+        for (j = 2; j < 8; j++) {
+            ge_add(&t, &u, &pre->Ai[i][0]);
+            ge_p1p1_to_p3(&u, &t);
+            ge_p3_to_cached(&pre->Ai[i][j], &u);
+        }
+        /* 256*A = 32*(8*A) */
+        for (j = 0; j < 5; j++) {
+            ge_p3_dbl(&t, &u);
+            ge_p1p1_to_p3(&u, &t);
+        }
+        A = u;
+    }
+    return pre;
+}
+
+void ossl_ed25519_precomp_free(ED25519_PRECOMP *pre)
+{
+    OPENSSL_free(pre);
+}
+
+static void ge_precomp_add(ge_p3 *h, int pos, signed char a,
+                           const ED25519_PRECOMP *pre, signed char b)
+{
+    ge_p1p1 t;
+
+    if (a > 0) {
+        ge_add(&t, h, &pre->Ai[pos][a - 1]);
+        ge_p1p1_to_p3(h, &t);
+    } else if (a < 0) {
+        ge_sub(&t, h, &pre->Ai[pos][-a - 1]);
+        ge_p1p1_to_p3(h, &t);
+    }
+
+    if (b > 0) {
+        ge_madd(&t, h, &k25519Precomp[pos][b - 1]);
+        ge_p1p1_to_p3(h, &t);
+    } else if (b < 0) {
+        ge_msub(&t, h, &k25519Precomp[pos][-b - 1]);
+        ge_p1p1_to_p3(h, &t);
+    }
+}
+
+/*
+ * r = a * A + b * B
+ *
+ * like ge_double_scalarmult_vartime(), but with both points fixed: A is
+ * given by its table |pre| and the scalars are split into signed radix 16
+ * digits as in ge_scalarmult_base(), which leaves only four doublings.
+ *
+ * Preconditions:
+ *   a[31] <= 127
+ *   b[31] <= 127
+ */
+static void ge_double_scalarmult_precomp_vartime(ge_p2 *r, const uint8_t *a,
+                                                 const ED25519_PRECOMP *pre,
+                                                 const uint8_t *b)
+{
+    signed char ae[64];
+    signed char be[64];
+    ge_p1p1 t;
+    ge_p2 s;
+    ge_p3 h;
+    int i;
+
+    radix16(ae, a);
+    radix16(be, b);
+
+    ge_p3_0(&h);
+    for (i = 1; i < 64; i += 2)
+        ge_precomp_add(&h, i / 2, ae[i], pre, be[i]);
+
+    ge_p3_dbl(&t, &h);
+    ge_p1p1_to_p2(&s, &t);
+    ge_p2_dbl(&t, &s);
+    ge_p1p1_to_p2(&s, &t);
+    ge_p2_dbl(&t, &s);
+    ge_p1p1_to_p2(&s, &t);
+    ge_p2_dbl(&t, &s);
+    ge_p1p1_to_p3(&h, &t);
+
+    for (i = 0; i < 64; i += 2)
+        ge_precomp_add(&h, i / 2, ae[i], pre, be[i]);
+
+    ge_p3_to_p2(r, &h);
+}
+
 /*
  * The set of scalars is \Z/l
  * where l = 2^252 + 27742317777372353535851937790883648493.
@@ -5540,28 +5798,60 @@ err:
 
 static const char allzeroes[15];
 
+/*
+ * Check 0 <= s < L where L = 2^252 + 27742317777372353535851937790883648493
+ *
+ * If not the signature is publicly invalid. Since it's public we can do the
+ * check in variable time.
+ */
+static int ed25519_scalar_is_canonical(const uint8_t s[32])
+{
+    /* 27742317777372353535851937790883648493 in little endian format */
+    static const uint8_t l_low[16] = {
+        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2,
+        0xDE, 0xF9, 0xDE, 0x14
+    };
+    int i;
+
+    /* First check the most significant byte */
+    if (s[31] > 0x10)
+        return 0;
+    if (s[31] == 0x10) {
+        /*
+         * Most significant byte indicates a value close to 2^252 so check the
+         * rest
+         */
+        if (memcmp(s + 16, allzeroes, sizeof(allzeroes)) != 0)
+            return 0;
+        for (i = 15; i >= 0; i--) {
+            if (s[i] < l_low[i])
+                break;
+            if (s[i] > l_low[i])
+                return 0;
+        }
+        if (i < 0)
+            return 0;
+    }
+    return 1;
+}
+
 int
 ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
                     const uint8_t signature[64], const uint8_t public_key[32],
+                    const ED25519_PRECOMP *precomp,
                     const uint8_t dom2flag, const uint8_t phflag, const uint8_t csflag,
                     const uint8_t *context, size_t context_len,
                     OSSL_LIB_CTX *libctx, const char *propq)
 {
-    int i;
-    ge_p3 A;
+    ge_p3 A, R;
     const uint8_t *r, *s;
     EVP_MD *sha512;
     EVP_MD_CTX *hash_ctx = NULL;
     unsigned int sz;
     int res = 0;
-    ge_p2 R;
+    ge_p2 Rcheck;
     uint8_t rcheck[32];
     uint8_t h[SHA512_DIGEST_LENGTH];
-    /* 27742317777372353535851937790883648493 in little endian format */
-    const uint8_t l_low[16] = {
-        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2,
-        0xDE, 0xF9, 0xDE, 0x14
-    };
 
     if (context == NULL)
         context_len = 0;
@@ -5577,40 +5867,18 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
     r = signature;
     s = signature + 32;
 
-    /*
-     * Check 0 <= s < L where L = 2^252 + 27742317777372353535851937790883648493
-     *
-     * If not the signature is publicly invalid. Since it's public we can do the
-     * check in variable time.
-     *
-     * First check the most significant byte
-     */
-    if (s[31] > 0x10)
+    if (!ed25519_scalar_is_canonical(s)
+            || ge_frombytes_strict_vartime(&R, r) != 0)
         return 0;
-    if (s[31] == 0x10) {
-        /*
-         * Most significant byte indicates a value close to 2^252 so check the
-         * rest
-         */
-        if (memcmp(s + 16, allzeroes, sizeof(allzeroes)) != 0)
-            return 0;
-        for (i = 15; i >= 0; i--) {
-            if (s[i] < l_low[i])
-                break;
-            if (s[i] > l_low[i])
-                return 0;
-        }
-        if (i < 0)
+
+    if (precomp == NULL) {
+        if (ge_frombytes_strict_vartime(&A, public_key) != 0)
             return 0;
-    }
 
-    if (ge_frombytes_vartime(&A, public_key) != 0) {
-        return 0;
+        fe_neg(A.X, A.X);
+        fe_neg(A.T, A.T);
     }
 
-    fe_neg(A.X, A.X);
-    fe_neg(A.T, A.T);
-
     sha512 = EVP_MD_fetch(libctx, SN_sha512, propq);
     if (sha512 == NULL)
         return 0;
@@ -5627,9 +5895,12 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
 
     x25519_sc_reduce(h);
 
-    ge_double_scalarmult_vartime(&R, h, &A, s);
+    if (precomp != NULL)
+        ge_double_scalarmult_precomp_vartime(&Rcheck, h, precomp, s);
+    else
+        ge_double_scalarmult_vartime(&Rcheck, h, &A, s);
 
-    ge_tobytes(rcheck, &R);
+    ge_tobytes(rcheck, &Rcheck);
 
     res = CRYPTO_memcmp(rcheck, r, sizeof(rcheck)) == 0;
 
@@ -5639,13 +5910,167 @@ ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
      *
      * the less strict verification equation uses the curve cofactor:
      *          [h*8](-A) + [s*8]B == [8]R
+     * which is what ossl_ed25519_verify_batch() checks.
      */
+
 err:
     EVP_MD_free(sha512);
     EVP_MD_CTX_free(hash_ctx);
     return res;
 }
 
+/*
+ * Randomized batch verification of up to ED25519_BATCH_MAX signatures.
+ *
+ * For random 128 bit z[i], all signatures pass the cofactored verification
+ * equation, [8]([s[i]]B - [h[i]]A - R[i]) == 0, (with overwhelming
+ * probability) iff
+ *
+ *   [8]([sum(z[i]*s[i])]B - [sum(z[i]*h[i])]A - sum([z[i]]R[i])) == 0
+ *
+ * which costs one multi-scalar multiplication for the whole batch instead of
+ * one double scalar multiplication per signature.
+ */
+#define ED25519_BATCH_MAX 64
+
+static int ed25519_verify_batch_int(size_t num, const uint8_t *const *tbs,
+                                    const size_t *tbs_len,
+                                    const uint8_t *const *signatures,
+                                    const uint8_t public_key[32],
+                                    const ge_p3 *negA,
+                                    const uint8_t dom2flag,
+                                    const uint8_t phflag,
+                                    const uint8_t *context,
+                                    size_t context_len,
+                                    EVP_MD *sha512, EVP_MD_CTX *hash_ctx,
+                                    signed char (*zslide)[256],
+                                    ge_cached (*Ri)[8],
+                                    OSSL_LIB_CTX *libctx)
+{
+    uint8_t zbuf[ED25519_BATCH_MAX * 16];
+    uint8_t z[32], h[SHA512_DIGEST_LENGTH];
+    uint8_t zs[32], zh[32];
+    ge_p3 R;
+    ge_p2 r;
+    unsigned int sz;
+    size_t i;
+
+    if (RAND_bytes_ex(libctx, zbuf, num * 16, 0) <= 0)
+        return 0;
+
+    memset(zs, 0, sizeof(zs));
+    memset(zh, 0, sizeof(zh));
+    memset(z, 0, sizeof(z));
+    for (i = 0; i < num; i++) {
+        const uint8_t *rbytes = signatures[i], *s = signatures[i] + 32;
+
+        if (!ed25519_scalar_is_canonical(s)
+                || ge_frombytes_strict_vartime(&R, rbytes) != 0)
+            return 0;
+
+        fe_neg(R.X, R.X);
+        fe_neg(R.T, R.T);
+        ge_cached_odd_multiples(Ri[i], &R);
+
+        if (!hash_init_with_dom(hash_ctx, sha512, dom2flag, phflag, context,
+                                context_len)
+            || !EVP_DigestUpdate(hash_ctx, rbytes, 32)
+            || !EVP_DigestUpdate(hash_ctx, public_key, 32)
+            || !EVP_DigestUpdate(hash_ctx, tbs[i], tbs_len[i])
+            || !EVP_DigestFinal_ex(hash_ctx, h, &sz))
+            return 0;
+        x25519_sc_reduce(h);
+
+        memcpy(z, zbuf + i * 16, 16);
+        slide(zslide[i], z);
+        sc_muladd(zs, z, s, zs);
+        sc_muladd(zh, z, h, zh);
+    }
+
+    ge_multi_scalarmult_vartime(&r, zh, negA, zs, num, zslide, Ri);
+    return ge_p2_cofactor_is_neutral(&r);
+}
+
+int
+ossl_ed25519_verify_batch(size_t num, const uint8_t *const *tbs,
+                          const size_t *tbs_len,
+                          const uint8_t *const *signatures,
+                          const uint8_t public_key[32],
+                          const uint8_t dom2flag, const uint8_t phflag,
+                          const uint8_t csflag,
+                          const uint8_t *context, size_t context_len,
+                          OSSL_LIB_CTX *libctx, const char *propq)
+{
+    ge_p3 A;
+    EVP_MD *sha512 = NULL;
+    EVP_MD_CTX *hash_ctx = NULL;
+    signed char (*zslide)[256] = NULL;
+    ge_cached (*Ri)[8] = NULL;
+    size_t n, i;
+    int res = 0;
+
+    if (context == NULL)
+        context_len = 0;
+
+    /* if csflag is set, then a non-empty context-string is required */
+    if (csflag && context_len == 0)
+        return 0;
+
+    /* if dom2flag is not set, then an empty context-string is required */
+    if (!dom2flag && context_len > 0)
+        return 0;
+
+    if (num == 0)
+        return 1;
+
+    if (ge_frombytes_strict_vartime(&A, public_key) != 0)
+        return 0;
+
+    fe_neg(A.X, A.X);
+    fe_neg(A.T, A.T);
+
+    n = num < ED25519_BATCH_MAX ? num : ED25519_BATCH_MAX;
+    sha512 = EVP_MD_fetch(libctx, SN_sha512, propq);
+    hash_ctx = EVP_MD_CTX_new();
+    zslide = OPENSSL_malloc(n * sizeof(*zslide));
+    Ri = OPENSSL_malloc(n * sizeof(*Ri));
+    if (sha512 == NULL || hash_ctx == NULL || zslide == NULL || Ri == NULL)
+        goto err;
+
+    /*
+     * The batch equation is cofactored, so it accepts some signatures that
+     * ossl_ed25519_verify() rejects, but whatever it rejects is checked
+     * again one signature at a time.  A batch is thus never rejected when
+     * each of its signatures passes ossl_ed25519_verify().
+     */
+    while (num > 0) {
+        n = num < ED25519_BATCH_MAX ? num : ED25519_BATCH_MAX;
+        if (!ed25519_verify_batch_int(n, tbs, tbs_len, signatures, public_key,
+                                      &A, dom2flag, phflag, context,
+                                      context_len, sha512, hash_ctx, zslide,
+                                      Ri, libctx)) {
+            for (i = 0; i < n; i++)
+                if (!ossl_ed25519_verify(tbs[i], tbs_len[i], signatures[i],
+                                         public_key, NULL, dom2flag, phflag,
+                                         csflag, context, context_len,
+                                         libctx, propq))
+                    goto err;
+        }
+        tbs += n;
+        tbs_len += n;
+        signatures += n;
+        num -= n;
+    }
+    res = 1;
+
+ err:
+    OPENSSL_free(zslide);
+    OPENSSL_free(Ri);
+    EVP_MD_free(sha512);
+    EVP_MD_CTX_free(hash_ctx);
+    return res;
+}
+
 int
 ossl_ed25519_public_from_private(OSSL_LIB_CTX *ctx, uint8_t out_public_key[32],
                                  const uint8_t private_key[32],
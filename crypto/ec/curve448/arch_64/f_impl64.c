@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2017-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright 2014 Cryptography Research, Inc.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -21,6 +21,47 @@ NON_EMPTY_TRANSLATION_UNIT
 
 # include "../field.h"
 
+/*
+ * The assembly versions of gf_mul and gf_sqr produce exactly the same limbs
+ * as the C code below, so the two can be mixed freely.
+ */
+# if defined(X448_ASM) && (defined(__x86_64) || defined(__x86_64__) || \
+                           defined(_M_AMD64) || defined(_M_X64))
+#  include "internal/tsan_assist.h"
+int ossl_gf448_mulx_eligible(void);
+void ossl_gf448_mul_mulx(uint64_t c[8], const uint64_t a[8],
+                         const uint64_t b[8]);
+void ossl_gf448_sqr_mulx(uint64_t c[8], const uint64_t a[8]);
+
+/*
+ * gf_mul and gf_sqr are called thousands of times per scalar multiplication,
+ * so the eligibility check is only made once.  It is -1 until then.  Threads
+ * racing to set it all store the same value.
+ */
+static TSAN_QUALIFIER int gf448_mulx = -1;
+
+static ossl_inline int gf448_mulx_eligible(void)
+{
+    int eligible = tsan_load(&gf448_mulx);
+
+    if (eligible < 0) {
+        eligible = ossl_gf448_mulx_eligible();
+        tsan_store(&gf448_mulx, eligible);
+    }
+    return eligible;
+}
+#  define GF448_ASM_ELIGIBLE gf448_mulx_eligible()
+#  define gf_mul_asm ossl_gf448_mul_mulx
+#  define gf_sqr_asm ossl_gf448_sqr_mulx
+# elif defined(X448_ASM) && defined(__aarch64__)
+void ossl_gf448_mul_armv8(uint64_t c[8], const uint64_t a[8],
+                          const uint64_t b[8]);
+void ossl_gf448_sqr_armv8(uint64_t c[8], const uint64_t a[8]);
+#  define GF448_ASM_ELIGIBLE 1
+#  define gf_mul_asm ossl_gf448_mul_armv8
+#  define gf_sqr_asm ossl_gf448_sqr_armv8
+# endif
+
 void gf_mul(gf_s * RESTRICT cs, const gf as, const gf bs)
 {
     const uint64_t *a = as->limb, *b = bs->limb;
@@ -30,6 +71,13 @@ void gf_mul(gf_s * RESTRICT cs, const gf as, const gf bs)
     uint64_t aa[4], bb[4], bbb[4];
     unsigned int i, j;
 
+# ifdef GF448_ASM_ELIGIBLE
+    if (GF448_ASM_ELIGIBLE) {
+        gf_mul_asm(c, a, b);
+        return;
+    }
+# endif
+
     for (i = 0; i < 4; i++) {
         aa[i] = a[i] + a[i + 4];
         bb[i] = b[i] + b[i + 4];
@@ -108,6 +156,13 @@ void gf_sqr(gf_s * RESTRICT cs, const gf as)
     uint64_t aa[4];
     unsigned int i;
 
+# ifdef GF448_ASM_ELIGIBLE
+    if (GF448_ASM_ELIGIBLE) {
+        gf_sqr_asm(c, a);
+        return;
+    }
+# endif
+
     /* For some reason clang doesn't vectorize this without prompting? */
     for (i = 0; i < 4; i++)
         aa[i] = a[i] + a[i + 4];
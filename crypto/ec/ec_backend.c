@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -578,6 +578,18 @@ int ossl_ec_key_otherparams_fromdata(EC_KEY *ec, const OSSL_PARAM params[])
             || !ec_set_include_public(ec, include))
             return 0;
     }
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY);
+    if (p != NULL) {
+        int precompute;
+
+        if (!OSSL_PARAM_get_int(p, &precompute))
+            return 0;
+        if (precompute)
+            EC_KEY_set_flags(ec, EC_FLAG_PRECOMPUTE_VERIFY);
+        else
+            EC_KEY_clear_flags(ec, EC_FLAG_PRECOMPUTE_VERIFY);
+    }
     if (!ec_key_point_format_fromdata(ec, params))
         return 0;
     if (!ec_key_group_check_fromdata(ec, params))
@@ -1,5 +1,5 @@
 /*
- * Copyright 2002-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2002-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2002, Oracle and/or its affiliates. All rights reserved
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -61,6 +61,34 @@ EC_KEY *EC_KEY_new_by_curve_name_ex(OSSL_LIB_CTX *ctx, const char *propq,
     return ret;
 }
 
+static void ec_verify_pre_comp_free(EC_VERIFY_PRE_COMP *vpc)
+{
+    if (vpc == NULL)
+        return;
+    EC_ec_pre_comp_free(vpc->pre_comp[0]);
+    EC_ec_pre_comp_free(vpc->pre_comp[1]);
+    OPENSSL_free(vpc);
+}
+
+/*
+ * Drops the tables of a key that is changing.  Verifiers hold their own
+ * references to the tables they use, so they can be released right away.  If
+ * the lock can't be taken the tables stay until the key is freed, the change
+ * of dirty_cnt keeps them from being used.
+ */
+static void ec_key_free_verify_pre_comp(EC_KEY *key)
+{
+    EC_VERIFY_PRE_COMP *vpc;
+
+    if (key->verify_pre_comp == NULL || !CRYPTO_THREAD_write_lock(key->lock))
+        return;
+    vpc = key->verify_pre_comp;
+    key->verify_pre_comp = NULL;
+    CRYPTO_THREAD_unlock(key->lock);
+
+    ec_verify_pre_comp_free(vpc);
+}
+
 #ifndef FIPS_MODULE
 EC_KEY *EC_KEY_new_by_curve_name(int nid)
 {
@@ -95,6 +123,7 @@ void EC_KEY_free(EC_KEY *r)
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_EC_KEY, r, &r->ex_data);
 #endif
     CRYPTO_THREAD_lock_free(r->lock);
+    ec_verify_pre_comp_free(r->verify_pre_comp);
     EC_GROUP_free(r->group);
     EC_POINT_free(r->pub_key);
     BN_clear_free(r->priv_key);
@@ -121,6 +150,7 @@ EC_KEY *EC_KEY_copy(EC_KEY *dest, const EC_KEY *src)
 #endif
     }
     dest->libctx = src->libctx;
+    ec_key_free_verify_pre_comp(dest);
     /* copy the parameters */
     if (src->group != NULL) {
         /* clear the old group */
@@ -772,6 +802,7 @@ int EC_KEY_set_group(EC_KEY *key, const EC_GROUP *group)
 {
     if (key->meth->set_group != NULL && key->meth->set_group(key, group) == 0)
         return 0;
+    ec_key_free_verify_pre_comp(key);
     EC_GROUP_free(key->group);
     key->group = EC_GROUP_dup(group);
     if (key->group != NULL && EC_GROUP_get_curve_name(key->group) == NID_sm2)
@@ -891,12 +922,77 @@ int EC_KEY_set_public_key(EC_KEY *key, const EC_POINT *pub_key)
     if (key->meth->set_public != NULL
         && key->meth->set_public(key, pub_key) == 0)
         return 0;
+    ec_key_free_verify_pre_comp(key);
     EC_POINT_free(key->pub_key);
     key->pub_key = EC_POINT_dup(pub_key, key->group);
     key->dirty_cnt++;
     return (key->pub_key == NULL) ? 0 : 1;
 }
 
+/*
+ * Gets references to the tables with which ossl_ec_wNAF_mul_pre_comp()
+ * computes u1 * generator + u2 * pub_key for signature verification, if |key|
+ * has EC_FLAG_PRECOMPUTE_VERIFY set and its group multiplies with
+ * ossl_ec_wNAF_mul().  They are built on first use and again after any change
+ * to the key.  The caller releases them with EC_ec_pre_comp_free(), tables
+ * that get replaced in the meantime stay valid until then.
+ */
+int ossl_ec_key_get1_verify_pre_comp(EC_KEY *key, BN_CTX *ctx,
+                                     EC_PRE_COMP *pre_comp[2])
+{
+    EC_VERIFY_PRE_COMP *vpc, *cur;
+    const EC_POINT *generator;
+    size_t dirty_cnt;
+    int found = 0;
+
+    if ((key->flags & EC_FLAG_PRECOMPUTE_VERIFY) == 0 || key->group == NULL
+        || key->pub_key == NULL || key->group->meth->mul != NULL
+        || (generator = EC_GROUP_get0_generator(key->group)) == NULL)
+        return 0;
+
+    if (!CRYPTO_THREAD_read_lock(key->lock))
+        return 0;
+    dirty_cnt = key->dirty_cnt;
+    cur = key->verify_pre_comp;
+    if (cur != NULL && cur->dirty_cnt == dirty_cnt) {
+        pre_comp[0] = EC_ec_pre_comp_dup(cur->pre_comp[0]);
+        pre_comp[1] = EC_ec_pre_comp_dup(cur->pre_comp[1]);
+        found = 1;
+    }
+    CRYPTO_THREAD_unlock(key->lock);
+    if (found)
+        return 1;
+
+    if ((vpc = OPENSSL_zalloc(sizeof(*vpc))) == NULL)
+        return 0;
+    vpc->dirty_cnt = dirty_cnt;
+    ERR_set_mark();
+    vpc->pre_comp[0] = ossl_ec_wNAF_precompute_point(key->group, generator,
+                                                     ctx);
+    vpc->pre_comp[1] = ossl_ec_wNAF_precompute_point(key->group, key->pub_key,
+                                                     ctx);
+    /* Verification can always do without */
+    ERR_pop_to_mark();
+    if (vpc->pre_comp[0] == NULL || vpc->pre_comp[1] == NULL
+        || !CRYPTO_THREAD_write_lock(key->lock)) {
+        ec_verify_pre_comp_free(vpc);
+        return 0;
+    }
+    /* Keep the tables of another verifier that got here first */
+    cur = key->verify_pre_comp;
+    if (cur == NULL || cur->dirty_cnt != vpc->dirty_cnt) {
+        key->verify_pre_comp = vpc;
+        vpc = cur;
+    }
+    pre_comp[0] = EC_ec_pre_comp_dup(key->verify_pre_comp->pre_comp[0]);
+    pre_comp[1] = EC_ec_pre_comp_dup(key->verify_pre_comp->pre_comp[1]);
+    CRYPTO_THREAD_unlock(key->lock);
+
+    /* Either our own tables or the ones they replaced */
+    ec_verify_pre_comp_free(vpc);
+    return 1;
+}
+
 unsigned int EC_KEY_get_enc_flags(const EC_KEY *key)
 {
     return key->enc_flag;
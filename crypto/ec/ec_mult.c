@@ -1,5 +1,5 @@
 /*
- * Copyright 2001-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2001-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2002, Oracle and/or its affiliates. All rights reserved
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -801,9 +801,10 @@ int ossl_ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
 }
 
 /*-
- * ossl_ec_wNAF_precompute_mult()
- * creates an EC_PRE_COMP object with preprecomputed multiples of the generator
- * for use with wNAF splitting as implemented in ossl_ec_wNAF_mul().
+ * ec_pre_comp_build()
+ * creates an EC_PRE_COMP object with preprecomputed multiples of 'generator'
+ * for use with wNAF splitting as implemented in ossl_ec_wNAF_mul() and
+ * ossl_ec_wNAF_mul_pre_comp().
  *
  * 'pre_comp->points' is an array of multiples of the generator
  * of the following form:
@@ -820,30 +821,21 @@ int ossl_ec_wNAF_mul(const EC_GROUP *group, EC_POINT *r, const BIGNUM *scalar,
  * points[2^(w-1)*numblocks-1]     = (2^(w-1)) *  2^(blocksize*(numblocks-1)) * generator
  * points[2^(w-1)*numblocks]       = NULL
  */
-int ossl_ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *ctx)
+static EC_PRE_COMP *ec_pre_comp_build(const EC_GROUP *group,
+                                      const EC_POINT *generator, BN_CTX *ctx)
 {
-    const EC_POINT *generator;
     EC_POINT *tmp_point = NULL, *base = NULL, **var;
     const BIGNUM *order;
     size_t i, bits, w, pre_points_per_block, blocksize, numblocks, num;
     EC_POINT **points = NULL;
-    EC_PRE_COMP *pre_comp;
-    int ret = 0;
+    EC_PRE_COMP *pre_comp, *ret = NULL;
     int used_ctx = 0;
 #ifndef FIPS_MODULE
     BN_CTX *new_ctx = NULL;
 #endif
 
-    /* if there is an old EC_PRE_COMP object, throw it away */
-    EC_pre_comp_free(group);
     if ((pre_comp = ec_pre_comp_new(group)) == NULL)
-        return 0;
-
-    generator = EC_GROUP_get0_generator(group);
-    if (generator == NULL) {
-        ERR_raise(ERR_LIB_EC, EC_R_UNDEFINED_GENERATOR);
-        goto err;
-    }
+        return NULL;
 
 #ifndef FIPS_MODULE
     if (ctx == NULL)
@@ -956,9 +948,8 @@ int ossl_ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *ctx)
     pre_comp->points = points;
     points = NULL;
     pre_comp->num = num;
-    SETPRECOMP(group, ec, pre_comp);
+    ret = pre_comp;
     pre_comp = NULL;
-    ret = 1;
 
  err:
     if (used_ctx)
@@ -979,6 +970,179 @@ int ossl_ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *ctx)
     return ret;
 }
 
+int ossl_ec_wNAF_precompute_mult(EC_GROUP *group, BN_CTX *ctx)
+{
+    const EC_POINT *generator;
+    EC_PRE_COMP *pre_comp;
+
+    /* if there is an old EC_PRE_COMP object, throw it away */
+    EC_pre_comp_free(group);
+
+    generator = EC_GROUP_get0_generator(group);
+    if (generator == NULL) {
+        ERR_raise(ERR_LIB_EC, EC_R_UNDEFINED_GENERATOR);
+        return 0;
+    }
+
+    if ((pre_comp = ec_pre_comp_build(group, generator, ctx)) == NULL)
+        return 0;
+    SETPRECOMP(group, ec, pre_comp);
+    return 1;
+}
+
+/*-
+ * ossl_ec_wNAF_precompute_point()
+ * returns the multiples of an arbitrary 'point' that ossl_ec_wNAF_mul_pre_comp()
+ * needs, i.e. those ossl_ec_wNAF_precompute_mult() computes for the generator.
+ * These are shared with the group if 'point' is its generator and the group
+ * already has them.
+ */
+EC_PRE_COMP *ossl_ec_wNAF_precompute_point(const EC_GROUP *group,
+                                           const EC_POINT *point, BN_CTX *ctx)
+{
+    EC_PRE_COMP *pre_comp = group->pre_comp_type == PCT_ec
+                            ? group->pre_comp.ec : NULL;
+
+    if (pre_comp != NULL && pre_comp->numblocks
+        && EC_POINT_cmp(group, point, pre_comp->points[0], ctx) == 0)
+        return EC_ec_pre_comp_dup(pre_comp);
+    return ec_pre_comp_build(group, point, ctx);
+}
+
+/*-
+ * Compute
+ *      \sum scalars[i]*P[i]
+ * where the multiples of the points P[i] come from pre_comp[i], as returned
+ * by ossl_ec_wNAF_precompute_point(). Every scalar is handled the way
+ * ossl_ec_wNAF_mul() handles the generator's scalar, so the sum costs about
+ * blocksize doublings instead of one per bit.  Like ossl_ec_wNAF_mul() this
+ * takes time depending on the scalars, which must be public.
+ */
+int ossl_ec_wNAF_mul_pre_comp(const EC_GROUP *group, EC_POINT *r, size_t num,
+                              EC_PRE_COMP *const pre_comp[],
+                              const BIGNUM *scalars[], BN_CTX *ctx)
+{
+    size_t totalnum = 0, max_len = 0;
+    size_t i, j;
+    int k;
+    int r_is_inverted = 0;
+    int r_is_at_infinity = 1;
+    signed char **wNAF = NULL;  /* individual wNAFs */
+    const signed char **block = NULL; /* blocks of the wNAFs */
+    size_t *block_len = NULL;
+    EC_POINT ***block_points = NULL; /* subarrays of 'pre_comp[i]->points' */
+    int ret = 0;
+
+    for (i = 0; i < num; i++) {
+        /* check that pre_comp looks sane */
+        if (pre_comp[i]->numblocks == 0
+            || pre_comp[i]->num != pre_comp[i]->numblocks
+                                   * ((size_t)1 << (pre_comp[i]->w - 1))) {
+            ERR_raise(ERR_LIB_EC, ERR_R_INTERNAL_ERROR);
+            return 0;
+        }
+        totalnum += pre_comp[i]->numblocks;
+    }
+
+    wNAF = OPENSSL_zalloc((num + 1) * sizeof(wNAF[0]));
+    block = OPENSSL_malloc(totalnum * sizeof(block[0]));
+    block_len = OPENSSL_malloc(totalnum * sizeof(block_len[0]));
+    block_points = OPENSSL_malloc(totalnum * sizeof(block_points[0]));
+    if (wNAF == NULL || block == NULL || block_len == NULL
+        || block_points == NULL)
+        goto err;
+
+    /* split the wNAFs in blocks, the last one gets whatever is left */
+    totalnum = 0;
+    for (i = 0; i < num; i++) {
+        size_t blocksize = pre_comp[i]->blocksize;
+        size_t len, numblocks;
+
+        wNAF[i] = bn_compute_wNAF(scalars[i], pre_comp[i]->w, &len);
+        if (wNAF[i] == NULL)
+            goto err;
+
+        numblocks = (len + blocksize - 1) / blocksize;
+        if (numblocks > pre_comp[i]->numblocks)
+            numblocks = pre_comp[i]->numblocks;
+
+        for (j = 0; j < numblocks; j++, totalnum++) {
+            block[totalnum] = wNAF[i] + j * blocksize;
+            block_len[totalnum] = j < numblocks - 1 ? blocksize
+                                                    : len - j * blocksize;
+            block_points[totalnum] = pre_comp[i]->points
+                                     + (j << (pre_comp[i]->w - 1));
+            if (block_len[totalnum] > max_len)
+                max_len = block_len[totalnum];
+        }
+    }
+
+    for (k = max_len - 1; k >= 0; k--) {
+        if (!r_is_at_infinity) {
+            if (!EC_POINT_dbl(group, r, r, ctx))
+                goto err;
+        }
+
+        for (i = 0; i < totalnum; i++) {
+            int digit, is_neg;
+
+            if (block_len[i] <= (size_t)k || (digit = block[i][k]) == 0)
+                continue;
+
+            is_neg = digit < 0;
+            if (is_neg)
+                digit = -digit;
+
+            if (is_neg != r_is_inverted) {
+                if (!r_is_at_infinity) {
+                    if (!EC_POINT_invert(group, r, ctx))
+                        goto err;
+                }
+                r_is_inverted = !r_is_inverted;
+            }
+
+            if (r_is_at_infinity) {
+                if (!EC_POINT_copy(r, block_points[i][digit >> 1]))
+                    goto err;
+                if (!ossl_ec_point_blind_coordinates(group, r, ctx)) {
+                    ERR_raise(ERR_LIB_EC, EC_R_POINT_COORDINATES_BLIND_FAILURE);
+                    goto err;
+                }
+                r_is_at_infinity = 0;
+            } else {
+                if (!EC_POINT_add(group, r, r, block_points[i][digit >> 1],
+                                  ctx))
+                    goto err;
+            }
+        }
+    }
+
+    if (r_is_at_infinity) {
+        if (!EC_POINT_set_to_infinity(group, r))
+            goto err;
+    } else {
+        if (r_is_inverted)
+            if (!EC_POINT_invert(group, r, ctx))
+                goto err;
+    }
+
+    ret = 1;
+
+ err:
+    if (wNAF != NULL) {
+        signed char **w;
+
+        for (w = wNAF; *w != NULL; w++)
+            OPENSSL_free(*w);
+
+        OPENSSL_free(wNAF);
+    }
+    OPENSSL_free(block);
+    OPENSSL_free(block_len);
+    OPENSSL_free(block_points);
+    return ret;
+}
+
 int ossl_ec_wNAF_have_precompute_mult(const EC_GROUP *group)
 {
     return HAVEPRECOMP(group, ec);
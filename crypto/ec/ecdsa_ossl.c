@@ -1,5 +1,5 @@
 /*
- * Copyright 2002-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2002-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -429,6 +429,7 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
     EC_POINT *point = NULL;
     const EC_GROUP *group;
     const EC_POINT *pub_key;
+    EC_PRE_COMP *pre_comp[2] = { NULL, NULL };
 
     /* check input values */
     if (eckey == NULL || (group = EC_KEY_get0_group(eckey)) == NULL ||
@@ -506,7 +507,17 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
         ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
         goto err;
     }
-    if (!EC_POINT_mul(group, point, u1, pub_key, u2, ctx)) {
+    if (ossl_ec_key_get1_verify_pre_comp(eckey, ctx, pre_comp)) {
+        const BIGNUM *scalars[2];
+
+        scalars[0] = u1;
+        scalars[1] = u2;
+        if (!ossl_ec_wNAF_mul_pre_comp(group, point, 2, pre_comp, scalars,
+                                       ctx)) {
+            ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
+            goto err;
+        }
+    } else if (!EC_POINT_mul(group, point, u1, pub_key, u2, ctx)) {
         ERR_raise(ERR_LIB_EC, ERR_R_EC_LIB);
         goto err;
     }
@@ -526,5 +537,7 @@ int ossl_ecdsa_simple_verify_sig(const unsigned char *dgst, int dgst_len,
     BN_CTX_end(ctx);
     BN_CTX_free(ctx);
     EC_POINT_free(point);
+    EC_ec_pre_comp_free(pre_comp[0]);
+    EC_ec_pre_comp_free(pre_comp[1]);
     return ret;
 }
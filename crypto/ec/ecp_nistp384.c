@@ -0,0 +1,1304 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * ECDSA low level APIs are deprecated for public use, but still ok for
+ * internal use.
+ */
+#include "internal/deprecated.h"
+
+/*
+ * A 64-bit implementation of the NIST P-384 elliptic curve point
+ * multiplication.
+ *
+ * The OpenSSL integration and the variable base point multiplication follow
+ * ecp_nistp256.c. Field arithmetic is done in the Montgomery domain with six
+ * 64-bit limbs. Multiples of the standard generator are computed with a
+ * fixed-base comb over a precomputed table (see ecp_nistp384_table.c), which
+ * needs no point doublings at all.
+ */
+
+#include <openssl/opensslconf.h>
+
+#include <stdint.h>
+#include <string.h>
+#include <openssl/err.h>
+#include "ec_local.h"
+
+#include "internal/numbers.h"
+
+#ifndef INT128_MAX
+# error "Your compiler doesn't appear to support 128-bit integer types"
+#endif
+
+typedef uint8_t u8;
+typedef uint64_t u64;
+
+/*
+ * The underlying field. P384 operates over GF(2^384-2^128-2^96+2^32-1). We
+ * can serialize an element of this field into 48 bytes. We call this an
+ * felem_bytearray.
+ */
+
+typedef u8 felem_bytearray[48];
+
+/*
+ * These are the parameters of P384, taken from FIPS 186-4, section D.1.2.4.
+ * These values are big-endian.
+ */
+static const felem_bytearray nistp384_curve_params[5] = {
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* p */
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+     0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, /* a = -3 */
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+     0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc},
+    {0xb3, 0x31, 0x2f, 0xa7, 0xe2, 0x3e, 0xe7, 0xe4, /* b */
+     0x98, 0x8e, 0x05, 0x6b, 0xe3, 0xf8, 0x2d, 0x19,
+     0x18, 0x1d, 0x9c, 0x6e, 0xfe, 0x81, 0x41, 0x12,
+     0x03, 0x14, 0x08, 0x8f, 0x50, 0x13, 0x87, 0x5a,
+     0xc6, 0x56, 0x39, 0x8d, 0x8a, 0x2e, 0xd1, 0x9d,
+     0x2a, 0x85, 0xc8, 0xed, 0xd3, 0xec, 0x2a, 0xef},
+    {0xaa, 0x87, 0xca, 0x22, 0xbe, 0x8b, 0x05, 0x37, /* x */
+     0x8e, 0xb1, 0xc7, 0x1e, 0xf3, 0x20, 0xad, 0x74,
+     0x6e, 0x1d, 0x3b, 0x62, 0x8b, 0xa7, 0x9b, 0x98,
+     0x59, 0xf7, 0x41, 0xe0, 0x82, 0x54, 0x2a, 0x38,
+     0x55, 0x02, 0xf2, 0x5d, 0xbf, 0x55, 0x29, 0x6c,
+     0x3a, 0x54, 0x5e, 0x38, 0x72, 0x76, 0x0a, 0xb7},
+    {0x36, 0x17, 0xde, 0x4a, 0x96, 0x26, 0x2c, 0x6f, /* y */
+     0x5d, 0x9e, 0x98, 0xbf, 0x92, 0x92, 0xdc, 0x29,
+     0xf8, 0xf4, 0x1d, 0xbd, 0x28, 0x9a, 0x14, 0x7c,
+     0xe9, 0xda, 0x31, 0x13, 0xb5, 0xf0, 0xb8, 0xc0,
+     0x0a, 0x60, 0xb1, 0xce, 0x1d, 0x7e, 0x81, 0x9d,
+     0x7a, 0x43, 0x1d, 0x7c, 0x90, 0xea, 0x0e, 0x5f}
+};
+
+/*-
+ * The representation of field elements.
+ * ------------------------------------
+ *
+ * A field element is six 64-bit limbs, little-endian, holding the value in
+ * Montgomery form: the element a is stored as a * 2^384 mod p. Every
+ * operation below returns a fully reduced result, i.e. a value in [0, p),
+ * so every element has a unique representation and comparisons with zero
+ * need no further reduction.
+ */
+
+#define NLIMBS 6
+
+typedef u64 felem[NLIMBS];
+
+/* This is the value of the prime as six 64-bit words, little-endian. */
+static const felem kPrime = {
+    0x00000000ffffffffULL, 0xffffffff00000000ULL, 0xfffffffffffffffeULL,
+    0xffffffffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL
+};
+
+/* -p^-1 mod 2^64 */
+#define NISTP384_N0 0x0000000100000001ULL
+
+/* 1 in Montgomery form, i.e. 2^384 mod p */
+static const felem kOne = {
+    0xffffffff00000001ULL, 0x00000000ffffffffULL, 0x0000000000000001ULL,
+    0, 0, 0
+};
+
+/* 2^768 mod p, used to convert into Montgomery form */
+static const felem kRR = {
+    0xfffffffe00000001ULL, 0x0000000200000000ULL, 0xfffffffe00000000ULL,
+    0x0000000200000000ULL, 0x0000000000000001ULL, 0
+};
+
+/* 1 in the normal representation, used to convert out of Montgomery form */
+static const felem kPlainOne = { 1, 0, 0, 0, 0, 0 };
+
+/*
+ * The generator table in ecp_nistp384_table.c: gmul[i][j] is the affine
+ * point (j + 1) * 2^(5 * i) * G, with both coordinates in Montgomery form.
+ */
+#define NISTP384_GTABLE_WINDOWS 77
+
+extern const u64 ossl_ec_nistp384_gmul[NISTP384_GTABLE_WINDOWS][16][2][NLIMBS];
+
+/*-
+ * Field operations
+ * ----------------
+ */
+
+static void felem_assign(felem out, const felem in)
+{
+    memcpy(out, in, sizeof(felem));
+}
+
+/*
+ * felem_reduce_once sets out = in - p if the 385-bit value (top, in) is at
+ * least p and out = in otherwise, in constant time. The input must be less
+ * than 2p.
+ */
+static void felem_reduce_once(felem out, const u64 in[NLIMBS], u64 top)
+{
+    felem tmp;
+    u64 borrow = 0, mask;
+    uint128_t d;
+    int i;
+
+    for (i = 0; i < NLIMBS; i++) {
+        d = (uint128_t)in[i] - kPrime[i] - borrow;
+        tmp[i] = (u64)d;
+        borrow = (u64)(d >> 64) & 1;
+    }
+    /* mask is all ones iff (top, in) < p, i.e. iff top - borrow wraps */
+    mask = 0 - ((top - borrow) >> 63);
+    for (i = 0; i < NLIMBS; i++)
+        out[i] = (in[i] & mask) | (tmp[i] & ~mask);
+}
+
+/* felem_add sets out = in1 + in2 */
+static void felem_add(felem out, const felem in1, const felem in2)
+{
+    felem tmp;
+    u64 carry = 0;
+    uint128_t s;
+    int i;
+
+    for (i = 0; i < NLIMBS; i++) {
+        s = (uint128_t)in1[i] + in2[i] + carry;
+        tmp[i] = (u64)s;
+        carry = (u64)(s >> 64);
+    }
+    felem_reduce_once(out, tmp, carry);
+}
+
+/* felem_sub sets out = in1 - in2 */
+static void felem_sub(felem out, const felem in1, const felem in2)
+{
+    felem tmp;
+    u64 borrow = 0, carry = 0, mask;
+    uint128_t d;
+    int i;
+
+    for (i = 0; i < NLIMBS; i++) {
+        d = (uint128_t)in1[i] - in2[i] - borrow;
+        tmp[i] = (u64)d;
+        borrow = (u64)(d >> 64) & 1;
+    }
+    /* add p back if the subtraction wrapped */
+    mask = 0 - borrow;
+    for (i = 0; i < NLIMBS; i++) {
+        d = (uint128_t)tmp[i] + (kPrime[i] & mask) + carry;
+        out[i] = (u64)d;
+        carry = (u64)(d >> 64);
+    }
+}
+
+/* felem_neg sets out = -in */
+static void felem_neg(felem out, const felem in)
+{
+    static const felem zero = { 0 };
+
+    felem_sub(out, zero, in);
+}
+
+/* felem_scalar sets out = in * scalar for small scalars */
+static void felem_scalar(felem out, const felem in, unsigned int scalar)
+{
+    felem tmp;
+
+    felem_assign(tmp, in);
+    felem_assign(out, in);
+    while (--scalar > 0)
+        felem_add(out, out, tmp);
+}
+
+/*-
+ * felem_mul sets out = in1 * in2 * 2^-384 mod p.
+ *
+ * This is word-by-word Montgomery multiplication (CIOS). After each outer
+ * iteration the intermediate value is less than 2p, so a single conditional
+ * subtraction at the end yields a fully reduced result.
+ */
+static void felem_mul(felem out, const felem in1, const felem in2)
+{
+    u64 t[NLIMBS + 2];
+    u64 carry, m;
+    uint128_t acc;
+    int i, j;
+
+    memset(t, 0, sizeof(t));
+    for (i = 0; i < NLIMBS; i++) {
+        carry = 0;
+        for (j = 0; j < NLIMBS; j++) {
+            acc = (uint128_t)in1[j] * in2[i] + t[j] + carry;
+            t[j] = (u64)acc;
+            carry = (u64)(acc >> 64);
+        }
+        acc = (uint128_t)t[NLIMBS] + carry;
+        t[NLIMBS] = (u64)acc;
+        t[NLIMBS + 1] = (u64)(acc >> 64);
+
+        m = t[0] * NISTP384_N0;
+        acc = (uint128_t)m * kPrime[0] + t[0];
+        carry = (u64)(acc >> 64);
+        for (j = 1; j < NLIMBS; j++) {
+            acc = (uint128_t)m * kPrime[j] + t[j] + carry;
+            t[j - 1] = (u64)acc;
+            carry = (u64)(acc >> 64);
+        }
+        acc = (uint128_t)t[NLIMBS] + carry;
+        t[NLIMBS - 1] = (u64)acc;
+        t[NLIMBS] = t[NLIMBS + 1] + (u64)(acc >> 64);
+    }
+    felem_reduce_once(out, t, t[NLIMBS]);
+}
+
+/* felem_square sets out = in^2 * 2^-384 mod p */
+static void felem_square(felem out, const felem in)
+{
+    felem_mul(out, in, in);
+}
+
+/* felem_square_n sets out = in^(2^n) in the Montgomery domain */
+static void felem_square_n(felem out, const felem in, unsigned int n)
+{
+    felem_assign(out, in);
+    while (n-- > 0)
+        felem_square(out, out);
+}
+
+/*-
+ * felem_inv calculates |out| = |in|^{-1}
+ *
+ * Based on Fermat's Little Theorem:
+ *   a^p = a (mod p)
+ *   a^{p-1} = 1 (mod p)
+ *   a^{p-2} = a^{-1} (mod p)
+ *
+ * p - 2 is, from the most significant bit down, 255 ones, a zero, 32 ones,
+ * 64 zeros, 30 ones, a zero and a one. The addition chain below builds
+ * a^(2^k - 1) for the runs of ones first. x_k denotes a^(2^k - 1).
+ */
+static void felem_inv(felem out, const felem in)
+{
+    felem x2, x3, x6, x12, x15, x30, x32, x60, x120, t;
+
+    felem_square(x2, in);
+    felem_mul(x2, x2, in);
+    felem_square(x3, x2);
+    felem_mul(x3, x3, in);
+    felem_square_n(x6, x3, 3);
+    felem_mul(x6, x6, x3);
+    felem_square_n(x12, x6, 6);
+    felem_mul(x12, x12, x6);
+    felem_square_n(x15, x12, 3);
+    felem_mul(x15, x15, x3);
+    felem_square_n(x30, x15, 15);
+    felem_mul(x30, x30, x15);
+    felem_square_n(x32, x30, 2);
+    felem_mul(x32, x32, x2);
+    felem_square_n(x60, x30, 30);
+    felem_mul(x60, x60, x30);
+    felem_square_n(x120, x60, 60);
+    felem_mul(x120, x120, x60);
+    /* t = x240 */
+    felem_square_n(t, x120, 120);
+    felem_mul(t, t, x120);
+    /* t = x255 */
+    felem_square_n(t, t, 15);
+    felem_mul(t, t, x15);
+    /* a zero bit followed by 32 ones */
+    felem_square_n(t, t, 33);
+    felem_mul(t, t, x32);
+    /* 64 zero bits followed by 30 ones */
+    felem_square_n(t, t, 94);
+    felem_mul(t, t, x30);
+    /* a zero bit and a one bit */
+    felem_square_n(t, t, 2);
+    felem_mul(out, t, in);
+}
+
+/* felem_is_zero returns a limb with all bits set if |in| == 0 */
+static u64 felem_is_zero(const felem in)
+{
+    u64 acc = 0;
+    int i;
+
+    for (i = 0; i < NLIMBS; i++)
+        acc |= in[i];
+    /* acc is zero iff in is zero; turn that into an all ones mask */
+    return 0 - (((acc | (0 - acc)) >> 63) ^ 1);
+}
+
+static int felem_is_zero_int(const void *in)
+{
+    return (int)(felem_is_zero(in) & 1);
+}
+
+static void felem_one(felem out)
+{
+    felem_assign(out, kOne);
+}
+
+/* copy_conditional copies in to out iff mask is all ones. */
+static void copy_conditional(felem out, const felem in, u64 mask)
+{
+    int i;
+
+    for (i = 0; i < NLIMBS; i++)
+        out[i] ^= mask & (in[i] ^ out[i]);
+}
+
+/*
+ * BN_to_felem converts an OpenSSL BIGNUM into an felem in Montgomery form.
+ * The BIGNUM must be non-negative and less than 2^384.
+ */
+static int BN_to_felem(felem out, const BIGNUM *bn)
+{
+    felem_bytearray b_out;
+    felem tmp;
+    int i;
+
+    if (BN_is_negative(bn)) {
+        ERR_raise(ERR_LIB_EC, EC_R_BIGNUM_OUT_OF_RANGE);
+        return 0;
+    }
+    if (BN_bn2lebinpad(bn, b_out, sizeof(b_out)) < 0) {
+        ERR_raise(ERR_LIB_EC, EC_R_BIGNUM_OUT_OF_RANGE);
+        return 0;
+    }
+    for (i = 0; i < NLIMBS; i++) {
+        int j;
+
+        tmp[i] = 0;
+        for (j = 7; j >= 0; j--)
+            tmp[i] = (tmp[i] << 8) | b_out[8 * i + j];
+    }
+    felem_mul(out, tmp, kRR);
+    return 1;
+}
+
+/* felem_to_BN converts an felem in Montgomery form into an OpenSSL BIGNUM */
+static BIGNUM *felem_to_BN(BIGNUM *out, const felem in)
+{
+    felem_bytearray b_out;
+    felem tmp;
+    int i, j;
+
+    felem_mul(tmp, in, kPlainOne);
+    for (i = 0; i < NLIMBS; i++)
+        for (j = 0; j < 8; j++)
+            b_out[8 * i + j] = (u8)(tmp[i] >> (8 * j));
+    return BN_lebin2bn(b_out, sizeof(b_out), out);
+}
+
+/*-
+ * Group operations
+ * ----------------
+ *
+ * Building on top of the field operations we have the operations on the
+ * elliptic curve group itself. Points on the curve are represented in Jacobian
+ * coordinates
+ */
+
+/*-
+ * point_double calculates 2*(x_in, y_in, z_in)
+ *
+ * The method is taken from:
+ *   http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#doubling-dbl-2001-b
+ *
+ * Outputs can equal corresponding inputs, i.e., x_out == x_in is allowed.
+ */
+static void
+point_double(felem x_out, felem y_out, felem z_out,
+             const felem x_in, const felem y_in, const felem z_in)
+{
+    felem delta, gamma, beta, alpha, ftmp, ftmp2;
+
+    /* delta = z^2 */
+    felem_square(delta, z_in);
+    /* gamma = y^2 */
+    felem_square(gamma, y_in);
+    /* beta = x*gamma */
+    felem_mul(beta, x_in, gamma);
+
+    /* alpha = 3*(x-delta)*(x+delta) */
+    felem_sub(ftmp, x_in, delta);
+    felem_add(ftmp2, x_in, delta);
+    felem_mul(alpha, ftmp, ftmp2);
+    felem_scalar(alpha, alpha, 3);
+
+    /* z' = (y + z)^2 - gamma - delta */
+    felem_add(ftmp, y_in, z_in);
+    felem_square(z_out, ftmp);
+    felem_sub(z_out, z_out, gamma);
+    felem_sub(z_out, z_out, delta);
+
+    /* x' = alpha^2 - 8*beta */
+    felem_scalar(ftmp, beta, 4);
+    felem_add(ftmp2, ftmp, ftmp);
+    felem_square(x_out, alpha);
+    felem_sub(x_out, x_out, ftmp2);
+
+    /* y' = alpha*(4*beta - x') - 8*gamma^2 */
+    felem_sub(ftmp, ftmp, x_out);
+    felem_mul(ftmp, alpha, ftmp);
+    felem_square(gamma, gamma);
+    felem_scalar(gamma, gamma, 8);
+    felem_sub(y_out, ftmp, gamma);
+}
+
+/*-
+ * point_add calculates (x1, y1, z1) + (x2, y2, z2)
+ *
+ * The method is taken from:
+ *   http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-add-2007-bl,
+ * adapted for mixed addition (z2 = 1, or z2 = 0 for the point at infinity).
+ *
+ * This function includes a branch for checking whether the two input points
+ * are equal, (while not equal to the point at infinity). This case never
+ * happens during single point multiplication, so there is no timing leak for
+ * ECDH or ECDSA signing.
+ */
+static void point_add(felem x3, felem y3, felem z3,
+                      const felem x1, const felem y1, const felem z1,
+                      const int mixed, const felem x2, const felem y2,
+                      const felem z2)
+{
+    felem z1z1, z2z2, u1, u2, s1, s2, h, i, j, r, v, ftmp;
+    felem x_out, y_out, z_out;
+    u64 z1_is_zero, z2_is_zero, x_equal, y_equal;
+
+    z1_is_zero = felem_is_zero(z1);
+    z2_is_zero = felem_is_zero(z2);
+
+    /* z1z1 = z1**2 */
+    felem_square(z1z1, z1);
+
+    if (!mixed) {
+        /* z2z2 = z2**2 */
+        felem_square(z2z2, z2);
+        /* u1 = x1*z2z2 */
+        felem_mul(u1, x1, z2z2);
+        /* s1 = y1 * z2**3 */
+        felem_mul(s1, z2, z2z2);
+        felem_mul(s1, y1, s1);
+        /* ftmp = z1 * z2 */
+        felem_mul(ftmp, z1, z2);
+    } else {
+        /*
+         * We'll assume z2 = 1 (special case z2 = 0 is handled later)
+         */
+        felem_assign(u1, x1);
+        felem_assign(s1, y1);
+        felem_assign(ftmp, z1);
+    }
+
+    /* u2 = x2*z1z1 */
+    felem_mul(u2, x2, z1z1);
+    /* s2 = y2 * z1**3 */
+    felem_mul(s2, z1, z1z1);
+    felem_mul(s2, y2, s2);
+
+    /* h = u2 - u1 */
+    felem_sub(h, u2, u1);
+    x_equal = felem_is_zero(h);
+    /* r = 2 * (s2 - s1) */
+    felem_sub(r, s2, s1);
+    y_equal = felem_is_zero(r);
+    felem_add(r, r, r);
+
+    if (x_equal && y_equal && !z1_is_zero && !z2_is_zero) {
+        /*
+         * This is obviously not constant-time but, as mentioned before, this
+         * case never happens during single point multiplication, so there is
+         * no timing leak for ECDH or ECDSA signing.
+         */
+        point_double(x3, y3, z3, x1, y1, z1);
+        return;
+    }
+
+    /* z_out = 2 * z1 * z2 * h */
+    felem_mul(z_out, ftmp, h);
+    felem_add(z_out, z_out, z_out);
+
+    /* i = (2h)**2, j = h * i */
+    felem_add(i, h, h);
+    felem_square(i, i);
+    felem_mul(j, h, i);
+
+    /* v = u1 * i */
+    felem_mul(v, u1, i);
+
+    /* x_out = r**2 - j - 2v */
+    felem_square(x_out, r);
+    felem_sub(x_out, x_out, j);
+    felem_sub(x_out, x_out, v);
+    felem_sub(x_out, x_out, v);
+
+    /* y_out = r * (v - x_out) - 2 * s1 * j */
+    felem_sub(ftmp, v, x_out);
+    felem_mul(y_out, r, ftmp);
+    felem_mul(ftmp, s1, j);
+    felem_add(ftmp, ftmp, ftmp);
+    felem_sub(y_out, y_out, ftmp);
+
+    copy_conditional(x_out, x2, z1_is_zero);
+    copy_conditional(x_out, x1, z2_is_zero);
+    copy_conditional(y_out, y2, z1_is_zero);
+    copy_conditional(y_out, y1, z2_is_zero);
+    copy_conditional(z_out, z2, z1_is_zero);
+    copy_conditional(z_out, z1, z2_is_zero);
+    felem_assign(x3, x_out);
+    felem_assign(y3, y_out);
+    felem_assign(z3, z_out);
+}
+
+/*-
+ * Base point pre computation
+ * --------------------------
+ *
+ * Two different sorts of precomputed tables are used in the following code.
+ *
+ * For the base point there is a table of 77 rows, gmul[i][j] holding the
+ * affine point (j + 1) * 2^(5i) * G. The scalar is split into 77 signed
+ * digits d_i in [-16, 16], k = \sum d_i * 2^(5i), so that k * G is the sum
+ * of one (possibly negated) table entry per row and no doublings are needed.
+ *
+ * Tables for other points have table[i] = iG for i in 0 .. 16, in Jacobian
+ * coordinates.
+ */
+
+/*
+ * select_point selects the |idx|th point from a precomputation table and
+ * copies it to out.
+ */
+static void select_point(const u64 idx, unsigned int size,
+                         const felem pre_comp[17][3], felem out[3])
+{
+    unsigned i, j;
+    u64 *outlimbs = &out[0][0];
+
+    memset(out, 0, sizeof(*out) * 3);
+
+    for (i = 0; i < size; i++) {
+        const u64 *inlimbs = &pre_comp[i][0][0];
+        u64 mask = i ^ idx;
+
+        mask |= mask >> 4;
+        mask |= mask >> 2;
+        mask |= mask >> 1;
+        mask &= 1;
+        mask--;
+        for (j = 0; j < NLIMBS * 3; j++)
+            outlimbs[j] |= inlimbs[j] & mask;
+    }
+}
+
+/*
+ * select_gen_point selects the affine point |idx| * 2^(5 * row) * G from a
+ * row of the generator table, in constant time. For |idx| == 0 the point at
+ * infinity is returned (z == 0).
+ */
+static void select_gen_point(const u64 idx, const felem row[16][2],
+                             felem out[3])
+{
+    unsigned i, j;
+    u64 *outlimbs = &out[0][0];
+    u64 nonzero = 0 - ((idx | (0 - idx)) >> 63);
+
+    memset(out, 0, sizeof(*out) * 3);
+
+    for (i = 0; i < 16; i++) {
+        const u64 *inlimbs = &row[i][0][0];
+        u64 mask = (i + 1) ^ idx;
+
+        mask |= mask >> 4;
+        mask |= mask >> 2;
+        mask |= mask >> 1;
+        mask &= 1;
+        mask--;
+        for (j = 0; j < NLIMBS * 2; j++)
+            outlimbs[j] |= inlimbs[j] & mask;
+    }
+    for (j = 0; j < NLIMBS; j++)
+        out[2][j] = kOne[j] & nonzero;
+}
+
+/* get_bit returns the |i|th bit in |in| */
+static char get_bit(const felem_bytearray in, int i)
+{
+    if ((i < 0) || (i >= 384))
+        return 0;
+    return (in[i >> 3] >> (i & 7)) & 1;
+}
+
+/* get_window returns the six bits of |in| at positions |i| - 1 .. |i| + 4 */
+static u64 get_window(const felem_bytearray in, int i)
+{
+    u64 bits;
+
+    bits = get_bit(in, i + 4) << 5;
+    bits |= get_bit(in, i + 3) << 4;
+    bits |= get_bit(in, i + 2) << 3;
+    bits |= get_bit(in, i + 1) << 2;
+    bits |= get_bit(in, i) << 1;
+    bits |= get_bit(in, i - 1);
+    return bits;
+}
+
+/*
+ * gen_mul computes g_scalar * G using the generator table g_pre_comp. All
+ * additions are mixed, and the table accesses are constant time.
+ */
+static void gen_mul(felem x_out, felem y_out, felem z_out,
+                    const u8 *g_scalar,
+                    const felem g_pre_comp[NISTP384_GTABLE_WINDOWS][16][2])
+{
+    felem nq[3], tmp[3], ftmp;
+    u8 sign, digit;
+    int i;
+
+    /* set nq to the point at infinity */
+    memset(nq, 0, sizeof(nq));
+
+    for (i = 0; i < NISTP384_GTABLE_WINDOWS; i++) {
+        ossl_ec_GFp_nistp_recode_scalar_bits(&sign, &digit,
+                                             get_window(g_scalar, 5 * i));
+        select_gen_point(digit, g_pre_comp[i], tmp);
+        /* (X, -Y, Z) is the negative point */
+        felem_neg(ftmp, tmp[1]);
+        copy_conditional(tmp[1], ftmp, 0 - (u64)sign);
+        point_add(nq[0], nq[1], nq[2], nq[0], nq[1], nq[2],
+                  1, tmp[0], tmp[1], tmp[2]);
+    }
+    felem_assign(x_out, nq[0]);
+    felem_assign(y_out, nq[1]);
+    felem_assign(z_out, nq[2]);
+}
+
+/*
+ * Interleaved point multiplication using precomputed point multiples: The
+ * small point multiples 0*P, 1*P, ..., 16*P are in pre_comp[], the scalars
+ * in scalars[]. If g_scalar is non-NULL, we also add this multiple of the
+ * generator, using the precomputed multiples in g_pre_comp.
+ * Output point (X, Y, Z) is stored in x_out, y_out, z_out
+ */
+static void batch_mul(felem x_out, felem y_out, felem z_out,
+                      const felem_bytearray scalars[],
+                      const unsigned num_points, const u8 *g_scalar,
+                      const int mixed, const felem pre_comp[][17][3],
+                      const felem g_pre_comp[NISTP384_GTABLE_WINDOWS][16][2])
+{
+    int i, skip;
+    unsigned num;
+    felem nq[3], gq[3], tmp[3], ftmp;
+    u8 sign, digit;
+
+    /* set nq to the point at infinity */
+    memset(nq, 0, sizeof(nq));
+
+    /*
+     * Loop over all scalars msb-to-lsb, adding multiples of the other points
+     * every 5th round.
+     */
+    skip = 1;                   /* save two point operations in the first
+                                 * round */
+    for (i = (num_points ? 380 : -1); i >= 0; --i) {
+        /* double */
+        if (!skip)
+            point_double(nq[0], nq[1], nq[2], nq[0], nq[1], nq[2]);
+
+        if (i % 5 != 0)
+            continue;
+
+        /* loop over all scalars */
+        for (num = 0; num < num_points; ++num) {
+            ossl_ec_GFp_nistp_recode_scalar_bits(&sign, &digit,
+                                                 get_window(scalars[num], i));
+
+            /*
+             * select the point to add or subtract, in constant time
+             */
+            select_point(digit, 17, pre_comp[num], tmp);
+            /* (X, -Y, Z) is the negative point */
+            felem_neg(ftmp, tmp[1]);
+            copy_conditional(tmp[1], ftmp, 0 - (u64)sign);
+
+            if (!skip) {
+                point_add(nq[0], nq[1], nq[2],
+                          nq[0], nq[1], nq[2],
+                          mixed, tmp[0], tmp[1], tmp[2]);
+            } else {
+                memcpy(nq, tmp, sizeof(tmp));
+                skip = 0;
+            }
+        }
+    }
+
+    /* add the multiple of the generator, which needs no doublings */
+    if (g_scalar != NULL) {
+        gen_mul(gq[0], gq[1], gq[2], g_scalar, g_pre_comp);
+        point_add(nq[0], nq[1], nq[2], nq[0], nq[1], nq[2],
+                  0, gq[0], gq[1], gq[2]);
+    }
+
+    felem_assign(x_out, nq[0]);
+    felem_assign(y_out, nq[1]);
+    felem_assign(z_out, nq[2]);
+}
+
+/* Precomputation for the group generator. */
+struct nistp384_pre_comp_st {
+    felem g_pre_comp[NISTP384_GTABLE_WINDOWS][16][2];
+    CRYPTO_REF_COUNT references;
+    CRYPTO_RWLOCK *lock;
+};
+
+const EC_METHOD *ossl_ec_GFp_nistp384_method(void)
+{
+    static const EC_METHOD ret = {
+        EC_FLAGS_DEFAULT_OCT,
+        NID_X9_62_prime_field,
+        ossl_ec_GFp_nistp384_group_init,
+        ossl_ec_GFp_simple_group_finish,
+        ossl_ec_GFp_simple_group_clear_finish,
+        ossl_ec_GFp_nist_group_copy,
+        ossl_ec_GFp_nistp384_group_set_curve,
+        ossl_ec_GFp_simple_group_get_curve,
+        ossl_ec_GFp_simple_group_get_degree,
+        ossl_ec_group_simple_order_bits,
+        ossl_ec_GFp_simple_group_check_discriminant,
+        ossl_ec_GFp_simple_point_init,
+        ossl_ec_GFp_simple_point_finish,
+        ossl_ec_GFp_simple_point_clear_finish,
+        ossl_ec_GFp_simple_point_copy,
+        ossl_ec_GFp_simple_point_set_to_infinity,
+        ossl_ec_GFp_simple_point_set_affine_coordinates,
+        ossl_ec_GFp_nistp384_point_get_affine_coordinates,
+        0 /* point_set_compressed_coordinates */ ,
+        0 /* point2oct */ ,
+        0 /* oct2point */ ,
+        ossl_ec_GFp_simple_add,
+        ossl_ec_GFp_simple_dbl,
+        ossl_ec_GFp_simple_invert,
+        ossl_ec_GFp_simple_is_at_infinity,
+        ossl_ec_GFp_simple_is_on_curve,
+        ossl_ec_GFp_simple_cmp,
+        ossl_ec_GFp_simple_make_affine,
+        ossl_ec_GFp_simple_points_make_affine,
+        ossl_ec_GFp_nistp384_points_mul,
+        ossl_ec_GFp_nistp384_precompute_mult,
+        ossl_ec_GFp_nistp384_have_precompute_mult,
+        ossl_ec_GFp_nist_field_mul,
+        ossl_ec_GFp_nist_field_sqr,
+        0 /* field_div */ ,
+        ossl_ec_GFp_simple_field_inv,
+        0 /* field_encode */ ,
+        0 /* field_decode */ ,
+        0,                      /* field_set_to_one */
+        ossl_ec_key_simple_priv2oct,
+        ossl_ec_key_simple_oct2priv,
+        0, /* set private */
+        ossl_ec_key_simple_generate_key,
+        ossl_ec_key_simple_check_key,
+        ossl_ec_key_simple_generate_public_key,
+        0, /* keycopy */
+        0, /* keyfinish */
+        ossl_ecdh_simple_compute_key,
+        ossl_ecdsa_simple_sign_setup,
+        ossl_ecdsa_simple_sign_sig,
+        ossl_ecdsa_simple_verify_sig,
+        0, /* field_inverse_mod_ord */
+        0, /* blind_coordinates */
+        0, /* ladder_pre */
+        0, /* ladder_step */
+        0  /* ladder_post */
+    };
+
+    return &ret;
+}
+
+/******************************************************************************/
+/*
+ * FUNCTIONS TO MANAGE PRECOMPUTATION
+ */
+
+static NISTP384_PRE_COMP *nistp384_pre_comp_new(void)
+{
+    NISTP384_PRE_COMP *ret = OPENSSL_zalloc(sizeof(*ret));
+
+    if (ret == NULL)
+        return ret;
+
+    ret->references = 1;
+
+    ret->lock = CRYPTO_THREAD_lock_new();
+    if (ret->lock == NULL) {
+        ERR_raise(ERR_LIB_EC, ERR_R_CRYPTO_LIB);
+        OPENSSL_free(ret);
+        return NULL;
+    }
+    return ret;
+}
+
+NISTP384_PRE_COMP *ossl_ec_nistp384_pre_comp_dup(NISTP384_PRE_COMP *p)
+{
+    int i;
+
+    if (p != NULL)
+        CRYPTO_UP_REF(&p->references, &i, p->lock);
+    return p;
+}
+
+void ossl_ec_nistp384_pre_comp_free(NISTP384_PRE_COMP *pre)
+{
+    int i;
+
+    if (pre == NULL)
+        return;
+
+    CRYPTO_DOWN_REF(&pre->references, &i, pre->lock);
+    REF_PRINT_COUNT("ossl_ec_nistp384", pre);
+    if (i > 0)
+        return;
+    REF_ASSERT_ISNT(i < 0);
+
+    CRYPTO_THREAD_lock_free(pre->lock);
+    OPENSSL_free(pre);
+}
+
+/******************************************************************************/
+/*
+ * OPENSSL EC_METHOD FUNCTIONS
+ */
+
+int ossl_ec_GFp_nistp384_group_init(EC_GROUP *group)
+{
+    int ret;
+
+    ret = ossl_ec_GFp_simple_group_init(group);
+    group->a_is_minus3 = 1;
+    return ret;
+}
+
+int ossl_ec_GFp_nistp384_group_set_curve(EC_GROUP *group, const BIGNUM *p,
+                                         const BIGNUM *a, const BIGNUM *b,
+                                         BN_CTX *ctx)
+{
+    int ret = 0;
+    BIGNUM *curve_p, *curve_a, *curve_b;
+#ifndef FIPS_MODULE
+    BN_CTX *new_ctx = NULL;
+
+    if (ctx == NULL)
+        ctx = new_ctx = BN_CTX_new();
+#endif
+    if (ctx == NULL)
+        return 0;
+
+    BN_CTX_start(ctx);
+    curve_p = BN_CTX_get(ctx);
+    curve_a = BN_CTX_get(ctx);
+    curve_b = BN_CTX_get(ctx);
+    if (curve_b == NULL)
+        goto err;
+    BN_bin2bn(nistp384_curve_params[0], sizeof(felem_bytearray), curve_p);
+    BN_bin2bn(nistp384_curve_params[1], sizeof(felem_bytearray), curve_a);
+    BN_bin2bn(nistp384_curve_params[2], sizeof(felem_bytearray), curve_b);
+    if ((BN_cmp(curve_p, p)) || (BN_cmp(curve_a, a)) || (BN_cmp(curve_b, b))) {
+        ERR_raise(ERR_LIB_EC, EC_R_WRONG_CURVE_PARAMETERS);
+        goto err;
+    }
+    group->field_mod_func = BN_nist_mod_384;
+    ret = ossl_ec_GFp_simple_group_set_curve(group, p, a, b, ctx);
+ err:
+    BN_CTX_end(ctx);
+#ifndef FIPS_MODULE
+    BN_CTX_free(new_ctx);
+#endif
+    return ret;
+}
+
+/*
+ * Takes the Jacobian coordinates (X, Y, Z) of a point and returns (X', Y') =
+ * (X/Z^2, Y/Z^3)
+ */
+int ossl_ec_GFp_nistp384_point_get_affine_coordinates(const EC_GROUP *group,
+                                                      const EC_POINT *point,
+                                                      BIGNUM *x, BIGNUM *y,
+                                                      BN_CTX *ctx)
+{
+    felem z1, z2, x_in, y_in;
+
+    if (EC_POINT_is_at_infinity(group, point)) {
+        ERR_raise(ERR_LIB_EC, EC_R_POINT_AT_INFINITY);
+        return 0;
+    }
+    if ((!BN_to_felem(x_in, point->X)) || (!BN_to_felem(y_in, point->Y)) ||
+        (!BN_to_felem(z1, point->Z)))
+        return 0;
+    felem_inv(z2, z1);
+    felem_square(z1, z2);
+    felem_mul(x_in, x_in, z1);
+    if (x != NULL) {
+        if (felem_to_BN(x, x_in) == NULL) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            return 0;
+        }
+    }
+    felem_mul(z1, z1, z2);
+    felem_mul(y_in, y_in, z1);
+    if (y != NULL) {
+        if (felem_to_BN(y, y_in) == NULL) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* points below is of size |num|, and tmp_felems is of size |num+1| */
+static void make_points_affine(size_t num, felem points[][3],
+                               felem tmp_felems[])
+{
+    /*
+     * Runs in constant time, unless an input is the point at infinity (which
+     * normally shouldn't happen).
+     */
+    ossl_ec_GFp_nistp_points_make_affine_internal(num,
+                                                  points,
+                                                  sizeof(felem),
+                                                  tmp_felems,
+                                                  (void (*)(void *))felem_one,
+                                                  felem_is_zero_int,
+                                                  (void (*)(void *, const void *))
+                                                  felem_assign,
+                                                  (void (*)(void *, const void *))
+                                                  felem_square,
+                                                  (void (*)
+                                                   (void *, const void *,
+                                                    const void *))
+                                                  felem_mul,
+                                                  (void (*)(void *, const void *))
+                                                  felem_inv,
+                                                  /* nothing to contract */
+                                                  (void (*)(void *, const void *))
+                                                  felem_assign);
+}
+
+/*
+ * bn_to_scalar reduces |bn| to 0 <= scalar < 2^384 and writes it to |out| in
+ * little-endian order.
+ */
+static int bn_to_scalar(felem_bytearray out, const BIGNUM *bn,
+                        BIGNUM *tmp_scalar, const EC_GROUP *group,
+                        BN_CTX *ctx)
+{
+    int num_bytes;
+
+    if ((BN_num_bits(bn) > 384) || (BN_is_negative(bn))) {
+        /*
+         * this is an unusual input, and we don't guarantee
+         * constant-timeness
+         */
+        if (!BN_nnmod(tmp_scalar, bn, group->order, ctx)) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            return 0;
+        }
+        num_bytes = BN_bn2lebinpad(tmp_scalar, out, sizeof(felem_bytearray));
+    } else {
+        num_bytes = BN_bn2lebinpad(bn, out, sizeof(felem_bytearray));
+    }
+    if (num_bytes < 0) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Computes scalar*generator + \sum scalars[i]*points[i], ignoring NULL
+ * values Result is stored in r (r can equal one of the inputs).
+ */
+int ossl_ec_GFp_nistp384_points_mul(const EC_GROUP *group, EC_POINT *r,
+                                    const BIGNUM *scalar, size_t num,
+                                    const EC_POINT *points[],
+                                    const BIGNUM *scalars[], BN_CTX *ctx)
+{
+    int ret = 0;
+    int j;
+    int mixed = 0;
+    BIGNUM *x, *y, *z, *tmp_scalar;
+    felem_bytearray g_secret;
+    felem_bytearray *secrets = NULL;
+    felem (*pre_comp)[17][3] = NULL;
+    felem *tmp_felems = NULL;
+    unsigned i;
+    int have_pre_comp = 0;
+    size_t num_points = num;
+    felem x_out, y_out, z_out;
+    NISTP384_PRE_COMP *pre = NULL;
+    const felem (*g_pre_comp)[16][2] = NULL;
+    EC_POINT *generator = NULL;
+    const EC_POINT *p = NULL;
+    const BIGNUM *p_scalar = NULL;
+
+    BN_CTX_start(ctx);
+    x = BN_CTX_get(ctx);
+    y = BN_CTX_get(ctx);
+    z = BN_CTX_get(ctx);
+    tmp_scalar = BN_CTX_get(ctx);
+    if (tmp_scalar == NULL)
+        goto err;
+
+    if (scalar != NULL) {
+        pre = group->pre_comp.nistp384;
+        if (pre)
+            /* we have precomputation, try to use it */
+            g_pre_comp = (const felem(*)[16][2])pre->g_pre_comp;
+        else
+            /* try to use the standard precomputation */
+            g_pre_comp = (const felem(*)[16][2])ossl_ec_nistp384_gmul;
+        generator = EC_POINT_new(group);
+        if (generator == NULL)
+            goto err;
+        /* get the generator from precomputation */
+        if (felem_to_BN(x, g_pre_comp[0][0][0]) == NULL ||
+            felem_to_BN(y, g_pre_comp[0][0][1]) == NULL) {
+            ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+            goto err;
+        }
+        if (!BN_one(z)
+            || !ossl_ec_GFp_simple_set_Jprojective_coordinates_GFp(group,
+                                                                   generator,
+                                                                   x, y, z,
+                                                                   ctx))
+            goto err;
+        if (0 == EC_POINT_cmp(group, generator, group->generator, ctx))
+            /* precomputation matches generator */
+            have_pre_comp = 1;
+        else
+            /*
+             * we don't have valid precomputation: treat the generator as a
+             * random point
+             */
+            num_points++;
+    }
+    if (num_points > 0) {
+        if (num_points >= 3) {
+            /*
+             * unless we precompute multiples for just one or two points,
+             * converting those into affine form is time well spent
+             */
+            mixed = 1;
+        }
+        secrets = OPENSSL_malloc(sizeof(*secrets) * num_points);
+        pre_comp = OPENSSL_malloc(sizeof(*pre_comp) * num_points);
+        if (mixed)
+            tmp_felems =
+                OPENSSL_malloc(sizeof(*tmp_felems) * (num_points * 17 + 1));
+        if ((secrets == NULL) || (pre_comp == NULL)
+            || (mixed && (tmp_felems == NULL)))
+            goto err;
+
+        /*
+         * we treat NULL scalars as 0, and NULL points as points at infinity,
+         * i.e., they contribute nothing to the linear combination
+         */
+        memset(secrets, 0, sizeof(*secrets) * num_points);
+        memset(pre_comp, 0, sizeof(*pre_comp) * num_points);
+        for (i = 0; i < num_points; ++i) {
+            if (i == num) {
+                /*
+                 * we didn't have a valid precomputation, so we pick the
+                 * generator
+                 */
+                p = EC_GROUP_get0_generator(group);
+                p_scalar = scalar;
+            } else {
+                /* the i^th point */
+                p = points[i];
+                p_scalar = scalars[i];
+            }
+            if ((p_scalar != NULL) && (p != NULL)) {
+                if (!bn_to_scalar(secrets[i], p_scalar, tmp_scalar, group, ctx))
+                    goto err;
+                /* precompute multiples */
+                if ((!BN_to_felem(pre_comp[i][1][0], p->X)) ||
+                    (!BN_to_felem(pre_comp[i][1][1], p->Y)) ||
+                    (!BN_to_felem(pre_comp[i][1][2], p->Z)))
+                    goto err;
+                for (j = 2; j <= 16; ++j) {
+                    if (j & 1) {
+                        point_add(pre_comp[i][j][0], pre_comp[i][j][1],
+                                  pre_comp[i][j][2], pre_comp[i][1][0],
+                                  pre_comp[i][1][1], pre_comp[i][1][2], 0,
+                                  pre_comp[i][j - 1][0],
+                                  pre_comp[i][j - 1][1],
+                                  pre_comp[i][j - 1][2]);
+                    } else {
+                        point_double(pre_comp[i][j][0], pre_comp[i][j][1],
+                                     pre_comp[i][j][2], pre_comp[i][j / 2][0],
+                                     pre_comp[i][j / 2][1],
+                                     pre_comp[i][j / 2][2]);
+                    }
+                }
+            }
+        }
+        if (mixed)
+            make_points_affine(num_points * 17, pre_comp[0], tmp_felems);
+    }
+
+    /* the scalar for the generator */
+    if ((scalar != NULL) && (have_pre_comp)) {
+        memset(g_secret, 0, sizeof(g_secret));
+        if (!bn_to_scalar(g_secret, scalar, tmp_scalar, group, ctx))
+            goto err;
+        /* do the multiplication with generator precomputation */
+        batch_mul(x_out, y_out, z_out,
+                  (const felem_bytearray(*))secrets, num_points,
+                  g_secret,
+                  mixed, (const felem(*)[17][3])pre_comp, g_pre_comp);
+    } else {
+        /* do the multiplication without generator precomputation */
+        batch_mul(x_out, y_out, z_out,
+                  (const felem_bytearray(*))secrets, num_points,
+                  NULL, mixed, (const felem(*)[17][3])pre_comp, NULL);
+    }
+    if ((felem_to_BN(x, x_out) == NULL) || (felem_to_BN(y, y_out) == NULL)
+        || (felem_to_BN(z, z_out) == NULL)) {
+        ERR_raise(ERR_LIB_EC, ERR_R_BN_LIB);
+        goto err;
+    }
+    ret = ossl_ec_GFp_simple_set_Jprojective_coordinates_GFp(group, r, x, y, z,
+                                                             ctx);
+
+ err:
+    BN_CTX_end(ctx);
+    EC_POINT_free(generator);
+    OPENSSL_free(secrets);
+    OPENSSL_free(pre_comp);
+    OPENSSL_free(tmp_felems);
+    return ret;
+}
+
+int ossl_ec_GFp_nistp384_precompute_mult(EC_GROUP *group, BN_CTX *ctx)
+{
+    int ret = 0;
+    NISTP384_PRE_COMP *pre = NULL;
+    int i, j;
+    BIGNUM *x, *y;
+    EC_POINT *generator = NULL;
+    felem (*points)[3] = NULL;
+    felem *tmp_felems = NULL;
+    felem base[3];
+    const size_t num = NISTP384_GTABLE_WINDOWS * 16;
+#ifndef FIPS_MODULE
+    BN_CTX *new_ctx = NULL;
+#endif
+
+    /* throw away old precomputation */
+    EC_pre_comp_free(group);
+
+#ifndef FIPS_MODULE
+    if (ctx == NULL)
+        ctx = new_ctx = BN_CTX_new();
+#endif
+    if (ctx == NULL)
+        return 0;
+
+    BN_CTX_start(ctx);
+    x = BN_CTX_get(ctx);
+    y = BN_CTX_get(ctx);
+    if (y == NULL)
+        goto err;
+    /* get the generator */
+    if (group->generator == NULL)
+        goto err;
+    generator = EC_POINT_new(group);
+    if (generator == NULL)
+        goto err;
+    BN_bin2bn(nistp384_curve_params[3], sizeof(felem_bytearray), x);
+    BN_bin2bn(nistp384_curve_params[4], sizeof(felem_bytearray), y);
+    if (!EC_POINT_set_affine_coordinates(group, generator, x, y, ctx))
+        goto err;
+    if ((pre = nistp384_pre_comp_new()) == NULL)
+        goto err;
+    /*
+     * if the generator is the standard one, use built-in precomputation
+     */
+    if (0 == EC_POINT_cmp(group, generator, group->generator, ctx)) {
+        memcpy(pre->g_pre_comp, ossl_ec_nistp384_gmul,
+               sizeof(pre->g_pre_comp));
+        goto done;
+    }
+
+    points = OPENSSL_malloc(sizeof(*points) * num);
+    tmp_felems = OPENSSL_malloc(sizeof(*tmp_felems) * (num + 1));
+    if (points == NULL || tmp_felems == NULL)
+        goto err;
+    if ((!BN_to_felem(base[0], group->generator->X)) ||
+        (!BN_to_felem(base[1], group->generator->Y)) ||
+        (!BN_to_felem(base[2], group->generator->Z)))
+        goto err;
+    /*
+     * Row i holds (j + 1) * 2^(5i) * G for j = 0 .. 15. Even multiples are
+     * computed by doubling, odd ones by adding the row's base point.
+     */
+    for (i = 0; i < NISTP384_GTABLE_WINDOWS; i++) {
+        felem (*row)[3] = &points[16 * i];
+
+        memcpy(row[0], base, sizeof(base));
+        for (j = 1; j < 16; j++) {
+            if (j & 1)
+                point_double(row[j][0], row[j][1], row[j][2],
+                             row[j / 2][0], row[j / 2][1], row[j / 2][2]);
+            else
+                point_add(row[j][0], row[j][1], row[j][2],
+                          row[j - 1][0], row[j - 1][1], row[j - 1][2], 0,
+                          base[0], base[1], base[2]);
+        }
+        /* the next row starts at 32 * base = 2 * (16 * base) */
+        point_double(base[0], base[1], base[2],
+                     row[15][0], row[15][1], row[15][2]);
+    }
+    make_points_affine(num, points, tmp_felems);
+    for (i = 0; i < NISTP384_GTABLE_WINDOWS; i++) {
+        for (j = 0; j < 16; j++) {
+            felem_assign(pre->g_pre_comp[i][j][0], points[16 * i + j][0]);
+            felem_assign(pre->g_pre_comp[i][j][1], points[16 * i + j][1]);
+        }
+    }
+
+ done:
+    SETPRECOMP(group, nistp384, pre);
+    pre = NULL;
+    ret = 1;
+
+ err:
+    BN_CTX_end(ctx);
+    EC_POINT_free(generator);
+#ifndef FIPS_MODULE
+    BN_CTX_free(new_ctx);
+#endif
+    OPENSSL_free(points);
+    OPENSSL_free(tmp_felems);
+    ossl_ec_nistp384_pre_comp_free(pre);
+    return ret;
+}
+
+int ossl_ec_GFp_nistp384_have_precompute_mult(const EC_GROUP *group)
+{
+    return HAVEPRECOMP(group, nistp384);
+}
@@ -0,0 +1,5109 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * This is the precomputed constant time access table for the code in
+ * ecp_nistp384.c, for the default generator G. The table consists of 77
+ * subtables, one for each 5-bit window of a 384-bit scalar. Subtable i
+ * contains the 16 affine points j * 2^(5*i) * G for j = 1 .. 16, in order.
+ * Each point is encoded as two field elements, x followed by y, in
+ * Montgomery form (i.e. multiplied by 2^384 mod p). A field element is six
+ * little-endian uint64_t's. Only 16 points are needed per subtable because
+ * the scalar is Booth encoded into signed digits in [-16, 16]; negative
+ * digits are handled by negating the y coordinate and zero digits by adding
+ * the point at infinity.
+ */
+
+#include <openssl/opensslconf.h>
+#include <stdint.h>
+
+const uint64_t ossl_ec_nistp384_gmul[77][16][2][6] = {
+    {
+     {{0x3dd0756649c0b528, 0x20e378e2a0d6ce38, 0x879c3afc541b4d6e,
+       0x6454868459a30eff, 0x812ff723614ede2b, 0x4d3aadc2299e1513},
+      {0x23043dad4b03a4fe, 0xa1bfa8bf7bb4a9ac, 0x8bade7562e83b050,
+       0xc6c3521968f4ffd9, 0xdd8002263969a840, 0x2b78abc25a15c5e9}},
+     {{0xc8229e55783dde91, 0x8e6c8f2e022b53f0, 0x3504e6f0ff9d48a1,
+       0xda821495f0687f50, 0x9c90a4fd2de4b506, 0xdb93b776427460c3},
+      {0x42ea84633140bfda, 0xe8e8e4a8c2aaccd8, 0x15e4f18bdc588258,
+       0x09f1fe415172bad9, 0x070d430900b0e684, 0xe34947f7123df0c2}},
+     {{0x05e4dbe6c1dc4073, 0xc54ea9fff04f779c, 0x6b2034e9a170ccf0,
+       0x3a48d732d51c6c3e, 0xe36f7e2d263aa470, 0xd283fe68e7c1c3ac},
+      {0x7e284821c04ee157, 0x92d789a77ae0e36d, 0x132663c04ef67446,
+       0x68012d5ad2e1d0b4, 0xf6db68b15102b339, 0x465465fc983292af}},
+     {{0x0aae8477ebb68f2c, 0x30594ccbee0421e3, 0x2e4f153b0aecac46,
+       0x078358d4736400ad, 0xfb40f647d685d979, 0xcfeee6dd34179228},
+      {0x54f3e8e79b3a03b2, 0xe74bb7f17bfec97e, 0x8e3e61a34c542ad1,
+       0x147162d30418c693, 0xe607b9e33820017d, 0x50946875303df319}},
+     {{0xbb595eba68f1f0df, 0xc185c0cbcc873466, 0x7f1eb1b5293c703b,
+       0x60db2cf5aacc05e6, 0xc676b987e2e8e4c6, 0xe1bb26b11d178ffb},
+      {0x2b694ba07073fa21, 0x22c16e2e72f34566, 0x80b61b3101c35b99,
+       0x4b237faf982c0411, 0xe6c5944024de236d, 0x4db1c9d6e209e4a3}},
+     {{0x7eb5c9317d56dad8, 0xcb2454b339d3413a, 0xec52930f580d57f2,
+       0x2a33f6661bdf6015, 0x4f0f6a962b02d33b, 0xc482e189f0430c40},
+      {0x3f62b16ea7b08203, 0x739ac69d5b3d4dce, 0x8bd4bffcb79e33b0,
+       0x93c9e5f61b546f05, 0x586d8ededf21559a, 0xc9962152af2a9eba}},
+     {{0xdf13b9d17d69222b, 0x4ce6415f874774b1, 0x731edcf8211faa95,
+       0x5f4215d1659753ed, 0xf893db589db2df55, 0x932c9f811c89025b},
+      {0x0996b2207706a61e, 0x135349d5a8641c79, 0x65aad76f50130844,
+       0x0ff37c0401fff780, 0xf57f238e693b0706, 0xd90a16b6af6c9b3e}},
+     {{0x23f60a05dd9bcbba, 0x9e336de5ae9b587a, 0x1c5c2e7193d7e30f,
+       0x1d9aebd64f3ddb37, 0x1c7b5fe116b66423, 0x5db4f184349cd9b1},
+      {0x0d2cfe83e6655a44, 0x836dbb36b7e55e87, 0x701754bf7d8686e4,
+       0xe9923263a42dbba2, 0x7008d943c48ecf0e, 0x3c0c6dd70d27ef61}},
+     {{0x2f5d200e2353b92f, 0xe35d87293fd7e4f9, 0x26094833a96d745d,
+       0xdc351dc13cbfff3f, 0x26d464c6dad54d6a, 0x5cab1d1d53636c6a},
+      {0xf2813072b18ec0b0, 0x3777e270d742aa2f, 0x27f061c7033ca7c2,
+       0xa6ecaccc68ead0d8, 0x7d9429f4ee69a754, 0xe770633431e8f5c6}},
+     {{0x845539d3c8d99c02, 0x2a15a9a6e58d6787, 0xe9f6368eab225fa3,
+       0x54a612d7eb32cabe, 0xc2f646025c4845ec, 0xa91a5280db1c212e},
+      {0xbb971f78e67b5fce, 0x03a530eb13b9e85c, 0x592ac0ba794eabfd,
+       0x81961b8ccfd7fd1d, 0x3e03370a47a9b8aa, 0x6eb995bec80174e8}},
+     {{0xc7708b19b68b8c7d, 0x4532077c44377aba, 0x0dcc67706cdad64f,
+       0x01b8bf56147b6602, 0xf8d89885f0561d79, 0x9c19e9fc7ba9c437},
+      {0x764eb146bdc4ba25, 0x604fe46bac144b83, 0x3ce813298a77e780,
+       0x2e070f36fe9e682e, 0x41821d0c3a53287a, 0x9aa62f9f3533f918}},
+     {{0x3db8477270313de0, 0xd4258cc55d970420, 0x03aced26c8edfee1,
+       0xf67eb42235d77d83, 0x523c40dbcf9ab45c, 0x627b415f9c35b26d},
+      {0xfacc45e48be55ed8, 0x80d60af627aa651a, 0x8c79848fd0e102ac,
+       0x40c64a4e66bed5af, 0x0329eab1f7942f0e, 0x0c6e430ef9c4af3d}},
+     {{0x9b7aeb7e75ccbdfb, 0xb25e28c5f6749a95, 0x8a7a8e4633b7d4ae,
+       0xdb5203a8d9c1bd56, 0xd2657265ed22df97, 0xb51c56e18cf23c94},
+      {0xf4d394596c3d812d, 0xd8e88f1a87cae0c2, 0x789a2a48cf4d0fe3,
+       0xb7feac2dfec38d60, 0x81fdbd1c3b490ec3, 0x4617adb7cc6979e1}},
+     {{0x5865e5018f75244c, 0xd02225fb01ec909f, 0xca6b1af8b1f85c2a,
+       0x44ce05ff88957166, 0x8058994c5710c0c9, 0x46d227c432f6b1ba},
+      {0xbe4b4a9003cb68e5, 0x540b8b82730a99d1, 0x1ecc8585e11dbbbf,
+       0x72445345d9c3b691, 0x647d24db13690a74, 0x4429839ddefbadf5}},
+     {{0x446ad8884709f4a9, 0x2b7210e2ec3dabd8, 0x83ccf19550e07b34,
+       0x59500917789b3075, 0x0fc01fd4eb085993, 0xfb62d26f4903026b},
+      {0x2309cc9d6fe989bb, 0x61609cbd144bd586, 0x4b23d3a0de06610c,
+       0xdddc2866d898f470, 0x8733fc41400c5797, 0x5a68c6fed0bc2716}},
+     {{0xda6e8a7f7c33ed91, 0x992afb5b0ecdd2d8, 0x37cf65517917652a,
+       0x317b63ea2887d5ff, 0x37065f5313bdc3fa, 0xa10896aa435abaa1},
+      {0x9b21615fefabca26, 0xeb07ddea230cf00d, 0x914871dc154d410f,
+       0xb333bdfbc88ee148, 0x51c305c6a72d1967, 0x659db48181ef2513}}
+    },
+    {
+     {{0xad852b878c0a64a4, 0x0d784cf208f779d5, 0x1896b9fcc651b1dd,
+       0xba8953d612e8dc87, 0x3a9865baa631cfb0, 0x5dd2a4a0626b3d79},
+      {0x1148bc72687c20bb, 0xa372dfc2f2a52bfd, 0x77315f9e9448fd08,
+       0x4bcb06f00a2377b6, 0x73b42725b35b4ff0, 0xc510ad93aabca99f}},
+     {{0xed4de4f88e89b258, 0x957c980f297a9a37, 0xe04b3d30f8a0580d,
+       0xa309199dca57b7bd, 0xfc8e87cf3be44d56, 0x4f5d5ab6d1b30e5c},
+      {0xb213c6a030a9325b, 0x0fd1c52df091bc01, 0xfe51bbbf1090fede,
+       0x6d97cabc301fe259, 0x3ee127895ecd3fe8, 0x888b708b9404ca51}},
+     {{0xdc5293851d15bba7, 0x8fd61e31148840d4, 0xee21597e52ce08f6,
+       0x26de4c6581998af2, 0xcb4aa43c9741eb42, 0x8bf3dccc39c18b96},
+      {0x66e1d5dad872984e, 0x507e24057dd87c39, 0x8545396f305ee4f0,
+       0xf9d19ea0c831254b, 0xcee0842f5d5680b8, 0xb257fb6c5a4434a4}},
+     {{0xe484fd9f8258030f, 0x0f4fa5eff21af80a, 0xc0dd449e7c1c3984,
+       0xf313389118eb5195, 0x0336aab8777a16d2, 0xa6661cc4c241720a},
+      {0x678db970a7efacd0, 0x228968656461e382, 0x5d85a0e4a022c7a4,
+       0xb01f1e0434a02a6b, 0x2657eedda5791ce3, 0x239dcab2a277ac5b}},
+     {{0x7f74672d0b3db49f, 0x026275e9adc8418d, 0x18866523fe7cc4ee,
+       0x3546317bbbf36aca, 0x282313fa80caf049, 0x08275c9c9a49d91c},
+      {0xe41f92ecab71c2a8, 0xb56746981dd95aae, 0x82347685a8c4dc57,
+       0xf78b23d6a847fd1e, 0x8194f070b692f868, 0xfe0dee06a5f2ad03}},
+     {{0x61361c0622abee22, 0xe82123bc2f42a470, 0x2c97dda13c6ceff4,
+       0xc2eea21fadcb0453, 0xdf2a4407c78ec9ff, 0x54557c559625c735},
+      {0xc693c9857c440c0a, 0x918e7324e56622c1, 0x8f990d2ba5f0900f,
+       0xa5b7d193c6aeeaef, 0x9f053d95450456e3, 0xdf783b1cad418ef1}},
+     {{0x08d2ce13be6c3221, 0x0f53824c9c0624ea, 0xad3ca7445da25412,
+       0xecb38a4193fea7cc, 0x8ae838d8cba623c4, 0xa75c8da541d85222},
+      {0x9f48b828290807c8, 0x4df75f0922f4ab6a, 0x02511a3e7cab82a9,
+       0xcc052dc321da354e, 0x7db6c1f303ca73e9, 0xca1d4279cb99244e}},
+     {{0x9a7a5b426ae54da1, 0xcfcadaab7040b022, 0x7539438e3d9f0e61,
+       0x013c6719e328c2e2, 0x7f4a706ccccbf891, 0xa335ab82735a2d28},
+      {0x46694ef03d984124, 0x0e0bdfabc166b337, 0x9d54ed8b423d47e4,
+       0x8075a8cbf44c9180, 0xd4f5b184abe9b384, 0x424dd00b41abdc75}},
+     {{0x36137ae5f2432ae5, 0x2d941abcad5f443d, 0xe31e96f2ee013f80,
+       0x24127d2026385266, 0xd4004cf3eae97f8b, 0xbf3b201a62527c9e},
+      {0x0cd0fee1cb8a2a2f, 0x488944698fdceb43, 0xe67565ba2250a356,
+       0xbbb5f8ca2ccfe7d1, 0x431a268fa350fe88, 0xd2eb03734e5b64d2}},
+     {{0x2ad7ae0df5d0255f, 0x4c04dee0d0836f8b, 0x15e3493e4ec33606,
+       0x590aefe65f5eea30, 0x09ef5a2e2e49ba54, 0xf56d447f69a0d232},
+      {0x045f26b6e2510f5e, 0xf90e18889941083a, 0x6e6a3bd6e66f6b9b,
+       0x637ad390251f82ae, 0xc40374b643cdf91a, 0x62f5f8ad2d6c6d88}},
+     {{0x3da0359011ff6e09, 0x41194047a685c0e8, 0x7c5323ff72b9c9ce,
+       0xf84ce5054f599daf, 0xd0dec10e5882ef19, 0x1ca3449dde1e3a06},
+      {0x317e4e7fb09af84a, 0x0ebaa2c91a46bc75, 0x42b00a72c103f200,
+       0x1c30ada5c3719155, 0x565bacfa5c1cb58c, 0x374f516c35fa4670}},
+     {{0x99a710b1400f1d87, 0xec3ca386ee47be8b, 0x3a00dcad37168fee,
+       0x1a69d6741765a0df, 0x85233afe917c4909, 0xa3aa97a4e9bd6210},
+      {0x01010526310885f3, 0x21c5de3fb5007b08, 0x5df0c6efee8ddabd,
+       0x5d17d45a0f6dfdef, 0xb73d831a251c9f79, 0x397779e6cb1df19d}},
+     {{0xe97f7bcfaf897b90, 0xbaeecddae05af5ab, 0x3c80856e1b81fd5b,
+       0xea309bd0eca4f983, 0x534d895022ab76a2, 0xa8d636276d620cfe},
+      {0xa13d622c6b0cfcfc, 0x584a9d2e84d9147e, 0xf23b9565d200ea9c,
+       0x5f44b61a193d5fe0, 0x430a3d3a64b4c78d, 0x045dc592c91c2b41}},
+     {{0xafd6bf05be13c1e4, 0x256e2b98e2ea8c26, 0x06711695903983f4,
+       0xbefbfbcb217c1577, 0xa214b26a7324c85c, 0xfa2d4711dd98b968},
+      {0xed722297f5d9cc93, 0x65cec50fd45f8635, 0x41627e4ac792e6b3,
+       0xc254a08c228dbb39, 0x5b28fd3fdf6fb26b, 0x1471d3534bdc6969}},
+     {{0x8600c7347c20f79d, 0x2bef7d87ca3052ba, 0xc52d0bdf7b082112,
+       0x0e649a4b2bf757ca, 0x0c1f41bdb13eeb84, 0xd7115e8f8ecf9ace},
+      {0xa62f5e311698ba68, 0x6a06d7bec862e751, 0xd875c1a4f95eee3f,
+       0xb25f8da3a0b2b331, 0x4e52fd111827c037, 0xacd38c2a9d72ba3c}},
+     {{0x5e2cb07fd7801edf, 0xf9fa2c0b3adc065a, 0xa296c53fd4de1f25,
+       0xd408060c838f7169, 0x68e19d7b2e8a6ce7, 0x2cc6e06c94b58671},
+      {0x93d02a07c1cb6151, 0xa10fb4cf35003126, 0x6aa069f51aa3bc4e,
+       0x0e44fbf0dd09b142, 0xe264f343832e5945, 0x5dca2adc1fc166ac}}
+    },
+    {
+     {{0x56ad7582a0eb176a, 0x085b5a366e19aa00, 0x85f2c6ffe2c8b036,
+       0x55c6d357fcd7336b, 0xb1ecc56d22a46acd, 0x8e0f976736277ac7},
+      {0xa4ed11e901878921, 0xd38355667f4fb650, 0x5fdaba45266158aa,
+       0x6f0b27fd89e0dff0, 0x32ef7ae2eb6b02d0, 0x2f145871cc1b46e1}},
+     {{0xe65245cef6e9f82c, 0x9e234dfff6da7b5a, 0x5677c121bad2c806,
+       0xc52dec32060fcf24, 0x78d070675d78ccca, 0x630002ea1bc8b6fb},
+      {0xc5cb86beeb2e99ae, 0xf13981e78551d16f, 0xfbb7cdf2c92a70d7,
+       0x5a9ff1f1f53cd2a1, 0xfdbe6b7a984f1139, 0x4403d046a470a9f1}},
+     {{0xb5b16cd48d040c69, 0xfdaba315f95a2dc4, 0xc9fef34961ce4704,
+       0x5fe87a0ddbb53ed6, 0x3f0ccc7973d70f93, 0x4601d1bc46724a1a},
+      {0x5c4a15ae24f08565, 0x5eda1e8aaa577320, 0xe31ebb35bb32d307,
+       0xcdc6f13bdc770a0e, 0xbe3ae514c434c2f8, 0x57c7fdf63a0ef0d1}},
+     {{0xeb06571c0f547eba, 0xf292c38d6246c0dc, 0xa185966726eed224,
+       0x8d9e56e46100e387, 0x470506b9dc6298d1, 0xb19e084cf3350ad0},
+      {0x83eb62a812abd898, 0x70f152cc2222342c, 0xb089e880e1bd4a82,
+       0xd4d1e70fcaf3b3fc, 0xd0b1ec6395ffd65c, 0x79f27f3a9b184ebb}},
+     {{0xc2467f9ab92a9a13, 0x0c3ee8eb6add349a, 0x59250eda45e99644,
+       0x22ce0635c8a2df27, 0xec7b643e312e8698, 0x334ccf2eaebd1587},
+      {0x0c1c68736bca2900, 0x00beb4c209826cb1, 0x12dbb586cde6b725,
+       0x8d7cee6c66dfed41, 0xc38deba2014de4c8, 0xa3ba6ec76248442d}},
+     {{0x3c686079d42aeb95, 0xc162e5e985e3ea0f, 0x34cf58611bbb2455,
+       0x7650de1d8773b064, 0x3b7562c6d2bab35d, 0x83191b4433d0741b},
+      {0x4b604db03a6bd9cf, 0x87cd84db074aed21, 0x02a042d2d4f91f9c,
+       0x5a5d52e5e42c2a67, 0x31291acd1d5f216a, 0x9c3971bccd6203c8}},
+     {{0x92e4c851aa1ef488, 0x4f91fc22846528a9, 0xaa2f5d2d5dc13a84,
+       0xba06aa68f1072d4d, 0xf4f3b17c5e3a2ba9, 0xff36a5355e4dde77},
+      {0xe8ef143aae17dddc, 0xcc82631ba1fcd4ec, 0x97db807ec7d3963b,
+       0xe4aff04521d85ce2, 0x2d6480e674667392, 0xc8ce97f3a55d0b3f}},
+     {{0xd42777314c14ee0e, 0xda8146d15e881c3f, 0x6b0746b099f1867c,
+       0x1ec73d72602dd4cc, 0x27fae51538081120, 0x6a677bdc2f8b2f2d},
+      {0xb924af64d60544e9, 0x1439e183dcfc6b16, 0x4e88e9ae068565ac,
+       0x8a3dbd25a9a4f146, 0xdb4a3e483f93f734, 0xb1971c058f1d33bc}},
+     {{0x059a5f9856e8d1d1, 0x93a2d2ac5c228e89, 0x0bc2c885fea48feb,
+       0x27fdf3be7b7e188c, 0xec579682d399ba6e, 0x01b12e12b3fdb5d0},
+      {0x8e00941b742f66b8, 0xd79bc58f478d8ee4, 0xefdcd0539ad50729,
+       0x8738666f3bf7bfea, 0x20192810d7afaff1, 0x6c13e29ed233e892}},
+     {{0xf1f5df24ff9ae345, 0x5b8038b93dd75336, 0x4746c5da7d2c0058,
+       0x667b07bd51ddd827, 0x1b3c67c28cfdfd25, 0x058dea0606dac0d6},
+      {0xd19040fd846c847d, 0x4e5cbe5907d00ec6, 0x2dc442fef1930296,
+       0x12f89640fdb583be, 0x0694f44f5606f66b, 0xa9fcca6cbbef8446}},
+     {{0x0c229fb94b5cb12f, 0x0486ba2de930ff3e, 0x00797293b80c37f6,
+       0x71be9538b43335e0, 0x0a604693da0d9cb7, 0xb248f30d745cc02e},
+      {0xfa889343d9a3013b, 0xd8642bc053d6a4d4, 0x9f89c21ae216af4b,
+       0x8627290041947320, 0x06f5f8f7a269c49a, 0xb3bc6d62727495ba}},
+     {{0xd1de964bd1066e5a, 0x26ccad6b749909df, 0xbc4b55af0de9eb07,
+       0x9f11b995a60289bf, 0x3e59000c52392c61, 0x2128c46a5ccff4fc},
+      {0xb28b306bea1e0d5e, 0x5f6ef5d5f5cfa47d, 0x59b0542ce3f824fa,
+       0x70f097b22f52b71c, 0x4483b72604c6d263, 0x48720be734d93e5b}},
+     {{0x864bbbb795ad5fe3, 0x24f15dcbe8113888, 0x968fcf606edb61fe,
+       0xbf266d1cc7e1aff9, 0xd85a15553f4a5d91, 0xd5ff238ef8416ead},
+      {0xcc0e75da30d18538, 0xcf8a5435b2b91d71, 0xfae90226027a7e72,
+       0x8e39918c627c27f7, 0x5b8235c918d454b0, 0xef92e64344987803}},
+     {{0xb39b33ce41ff08a5, 0xaf6dfb2832450c03, 0xe21947c57b45c3f2,
+       0x21b529f6bc35bfdf, 0xc0a269284c5be366, 0x73856f3ad366b21e},
+      {0x53e26b663df444f7, 0xb18a295e8b9c7ac1, 0x6b9df497301f1f11,
+       0x6e77d0e27607f372, 0xd2e6b296c311fc01, 0x18a224e07a396a6c}},
+     {{0x8507c7079b97dff2, 0xacc0b6a5983d26af, 0xdcc30fd62b62fdb2,
+       0xe9b03755a68ab541, 0x270bc07313b6c3a0, 0x952ec4b9649051fc},
+      {0x4814c2c2e70ceb83, 0x07632da5c090e636, 0x1c34068611fcdb0b,
+       0x7b4985d7113f2ce9, 0xc307234716da3a7d, 0xf0575aef0d7d36ab}},
+     {{0x721bb8363a7f43c3, 0xab5b3108c12dca0f, 0x9cc9a78934853870,
+       0x78b604a7af598c4f, 0xd370375e476f27c8, 0x9f0415b80b15cba5},
+      {0x2bcfd9a4d400dc1f, 0x2a6fe03b4bc62ddd, 0xb05a6464a211b19f,
+       0xce059d419990b504, 0x011c5f87d94951d3, 0x13cec08900d9c7b0}}
+    },
+    {
+     {{0xf365419f9b280fd9, 0x13e3b12746365672, 0x8a91c165c41880aa,
+       0x3eb27a97f9712fbd, 0xa6587aec76c55678, 0x7c3a04b702cd79cf},
+      {0xfc878f9cda712eb8, 0x076e61170fca3e02, 0x09a184d8caf6df5e,
+       0xd32bf232aabcde75, 0xf601d0de03de597a, 0x85d2b5fcc5da2858}},
+     {{0xb6029961ae899afa, 0x8eedd66e681b6e1b, 0x82db693b4df3e5b1,
+       0xb5131488a0c3e357, 0xbfb01ff3ccb2f577, 0x28ea947027a72cc3},
+      {0x26170928e39e325e, 0x42d4876b84f80188, 0x0bec6a634c872d76,
+       0xa0a7cc90b14d9c9f, 0x8a32d2c44f6c7778, 0xe7cd346e3b889a4c}},
+     {{0xea95b5c9437f2efb, 0x67d3e9b58e52ce8e, 0xfb33102488ff5455,
+       0x883ec9fcc3101ded, 0x056218e20ca5f1f9, 0x4c9b2483bccc65d8},
+      {0x13199b26123db2ec, 0xbc1d82479aff90db, 0xc4a9311d367516f6,
+       0x3b40c867cb6e90d6, 0xff674ff84034415c, 0x2787db45a1821e7e}},
+     {{0x860ef794609683ac, 0xf0631ad39af1c522, 0x322c83662ee7f522,
+       0x58ccd95f54122af0, 0x7454880c2bbb2d80, 0xea173d8286d8d577},
+      {0xd5a3057cea1cc801, 0xfd08d482bbb2a189, 0x26aac99ec3c512f8,
+       0xc3eac036556d891e, 0x866c3aa7bf9f6112, 0x7c4c8fb9c144f7e9}},
+     {{0xc0c1eb0f8343f5dd, 0xa205e66a0126fa2d, 0x37530a3244fd8be4,
+       0x3c7af6f696ab64cf, 0x1f04305076657202, 0x2c59d31c828f3fb1},
+      {0xa61cba51e7f5926e, 0xb2de427391ebeb81, 0x976f2c34bb855476,
+       0x0c6c02c3269e4f86, 0xc69bed8fe2e01fff, 0x19aa421c480bf7b4}},
+     {{0xad0d24c7b617206b, 0xb8be483f9dd13f59, 0xa55134ff7655aa29,
+       0xa3d103857a5e217e, 0xfbb9eeb53a21b295, 0x1de71555c84a136d},
+      {0x7579398e0b7487b3, 0xc6ca9575a14dce87, 0x99b32e1e46452257,
+       0x99d54955479d8f2c, 0xc2a8a6a1930b80ef, 0x58d9db81656c850b}},
+     {{0x6c85a0eda682508c, 0x8350b515edcce6c8, 0xa84a67656f95898d,
+       0x55b0ae971e419847, 0x11115c6edd6a885d, 0x6f0beaf64fb174a4},
+      {0xaaae44b2815af3af, 0xcf0697b9927a2c1c, 0x37639d62d7d645ee,
+       0x157b7eda2effec37, 0xb55e50759b9c66e6, 0x33a66a1f85f597ec}},
+     {{0x171898aa8f7782b6, 0x8b7a706b499b3a81, 0xbc0e835ffdb2c1ba,
+       0x4ee30281591f5aaf, 0xfd71de3bcc272c6a, 0x532800c46e93f68a},
+      {0x35ee08048365c576, 0x6c2bcc94cd4c0221, 0x49f37ff5957b2ff6,
+       0x315d8e7e5ec029c0, 0x33230602ef324c12, 0xf5847f9b966b2578}},
+     {{0xc29b123e1453b1e1, 0xefb0778820059b44, 0x15554ade9291671e,
+       0xeb5a1980429dea37, 0xf96dacbb6c4b867d, 0x4f5563d6abab4d68},
+      {0xb5b0ecffcbe76297, 0x5a22996a51d6bd43, 0x0088ec95b7e5cfc6,
+       0x4863a5a1fe373e05, 0x42b7925bc244d93d, 0x85bad13540117113}},
+     {{0x86283e21f9daa551, 0x47fd23f81f696f1b, 0x7d029b1bb9784a9a,
+       0x7c7798bea0c0acb5, 0x41241c716d7c682b, 0x11c6c1131d33c2b0},
+      {0x5d469ca23565cf32, 0xa949f022bad4bdbf, 0x3d054cc2a13cf4cd,
+       0x13bd21669e3ce279, 0x01bc70e68a4beafc, 0xb39e351d8aba087e}},
+     {{0x26072a5d82357232, 0x3762764e9f0fd2f1, 0x9c5813f60c16733e,
+       0xea2e0e03718951d4, 0xae195bd469e63818, 0x241a4afcfa2f9a6e},
+      {0x0e97519f9165d59a, 0x416bd37358e5af1b, 0xc4e811288197b7ec,
+       0x4145be2c9c6ba0d0, 0xc82cb2a17d40b98a, 0xc3c28487bccfa8b8}},
+     {{0x84aa863ea4ee10a1, 0x24d805a687919ccd, 0x553f3206b5c399b2,
+       0x775b92173cc109bd, 0x25c01263fe384088, 0xa3c4418bd5f743cf},
+      {0x3d69705ddf91f1f0, 0x547d46269ebddad1, 0x0198ab1a2626cebd,
+       0xaf8320f285b1afe8, 0xb9c0968ce17e6efd, 0xfedc75c290215bb6}},
+     {{0x8061d340143ff74d, 0x59e94fc6a23aa7b3, 0xf7c79a0b914c3b81,
+       0x5a836211702c6ae7, 0x2570d63c718123c3, 0x7e86d11ec9f5ce3c},
+      {0x80f03f9717bcce3b, 0x073975b1465a7446, 0x29f66de7cb357ace,
+       0xe87bd12c04894fb0, 0xfc501a2651a0b5ae, 0x20a3170c02207a3b}},
+     {{0x3ee52d8f5fe63bd4, 0x09f8405c7a7da77c, 0x35ce95c61881a757,
+       0x0a8cf9d9c13e3707, 0xe71258d548d2d3f6, 0xcf4fd6910bbe7c0d},
+      {0xbd6496e1fb9479f1, 0x711c669aab8cb3a2, 0xcbe8501358cfdfb4,
+       0x655c902b59275b4a, 0x7e0ff05b20f722ba, 0xcb00031d42b17aad}},
+     {{0x3360ff11d54bf1a4, 0xbab994cb5c79494b, 0x953ad553757d7771,
+       0xf17f14f068b58ed5, 0x223615317523c422, 0xf0f05f965ebf0d49},
+      {0x3386676549182267, 0xf87eccc1ad71c3eb, 0xd7708e18913d8dca,
+       0x27fe27e1b193eef9, 0x33376365cc45e65d, 0x599b4778d700ac20}},
+     {{0xda643272ed068028, 0x86b52135a91fb87f, 0x23865a7c35b43943,
+       0x6ac015884606bbf2, 0x9660ab721559fb9a, 0x1fcb09e73ce2f1a5},
+      {0x62af29ab793d2f0c, 0xad5aaef53aee7efc, 0xee9f29b744c11037,
+       0xb2a19cf1d36c2571, 0xb87d88e265b552b7, 0xd8b4f172beb253d4}}
+    },
+    {
+     {{0x31bdb48372876ae8, 0xe3325d98961ed1bf, 0x18c042469b6fc64d,
+       0x0dcc15fa15786b8c, 0x81acdb068e63da4a, 0xd3a4b643dada70fb},
+      {0x46361afedea424eb, 0xdc2d2cae89b92970, 0xf389b61b615694e6,
+       0x7036def1872951d2, 0x40fd3bdad93badc7, 0x45ab6321380a68d3}},
+     {{0xc5cf8997ce0b5b72, 0x350adde19d7154ba, 0x8139681e307b254a,
+       0xcc87fb5775cd94d7, 0x90e7027478684954, 0xc4fdf4c095ceb991},
+      {0x91bbc0ab8762c84c, 0x5e09e226ce09e8ad, 0x1cb83d704b93d45f,
+       0xe2299024f541da1f, 0x3eef7ce14b7ffd10, 0x53ee63bbb3fc1b9a}},
+     {{0x23c1f74481a2703a, 0x1a5d075cb9859136, 0xa4f82c9d5afd1bfd,
+       0xa3d1e9a4f89d76fe, 0x964f705075702f80, 0x182bf349f56c089d},
+      {0xe205fa8fbe0da6e1, 0x32905eb90a40f8f3, 0x331a1004356d4395,
+       0x58b78901fdbbdfde, 0xa52a15979ba00e71, 0xe0092e1f55497a30}},
+     {{0xe5004e8003682f59, 0xccdb9cb7f642ac0f, 0x405f50d1bd869f77,
+       0xecffa54de7ebea2c, 0x3354dc22d87620ba, 0x01bb2988b1c01ff4},
+      {0xd9370076e16477fd, 0x45303d2a2e71ba4b, 0xc0de76273291e5c5,
+       0x5cfebd87f0a7ca55, 0xde1162809e592a30, 0xdd26e577a78ebce4}},
+     {{0x5562a85670ee8f39, 0x86b0c11764e52a9c, 0xc19f317409c75b8c,
+       0x21c7cc3124923f80, 0xe63fe47f8f5b291e, 0x3d6d3c050dc08b05},
+      {0x58ae455eee0c39a1, 0x78bea4310ad97942, 0x42c7c97f3ee3989c,
+       0xc1b03af5f38759ae, 0x1a673c75bcf46899, 0x4831b7d38d508c7d}},
+     {{0x1e9b23b9ff1735a8, 0xc3bf3d5b2b0e4b7b, 0xd4cc00fe59b7721c,
+       0xd5c36f9c9e2f4ceb, 0xdeca06bac90af70e, 0x42676f12416ee799},
+      {0x0d7afe1b6f748c6f, 0x0b7a6de539c39d55, 0x11e43d6ee6eaed18,
+       0x5baf8602496087e0, 0xf833634fb1a3a66e, 0x25098c8a79398677}},
+     {{0x76512d1bc552e354, 0x2b7eb6df273020fd, 0xd1c73aa8025a5f25,
+       0x2aba19295cbd2a40, 0xb53cadc3c88d61c6, 0x7e66a95e098290f3},
+      {0x72800ecbaf4c5073, 0x81f2725e9dc63faf, 0x14bf92a7282ba9d1,
+       0x90629672bd5f1bb2, 0x362f68eba97c6c96, 0xb1d3bb8b7ea9d601}},
+     {{0xe141e763d4720770, 0xb9739e70ddb3b450, 0x46e6cde496131446,
+       0x0458a5d5cb6c2ef7, 0xb7747634532f9fd8, 0xf62d372116544457},
+      {0xbfacb4ded3100854, 0x70788a31b39d3f62, 0x9b543220f22d92e4,
+       0xaa4590f655723258, 0xc7b6730e01ddb8bc, 0xae252cf869e1e7bd}},
+     {{0x73878f7fa9c94429, 0xb35c3bc8456ca6d8, 0xd96f0b3cf721923a,
+       0x28d8f06ce6d44fa1, 0x94efdcdcd5cd671a, 0x0299ab933f97d481},
+      {0xb7ced6ea2fd1d324, 0xbd6832087e932ec2, 0x24ed31fbcb755a6e,
+       0xa636098ee48781d2, 0x8687c63cf0a4f297, 0xbb52344007478526}},
+     {{0xc618cf0ddd4b8d8d, 0x471cda8640dcfbfb, 0xba0dd7ac08882ce6,
+       0x58e5d2f56cd336e7, 0xcdda8301af096540, 0xf6d268463cf31600},
+      {0x6150cd982197efd5, 0x4440fbfa55fb0877, 0xca31871c90757f1d,
+       0xc4a1faacbdd756c8, 0xc9d4ac1bcbb8421e, 0x3c0c2914b17c43be}},
+     {{0x2e5f741934124b56, 0x1f223ae14b3f02ca, 0x6345b427e8336c7e,
+       0x92123e16f5d0e3d0, 0xdaf0d14d45e79f3a, 0x6aca67656f3bd0c6},
+      {0xf6169fab403813f4, 0x31dc39c0334a4c59, 0x74c46753d589866d,
+       0x5741511d984c6a5d, 0xf263128797fed2d3, 0x5687ca1b11614886}},
+     {{0x46fdb65caa6fe9ea, 0xe0d48e5e05494cd9, 0x5adef5704afbf837,
+       0xc96ba4b91c9e2cad, 0x1e8158f7054a158c, 0x47be73209e38b88d},
+      {0x9b99971e6d2993ec, 0xac9b0bfadf980ecc, 0x9da09642d96ca391,
+       0xd67105369bf4305c, 0x40cc1adfa0dfafae, 0xe27e32f8a209699b}},
+     {{0x076d902a33836d4b, 0xec6c5c4324afb557, 0xa0fe2d1ca0516a0f,
+       0x6fb8d73700d22ecc, 0xf1de9077daf1d7b3, 0xe4695f77d4c0c1eb},
+      {0x5f0fd8a8b4375573, 0x762383595e50944f, 0x65ea2f28635cd76f,
+       0x0854776925fde7b0, 0xb2345a2e51944304, 0x86efa2f7a16c980d}},
+     {{0xeaaddeb836e87d82, 0xc12587a71ffd7210, 0xf93d2f5c731f6838,
+       0xb96594e8f7097a65, 0x08d6717ab016e8d3, 0x9c378de81984d825},
+      {0x627d41e7cb2a0c26, 0x1f447501c697ceb1, 0x8dc40831c760550b,
+       0x70ad48707fac97b0, 0x5ac7f22e7021c170, 0xa6f730e4929d5931}},
+     {{0x4ccbe2d0bf4d1d63, 0x32e33401397366d5, 0xc83afdde71bda2ce,
+       0x8dace2ac478ed9e6, 0x3ac6a559763fdd9e, 0x0ffdb04cb398558f},
+      {0x6c1b99b2afb9d6b8, 0x572ba39c27f815dd, 0x9de73ee70dbcf842,
+       0x2a3ed58929267b88, 0xd46a7fd315ebbbb3, 0xd1d01863e29400c7}},
+     {{0x7d27d71fd186cb09, 0x67cb7f4e3bc213c7, 0x418cafeb6075b2cf,
+       0xc0d691e6d93a06f7, 0xc16a95259dd001b9, 0xa0583230026f17b9},
+      {0x4c1041b07845900b, 0x2874079147a22aae, 0x8d08efd62c1758e9,
+       0x9cc6f207e6c3229a, 0xec69e902082d8924, 0x9cfa1deaf331dfe7}}
+    },
+    {
+     {{0x8ec4335fabe7c60e, 0x01f198c10a6a9fb5, 0x3ff96de001141ab6,
+       0xb21acc2c2eca98a1, 0x6154849010fdf648, 0x2c01a99cd1403e8b},
+      {0xf1a35f306fa509d7, 0xf7715fe3e3f08e9f, 0x89c26c077fc9a752,
+       0x8d2535fe420d48a0, 0x80ec5ddd52fe2e73, 0x041b8df071704f39}},
+     {{0x498808edc65fafce, 0x3676a7cc4e806bc3, 0x796e25f176c6b964,
+       0x1aced64bac474261, 0xa62470fc29a460c1, 0x77501dce5e751e48},
+      {0xcc00053b6d9e3641, 0x2b5bc4ae9a3f5a0b, 0xddaccc2e3f9ca178,
+       0xad33f34a0b80d1b0, 0x6a76df9364642225, 0xc145f36f778e761b}},
+     {{0xdffb03aec10b43ae, 0x39b1266e9433a54b, 0x4c262521b19fe0db,
+       0x0ec1e54f3d5c7fee, 0x2856510b05e68e1e, 0x49382c1edc80b8a6},
+      {0x80a509312471bdd5, 0xe8cde18581974aa9, 0xca6112ee28235c52,
+       0xd28a0eb8301f9653, 0x22b11e26e11fcdf8, 0x97e6fc5de4d735f3}},
+     {{0x9c66a32becc5f6da, 0xe4ff40431719ba2c, 0x8c6cfab721e716ef,
+       0x32c8fccb96ed74e6, 0x475890dd0b110c83, 0xdfada95f5cb4eefe},
+      {0x9d7b89a693240fe1, 0x6afdb2d0210b776f, 0xc3f0b55bca7a7d52,
+       0xa6e56a0655d04585, 0x818e221c4257acc5, 0x05207b63fcb8d39e}},
+     {{0x00fc2cfeac993097, 0x4d3532b176b4508c, 0x0887cb17a24c9add,
+       0x2698a3e01a9972dd, 0xa6f0258b26352346, 0xf67915993132792c},
+      {0x2c3d2ebb92f39495, 0xf84058943f9e744c, 0xba22030154833968,
+       0xa0c5454eb7936d27, 0xdd9078e1b0ca30ec, 0xfa5e78ae5a80ec29}},
+     {{0xc948333be68b9c0c, 0x96e30042265cb56b, 0x957516bd3c12bd22,
+       0x0d3284730033e495, 0x23ff9704c9e2117d, 0x81693f98e3d28a72},
+      {0x7a0ba6c9f8066b56, 0x0e2e2242332bdbe8, 0x885d3c00e9f4ce83,
+       0x3145e5ec8ae96eae, 0x8d4b26d491e3d14c, 0x17b5782aa9ad6fe2}},
+     {{0x39062094cabd9b94, 0x20b3910bc68dc31e, 0x7d78a0430b708450,
+       0xe113da29522bd0d5, 0xc46fa10af7f27be8, 0x8258b2ce295393a0},
+      {0xf69dc62228d958d8, 0x97b796c0991261e9, 0xaedea55e36482f74,
+       0x6e4f2e3ceec962cd, 0x782f495a2a06b626, 0x41e32a4dfe23dd4b}},
+     {{0x0a74da82d8ada6cc, 0xc6b98a3cbea55457, 0x896c26bb57c2f5ac,
+       0x981e2f72845d45e4, 0xca152b877e9a7d36, 0x49666d457b582e8f},
+      {0xea3b9bda49fc20b9, 0x5bcbc84a7c71f153, 0xd346fc5d5748a654,
+       0x7ac2f217622665ee, 0xbb5efe7fb6f16e27, 0xb1810a70644c9dc8}},
+     {{0xe0c7946c2e4b40f5, 0x7ef21fe57dd0f6de, 0xc2a8cdd8f81f21f3,
+       0x6ad73e42c7ebe7a3, 0x3e8099c35d42a7be, 0x151c6de86df16d22},
+      {0x214a649b5293c104, 0x769763d156b4d1d3, 0x78b33355e3bebab4,
+       0xe10a70cec78a804e, 0x985a16fe211f735e, 0xfd50c86856605fc0}},
+     {{0x16bcf31c8f646cdb, 0xe9b4b8a9059f65cc, 0x34a47964f8971dbd,
+       0xd76f597fcfe021f8, 0x23bab19c573891a6, 0xdf6702852645a244},
+      {0xcc338b2c4347674f, 0x1ddd83da4c07ab3e, 0xee6bb10231bf757d,
+       0x3f2828c5032ec673, 0xcf0daf5f0cd7c8f8, 0x1b5d112656eba0e0}},
+     {{0xd9b864d9dcf6b460, 0xf453164e5141107c, 0xac36ccb9b019575e,
+       0x996c97bba0040dea, 0xf684e53986b7899e, 0xb11bb5336b00d106},
+      {0x86af64aabe831360, 0xbda68250b21650cc, 0xc080ad14ffd7b0c6,
+       0xa7cd582f1a3844b9, 0x3656ad084531ed01, 0xe12b761e0af8481d}},
+     {{0x94a35f648532b8e4, 0xc2cf81f82227ce87, 0x2c0a163f7f8ce7c5,
+       0xe9de5d0fba5e1907, 0x0a58d572c1c14999, 0x406a3eccd934e441},
+      {0xf9ef9a75c315d861, 0xa18abeae864a28bd, 0x9e65f3c360831100,
+       0xf757107b2d4749cd, 0x8fec38ebe8d782bb, 0x74b4d444be94b2ae}},
+     {{0x796fc73b59480d9b, 0x9f33407ae0555912, 0xbc428d52bcd9a4bb,
+       0xffe3b15b82ac0b57, 0x0f4cbd0aab58a714, 0xe3b57ece353b82bf},
+      {0x67e16b95f77aa72a, 0x7b5d3eda112a81cc, 0x6795b7758d749470,
+       0x334bb4fcfe097d37, 0x0489c0ce64deebc3, 0x0cf28e2985092a86}},
+     {{0x0cc8d80b29843096, 0x1f5107d76aaf8c7c, 0x6fb26e1ad1647601,
+       0x66da08d52e2ca8c0, 0xac0a6fbb34d9e92a, 0x596cc78b52203763},
+      {0x145521ab8e88a471, 0x9bdbd48264bde8f6, 0x5a4d25bd01b4d2ea,
+       0xef1fc3626e7152ae, 0xd188389afba5462d, 0x951d4667f01d497c}},
+     {{0x294045fbbcc5466f, 0x145c2078039461a1, 0x21c890c82a620ace,
+       0x1ecc5928896d0458, 0x14130b9cd3f9fb46, 0xf001b3c2461506dc},
+      {0xd90a95e297a1b5c2, 0x9e37948edf6487be, 0x00ce787c3b165a95,
+       0x10d4f2a6e49c468d, 0xf0f26eb8acd25333, 0x25b513b063f3570b}},
+     {{0x98d089819bc5917b, 0x9f90885d187fac5d, 0x651b18287cfc13db,
+       0x2d606e4c8655a658, 0xba64d3c563c91b71, 0x36c7d7d8b82a5090},
+      {0x2d1dff02cab1d598, 0xa95788d7be78f90d, 0x1ac2ee6b0ea1fe01,
+       0xc100b60cd5c1273c, 0x4496084ceae603e7, 0x7fcaaf5f77c2fdfb}}
+    },
+    {
+     {{0xe8e3225a6abdd842, 0x8c85f18f3b367b02, 0xf147a4219f42edb9,
+       0x6d4bc00d0d411d4d, 0xa1a13a2770014bb4, 0xb896d97bfa10166f},
+      {0xb2a1dfa70c302c6d, 0x0a24bd5d808a63a4, 0x8409a3a2f88c7359,
+       0x071f3838347726a0, 0xd18a551c27507bb9, 0xe0c4cc34b359b167}},
+     {{0xa44f6ef880e9d9f3, 0xaa7621e91d14d618, 0xcb0e4ed80eaf6671,
+       0x2bf485f8181514a2, 0x74670e180a2927ea, 0xe1b5461612c14645},
+      {0x4068c0742a67ed61, 0xd10c7a57739063ca, 0x391b651d698b2816,
+       0xf310d1696da14fa8, 0xa089be6bd8a578b1, 0xa314b3a844389ad7}},
+     {{0x664ff05368ed0760, 0xc3cdc99138fae9fe, 0x3fe057aaf1f30a86,
+       0xbae990222d08c72a, 0x4f5faf3f6f09e13f, 0x44461a4413d26b29},
+      {0xc2504c1bf95418ed, 0x12766ea7db3ff26c, 0x2f956e9507a22399,
+       0x2716e70f5a00cdd3, 0x80c020140e9fba99, 0xbe587ac30519875d}},
+     {{0xba86aec170128295, 0x83a09b65c12f35ce, 0x8978ff0789df2f80,
+       0x85750cfd97a773d5, 0x806bb730fc3f35f6, 0x04503422fed868c9},
+      {0xdc0fcde086ffdbae, 0x8f4297e11860f43b, 0xfefb7d028d3ad6cd,
+       0x5c652b5997293550, 0x32e12942ed5cfbba, 0x06192aaf98800d22}},
+     {{0xccf0fb423c9eb0ca, 0x8703c6694aa03b40, 0x44c735a74001af07,
+       0x9616dd932e874ed1, 0x5c2e8520474ba621, 0xddf13cd3fa93d8b4},
+      {0xd68c9b4575df1b67, 0x4cd242288f80d389, 0x0f1a16bcc09f47fc,
+       0xc414dc6a9cd4842a, 0xbb0fa94f1f353c6d, 0x405124551950d073}},
+     {{0x935b9e244d2edd5f, 0xfeb46fb5efb287b8, 0xa51700a3f5018b92,
+       0xc328beba23864e2a, 0x113b5c9a995f70c1, 0xc0b11c22da1b5d51},
+      {0x9b99b907f4a360cb, 0xf4ee9995adf0b094, 0xf67c7cf2f94b3f0e,
+       0x664a51a1dcaf10cc, 0xa3709ccce937a669, 0xea97bace4862f098}},
+     {{0x51758334c942a3f5, 0x7cc01e8832182ba6, 0x772af25774de4fe6,
+       0xb1b3c448e9667bf8, 0x71cb27388079caf6, 0x48890c641d823a40},
+      {0x47a5887b0e9edbda, 0x916dfb0cbe089e5a, 0x3185090e1eb42ddf,
+       0x3c7eaa13b7f3af26, 0x940ed8c79e9963b2, 0xd85e77db3426ac10}},
+     {{0x162cdf342efffd95, 0x92111fdad59086e8, 0x4478d114454eb977,
+       0x8ce403d8dea38a67, 0xd459633b7435728a, 0x3a7be4e3a63b0504},
+      {0x0c74066b335dba3e, 0x4e8fb1d7c6ea6ee5, 0x3398b588a99690ed,
+       0x4949517c3ad77562, 0xf9824f09cbbb60ee, 0x9fdcafdf85660bec}},
+     {{0xf26bd8618875d9e8, 0x22e2380dbea9c273, 0x5f15183791995508,
+       0xb97f40a6648aa1c6, 0x7478f5f83977d848, 0x21e876ae35b57de6},
+      {0xf620b180a93fc7f6, 0xf49bd07e1b148996, 0xfb0857261c4f60e1,
+       0x6a6653af7ad6b84d, 0x913a2d022e05b686, 0x94746629407dda9a}},
+     {{0xb8465d16da684157, 0xdadde1abb238faae, 0xe2cd45e7c6b9bea8,
+       0x7251d4a15cf413d5, 0x615cea8baae1765b, 0x75aa831813f36885},
+      {0x7d5b0bf7b8767cc1, 0xec38a8ff8022968c, 0x034805b62a07faeb,
+       0x916f9eb033b7321e, 0x34963633c0c577ce, 0x8ee07efdabb8d3ce}},
+     {{0xa0bd6c0da8a29345, 0xc676b6c55d7f5ef9, 0x303b6d7c20ad7259,
+       0x06542a19d8fe09a7, 0x5a06653ca959014a, 0xf45fd79a5bcfe0cb},
+      {0x29058d984e583468, 0xf1bd25e60cd7afc0, 0x2a88246ef7dbe54c,
+       0x680eaff835e0ef3d, 0x5942c97f726e59b9, 0x43e971398d5c0825}},
+     {{0x2daddb11a406d4d7, 0xb02b5da5a2a33d81, 0xb73ce82721a6aa89,
+       0x10919587467506de, 0x0927724c428d8daa, 0x0ede991f7c17adfd},
+      {0x8518dab1bf7ddb3d, 0x04b091c42a54e1b8, 0x5943c37f89e7a398,
+       0x8e63f5e8e273f6f3, 0xc6d0352b83143d22, 0x30e43182ebd1628e}},
+     {{0x606658a99991167e, 0xb8773e1572c4b43d, 0x6cb364cde025abce,
+       0xafa58e9b0c5a653e, 0xa7e35a54134a68bf, 0xcb831d42ba4d9db6},
+      {0xae37348ede83ef97, 0x4ac64a6a62ddd553, 0x5feb5e0d715bb6b4,
+       0xf876efae043424b2, 0x7b56a291ad91a9ef, 0x817c7053356f3ade}},
+     {{0x3d6e8d6d8dff7dff, 0x6b6c194ad5be4ad1, 0x57b93f2db6fcd08b,
+       0x99f09948f3761f23, 0x4062f3d6ac8b018f, 0x4b58ac05a27af72c},
+      {0x4abcc81504d0cdfd, 0xa50043e0bda4b02f, 0xe11297e527a9c083,
+       0x2b2d8d529779c5b3, 0x3de3d330dfdecfed, 0xfe2487caae7fc522}},
+     {{0x1c2fc5088f7a83e5, 0xa7c56233b9970c92, 0x949c71738bafa66f,
+       0x1e299b2d5bbb0490, 0xb9a79e7c18fcb9e8, 0xe6372ce69cb5cc50},
+      {0x114fc628f465c6aa, 0xc55395208cb797f6, 0x7df94ed7a73ad211,
+       0x41eb8e1f8e0cd008, 0xb028725a004cbb0d, 0x1340186d372c1656}},
+     {{0x4074ee27978029bb, 0xa9394bdabae0d0c0, 0xaa01d53972cecb4b,
+       0x4b0cf1279a7dd9c4, 0x3e3e3f165bc787cf, 0xdf48f7e1942de53f},
+      {0x0cc69719567b9d0e, 0x631e33158d0d2750, 0x9fedc1e292314a09,
+       0x7547d22614a1adcb, 0x405561a48662b86a, 0x149fa2b1f5480b7d}}
+    },
+    {
+     {{0x923d0b44bda4aaa7, 0xced14ce4fee29f7b, 0x1656be009cf5b87d,
+       0x13a37d0d1d61103d, 0x1d705880fb652393, 0x870a31bbed712ed8},
+      {0x15ad02e6ad7c21e3, 0xf004e447c36c2831, 0x56aa376cba2b3ffd,
+       0xc3be2b2f9745443c, 0x47c8a870eb903660, 0x976c303e6c6c192d}},
+     {{0x148bd39cf4fb80d4, 0x469b208cfff04e65, 0xf397fbe2ce548415,
+       0x441e5c2c87fdde9f, 0x6366b49ffee9c179, 0x38d02bd32938dc71},
+      {0x26d450fac49c5444, 0x4569f95d2b23d3d7, 0x5f68bf4d298fd876,
+       0xe86df047544768b6, 0x40b69a32f8491267, 0xcbf3adf9f917c71a}},
+     {{0x32498d4d8125489c, 0x965e8d07a5a46ae0, 0x6cea5e47e96a7e29,
+       0xf78293a4668039ff, 0x62548a96f63edd32, 0xe8e6af95a83e8256},
+      {0x76e60c3b0db6263b, 0xa1ee4b0621b3d668, 0xa17dbf8b9e49b0b5,
+       0x4b29ba127eb366fd, 0x5e0ed781d29b565f, 0x8cb50d53199b36f9}},
+     {{0xa66c703529aa3150, 0xd038a5ab479e61fc, 0xdee33e96b5ab5410,
+       0xd068929c7c57d123, 0x0839a208f1d6ad37, 0x8f523dab123f8178},
+      {0xb3e5e524a67d3840, 0x88bda75e52eb59df, 0x513a0ab7389f2dd3,
+       0x3197a145890bba6f, 0x61add75b6f66bf09, 0x5c9dfc154eef1722}},
+     {{0x66dc285007769b1b, 0xe07fb7414d71fac4, 0x5ae688a6c2abbe60,
+       0x08ae92fadcbfd296, 0xbc291256b43044d1, 0x0e1d71ed9fcdf213},
+      {0xf0c5b28102485685, 0x5d3f9302e3f68f42, 0xbbbfac50ffe4f036,
+       0xb5b5f26174fdba44, 0x4ebe1d070d746760, 0xbb0f7812c37f04b7}},
+     {{0x810b6ab36df1199d, 0xc229308bb4f293b7, 0x3cf838dd89897750,
+       0x3e391e4e7a336c9a, 0x70148337176f89c0, 0x54b15bacbc4f1e22},
+      {0x32b104f92c0f2885, 0x2c39cefa67034f2a, 0xb8310437bf178ac1,
+       0x722299f5c99370d5, 0x0a493cf0332b93a8, 0x00e0ab41a420f719}},
+     {{0xf25925434cab24da, 0x52be9bbce7c3b9c5, 0xaab7a8b64660d1a0,
+       0x09738b819a9600f4, 0x58f0c86637de9e3c, 0x0aea5cc15db31f4f},
+      {0xe480406f499868be, 0x0d8fc7f0f6913a44, 0x7282364435f2e14e,
+       0xb147b31045e37a93, 0xb1e7aa5bf15c1af7, 0xa8685068b03e7713}},
+     {{0x21feb7fc21c34c2b, 0xab6a553addb0140e, 0x03a6557624b04e6f,
+       0x2531f186342cb0ad, 0x088c4d54a24f6426, 0x9a0ee15c06a873ea},
+      {0xdbe0253fd33bc748, 0xdad3339f5db8ac9e, 0xeaaf368173e65901,
+       0x71f1fab2ccbfa504, 0xb7b845224b0e163e, 0xe0fca8373c779f3b}},
+     {{0x710988eb46baf373, 0x8cceb935b57d5018, 0x1864603fa45fdf17,
+       0x3dcaae73ef48e6d0, 0xadd9420b590322c5, 0x947783e39b135f67},
+      {0xfde763688bf5049f, 0xf00e4c182caa4023, 0x4d3b0f23d355b3d6,
+       0x181fabcc20d5799d, 0x29499b40ab2ad0af, 0xf6e66328f9a938aa}},
+     {{0xcd7b3c42bcbe922d, 0x2fe02b3b95dd1a5c, 0xeb66bcbd24ef5c38,
+       0x7edcc21ce579c309, 0x7b19d49116f6c900, 0x36019ecdb6317c2c},
+      {0x554ba55391d9001c, 0xa5e30b9814f31e44, 0x3d1fe33bffda4032,
+       0x5dfec4782306675c, 0xbe59305e000c91e7, 0x3c4e52a325a6b879}},
+     {{0x02fcc14ec5ea88ac, 0xca29bb6d56d093b6, 0x876aeda90e6fe94d,
+       0xfa11a142d7225a9d, 0xfea3ca053d03fed8, 0x435854c6c54d5962},
+      {0xd770737454a6dfd5, 0xb8960017a3e55d02, 0xd4015a0c04d65c3e,
+       0x397f93d1e98a1204, 0xb0efa2e55f3ed850, 0x18f244698a3ec67b}},
+     {{0xa35802f5d62cd9f9, 0x0ca9c15d4148436e, 0x261a991d472b9d21,
+       0xd81a1ed6a2f8e875, 0x942f213a699b6d63, 0x041a12fc0ae57758},
+      {0x61191c82bd70aabb, 0x3776eb8bee4c23b3, 0xabe23e8652511222,
+       0x66dd967d30dabb91, 0x77650c597ed27424, 0x08ea2ebdab25a050}},
+     {{0xa410ba3ab6cb5a02, 0x6eb40d15d07c5c6b, 0x0de81e9107dcc811,
+       0x996f46eb2631b7af, 0x5a350ba75b7a22f3, 0xf42b24e7634159af},
+      {0x07bae0abc30952fd, 0x3488cda2d644e0b0, 0x23ae40d0e2111e12,
+       0x650af54ec80cdb56, 0x0f33a30b7d4aa2a8, 0x4e8d3e98442a00e8}},
+     {{0xa624ab3759a8bc95, 0x4b7e3fa61c971228, 0xe8229c4273aa694b,
+       0x0cc31029779288ab, 0xf8eff30f57575e0e, 0xee5e01947d52803e},
+      {0x32d87e558a78f632, 0x48a06031e454904e, 0xaa2cb8dd16c6e626,
+       0xadd098ac2c140452, 0xd25f285d2d3031b1, 0xfb5fbbe175b59543}},
+     {{0x2297041fd7a21503, 0xfe7738c2657f03f0, 0x994a8deb168fa34a,
+       0x0c772e02a53c4fdb, 0x67f835d150124cd3, 0x0e0d26356993cbbe},
+      {0x9857ed845257f11d, 0xdc23a728ac556942, 0xf0e1bb29deb32a7f,
+       0xb8c3c43fee0d70f4, 0xc294b0efc60ad214, 0xa4d438dc679067ca}},
+     {{0x520b0bb905c755e4, 0xa2c2c59bf89f0048, 0x85c1c73a73c23975,
+       0x6e4dec49783aabba, 0x69f0c69bb0463155, 0x61a42b949c97b17b},
+      {0x55af24a945d331a3, 0x4b0e63f8f5fe81fd, 0x4034283d708671c4,
+       0x200ddab35fd9001a, 0xe45f28e4342eaf3b, 0x3e8375b41ba936c4}}
+    },
+    {
+     {{0xb083ba6aec074aea, 0x46fac5ef7f0b505b, 0x95367a21fc82dc03,
+       0x227be26a9d3679d8, 0xc70f6d6c7e9724c0, 0xcd68c757f9ebec0f},
+      {0x29dde03e8ff321b2, 0xf84ad7bb031939dc, 0xdaf590c90f602f4b,
+       0x17c5288849722bc4, 0xa8df99f0089b22b6, 0xc21bc5d4e59b9b90}},
+     {{0x6f57752951c2bb65, 0x4a0c1c284b874bdb, 0x19a1842778b96c6d,
+       0xa674f9922f593505, 0x5abeeec46b7209d6, 0x42d15d0147cf5fff},
+      {0xe24509b7b49e3b4e, 0x81be939c639ee6e8, 0x7f7daf595761e8e3,
+       0xed5cfcb8d420a288, 0x365b29eb7a0ff696, 0x7d14680599a1ac8f}},
+     {{0x4936c6a08a31973f, 0x54d442fa83b8c205, 0x03aee8b45714f2c6,
+       0x139bd6923f5ac25a, 0x6a2e42bab5b33794, 0x50fa11643ff7bba9},
+      {0xb61d8643f7e2c099, 0x2366c993bd5c6637, 0x62110e1472eb77fa,
+       0x3d5b96f13b99c635, 0x956ecf64f674c9f2, 0xc56f7e51ef2ba250}},
+     {{0x9ee1ec3aadcdaa68, 0xd98c498fdcbb6548, 0x32b9737588102ac0,
+       0xdd296cf9c08527f4, 0xb74f8145fae3dfbe, 0x84131eb96cd7cc4f},
+      {0xa0f2fe7a927ff15b, 0x6b0ade4deee1a4b4, 0x6e7df2d40eeb90a7,
+       0xe2f46e20be4de684, 0xcd28feba3fdd06bc, 0x8e4205aee6d6d9f6}},
+     {{0x246ffcb6ff602c1b, 0x1e1a1d746e1258e0, 0xb4b43ae2250e6676,
+       0x95c1b5f0924ce5fa, 0x2555795bebd8c776, 0x4c1e03dcacd9d9d0},
+      {0xe1d74aa69ce90c61, 0xa88c0769a9c4b9f9, 0xdf74df2795af56de,
+       0x24b10c5fb331b6f4, 0xb0a6df9a6559e137, 0x6acc1b8fc06637f2}},
+     {{0x9ad73168f4a59550, 0x2a488d698409d7af, 0x9e946c2d30b3a5f4,
+       0x7bc4ced7c89723d5, 0x79f514a1bd31f607, 0x7d493f593a274341},
+      {0x7eb01027d45d55d1, 0x63f7690914735d1e, 0x718d760f35be21cb,
+       0xba58160b7c793331, 0xfbc0ce1f8d30d29e, 0x4645c0c2c6f4b03a}},
+     {{0xbd8c086834b4e381, 0x278cacc730dff271, 0x87ed12de02459389,
+       0x3f7d98ffdef840b6, 0x71eee0cb5f0b56e1, 0x462b5c9bd8d9be87},
+      {0xe6b50b5a98094c0f, 0x26f3b274508c67ce, 0x418b1bd17cb1f992,
+       0x607818ed4ff11827, 0xe630d93a9b042c63, 0x38b9eff38c779ae3}},
+     {{0x35d47426f78d33ef, 0x4af25db28440c42c, 0xbd6a15e22e91bf5e,
+       0xe366a84cc08b6b1a, 0x759c122f55b97de8, 0xecec558f08a03f29},
+      {0xdcc9fca2ea9d2060, 0xb3e49b8e9f361fe1, 0xdeae39029b59cd04,
+       0xf532ede06f5e5bd4, 0x84fbeeb936099f4d, 0x73576b1f088d2052}},
+     {{0xe8767d36729c5431, 0xa8bd07c0bb94642c, 0x0c11fc8e58f2e5b2,
+       0xd8912d48547533fe, 0xaae14f5e230d91fb, 0xc122051a676dfba0},
+      {0x9ed4501f5ea93078, 0x2758515cbd4bee0a, 0x97733c6c94d21f52,
+       0x139bcd6d4ad306a2, 0x0aaecbdc298123cc, 0x102b8a311cb7c7c9}},
+     {{0x2b85dd03139a9f83, 0x02740ec2f55cbff9, 0xdca3616adc3bd5f6,
+       0x52843de5a5da9b2c, 0x7ee7890a1e22c1cb, 0xd5cf15114aee5c76},
+      {0x86d70af0c7234c24, 0x1735378b6b6a709f, 0x9989ed21423f32e5,
+       0x4675a4ffe739b1fd, 0x873edb62304ce529, 0x60b6624a7f1db13e}},
+     {{0x22a28e59faf46675, 0x1075730810a31e7d, 0xc7eeac842b4c2f4f,
+       0xba370148b5ef5184, 0x4a5a28668732e055, 0x14b8dcdcb887c36f},
+      {0xdba8c85c433f093d, 0x73df549d1c9a201c, 0x69aa0d7b70f927d8,
+       0xfa3a8685d7d2493a, 0x6f48a2550a7f4013, 0xd20c8bf9dd393067}},
+     {{0xee43828c6b512bc6, 0xf73dc9f550b91e60, 0x68f23f30f5dbde6b,
+       0xaf2fe9e3ddd15e00, 0xfbf34dae86578d49, 0x689796556c130010},
+      {0x137a5fc309942897, 0xff1f0bfe9959f06d, 0x2dd0a04abd7ee14b,
+       0x59c46072e54e2161, 0xf470bdaeea7518ad, 0xce556e4340c471cd}},
+     {{0x4ec874ea81625e78, 0x8b8d8b5a3fbe9267, 0xa3d9d1649421ec2f,
+       0x490e92d9880ea295, 0x745d1edcd8f3b6da, 0x0116628b8f18ba03},
+      {0x0ff6bce0834eadce, 0x464697f2000827f7, 0x08dccf84498d724e,
+       0x7896d3651e88304c, 0xe63ebcce135e3622, 0xfb942e8edc007521}},
+     {{0x6b97dae4829ee0c7, 0xcaaad7e3f274bc7d, 0x87bee424512f7d86,
+       0xb5a03e5b3f7b0dde, 0xc29db9c1f9fca5a8, 0x538a6f8bede64af8},
+      {0x0e518ba88b3c715f, 0xc1cb4c313cb5b861, 0x5cd61604c76dbfa0,
+       0xc557e50dffdac22e, 0x7892fc51f67b53e8, 0xa42f85c1ea7c141c}},
+     {{0xbb155a66a3688621, 0xed2fd7cdf91b52a3, 0x52798f5dea20cb88,
+       0x069ce105373f7dd8, 0xf9392ec78ca78f6b, 0xb3013e256b335169},
+      {0x1d92f8006b11715c, 0xadd4050eff9dc464, 0x2ac226598465b84a,
+       0x2729d646465b2bd6, 0x6202344ae4eff9dd, 0x51f3198fcd9b90b9}},
+     {{0x2ba8c79022b25f2e, 0xf4670a511af0f4a8, 0x6842f36a2fc2451e,
+       0xfc5c9558bb91e1e3, 0x035d1dfcc3ead762, 0x3d0721cb031e5556},
+      {0x3af0cc813af18a2e, 0x7888cee2bd11a363, 0x80c3de0a6ade1d12,
+       0xe8c3a5bd93b2dcb5, 0xe3adbd7c90a2214d, 0xfe8646d51192948d}}
+    },
+    {
+     {{0x65026297ba958101, 0xbeb4adf98eef151d, 0x623763a460c8bbf7,
+       0xfa8f5ad78b2a7120, 0xfd744bdf085497e7, 0xf9b6f97e2ba35618},
+      {0x0cebfe9df8a15e86, 0x47a6d01329576088, 0x655817a3fcf19627,
+       0x30ab44f7c2f11261, 0xbb001c9dddf2c850, 0xb45c7eff073260c3}},
+     {{0xfa7d1236e2319f38, 0x9ba1a1c0a551d3fe, 0x9ea27288beb1282b,
+       0x1c069efa07fee8a9, 0x5749c7b55870fee9, 0xbedca76fafcec6fa},
+      {0xa3f8f1b14c63c5e2, 0xaa1bb15694758ac3, 0x753329a9b59dc06e,
+       0xfa8e5f5b98a92c38, 0x6b6f46fd3c2b4662, 0x716f41a1ec04c6c6}},
+     {{0x0430af7759b11c7a, 0xf71cc5b1d4f47aca, 0xe1a7905f12e9190f,
+       0x1c689b7012db9e14, 0x6bdd3dc90abaeeac, 0x97f1c244504f0319},
+      {0x874afd61a7a54b51, 0xd4604ecbe3d979b8, 0x0d33eee1ebf4aab1,
+       0xa3631cac1aa49fe6, 0x0d8340fbf2217cfd, 0xf6373284423b7e77}},
+     {{0x78a53b5a9563e3bb, 0x19c75eb286af355c, 0x3520f427019a6f8e,
+       0xde6fcad6dc3ad0ba, 0xfec96e4f79745b7c, 0x5e566bbdb133f2dc},
+      {0x50088a2b26561be7, 0x16275b4cc5fddfc7, 0xf21332ff23ae4b9d,
+       0x8cbc659e85246712, 0x27fa9c8df50b515e, 0x25ecf745494ac8b7}},
+     {{0x437b7224641e3bd1, 0x84e39f7980a58460, 0x68e5292709759523,
+       0x0176a3ace77f5904, 0xde92fb15e151e242, 0x79965c9aeb1438d4},
+      {0x318a810a596700b9, 0xa8a6ec57c2198cbe, 0xd7709aaabf030fd2,
+       0xb432023472f5d326, 0xc9945214b03bce50, 0x0bc06d9bd4ecba09}},
+     {{0xa1972c2196fffb94, 0xbe04093099d7633b, 0xb116ff407e23d66e,
+       0xcb12b2bb949a19f1, 0x75df10ee79e49e91, 0xa3bf90764890bcf4},
+      {0xcbaa76a609a30252, 0x17c224a90ee5728e, 0xcbc56e5cf4f3f4cb,
+       0x8a07110f4fe868a5, 0x23289f2125e110a2, 0x0289c12bd7693c45}},
+     {{0x06ba6db1f184c91f, 0x3c0a348a45fd0382, 0x0d535b6e4434b527,
+       0x7bbfa2c8692bae0b, 0x5c59a08ebe7fe51c, 0xbaa7d2be36e80cb8},
+      {0x8a42d8d1bed3cae8, 0xd9e0bc0d15ff4962, 0xe51fce93644c75ff,
+       0x40222561b9392d63, 0x8ab1d286023b4787, 0xfa85c220a1b3190d}},
+     {{0x298647532b0c535b, 0x90dd695370506296, 0x038cd6b4216ab9ac,
+       0x3df9b7b7be12d76a, 0x13f4d9785f347bdb, 0x222c5c9c13e94489},
+      {0x5f8e796f2680dc64, 0x120e7cb758352417, 0x254b5d8ad10740b8,
+       0xc38b8efb5337dee6, 0xf688c2e194f02247, 0x7b5c75f36c25bc4c}},
+     {{0x1213a2fc938e2480, 0x2dff0ea8ed7b85a1, 0x4f280c740cc9619f,
+       0x3a215bc566678817, 0xa51602ca327985a8, 0xd691692010f02615},
+      {0xd01274aa3dc4f2b6, 0x40feccd73ff804d1, 0xe508a27ca2100fa4,
+       0x37cc757ed90cc776, 0xaec4884bb74827c4, 0x0c9045824ac34a27}},
+     {{0x6ad3f9d3f761baaa, 0x3936d0d9a5ae6088, 0x54d5bff083a0dd41,
+       0x418c4b2070cfa7fe, 0xdc4d4742892317fc, 0x1248e2c0265359a1},
+      {0xa14ee83c2120ad82, 0x048b7b2789260c26, 0x637e71d5b5fe2775,
+       0x849213d5f3e08f62, 0x8a8a2da85a9faeb1, 0x57047761ef96612f}},
+     {{0x7608efa7027a3ba4, 0x14cb67adcf450422, 0xc55a7aae5330ef70,
+       0x3f18a78d64901358, 0x264d3a5cfeb668df, 0xdc0569c0bcf7c23b},
+      {0x93af8a9b6ae18907, 0x55dd3e3a24b8e961, 0x1c3fcd3436171692,
+       0xfc0ab80c2f1f7ca5, 0x0dadc166564878a7, 0x7d20d34b000d81f3}},
+     {{0x0e8d03f8b19231b4, 0xe4498dbddcda852b, 0x9963a6bb31a8dddb,
+       0x80bfba33d949c6cf, 0x72e483951b6e1ab7, 0x35a2a80282d7301d},
+      {0xcfce9b9101edd784, 0x794ab50ecd9bcb9c, 0xe1f90e0cf465c3ca,
+       0xb7ded4b5902b1b57, 0xe593dafc8a8c27b4, 0xa80faad46f940ca0}},
+     {{0x5396fd32421e65d3, 0x6c826fe215e91d37, 0x14c80f4a3cc3d9cb,
+       0xdb760a1343028c7f, 0xd7a541bdce1a3e42, 0x4726a5b7b81193f1},
+      {0x5c96916df004d745, 0xc86961c0ad031ec3, 0xb5a73c58b8d28a4f,
+       0x9a7bcb0e7ed16163, 0x3f6871f32fbd18f5, 0xebef020a42155e84}},
+     {{0xce6c810c4cdd5d8c, 0x9fc290a4078c9bc1, 0x84debffd96d47e78,
+       0xf291d301143590fe, 0x7cc5c36d69111f3a, 0x3a2cdc4246311370},
+      {0xd3d8bb989e6f14a7, 0xfeb97d41481e22db, 0xe1e20cfb462748fe,
+       0xcf8f5dd0a2eaf3c7, 0xb4f9acd4302a52d4, 0x1c154dcd8d715c96}},
+     {{0x5f492236b13ddc9c, 0xc930fb0ebabe466c, 0x21daa0b95c017d52,
+       0xc182a975ea9a6c9b, 0x45d3d6c04fd839af, 0x9e4ce10a3d89b744},
+      {0x906af5403a947f16, 0xa0f8e1b7a377f4f3, 0x268360cce343d7c1,
+       0x66fe9eb7bddbeb1a, 0xf5c80368c3bafefc, 0x0e183ee06664d04e}},
+     {{0x36c9dbbefda8520e, 0x573507ce6ae3ea98, 0x1ab38db696a8f9f1,
+       0xe031d2356b01e6bc, 0x10466ae68afc4ada, 0x3b35df41ed9c44e4},
+      {0x61272c12c7bd99e8, 0x6a4ae7b4805afd79, 0xf4c47a910ecc49eb,
+       0xeb95dfeccbe84d5c, 0x43f3b71c8ee497d7, 0x2547af524c6fece4}}
+    },
+    {
+     {{0xe323ed0cced45039, 0x04ce0b67a90aa713, 0x9c092f06e8d68e4e,
+       0xd8f5555ad0742e5d, 0xe2d175bf00d3df92, 0x8ca55f154f71aeab},
+      {0xd1762d72642d391d, 0x0dfdd3c2aec466bd, 0x2caacb4c6281f2a7,
+       0x635ba4703603e53a, 0x94a9811d49fecf29, 0x3a42cf09466bf361}},
+     {{0x0f05710b11bccf2f, 0x7113085a7aec1bc6, 0x137da67a46b8d0e2,
+       0x454b89fc698b78cc, 0xf2a6e1de258a9393, 0x5f1804e716488e69},
+      {0x7c6c550215b3bf35, 0x3b0e09a5b05c2ec1, 0x4b9de30e92f15247,
+       0x09d4ca9327e70a0a, 0x9c8b16340d149363, 0x54a8287cce642137}},
+     {{0x49ecd6f3346a764e, 0xe46847f14105e657, 0xce9cb2b57550f608,
+       0x45f1a1f7f4cf062e, 0xcdb19a112c27d38a, 0x36d375b284e50b19},
+      {0xf43691540dba6405, 0x4c9dc863040354dc, 0x7229e70ea24d09cf,
+       0xe72aa86c7cf6831b, 0x487fb68425392838, 0xe88bed04430b9b47}},
+     {{0xf8a8499b666fa8a8, 0xd0f9401571bba84a, 0xb85e1b1d515e1328,
+       0x88a2636ba941e788, 0xa045241d2b5dd8d8, 0x161be476332f0350},
+      {0x96c4b205a18fac6b, 0x5cbe8d5e73fc5337, 0x6fc33fc6d00b6029,
+       0x07a914ee89aa3b79, 0x35353eb7a4d4dd00, 0xc026bdc0673e8956}},
+     {{0xccda372167103852, 0xf78d22470c54de53, 0xebd16036afa44aa5,
+       0x7b88024864a24ab9, 0x86b38e961c2bc78e, 0xd0aa0d058d63b295},
+      {0x24912955c62fcbf1, 0x77a68156b9ac435c, 0x432401c71b360b26,
+       0x091f19f34c58ef8c, 0x3a4a61f483d46c9d, 0xad0e5c72e8d616cd}},
+     {{0x33b029bccdaa6831, 0x2548552d4c1f9ced, 0x35f1a002dece1c8c,
+       0xc6b87fd7acc23aa5, 0x0b8bb275bab029a4, 0xf07bc06730bfb42d},
+      {0x1688ff5d1f69ce9d, 0xeedb7b5edb10585e, 0xb7a88cf0d432c197,
+       0x20731bdd015a350a, 0x5fa1835463223f5c, 0xe392e1318024693f}},
+     {{0xdfaeea0a0154731e, 0x9e53419de15a0388, 0x2ad6a83c25a992c8,
+       0xa2ba020fe125501a, 0x894ebaf8d4dd04dc, 0xd48cb95850765559},
+      {0xf9b58d0980dec92b, 0x2a0e11659da299d7, 0x3c081853efe9cb11,
+       0xb9f3b702a511c5e0, 0xa8f7a25f70486180, 0xc0358b25591b3e2f}},
+     {{0xf36e8398eaddf274, 0xe41553a16a5e4ddb, 0x36ab07464efc5b0c,
+       0xb211e59ad316c434, 0x2515ec9f16ccf839, 0x6ecb746503dc6a07},
+      {0x842b7275c65c1b07, 0xf7ceeec535750ab6, 0x967d711ccef5255d,
+       0xcd3bfb075108cb92, 0xe50c0d8aec1b9740, 0x9e8d56611a9e6308}},
+     {{0x84f8ea13ccb8a36a, 0x5f7aeeffa05709a2, 0x4942d04e60574f37,
+       0x855b13e9e048b400, 0x747e4067a6b59c09, 0xc349fb05074d3990},
+      {0x398e6afaec2c7e03, 0xce361865ec2d5a4c, 0xfc04bf8eb6f57d22,
+       0xf0e0b84c759ce6c6, 0xb65141235ee7e528, 0x8ca144bdf5c0f9b9}},
+     {{0xc1370daef6a58536, 0x6f2e5b37c56b0ae9, 0x5511d68292f6b6a3,
+       0x2e9e5034ae575249, 0x3e5a32f81d14bed7, 0xa346a86f75efd17a},
+      {0x4f2510a60309fd7a, 0x689ecd74d0b1425e, 0x9e9bebe19f771e24,
+       0x20188045adc5b48c, 0xe49811b6b845230b, 0x420855ec5a8687f8}},
+     {{0xe650e49abae1b94d, 0xb6b162e6e3199794, 0xdc706859b4ec0480,
+       0x28b618c24b1a06ca, 0x0929a001403acdc2, 0x796dfd972da3aefd},
+      {0x16389072ef4c1673, 0x600d8bd7fc94a4f5, 0xf003214de5f386a9,
+       0xa7af0499e62cbb48, 0x750a3b00de82bad5, 0x6c615b838e7dc8ee}},
+     {{0x283eec26d71543a6, 0x98fa08bea7627841, 0x269a83b827ad302d,
+       0x225f2f12bde3fdd0, 0x046fcf380130b3a6, 0xea733c1ac3ed9043},
+      {0xf870f14d70aa08d1, 0x643d18b834391e0b, 0xf3e1d5f4847be772,
+       0xa9498223d0ed73a0, 0x6933ccf014b3babb, 0xc2439ae437f08f70}},
+     {{0xb643f4e0f88d049b, 0x5e0ac1fb12682fcf, 0xeaf7874d9f981c8f,
+       0x9c2adfd2b1af779d, 0x9a7abeaddaa8c275, 0x09ad552124cacec4},
+      {0x069cd5c40ead1646, 0x5186bf190a6157d1, 0xcc222a9396503506,
+       0xfeaa7bdebd29686e, 0xb0d65b0da7257c8d, 0xc31c0a8898aa227f}},
+     {{0xb4b7651f5be1d45b, 0x0425200a7f0cf680, 0x200d12b48960be95,
+       0x02fdd1a14945b193, 0xedd70e3e27d046d8, 0xc1cc086a83f14e12},
+      {0x1580e72b2629396e, 0xc87439dbf9ed73c1, 0x5debdf30a90c5128,
+       0x0b6c020e9fbe14ef, 0x168da56a0149a0b0, 0xc66a4dbd79c58ac6}},
+     {{0x800aec84330b8e2e, 0x1a2c033e335837bf, 0xf1a91551fe6f6dd9,
+       0x326c42b21de7360a, 0x300e740b7b66f9d5, 0x53bcc70068ce95d4},
+      {0xc9e225ac3d80f228, 0x64b2ad4e6977dfdb, 0xac863b0801f23221,
+       0x0517a648df11e5f7, 0xbf7aedcb68d11050, 0x2607e33777b3029c}},
+     {{0x1afa6aa6206add5d, 0x66cfbbae150ea4c9, 0x07fb920b5d36da4f,
+       0x144d51f9291e774f, 0x26c2c134f40d87a8, 0xc8cf3524a932f1a0},
+      {0x35bb2a425aeb0bde, 0x5cfcc1dac4be960a, 0x5c40cabfaa1838ed,
+       0xea0c05ffe2855f1f, 0x931ebb02fd525934, 0x31a7b78f16246fd4}}
+    },
+    {
+     {{0xcd92906c6d6ae962, 0x628356159807d881, 0x0d6929781fdc1915,
+       0x45d01a8c269d611e, 0xe7bd1e709665b00a, 0x086385349bcaa388},
+      {0x8f189e882dd24299, 0x5f643392b82fb270, 0xca65bf16c633b111,
+       0xc6adc9c9d6f1dac8, 0x0df2c293a3c3381d, 0xdd6ae97d8388cd12}},
+     {{0xffdbd0eb3863db02, 0x8b8256832f57e10f, 0xc11acead35e7a3a2,
+       0x4998cf8c67833028, 0x8f3a346b844c7976, 0x0a9d872cdb9b1a1c},
+      {0x8735dabcb98d445d, 0x93790d80305fa0a9, 0x7c0add49d267a01a,
+       0x2b46c913ffa20d11, 0xf2acef26d8ab2d4a, 0x71b701b93d926080}},
+     {{0x7cae584dfbf536a1, 0x0af06fc25b52faa9, 0x807706dc2827b872,
+       0xf029478f59903742, 0x0e8c393c85cd7aed, 0x2e1e6adea331bee7},
+      {0xf5d13dadcdb7f97a, 0xdb22fed18577c3cc, 0x6f45318081e39043,
+       0x41d4bb25a00a806c, 0xe6064b92e28670a7, 0x733a31c8a7c63f88}},
+     {{0xe9d2a98a5133de8e, 0x37083b60b81b8b00, 0xf399325dceaf86ae,
+       0x03b17c888f161525, 0xd8ac35c984211b9d, 0x220837849050ca48},
+      {0xa818c44bc9fab832, 0x8882bccee5aea7da, 0x633aaf35f8715b04,
+       0x5463e1b99d8829a9, 0xb18df52d84a820f1, 0x9d5ef891d096675d}},
+     {{0x394174d0c2b47dd2, 0x06b117a830a87997, 0xcfd81d41894731e5,
+       0x6476b1afc84e7d05, 0x37069fe2743b8218, 0x93f21550a36173d8},
+      {0xa8ae70f4edadef86, 0xdac5d02176366073, 0x4063ba571c982076,
+       0xc3471b5f2d24d61e, 0x57b69c41ae4d820f, 0xf73e14a4c463a391}},
+     {{0xd54e2c7cac60496d, 0xc06d5e5d04cd50a4, 0xcb4105e8e60f7f59,
+       0x705db308427483ad, 0xf73ba98bf2bff383, 0xa945611a0220e6e9},
+      {0xc01c46b8d957e12b, 0x458897b7acb1f371, 0xf738dc0bfa3403e6,
+       0x098bc687d2202896, 0xec0c217a5f882e5e, 0x8f25af77a1f4eb13}},
+     {{0x86e6a8fc195736e9, 0x88099bf31a20620f, 0xf3d9998b9cdc1db9,
+       0xf36d583e47042834, 0xcd4519d825a0d589, 0x78c435ab1e04a91d},
+      {0x0428e76ee44d9e31, 0x63994993ce821aab, 0xd167ceb72625cfce,
+       0x9f2422450ddf2b89, 0x182e33d6717ffb5e, 0x3800290e26de205c}},
+     {{0x2615c78259ee4124, 0x4dc2824c76532b4b, 0x9c3b1d771c84a04b,
+       0xb6fc203fcb9f9e34, 0xbed65464c64f7846, 0x04f520a2eb004248},
+      {0x5c0177274a58fd22, 0x25958482c10d9472, 0xb78c6666aceb0e3a,
+       0x18d3c188fc046f0a, 0x7f3e2f301baa9595, 0xa574f8cd8a2844e8}},
+     {{0x9fd2e5244bcc5a81, 0xc73e2598d3f2f80f, 0xff838e9c15dc157c,
+       0x0b2491d2c522319e, 0x2b65f042909592d6, 0xf113045c849f5dee},
+      {0x84fe31be9b287c3d, 0xd048126280097bd0, 0xaf203cba63660f87,
+       0x5621c3d80ea001b3, 0x125a5eaa346ea29b, 0x3dcec22c3ca79649}},
+     {{0xc899eba381c2d81f, 0xb27267d6f3f0a431, 0x607c8629da55568e,
+       0x6b5472282b1dc1d9, 0x23232311c9c001ff, 0x207a2eb2488f8b85},
+      {0x3867ac9adac37a28, 0xa36d14d32584a5f0, 0x7398c647a74488ff,
+       0xf6ed920fbe087640, 0x72beddc76319a571, 0x55c2cd826a244aeb}},
+     {{0x42df56309ede92f1, 0xe6957bc476503aa7, 0xe7abfe12fbec9577,
+       0x9660e762274b7f6c, 0xf78af22c35f12ea2, 0x73ab1bbbb51bec2c},
+      {0x5e8e40e61641f424, 0x1af751d90905e4be, 0xb5130ade1c033198,
+       0x96d47ab2a22f5f19, 0x5aff3e6655340d4c, 0xab4aa5a71bed65fa}},
+     {{0xb7da79c625f8a53b, 0x6b950bdfd331ad8e, 0x3481b7b54aa36d18,
+       0x6efeaf88ed0e3091, 0xeb017bddc993074c, 0x8431a6d6529dd654},
+      {0xf5177231bd069585, 0x6d753b103ce85096, 0x194d82d34ca26741,
+       0xeaeffe15adcd1650, 0x4dcec3d9af7758b7, 0xf5fdf6664cc2c819}},
+     {{0x7e9ad6e8ae850261, 0xbeb25ca011960968, 0x60c5f0eead4cfa42,
+       0x81714b3feca5c508, 0x810e71d7b78a290f, 0x03536cec3260114c},
+      {0x24d29f0f6a16cdf6, 0xec45a58a4a4c964c, 0xbaaa5fb3ea344b44,
+       0xf1b7a68cfeb783f6, 0x533c4b723ddd7062, 0x6a33a0dc1598b5f7}},
+     {{0x94bdc7f4a9810744, 0x464195daf045d859, 0x27e2dab0d654cb57,
+       0x1d4e1e537a491956, 0xa1ef570c31d5d099, 0x01cd21ee295f3de7},
+      {0x8681b00db8249038, 0x17c31bce93781b71, 0x4324e90c6a1b5748,
+       0x44f9324c1222e554, 0xe30ba10fffd53dd0, 0x2e5817a8b48eeef0}},
+     {{0x6b0ee06024b3a9a7, 0xcf78c3fed5f6545c, 0x050bedaafe0f2ec6,
+       0x0b7774b8b3e6b4f8, 0x096b9e192b4a853e, 0xa74636610698f7ca},
+      {0xe1d1d1bef090c97b, 0xbc1e09d955517a2f, 0xb3e24dd55868ee3d,
+       0xd6103494d7b83619, 0xaf7395593b0129b3, 0xef42bb603ded9fb3}},
+     {{0xa349bb66c8fccaa9, 0x7888755f31a53ee7, 0xa6e1d891c18d3750,
+       0x9985aa4dae8d2bfb, 0x8baec9ae31b33078, 0xee68295a98750e94},
+      {0x0d834bf8d6ddf305, 0xab33dff39762126c, 0x0c22faaa0c51d098,
+       0x32404042b887a10f, 0x31f6a614248bed32, 0x311f86301ce0d662}}
+    },
+    {
+     {{0xac6dbdf6edc9ce62, 0xa58f5b440f9c006e, 0x16694de3dc28e1b0,
+       0x2d039cf2a6647711, 0xa13bbe6fc5b08b4b, 0xe44da93010ebd8ce},
+      {0xcd47208719649a16, 0xe18f4e44683e5df1, 0xb3f66303929bfa28,
+       0x7c378e43818249bf, 0x76068c80847f7cd9, 0xee3db6d1987eba16}},
+     {{0x1238e097ae658422, 0xb4631ddb568df55f, 0x451254e7f74c5c50,
+       0x238b16d28805813b, 0x23987b28925e7a6e, 0x93b72e2d2a1a10bc},
+      {0x944c784d05e44b7f, 0x7d70fd098c8e3120, 0x6bf1ab2aead45716,
+       0xd5f8f0e631c04205, 0xac062526a10b8881, 0xa1a83cf0fe5505a8}},
+     {{0xcbbd8576c42a2f52, 0x9acc6f709d2b06bb, 0xe5cb56202e6b72a4,
+       0x5738ea0e7c024443, 0x8ed06170b55368f3, 0xe54c99bb1aeed44f},
+      {0x3d90a6b2e2e0d8b2, 0x21718977cf7b2856, 0x089093dcc5612aec,
+       0xc272ef6f99c1bacc, 0x47db3b43dc43eaad, 0x730f30e40832d891}},
+     {{0xac92ee1537d83369, 0xc968c187fecec65c, 0x29a7ca876e7a3265,
+       0x0f2b7e7a8456c9af, 0x7471824e9754326f, 0x498687bf364d2ec8},
+      {0x86d8aacd3c6ee351, 0x01ee6823f6f41e85, 0x9805fc881d79f7eb,
+       0x377ac3a40040547d, 0xd39215d461b4e90b, 0x2547416e4c5fd81b}},
+     {{0x9ffe55630c7fecdb, 0x55cc67b6f88101e5, 0x3039f981cbefa3c7,
+       0x2ab06883667bfd64, 0x9007a2574340e3df, 0x1ac3f3fa5a3a49ca},
+      {0x9c7be629c97e20fd, 0xf61823d3a3dae003, 0xffe7ff39e7380dba,
+       0x620bb9b59facc3b8, 0x2ddcb8cd31ae422c, 0x1de3bcfad12c3c43}},
+     {{0x03621d34f6e10789, 0xc72143b8410c4004, 0x886d00f66ca2933a,
+       0xd0a22382de1494a2, 0xb8656c4d0bdcdf82, 0x5199d9d3c4a58832},
+      {0xa982c1aae1c0f449, 0xe9cefb905a922bdb, 0xfc268de431390c6d,
+       0xea4160e18c4fe595, 0x6c427a636790d82f, 0xaceb0154fc519907}},
+     {{0x8c074946d6e0f9a9, 0x662fa99551c3b05b, 0x6cdae96904bb2048,
+       0x6dec9594d6dc8b60, 0x8d26586954438bbc, 0x88e983e31b0e95a5},
+      {0x8189f11460cbf838, 0x77190697771dc46b, 0x775775a227f8ec1a,
+       0x7a125240607e3739, 0xafae84e74f793e4e, 0x44fa17f35bf5baf4}},
+     {{0xa10292b907a6fbf8, 0x292c1a203fa6235b, 0x7a36f18f73ad7a1f,
+       0x8b2c7b0c5897b11f, 0xf7b9a272cb664c61, 0xb6d366af8f81e22c},
+      {0x3b99b2118e342bba, 0x03ce158bb06ced2b, 0x3af1175d001db74b,
+       0x526f08467159cb8a, 0x6a3c6e1febde4601, 0xfad5963b8c232eac}},
+     {{0xa21e69a5d03ac439, 0x2069c5fc88aa8094, 0xb041eea78c08f206,
+       0x55b9d4613d65b8ed, 0x951ea25cd392c7c4, 0x4b9a1cec9d166232},
+      {0xc184fcd8fcf931a4, 0xba59ad44063ad374, 0x1868ad2a1aa9796f,
+       0x38a34018dff29832, 0x01fc880103df8070, 0x1282cce048dd334a}},
+     {{0x21387e8a42a993b1, 0xbcb6553368b1f2a0, 0x3161d87aa5f7e4b9,
+       0x927b41301bce0a84, 0x3aabd32787be0ae9, 0x0163c6aa0aed169d},
+      {0xad1e0f0e11584051, 0x1ba4630274093225, 0xed0456180a6a1f01,
+       0x15d07c636da060ed, 0xa4584f72b7e003ae, 0xf6e6b7c4a02ec136}},
+     {{0x76aa955726d8503c, 0xbe962b636bc3e3d0, 0xf5ca93e597de8841,
+       0x1561b05eaf3f2c16, 0x34be00aad34bff98, 0xea21e6e9d23d2925},
+      {0x55713230394c3afb, 0xeaf0529bd6c8beca, 0xff38a743202b9a11,
+       0xa13e39fc6d3a398b, 0x8cbd644b86e2615a, 0x92063988191057ec}},
+     {{0x7150321974962b2e, 0x3beeaf81e1db7ec7, 0x702784cc445c4e88,
+       0x7aa583159baad7ed, 0x72b76e2fd044b38a, 0x35a2bb8f6a7f2101},
+      {0x5e6ae263a14c2bf2, 0x8fb614c034bb719d, 0x7949eeca5dcd7c65,
+       0xb198be587670aeb1, 0xb2238dfc93cabf25, 0x6a6d45551a422b95}},
+     {{0x787835ce13f89146, 0x7fcd42cc69446c3f, 0x0da2aa98840e679d,
+       0x44f2052318779a1b, 0xe3a3b34fefbf5935, 0xa5d2cfd0b9947b70},
+      {0xae2af4ef27f4e16f, 0xa7fa70d2b9d21322, 0x68084919b3fd566b,
+       0xf04d71c8d7aad6ab, 0xdbea21e410bc4260, 0xaa7dc6658d949b42}},
+     {{0x3ddea6d9f7848707, 0xc11260d06dbcf13a, 0x62c5ee60a16508f0,
+       0x4bdfa38fcb56535c, 0xd391e7864fa5a6b0, 0x173c3d702d4cd296},
+      {0x9c5c596f5fa3f53c, 0x77d395141ddd3732, 0xca1bb91da5bf4edc,
+       0xb23afd381cd98b09, 0x198248ed60bdfa0f, 0x559dd99cfb69a4b1}},
+     {{0xd8e958a06ccb8213, 0x118d9db991900b54, 0x09bb9d4985e8ced6,
+       0x410e9fb524019281, 0x3b31b4e16d74c86e, 0x52bc0252020bb77d},
+      {0x5616a26f27092ce4, 0x67774dbca08f65cd, 0x560ad494c08bd569,
+       0xbe26da36ad498783, 0x0276c8ab7f019c91, 0x09843ada5248266e}},
+     {{0xa54768dab1b43eef, 0x13e41f47e14fda22, 0x774df203faef6863,
+       0xf795a034bd7471b3, 0xf0958718b47de2e9, 0xc92f7888e1160cff},
+      {0x86ded97b0146c790, 0x015918f5480a4b7b, 0x05588920424e8459,
+       0x37455914eecf8b2b, 0xe7d3df1fb968a6fa, 0x07a0ffd6bad0719f}}
+    },
+    {
+     {{0x2566021f98d23f6f, 0xfb883e1234ca97ca, 0x34e047a5d9f51b69,
+       0x0b50d91df8efa646, 0xc2bbcbb2971f584f, 0x4136f0e40907c91c},
+      {0xa7ebeb0de735cc48, 0xa7d1bedce113c8fa, 0xc04d9a073f5c962a,
+       0x95c155e53ff74a2f, 0x923c65a53df0749d, 0x10d5f81227ae35d0}},
+     {{0xd5469c7becee6e87, 0x056180bc33a4c917, 0xf881ca21a16caa7a,
+       0x221de182e6cc7f39, 0x10d61ab531378723, 0xfb763bd9520c9660},
+      {0x145214cd0d6b1541, 0xd9f7ff2dd70223e7, 0x9fce59e30cb1fe69,
+       0x2e6e77fa3e299fe7, 0x3a0cf652d5af78cf, 0x50cc42c53e852159}},
+     {{0x0791dfa1df764716, 0x31bf68768c66da07, 0x49f25b77ccedf4f3,
+       0x05170ccd5d965c05, 0x37d9521bd49e6727, 0x1548251286a00176},
+      {0xdab444936c00eb48, 0x102c6b95e00c5c5d, 0x43660c3e4c2506ba,
+       0xb2fb26165ec6f132, 0xccc4221a99ac7691, 0x05b29758a576deb5}},
+     {{0x4a873076ad8c49b7, 0x891598ce7146575f, 0xc1d3042f427ea198,
+       0xdc592111ed259219, 0x0abdbd16234850ca, 0x26b9412643b6fe8d},
+      {0xd3c79d1736a1cfe9, 0x576386219a2b3baf, 0xa736535d5a98bf65,
+       0xacb3b7ddab2cdb2b, 0x37d3743adaaf89ee, 0xf19d9aba0b348532}},
+     {{0xafad01a0d93c54b2, 0x659bff9695536c49, 0x7b91aac2b9734c15,
+       0x55c7f08224e02f59, 0xebcb71e73a26e551, 0x5b7225f76c6343eb},
+      {0x021c48fb17d5e775, 0x57536a42bd859c87, 0x24852cc0ae2b63e9,
+       0x21515020c0ce0ef1, 0x2ac7336c8fed825e, 0x4bc87feea0152819}},
+     {{0xe7c396d64654712c, 0x1fa5ea507a26e994, 0xaa98768709012b83,
+       0xf1ef9792e9b17e98, 0x2c22bcb06dc2db10, 0xae42ddf6ed4be80e},
+      {0x672080f62e743405, 0xa15a7f975b7821d1, 0x0cd912f247adbf07,
+       0x6919c0dcb6c4ae8f, 0x62b13edd14c6253c, 0x66f35919f8032287}},
+     {{0x2713b58c9d628e1d, 0x3729960afaa8ba1e, 0xc3438130ab53bc93,
+       0xcef9eda5e9c165e7, 0x9bacd1c3fd02650b, 0xbb300334540ece72},
+      {0x21f5a5d3d9c4f0ed, 0x1ba32e4ff7c19269, 0x8f073beb2cf320fb,
+       0xb49766c45599646f, 0x68180d6649e4f200, 0x8203d8aeeaeddb36}},
+     {{0xa68295da2caf088b, 0x23d6439a5c8709fe, 0x8deba0cffe0c3df0,
+       0x5b4d037b3cd00a1a, 0xe9edc429aa0f9088, 0x6f5827e35847def7},
+      {0x9739d03d306ad966, 0x7c6b18afaed51d04, 0xdc3d34ff1759060a,
+       0x029e9aa9a7e94dbb, 0x2a3cdfa0f7e8b7f3, 0x42f87bf0bbd8f6f4}},
+     {{0x516f138bed210253, 0x5ec2fa324433461a, 0x0dbe2c66cdaf1280,
+       0x086b91e59fbf3318, 0xfb0223ee399a1ca6, 0xd6f86d9b0db5b20f},
+      {0xec02bca25752d618, 0x952fafcaaf69f3f1, 0xf304cb7533c4d294,
+       0x78085727dac65608, 0x22f302ef840a4466, 0x33fb889dc371c31f}},
+     {{0xaa4711f54f890542, 0x862421d9eba822c4, 0x2f667179848280fc,
+       0x4de16d87c201ed75, 0xd20e1399c5e61b5d, 0x3f7114b49ed67ec7},
+      {0x561fd4979b5a88f9, 0xb202eb86d84db2c1, 0x67d8fb90c8637d3d,
+       0x3d1d78a1032b1853, 0xe07bf775ef1af9ac, 0x691e1deea57d6ada}},
+     {{0x834701da3801c65d, 0x5bb35c48955aa27d, 0x0ef0f375db7ad387,
+       0xd25e337f06cd1d53, 0x757a1f9d90cd91de, 0x1604f153d61bbd60},
+      {0x6a01e8cf8bb95dc4, 0x34b7be6275bbdb13, 0x0a96b3a121e9b029,
+       0x25615c3b2946df44, 0x5eda7d1919d04842, 0x08317975fba84668}},
+     {{0x12474bd8a55a3a4d, 0xe326aaf19e471af4, 0xf201a9308caadaa6,
+       0x546821f835304341, 0x7fe452c3088353e1, 0x8f1ff628fc82566a},
+      {0x49526f46d99f8967, 0xb19c80c0a4009690, 0xeccf97591cbc0716,
+       0x2e13ae2caf4cbc8b, 0x12b0df13f32e29ad, 0xa2005d6e0b1565f0}},
+     {{0xdb891eedd06014e0, 0x69685d6103e9970a, 0x3a612db402838113,
+       0xc1cd7b3adcdef0b0, 0x612b299da41d6c1e, 0x982161ed0ed386a0},
+      {0xb36bbe2f3ea1bf1e, 0x0d8c3752ceb2a5ec, 0xc02cd7f6ec03bddd,
+       0xa87977c152631d9e, 0x7b546cc37e398d7e, 0x5b1218a804845671}},
+     {{0xfa3e43e56cb173d1, 0x2502258d4591b5a5, 0xae8c4b558ca9682a,
+       0x8cb1ffb4ec81a288, 0xd11ae888bfc84fd1, 0xa3b083a0d774577c},
+      {0x119b41c11da9afc5, 0x44bc77622934e22b, 0xa04694f37c639d6c,
+       0xd5e1ce5732c5b8ea, 0xd507c39b9749e8b6, 0x16cc0b5755255b63}},
+     {{0x71e5df78614f6f37, 0x5cf0e08da0b80bee, 0x1f8dae171e32051f,
+       0x54ae365d83bc233b, 0x97ea005b1b84aaa6, 0xf4766d9264c75139},
+      {0x9b93bbf241215701, 0xb18f042d8cf8a865, 0x5dfb96dd0867556f,
+       0xe9fafbb8597fd6a1, 0x729b2f50fe48bbc6, 0x2cf85f6b7f37ff9b}},
+     {{0xcd8c2ec9378ef62b, 0x7f4a3c5491a7c4b9, 0xe12386d4db83e1ab,
+       0x9a792032bb549bb5, 0xaf81cba62807c0f1, 0xd4ad7d87abf2008e},
+      {0x9d7a72307e9ad6cd, 0xb30636b08b517b2a, 0x47c324daec900516,
+       0x408cd0d37193eb30, 0x8f0bcce2d315c655, 0x540ad4e0869d6c22}}
+    },
+    {
+     {{0x4b5e753ddae0ff8b, 0xe55c83e4da3d97b5, 0x4034d75f42fa905b,
+       0x89b85edac33e462b, 0x31f413c3058de3bb, 0x66c01c806ba75391},
+      {0x3f500202373e28de, 0x5090b33b4b9be739, 0x7297aa10efa2addd,
+       0x3e8ccdbe1a6566aa, 0x4dfda07fd7b4f214, 0xa659bd1e7cb1cae7}},
+     {{0x31796c2387d11691, 0x02991ea2a9de506c, 0x4ff0cb716cb0c301,
+       0xdd0cdbd7d1702ca9, 0x470a26c8e1a02a90, 0xb705b7bad7054625},
+      {0xfadc2e86d4a1a268, 0x0fd9764668e9f923, 0x042b5ebb2951a8fe,
+       0xe4af9d0364197a76, 0xdd2c6bb3249c1b5d, 0x60af89bdf01932b1}},
+     {{0x4374145d41afcd64, 0x98b72d6049d21198, 0xc0ff394bdfde8a41,
+       0xed1112e5ee1ff7a5, 0x87a920e8cb5036fc, 0x437123f62deb225e},
+      {0x37e527afb9ad8c58, 0x3e3c9998abfaef38, 0xb656bcc550b2b4e2,
+       0xfacc8a193bf5699d, 0x98cec74fe616307a, 0x34af333dd3ef8bab}},
+     {{0x9ded9b0d744ec273, 0x5bdfe5472e79e4d5, 0x94f3aaf539393728,
+       0x22136862a438413e, 0x449286da373c7de3, 0xa709d85d29aa1540},
+      {0x1bd13e410284a4f6, 0x37b54d69f0799c8b, 0xd43b558f6bcd0cb2,
+       0xf5757c0e9e610369, 0x15c80b23c16e0651, 0xacb2cf64001820aa}},
+     {{0x0629e4ddeec37f48, 0x3f7556a2da7de716, 0xcacd8f27661662bc,
+       0x65d8bc2ceaf01690, 0x83ac66477c39c893, 0x353f60dbf59440e1},
+      {0x2597b0d6852c575a, 0x410885f73a40c2b3, 0x953ab3472fcc2488,
+       0x9f753e5eef4cc6d8, 0xfc32bb4d97f69e63, 0x461c1b0c87e8c264}},
+     {{0x2bea7e75ac4b62f5, 0xcf255dcdc6297871, 0xdd88db8781b25c72,
+       0x77ad90b3b617dc04, 0x65ee13820ed4a7d6, 0x4c08df9cd9644c8f},
+      {0x072d3784525a023f, 0x1aef69cefce399fb, 0xb07fd78ed7f29044,
+       0xa3754e1443043fa7, 0x97bdae92ff9fe4d9, 0xad63ba6a700fe6b8}},
+     {{0xa571929ba1ca17db, 0xce7a12f545e146b8, 0x39df1446d9eb426d,
+       0x1e48b3f8dc27f268, 0xa2d7dfa1ff548455, 0x750068b86ef1cc82},
+      {0x4d699306667fce62, 0x98540b9d131c5412, 0xf8a62cd347c580b0,
+       0x2b55460f73795005, 0x3206c0257b8db337, 0x2280934bd0dda5a2}},
+     {{0x10a8aabd2352478c, 0x599d9dfa1364c40f, 0xa009df1a076945a2,
+       0xf869152c03861f02, 0xc405226e9f866a3c, 0x93bd737d8b41ecbb},
+      {0xb5c9ed1033901eed, 0x90e4ce8f99312b80, 0x1a9ef22e57589279,
+       0x83ef607d7fe2d6aa, 0xf2da84543473dbfa, 0x14f36d3a57879066}},
+     {{0x2c780f220ea3ce34, 0x240a211e4b8aac72, 0x7a266e5dc2625a99,
+       0x1cb15d3e3b30c878, 0x8cd8ccab0e1b21d3, 0x53c64279adc1a6b3},
+      {0xe60d15b960bf708d, 0x6e431c1b0cb5ad4b, 0xec874c3e82033111,
+       0x88054a1d9141eae5, 0x98438a5addf53a28, 0x168f0b0ffa12c657}},
+     {{0xd621ce26629d7a57, 0xbf571de7cc1f8af1, 0x2c5cfaf9304adaa3,
+       0x950addbd3f283b49, 0x622dc27cee6d1cd1, 0x26d920041f0863fb},
+      {0xe243b2a2a41ec585, 0x0dbd9adf2bea6235, 0xcb083c4d6f0820f5,
+       0x809ecbafd5493931, 0x9647067414b7ffa8, 0x2cdfe22e53fc2224}},
+     {{0xc8b1333c7cd74a06, 0x7d5ac4dc271006bf, 0xe9377d9fc14e0e56,
+       0xaa8651db7a92ab1f, 0x77cee8145fc11fb5, 0x1e7c5ca027870b14},
+      {0xdeef4b3f6f959698, 0x7c59f26e5daa9bda, 0x4d0d5aecfd312368,
+       0x5247a6f3b738de68, 0x1c4e8ba990c04807, 0x0554b41bcce126ca}},
+     {{0x3df98ea9a81cc26a, 0x982ed56883b2c6f3, 0xc9cbd1b5ea6d6976,
+       0x3f9f23197e25ffbc, 0xbca8e0567da6280e, 0x7abd316635cda713},
+      {0x46ef321d740ae011, 0xb17f6c75db214a33, 0x37b73b4b51de4044,
+       0x5bccf3ccccd9ba8d, 0xa2ca080dd0f7045b, 0x79caf90668cf4dcc}},
+     {{0xcc3605a9a7b07d22, 0x4370eb18b4ebe4e7, 0xbe393039248867c1,
+       0xc8e4851ecb1a75ff, 0x215f3fbe39cb6da4, 0x6f2102eee41f9a34},
+      {0x61d484abdfae7c27, 0xf5143bd26f1260fc, 0xa70b6c067514bccc,
+       0xe71ca833d23506f5, 0xe2f50ba8eae03a8e, 0x2ac3b50883c33359}},
+     {{0xe94b930f3655cabd, 0x6ef6aac4a342443c, 0x2feb8005bae255da,
+       0x4625a15cac6e2095, 0x75c6311d0ec76c1e, 0x896a07409b81c6f2},
+      {0xbad3e2f9073378bb, 0x2984a10629266ec0, 0xa68a5351a788010a,
+       0x321aa113017cd052, 0xecfb61752f34db5c, 0xfe080cedca2b51df}},
+     {{0xba29690803360c88, 0x3fb087c036311812, 0xec5fb10ad9ff6a48,
+       0x52f7077f207dd8e1, 0x8e65cfb844c02fbc, 0x4f4fcde2fbf4bfd5},
+      {0xd1ff54156cc74320, 0xf989d544f68b036a, 0xafedc2db973bd9be,
+       0x7bdc35694785e26a, 0x0df36796751ae9ba, 0xfebde691ccdabd95}},
+     {{0x3499b44bc77488cc, 0xde000e01aa8f3c10, 0x30140406c1f517d7,
+       0xd4b3c8eb82a174e8, 0xc8835b13af2c9b3a, 0x2cd7626e443716f4},
+      {0x336c4f4b9c22de71, 0x9dd2b277f2529f60, 0x6ffba2dc828c34d3,
+       0x257a345c34d0d1f7, 0xbc1eff056ca4fbce, 0x05b335620768349f}}
+    },
+    {
+     {{0x5d7afe9a10fa53ce, 0xe2415b501ff49021, 0xe39a067dc6523492,
+       0x3458527527557f5d, 0x756b8d86930e9f9d, 0x88df6219040d52d8},
+      {0x606eb60b5362b045, 0xd179818c9e383cbe, 0xa6215748e068d293,
+       0x73fbdca22fce158d, 0x9cfee07dcb183c8f, 0xc0bf2beba5e03c98}},
+     {{0x86230934f14a99d9, 0x1cf9c66e97c1c092, 0x01e186ba6f595ed3,
+       0xd3291c3de2284a58, 0x03dee2311b9e5e25, 0xf2e9b4ad15cc9f53},
+      {0x4fba15679770c29d, 0xbf7d673650c4ae2f, 0x86901eb92532d015,
+       0x4396fd784e7455de, 0x2fbcea8fbcf811c9, 0x3981ad15ae952b37}},
+     {{0x5563ba504caea411, 0x6d06f7ff59297ddc, 0x244c00acb2fb7a6e,
+       0x25aac3d435df586e, 0x6c6777e4d67be5f9, 0x476cbbf111c24c8a},
+      {0x6083235983b496fc, 0xcc13c19109a871a0, 0x7c0e049f56f78170,
+       0x19bda64b6eafe939, 0x04381fb609aa41e3, 0xe4d4dcbb0b8c4500}},
+     {{0x6bd2c54d4cb89afa, 0xe78c8bfa36527751, 0x27f52654e3eee747,
+       0x56f205839598d907, 0x5f91c2d027cb3712, 0xc501819fa3e33c5b},
+      {0x248490aa4eded738, 0xde7ac94427789065, 0x20138b3d74f7d38b,
+       0xae791f602fb60214, 0x6b4fb300bd033d4e, 0xc69c25d9bdfd1f17}},
+     {{0x8a5cb7ae92717482, 0x3dc97730c49d53e9, 0x07b1e2cc5302d584,
+       0x06617e8e397b46cb, 0x73426657e8e9f451, 0x82dcb228dd517335},
+      {0x39cde2975cad6d10, 0x76991f562e4b0ebd, 0xf3e3b3b25020cfc6,
+       0x35a63790e51bbaca, 0x47b21e6f4a23f2ec, 0x964c6fb5620e0b06}},
+     {{0x9bd2b68dbe832a0c, 0x0efa6b60f1e49e28, 0x67e7f35989586da1,
+       0xbc04c8aafd0944ca, 0xb8db5424f0569b5a, 0xc27dd1250cc5546e},
+      {0x8f0ef9dfad67b577, 0x1b5d40689824cbc2, 0x2ec1eb644e7329b8,
+       0x3e0e7f37e6896b04, 0xad2bff11c118b6bf, 0xe17ec8dc40f93fa6}},
+     {{0xc7e6807598692833, 0x311dd043e1257bf1, 0xd4356992e6258442,
+       0x7868deca05ddf6d2, 0x61b3a96195a0951b, 0x0cda07bf61c6fc20},
+      {0xac9aa65d2d061312, 0x4d9c4f20b65f1a23, 0x862e4927b06611a8,
+       0x0d1c906e6cccfba0, 0x0c82ac346a49234c, 0x70f3c70baadbaea7}},
+     {{0x0c3d2056be21a890, 0x1c1ffbfb8fcfba99, 0x1b68a98b1fbf56ca,
+       0x56fd85ff396e31cd, 0xd2ca58444382c03b, 0xc442030a7d3ef917},
+      {0x4129a731426afafa, 0xacff17ff5eaae9c6, 0x9e854180653f3b23,
+       0xe65a1a149ee066bd, 0x3420084e362ea5fe, 0x6fe58801c7911e2e}},
+     {{0x4dd38c4202a97a2b, 0x2a8d49c2fdb98b51, 0x7034c7535cb2e0ca,
+       0x87e0d6d3c4b59d32, 0x9544bb0735514758, 0x9ed743da4ff27eb0},
+      {0x1d21a1ada0163883, 0xd644249838c57492, 0xf46e8accf2fd1b7f,
+       0xec9932c5c8005cfe, 0x5fe24f52b802c109, 0x5539c03be3ee9ba7}},
+     {{0x4c3f4f4905a95afb, 0xd53a1d3af5db9d6b, 0x0fbd9bad1844be86,
+       0x6b3b80ee272afc14, 0xd727b0b6aa40a738, 0x8a21bf454d809a37},
+      {0x09fb064070767232, 0xa671a2cc45bf5d89, 0xa7e5ff8ad73a211b,
+       0xccdbf621d9a6b97d, 0x38448e2cc89e8f56, 0x07e4e9c32126da09}},
+     {{0x762e65847adcc8b8, 0xedef40a77924eafd, 0xe19906885913e468,
+       0x1882db47289bc581, 0x680cd99be6084637, 0x5249f00e1adacd71},
+      {0x0d3b583f933bf6cb, 0x51c867749b02a63d, 0x0be0ada71dc57813,
+       0xd4b639641e2c5f9f, 0x810b38b02c77c4e5, 0x9f06b31d862013cb}},
+     {{0x43f0ae676c4be6a0, 0xabc6a17a504bffeb, 0xd5be6c25dbb4492e,
+       0x7efc9ee884bff97f, 0x54fbd9d7062da2e2, 0x1befeb61c6d2ac32},
+      {0x14cf6dc0cbafef5b, 0x8e640e4771d12192, 0xd0566543d9a16800,
+       0x9cc2ade9beb1e28d, 0xcbfeb45038e65833, 0x3852eaacd0f5acb2}},
+     {{0x8bbac2203b5a25dc, 0x6e2164047deb0149, 0x3d6eecea7ae10837,
+       0x2ab3cd3deb944203, 0x8fdcb5955114d51a, 0xfbf0f72692471196},
+      {0x6523ea38b20cdb3f, 0xc08ad84a5796c8f8, 0xd7977bc271b564cb,
+       0x16a9e7005d66093e, 0x67fb9a6f144cd814, 0xbf2094bbeecab0d4}},
+     {{0x4f10299a6c50f6a1, 0xa51c677469a1caf7, 0x024b18bc0cbede41,
+       0x7883c01e6b03ac7d, 0xa7b99e741c5213be, 0x529fad7a85a97540},
+      {0x0b6fe59d03125409, 0xf158167976275b90, 0xcaa0969d6ad18919,
+       0xc47afe13ee7761dc, 0xcae681fcdfb12539, 0x58dabc7602ea65f4}},
+     {{0x3f19ec0835a505bf, 0x83186122b0032e38, 0xe5c2eac42b3126ec,
+       0x4368683ff752524f, 0x03de9cdd3ab28694, 0xfc5e70df61d0253b},
+      {0x7991742a789a16d4, 0xefdb8003226ee928, 0x0468fe4ca4e62a4f,
+       0x3ce92ccbd07dd729, 0x447bed93fe688c1e, 0xd5ff355dcae39d89}},
+     {{0x5e930d65c4650b85, 0xbe96b2ae6350da54, 0xcfac4f7efa08bd49,
+       0x277e8456a6e10f64, 0x41be3067407ac162, 0xcfd1d03252a9b68b},
+      {0x8d8d216a9c337e0b, 0xace044dc4e1b9cf5, 0xad9a4102c60d54c3,
+       0xb09420f028815187, 0x881179c60b3b8e59, 0x872685ed5b09aba1}}
+    },
+    {
+     {{0x22313dee5852b59b, 0x6f56c8e8b6a0b37f, 0x43d6eeaea76ec380,
+       0xa16551360275ad36, 0xe5c1b65adf095bda, 0xbd1ffa8d367c44b0},
+      {0xe2b419c26b48af2b, 0x57bbbd973da194c8, 0xb5fbe51fa2baff05,
+       0xa0594d706269b5d0, 0x0b07b70523e8d667, 0xae1976b563e016e7}},
+     {{0x022aa09d236b71dc, 0xb1ce6a0ea65a7640, 0x317344c5b38b417a,
+       0x29a74cdb436451ec, 0xd898eb6ca8b1c876, 0xf0134f99b74eeffd},
+      {0x0d9eab64225d71f7, 0x9679b453ceb3cc2d, 0x37c894ce14dbff2f,
+       0x3704d34927065280, 0x9ee435d8ba29a0cd, 0x675bea1409c11c4f}},
+     {{0x2fde4893fbecaaae, 0x444346de30332229, 0x157b8a5b09456ed5,
+       0x73606a7925797c6c, 0xa9d0f47c33c14c06, 0x7bc8962cfaf971ca},
+      {0x6e763c5165909dfd, 0x1bbbe41b14a9bf42, 0xd95b7ecbc49e9efc,
+       0x0c317927b38f2b59, 0x97912b53b3c397db, 0xcb3879aa45c7abc7}},
+     {{0x8b3269a2714a10e8, 0x64cef040a4a2727e, 0xbc5ac714e428865c,
+       0x531dd17ffdaba094, 0x86d2405718d657f2, 0xe807b0d92f99dbbf},
+      {0xc428a80f6848ef88, 0xb3ef0709d0b73ce5, 0xa752691922a5d255,
+       0xbfe6392318a18586, 0x28a0c772fcf633b3, 0xad22b4ec3f3c5298}},
+     {{0xcd81bdcf24359b81, 0x6fd326e2db4c321c, 0x4cb0228bf8ebe39c,
+       0x496a9dceb2cdd852, 0x0f115a1ad0e9b3af, 0xaa08bf36d8eeef8a},
+      {0x5232a51506e5e739, 0x21fae9d58407a551, 0x289d18b08994b4e8,
+       0xb4e346a809097a52, 0xc641510f324621d0, 0xc567fd4a95a41ab8}},
+     {{0xc8c9b0ae7176dd90, 0xa95604542917d487, 0xb03b7946e62c508e,
+       0x60425926e9fe2321, 0x73b10bba80c1d136, 0xc30a847d9d218c9c},
+      {0x6ed0c8ef2073859f, 0xa176eabf432dd97f, 0x3078096ab9e96167,
+       0xb28f0e6cc473e377, 0xb44e4995683a3bc8, 0x483512eed3523796}},
+     {{0x261578c7d57c8de9, 0xb9bc491f3836c5c8, 0x993266b414c8038f,
+       0xbacad755faa7cc39, 0x418c4defd69b7e27, 0x53fdc5cdae751533},
+      {0x6f3bd329c3eea63a, 0xa7a22091e53dd29e, 0xb7164f73dc4c54ec,
+       0xca66290d44d3d74e, 0xf77c62424c9ea511, 0x34337f551f714c49}},
+     {{0x93a62e7cfa43699c, 0xdad738901bc422d9, 0x265e3cbb10cc9544,
+       0x28cceb062f37154c, 0x6b79b0713bf2e08b, 0x88e025df3ab39091},
+      {0x50a8d04d126522bd, 0xeabbc1b7b779bacf, 0x3db4336ac21cc62e,
+       0x4747f0a36fc00450, 0x067cbf1c544b2d95, 0x2480b7d8fd2be7a7}},
+     {{0x5ed2b216a64b6c4b, 0x1c38794f3aae640d, 0x30bbaee08905794f,
+       0x0d9ee41ec8699cfb, 0xaf38daf2cf7b7c29, 0x0d6a05ca43e53513},
+      {0xbe96c6442606ab56, 0x13e7a072e9eb9734, 0xf96694455ff50cd7,
+       0x68ef26b547da6f1d, 0xf002873823687cb7, 0x5ed9c8766217c1ce}},
+     {{0x21965f08b6ba9a0d, 0xa744f06806cab532, 0xd15d5fa45d4b9a92,
+       0xc79fc89b955ee1f4, 0x6367e8b27b2775f6, 0x2076cd8be2294382},
+      {0xe5c20cedc9089d2e, 0xe6097605d76d6424, 0xa69f79eb02b41ca6,
+       0x9738d39d63e07498, 0x35c14a6a92974776, 0x3a000a517270fd02}},
+     {{0x423ba5130a3a9691, 0xf421b1e7b3179296, 0x6b51bcdb1a871e1b,
+       0x6e3bb5b5464e4300, 0x24171e2efc6c54cc, 0xa9dfa947d3e58dc2},
+      {0x175b33099de9cfa7, 0x707b25292d1015da, 0xcbb95f17993ea65a,
+       0x935150630447450d, 0x0f47b2051b2753c9, 0x4a0bab14e7d427cf}},
+     {{0x2724c53558e996c5, 0x24010322d7453876, 0x3532b79c74818d0b,
+       0x1984146eb27b07e9, 0x948b0c4f471646df, 0x551b1c6132ef8e08},
+      {0x22c0843425f892bb, 0x8fd873a84853c594, 0xff0bdf02ffdf802e,
+       0x527d69938239b779, 0xed66f25c27ace140, 0x7389d738a1a846a0}},
+     {{0xa39def39b5aa7ca1, 0x591cb173c47c33df, 0xa09dac796bbab872,
+       0x3ef9d7cf7208ba2f, 0x3cc189317a0a34fc, 0xae31c62bbcc3380f},
+      {0xd72a67940287c0b4, 0x3373382c68e334f1, 0xd0310ca8bd20c6a6,
+       0xa2734b8742c033fd, 0xa5d390f18dce4509, 0xfc84e74b3e1afcb5}},
+     {{0xd605097e12e471f2, 0x8cff86ab2bb4aa64, 0x4a878412ea65a755,
+       0xfa790b772f2b55fb, 0xd13fb9b35098a08f, 0x39e474d7b359117d},
+      {0xc37499c1e8e5a3d5, 0x5abf6859c7586167, 0x13143ba8310fec8a,
+       0x3543979f75918fc2, 0xf55a9b62cbb0bde9, 0xd6c1d00029359b93}},
+     {{0xb028334df2cd8a9c, 0xb8719291570f76f6, 0x662a386e01065a2d,
+       0xdf1634cb53d940ae, 0x625a7b838f5b41f9, 0xa033e4feee6aa1b4},
+      {0x51e9d4631e42babb, 0x660bc2e40d388468, 0x3f702189fcbb114a,
+       0x6b46fe35b414ca78, 0x328f6cf24a57316b, 0x917423b5381ad156}},
+     {{0x0233e423d52eb122, 0xc28483521154b0c9, 0x2ca09cef6349e35b,
+       0x3b70afc3ded2ec54, 0xc813474d52dded3d, 0x2d3f21bf12f00ee0},
+      {0xa0908f7692f215c6, 0xb97d60e94e9c0440, 0x84ad10c134b6a8e0,
+       0x6f37fd956e7c163e, 0x7caae8c8d057e0c3, 0x534f52c2553721a2}}
+    },
+    {
+     {{0xa354c1de72a041b2, 0xe83df25929d1330a, 0x676610999d532bbd,
+       0xb7c2f4cf52011751, 0x6945d34ff659e35e, 0x6217d20ba1303b7b},
+      {0xa200ddba25751bad, 0xa74a729001d3566d, 0x3018445faa82b46f,
+       0xc3e6a3acfccedc1b, 0xe86ae8703353e29f, 0x1c8085bbfd7e8547}},
+     {{0x306b63e3b4dcea78, 0x4b10209213636935, 0x36bb68898bdeddea,
+       0x9331655d67a329ac, 0x14c7fe26ba92ccce, 0x4e7d6929be0519b4},
+      {0x0dc39dbd164d50e2, 0xd4c430a0b1679cc5, 0xc7f78818fa8682ba,
+       0x43396eadb60aad97, 0x751784d7ff2c64cc, 0xd37928be866af43e}},
+     {{0xf0a69e685a91c9aa, 0x0304d20105c13197, 0x773a3ab7cd14af1d,
+       0xc0b88edd558d555d, 0xeb12d197d2e63dd6, 0x4a8e849fbcd9cdb3},
+      {0x06432985965eaa14, 0x453d93861a5a6f43, 0xbd28f6164171b9bc,
+       0x37781639bbfcf90a, 0x1f93898f3a36084d, 0x1fefd8b7dd00ca75}},
+     {{0xb9207dbc2b2f1bcc, 0x6afd6871a3e83ef7, 0x49924e5534ba150b,
+       0x2935ebf1dfec9972, 0x34bf5e94b76f870d, 0x22d0f32b4c20385c},
+      {0xc78ac1728ccc8e72, 0x7b45b8220ccecb0a, 0x76c67ee4cfb4b8ba,
+       0xecfaefb2cd8724b6, 0xe9bc3d67340bc1ef, 0xed40b2b9ca5541b5}},
+     {{0x9b8a3eb3069e6432, 0x43aaa7fc721397f7, 0x46e23c6ca7e83a71,
+       0x71b261d593fa3c25, 0x4a47a1050f523a72, 0x31919e898dcad752},
+      {0x4c8b06e70c5dd2ad, 0x677ec5f38bdc55e7, 0x4372d55dcb1b5828,
+       0x7bf054c1f04dd321, 0x4e8c1a992e44584e, 0x6807803751d35d78}},
+     {{0x25ae349981d311b3, 0x8640f52a3b16037b, 0xac0839941d947065,
+       0x3723c75ee2e693d2, 0x65040a51b66f429e, 0x7f582b0b035a3a53},
+      {0x20eca9e10a166da6, 0x45b37e202c4cc565, 0xeab882957a8a96e3,
+       0x99e771dab60a1a1b, 0x2cdd778c23b03965, 0x8d4d7a7291052478}},
+     {{0xa52d3c2d7e8f73b5, 0x86d8063351842657, 0x58f01253b3949eba,
+       0x97689f15e79367d0, 0x918bf9a30d820328, 0x2d4bc99441c959df},
+      {0x37392f6e8c16ee54, 0x9f726d58e6f0849b, 0x497de1e4b8208f08,
+       0x60c51233d51a29b3, 0x0f61fb03c9e1d465, 0x09494bd0fbe2613c}},
+     {{0x4f293478154d0f99, 0x1b82320dd07a24b3, 0x1bf7c94f64d55f6f,
+       0x4489b57d725c5125, 0x3aa4d43ab1b6a091, 0x054842bdcf7a60fa},
+      {0xaa918a4d2aeb4cb6, 0xcbdaff99ac7d317b, 0xed0e00a16812a03c,
+       0xb09acf270b0a1e4b, 0xc73a41f7ac28386b, 0x43134dbdf4cd1321}},
+     {{0x08336ffed8c33924, 0x15b56cbf5140b253, 0x38dcd310306caedb,
+       0x04ecd49647944afd, 0x1280d23f68a48f95, 0xf414220434363c6e},
+      {0xd0a397eacaa8717f, 0xb51a1669c3994b80, 0xa02eed916c56808b,
+       0xc3ab55c583545c3c, 0x8b835820fd26114a, 0xe0cfa4a6ffff324c}},
+     {{0xcf63d27951c0d95e, 0x3b170a0bac86a014, 0xc21eaaa9881095e1,
+       0xed2fda116069a3eb, 0x536264b9bd2f1c5a, 0x819e1cffde312c2c},
+      {0x6c30f983dfd6ce38, 0x2f32cc4c980b439e, 0x9fab10b63b9c03b2,
+       0xdfebe34e011ab74a, 0x587360e3b80963f6, 0x3db1f6108692e352}},
+     {{0x63a094c5fe3d070b, 0xf769b91988515eb1, 0xafe86e1450d1131d,
+       0x6bf277886774d3d4, 0x7231d699ffd805d0, 0x05132e5b6304116e},
+      {0x3d5e255be34ce5bc, 0xfd9c3bd0c95e3089, 0x22a24023b83cbac9,
+       0xfb6d2b6fb0b3b98a, 0x74af1115f7e36fcd, 0xcfe15eaff9da3bf0}},
+     {{0x266d2c1cbb2fcdae, 0xb538d4a252be93f2, 0x774c88ba73bd0094,
+       0x65283a9b81a7e042, 0xe1438bbfd0381625, 0x450e1f644d0db206},
+      {0xb38ae9ef4e60fc4a, 0x14ce87e112719817, 0x831d41ec570303f0,
+       0x7172917028850444, 0x2077ea32ccd609f5, 0x091d1166cd273fdc}},
+     {{0xdf216dd84b2ca517, 0xb3eec4b9c6b74c4d, 0xf564e6c81c14e77b,
+       0xcde25f1c2c2c9395, 0x7e31f7a5049fcc83, 0x6913707b9284c753},
+      {0xb92a6f2458e6eb5f, 0x85b0cab595148292, 0xeaad036d7449be92,
+       0x2f6a2888eb94a702, 0xd7d8773d47d59fb0, 0x612d257303c0bf25}},
+     {{0xb872a10584d2c3bb, 0x44bca57139196026, 0x857327d84e352e5d,
+       0xa6c6004ad925f99f, 0x48aaf266bab79ead, 0x213ad923adab2a3f},
+      {0x3be29b6df371cc48, 0xe732b9062385c9f4, 0x562e0be123f0a84e,
+       0xbb6b017228c4b0db, 0x71a93ae5f4c6d8be, 0x76b8bb16551f1fe9}},
+     {{0xbbfaaa94c39926a8, 0xb9a59fdb60a138aa, 0x217a1aa2947e30e9,
+       0xcac988c9c52c9fff, 0x5676473a3bae3c39, 0x7d84b353857f04c9},
+      {0xdeded30cdd324e24, 0xf07c678a9c242899, 0x956d05538cb64f3b,
+       0x9d34e2f5502cb2b0, 0x99e1054a51dd03b3, 0x86b8bfa54d60a593}},
+     {{0x10a53b90754d15e9, 0x6cde9a0c5f4c7218, 0x740d513fabef2b96,
+       0xff6cc47cd3f802fd, 0x1be6825beb0627af, 0xdb21ede55886c2dc},
+      {0xb6cfb2c6f5daaed7, 0x68b61aa8fae29a9c, 0x7a1e16f53a5a485b,
+       0x16b60b92e7b2223e, 0x332f33d836a13a9b, 0x4567c313876cd1a2}}
+    },
+    {
+     {{0xa896d28e4aea3fa2, 0xc6137a456db06ee9, 0x1bbafe8c06fb15cc,
+       0x2daab2961cdffdad, 0x984defc8e1119b3a, 0x9cd44c3cde2a25a3},
+      {0xa7f54ece54ed6d73, 0xd283017f50907054, 0x69130efc6a3b9442,
+       0x5d17f1276785163b, 0xc019911b172b1d0a, 0xa19c745f7e3e093c}},
+     {{0xe185bdc2ab83d932, 0x0a75845dd7c4e754, 0x1f6f3397c3fe5695,
+       0x6c9f3a5f61f6a04f, 0x3c0f9d4bb390a92b, 0x9e3336b74793b454},
+      {0x91ad0c341472f06b, 0x4110047a892cbdd7, 0xfa24d90565d53c83,
+       0xd63e58334176007d, 0x741089fd2cd1623c, 0x6b3d92022685d345}},
+     {{0x1ac37f313586c802, 0x70daca37a9cb8662, 0x6e57d6a78d9c7bf6,
+       0x27069e2ce97eec9b, 0x16284ceb4e877a82, 0x30856e26774f6288},
+      {0x88e53ea7fa33820f, 0xbfe3b89f715ced07, 0x6cf55589743b11c6,
+       0x020f8a092edd201e, 0xc80afc2cb15c27e0, 0x56557371cc53751a}},
+     {{0x1d510157c9cb7f6d, 0x532a077346ab7372, 0x2ea07e2fc6dde9e2,
+       0xceed9ad937d5bb1f, 0x3121994b98cc6e28, 0x67d2fbb567ad8fc4},
+      {0x34707fb3dc9f195d, 0x6a601f481fd5a013, 0xfe939b8d81ef6cb5,
+       0x5c51e8ab1223a9a1, 0x8f6d7993db74cf37, 0x0b81c5b7972808e1}},
+     {{0xcc54c384e26e1212, 0xf4c6a3cbfee6836b, 0x6258940591cccc5d,
+       0x5ed3f3ce135a7e68, 0x11cc139fe1994768, 0x6386c5c477c07147},
+      {0x444230ae75fb9b2d, 0xa5972fd98029bfeb, 0x46e687ecdb5f8291,
+       0xf00bf6890de6d5f7, 0xbf946c5036af6be3, 0xd6d9aaefd39dee1d}},
+     {{0xcb4e85123bf921af, 0x28fc6332532e81d3, 0x682d8637f69f907d,
+       0xbd9fa8f45f759a16, 0x091ea9fa51f03716, 0xd685a14132c630e9},
+      {0x7600c9ac3d249cf4, 0x687e2022002cd2b5, 0x7ec205ab55334058,
+       0x9d0d86b13ecf1368, 0xb3fc17a7fc7baf6d, 0x57939961361c91cd}},
+     {{0xeb74751b37318b6d, 0xb967a3cf5abe7213, 0x8074153902ab79cc,
+       0x11b647aeafbc3e08, 0x3e34458e9e949616, 0x6d714d6272591fad},
+      {0x813ba91c131b7659, 0x7f836d36fd0e295e, 0x192531f8c5d7be99,
+       0xce83f561901e480e, 0x7b187da4f1bba4dd, 0x090754d0f5c82a33}},
+     {{0x0db33228010c0754, 0x10635ffa8eca7c59, 0x6efd85380e8a38fa,
+       0xc1812ea5769360d8, 0x505723dc76f27ef5, 0xd0358e02f35af2e8},
+      {0x9f7bb7fed99419ee, 0x87c66e83430a0e2d, 0x01187549773eaf7f,
+       0x05bbbba489d51bda, 0x52cabb06640ccde6, 0x0d5cb557e7ff387d}},
+     {{0xa338a9f7526f59f3, 0x9b866285216004f8, 0xe94cfd05eb6fcc58,
+       0xc60b12ea2432ba24, 0x3bb7acf1ef1227f5, 0x176e0ef75ec503dd},
+      {0x9c2337f7236f9707, 0xdc2b0f77e029aa27, 0xb795424aa5f85372,
+       0x2eb6d54b1485af98, 0xd2ce87dd7e3f46c7, 0xc5eaf6ad830f743c}},
+     {{0x709d61ca10e06f1a, 0xaa1e9fc578eba75c, 0xf85d062f914b2cfc,
+       0xe73b3baf9089d85c, 0x4ac05feac4a284b9, 0x92c78a433acb7268},
+      {0x7b5586f8ee45bb4d, 0xc39a0d0e6ac0a9e7, 0xe4bbe3d54d6f9ab8,
+       0x1489463f1fd46a08, 0x3ba3182529dba364, 0x94f000d68138511b}},
+     {{0x9f8eafecee9b6d83, 0x069d5ad9f4eac676, 0xbf9ccc6eb5687ebb,
+       0x5d0f44be9d213f1d, 0x372b52960d0d6e70, 0xef1466eff8bb90f3},
+      {0x2ec1daae949789b2, 0x5c7d9b6db40be288, 0x48319460c351e87f,
+       0xfeaa721c5db0fde9, 0xb33d58e9d16dc699, 0xe3f296f23ca8d3d6}},
+     {{0x70187dfbc39c1cef, 0xa785216e0c50c71e, 0x30188b816a6c0d60,
+       0xeaeda67d6a27e97b, 0x4a5192826ba389aa, 0xb96c7c7ea2bf1273},
+      {0x8ff10657267fe714, 0xdff4a271996d91b7, 0xe34ba3e11dc7aed4,
+       0xc457048b38853d61, 0xe89825db1ccbf658, 0x68c7b4556b255edd}},
+     {{0x2f6f6a0f49d38208, 0x38fbcb5b11ee2340, 0x06e43b73865a4304,
+       0x08c696e606d728ad, 0xdb82930d961c650b, 0xf1de8cb5c20c5b68},
+      {0xd8e3cf7bf8e1f9b9, 0xd6e081abf3a304ed, 0xf08d8624cd3cb8bb,
+       0xa3fe7742b26aa9cb, 0xa3a9d2200de295f6, 0xfd465046b9579b7f}},
+     {{0xdc14cb2a74871e18, 0x017b1340fcb8974a, 0xea5cb0546e93c20f,
+       0xa7c078ada9e2ad1f, 0xa37207d4beb26838, 0xcd8b3b25de7ee8ee},
+      {0xdca6606a2801a7ff, 0xad2fedcf0f8af3fa, 0xf27d30b49b530c05,
+       0x071fc1c36b2a4613, 0x363aaa99b72cea9f, 0x7a33ed8f3d350374}},
+     {{0xac02833ff2f3e9ea, 0x43bcbde0956fb86e, 0xf888696b95735c62,
+       0xefa03aaee7b2fd9e, 0x0e563e92e75b2684, 0xa49d2f31d7f335bd},
+      {0x086641718ac31404, 0x35866eab07ccf31f, 0x6bca611104122373,
+       0x730c92e5cb21398b, 0x283791a8b93102d5, 0x4b41d94d50dc1b38}},
+     {{0xc377b373bb20fabf, 0x68d3aa52f986b847, 0xd9c2f2adf39b6894,
+       0x1bbff106bd6da22e, 0x3f7e5b8e7e09678e, 0xad6a87897ed3ee78},
+      {0x689e6b31af9807b9, 0xeca87778bd1f6ef2, 0x17d3277edda78c54,
+       0xe686caccefb65cb7, 0x758aa1ab19a30f0c, 0xb40df97fb11f071e}}
+    },
+    {
+     {{0x16f3708b953b9223, 0x0d3780f8770e7cf3, 0x97a615b227bb71a8,
+       0xa8b9a864162f8b55, 0x80ee8362d91e3fb9, 0xb2009a09f83a4ff6},
+      {0x07a7873ac1696281, 0x17ff00c223095ddc, 0x427f683d860d60ba,
+       0xea9959271f87d32a, 0xb2ac69faa050319d, 0x30c362b9d2d0b9ce}},
+     {{0x24480c57f26feef9, 0xc31a26943a0e1240, 0x735002c3273e2bc7,
+       0x8c42e9c53ef1ed4c, 0x028babf67f4948e8, 0x6a502f438a978632},
+      {0xf5f13a46b74536fe, 0x1d218babd8a9f0eb, 0x30f36bcc37232768,
+       0xc5317b31576e8c18, 0xef1d57a69bbcb766, 0x917c4930b3e3d4dc}},
+     {{0xff41d51faae4bfd4, 0xcf50b14117c44fac, 0x078b808e657a1ea4,
+       0xc5aac1a893c00c55, 0xcb99cfd0cc4d1c0f, 0x1d1048933fa123a6},
+      {0x49646059023ca92f, 0x5833e326f3982134, 0x2e0d4bc9c5781cdd,
+       0x5f7f84ed8d5e75f5, 0xb6655f1fe1e8a383, 0xcc18514c296e4943}},
+     {{0x53ebbaaeb475d8f3, 0x3d6ea31cff76beda, 0x3c15f25d340986b4,
+       0xc5925d2e3365312a, 0xc35d3ee251641f96, 0x11eb2f75984128e4},
+      {0xb41a21a83d04bc99, 0xf2d286006436c3d0, 0x4ffcf4c0faf5663c,
+       0x889d285a0a62c9dc, 0x0908665acb2d60c5, 0xe2f19c590a131be5}},
+     {{0xa93a7dbcb1e46617, 0xd0ad4a47d77195a7, 0x020d8467e5948165,
+       0xa3375bd925267b60, 0x8cf54ab28c44e226, 0xc4f7f467f2bf5bfe},
+      {0xde336f92c414077a, 0x92656952c92d7219, 0x31645a70c09ee1d9,
+       0x8cfe567d292630eb, 0xb835edb97c16c0a8, 0x8ac88e9c48dee1be}},
+     {{0x318feb4c22319bfb, 0xfd0a1331a1ee9625, 0x1e4a786d5b238661,
+       0x88e04305a722c591, 0x38eb062af406cb01, 0x21caa381e7216364},
+      {0x450c1d29f0e1f665, 0x369af7bf207a1320, 0xfe46a53a6f6c0680,
+       0x4553199a25eac032, 0x41fa659affc49722, 0xfb9e0c73bbcb7a29}},
+     {{0xca53bd857e09207e, 0xa304cf7dfa171b01, 0xa93499d7881beffa,
+       0xc0b04ee595cf1295, 0xe0cf548e90cd1e30, 0xfa82436e821b4efc},
+      {0xbb4d7958979ab01d, 0x4a1c815bd48ca82b, 0xbacf6a1b627640fd,
+       0x31150946abd9a758, 0x2c9d7d14906bea56, 0xd2450bcf17e06ed1}},
+     {{0xc0de60f5091354ff, 0xd7cc38bba1bd1975, 0xf4122aa8e734e2df,
+       0x08f40f63ef773db6, 0x0a7e9484ce2d71c5, 0xcc79173378a3f825},
+      {0x0cac7a5bb47beec9, 0x1cbea0e4a3f7b5b6, 0xecf19a90d3e18145,
+       0x0d1b062a0aadf689, 0x42299f1ff3f0acf7, 0x63a645395ac252b9}},
+     {{0xfda262478db83d7d, 0x3a2d1c292ad24ac5, 0x586b6219a01d0daa,
+       0xa92f773b949dbc96, 0x89c9668d5dc355d0, 0x0aaeecdfb5e40672},
+      {0x5945a47f2c701014, 0x50e4a494c5590e89, 0x307cbd9f7fd21edd,
+       0x96005378b85543b7, 0x9f87fddfba214861, 0xcdd615c5f9d9d2c7}},
+     {{0xa4bfe1515bd11a42, 0x38920da20ea6729b, 0x41e28260a0ee708f,
+       0xff4fdff4abc9d5f5, 0x6ed92241ffaae99e, 0x6075ce0dc04fe4d9},
+      {0xf10a173e5db066f5, 0xa2edee12e75ef129, 0xd2a0823f8ed02e85,
+       0xffa78cf42e522dc1, 0x07041e4600c939fd, 0x3369357f3a9a8bba}},
+     {{0x3b2025331a4e68b1, 0xa2ead2d7f7504686, 0xb0bb1808a569cb36,
+       0x953f539cc015c68f, 0x45c876dc9a6fefe1, 0xe87ce8acbede60ec},
+      {0xecfc84ddf3c69642, 0xabe549ed3a90826b, 0x03a29df457cca429,
+       0x08d4e9a1b8e72b83, 0x88d9c51b79e7ef57, 0x48102f0edc075e38}},
+     {{0xa1fc20f7ba264fa8, 0x0f6254154105e64a, 0x2e5581c28e2e8e16,
+       0x912c80fa4c456234, 0x7fd61fb9e9e31ad4, 0xa5de4e7d1c19e811},
+      {0x6a7ab2cc2961b64d, 0xbf06db255bb2da03, 0x33f76a85ab06af4d,
+       0xda387e544866378d, 0xbb71deb856826f8c, 0xbbe3ce38eb64ecb6}},
+     {{0x2a6f3d84bb63bdd0, 0x8b5bececc2792d41, 0xb0412202ec9fa26b,
+       0xbdaad566bc706607, 0xd34e3ef1d8d361d4, 0xb4fe020eeb3c3f14},
+      {0xc6bac95d82656dd4, 0x8cf56ba088ffb328, 0x33f04ddadc84969a,
+       0x642d93d6a5f1d0eb, 0x122e35f693ce88dd, 0xbcffc36902c0e82a}},
+     {{0x0e935934fd5d084c, 0x7cd4992a9121a6e0, 0xab773dba8e15d863,
+       0x9cea4a51cab64644, 0x516754d72efff061, 0xd8af89dacd3a36a4},
+      {0xc7d352ac4615774e, 0xd1bb914b21ae0d27, 0x8a8aed979199938e,
+       0xeb06789acd6f3495, 0xc51d7766775f93ee, 0x7eb6909f0a8af851}},
+     {{0xf67083096a82fd92, 0x08652b2bfffaccf2, 0x8ac0e67bf0da4c5c,
+       0x26c5a4beb0fabc5d, 0x3e5ad350b1dcad44, 0xb539e10e3aa30664},
+      {0x266f4163a41fef81, 0x860401ec78ef116f, 0xb0fc5cc33563575b,
+       0xc28a5cb5d4c9e03a, 0x93399effcc9bbe6c, 0x50a48cb29c9a84a2}},
+     {{0x44bfd1665c1d4586, 0x46434e198d1d86d6, 0xe50fcf81c3936683,
+       0xc9b4eb068b08680f, 0xf90882c52832aab0, 0x42823cefecbf5dda},
+      {0xfd4d51c744ae08f0, 0xb54a08f1bbd21c1c, 0xb72953dbfb187c34,
+       0x166f7f26f8ed037f, 0xd2b1077a097bad45, 0x47794cdc790dd808}}
+    },
+    {
+     {{0xa05c751cd1d1b007, 0x016c213b0213e478, 0x9c56e26cf4c98fee,
+       0x6084f8b9e7b3a7c7, 0xa0b042f6decc1646, 0x4a6f3c1afbf3a0bc},
+      {0x94524c2c51c9f909, 0xf3b3ad403a6d3748, 0x18792d6e7ce1f9f5,
+       0x8ebc2fd7fc0c34fa, 0x032a9f41780a1693, 0x34f9801e56a60019}},
+     {{0xa4b957d262c36887, 0xaf15a485fc24cff8, 0x11575e80a271d9e0,
+       0x0fff68d44b9367e5, 0xf55ba6732279779f, 0x9d72cca6d4d68f68},
+      {0x01474ab1590ffe4c, 0xd20f44e1074d634b, 0x63903a8336111d25,
+       0x37342a5fab531cef, 0xd3c93fe7702ed867, 0x05d143696279f7e1}},
+     {{0xb398290cf0db3751, 0x01170580ba42c976, 0x3e71aa2956560b89,
+       0x80817aac50e6647b, 0x35c833ada0be42da, 0xfa3c6148f1baba4e},
+      {0xc57be645cd8f6253, 0x77cee46bc657ad0d, 0x830077310defd908,
+       0x92fe9bce899cba56, 0x48450ec4bceffb5a, 0xe615148df2f5f4bf}},
+     {{0xdccf68bccbaf4685, 0xb333e464270a2bcc, 0xe43ae199254dd3e3,
+       0xe8526e26ddce5c84, 0x52bad815ea0b4258, 0x67c12c1b094574c4},
+      {0xa5362fcb861545b7, 0x3e904c35c2b2eb62, 0x0f9312b5eeffc2cd,
+       0x5475657b14de4e5b, 0x746e67d4f0233fa5, 0xb5157d7f35471ec2}},
+     {{0xf55edabb90b86166, 0x27f7d784075430a2, 0xf53e822b9bf17161,
+       0x4a5b3b93afe808dc, 0x590bbbded7272f55, 0x233d63faeaea79a1},
+      {0xd7042beafe1eba07, 0xd2b9aea010750d7e, 0xd8d1e69031078aa5,
+       0x9e837f187e37bc8b, 0x9558ff4f85008975, 0x93edb837421fe867}},
+     {{0x3503d9371f23a0d8, 0x64c598a8c321dde0, 0x67f101ef5b52e0f0,
+       0xb6b5b4c2f955b5fa, 0xb5f03d53880e0569, 0x121c3ac1c99393ef},
+      {0x90755bd657330666, 0x70ae5793d4d71d3d, 0x326ffd519e9ce792,
+       0x1b772d7396ccfa14, 0x652710f4874a22de, 0x72768469db210342}},
+     {{0xaa6489df83d55b5a, 0xea092e4986bf27f7, 0x4d8943a95fa2efec,
+       0xc9baae53720e1a8c, 0xc055444b95a4f8a3, 0x93bd01e8a7c1206b},
+      {0xd97765b6714a27df, 0xd622d954193f1b16, 0x115cc35af1503b15,
+       0x1dd5359fa9fa21f8, 0x197c32996dfed1f1, 0xdee8b7c9f77f2679}},
+     {{0x58d6998e171c1439, 0xfd4a98f401feedec, 0x420b2a0165739fce,
+       0x5c5db30822f7a073, 0x016c547805042f00, 0x5fc73ce2a12413d9},
+      {0x8ceb2d70e932aa17, 0xb4d66b670537afaf, 0x2638d012339c146b,
+       0x02fbb7b628ac0555, 0x7fcb0c8162d46e63, 0xeaa9ff4f066d088e}},
+     {{0x5405179f394fd855, 0xc9d6e24449fdfb33, 0x70ebcab4bd903393,
+       0x0d3a3899a2c56780, 0x012c7256683d1a0a, 0xc688fc8880a48f3b},
+      {0x180957546f7df527, 0x9e339b4b71315d16, 0x90560c28a956bb12,
+       0x2becea60d42eee8d, 0x82aeb9a750632653, 0xed34353edfa5cd6a}},
+     {{0x8273db992d189057, 0x4d1b05fce1b5f8cc, 0x5fec7c830a7c32d1,
+       0x28ddaf28ea9b4d45, 0xb6bb62aca2fc58be, 0xfc65b7aa4a41852d},
+      {0x6e7651941c9e6045, 0x3acabf28fc116257, 0xc9d5e8054b5a4ba8,
+       0x9a072259cbdcf1eb, 0xc67cf643439fc8fc, 0x917ef6f8b4333aa8}},
+     {{0x82154d2c91aecce4, 0x312c60705041887f, 0xecf589f3fb9fbd71,
+       0x67660a7db524bde4, 0xe99b029d724acf23, 0xdf06e4af6d1cd891},
+      {0x07806cb580ee304d, 0x0c70bb9f7443a8f8, 0x01ec341408b0830a,
+       0xfd7b63c35a81510b, 0xe90a0a39453b5f93, 0xab700f8f9bc71725}},
+     {{0x311ebba2fc37efed, 0x8a6a42d660cfd6bc, 0xb4051b3af2a4871e,
+       0x66ce77b8c2f0ebf0, 0x84abc9480ad28477, 0xc82e5c6263d9d11a},
+      {0x99ffc70c007dcf93, 0x5e974edfd964c822, 0x0fee3572513085e3,
+       0xbe67a88046ce8444, 0x136ceeb806d17129, 0x0da512ae662d86fd}},
+     {{0x9401aec2b9f00793, 0x064ec4f4b997f0bf, 0xdc0cc1fd849240c8,
+       0x39a75f37b6e92d72, 0xaa43ca5d0224a4ab, 0x9c4d632554614c47},
+      {0x1767366fc6709da3, 0xa6b482d123479232, 0x54dc6ddc84d63e85,
+       0x0accb5adc99d3b9e, 0x211716bbe8aa3abf, 0xd0fe25ad69ec6406}},
+     {{0xe7acaa8457e0105d, 0x3c06d3bd3851fd57, 0x23cf3c612a9c631b,
+       0x13888aaa33863bf8, 0xf2396355717783ee, 0xf21e1a4836b300e1},
+      {0xa734cb3b9d27b4cb, 0x0a7effed796e34b6, 0xfc5864773615cc7a,
+       0x1f98ed7788844a21, 0xd6e289407ad4c7bd, 0xa00d64ebe9331c7e}},
+     {{0x0d5c1769df85c705, 0x7086c93da409dcd1, 0x9710839d0e8d75d8,
+       0x17b7db75ebdd4177, 0xaf69eb58f649a809, 0x6ef19ea28a84e220},
+      {0x36eb5c6665c278b2, 0xd2a1512881ea9d65, 0x4fcba840769300ad,
+       0xc2052ccdc8e536e5, 0x9caee014ac263b8f, 0x56f7ed7af9239663}},
+     {{0x17e3d0b8713b8541, 0xf372b048c6b5e839, 0xf8ef0261d0bb1848,
+       0x9b804ceec71a3bbe, 0x00b7d171542a88ae, 0xf2b8ed10e9097b9e},
+      {0xdbad9f122c0a009a, 0x245fc1e9205fb1bf, 0xa8a4834fb83debf5,
+       0xc3ee226d637e449b, 0xe3070d93cab82664, 0x24b8094db37320e8}}
+    },
+    {
+     {{0xb506b7b925059699, 0x349fd83f01ab02e5, 0x64b729ad3789281e,
+       0x69ae8f81f9af4561, 0x007befe156f91860, 0xb578c566edc250fb},
+      {0x1c16d75a67ae4801, 0x04c35a7ea1d3f592, 0x5dc97da936881f89,
+       0xaddb603103a5b1ea, 0x7eb515b13e153a0f, 0xdc3a92192b4a1ee2}},
+     {{0xe7365f9e512cc92a, 0x9efdcf8b5172a654, 0xbfb389ac8e611fc3,
+       0xce778fd5699c227d, 0xdc1f47b63ff2ef17, 0x2ae0f68302672ed4},
+      {0x51c63806a8e879cb, 0xd3dfecf03909f526, 0x375b3d13e00e12a2,
+       0x91f9f750bf8df325, 0xf1ea0e421df5f21a, 0xaed73e7f32c60584}},
+     {{0x03b07fb5e0728e6d, 0x9e0469201012234e, 0x272e644935637644,
+       0x2b6ad1c2a55bcadf, 0x86c527765c71c6af, 0xa25bd60bc1678806},
+      {0x0cae829476bb32f8, 0x389ce4e633e03cb2, 0x504df8337513dfb6,
+       0x4260ee8e1b351dda, 0xa473c5d9dbaf7cd0, 0x22cb7cb471e390fd}},
+     {{0x1d9aa9fa26caebd8, 0x6b64686926b7a673, 0x7ebed6a17f167b47,
+       0x324c13f85bd9153d, 0xe9ea5b734c682ba6, 0x2961da7d7e3ff6e2},
+      {0x1ed2b05001a83dad, 0xb232951dc4a2f60a, 0xafcea5d3d68b8ec6,
+       0x21dc058d1c6ce0d2, 0x0043de75e719410c, 0x4edd792ce15cf534}},
+     {{0x0f45245f3babe09e, 0x0959326fa9f2fac5, 0x7629e7fb5cc136e5,
+       0x208bd5a6e48b7eb0, 0x637891d6b75a85cb, 0xf0ad9d8d9f27b57e},
+      {0x437b6944e0454b05, 0x022c51d702ed3592, 0x0f79e2bd0dc0a769,
+       0x54ace1fdd9b81f9b, 0x38611d66f95ea8dc, 0x52443ca8f0e6147b}},
+     {{0x857d68558bc272d0, 0x4583eeeeb5be2485, 0xb83586dafe0152ec,
+       0x8b0eb223e830294a, 0x757582b6a5b0e880, 0x5140c0169cca7fff},
+      {0x07a00782e9228f12, 0xb96e2b5dd4973080, 0x3cceb9a6e88efbe6,
+       0x9955b63073fcdd25, 0x04f26ab02805d470, 0x90b38299424da086}},
+     {{0x73f1ae48f4f6c5b4, 0xee5af13d4a477f01, 0x274614a2ddb93d52,
+       0x90b0c563c320aaf5, 0xee2303c8ef990b0b, 0x00d028e73061f140},
+      {0xff705011cb3d8eaf, 0xae1d990862594f4c, 0x22a27cecdafea438,
+       0xa78e12d5c5962ea9, 0x5bbe9d878e65f9cf, 0xa222580cf47cefa6}},
+     {{0xf7aaa732959abb9e, 0x1222ad0a2ebf80b9, 0xa1a417372e0c286e,
+       0x3b6685025da3472d, 0xbc0d116b7576f2a2, 0xfdbcad95a36a27d4},
+      {0xcdb3f4749d54f7ee, 0xe2e0f5f98a5643a3, 0xc70d11b969d4f171,
+       0xdf96d1366cca4ef7, 0x570693db2fc6afdf, 0x5059e67b567504da}},
+     {{0x2c8107d47fe632a2, 0xfc46c745ede7bff8, 0x2d3b12864650025b,
+       0x815ef3cbe74cd65f, 0x5431b01ba256f01c, 0xe832ff1139915cfa},
+      {0x2c106de607d7af84, 0x67303b786d4753e7, 0x5f886ffa6d75c8de,
+       0x932a6c20967131cf, 0x5bc94a9170aebbb0, 0xa85b3044fd56e06d}},
+     {{0xc904558ae7eba799, 0x46b6031bb2fa7331, 0x6620e2b50653675c,
+       0xd1373a357d2218f7, 0x0f4b3ca3af55a5e7, 0x50774160714e70c2},
+      {0xacc63d1469188455, 0x89a795fe043b8b30, 0xac2fd66ce1e4b9cf,
+       0xac7927021bf67f26, 0xb9513f0d1143d437, 0x02198050811f2931}},
+     {{0x6d4acdba7b480776, 0x8b518cd466dffeb5, 0x8826c99451918859,
+       0xd2b6a7a038fad835, 0xd315417a6929a870, 0x05d85252c5a769e1},
+      {0x2fa06335ec0d091e, 0xb0cc337287768c88, 0xacbda5ba58a2eb9d,
+       0x2a404fc976b7b057, 0x073abb71838c6135, 0xbdf89b135cfc4f3c}},
+     {{0xd00eb9c53508675f, 0x92ec76a4a117dc95, 0xf58d6f85334ca15c,
+       0xeeb522169cee0544, 0x3eb9847ff21457c2, 0x547908bc5524c60d},
+      {0xb5b49d225198709b, 0x718abce6324abc67, 0xdab8ff2f4abd54ba,
+       0x98be59e67184d444, 0x45b74b54babeb4b0, 0xd8d8bb30ff71a5ac}},
+     {{0x8aedf7e28ec13e6f, 0x8b952620d950792d, 0x36e9dac204918f59,
+       0x5e49a5a2d3dd47ed, 0xb17455bee863c2bd, 0x8caac6a9326a0d66},
+      {0xb6c3f5e427bb72e1, 0x17566c9dee5fe09b, 0xfd6bbcc25e3db64d,
+       0xd437d07a3189319c, 0xad00dfc4cd3166a5, 0xab75927b0bd63003}},
+     {{0xa7672a39afc43be8, 0xefc49015c72f97aa, 0x81c63c050e48f2ed,
+       0x62f39f32833a22cc, 0xf7a3480172c0c0c4, 0x4711cd41a4158538},
+      {0xa3c99a4d1d15f2f3, 0x4b82c1c17bee1b47, 0xc7d60b489d199f10,
+       0xd1d1f03d5f16fa95, 0x96c780c932fbeaf2, 0x0662e250376ff106}},
+     {{0x728e334678571c8f, 0xd0a886b56cb339d3, 0xf4ea33380a5671ba,
+       0x43823401a64850a4, 0xa7729cd533117b9d, 0x4dd457602b78cffb},
+      {0xbe0571115a67d812, 0x7ec6cf925105a3fc, 0x5dbcb4bc0ccafeec,
+       0xa7587f15803092f8, 0x67ee61d5a884efad, 0xd4ced554ca47d9ca}},
+     {{0x02c6b6083b03dcbc, 0x2b20149e3b9d868a, 0xaf5ab01d4f57eb0c,
+       0x59935b94d750e515, 0x32721b408f89ad68, 0x673bd755a7e3ceff},
+      {0xbd462fd8ef3b3393, 0x991422640e59a120, 0x4162da619263fa61,
+       0x2ed1f2deb6488eb3, 0xb0bd37a8725680c4, 0x17218bf029ec27b0}}
+    },
+    {
+     {{0xfb09e7564bd044ef, 0xdbc9fcdfbb964fb3, 0x451c5b01cdb1f4f5,
+       0xb02f9068f1dd1cf0, 0xd4765e7c0c687e41, 0x89b64981d1967bd3},
+      {0x06a0e4ecf0439d65, 0x564c387da5abbcec, 0xc1e9d01ac651d806,
+       0x5e6ebd830618a96c, 0x9ce1aacec54ad8ce, 0xe5248a089953f90f}},
+     {{0xda2b0725bb296c27, 0x1f22ffa4d341171b, 0xc721e35a5b132756,
+       0xe5695e84fadb6907, 0xbc5a3bf4c283f546, 0x9182cb3edde128ae},
+      {0x179c7fa66592e05e, 0x1e604790f38e8586, 0xaf7e83bea16bad55,
+       0x6f41231e9137ecd8, 0xac87543d8f30d1ab, 0x630a9d87b1ee0ee8}},
+     {{0xd8ccf5500850b471, 0xea8f73d2f7ebfcd8, 0xfb374f997f138136,
+       0x6b3a1ab86cd70e73, 0xc4577c1342f40008, 0xb23800f9a0517e75},
+      {0x79deaa457088a19b, 0xa8410f51702183ed, 0xe2761fa12c9f6594,
+       0xed1d011252868276, 0x9e9805d7c22157a4, 0xbe4aa213ac7653e9}},
+     {{0x359cbfa05e4f1914, 0x6992cd48d922176a, 0x2fd5e90f630cbcb5,
+       0x2b0f61306ddbf238, 0x5070970a3af753e6, 0x433d009441727016},
+      {0x2eb15b3b9dca97e2, 0x3a7379cd00d96875, 0x0d4374aee930a75c,
+       0x3cd36046849e7727, 0x9ac3117e336a19ff, 0x2d1373c9433ddc04}},
+     {{0xa60026f013a2a0f2, 0x173b08a8d6d8a91c, 0xfa6b3eea2b0ff7fb,
+       0xd5417c7e4201b05d, 0x91dacda7598f4c56, 0x00323d9a0a1513a5},
+      {0x079a4ef138bf2619, 0xfe91faaeee3512cc, 0xbf9aabdfbc03468f,
+       0x0d46d3a201d3ca1f, 0x6bfad5113e677e61, 0x219a70aa6dabf925}},
+     {{0x8e1458698faa3eca, 0x811c0ab1511c5e09, 0x08a52f04c39fd20b,
+       0xa7c222635e5f514e, 0x365701af8507e5c6, 0xba1c1ce2495177cc},
+      {0xed128050bd3d7f93, 0xf5b3a50805af7fa4, 0xe27a017c7eb1e384,
+       0xaa95d99a1fbca0a7, 0x61a459cfbaa36562, 0xc1ee4d7bb7f845c1}},
+     {{0x164a4fa1a4945d9f, 0xf9fb03278ce7f161, 0x5284c7049891eb36,
+       0x9ca1ee6b9bd23713, 0xb364fe43bdc043e0, 0xcf9c9e70ae82eb35},
+      {0xa375b9d5bcde9b87, 0x55f437d76d5ada37, 0x49fc8d7285bf9126,
+       0xf13cbab7bd83c1bc, 0xc3d75306f847972a, 0x8c27482ab1da55aa}},
+     {{0x985dcb43e4362d67, 0xecb860c2a939bea4, 0x40597f3055fbf1d5,
+       0xb6d166bf43fcd98a, 0x5932570915ec99ca, 0xe05ae3b9c5bdd370},
+      {0xc18f78270c7b943b, 0x84bde9c64dd572cc, 0x5d50a89df478e56b,
+       0x242c2f4864d29053, 0xcda12c6161cf7e0e, 0xf8b6890eac8d1d40}},
+     {{0x3f2c311e37d03584, 0xb387b3ccbb91574c, 0xa64914d18d7aa7af,
+       0x7586999aea0fb673, 0x25ee7a7014e5014b, 0x1015b142557fce0f},
+      {0xbb83971210cc9d92, 0x31118426abbb3b2a, 0xc3a4fa6fa29866e5,
+       0xbdb3a49566310a76, 0xd397ceb6a11055e7, 0xc8d47e100240bd0d}},
+     {{0x76624aadfc8d5f6c, 0xb7dbb41a0144a0ff, 0xd7be190f30df5bea,
+       0xb61e3e979ed58b6a, 0xce192eb314bf09f6, 0x3d6632af27ad3fc4},
+      {0x51f180e8cdd7c93b, 0x257df031932c89f0, 0xed1ffbcbb680f621,
+       0x6d8be60134ef3db2, 0xc32869e3044b7f8a, 0x8db4099509958ada}},
+     {{0x004888a97ebfc0d7, 0x5546c1b10f90df8a, 0x9c73aa4eddfb6a92,
+       0xb492a7232782e2a4, 0x5e79ce872b9b9390, 0xb8165f792564d95a},
+      {0x235665e2a8f207cb, 0xdef167621087fea6, 0xf4275ea27b9d891a,
+       0x70b2662a1f98a6d9, 0x2990c5215fd15926, 0x2734975dc30089d5}},
+     {{0x7a9a9dd7b6b11af8, 0xac4c50dd16a42f8f, 0x1550267b6726c324,
+       0x12cfb2fd7f841afb, 0xa41b19052f046430, 0x8f5f5373b7d786cb},
+      {0x7b61b39c729e09fb, 0x07a5415f2626da4c, 0x65d6efb84a348905,
+       0xf377862cf2e864b9, 0x3c94000dab96cdb2, 0x2176321a8efef0f6}},
+     {{0xfbd2489faffedcf4, 0xe41dfcac41feb03e, 0xf13f6579e9a86cd1,
+       0xfe3c2a91b7ff732f, 0xd447c72882f008fc, 0xe4e9c0540e1924b1},
+      {0xe0d6bfc3048bb350, 0x5fe1c2042fb5fc5b, 0x70799d49aa50972b,
+       0x7c79c24ed2c42b50, 0x4ffa2c535405cd06, 0xd890bea7c7ba6f8b}},
+     {{0xee68456d94747d5c, 0x5c0312feef40112f, 0x57a480bc0fcb2565,
+       0x549b31ad7c529c68, 0xcfdc5d33402bdb03, 0x955bfd5dbf45407e},
+      {0x8381a1ec1fdb20fd, 0x89dafbdc4fe0b38e, 0xf33c870668f59249,
+       0xb6cc761868be67d2, 0xa7897c7cea4845b8, 0x6773f08b93f2f9a9}},
+     {{0x642405c114a03fc5, 0x5b9735844cf34763, 0x9f24c2cc3331c03d,
+       0x56428a376f9bf4f5, 0x2e83d070703e5e73, 0xb8e4e61a573c3cf4},
+      {0x7a18ec588f3e3efe, 0xbab02660b812e5a7, 0xee826e368289de63,
+       0x86d263f9c1a8eb16, 0xee8f3e72d7b85103, 0xa3627d9be567c787}},
+     {{0x8c558000c1c1bc68, 0x9e48a67a83fd6ca6, 0xacf0d75ceb7a35cb,
+       0x0fbdce4cf0a93110, 0x82b2d13a9cc50c85, 0x696fd259cef70d6f},
+      {0x1cc9be2e457b88c2, 0x0d58b34b1f04c0bc, 0x52bd479f195a532b,
+       0x769fe6ca1ab3605c, 0xba6a63e48a24c1e0, 0x86dea46299da5d7a}}
+    },
+    {
+     {{0x509abccb65682820, 0xfbfa1d094ff86137, 0x1ae371bd640bc2f6,
+       0xa155c2978f546c68, 0x8858cadcc08b8cbf, 0xafac5b0a1d96948b},
+      {0x919cb22682e25016, 0xd147df4ab064ffc3, 0x25dd0f1ab4abe560,
+       0xc6bbe6369cb75bd1, 0xbb367cf947a778e4, 0x5714aa4dbde524b3}},
+     {{0xc6307399166915df, 0xb35545bc5da8a26e, 0x8e0126aae3a99321,
+       0x0fbfdf76da9308d1, 0x2163ed6b6168e505, 0x71f3d0087500d8bd},
+      {0xf57159605ac13f65, 0xc1cd9a6755172d5b, 0x6b225f7e53d84c65,
+       0x9c031269025029da, 0x54c1edfa17d89aed, 0x5b0238786b435150}},
+     {{0x1e7ae1601e94d949, 0x177dc53ee78e6221, 0x8af29d8f7aeb9882,
+       0x2d9a60fd9e3f3906, 0x6979fcd6df962156, 0xdd2fe5887e1e54b8},
+      {0x9cccf31076643453, 0x94ece1a84e0643d0, 0x745449cbc111d8cf,
+       0x872afa4ae6cfbd97, 0x5c27b7ca10dfb34e, 0x505e62bc533480fe}},
+     {{0x009ef80aae238fa1, 0xb41d9b24486af6b5, 0xab4455ed685add95,
+       0x18f323f672c7dac8, 0xe7009790e372f168, 0x4d5bcba6067bea99},
+      {0xf15bdbcc51a2a9a9, 0xde7e4f742fac9169, 0x2fd62c304bdbec36,
+       0x8b3ea93d1b3ac6c7, 0xce1c8e5c9c293889, 0x19664dda11564f8b}},
+     {{0x5f266f13175418b2, 0x6bd7a86903a626f9, 0xc7b532304a6f11ca,
+       0xa216b056bfc8cced, 0xa274d5d8b288cb7c, 0x6fc4a35d924897ad},
+      {0x1ea532eb81fc6940, 0x2fcd817e2acbbc45, 0x45eee93f67814fa3,
+       0x3b3da48c1229e035, 0xd049a976efd8e3d7, 0x8087dff7bf81f314}},
+     {{0x77faac22bd366155, 0x13cc4038282f11b5, 0x31ad1dd45fbd35ab,
+       0x7e0de9da45d6d40e, 0xa16c5f1939749ef6, 0x761cd6cf85691cf2},
+      {0x156536ad4d59b802, 0xee98dc4187c4b11d, 0x165a1eacd35088fc,
+       0xce8a733538fb995c, 0x34d0d3313293b3a5, 0xfcf548ca8b570e79}},
+     {{0x7be5946ea85af34a, 0x420593c9da6fb0e0, 0x40b83c00987f9246,
+       0xac35f4e9a15d192b, 0x1979bd33776a678c, 0x0a7d973e8f6068d3},
+      {0x71d322e87e6298fe, 0xbb23a29936af9b65, 0x14e2b9706644c50c,
+       0x5f7f207373570bd3, 0x40215c569055538b, 0x91372e64365500c9}},
+     {{0x6a3a23279af0a75c, 0xf832a8159f1f250d, 0x17030c3322a82d3f,
+       0x24bf18ea14cbc835, 0x319dc4cab2da2727, 0x481df3606d020d4a},
+      {0xaeebdd8a7fc22ba5, 0xbd0515c6a91e28ab, 0xfc8a2978595f361d,
+       0xe60dd96c1ae8fa3c, 0x19c2109aa5341575, 0xfd6e92bb06a0ee48}},
+     {{0x650008f977b5c7c5, 0x4bcf600202a6d087, 0x391ebfa382234273,
+       0x9dcb05d386cd884e, 0x1b5e7afa8753b3fa, 0xd453e9b42d1e513c},
+      {0x3b1a0dea4b3a74b4, 0xf8989aac5bebd592, 0xac3ec9f561dc640b,
+       0x4ba9dd0a6c4b301b, 0xf686a5fe04e48df6, 0x8b0d2d760631d1e6}},
+     {{0x443deaab03c87a20, 0x57dbd224bb817740, 0xf88918ded51d6acd,
+       0x48c9b2f17d4ec9be, 0x78b41104dfc48a69, 0x44a8144378827f54},
+      {0x74ed794916a22495, 0x6b9e9128ea92d3e6, 0x6fe6449b0d9fe252,
+       0x31743d06c14e825a, 0xd9d4ad8c08690f00, 0x562e2f600e65f748}},
+     {{0xe9e01117b1befb0a, 0x7ce74721d25cb1ae, 0x946216c62d4437ad,
+       0x83b03131ea8b2d85, 0x3614b15d2c4fa895, 0x393317d9c23c6bf7},
+      {0xda73495adcd80eb4, 0x850dfb466338db53, 0x3329c498c9b8943a,
+       0x1ee615b50765d94a, 0x2d16a6cfd67c17b3, 0x050d6bfe6f8a9ed5}},
+     {{0x92501ff88b7f8cb2, 0xcdaa6c93578a4cfd, 0x95b99a05e5303846,
+       0x30a72fdc2543d1a9, 0x6648126b11808771, 0x6980dd99eefb8145},
+      {0xd9a87f83f1949aad, 0x3b4f208df7b8ab95, 0x3341e118c40122e4,
+       0xe513567f853b291e, 0xd4f1bbb73b565bad, 0x86207b43a7658f77}},
+     {{0xe5737dcef87cd72c, 0xdf41230a7a1c9f7f, 0x7fe5cfcf34e0d519,
+       0x83cc1da526033c9d, 0x4195ef1ae16dffd0, 0x7c388f6e8af91671},
+      {0xeb1002b862283e40, 0x08122e57a96be04c, 0x48cb2d0cdf9fac7c,
+       0xa3c007ae41f0946d, 0x4d6fa5c5cec27088, 0xe1fbc03edcd5fcfa}},
+     {{0xbab37a639bece059, 0x5a60ec877fa28fc3, 0x69e1086c1d4a8f5b,
+       0x3a87384465814282, 0xb642dc162676cc7d, 0x8d152bb997e423a0},
+      {0x66ac1b37160ff40b, 0x7410ba67f657547a, 0x8f47debbadcc6823,
+       0x44e9bf64b1536fa1, 0x1cfdd504939e5461, 0xba5729e143bb3b90}},
+     {{0xb5c26108dd63f6d4, 0xefb8dfc760229177, 0x9d98088923e4cc7d,
+       0x59579ee8c211c92b, 0x6f14630035fe17b4, 0x6c1e70750ca61e4a},
+      {0x8671156d19d582e1, 0x36a3d85807230605, 0xd9314e61a352dcdc,
+       0x7a9d0de74c6bc2b1, 0xb57d3f71c894ab77, 0xb3564bc7d4e5a04e}},
+     {{0x2e32f896cde5e785, 0xcd55ae7ab9db8f31, 0x278db1ad8f832885,
+       0x271d9078adcbd933, 0x2208fae34a64f863, 0x974046e039c89365},
+      {0xcb46f272b3cd0cd3, 0x31f34e1a74e59edc, 0x3421d316edd50418,
+       0xb1d8a064cabe36ed, 0xdb13e560362efcda, 0x567c2b6cc71eb3ee}}
+    },
+    {
+     {{0x2af8ed8170d4d7bc, 0xabc3e15fb632435c, 0x4c0e726f78219356,
+       0x8c1962a1b87254c4, 0x30796a71c9e7691a, 0xd453ef19a75a12ee},
+      {0x535f42c213ae4964, 0x86831c3c0da9586a, 0xb7f1ef35e39a7a58,
+       0xa2789ae2d459b91a, 0xeadbca7f02fd429d, 0x94f215d465290f57}},
+     {{0xc08550024b950889, 0xee99dbfe8ce24da0, 0xdda71d964318e860,
+       0x01d3d39604fe9b85, 0xda4bc065e25e7e20, 0xd3a50b87e076c81c},
+      {0x5b9f821931e5f494, 0x6a140527a6a1b821, 0xf52683e4d8dd159b,
+       0xca9c888720b18043, 0x73c040fa08a0d8f5, 0x92e482e8179525c4}},
+     {{0x37ed2be51cfb79ac, 0x801946f3e7af84c3, 0xb061ad8ae77c2f00,
+       0xe87e1a9a44de16a8, 0xdf4f57c87ee490ff, 0x4e793b49005993ed},
+      {0xe1036387bccb593f, 0xf174941195e09b80, 0x59cb20d15ab42f91,
+       0xa738a18dac0ff033, 0xda501a2e2ac1e7f4, 0x1b67eda084d8a6e0}},
+     {{0x3a828904a4d2313e, 0xbf4946b192e66888, 0xc574898ae5fa19d2,
+       0x0b13dbb65e1c5fa4, 0xf11343ba7c390fc2, 0x35b1418fd7d32187},
+      {0xc92cb1bb83e7fe7b, 0x0b969455d78365c4, 0xda69dfe5672f2af7,
+       0x9c62d7b430932441, 0x165672ad94af02d6, 0xd2cc734dcde81c22}},
+     {{0x1d27efce1080e90b, 0xa28152463fd01dc6, 0x99a3fb83caa26d18,
+       0xd27e6133b82babbe, 0x61030dfdd783dd60, 0x295a291373c78cb8},
+      {0x8707a2cf68be6a92, 0xc9c2fb98eeb3474a, 0x7c3fd412a2b176b8,
+       0xd5b52e2fc7202101, 0x24a63030f0a6d536, 0x05842de304648ec0}},
+     {{0xd45e350133f4d416, 0xbb40233a4bf9131e, 0x1532a088e302483a,
+       0x3475e8b82c2485c0, 0x08f9ea56969cdbe6, 0x31928645253cd738},
+      {0x1cf323a4ac9836be, 0xdf647ccf02b6e4de, 0x9a31e84fc06f3d09,
+       0xd326b86e39efe6d9, 0x77e3e1df14ac4dec, 0xf2d5917af3e0c582}},
+     {{0x67477cdc30577ac9, 0x51dd9775244f92a8, 0x31fd60b9917eec66,
+       0xacd95bd4d66c5c1d, 0x2e0551f3bf9508ba, 0x121168e1688cb243},
+      {0x8c0397404540d230, 0xc4ed3cf6009ecdf9, 0x191825e144db62af,
+       0x3ee8acabc4a030da, 0x8ab154a894081504, 0x1fe09e4b486c9cd0}},
+     {{0xe92b56c002cf37fd, 0xa75bbcb0f71b34de, 0x7754d0ef50f5c482,
+       0x850a9ef611fa89fe, 0x97d74b1bba4ea7d8, 0xfc757c25aab7ba2e},
+      {0x06f30ab0f2a67fdd, 0xb10aba1412e72af8, 0x47580bca7a2e053d,
+       0x85795598dcf0e14c, 0xc3596781d6f55310, 0x8ab251b74c9b7e18}},
+     {{0x512f82f9d113450b, 0x5878c9012dbc9197, 0xdb87412be13f355b,
+       0x0a0a4a9b935b8a5e, 0x818587bdf25a5351, 0xe807931031e3d9c7},
+      {0x8b1d47c7611bc1b1, 0x51722b5872a823f2, 0x6f97ee8a53b36b3e,
+       0x6e085aac946dd453, 0x2ec5057de65e6533, 0xf82d9d714bb18801}},
+     {{0x4ab138504dbb8798, 0x0e7980d772d04cd2, 0x1755c5660b3271c6,
+       0x8414efb09d9d1468, 0x61a586301795ce66, 0xb6a8b393232924a1},
+      {0xa992f0ceae031bd6, 0x6747fb5f2915acc1, 0x03daa26693e9c0d2,
+       0xc18fa3645400d554, 0xaf04ff8d9497e895, 0x86c3cfc250b6b339}},
+     {{0xad81fa938ba5aa8e, 0x723e628e8f7aa69e, 0x0ba7c2deef35937c,
+       0x83a43ec56decfb40, 0xf520f849e60c4f2d, 0x8260e8ae457e3b5e},
+      {0x7ce874f0bf1d9ed7, 0x5fde35537f1a5466, 0x5a63777c0c162dbb,
+       0x0fd04f8cdad87289, 0xca2d9e0e640761d5, 0x4615cff838501adb}},
+     {{0x376b2a7f04e1e6e3, 0xea0dcb70a31774b4, 0xfc7fe4cc5cbdec2e,
+       0x8568499df03f459e, 0xe9fd8fb28b78900e, 0xd33c6e30e431bf97},
+      {0xd904b8f5c896e766, 0xa8f577cf82748cef, 0x93dd921b87e044b3,
+       0x23d79837f76eebe9, 0x5e0a7493e569feeb, 0xd0797549414dddb6}},
+     {{0x9422789b110b4a25, 0x5c26779f70ad8cc1, 0x4ee6a748ec4f1e14,
+       0xfb584a0d5c7ab5e0, 0xed1dcb0bfb21ee66, 0xdbed1f0011c6863c},
+      {0xd2969269b1b1d187, 0xf7d0c3f2afe964e6, 0xe05ee93f12bb865e,
+       0x1afb7beeed79118e, 0x220af1380f0fe453, 0x1463aa1a52782ab9}},
+     {{0xfd9e3542bfe5b1a7, 0xb42d2a4175938cea, 0x74688a153befb760,
+       0x8daeeaa22e33dbe7, 0xc9c1ea083e677801, 0x68ecf4e434effe1e},
+      {0x927700ccd294c321, 0x9e2e723de940afc5, 0xbcfac07a7cf6cd43,
+       0xa009ef94d1006bc3, 0xa02016b0373d13e3, 0x4e097adbabae5822}},
+     {{0x7c139d56d7dbe5f9, 0xfc16e6110b83685b, 0xfa723c029018463c,
+       0xc472458c840bf5d7, 0x4d8093590af07591, 0x418d88303308dfd9},
+      {0x9b381e040c365ae3, 0x3780bf33f8190fd1, 0x45397418dd03e854,
+       0xa95d030f4e51e491, 0x87c8c686e3286cea, 0x01c773bf900b5f83}},
+     {{0x8db8b78cc898b8bc, 0x686896da502940cd, 0x67e50f022dde2e3c,
+       0x2e2461f38cbf406c, 0x32182781e1f7ff60, 0x26934b05e30e2688},
+      {0x95adc204fc4494f6, 0x4c7f30c5161b7499, 0xd5caf060b7341737,
+       0xed93187fd128d46c, 0x3f2819cb20fc1e04, 0x48c4086f2b7f70a1}}
+    },
+    {
+     {{0xd74d09c10ece13ae, 0x5e59d9e057a6bd95, 0xdb1ccfdce132b940,
+       0xa0e5309c843d3c66, 0x1fbd03a5f9cb3ef4, 0xcdc9ef0a00ea5177},
+      {0x1ebf5a15cb784a6b, 0xa67382af8a0d109a, 0x3256c37aa0d34d15,
+       0xee40efa50fca43af, 0xc299bbd4b9841bde, 0x6df68f603bef4a0b}},
+     {{0xe01295fdd9d7c50a, 0xaf31b4ea67f8ef0d, 0x2ec9689f9eaf8eb7,
+       0x327b96c5c622acc5, 0xae918f81b2757f2a, 0x74927d684fd6606e},
+      {0x09bb7fce18574215, 0xfea383bce8e68b72, 0xdf2a6f125fb47511,
+       0xbe88faa18e399520, 0x0166d57e3fb1c3a2, 0x5907ef2fe525f81f}},
+     {{0xf24fab9b57797e5c, 0xd85009873add682c, 0x75e370e733ac4fb5,
+       0xd8d61642c8a69765, 0xf057f10a5e30aa0e, 0xaf9530874f1e8637},
+      {0x887f06b3701cd1a0, 0xd7c6a9c68a200082, 0x4319f7eb6e6483a0,
+       0x44f1aaff475d4bfd, 0xa8ee73b50f811fc7, 0xbb67bcdc82916f8b}},
+     {{0xdefe3a7b8a37f660, 0x7898db8c858f5765, 0x7366c26a73d1f9b4,
+       0x35d5d718237ae8b7, 0x3efb20feb4478259, 0xccd0fed7aa545ee3},
+      {0x750edd05ed22d152, 0x4f8020f9ee20d4c6, 0x16e60f370a9e29dc,
+       0x9cf0a136bfbec7f6, 0xb430a34b2e47e143, 0x2e2560bbc6cdd1a9}},
+     {{0x2cb5625c2a9af85a, 0x9ba19601fea96b60, 0x25dd6acad7549809,
+       0x9c02e6135b4c31e9, 0x40c4baeae09dbb63, 0x38455db7f49beece},
+      {0xe9846d0d5b848716, 0x9c63043dd2ebce35, 0xedee8e86bc26a79e,
+       0x70c46f940869c85f, 0x34b059347bc49e34, 0x737fe693a80d7d8e}},
+     {{0x799352dae4161a65, 0xe5cf7ad856253ce6, 0xf606bf796de32775,
+       0xddc0f3a357fce8db, 0x1075fc2316cf4a47, 0x078f0e04b27c5ad8},
+      {0x9fc477953f7100aa, 0x3ac489254673ffa2, 0xb8263f42f9cd8348,
+       0x5bdfde3068cc92d5, 0x2250927b1ac37f9c, 0x26ec8328b33da359}},
+     {{0x76923635236eaa28, 0x5acc650b657d0640, 0x2652ec7ec20a58ab,
+       0x93385f9f1a5459f9, 0x45952d39306e2091, 0xb31f5a4234cef2f2},
+      {0x0d9b04841f3c055f, 0x6c5ef8eeae3b1f4d, 0xd3fdb464bd24becd,
+       0x49b11a10a2210148, 0x73de28551472893a, 0x99435b576ee531f7}},
+     {{0xf186d6bcc88d568a, 0x872bc4c7528535dd, 0xc9e7432edfe64dc3,
+       0xd9fc4832d795ea57, 0xf4ffdb81c845af2b, 0x66d7e7882b670517},
+      {0xa7c1be04d7b7a1c6, 0xbed88479d5b2a249, 0x62ff8aba03f2ef6d,
+       0x60ecaac420dc701d, 0x9f4b559f4ff10119, 0x0582c9313cd54fd0}},
+     {{0x271f5d703940d5dd, 0x7707d109192fb2b6, 0xc6131828da210560,
+       0x217500480bc534c0, 0xa96593d123487a61, 0xdab1698b0b9c6e92},
+      {0x8a7951a51f7abe02, 0xa9394a4becd49e72, 0x95ba141d2f6f53d5,
+       0x038093796cdb90cc, 0xa5e0ebf30586a3ef, 0x75f006dd70606681}},
+     {{0xea9da8f012bbaeb6, 0x3fba06b18c9f8360, 0xc11bd7abb28c0ac3,
+       0x1e05af2faa8a01bd, 0xae1e99c5f000b1c3, 0x93ee806453d79930},
+      {0x5728089e4c4f5513, 0x755351f3b1f70b76, 0x187ac651675f77ef,
+       0x5cf7bfb553067d84, 0x629290838174b5c0, 0x720e20798d5be74d}},
+     {{0xcdb0e97415c26385, 0x7110dd6840c9a381, 0x1fd856578180d82b,
+       0xa42cad51b97cf516, 0xd0e97506c8e096e2, 0x9372ac5cac077c1c},
+      {0x080cac77528c6d23, 0xa62b7b39c192bee8, 0xf1b2be68596c03b4,
+       0x9e367c6765cdde1a, 0xdb0a51dba97f58bb, 0xa9b52c4dc29dbc0d}},
+     {{0xab8cc09ff5eb9ad1, 0x97a4de76132edbfe, 0xa2e11c548baf6347,
+       0xcee54229683cfcf6, 0xe1e993b8dcfc6555, 0x333bf16abe9df066},
+      {0x5207e093060d62df, 0xfa32324d69b0f5fa, 0xef16fbcfd3243d2d,
+       0x540a2e59f04f8e45, 0xb5e70f9c48317bba, 0x00dbe9b25b35baa1}},
+     {{0xa7c2e95104a6bdf1, 0xe7b5001045310414, 0x0ad7ac85250deed3,
+       0xeb7ad46507fd3b65, 0xcac35e8c6bdc321a, 0xf773a3e9e992ce8e},
+      {0x99cbc6510f682437, 0x62f7b15d7ff5f4b3, 0xf3c08dfd6d131441,
+       0x8b998754fbb0fd4b, 0x88dae889e061d5b7, 0x9f6e8dca2a346488}},
+     {{0x0eaed675ebb512ee, 0x347e0756058efbd5, 0xadf792ca296d3d47,
+       0x57f00c0a4654d012, 0xa1e08a04bccc5803, 0x610677f05b2f11d1},
+      {0x0d9393d7b81acfd2, 0xb258e1570587c219, 0x372a1857b4ceba47,
+       0xe1ce8bb53ecc1c5d, 0x7efdf301922cecd0, 0xcab8cb170d8aa653}},
+     {{0xc60f118ad85124dd, 0x4a045272a77febb9, 0xbae0edf545555221,
+       0x1fb21695ab65b900, 0x9179d546d56b9882, 0xead5f78e006bc680},
+      {0x6c3ef1c1ed9d8095, 0xe22832c1d024f8cd, 0x8c783b9d157c5363,
+       0x25c1bd7e000d3603, 0x4e76a723e8ff7a81, 0xa55cfcb44a955196}},
+     {{0x31954a5679d05497, 0xc12520b6fe76d4d8, 0x8c433ec5e37ef1d2,
+       0xcd0f203575bc3b66, 0x3723f145249cd98b, 0x1356e0d2ea3b42a3},
+      {0xf607fee0f174c7b5, 0x318afc5e0127be39, 0xd47b5d74cea5417f,
+       0x6891940a10fca22b, 0x5cea41332b635e8b, 0x93db2ed6b5934fef}}
+    },
+    {
+     {{0xb1f4fead41b959b5, 0x6edb53a9e71890c0, 0x48b47efe2e28aa2a,
+       0x70dad2e9b3151d67, 0x87a8178b436a3460, 0x0f86f9f5801f7af7},
+      {0xfab462e3a982fc14, 0xe29126bacb03e978, 0xb4696b3fe6681282,
+       0x3bd9910a6a3fdc1d, 0x4409128449e37dac, 0x3b4bfabccf605fb3}},
+     {{0x57edf71edf9a9f18, 0xbf834240627a0b79, 0xb37aba1aa6934160,
+       0xd45b3d2c5e639a54, 0x62c6b9ad70bce957, 0x16bc35a75d7e87f3},
+      {0xb021698266b4a982, 0xb56050dd0e51c9bc, 0x15aa692b478e4b91,
+       0xdd67cf29be3fe25a, 0xf1ef75b006bdd4a8, 0xf71a285b41df627a}},
+     {{0x3176a43ab7a3ce87, 0x9fa09e975f130e73, 0x971cc37b9368e156,
+       0x2cabf535b8981792, 0xaec2862e4d0f0bc0, 0xa1a48c183ce8c100},
+      {0x288f4e694af2eae9, 0x778845f21f9339bd, 0x1ef5fdfd17dfaa6a,
+       0xc784117e3483a6fc, 0xe8c82f05f3c5c19e, 0xf39b3c1d1da87ab6}},
+     {{0xa58a27c58a541be6, 0xaf66949954fd7683, 0x2431826600079a25,
+       0x113f6fcf2606caf5, 0xf6ff2be316cb28c8, 0x8f7fc60e3c17caa6},
+      {0x8ea577e07d35e26c, 0xc3e744c0f0628903, 0x4b28eff4592a57ee,
+       0x76e1f87c5e3f67b2, 0x40d7a676fb008902, 0x68a9dc764b6e6b7e}},
+     {{0xfc14716fe4fbe1d8, 0x711c4f6088d5fc05, 0x53df27118ab2552f,
+       0xeb4a3587b3039434, 0x84223085825eba03, 0x1aff30b7f69569cf},
+      {0x752a2b2530d38055, 0x8fb8ef5e7dc7727e, 0x8f0b8bea679f84b9,
+       0x076e7b05004815a9, 0x9327503765debb2f, 0x24f92c7983a686b0}},
+     {{0xf9597802dff082f7, 0xb47fcfeeeb44042c, 0x0e2570c98ac1e9a9,
+       0x144f57639168391b, 0x7c5fe9e6fe49b3b2, 0x30dd5a41e1202056},
+      {0xb0866f7ce5132272, 0xaa2d7c60199d029c, 0xb37c32322bd29ff9,
+       0x6c0e511b29bc5c36, 0xb64e16b6baa69a42, 0x9fd7d79b28545caf}},
+     {{0x0620003c0c3576d3, 0xa9608ecd31b24876, 0x7dcb576a2d83f362,
+       0x88a3a38a7df98941, 0xdd182e8ab3596afe, 0x9c740d01e02a5357},
+      {0x2fed2fccb75d5d3b, 0xd0ea6d508d34ca34, 0xfe4b87438f4bd1dd,
+       0x73c5acd3b130c5c5, 0x9f8b08172dadbb20, 0x34b74294c5a59dfc}},
+     {{0x76e2751a12575913, 0x2c6059914a5f8c4a, 0x58322dfb71fba662,
+       0x228aec085e0886af, 0x8d83b6276aee544c, 0x338f5fb6e29f9639},
+      {0x1ba4cfe0bf5e19fa, 0x2eea84c5b9e4f8f6, 0x7e0eed58cee95d92,
+       0x2d29282abe535540, 0x866638b607a9a1f4, 0x915999776ab8dc82}},
+     {{0x6741d444a2144cce, 0x06ce4c04771c7c6c, 0x3d5bc2d2ae0ff352,
+       0xa0ae03ba0e05ca8a, 0xbf718851833183d8, 0x7095f4d4ccdc956f},
+      {0x23268e4ab3ab0c80, 0x984cf1ebc16c6dad, 0xc233314567120ec8,
+       0xc615f60e9cd9a03f, 0xe9e35fd3b3d16871, 0xc9b9853d15e76b83}},
+     {{0xd8e314abbb7fefd2, 0x74d946baaa61ea98, 0x10cfd8b500fd45fb,
+       0x87dfda88357f8e42, 0x6dab4a2f27bf7a3a, 0x4dd49a1503b613f5},
+      {0x1f5491dc74f2c1a8, 0x98d17370cc8ee02e, 0x01ef39fe3f141b03,
+       0xa5b046736984d4c3, 0x10c401834a926cdb, 0x3e7bbe18e2af1758}},
+     {{0xda178c95c2faa336, 0xb4ae744b68d20d12, 0x5b75f4e95e066620,
+       0x4138315f41e95800, 0xf5c97da9010c2c6a, 0xbc4ff40fe07bbf8d},
+      {0xbdd6bc9f21709050, 0xf3f4dcf2c5f7bb78, 0x584ce0309b1da924,
+       0x44b81c48ec3d9507, 0x1dfab02173e1961e, 0x9212120ea77458a8}},
+     {{0x599ece96f9612455, 0xe1c6eb81c725cba4, 0x2afc5ba86373ccee,
+       0xe4556833c64f7261, 0xf29ad540414ce1ab, 0x7094e0673ee82a77},
+      {0xfa26eaa0dc9716fa, 0x340da4be9ceb36af, 0x9570ade54e1c94bd,
+       0xf4a86d8e20b0ddbe, 0x967ab653dc6eff6f, 0x48890be5e8bab7a4}},
+     {{0x74ee2fe8c96437e8, 0xeafe095d0bfd2bb3, 0xc75f0e53103d0a33,
+       0x2219080170f13700, 0x96684d5b101d133f, 0x6c98178ff21b224b},
+      {0xe30033161d59dd67, 0x933de68f734e7699, 0xa3883631a305ea84,
+       0x21afb4d06d66c90f, 0xebeecc72330568ce, 0x6b65b75762b5a3ae}},
+     {{0x4069700ff637841c, 0x6ee84605b1c94076, 0xcd64ecd7829e1bc4,
+       0x606944a845cdda86, 0xb0f2d5fe58f036ae, 0x0391590aec18a23f},
+      {0xe29e38911a82e6c2, 0x5489a6286bd4a55b, 0xf3e7a3517ae6380c,
+       0xb3272f236ae0ae07, 0xb605a039e66cd800, 0xd4e522ea2aac1b66}},
+     {{0xbb9d0b1c8b153f87, 0xa3d52cbe518a921d, 0x232a29d22110cd42,
+       0x9083e2258a40d59b, 0x3b00382eaa50f55d, 0x4ad64680c02cf900},
+      {0x2f25bd2636cad5d1, 0x9c693e8564eb9c45, 0xe4ea93e5ccf60708,
+       0xb932b958f9270541, 0xee93f51f5eb454ce, 0x1e82e35438840e07}},
+     {{0xa16c79cfaf4d260b, 0xfe853f6cfab3c3c8, 0xb8bd6aa0c2f47e68,
+       0x277d590f2c9b4914, 0xb6d1c810097242a8, 0xcf2f3d8e45f75512},
+      {0x2176162b74a20c3b, 0xeee8bcb82b2bcdda, 0xfcf8c0d1a503aee7,
+       0x5d1f94a57af4dd78, 0x8f0bc1a62ab43be4, 0xd22dbf16ba9e071b}}
+    },
+    {
+     {{0x705bfe37b4e814b3, 0x22f0de61702013c6, 0x811e77a9bc456797,
+       0x4f52c4e617081a2f, 0x87405d819fe1640e, 0x53fa82b7707711d7},
+      {0xdc6fff830ee4aea6, 0x8413e22ffd60373d, 0x0ecb66bea9cf3ead,
+       0x7418372e87139b8b, 0x6aaccf295e42b4d7, 0xb6dc592531fc932e}},
+     {{0xfa3b4c8eb88ee8f9, 0x1f288e60b521ab57, 0x06aa39562e8c4d8c,
+       0x4981c3e5cf89935b, 0xbdbd0c4745fa071e, 0xa78f831c496073be},
+      {0x09a72986a4e5c001, 0xac527731709cb728, 0x9a64b5b3988f2781,
+       0x6ac9440d73b1719d, 0x58ad54c7e3d2e807, 0x1c1574488f06742b}},
+     {{0x6b5b7b2a75c953b2, 0x927ed77ca7f1cd5b, 0x2e8c53994cba0e5e,
+       0x03aeb14a3f4a941b, 0xedbad9a0a1385c8a, 0x925a49c167fd2258},
+      {0xe7e368ee3365ffed, 0xcc4aad2dd106eb87, 0x4ce908daa980b53b,
+       0xd3f4954016929ac8, 0x613c804dd5c05c32, 0xa42290ccd7973344}},
+     {{0x33952177a98cf218, 0x841d9e1f579ee53a, 0x1084d61e0a285bd5,
+       0x3935a84e71171b1c, 0x8ac2433cf29b29f9, 0x5dd868b56dd1e9bd},
+      {0x88da04788d102390, 0x1140735a657400d1, 0xa792a25f9d5b19e1,
+       0x9ee015cb6a27fa79, 0xea3bf8b57ba16a8e, 0xc5f0cc26c15fde67}},
+     {{0x2e152d95ee2c3290, 0x8437df2e4a9ceda4, 0x4151754e3c7ebfd1,
+       0x556c59a888f80aea, 0x8d099c5d8de44dbc, 0x9ecce7fc77abeecc},
+      {0x5e0a0f383aa311cf, 0x99ff1eecb8f2bff5, 0x5ae0b483b5dcf488,
+       0x11212c4591483a02, 0x99fe0738312134a1, 0x3b855db0a72745ef}},
+     {{0x37f50e43892c8eec, 0xf06a2f047d85a7e2, 0x3916af85e1d11150,
+       0xf56e852f6785ae1c, 0xbf8c72adae6ada8c, 0x1fcd53e3e13285b2},
+      {0x5327920cbd56d348, 0x82a394fb445658a8, 0xa71328573caf3792,
+       0xb15ab34b550ffe1c, 0x818980666a5d4e4f, 0x0bda153b2f854f9d}},
+     {{0x77a31009722730fe, 0x93707ac4d5cdd297, 0xa290be39d3811e8c,
+       0x831a9b9592a5cdb7, 0xc74cda84e7342270, 0x964661903f48affc},
+      {0xb0496cca5520b0f0, 0xc8742cd9bae930ff, 0x3a30737aeaea703a,
+       0x0a8e6fb7fb758854, 0x9ab9523e6796f4d1, 0x36e6c05dfdf7140f}},
+     {{0x3b62315064ef6a95, 0x97645381aaa5b792, 0x4bc2c31c56471100,
+       0x4a0e73bb1bae8d2a, 0xbfc0770a8df1f76a, 0x5089916fa7bb16ca},
+      {0x2afe5b1cf31fe82e, 0x0b06831df0119977, 0x97caa333a1af2a82,
+       0x93cb92c5dafed6cd, 0x09553e7e92c3b2e3, 0x3d9c4b7d61af2956}},
+     {{0xd83f574a08f84746, 0x48fc9715ca07f5f8, 0xb3d5d0d2dcc51638,
+       0xc2a5e3356153bdcd, 0x8242cd9a8aa4ef74, 0xe71ba25b0bdaa0d0},
+      {0x4342d4bba4ff172d, 0x81db10dffc1341a2, 0xdd93dd877dacb140,
+       0x6f8a4e81d12d347f, 0x0d4e7e461bc369be, 0x3ce10a771fafd0c5}},
+     {{0x5559dd31e67145b6, 0xf2d905b45b2427e7, 0x0d840fabcaf57d0c,
+       0x9625866578742ab6, 0xc85482ad409c1c8e, 0xdca2a058adaa6167},
+      {0xec26ad9a0c8885fd, 0x1b93b8a22a600cb2, 0x340aa7fc2539986b,
+       0xd7674876a23dee41, 0xa948a9292e1a9837, 0x9ae67d2a71438da9}},
+     {{0xeac6f447d56bdf1f, 0xb22e8425c2b502ff, 0xe1cc9d3dfca5a501,
+       0x8192bc29b64baf39, 0xeb2c901a52ce849e, 0x7f5f38b11dd506f1},
+      {0xfb3684b10f0a1d68, 0x16c4aacde9240ff8, 0xffa682435a4d8995,
+       0x27264ab554e4c95d, 0x9aa40cdc4f34ffaa, 0xcb8a30a35fd818ee}},
+     {{0x39038863f7f35053, 0x421a17f3328787d2, 0x38aa682ef3d8310f,
+       0xb52d41e8f4123153, 0x4fbef3dd7026310b, 0x0c6bd7adf6ff5692},
+      {0x3831c6b2a9be5d0c, 0xb5c9ae85e8d328b8, 0x76d26abc6516bba4,
+       0xc237f9a5446d35a8, 0xb2b16c0ff012a8d0, 0xddf2b7fe0ee0315b}},
+     {{0xbb85b640056ad6c2, 0x7c51ef96ac074372, 0x1c7ce31cf10b43fc,
+       0x08e4101b26f4d3a4, 0xd18511c43968459f, 0x00e20c3fd6d07839},
+      {0xd5bcd598e4fcdc11, 0x99e9a4d0c877f6a2, 0x9c5dd9d0bd491646,
+       0x83918f609bfd7a1a, 0x4bc130cd7e2b95a3, 0x668825fbfbc31c83}},
+     {{0x817d77b106a9ad54, 0x3a999d7d89a25eca, 0xd3ac4107da68b768,
+       0x6904bcddbebc4c4d, 0xb0d2103ca53d39e9, 0xdba86bd230a5e950},
+      {0xb09256804f52208e, 0x37c3156a28495b2c, 0x2389ab34c15855ae,
+       0xc14dfd963017194f, 0x420e07191146b838, 0x1a9f909b8fb4b6fc}},
+     {{0x2926ef17dd63404d, 0x0e89c4d41399cc68, 0x6507fedef7ec20b8,
+       0x1ac084ff88c751d6, 0x31bc08bedefe29e6, 0xd42199714f0692c5},
+      {0x4d6ee74236069bc0, 0x3868ef6aff80f3d7, 0x6df02d7c5a9c6f4b,
+       0x2c3096bb101abf69, 0x0c2b01ec8eaacaeb, 0x65914c20eb2e687a}},
+     {{0x13722ab079ed523a, 0x33b29bec249d5624, 0xd3d0f467f76fdaf7,
+       0x7ce072f912ddfd9a, 0xce918a5747bdefd3, 0x14d38ab4750e5315},
+      {0x08bbb20e3346f647, 0x428b917f05b26894, 0xc8fb5c21ca865ba6,
+       0xee6e41e02e6e8e6f, 0xd00ae6214c608b60, 0x659756396ff685cd}}
+    },
+    {
+     {{0xbbccce39a368eff6, 0xd8caabdf8ceb5c43, 0x9eae35a5d2252fda,
+       0xa8f4f20954e7dd49, 0xa56d72a6295100fd, 0x20fc1fe856767727},
+      {0xbf60b2480bbaa5ab, 0xa4f3ce5a313911f2, 0xc2a67ad4b93dab9c,
+       0x18cd0ed022d71f39, 0x04380c425f304db2, 0x26420cbb6729c821}},
+     {{0xca07923c0eb008c8, 0xab79402d9985912e, 0x41e379e83cb02510,
+       0xfabac005beb383ef, 0x24d12d9a1076dd0d, 0x95afd46fb208f127},
+      {0x9cc38a60b1031e46, 0x93e21e977009f6bc, 0x6f6360d98ac219ef,
+       0x1edaab3faf284c80, 0x9c3b5281019e366a, 0x6475c579bc9e9726}},
+     {{0x26bd07d6bdfbcae8, 0x10b5173fdf01a80a, 0xd831c5466798b96c,
+       0x1d6b41081d3f3859, 0x501d38ec991b9ec7, 0x26319283d78431a9},
+      {0x8b85baf7118b343c, 0x4696cddd58def7d0, 0xefc7c1107acdcf58,
+       0xd9af415c848d5842, 0x6b5a06bc0ac7fdac, 0x7d623e0da344319b}},
+     {{0x8410d8298d85a25a, 0x48ee01354af81a14, 0xae460d0d18c25348,
+       0x5d0279a07eb035a3, 0x87e7c1289a114414, 0x17c08a8ec0744f79},
+      {0xb7b2b4f1025cdbe3, 0x9a74f15d82d1af60, 0x124a7395b51ee685,
+       0xf2937c4bf6122422, 0xb4ec133207f1a7ff, 0xad801112f886032e}},
+     {{0x4c0d78060c9d3547, 0x993f048dcf2aed47, 0x5217c453e4b57e22,
+       0xb4669e35f4172b28, 0x509a3cd049f999f8, 0xd19f863287c69d41},
+      {0xe14d01e84c8fded0, 0x342880fdeafd9e1c, 0x0e17bff270dc2bf0,
+       0x46560b7bc0186400, 0xe28c7b9c49a4dd34, 0x182119160f325d06}},
+     {{0xdd4eb3d07bb5346e, 0x9a46ad01382e7db7, 0x1200285ddc1973c7,
+       0xfd342beaa0046b98, 0xd19173491219a7fc, 0x5383d319b7caffe5},
+      {0xea5a0c4e2e0fa118, 0x1cc2de3ca5457b28, 0x5b2a16dc6046eeea,
+       0x1755e1fecc8e64b1, 0x51e4946e9e7fadda, 0xf805422ffcbf4ec2}},
+     {{0x46d70888d7e02e18, 0x7c806954d9f11fd9, 0xe4948fca4fbea271,
+       0x7d6c7765bd80a9df, 0x1b470ea6f3871c71, 0xd62de2448330a570},
+      {0xdaecddc1c659c3a7, 0x8621e513077f7afc, 0x56c7cd84caeeef13,
+       0xc60c910fc685a356, 0xe68bc5c59dd93ddc, 0xd904e89ffeb64895}},
+     {{0xf877e8c6bd08ffaf, 0x24718fefaf23012f, 0x19ff269f2b004cfe,
+       0x8adc5d7795450f8b, 0x688ce8bce2a7d458, 0x74d7445b97bd7fdc},
+      {0x1b9f4ad641e6abad, 0x6652ed05f00e4bf5, 0xabee1f7e71d83d86,
+       0xe693c76d25ffc219, 0x1c9a84afc873f553, 0x84d2718766d77a55}},
+     {{0x75d874fb8ba7917a, 0x18fa7f53fd043bd4, 0x212a0ad71fc3979e,
+       0x5703a7d95d6eac0e, 0x222f7188017dead5, 0x1ec687b70f6c1817},
+      {0x23412fc3238bacb6, 0xb85d70e954ced154, 0xd4e06722bda674d0,
+       0x3ea5f17836f5a0c2, 0x7e7d79cff5c6d2ca, 0x1fff94643dbb3c73}},
+     {{0xe566dc057e5f7121, 0xccac74e22ed07bc3, 0xaabfdfcdc70401b4,
+       0xac9fc4496254e0db, 0x358d885f11c7de05, 0xb8e6a4a9d60772b4},
+      {0x884272a5cfe917ce, 0xdfbe98689a3d347a, 0x06b90848c9d1bacc,
+       0xc4ccedb6db8c6288, 0x892878b979e5683e, 0x1b521829243273e3}},
+     {{0x916e19d0f163e4a8, 0x1e6740e71489df17, 0x1eaf9723339f3a47,
+       0x22f0ed1a124b8dad, 0x39c9166c49c3dd04, 0x628e7fd4ce1e9acc},
+      {0x124ddf2740031676, 0x002569391eddb9be, 0xd39e25e7d360b0da,
+       0x6e3015a84aa6c4c9, 0xc6a2f643623eda09, 0xbeff2d1250aa99fb}},
+     {{0x099369c4bf0c6fbe, 0x976f78b2fe7d5727, 0x32feb503d18267a9,
+       0x162c41501a7dd0fe, 0x3141e37726b8e969, 0x50497a643b53a94a},
+      {0x96159f41607b4cfc, 0x1999b7042f111bab, 0x3254987c760f2eae,
+       0x5308075b841014fa, 0xc634127e4e7adad8, 0x32a70a6059ffbfe6}},
+     {{0x1feef7ce93ee8089, 0xc6b180bc252dd7bd, 0xa16fb20b1788f051,
+       0xd86fd392e046ed39, 0xda0a36119378ce1d, 0x121ef3e7a5f7a61d},
+      {0x94d2206192d13cae, 0x5076046a77c72e08, 0xf18bc2337d2308b9,
+       0x004db3c517f977b1, 0xd05ae3990471c11d, 0x86a2a55785cd1726}},
+     {{0x7279c369a1f857e6, 0x029d30ef27fb373a, 0xe82cbc806827358b,
+       0x2bfe09aaa18f57ab, 0x63bf3145e5503492, 0x7ea15beafb28ee43},
+      {0x8e6d428f5eec91b8, 0x215e03e9611b1799, 0xb995737161d476de,
+       0x2320c764e76726a5, 0xc5de88178e5e26f5, 0x24aae0699161e0b7}},
+     {{0xb8d9b28672107804, 0xb5a7c4133303b79b, 0x927eef785fa37ded,
+       0xa1c5cf1ead67daba, 0xaa5e3fb27360e7c7, 0x8354e61a0a0c0993},
+      {0x2ec73af97f5458cc, 0xde4cb48848474325, 0x2dd134c77209bc69,
+       0xb70c5567451a2abe, 0x2cd1b2008e293018, 0x15f8da7ad33c0d72}},
+     {{0x5584cbb3893b9a2d, 0x820c660b00850c5d, 0x4126d8267df2d43d,
+       0xdd5bbbf00109e801, 0x85b92ee338172f1c, 0x609d4f93f31430d9},
+      {0x1e059a07eadaf9d6, 0x70e6536c0f125fb0, 0xd6220751560f20e7,
+       0xa59489ae7aaf3a9a, 0x7b70e2f664bae14e, 0x0dd0370176d08249}}
+    },
+    {
+     {{0xaff4782231cb94c9, 0xf1b5a0b7803c1af4, 0xbeb85f8d2ef696a9,
+       0x8ce5baab4fa94fca, 0x0a32f96200d41a43, 0x0f69ad5774f6e772},
+      {0xbe0221af6ccb5157, 0xcb83969a2a4f91ff, 0x78ff85d6a7e49f39,
+       0x63006589cb5d3c63, 0xe8e4383596eb65f5, 0x79f59da9ff8adbdf}},
+     {{0x082ea61d10eeed24, 0x7c9d5ade143fd59d, 0x7d33df962e54f5cf,
+       0x340b0d36e39dc6ab, 0xd97a8b848d179b13, 0x88184bb0288d388c},
+      {0x2237e507e116ae6d, 0x3e97b063211b2cf0, 0x645f8bcb42be7459,
+       0xce2b0f54de2176b6, 0xaf570a09d1e2f09c, 0x110adf5657fdc001}},
+     {{0x9d21c740842e4246, 0x30f474c44ab098a5, 0x57f8b1a3aae5d701,
+       0x477e4f8891978d15, 0x2913ffb40fb85b1e, 0x80aedb2258489fb4},
+      {0x0e1ab2670912d86a, 0xea5e6a4182933f3a, 0xf578ccb657ab8d86,
+       0x339fd796547f64bd, 0x904693943f3e497e, 0x2cde596c1d864706}},
+     {{0x158bfe27bcb6db29, 0x967212410054d963, 0xf07b153b8e71aca1,
+       0x5e67698171b11643, 0x77b7dd7dd04e2f90, 0x07814aa6f0dcf109},
+      {0xd3bab2a4fe1d0b1e, 0x50abba31be69e691, 0x54fe99afc6f53cd9,
+       0x071f2a4f628039e4, 0xf1f44181b183aa16, 0xdf0138e05010f6f9}},
+     {{0x5737f903aff45947, 0xe576f8ff62c5dfd1, 0x2a7d4f18e1e379a2,
+       0x8596ffaff2f26f8c, 0x12f49653fab86608, 0xcc6184973aab1eaf},
+      {0x7b5d029f865d9611, 0x87af2d58bf6861f5, 0xb765364631b2d7cf,
+       0x60f47e058be46ef9, 0xa21106a9b1c175ce, 0x21cb0e27deb065b6}},
+     {{0xb287e26db340f4eb, 0xa397cfd1b34c2948, 0x0d91d7639a7ead15,
+       0xd71901b966e88f14, 0x02447ad3b4884ac2, 0x5e6f7545d006f448},
+      {0x2af6bfeeec5744e3, 0x643f46b1f55cd6ab, 0x13400bc487b2c127,
+       0xd1dddff44629859b, 0x9710cae020feecb9, 0x594bc27cd02d4300}},
+     {{0xb0233c4daa331700, 0x3bf63a6130b3a854, 0xc269d68b49b806e2,
+       0x4a079274da8ddca6, 0x256bc0090db04d76, 0x7395c11c1f47dfee},
+      {0x51bbcc9513886ec2, 0x9d5377eb244d1f0d, 0xa6e0f054ff9e6b3a,
+       0x307f9e93204e5258, 0x8069c01d8d34d97b, 0x30f785ce43c24997}},
+     {{0xb1e365019c77ca60, 0xfe084a2301018e14, 0xbf451d2ca4bfdcec,
+       0xd210892fb29cdcfe, 0x5b12bcd894514871, 0xd03ca18c1809b1e3},
+      {0x09b243115858e4ea, 0x37b30d50e57524b4, 0xcef0a16b5de334b5,
+       0xfe0bd1e20b116076, 0x54e4b48289ae2bf4, 0xfbcc5e1a68c8a937}},
+     {{0xf747390291ae19fb, 0xc1c228d31bed3f8d, 0x763ba8ee6552154e,
+       0xb7b60248e2063ce7, 0xafaf01b8178a5184, 0xe193b8347901d21a},
+      {0x1d29f7d6260eb30f, 0x030516c6c23b4b94, 0x30a8046a7dc4a09a,
+       0x8414133ab5ee1147, 0x7ec8dccf4453f1a6, 0xe380e69c59da8e8d}},
+     {{0x28fdf72f22c77f4b, 0xfa077b1532485220, 0xc3801fafd6325081,
+       0x8dd4e3c9891ff5df, 0x6726c5ecaa73c827, 0x12af9707e9b9b128},
+      {0x5e6ae3cbff25cf07, 0x0613bef8d7cb7adc, 0xfd426caacef4cd47,
+       0xe14ed3efced0e435, 0x8323a8616000ec80, 0x58221041941f8071}},
+     {{0x6f766821a83eb17c, 0x91fe58c1bd7ff851, 0x7ce09f049063af8a,
+       0x5230b3c66c109e02, 0x501adb3336274fb9, 0xcfb34bec90547af3},
+      {0x622d138740f61ec9, 0xdf26e4c60e3e98d1, 0x6b3b3d627c676ee3,
+       0x9f841097f0244737, 0xcfaf6ead4fc8dd58, 0x4f5d463bcd534ab4}},
+     {{0xa5023e1364be0f56, 0x6a7310e00046f45c, 0xe0af09aeec8700d3,
+       0xdea5fb7ceb2d38f0, 0xc038eae6859852e6, 0xd515fb4c8c34f04c},
+      {0x546b778e1488c207, 0x8cf4f1146258d8ba, 0x474e60d85182c96c,
+       0xcd0387303dbde757, 0x387232f876ab01ff, 0x277614f628231392}},
+     {{0x930c3c5980b86bc6, 0xebc8c144a06d10a8, 0x20743ddd81e55432,
+       0x059521d4006d3073, 0x8d4fe30312dbc785, 0x15a4debcdf4901d6},
+      {0xc9b226b1b37b2d8b, 0x385ac3c90fe9bdbf, 0x64df89f7feaa5bff,
+       0x67de8e0381de42ba, 0x12bd83225bf63f6f, 0xb499f8ff32b4ec13}},
+     {{0xba0800b89608c827, 0x560c31f547dfcd84, 0xd52e8fdc520dba6e,
+       0x66a917c2854fa4ee, 0xfc543b79c6e5d664, 0x5b64369232b530aa},
+      {0x427dc1ef563a3933, 0x4e47c92988d5902f, 0x9eff3a4093eca4fb,
+       0xc5b396ee59260a69, 0x936a506248e70137, 0x69eb44f621bba959}},
+     {{0x0af34aa7ab9f58a2, 0x0ba16d987d150dcb, 0x444d5495b7c119b4,
+       0x317a55e55ecc3210, 0x8fa3b3ceb1aa90c0, 0x8e7c75390b2e9392},
+      {0x5ee5f3e8e8921afa, 0x3934ea8da3100dd3, 0x955045b14c8ae6ce,
+       0xa54acb5f649897fc, 0x4204fab6e7081246, 0xec3dc9686dce3a55}},
+     {{0x309b1eb33ef5a413, 0xa7607981a81f43fb, 0x87c2b81ebf8a894c,
+       0x27a40bce0d293293, 0x7f4c315be4bf3714, 0x03fdc14e01236895},
+      {0x319c88f8dff053fe, 0x146bb448ea3fa121, 0xfcc2a05df0dd1380,
+       0xc8d55b024acba9fa, 0x871358de5927313e, 0xfd1d81d317ce294a}}
+    },
+    {
+     {{0xd3797831ff63ae69, 0xa753de02ce4c7eaf, 0x2ff7a6a611a4e339,
+       0x904f86f05328043a, 0xe29d31c012e9f7dd, 0x8825a639c0a51904},
+      {0x070c2696ebfc2cc7, 0xc03ce643c5f7a943, 0x5b970d0c12c8a1f5,
+       0x572aaaa1ab352a83, 0x63df45a90c5eb0c7, 0x95c951e1d4977599}},
+     {{0x2c5b0e42bca07a42, 0xbe57f3597a0dffa1, 0xace485959aa90727,
+       0x32be886af658699b, 0xce75d6c6da3b18e6, 0x9d563e4f69caf667},
+      {0xc17c66cf065eb772, 0xfbe123814df9f6ef, 0xceb80041623db4ef,
+       0xe75615b2c74762e1, 0xade8a5438671c52f, 0xb713c401cacaf2ec}},
+     {{0xe6d039ef467eb167, 0xa7e0959d74696cf9, 0xf3a19b9d7078d8a0,
+       0x5d4ec99c07cdc6f6, 0x4842d0f98386eed8, 0x48f5ab80545fc0d5},
+      {0x8906fc626d39c2f7, 0x1c050d691bf5366a, 0xac506c579f54d0d6,
+       0x9a356a6ef9e4b94c, 0x62632c5108a75e61, 0xfc1b9fa5c6951dc2}},
+     {{0xa933aaf7a4886619, 0x9ec1915f4af13c7f, 0x25a9dff8854de496,
+       0xa8b31d9b247bec15, 0x468a25c84661e58d, 0x8989c046786a0707},
+      {0x282db8cabb66922e, 0x73bf240d45ca29ff, 0xa2c40faaeaeda06e,
+       0x69632929add94b47, 0xc72354f6b0069076, 0x8d197fbf7878e92c}},
+     {{0x69a9ebd8a83bbb88, 0xcbab0b5a29f98875, 0x325e487e4e7611f0,
+       0x90aa24b1d955cc3b, 0x840e70a13c264d53, 0x15bcf88bad7f4f81},
+      {0xe47552cc2cf0df0a, 0xcb99973379205ea9, 0x25dc58bd10d5ca45,
+       0x0947d7151228b978, 0x9a0204da4f2c7c4a, 0x4377ea4a4690052c}},
+     {{0x015c325eb8e79179, 0xf4fc61335b57dce6, 0x27a51e5d78d6858f,
+       0x13babcab4dd5f180, 0xfaa19cb1847e499e, 0xe2688ae608aaea61},
+      {0xe20d7edce86100d5, 0xa9b0d46bed2fedac, 0x5e99cc0c1d357ded,
+       0x4c1263ab723cac89, 0xad5f3e6ff15e22f4, 0xf25f3950d77dae65}},
+     {{0x3c0e2b9737e8e6b2, 0xa2037913575da8b7, 0xeedf0a75b925cbb2,
+       0x4f28ec1bc561b405, 0x368fb2742901931c, 0x52b54eee2f26221f},
+      {0x381845b6247812a9, 0xf9bcc9619115a0df, 0xef127dfecb84d25b,
+       0x4256afe5fa10e0a7, 0x0c08a532353a15eb, 0xbbd15b176a91e61e}},
+     {{0x854b05846150771a, 0x35fdd9b4d9ca9868, 0xec8293894c32fc71,
+       0x882fad4c9ec8f90d, 0x2d39990dc6c7b9c0, 0x7fbc201bd71a25e5},
+      {0x6b852e655166da7d, 0xc6bde23a3d8c6e36, 0x370011545857f048,
+       0x746621fc1ccb9bc8, 0x97e44e63612bb853, 0xabc3b450758da4ed}},
+     {{0x856463a8bb44db8a, 0x18ec5abe4baf2f64, 0x75efa67d92980518,
+       0xabd300f894b03911, 0x4ea44bd4c1cd1cf7, 0x525c3583124ef41a},
+      {0x03c18c0a6b3a701c, 0x5ef82731cc7b6885, 0xb3716386a00d0089,
+       0xed9af50c741c0ea9, 0x31f0e49a8a36f03f, 0xce993757ca724a16}},
+     {{0x2b6bf5e29a90c6b9, 0x9b134fc8a2c0b35f, 0xd64157f8a6717af8,
+       0x7228156c45dd16f0, 0x0a9ab894daa99226, 0xa7b130f7bccb07e5},
+      {0x2b7ab41f4d9243d5, 0x570b4ed088568fa4, 0x666b98bec9c84d91,
+       0x2a75793d02124f7a, 0x0fb9b82e0aa16891, 0x71e94c933cc7f2d7}},
+     {{0xb7c13bfbf47211c0, 0x738fe4a9e70929ae, 0x4cdac99b423db6f3,
+       0x3883201ae4255a4d, 0x7ffe82d39730d749, 0x033ba755afbaaabb},
+      {0xa302ba65f836d62b, 0xc626f604143a88bb, 0xe1d189aa31c16b3f,
+       0x4664c0507d68ab17, 0xcffc651cc02eb56b, 0x6c52f3c46ab49c24}},
+     {{0x587758578fb415b7, 0xab580f159e88dca3, 0x86a12e3da62265d2,
+       0x8ec4278672d98b08, 0xb9da8016f61e9c85, 0xa895aedb800994ce},
+      {0x63d0878ce38ef526, 0xa081d7141efb6575, 0x780b9e126a1c1efa,
+       0xeed68d0eebd0497a, 0xbfeee3d29265231e, 0x46f751da80e03127}},
+     {{0x806dce0b03e4074c, 0xd40547006973bc6d, 0x8c4d393ea2897b68,
+       0x7d592d04c7f9af16, 0x0625826a4f895dbf, 0x038bed2937dfc8a1},
+      {0x981862da4799d78a, 0xf34c18956675c1b3, 0x64de9a5b8706afd3,
+       0xc80ff68ef74e6ca3, 0x26a9042283ed8cf2, 0xc1f5ce5377a47011}},
+     {{0x0bd157834aabf727, 0xfe79d2dd54fce3ad, 0x242b18061a77ce78,
+       0x30cf6c32da7e489c, 0x854e43f8b2966f38, 0x6e5fb045a2dd4ea3},
+      {0xb2a48aecde3c9b7a, 0x66ac77e63625ebd6, 0x332a969b0bcbabe2,
+       0x19de27015be51225, 0xf26c73fc5b9b80e6, 0x98c9cbf791025007}},
+     {{0x1e41874ebc098b8e, 0x758ccd5f8a234773, 0x47ab76cac1bc847f,
+       0x377f32e9c540ceaf, 0xba8897c369c2df21, 0x6afacb01233c3a02},
+      {0xf1609b45fb54ffb1, 0xb7a98e5ab8f9c150, 0x607478b008b1977e,
+       0xa9500582d48b7a90, 0xacd841e332fa7597, 0xdf53373df9333957}},
+     {{0xd25f650804926a41, 0x7236b475514045da, 0x0b36031108b9b08b,
+       0x16477aff3fe92e91, 0x6e5f6cb103189ddc, 0x81ff008ec698a38f},
+      {0x02a09218c93adb23, 0x71fcecd3445d8fae, 0x55a15eac8fd6b76c,
+       0x1e37ec3611ef96b4, 0xd1b3b3fc30e433b5, 0x4951873351d174c3}}
+    },
+    {
+     {{0x7914213db8c9f82e, 0x7a3e4e38fc038e90, 0x6edae5a126a34238,
+       0xe566bf50701ce8c7, 0x3562e87555656e02, 0x48325ebfb4e8efbf},
+      {0x5f10a50466505ec3, 0xd8b9834b8da78aec, 0x49d1fc25cc2f2e40,
+       0xe973bb1caf5718c1, 0x9b8825dad2d6b890, 0x7de7885ee2f00f12}},
+     {{0xe37211be7ef79898, 0xa810387721344d16, 0xfdcd7e26a1b9f8b4,
+       0x5641e45d7d7f72d5, 0x5377c1bec449c920, 0xd3edcb0cefc7b2a1},
+      {0xc657a9ffe14b42fc, 0xc8f858c800831b07, 0x6bfcd1bcd020eaa8,
+       0x17534b0a3f6860c7, 0x8ce5722284c7c806, 0xa1d40eaf2bd7456b}},
+     {{0xe0c93007c9aa57ee, 0xebb2d47b8895a604, 0xb8aebc49c4fd6ffe,
+       0x2c06e1e573f300b6, 0xa019070d81628b8b, 0x2db1690bbaf8c1ea},
+      {0xb3fce6c8cc94ccd2, 0xf301463885bcdf4f, 0xb1e62616e2f82c32,
+       0x85581e2468295a54, 0x0f2e2ff5bf51f8fa, 0x940716f1155c1f6f}},
+     {{0xaed02b6b4e623856, 0x7a6d2bef3e1d74cb, 0x82226ec4654e7c30,
+       0x008ac003e7034bfd, 0xe343c5407fd6b555, 0xca1b29071b429d44},
+      {0xe0702a339c3ceea2, 0x48079aa9732694c3, 0x7e6d72f6d4652401,
+       0xd92655ed35f60043, 0xa0dbaac6273e8cc4, 0x0bb8f0f93c3ffb40}},
+     {{0xb41b87b6c95cd23b, 0xb99714ba55e371a4, 0xb138ee8f6f571ceb,
+       0x09c42be480146ec7, 0x275ee21eee9aa125, 0x0cef4d6f3a878b59},
+      {0xd436eb1ca801068d, 0xe2c5448c762b8a80, 0x243beee1f3640eca,
+       0xf979458b32bbba7a, 0x6bc26cfea63407d3, 0xd3b6e132392dd1d3}},
+     {{0xbc06ecab3de4ba2e, 0xf51ca0639e491bcd, 0xa6fc6fa0453c94be,
+       0x5460f943ed1a6731, 0xeb11656a4ec3f1fb, 0x2fcb2cabff1e7d4e},
+      {0x595264678fea2286, 0x838117a34e0bee38, 0x7bdf588824fd2ce5,
+       0x13df0c839f2c2925, 0x1bf621e6dee97f30, 0xb43b2558ebea6641}},
+     {{0x246c86608e729329, 0x39fcc41dd693dac8, 0x48a65b54c062a6c0,
+       0x368a57706a5a3101, 0xd143600f47ed1988, 0x48466d92a764ce3d},
+      {0xb05006135a22cb6b, 0xf1d77247edea070c, 0xb1ddd151617f2464,
+       0x7905069828b83fd9, 0x021abb26d70bf93e, 0x590b3c42ab5a5e1e}},
+     {{0x5906a35c1cfb991f, 0xb62a4f80740a7744, 0x65c8ac9136f84763,
+       0xf73b3debbe0f1dd3, 0x40358868a2d26c21, 0xd907e90a76792ae7},
+      {0x3ecea167668c3d5f, 0x731068f26754b49c, 0x6db891090e006243,
+       0xd29106e6dd94681b, 0xb40b8694a85a3de2, 0xc80c7bf1936b86cc}},
+     {{0x003d45d011913575, 0x866cb2dd87e1186b, 0x692f630146b69a22,
+       0xd296a55c8174c1d1, 0x77ef6fbe9f17af00, 0x6b588be93aa922e1},
+      {0x99ecb44f033e6dd7, 0x32edea2c1d22b7cd, 0x3122b027ba7006f3,
+       0x8950054bbb6ebc5c, 0x4f6d606182dab805, 0xc12055181bae5f1b}},
+     {{0x28d33e79e08c180f, 0x768c7794f6aec9ce, 0x5a749f3bce683c5b,
+       0x717629d98371fe75, 0x5e828fc057712c1d, 0xb46c6ed17e4c61aa},
+      {0x5d927bad5bccf95c, 0x55d6fc80d72f68ec, 0x560a99a398591dc2,
+       0xc885fe8a4836664c, 0xd18acd4226d79298, 0x05e4cd17185df1d7}},
+     {{0xebc60e21fcc83355, 0xc94dbc02d9119b77, 0xceb05a312f18ae9a,
+       0xa8462962b8f69016, 0x58dde5a48f67b5f4, 0xb8bdf9c9af3c234d},
+      {0xe95c069f80e85df8, 0x9d525e1bab3aa0e5, 0x73c8a92f76276d8b,
+       0x7feb4abd163530ef, 0x8ca949b35ef5ad73, 0xe129431e2e3d057b}},
+     {{0x9d8a925b60dec308, 0xb72e3efa6b3ea363, 0x4f53ca6ddfb534b8,
+       0x4e64874c6dd78a32, 0x336e5b46c2a146d5, 0x07c76d6398395201},
+      {0xa4c095228fe3e815, 0x887e659d3221cc26, 0x0ff92f64c36286ec,
+       0x57b1b903c3ebb08c, 0xc6bdc9b665f00c30, 0x826242269a46d36e}},
+     {{0xc782c16c1a0b619a, 0x8643d42bbe316086, 0x49d2966bc0daa421,
+       0x080b1cafb7b487e0, 0x1d33bb53144de273, 0x8bafce2d6faf7ed9},
+      {0xdafbe3cf408d4636, 0xf10527df7ee8835b, 0xe1123f3ee2e75522,
+       0xb388c64bebe27d60, 0x2cb38dc1e3f1f55e, 0x57ff8e43e34524d8}},
+     {{0xd67dc92b85653dc8, 0x8e0970af0bc93ab9, 0xb6f09baa8b87c0af,
+       0x5a8a903052760ef4, 0x2e2ae7561047bf85, 0xd049078f85bd4e74},
+      {0xced11ff83729f708, 0xdd21cbebd91068a6, 0x83d488ff24b3e911,
+       0x6e166fda1afd2196, 0x66a912114f0d2128, 0xd11078ed05c9f39c}},
+     {{0xd87003d3bdbdf0cf, 0xe9750b5b56c298f1, 0xc256c3a2b73ad05d,
+       0xe0779a192ee94279, 0x31d8b3c6279626a3, 0x469056bb90163bc8},
+      {0xe6aeabc623755853, 0x9fffdfe2896a6f4c, 0x15c1ce78a36cf41b,
+       0xd4c8c025eee41941, 0xf7a917ee7653be9d, 0xfa3cba9659d52222}},
+     {{0x913f92075f8ab132, 0xd5b6792c5c14080f, 0xefab4e2c787c3594,
+       0xa55d465fe7b7b7dd, 0x921aaad834e28e6a, 0xc4f3a35e12d6a7bc},
+      {0x109803c46115a5ae, 0xc023098ce709f9a1, 0x1a8c8bdb99c5bb66,
+       0x1cd1c2b6bc7c2da7, 0x50189c975f927eef, 0x493823d1229f9410}}
+    },
+    {
+     {{0x11a8fde5f0ce2df4, 0xbc70ca3efa8d26df, 0x6818c275c74dfe82,
+       0x2b0294ac38373a50, 0x584c4061e8e5f88f, 0x1c05c1ca7342383a},
+      {0x263895b3911430ec, 0xef9b0032a5171453, 0x144359da84da7f0c,
+       0x76e3095a924a09f2, 0x612986e3d69ad835, 0x70e03ada392122af}},
+     {{0x3ee0a31c6754f492, 0x02636c6b96769ff5, 0x90a64f4ff0fbfa96,
+       0x513f054efafea65a, 0x796ba7479cf4b9f9, 0x3198c068932a9590},
+      {0x93af8a65549ee095, 0xb8b6f72ca212760f, 0x23bc71e9c1a46c8f,
+       0x000643af4c9bca72, 0xb6d967c7848cea30, 0xe06b6b4e73312ec2}},
+     {{0xfeb707ee67aad17b, 0xbb21b28783042995, 0x26de16459a0d32ba,
+       0x9a2ff38a1ffb9266, 0x4e5ad96d8f578b4a, 0x26cc0655883e7443},
+      {0x1d8eecab2ee9367a, 0x42b84337881de2f8, 0xe49b2faed758ae41,
+       0x6a9a22904a85d867, 0x2fb89dcee68cba86, 0xbc2526357f09a982}},
+     {{0x52ec99561d85a725, 0x0f9be000f3208012, 0xe881337c6dcc7816,
+       0xe4e7b6d9791f7cf1, 0xfaa717aa59885a42, 0xb1bbb5c7f9c01e41},
+      {0xcf208d58a0361880, 0x24426e4020afa350, 0x7261871b264ce04a,
+       0x66be4a86cd42026a, 0xc5397b77829f99fe, 0xffe4a6bc24578e2b}},
+     {{0xadc794368c61aaac, 0x24c7fd135e926563, 0xef9faaa40406c129,
+       0xf4e6388c8b658d3c, 0x7262beb41e435baf, 0x3bf622ccfdaeac99},
+      {0xd359f7d84e1aeddc, 0x05dc4f8cd78c17b7, 0xb18cf03229498ba5,
+       0xc67388ca85bf35ad, 0x8a7a6aa262aa4bc8, 0x0b8f458e72f4627a}},
+     {{0x0733667af822d5f9, 0xd7f81b9e18339700, 0x7ca29b27a7bc265f,
+       0x9fefa698eb4f0c7a, 0x7b6f351301f27630, 0x72f0f152fcfb1133},
+      {0x9928d9d05c81eb14, 0xa16ac36bed8ff6cb, 0x7fbd1acbe041bef3,
+       0x7d25159af8d99854, 0x2ec3a7d8db5a0dc5, 0xd86fc4cc87e3e933}},
+     {{0x3fb812eec68e4488, 0x53c5eaa460ef7281, 0xe57241838fbefbe4,
+       0x2b7d49f4a4b24a05, 0x23b138d0710c0a43, 0x16a5b4c1a85ec1db},
+      {0x7cc1f3d7305feb02, 0x52f7947d5b6c1b54, 0x1bda23128f56981c,
+       0x68663eaeb4080a01, 0x8dd7ba7e9f999b7f, 0xd8768d19b686580c}},
+     {{0xba8418f34c20e15f, 0x7eed2494fb54404e, 0x4e6438d7bce1e82d,
+       0x9e489b3eb397915b, 0xa9baea9ffb4cf659, 0x8bc5b2ba42ef4aff},
+      {0xae3fb5337e62a188, 0xcd648493496e8e35, 0x89728e28defe047b,
+       0x63a8c679d24e60fe, 0xadacbf92470f710c, 0xd470aeb95e198d3c}},
+     {{0xbcd0e0ad7afdda94, 0x95a0dbbe34a30687, 0xbbe3c3df8c5e2665,
+       0x742becd8ebf2bc16, 0x300ceb483fa163a6, 0x0c5d02ee4663354b},
+      {0xe4fb9ad6b5e606a4, 0x93f507b8cf49ff95, 0x9406a90c585c193b,
+       0xad1440c14ecf9517, 0x184cb4759cea53f1, 0x6855c4748ef11302}},
+     {{0x8e3807dd7a3e874a, 0xc4edb45b89ac3a99, 0x9ba9cdaf4bfd77d2,
+       0x31d33f59b540fffc, 0x404c87790c60028b, 0x7f89da7189688c81},
+      {0xdd3390e5504b862b, 0xdf1e721be937efe3, 0x5833d0df63e6036f,
+       0x7712527a385fbab4, 0x6347236bd210c0d4, 0x12d7733c8d238e2d}},
+     {{0x00ecb523edcafa52, 0x0da0ae0e086f69d3, 0xc384de15c242f347,
+       0xfb050e6e848c12b7, 0x22f6765464e015ce, 0xcbdc2a487ca122f2},
+      {0xa940d973445fb02c, 0x00f31e783767d89d, 0x2b65a237613dabdd,
+       0x2be0ab05c875ae09, 0xb22e54fdba204f8e, 0x65e2029d0f7687b9}},
+     {{0x0ecb0723302e943f, 0xd180ca1e4a443e78, 0x39e7891123dd2c9e,
+       0xfa2a440401fe50bb, 0x4678e7ed154d39d1, 0x64ddaee1af513e01},
+      {0x6d4c615a634904da, 0x937c6326ba5c900c, 0x70658f5feb6c8582,
+       0x2a04fd51f3d65166, 0xcefe7472b676eb47, 0xd3565a71f597d887}},
+     {{0xffd825381855a71c, 0x26a330b3438bd8d8, 0x89628311f9d8c5f9,
+       0x8d5fb9cf953738a0, 0xcb7159c9edfcd4e5, 0xd64e52302064c7c2},
+      {0xf858ed80689f3cfe, 0x4830e30956128b67, 0x2e1692dae0e90688,
+       0xab818913ca9cc232, 0xe2e30c23a5d229a6, 0xa544e8b10e740e23}},
+     {{0x299520f4e5dcba80, 0x522ad4b52b758045, 0x54eabe27193b36d4,
+       0xda4d3bff45e9e442, 0x44cb9252637311f3, 0x4cd620a971338ebf},
+      {0xec908157cc9524fb, 0x2731a11ba8c955d7, 0x72a5e0545cb94009,
+       0x7eee8f3b9126cfe8, 0xc71e29203dd5d5ce, 0xe886f91a22069494}},
+     {{0x1c15e569dc61e6cc, 0x8fd7296758fc7800, 0xe61e7db737a9dfc5,
+       0x3f34a9c65afd7822, 0x0a11274219e80773, 0xa353460c4760fc58},
+      {0x2fb7deebb3124c71, 0x484636272d4009cc, 0x399d1933c3a10370,
+       0x7eb1945054388dbd, 0x8ecce6397c2a006a, 0x3d565daf55c932a0}},
+     {{0x294d29550db962c0, 0xd6994ef46d523ab0, 0xfa1a7f9158f95037,
+       0xb137981164420c94, 0x2b686e1e093caea8, 0xdef10944f9e1c340},
+      {0xcd1beecf611d9bf5, 0x34696c50a1b5267b, 0xcecbc7192dfc2b16,
+       0x2cdb955dcee7e854, 0x9fefc321f2635cc8, 0x276d2e4f2936f7d3}}
+    },
+    {
+     {{0x4962c02167141724, 0x5f81eabeabe7762f, 0x78549a79dd189c3f,
+       0x47675cdd6ce517a7, 0x5102294e32d6bb97, 0xb19500c66ed1a029},
+      {0x3efb54e8b16a206c, 0x7dbdcc250dc135b8, 0x955bc2948967fb04,
+       0x373615c9be04e909, 0xf1fcf820111efad6, 0x8530f97d6fd2e97a}},
+     {{0x3f2b5bd4b4805410, 0x201ca7a9f96c5ee7, 0x532ef2db94256fe1,
+       0xacbfc459318ddb03, 0x2375f9fd5f24c8e1, 0xd27c479b370783db},
+      {0x1bd461e856541ae6, 0x78f054a77f7ea49a, 0xc9f8777d8845f315,
+       0x81aed29697fc92c7, 0x9f2f8d7949929540, 0x7531e78bff5ebfe0}},
+     {{0xbd9a66d6543b3e41, 0x2948c0a62ae73774, 0xa75151dfef38e9b3,
+       0xa3348ae5754fb3fb, 0x1218fa8f13069b72, 0x532bb0510835dfaf},
+      {0x2121a98edf2be3c6, 0x85980de69e5199bc, 0x1b23a4be1a1eb6ee,
+       0xb5c48b92adeb3ae5, 0xeebd305dedea2b45, 0x20543f04c37198ea}},
+     {{0xd0960bd80fab968c, 0x6899e4faae028db0, 0x975ccc77a9850916,
+       0xb41bd531e5f81554, 0xbdf8ab57c8cff2c8, 0xea306a01f5822be3},
+      {0x1f0ac0e7befbdbbe, 0x72f4b0e960519f87, 0x22bd8b82e3cc86ab,
+       0xc43bde8d2b2beaee, 0x8168781e412617ff, 0xc5610627b7ee7096}},
+     {{0xc408553840671bd2, 0xccb74902599f8eba, 0x477a4a098d65e832,
+       0xc620c314f1241626, 0x05f2f152e7344054, 0x2483a2d96d83320d},
+      {0x167439d70e344da8, 0xa0c02b1b1002fb36, 0x46cb4a7030afbda2,
+       0xe74e3488229d4efe, 0xd371dce21cef3aec, 0x96e0592c7c3f2521}},
+     {{0xdec0e091cc5f4a6e, 0x055ff295201108d0, 0x2b371998dc202800,
+       0x1b650d830d5f5f9d, 0x29be5503a0226262, 0x0f3681ac185bf3f1},
+      {0x4f5c44b48c3e2c4f, 0xcfe74a51717814fd, 0xb0ce41837b52a561,
+       0xde143e3aee634895, 0x08f8310048d46b2f, 0x34b79d556386486d}},
+     {{0xa60659c4ee1388ba, 0x475a4d067eca29dd, 0xf1ef88c166470e08,
+       0x71cac87a687c716a, 0x994fb1ee86f43fff, 0x53ded2ef43384658},
+      {0x317d902456c41587, 0x6807f0ad9dea0f26, 0xfee8beaaa0b0d53b,
+       0x15c06a1fb0288c94, 0x4b9eab0347028bce, 0x6d2144351446bc6e}},
+     {{0x0869457a01a8eb44, 0x522239857a7bedd7, 0x2c04b0c600057505,
+       0x468be6e80b09adeb, 0x2f3bf32b6f81474f, 0xf54f949da712ccce},
+      {0x292cee424cdd8f2a, 0x3d9fdf6b9c221be1, 0xe54da66156f47b2a,
+       0x2ca76835840b5d1b, 0xb52adb6a8a6e8cf6, 0x8b416a6bdade153e}},
+     {{0xb8c3a1383fd55732, 0x4b3482432fd63498, 0x60cc7a0ff52c44d3,
+       0x9787f3569422c87e, 0x0fae617760ad9f57, 0xb9ac12d882e307c4},
+      {0x5231661879416b16, 0xe603cb9a91611196, 0x0ce22a84e34c3a39,
+       0xcb1912375b2dca8b, 0xcb87c2279e5b750a, 0x7feccba013a02f00}},
+     {{0xd3a66685a3cd6034, 0x74ad77ad3a283c3a, 0x0c903afb66644cd0,
+       0x34e18018c1f90202, 0x8fa168e70008aa04, 0x871573dfbe8e35ae},
+      {0x8841591ef4561f77, 0x55e3033dc6cd0f01, 0x44327c97fe1fa6ff,
+       0xed4e69d6dddfcba8, 0xe82e1e4252d907ec, 0x8a5d9a7179064b8d}},
+     {{0xa47a884cc26f1000, 0x9f04763444a4b7cb, 0xa5a2bf4e89813d5f,
+       0x83ce02c9d8e9318d, 0xf27312542c86c874, 0xb76a309602a0813f},
+      {0x1fabaa2d0c8b505d, 0xad693de04895425b, 0xaf7f5848a55ff754,
+       0x098a328feadfa222, 0x4c20adfb470c5898, 0xe4b23ead5d199733}},
+     {{0x37b29ca79a605b1a, 0x2ca364f630caed34, 0x1e538aae3c2ff02f,
+       0xc10c493c42c6a320, 0x92f18f28a2b9e130, 0xaf249c41dd0ed08f},
+      {0x42039a5270285f2f, 0x4e502f2ecfd3ebb0, 0x428219146e39b30f,
+       0xdbc809f170e820ca, 0xbccb5567d2781e34, 0x8c1e3bfcbe3d05dd}},
+     {{0xa29f0b6543eeed0a, 0x0b96b6a1fd8b3697, 0xc2454ada88f8755a,
+       0x57202337af85d4ac, 0xaddfc388a7aaef40, 0xc1495163b156a5fc},
+      {0x67abbbcb1f1a8775, 0xb83e3dd65958bb8b, 0x17119d0236dbf23c,
+       0xeb336460b954337a, 0x9b1010016f46dca7, 0xef862ae8bc991dbe}},
+     {{0xaa878db566befae3, 0x28bb9c9e05110c6f, 0xc3a57a8c4caa069a,
+       0xbb5b550e594a2753, 0x01ab80565187afb8, 0x1f7c9ed3b9255f65},
+      {0xcd669e2b146f6635, 0xa8f2d4b6cb9457a3, 0x0f0541aa849dba46,
+       0x2537bf022cc9c7e9, 0x872b4f59d79ac77e, 0x705c2219e0a44aa9}},
+     {{0x03b42dbb3849051d, 0xe2efcfe3f27a63a6, 0xf709a5ffceb478c2,
+       0x2cc86b82c4f7feda, 0xefa834e4066a1c08, 0x153b64ef309fd644},
+      {0x8cff4eb0e62168ff, 0x0d7781db095d9f3b, 0x01f8e1af10bce338,
+       0x14aa9a02139d8f2b, 0x1985d844259ec819, 0xd7758b213a072e8e}},
+     {{0x65f7d2c18565afc9, 0x764c897170fa7b82, 0xe268634c986436f2,
+       0x6334d8d133356165, 0xf17164269ec7957d, 0xae834331b8093983},
+      {0xedb1fe5cd2dfcce7, 0x6195b86368463e5c, 0x746e5f4da691b665,
+       0x61171291e1e2727e, 0xbb4aa8f16f27b029, 0x1037657d7f42c197}}
+    },
+    {
+     {{0xfe19901b0d5b855a, 0x5facb9552f745022, 0x92fd012556c4ce5c,
+       0x23172d65938c89ab, 0xa71f8a33aaa587b1, 0x511a3745b55c9c50},
+      {0xec005f6a7185086e, 0x6dfc2761f894c6ab, 0x98a4d67f9e26361f,
+       0x7f0a2b2321389c25, 0xd158820795ffbcee, 0x4d6b29ab9f36a888}},
+     {{0xeccb421ed0a701a5, 0xad4cb9a5b60cd286, 0xd344da9e05a53972,
+       0x3a8035e07bc99fea, 0xe0214485c0f77bf5, 0x50ada30ee54df78a},
+      {0xdef45af64ec2d576, 0xa05d61845f9a8678, 0xa9b17db1c337e017,
+       0x026a4f66b84671d5, 0x606142343b7d696d, 0x71ed9aaf81cfd22a}},
+     {{0x1b76a3c5439ada39, 0x818829cf89236ae5, 0x2277cb7a750f8129,
+       0x44aa462a4d46502b, 0x7a12e1e164f06dc8, 0xb9a3300dba5630cf},
+      {0xd2cc8d9c55b05f4b, 0x6d0b0b88a700be7a, 0xa7be99699617500c,
+       0x2b5b8deac03f8a50, 0x712f703e785b3dfd, 0x96a5a60accf93950}},
+     {{0xfeb984b3ee828fba, 0x8273f830e2bd188c, 0x177ef97e3ca0a99f,
+       0x76d4796dacc000ac, 0xbad0fa6eb140f51a, 0xb275656706ebc810},
+      {0xf89eb78fa18cb32f, 0xcfc37eaea65285b0, 0xe2b29cfbb25e9d1b,
+       0x9388ea8fb4e7aef3, 0xee606c12e267e845, 0x6b103c549f5806d7}},
+     {{0xf418e3f63766f2ae, 0x4a3ad3c8053ef1c1, 0xd01e5b5b560db262,
+       0xa583edc7c02bf4c3, 0x7c9f706052f318d3, 0x0852556f1f5e1ffe},
+      {0xe1c70aa7feb0e63c, 0x59f0a3f989a8c058, 0x4aa4cf021ffc0ade,
+       0xbb880e4138a78632, 0x35b0f7596f28f096, 0xf9c4fe17d5757d7d}},
+     {{0x78b8879cfd6376eb, 0x22a76461c01e1edb, 0x6a44be39369cf0c4,
+       0x6653670d5ae54539, 0x257bd7516fb43ad0, 0xb3ac371512baffdd},
+      {0x48659d617548eabb, 0xd8f931f80cd468cb, 0x98f0241549e3b531,
+       0x90b0d71670df011f, 0x26d73c54ab98f066, 0x06591ec988475d5e}},
+     {{0x627f6328412b84c3, 0xd427e977a04545d2, 0x5b0145bc104f25c2,
+       0xa6931c4f2ac7ad62, 0x407611431f8d42f5, 0xfda5a76be7f8a0b3},
+      {0x4f1ca5cffe0946b9, 0x6def7b9fbeb2d427, 0x984bd4bbc9a0d136,
+       0xb9a778235b3af1c1, 0x04ee66ae38ac2087, 0x63374ed926d9dbb9}},
+     {{0xcf947c0644ba39e6, 0xf5d5216cedfe78d7, 0xd00115c05f1835c9,
+       0xdf084152d8c79d90, 0xc0c3a6846db5f791, 0x40514451749b18cd},
+      {0xd314b7d5734df3f1, 0xbccdd3f07f541415, 0x97ed5af06855a942,
+       0xea84ae9ee9d02ab9, 0xb87e90343238a5d0, 0xd12d25c3650a0eab}},
+     {{0x1473b55b86a515a9, 0xa9e3230a3b337c64, 0x7e8bf9049db668f1,
+       0x1db2c25ef27f9fc9, 0x0c1086072d9e467e, 0x4505579aa3f00d52},
+      {0xe2ad661b240400a7, 0x8022294c11af4874, 0x29e9037078bba8e8,
+       0xbf0fbf08f6baca04, 0x2e46d2b74101fab0, 0x66065490c61089e6}},
+     {{0x2131ce5b09f8a1cb, 0x7b373ed28ab129e2, 0x463cc8d677c1292a,
+       0xa9b7cf6594ffe9c5, 0x129125ceb99bfc4f, 0x819b42849820d323},
+      {0x3f70976376541a41, 0xfd679ae5e32c7a7b, 0xc39a208df65b6b3c,
+       0x1c22ebc050002745, 0x268f19dde2bcd202, 0xfeac809c9c3d4266}},
+     {{0x0746783787dcdbdb, 0x4cce33be320493d8, 0x9ab08cbe713c7746,
+       0xd6f0c1de9c6dc5cb, 0x194005382ac03761, 0x3fc11f38d0547be5},
+      {0x66b378ce819fe3fd, 0x6a590acc3700fe7e, 0x4c976a728924b396,
+       0xa5006d8d70b9b250, 0x2fdce1b212b85f9c, 0x5858f7ce495f8f1c}},
+     {{0x357540ab903ff177, 0x225280b8276af514, 0x33d273ac14d7fed3,
+       0xfef6b9ffd186ee3d, 0xa94c207101a7b1d9, 0x4ea3627450bc8bc2},
+      {0xc68959c9fa98a918, 0x8f5ecceec7bdc262, 0x7a73a4fce6861310,
+       0x19bcac90c828330f, 0x73e3b66f7ef74fdb, 0x60f7698352d8f2f4}},
+     {{0xab3578047e03a14e, 0x0f4f28688caf673f, 0x919e661e66530425,
+       0x28da445c91ba47c5, 0xd6d0537566c394fe, 0xfe1864a302e8ae91},
+      {0xd34baca2a753aec4, 0x43b7ffe7a2c8d292, 0x496659eb04efb8f1,
+       0x310ec2a9e0252dfd, 0x98173d2f9168a80e, 0xa3e018d631497255}},
+     {{0x3266c887d9d9284a, 0x690f818b73646ab7, 0x67315ec6af7fc33b,
+       0x181e61abc30b1ccb, 0x1b81e6cd105a9e1c, 0x62a15daf5078b9bb},
+      {0x74f9840f6fa8cc65, 0x356b777443388573, 0xba0f7d0506b3fd46,
+       0xb0ac864c92b4fdad, 0xcdeac253ef192cde, 0x0c24810bc313b4a7}},
+     {{0xef8c40bf1adb09b7, 0x2efeb49c0b74992a, 0x3f0f8a412b79957f,
+       0x08927bfe87a06873, 0x1f63a4109288cb9a, 0x8c66fb70df2b373a},
+      {0x98da4712980facae, 0x15ce5b17d819d026, 0x097571a5749a671a,
+       0x85a40804894dd269, 0x3e89c13c34cb6797, 0x2d19d5e4d07119a4}},
+     {{0x58225208ecbafb80, 0x4f212035aa73d6de, 0x1224e45562fe86db,
+       0xa8c8a4782dc5b2f1, 0x8a957b8dc3096555, 0x6a3248b0b1591452},
+      {0x1e563c58cb604c18, 0x32808cb59bf1045e, 0xf8f62de99462e7a2,
+       0x6b3dfe91c2489214, 0x6c1d8fc42174639c, 0xdfca11b8ef88d4b5}}
+    },
+    {
+     {{0x5a4a5ce418690ad0, 0xd0f788e0fe27f51a, 0xd459388e4efe9a30,
+       0x3a45c11aef9d074b, 0xf68ab50b93ab9cb0, 0x62fbc397ecd9a566},
+      {0xbfb79b7fcc587a7e, 0xfcf4d66f92870bae, 0x4f31aa21877390f0,
+       0x2de0c645e314cfb5, 0x56d904f6238eab12, 0x4d104a42ccb4d4f6}},
+     {{0x3eb83a8729358cd3, 0xad741295b9c6d430, 0x57b8c77a53abe4e9,
+       0x0a14673ebb9feb82, 0xc0a6cbf7f26f922e, 0x213de299a32e526c},
+      {0xca417e677b6ca858, 0x8d6ae0f7fc2e0900, 0x2bae0e7a62e135dd,
+       0x962bdcaea7ee82c7, 0x573d7f6ae5776c74, 0x9c4de6496ffbefeb}},
+     {{0x8c962fc809335d38, 0x26d1bc81eb38d176, 0xe1aeb295c47711ed,
+       0x0812b9926cbe3e4e, 0xeecacaf90ab9805d, 0x82fefbaa3521a0ad},
+      {0x3a6948c0e2c31b9d, 0xb7d3905be82daf2b, 0xbd3ac90e25a34c37,
+       0x55afd99b61453063, 0x56d87cd190b99303, 0xc9bf82dd97ddb0a3}},
+     {{0xcbc0bb1968916917, 0x0bbb9f921094bf88, 0xf62cb350d3806442,
+       0xe4d2f1cc397a7602, 0xa54bd48e43987d82, 0x77b6f8314f0a19fa},
+      {0xfa0c9a456e766443, 0x995ae0fff51ba70b, 0x8e242c5b9cbd8d33,
+       0x1671eb0813d97956, 0xccae388f40da55fa, 0x97cc48faf376dce5}},
+     {{0x1c2919bbe8c91718, 0x9dbb727a5097bde3, 0x23f87ae7f8ea2fb2,
+       0xe1bfffdcba310121, 0x5938c50c75329669, 0x716c63e00549855c},
+      {0xe091b0c9654814f0, 0xa20535d10e43daee, 0x16ce68b2593ddd04,
+       0x7813a49af59900bd, 0xef0d3eecd3e5d232, 0xe7d12cc40ee3fd4d}},
+     {{0xe54d92cdef01fc5f, 0xc46c2ab8dda2e25a, 0x7c907fd2849f6142,
+       0xbb11dd2dacd0202d, 0xa4913a701d92d19a, 0xe9a26ae0cf610677},
+      {0xfff1e1d5538943c5, 0x5943dcc4a47b2204, 0xcafcf33a92cabf71,
+       0xd571e13ce329d1ad, 0x7626ad237a9a0e4c, 0xf0aa0d9f130d7f86}},
+     {{0x09df3a4419e6aa7e, 0xe27ad0475841b1cd, 0x02d2a69fbde75934,
+       0xb0e05e53fd9ba435, 0x4732d88ae008c16e, 0xdebc4777ea72110d},
+      {0xccb7d9932e3143ad, 0x674f3753ea8cd06a, 0x56012a7a051562cf,
+       0x961df68425f74cd6, 0x26630e71214d8a95, 0x584e8d6365d92f84}},
+     {{0x8a89daefebc5557c, 0x7ca71403275e1649, 0x48d923775b80bb4a,
+       0x0a587c52a45b3626, 0xdaff503cc75bfe91, 0xd845d3e6116d07d7},
+      {0x6b5a4715a51eeca2, 0x34ac02bd74481991, 0x8f076cfc595abf8d,
+       0xc9de4ce9ed0391ce, 0xaaaad03ae1fcabd3, 0x8d48ec0087b199ed}},
+     {{0xbd0f2653ae5dd482, 0x59f968dd060032dc, 0x6bea33e067283310,
+       0xccce88cc012aa50c, 0xbb6d7f2f66838f46, 0xb764c95f05ec9bcb},
+      {0xd097b60451477cca, 0xc2fbda7b82b20a85, 0x75fe07a424e9ca8d,
+       0xfc4fa8240cc40d01, 0x0b17d5f90c0e95f7, 0x285e6e8a6e1e46dc}},
+     {{0xb0641d09bc9b2654, 0xf9fcc2e68aa8fa35, 0xd12a5b4b00d5ec6e,
+       0x9be1a1115569d89a, 0x9c0566deffac7208, 0x7a9fd4ff7034edf1},
+      {0x636aeb6b9571c375, 0x60d05aec55cdf187, 0xf4e2f898734e9d2f,
+       0xdaf742195ccdc6bc, 0x9d39249f608a4f28, 0xb5f1bb5e8820e2c3}},
+     {{0xd02e9936d9589548, 0x8f1bf5755341402f, 0x1535a443057300aa,
+       0x3062478e65d29324, 0x4203351fc656a3f3, 0xbeb21b516569c4ff},
+      {0x8113ce70e1f0f263, 0x59d1293903f9320c, 0x95061255d08f8936,
+       0x8be3c0f997d4b705, 0x0259742e827837c2, 0xf55ea28d95c65cda}},
+     {{0x62024812603dc3dc, 0x25dc5337efd67b57, 0x86b3eb38d7f033fd,
+       0xee3226b232646d6f, 0x8c4825f6f1dae596, 0xd2303055a5bcb8e5},
+      {0x904a53493c0baa76, 0xe60f6125e08646a7, 0xaf6a329f21d45f89,
+       0xf20ad88a06605546, 0xcf7a0e9619a93d14, 0xf1eabcc891c97174}},
+     {{0x72b76e9e8f02af51, 0xac94cbf1d580f95a, 0x2e9cd74801d854a4,
+       0x4ed4e9061f08a1bc, 0x0a2b28419d2bd936, 0xbf86350051c89dda},
+      {0x9407b0e7e3f00bf5, 0x6b1f71ff28b57ac1, 0xc1dfe03fcd28801f,
+       0xf3d83d64afa55309, 0x47aafba28af8f76f, 0x54eed45f6604b2e9}},
+     {{0x59edd2640f3e541f, 0x318674b582b76ba8, 0xbf4a0d304e7f0716,
+       0x36fc0e4119b88200, 0x91db560240da801e, 0x638371ad2c72c2c7},
+      {0xfe960c25d5822da7, 0x7a7571d14a7415e1, 0x5a6480febccc1576,
+       0x72f4e5e5c3c88f47, 0x224e7e749a7bd8ec, 0x3ebbf52c7631455e}},
+     {{0xae3c2bc08608ab37, 0x35e3da8c39f336b6, 0x7413664281f44511,
+       0x21ce7c511d8506e7, 0x9b6718b3846165f1, 0x9e455007f5cabf6a},
+      {0xec582a0e02611073, 0x269aa18d83bf042e, 0x7c54fb7c86306757,
+       0x453336021b948faf, 0xd3a5c508b7025d73, 0xcd6e555b428471e4}},
+     {{0x42c9fad511a224e6, 0x6b6aeb8b69b2ac26, 0x0cf4c7fdb149854b,
+       0x4a7d90002fc359eb, 0x9ff0c3ea29ec8603, 0x157ae7859b24ee14},
+      {0x638c809a8979e9bb, 0x347dfb2e7869d8c5, 0x2fb1e0f8a07ea547,
+       0x1e580d32aecdec3f, 0xbbf895730f74025b, 0xeb94d71bdd529164}}
+    },
+    {
+     {{0xfa2db51a8d688e31, 0x225b696ca09c88d4, 0x9f88af1d6059171f,
+       0x1c5fea5e782a0993, 0xe0fb15884ec710d3, 0xfaf372e5d32ce365},
+      {0xd9f896ab26506f45, 0x8d3503388373c724, 0x1b76992dca6e7342,
+       0x76338fca6fd0c08b, 0xc3ea4c65a00f5c23, 0xdfab29b3b316b35b}},
+     {{0x14f962e404a8313d, 0xc6e3e7c45f1f5a26, 0x2c0e11c079e777be,
+       0xa1705efb4657c31b, 0x02688fd23c494de3, 0x75664a84412a8718},
+      {0x878fc7ad7a422f8a, 0xe5d581df7419bd0a, 0x7c813c4c704b70c0,
+       0x98553da87323c008, 0x4f63cec663089f1a, 0x9626d6fa9655d291}},
+     {{0x84e5541f483aebf9, 0x8adff7dc49165772, 0xe0a43ad69beaad3c,
+       0x97dd1820f51c2714, 0xac2b4cb457ea5b0c, 0x87dbd011d11767ca},
+      {0x18ccf36cbfc7957a, 0xd4a088411bc79227, 0x9811ce43d8d292a8,
+       0x72c5fc68d58c4ee7, 0x5bc0f0bed35c65a7, 0x0b446dbccbbf9669}},
+     {{0x10586ea7507f8b27, 0x1510deb9a261f7d7, 0xa42fc4d7dfbfa352,
+       0xbf38c3821e1c2291, 0x46e40ef60e11760a, 0xc24f6061dcb974d7},
+      {0x755b105ba7619027, 0x8004bf09b8ffa759, 0xa630d0b00945db60,
+       0xa160ac9cf2809e1c, 0x38fc1113dc6c95c5, 0x01f540985d52574f}},
+     {{0x7eba3da69cee9bce, 0x3e2c1248d5377750, 0x8c917d982b93d8b2,
+       0xca8fc6ac7cad1f75, 0x5f581f19a0ff150a, 0x872cc14ae08327fa},
+      {0xc774f187e9333188, 0x528ed4ac497af7e8, 0xce036e9b8ad72b10,
+       0x463f9ebb917986cf, 0xbe5163281325cf9b, 0xd28d5c50dd7e5fea}},
+     {{0xa4e9f29f0b237b7b, 0x8ed65b094270ee2d, 0x0e2184e42993359d,
+       0x4f96ce7f224d5aa3, 0x0862e2003a132c48, 0x5bbc6ad80f015f5f},
+      {0xab9d5149d7162f5c, 0xfe6577291267e5d2, 0x4865e671c1fd96e2,
+       0x7baf4dbe71a703b2, 0x83dd6cf9142add10, 0xab4fc1aa98461d30}},
+     {{0x714c1d1bdd58bbe3, 0x85ba01ae039afd0f, 0x7f23ea3a6951ac80,
+       0x5c599290ac00c837, 0xf6efa2b3bf24cc1b, 0x393d8e421e84462b},
+      {0x9bda627df8b89453, 0xe66fff2eb23e0d1b, 0xd1ee7089c3b94ec2,
+       0xf75dba6e3031699a, 0x8ff75f79242b2453, 0xe721edeb289bfed4}},
+     {{0xcda68a7e698ee21c, 0xc7414d196a5e725e, 0x483be2dadce20b91,
+       0x7de1601cfc69dca6, 0x4bec17aaac4f9891, 0xe8741dd18d479a56},
+      {0xc623cb8dac23a286, 0xe20a96b5166133f0, 0xda9bb7c030dcde61,
+       0xf84ea3273a1733fd, 0xd7afb6c3e82fac31, 0x37ea7d35d3897449}},
+     {{0x083215a1c1390fa8, 0x901d686a6dce8ce0, 0x4ab1ba62837073ff,
+       0x10c287aa34beaba5, 0xb4931af446985239, 0x07639899b053c4dc},
+      {0x29e7f44de721eecd, 0x6581718257b3ff48, 0x198542e25054e2e0,
+       0x923c9e1584616de8, 0x2a9c15e1ad465bb9, 0xd8d4efc716319245}},
+     {{0xed85257efd028642, 0x93657f45b96a2068, 0xfef64edaa13ac381,
+       0x108f6ff256c557a3, 0xe690d92b9204e3f7, 0x902a3e3803ef8640},
+      {0xaefd49226416f50e, 0x9b272152b7eae8f0, 0xa911921f29d93d8d,
+       0x7c6bc4995eeeea56, 0xbd3439d83ca7c720, 0x2f8cf2e3c39b208d}},
+     {{0x72dc79439961a674, 0x839a0a52a0e13668, 0xd7a53fa9334945ea,
+       0xdb21db77e7aa25db, 0xb6675a7d66e96da3, 0x2c31c406e66f33c0},
+      {0x45020b626ec7b9cb, 0xff46e9cd0391f267, 0x7dabd7440fa2f221,
+       0x9a32364b9d4a2a3e, 0xf0f84ae852d2e47a, 0xd0b872bb888f488a}},
+     {{0x120649b20370327b, 0x0e76555acd48cdc6, 0x4ed54decca01db03,
+       0x7be21319ac601d22, 0xf711661901b6576e, 0x7839fa064e73537f},
+      {0x169d43ace46e860a, 0xde6d658c3078eed9, 0x8df731395032142b,
+       0x6be199b09b3c76c7, 0xc2f385f6f8bbffe5, 0x848df7f3d5ffd28c}},
+     {{0x531e4cefc9790eef, 0xf7b5735e2b8d1a58, 0xb8882f1eef568511,
+       0xafb08d1c86a86db3, 0x88cb9df2f54de8c7, 0xa44234f19a683282},
+      {0xbc1b3d3aa6e9ab2e, 0xefa071fb87fc99ee, 0xfa3c737da102dc0f,
+       0xdf3248a6d6a0cbd2, 0x6e62a4ff1ecc1bf4, 0xf718f940c8f1bc17}},
+     {{0xa342bf65f874628f, 0x18de3f8ac71a57bd, 0xb4d12a1771fc321b,
+       0x96716602a25ebf10, 0x744f68201a286d80, 0xd60bad1de3cf63b8},
+      {0x0c0b1ac44368da09, 0x53afeae373a6d3be, 0x4d2e6ce2a90af331,
+       0xd797224f88bc0638, 0x10c60b2d9396d893, 0xae3b0c11fe45e1a8}},
+     {{0x2c8b0aad4f63f026, 0x2aff623850b253cc, 0xcab3e94210c4d122,
+       0x52b59f0407cd2816, 0x22322803982c41fc, 0x38844e668cf50b19},
+      {0x42a959f7be3264cd, 0xbddc24bd6c983524, 0xa489eb0c462b8640,
+       0xb7c0509298029be7, 0xd5546b5fa1addc64, 0xe7cac1fca0c655af}},
+     {{0xa189f30fc6a6d6d1, 0xdd674d3669665ab8, 0x307c9ec37d8da76d,
+       0xb3e1d006c1ea7c10, 0xc15e20b3b88c62d4, 0xb0000ec50bff3b3a},
+      {0x9e330eb19ff9aa5c, 0x8663f9fddf578877, 0x157d3cb002e1eb2a,
+       0x638f297bf525e4d4, 0xa20f833234a3dff1, 0x748ea86b45a9c051}}
+    },
+    {
+     {{0xfe9fdde8bc266ee3, 0x91668688ba18e6c7, 0xa65349acddde6f6e,
+       0xc53c29c97e54356c, 0xee15ad945709f73c, 0x033b3940e5429277},
+      {0xf52035cdd0c3475a, 0x9c5bef4d93f1f1f0, 0x26e0b0ceca319bd4,
+       0x4e7eb67b6951fd8d, 0xac3a6f4395c34d6f, 0x1f2769e600f60b59}},
+     {{0xbd10b8bffb787270, 0x4f0b1566e43aaab6, 0x9a18be5ec0c90781,
+       0x3677f4c71ad167ce, 0xccb254e2a68c1c56, 0x392493e6e2c4d275},
+      {0x44958cb1d5b63617, 0x178f141a4caa4e7c, 0x7445a767a2ffdbd5,
+       0x0e789c99b0b6c22d, 0x3ff8b6565dc92b2e, 0x1623e5c3eca98782}},
+     {{0xfadf9be978207cef, 0x97d5ba569cb5718e, 0xcbad24ec2f995393,
+       0x6236a26861203303, 0xe4bafc336589a4be, 0x6cba77185e23fa82},
+      {0x8ccbc5774583e65a, 0xe5d88bca4bc2f415, 0xe6bc2d5841df8dd1,
+       0xec24e1d914d31fcd, 0xacaaf13efc26010b, 0x7e1da447e01b92f3}},
+     {{0x6f6a6104899ef333, 0x95496f6d39067165, 0x42fd9a6ab51989e5,
+       0x1b60ce0f68f5b168, 0x97324d8756f7fe67, 0x443812f7676815a8},
+      {0x265ee994685a7260, 0x342c7b2f6c6515f0, 0xe909232334b4adb0,
+       0xddcd233e1e5a8d18, 0x3dc5b27c5f4f6456, 0x9664533a7f421d9b}},
+     {{0xc48bc829ff7543c0, 0xc0bda14c4d72bfaa, 0x2f470ec703be0af1,
+       0xc70f1e8e92d37eb4, 0x08abdd98418f410f, 0xe38c74ab35386176},
+      {0x9c07cfdd8c00426c, 0xba74c310a998f1ad, 0x76b45140b7d2dda8,
+       0xa52b5e584948330e, 0x9b7332348d8efb26, 0x5d1763735d19a312}},
+     {{0x43b58def987cf64a, 0xc95b16c63d4bcd4e, 0x5d1b1373bcd9b923,
+       0xaf560542522e052b, 0xc2ff8f7583800352, 0x11723aa17fe2a4ea},
+      {0x28de7668e94bd9bd, 0x0ce80e0f874018a5, 0x0fe3755d8d43e726,
+       0xa78296acf9b075c5, 0x76d58d9882207423, 0x5c5bc6971db99205}},
+     {{0x583ee7dfe3b7e746, 0x0b6659e4a4fab3a8, 0x34ee02751946db5d,
+       0x5ae3c0ba1a12eeca, 0x36756ed44ccb83e7, 0x973b0861a80eaf3a},
+      {0x969e38f46982ca90, 0x9a9bcd10018d01fc, 0xb540e9533272476a,
+       0xcf91dd0a75ab7002, 0x2c7d363f39ceb983, 0x4369c221974747c7}},
+     {{0xbfc40c30f893a2ca, 0xdf96980e0623bad1, 0x4fd7b54dc027511c,
+       0xf4799284cf3484ce, 0x655ab811069beea5, 0x52588bc87392e280},
+      {0x522e7b404f0c17cb, 0xc0d88acac705e9b2, 0x9cf1b95877f3913f,
+       0x3e06b9267dd52514, 0x992e920e2908cbca, 0x13baced26d6ed529}},
+     {{0x41c59b9c95ab4944, 0xfacdd4faf32dcf4b, 0x6401bcb6ef361bc3,
+       0x8d1fbbf7697706ff, 0xa9dcd2cd12fafc26, 0xc1fce537ced1b64c},
+      {0x760b3eb206433b06, 0x53a27b08f6f894d2, 0xb50135cd851c8bce,
+       0x9bf9a2430e058bf5, 0x231624a6cc0a78ef, 0x8200be42ff090623}},
+     {{0x5a0f6f6b67a470ce, 0x7b8c2a887ccca885, 0x4421fe1325f812da,
+       0xc7a9c622e0833478, 0x6aff42db94829d7c, 0x6fc2f23b37d888fe},
+      {0x9cfb8a1464b75c84, 0x56e1b7d446139fee, 0xcc6943b8fe72fca5,
+       0x12e757e1c3d621cd, 0x6d9d63b072c1571a, 0xa1fc3db17b300fc6}},
+     {{0x7d58f7e6393e37ca, 0x30290d9b5e47e4c4, 0x831e5039a69dc1eb,
+       0xe2f427255a758799, 0xe8166ff7c8f86525, 0x28e08f58aa85cc41},
+      {0x66be9bb7e5409138, 0x7d0f8807dcbb88ca, 0x870cd794e7803e98,
+       0x78fd1eaed59d39c6, 0x1aabe0afcc0e56c0, 0x7f8de7335bf0f272}},
+     {{0x36aa63d9fdf88aba, 0x87198fdccdf43217, 0xd8fe6f62a9a923c9,
+       0x85c81a0eee2ae4ba, 0x7c20dea032dbcb0b, 0x08baa938129a31c6},
+      {0xa47b3003b1d60f99, 0x314599936905192e, 0x67e2289932cf2c7c,
+       0x4c5f43753b3c32bc, 0x8de5d14dd499aa00, 0x54875c3fa311dac5}},
+     {{0xb6475210898dc5c7, 0x0f709811080e62b4, 0x8a0016a7bb3bffd9,
+       0xfc56d337afb97dc7, 0xff911c89ca1b43d9, 0x9f8d40b79187747a},
+      {0xf6ba52145700a9ea, 0x7bc1c0e38c04b9b7, 0x2dd3de09a2c924d2,
+       0x12378655717b13cf, 0x090f25566e9d0e85, 0xf66a337d88f728c3}},
+     {{0x1f90b9b6e5140e1e, 0x7ab77ce1ea2d44e5, 0xc8a3343ef4878fcf,
+       0xbeb73f7cc544e407, 0xdb3a8266fec32a61, 0xbe30a82e38db88f8},
+      {0xf33ad1df525080cc, 0xf66aa44d1a553e27, 0x3194733fa9b7b198,
+       0xd87c8145b4b9b4c1, 0xca7cd39268883c51, 0x2d12a779ca49b152}},
+     {{0x407842b52c4ffe71, 0xfa9a9143c3f5593b, 0x97f9f32a69f25d01,
+       0x78e3d5fd4571d150, 0x8cbd107889878e86, 0xd4a4be53633ed774},
+      {0x2e6cf7f0d65d0ef1, 0x5cefa89218a2e243, 0xb2e8ccb6130c9ba1,
+       0xda209fc8de1ec2f9, 0x64845a36b3448d09, 0xbde9ae0a92896b12}},
+     {{0x8a46c911bfc6c637, 0x8dc3d699e4fa4fe6, 0xd4ba64f15cf8e4c9,
+       0x01b3908a01cb3488, 0x69b1fa5d38bd7ded, 0x92ad483818b2eae1},
+      {0x619324beb33955b6, 0xc7f373355c8a6df7, 0xa397f42e925b3f69,
+       0x32169a495f7e4d11, 0xc0fa9a548d0d9f01, 0xf52a1f2289d8f2e5}}
+    },
+    {
+     {{0x9c0d5231ba8e0a52, 0x94d0509e93e465d7, 0x67df90dd98515454,
+       0x223e8b9c8dbfb46a, 0xf39529a36d757ce3, 0xffec9175b4648296},
+      {0x330749e8f78aae7b, 0x19e5549645f93cc3, 0x8c320b3494083aa8,
+       0x1161f5a321e321c6, 0x0980deedde3e7892, 0x605aa9196ad76ccc}},
+     {{0x73fa3508180660f7, 0x4cae013e2d24936f, 0xf64a549f58493d98,
+       0xd9ceae0adc79f602, 0x6569e37bd1512b84, 0x11e4c022151c9151},
+      {0x075678c2b55c5813, 0xb26cdb5809d3cb16, 0x6334dca3a57fb969,
+       0x0ed90820223dc3ce, 0x74f9c3aebd11e277, 0xaeefed3679c0b8e2}},
+     {{0x0e2fc74c2a24c385, 0x836a474034679278, 0x25518f16817e2c41,
+       0x8b573a8eb4b7d3c1, 0x012797f94ab56adf, 0x9e0e56d0fa2ab690},
+      {0x009ba1ee1c9f6f08, 0x8ebf4aac2f412e9e, 0xb143122a1cfb4e02,
+       0x988cf0eccbf2b783, 0x44a7ed9657f5be97, 0xbdcad87251804147}},
+     {{0x378205de2f9fbe67, 0xc4afcb837f728e44, 0xdbcec06c682e00f1,
+       0xf2a145c3114d5423, 0xa01d98747a52463e, 0xfc0935b17d717b0a},
+      {0x9653bc4fd4d01f95, 0x9aa83ea89560ad34, 0xf77943dcaf8e3f3f,
+       0x70774a10e86fe16e, 0x6b62e6f1bf9ffdcf, 0x8a72f39e588745c9}},
+     {{0xa96955b9b1bafbc4, 0x8dcb55a7646ece39, 0x2b62784feb00e541,
+       0x462f9d7d2693249b, 0x8b264697794c189d, 0xded6ff5563354e69},
+      {0x7c8ea441eed1089f, 0xe355f75c1462f461, 0x87b691f61210fd5b,
+       0x7291bffb6983cb27, 0x9ed83afc92800095, 0x307a3dc81f24d923}},
+     {{0x7cec60ead7804b2f, 0x0064464345c11441, 0x3c6de88b769cd685,
+       0x34709186c7f01232, 0xd9eef41eedd2bd0d, 0x3bafcccde427faa9},
+      {0x33e5350ec07e701a, 0x9cb2eb47a87c1fd1, 0x9fa9a7790d5f5b28,
+       0xa2e7076b07ea2e53, 0x72f4da325c169cf4, 0xb7f192947e751588}},
+     {{0x47eb133532dd7a30, 0x9d058169a9db654d, 0x375c59df6e7a2b1a,
+       0x55d37c677a35f29f, 0xc78a3678493c4cde, 0xe5f0e2d68d83e31b},
+      {0xf7927002e9777bf9, 0xdd559324a5afdfc7, 0x077c6c48b81c08cc,
+       0xba1c98ccaa2ef694, 0x06c6c9544c02dd46, 0x211e50f37dd3145e}},
+     {{0x2a5f8ecf06616d0d, 0xca9b1cb8c7deb373, 0x9de31cedc59c4301,
+       0x1e0f40b10111d998, 0xd29d229f960d5b95, 0x10563249d1dabab8},
+      {0x7b225cc9a05ecac9, 0xb02e689678f3b8a0, 0x009b52a1f5fb06b2,
+       0x8a575d3f842b9081, 0xfddb48afe9272512, 0xd39b8f1d0b452cb7}},
+     {{0x0d6b9c7c67e09987, 0x261a564d0761ad52, 0xec4621749f60925b,
+       0x83ee0c1218529b03, 0x72972467fbcfff74, 0x37fc074c6abc4bfb},
+      {0x8b6015bd54e65e89, 0xde8583eb991583cb, 0x379548e1b4d2c62a,
+       0x88024a9a9b24a5e5, 0x633aa869fc03abfc, 0xa27657b98fa35283}},
+     {{0xde9703b461d9e770, 0x02d4091def4653ef, 0xefd229aa576eb5e1,
+       0xc0b0b243f77eb987, 0xb11309b2eefe8f71, 0xfeeacf2f68478044},
+      {0x8dfd8e8643ac3dd7, 0xc0a24181b07f95c3, 0x551ca09624be161c,
+       0x6cb2c1d4b098cdc3, 0xbfc74e9be74f84f8, 0xe58e14d9067e3388}},
+     {{0x9eca6f94f025baa6, 0xb2db0741bcf9c741, 0xf8e2aab590bb8f56,
+       0x4772903208762829, 0x067a0c5ae2a266c8, 0x22b104c771b7d7d0},
+      {0x4a48cd6953e406db, 0xb85e44d524f0070b, 0x6168262fe10133ff,
+       0xdfc02315e4874e8f, 0x20dba2d7ca317e3b, 0x441c56d2e1d2c0c3}},
+     {{0xae10069e808dc4b1, 0x64df30e18fb3ba73, 0xbbe4caf27ebaad0b,
+       0x5907bf373dd6119c, 0x0a723dff9dfceefe, 0x59bff4ddf7cffc7e},
+      {0x7bc95fa26a6f43c2, 0x9001d1d53ca0e2b3, 0x316a7ecd27b3335b,
+       0xbf08e6727b8d7d49, 0x4b209f93c619058f, 0x4c0ca01e59d8f9ea}},
+     {{0x18c452c4cae69c3b, 0xf45690acef0f00fa, 0x3b363aa04f66a5cc,
+       0x9dd41c0a47718c52, 0xfa219d7e7e5cd370, 0x5d384db7b2196dfb},
+      {0x5e14749b90b4d46b, 0x55796656d9db9481, 0x3bf13d0ac8cf353e,
+       0xb89a28a6a95c485a, 0x568fa3d05da29783, 0x4aa008eed182b1a4}},
+     {{0xf7e1ed3bb09fa8f3, 0xbb4fe6f71da5be9e, 0xcbab0e01f4d1ba21,
+       0xb732741076a5f326, 0xd94d2349206092af, 0x739f3cd0728e0e4d},
+      {0x568644aaf81fd823, 0x510cff6b6110e2f6, 0xef4cf1ac566c3598,
+       0x2c26f17162aae69b, 0x1e4360468964a2a5, 0x83c0bbf63e472c50}},
+     {{0x79c04804aabd965a, 0x9581aab443d0b660, 0x59bff0035ba71d23,
+       0x212ecd58b6a0cd80, 0x29bdcd33bf1ea5d6, 0x59fd2ff477a002e1},
+      {0x3c9d21308d9cd247, 0x790e9dbcb1786da3, 0x967ee5e714464d04,
+       0xd6f7ebbd2b5373af, 0x1c0b22d539768d40, 0xdfb54983913f6cc3}},
+     {{0x167ec88a51b3f1ce, 0x19756ee0420024c8, 0x10f2e2443877e634,
+       0x6321bf2603462cb3, 0x1dbd10ee9d3afcee, 0x0726f5f22ca17dcd},
+      {0x094652660bacf018, 0xc92a9f2de1feb969, 0x0043b0f95e1c5912,
+       0xa09b94d1757d3a63, 0x533956529fdef1e0, 0x9826886cd4fedd41}}
+    },
+    {
+     {{0x2e75a26eec65b53e, 0xfeb630b270552fb3, 0x53dfd057ee7d8e4a,
+       0xb959110d8994f449, 0xb4a16596bb538367, 0xa70917bdef82f29c},
+      {0x5a76430043bba6ae, 0xee207476cfbc194a, 0xc7eab23803a4184b,
+       0x60c67ef20f7fcd62, 0x41e05799dfa8a0c6, 0x5d7d05e604d352b0}},
+     {{0xc97c01eb436b59f5, 0x1d15aca7ef1848ab, 0xdba1ce807fa7d3c2,
+       0x69e6f96e81060874, 0x6e3e0df74d7eeead, 0x8a3b5e85b0c87f3d},
+      {0xc55ae3dbc8a23914, 0x5cdc2a92bf6d27d9, 0xa6008c591de7860a,
+       0x8202f8b66e546731, 0x652f2d07aa1e45d4, 0x146f214f6df5415a}},
+     {{0x4b01246a651ed62d, 0x9f6824a30b9eb006, 0x763ae8feba95697f,
+       0xeff4f88defe2182e, 0x2c2ef50c74ba79b4, 0x319df6c91d23d649},
+      {0x481f9faff6c273a8, 0xe71564579706dc07, 0x06f0617a424d5cb9,
+       0x6d6b5d8ba8ad220a, 0xa485ca14a2bd8c40, 0x7a7a15bf54cb54f6}},
+     {{0x041c706cce5fb4d9, 0xddc78cb3b22a79a7, 0x7dc4cd27839e9d5a,
+       0xdfc9db83bf3c4c06, 0x85b8094138b7bd22, 0x1007dea2d0f4c2da},
+      {0xd7b34006c633fba0, 0xa8880acf4476e55f, 0xa340b2c275236685,
+       0x5ddd05510113a85f, 0x7dfc7ab29cb32704, 0x9a334a33dabf22ff}},
+     {{0xa8261c317e546950, 0x89d19cae26706dc1, 0xf8dbf6caedc9af36,
+       0xda79fe4e7e446207, 0x8bbc319581cee38d, 0x9d121e9cb5be9577},
+      {0xdb3fff88cddb5a61, 0x751cad153ee86665, 0x5c0986df3d07abad,
+       0xf77489b383fe8451, 0x3546c5a9f90d3e94, 0x1ec54bd1d8a694b7}},
+     {{0x2fbce9bed7d1146b, 0xcec9e5d8b3980bd2, 0x48ea45939f4cbaf0,
+       0x56c540092574a3bd, 0x84a39630e792c39a, 0xe5c690f8eef81343},
+      {0xf996760f17655bc9, 0x6009c2156c0c191c, 0xa0ca12e6966d7027,
+       0x92a6d5d52e6f7c63, 0x46809d269bd13ead, 0x3c11fa7967aac681}},
+     {{0xca2876f9ea8edc01, 0x85c1a4ac28d411c8, 0x4d5fca4cfb0299a8,
+       0xa1df6c5a17fe8b37, 0x2ffb3570cc062556, 0x4c59773e465ef78f},
+      {0xea3e39aeb3601ca5, 0x9806345fb7d30864, 0x428fe41fe6600e5d,
+       0x19bd665d067a59c0, 0xbd6b8272908cdb52, 0xb60250280b2707d8}},
+     {{0x3fc9b3cfabe2cc87, 0xfd8d64e3514e77fe, 0x2003a58afe1ad535,
+       0xcec4be38cb39149f, 0x4d578c99bdedf470, 0xcd35d7a33a356519},
+      {0x7a762f278b078d6b, 0x3b6891ed31ae2701, 0xdc0e817f270c508e,
+       0x5a7be2049fdb29c8, 0xfa1a0be3cb2711d3, 0x5865f55f3786a0c2}},
+     {{0x5f5db9af23bd1613, 0x0071d2c4cfd5bc16, 0x273d7ad181adfd03,
+       0x683508f4a0570ffa, 0xa49f5c08611a75fc, 0xfca5bd128fbcfbb1},
+      {0x7eabb3392a4fc49c, 0xdc5fae69ad6e6d32, 0x2e599c43e0b03dce,
+       0xf4ad8d3e7ca7250c, 0x626c1f7eedeee0fe, 0x2296376faab0b3f0}},
+     {{0x1d0af6b52f641cff, 0xa932adeb3648c4a0, 0x67641951b1ea8fc4,
+       0xc0b90064b1fae482, 0x7012642f6623477b, 0x1cddc0245bf019ce},
+      {0xca1f4675c2c32737, 0x11525a5e97d6b18c, 0x9c034ef2d3868de9,
+       0x0533d921044e0c18, 0xba6cf14ecb5e38c3, 0x438309f3509d7053}},
+     {{0x0b82b506790b3f68, 0x75b38ef112c1f59d, 0x6bc1e0074dbdd80b,
+       0xf81480dbd13bb11c, 0x2513188717259091, 0xc5c8823ec61dde4e},
+      {0x0ddb06a09b2736d1, 0x64dfb1fea785e570, 0x6f8f9945cc593359,
+       0xe8e457a9d186352c, 0x389479b67c342abc, 0xc73ddfee4cc71b3b}},
+     {{0xe164268ec4ff9f0b, 0x6c8e9349e6c36e63, 0x734f979478ab17f3,
+       0x46d468de0179ed0e, 0x7e68f006dfa26867, 0xe4d4a85de3d0485d},
+      {0x0913a1d7f84c0f8f, 0x4095c8c025a9c9cd, 0xeeb1a79e49eadd08,
+       0x433f5e417dd8f954, 0x70a6281430bb26d0, 0xad94d8f6ff5e8e29}},
+     {{0x0b614a645652a3c0, 0x8927918534597010, 0x06c97f68810a812f,
+       0x566120f4be358e91, 0xcb1f8b75c044ff3c, 0x77b3b0b07d1a468b},
+      {0x37a728627d49aad9, 0x3ada117b8646efd4, 0xd8626c0d21bac6d0,
+       0x2263d74cdd2c980c, 0x8afd14c0fd1b6bda, 0x693742cbcae64c0b}},
+     {{0x6a352b579e32c0a4, 0x5274a08277ec7a40, 0xee1f7c7a240e6dc5,
+       0x85d5be62d313b4a9, 0x1522c5d25c01a405, 0xcfa08aab960afd5a},
+      {0xa3cb77f38e8a93dc, 0xaacb16766d1c98c7, 0x84090c7d3b93fa9d,
+       0xc77f1ee13c0383ad, 0x461c93b776f7a220, 0x66d63a1d04ac0bfc}},
+     {{0x3d1904c6d2343e0b, 0x8ce038f7775f877f, 0xa9d4dce1d797f231,
+       0xb6712aa716c08c2f, 0x5045b87a335ad61a, 0x44a251fb7115bb4b},
+      {0x2363cf68e66511bc, 0xed8ab55381cc48f3, 0x8bf71687725c6bae,
+       0x16e0d015c23ab12c, 0xfbdcc06421f333c0, 0xe73df70962c9f01d}},
+     {{0x3c7d6b644751207f, 0x65e1f96ae440c1a2, 0x8ed15d20aa0eaa1e,
+       0xe944ad2fc0eab490, 0x71525aa1f6d9f260, 0x5cd14c8816146ba3},
+      {0xf940190814a41275, 0x3bb7ea742288618d, 0x6a4e1c37cab1060a,
+       0x357fe4d0c8cac96f, 0x97a8b8ab6a2466ec, 0xb6e83fdb9c01be70}}
+    },
+    {
+     {{0x5b0b5d692a7aeced, 0x4c03450c01dc545f, 0x72ad0a4a404a3458,
+       0x1de8e2559f467b60, 0xa4b3570590634809, 0x76f30205706f0178},
+      {0x588d21ab4454f0e5, 0xd22df54964134928, 0xf4e7e73d241bcd90,
+       0xb8d8a1d22facc7cc, 0x483c35a71d25d2a0, 0x7f8d25451ef9f608}},
+     {{0xa704016022ec7edd, 0x19124972cc9c8ee8, 0x697f301f2ccb9417,
+       0x3ee877646f00d8aa, 0x2b5afaf88138a017, 0xf152b14c832d7543},
+      {0x27c27ce2383052f9, 0x4746c5b5e1dae11b, 0x92dc5ac75b752008,
+       0xcf382e01e84fe5f1, 0x90e034197d5929ce, 0xafee3abb15ca3ffa}},
+     {{0xcb51f03954ebc926, 0xe235d356b8d4a7bb, 0x93c8fafab41fe1a6,
+       0x6297701da719f254, 0x6e9165bc644f5cde, 0x6506329d0c11c542},
+      {0xa2564809a92b4250, 0x0e9ac173889c2e3e, 0x286a592622b1d1be,
+       0x86a3d7526ecdd041, 0x4b867e0a649f9524, 0x1fe7d95a0629cb0f}},
+     {{0x11dd860e1c6d03b0, 0x30c1700809eec660, 0xd4f8aff635c0192f,
+       0x96a727b1e3a4a900, 0x1426daffde78c8ba, 0xfacaa9bd8d1527c4},
+      {0x0c0d5234cd072989, 0x1936c20d918550b5, 0x4828bee43d914fb3,
+       0x8324ea38f3ba26a6, 0x027590f3a94eb26f, 0xfd354295acd957bf}},
+     {{0xf4f66843ca5baf54, 0x298db357efe7db78, 0xf607e86e7365712f,
+       0xd58822988a822bc0, 0x2cfbd63ac61299b3, 0x6f713d9b67167b1a},
+      {0x750f673fde0b077a, 0x07482708ee2178da, 0x5e6d5bd169123c75,
+       0x6a93d1b6eab99b37, 0x6ef4f7e68caec6a3, 0x7be411d6cf3ed818}},
+     {{0x959353be3dfb423c, 0x8458e85836d41cc8, 0x6a4826f799d7a4f4,
+       0xab146ece52fe4b65, 0x94fc21d735038573, 0x26f50135f4d56e84},
+      {0xe15ca04d3162d92d, 0x8f652fcd34ed4e84, 0xef7e79244f21a910,
+       0x2eecb7e9dcc76132, 0x5b484745dbe89048, 0xbf8c490f6e43a2c5}},
+     {{0xf92b307363a0a7d2, 0x32da431c881dc8cf, 0xe51bd5edc578e3a3,
+       0xefda70d29587fa22, 0xcfec17089b2eba85, 0x6ab51a4baf7ba530},
+      {0x5ac155ae98174812, 0xcaf07a71ccb076e3, 0x280e86c2c38718a7,
+       0x9d12de73d63745b7, 0x0e8ea855bf8a79aa, 0x5eb2bed8bd705bf7}},
+     {{0x3ede2484da756624, 0xb22da2ab73b13062, 0x56069e93962a667b,
+       0xc931266b130f2cea, 0x4bd6a6fca7366a66, 0x23f30563aa5ac3b1},
+      {0xa025d0efd7c2b26f, 0x597ce7d862129bc7, 0x4809927f2b3057f2,
+       0xb001c10a1499f884, 0x309d141c30b9a653, 0xadddce7dbf659d05}},
+     {{0x33fe9578ae16de53, 0x3ae85eb510bec902, 0xc4f4965844af850e,
+       0x6ea222b3087dd658, 0xb255e6fda51f1447, 0xb35e4997117e3f48},
+      {0x562e813b05616ca1, 0xdf5925d68a61e156, 0xb2fa8125571c728b,
+       0x00864805a2f2d1cf, 0x2dc26f411bccb6ff, 0xebd5e09363ae37dd}},
+     {{0xe448127c9303b5b0, 0x6ac656817a74ec27, 0x05128a5286f0e7ec,
+       0x9d9f32c17603a73c, 0xb5a799bf556c51ea, 0xea94f169a9a9a416},
+      {0xebb3e549aebde511, 0x9037046af9cccd3f, 0x2a9343a8f08a8254,
+       0xc5cc43f6d40c7f26, 0xe1146cdcb39677d2, 0x6cbfec8bbe66d4b6}},
+     {{0xd2d68bb30a285611, 0x3eae7596dc8378f2, 0x2dc6ccc66cc688a3,
+       0xc45e5713011f5dfb, 0x6b9c4f6c62d34487, 0xfad6f0771fc65551},
+      {0x5e3266e062b23b52, 0xf1daf319e98f4715, 0x064d12ea3ed0ae83,
+       0x5ccf9326564125cb, 0x09057022c63c1e9f, 0x7171972cdc9b5d2e}},
+     {{0x10867369b0a219fd, 0xe7efac975ab56581, 0xde3372e87813f6f5,
+       0x3bbe59771d4b8ed3, 0xf17f61e553376573, 0xf719d06d97964b90},
+      {0xb1e8c483b24d2e4a, 0x53709647184379eb, 0xb739eb828a8fcb83,
+       0x5d2f3a4d60163017, 0xccedf4f4f823b4af, 0xa6e166a1ff315eae}},
+     {{0x2364fd9aeabd21b2, 0x3ce5f4bb9174ad6d, 0xa4d6d5d0b38688c0,
+       0x2292a2d26d87fd7d, 0x2a7d1b534ca02e54, 0x7bee6e7eb4185715},
+      {0x73e546098fc63acd, 0xf4d93a124064e09d, 0xd20e157a2b92daa5,
+       0x90d125dbc4b81a00, 0xcb951c9e7682de13, 0x1abe58f427987545}},
+     {{0x76452ac1e1c01fab, 0x167d73266bd32f0c, 0x72d209c14a283a42,
+       0xd26859b648ea0ba9, 0x7b3e5c466369309b, 0x474a962593c9a0b9},
+      {0x676ea3e4c76e25dc, 0xb0c9ccf771400c71, 0xc429587036f83518,
+       0xb86c1b39267f0c25, 0x8a3e352428884a80, 0xea182c4543ba8e28}},
+     {{0x6d35164030c70c8d, 0x8047d811ce2361b8, 0x3f8b3d4fdf8e2c81,
+       0x5d59547733fa1f6c, 0xf769fe5ae29b8a91, 0x26f0e606d737b2a2},
+      {0x70cbfa5db8b31c6a, 0x0f883b4a863d3aea, 0x156a4479e386ae2f,
+       0xa17a2fcdade8a684, 0x78bdf958e2a7e335, 0xd1b4e6733b9e3041}},
+     {{0xa6c32900af2825c1, 0xb37c46c1d223a04e, 0x691e7d39063de7ea,
+       0x998df4e710daf9bd, 0xc7085b9e718b5d7a, 0xd41abcc816b3d4b8},
+      {0x4dfce693f9bc4041, 0x383677ed659ec7a8, 0x2c1904bf4491fb34,
+       0x7c1bf1114552451c, 0x6562cc2c3c5e5e40, 0x1ecaa2a1fe0e4372}}
+    },
+    {
+     {{0x84c3630bf3087bc8, 0x152691e674be6e26, 0x5abd125ff61af001,
+       0x69bca56fbfea3525, 0x384af19900e0cb6e, 0xb0b13cfed00475a6},
+      {0xedafde495e394049, 0xd988b558daf2add6, 0xf14cf97a6c8ffcc9,
+       0x4d6cec23e5a9cc5c, 0xb0d678f88a104e05, 0x80a7fcba9fb527c1}},
+     {{0x0d6cadbfc22137d2, 0xb5db59d3628a3298, 0x3b433c734ab19507,
+       0x4fc53405660086b3, 0x770ae903a1eb0f43, 0x31b5857ef6b5b58d},
+      {0xe206e141d392868e, 0x8be6956f4b31de04, 0xcfbfca2f47449e07,
+       0xebaef25639fef8e1, 0x959e37b8c16fc80c, 0x8bb4bdd2e911d61b}},
+     {{0xc483d4b24343bbf8, 0x42aca2e18a0fc95e, 0x5165df6fcbab1fb0,
+       0xeb284370f6cdfc0c, 0xab565c00994320fc, 0xc0d157fd62133e80},
+      {0x7850cda55b69644a, 0xe37ae76a806ec8b8, 0xd14b805cc2c82edd,
+       0xcb5468b6cf244539, 0x97d43ee825dbe92d, 0x1442243689fb8f1e}},
+     {{0xd7bf2ac6a0a85236, 0x2921b55c7194c46d, 0x162fabaa9afa9762,
+       0x7b7f1664b62b36ab, 0x77b9f797296a84e9, 0xfcc1ad657dbd843d},
+      {0xc6e9c1e1cd77b7f6, 0x9cf0e272917067c9, 0xfa7fa93d3bfa90bf,
+       0x55846fe9d050e46a, 0x473b9a0d35c56256, 0xadd29e332b656a65}},
+     {{0x926c2552ebc69b0b, 0x953a850fd4c7432e, 0x0ee85e14b9359035,
+       0x8b10b01abde090a5, 0xb2878dcaec423943, 0x2571a178f70bde20},
+      {0x24ed159af5ebeee5, 0x60c202af043f6539, 0xdaaa76f4c8d4ffc3,
+       0x2fc1f1ba06eda10f, 0xddf159ee88ded556, 0xcfa71782e67b1ec4}},
+     {{0x31521f66d5d826b0, 0x0a63695240787844, 0xc0a3bd059c8f934e,
+       0x12c57dd42f0ce835, 0x847f6a9967064213, 0x1c9e1a7aa88bd71a},
+      {0xc4060eb2171e8407, 0xdf78d8dfed106780, 0xa3d28ceb0d704729,
+       0x4f8e523246ca3912, 0x09e9f852017791f4, 0x594006631e6ea97d}},
+     {{0x547b0d9583939224, 0x3a0823ff1e026769, 0x6016671525bd43ac,
+       0xb6cf475e18ba5f64, 0xa22f9c92c8b6d09d, 0x730553683ccf50ab},
+      {0xa6de248eee6deefe, 0x32aaf8b2acc3ca20, 0x0e254c5bad44e674,
+       0x8aa73e6535f95f98, 0xe622600160a2dc1e, 0xdf9482109109020a}},
+     {{0x372798f02893f2f7, 0x4f62bfac9e5030ca, 0x5e64f9a98a1e2567,
+       0x5870254ce70391c8, 0x2def81a341f02458, 0x25d4e4dc1d087bed},
+      {0x3557d07d4fe24a13, 0x6da49186dc3112bc, 0x08c8c5675f73ba50,
+       0x5309050b9c7c6706, 0x2ab67da3bd985072, 0x9bafa8b1e5df4e96}},
+     {{0x3ac662895c02f173, 0x6a110e3876d566e5, 0xd9cc14e2b9577e26,
+       0x6f3d5df9fdfe617e, 0x8fac740f352bb2ca, 0x50bc8a0cc28e6310},
+      {0x6e572fc477ac93f7, 0x56277377605bb8e9, 0xad6d0637402b8c55,
+       0xdab377914509eda7, 0xae770abc0854e91b, 0x523bd278742b3de8}},
+     {{0xc2cbd64417fecb90, 0x61616eb3b32dffdb, 0xdc4485a29f5d2095,
+       0xf78911246553371b, 0x4f06ba18bf9b20af, 0x136d4f291a2c4df1},
+      {0xc04aca34fb8b685f, 0xeec83c20f2b657bb, 0x4da5d70a5925a36a,
+       0x8060874172ff2965, 0x2e0dd9ff9f352620, 0x5f0afa6746d1a7a8}},
+     {{0xa995a95bf46aace5, 0x44ede5379eaa630a, 0x421f3b3500336e3b,
+       0xbf897478cf47c9ed, 0xf360ae32259e0827, 0x04e0e3e82e6a9f6b},
+      {0xb26eae5fa9136702, 0xd6cb15a1853674b4, 0xf81276e2748bcbc9,
+       0x7fc02e220a4ca1d7, 0xf650f48ecd82f330, 0xf4ea7c1dabaa8859}},
+     {{0x1ccd44ff95c746ec, 0xe18914b510405763, 0x50ed644321a3a927,
+       0x4f96a1b143ef8e8f, 0x7f5645e577952bf8, 0x4bc5c7ab66dbdf15},
+      {0xacc1612623930a08, 0xbf5ed482504cf9b6, 0xdeb7a798d71ecbd7,
+       0xf62e63b14a4dd859, 0x668809a7daf714d9, 0xdd836382f3a4329e}},
+     {{0x894bdbd9c48f3ad5, 0x687ff8de09e167f6, 0xf06104a930371c43,
+       0x82fd34b7ce84dd10, 0xae122deb66ce5abd, 0x31f041d2fc4a90b2},
+      {0x2589535c9a01c607, 0x231bcc85695bd7ab, 0xc67c306262e3a31d,
+       0x31be44757af3e186, 0x1a2077a388efa7f1, 0xffe53e22815fad1a}},
+     {{0xdd15591366229776, 0x84093730f7882064, 0x6dddcb14e50ee337,
+       0xa8e6ec597a1f7e81, 0x8467f998f3738a6a, 0x70fcc6bcad3f1840},
+      {0xf82eb4be723b3f4b, 0xf0f3935406beec1b, 0x1b181ea37ddcb539,
+       0x9c82c4faad6a81b9, 0xcc5ea5435c612c2b, 0x63ce7571bb258d6f}},
+     {{0x1b5888550b96547f, 0x4539c9c065d1a59d, 0xd6c95fea26e15084,
+       0xf84ad9e286b96242, 0x92f57d6d451a5486, 0x0215cfcb06a9e87e},
+      {0xe05b10eaf66e46f3, 0xe7b0e72f655a0642, 0x035032677b117f43,
+       0xf5b78105779ea4a1, 0x28ee00faa4adac77, 0x1ea67d716a93a2b1}},
+     {{0x7be81fb126882c6c, 0xe2d5a251ecd25498, 0xbb3d40e27a8d1678,
+       0x1806c67ad520811e, 0xadd4bb6686f65d23, 0x3a62b1b3e20e23d7},
+      {0x208b47006548b3eb, 0x0497f09ab7ec2809, 0xbd3964f8121c37e2,
+       0xd35ef301a598efbb, 0xbd76a276c5eef966, 0x64700a7f0af64e46}}
+    },
+    {
+     {{0x169474a2d3812087, 0x9de300da6698ca7a, 0x8589de922ede425b,
+       0x50e03fea6df8a890, 0x0d8a5c1c4ba8b8e3, 0xf273aa673fffb91a},
+      {0x21cf054475fc8236, 0x6ceafacf9799c242, 0xc3237eaed0962c81,
+       0x43d6ac34213f6004, 0x45e619b2d4148b6b, 0xfafa18b5ea5fb80a}},
+     {{0x9a8580aa2f063b51, 0xa83c8ff71c216613, 0xb4da0970be07f781,
+       0x0ac2a260712f7b7c, 0xc9b8ee84436a7b97, 0xd758c20d11fb2f62},
+      {0x5daabed9f170b799, 0x018d2fddc46bc387, 0x82d6b5b7d96cfb8e,
+       0x4d7d0d9344d9e843, 0xfa2a9ea991e7da3c, 0x8230c1a3d531b253}},
+     {{0x82412f525ec31754, 0x42f462c89d32e890, 0x1e7b58cece897ff2,
+       0xcfef785241164628, 0x34ee0422d8bb22ef, 0x6e0d44ac7d32f01b},
+      {0x968251655a3cc196, 0xa26724dc99eb23d3, 0xdb575fafa75f7252,
+       0x778e333062a3e5b1, 0x8689884e84cccc80, 0x9883cd19b645502d}},
+     {{0x4cc41f2834220e26, 0xb5937c6da49749c4, 0x705366640fa1ca24,
+       0xeeb40f3b91e5edaf, 0xcdf98235f1d3de14, 0xa65e5b7eff018c43},
+      {0xaa3228e7acee3a6e, 0xb63a6289e08f4ff1, 0x90e90425650b2daa,
+       0xe4a8cad26d875f17, 0xc212029c9ce8a46e, 0xce0512835ed7cfb5}},
+     {{0xb0df226159b79436, 0x82bd0dafa195be26, 0xbc99a94b3398c317,
+       0xbeb44c903c96ee31, 0x3c39ad81664d2e46, 0x081787520a3e0585},
+      {0x9a054b6b413e269a, 0xbe58891d98c3b62e, 0xe7fa4c4de5734974,
+       0x8ac535f4d0a846a8, 0xea0f95f1a651339c, 0xa255274fd96aa239}},
+     {{0xe23b7b229534047e, 0xbd70aea83a3bd625, 0xf44b05fe238db60b,
+       0x9c46fb140293abcf, 0x12cab5d3bfd8875b, 0x1f38d4aa12dd0c65},
+      {0x4bed41572adf9805, 0x3f87da928a56609d, 0x10b93363da02c903,
+       0x7ecc726621ce4786, 0x8ae366851e3da5bf, 0x196040ffd3edee12}},
+     {{0x4805841fe81508e8, 0xe2a578d3a4808642, 0x6bbf10accd0b2555,
+       0xc5071effaf5cde28, 0x665e75439a7124a9, 0x157c11edc1437981},
+      {0x2019367d7aeddd8b, 0x74a1e104386e3b8a, 0xe72d429bfbe09a42,
+       0xaca96fd9061b862e, 0xbb2d2bc8122595f8, 0xc90c6503c509d644}},
+     {{0xadb5966fcff05ada, 0x8ed26c025c57284e, 0xa76e73e244693a95,
+       0x14da74355982bbd3, 0x46e982cd5d2ca132, 0x8f39074024938e76},
+      {0x749206b30a89b09a, 0x429653c793b4a1e5, 0xbee3d1567025bb7c,
+       0xe23f0e1e19555c9e, 0x0dec3837751639ba, 0xb36cb84405d43bd0}},
+     {{0xae76a96e74f90b6e, 0x5fa8e94824c6789c, 0x2b3584bb03abbb81,
+       0xe19ce47c5c451f72, 0x35792fbad619ac7a, 0xfa0282a250059bf4},
+      {0x562bfd14dabe692f, 0x1aaf542c47eeb6c2, 0x392d5bba045d0360,
+       0x4e7bb31bd80fe998, 0x08f62ef31111e14d, 0x4de917b04e9ee1b8}},
+     {{0x8b9d2d5867166271, 0x658db4ea142bab7c, 0xdf84932fa4ad2849,
+       0x04b113355f6f86a7, 0x2de6b29c50cfcea7, 0x46d8f68a9be6a3a3},
+      {0xfb88cda7af0204af, 0x3ece449126029d72, 0x69fef1e23f946dfd,
+       0x708532fb01ef7bb5, 0x78d5053deb3795a2, 0x819a63206b36d57b}},
+     {{0xca07e0c1e509d19e, 0x6c7e42c39f6281b1, 0x0e2ff43977b66728,
+       0x1d740e7880e76251, 0x6bfae4c631a0eb23, 0xd78ca917aa9b0b3b},
+      {0xe140c662991e1781, 0x6e396b5f0dd3cfee, 0xf0a1d1976ce7f6c7,
+       0xbe10f8efd5b01564, 0x865cbd54101a5194, 0xf665885266861ded}},
+     {{0xe4e52e865b28f7da, 0xeb43a6809a58683f, 0x73b951bfb49f2b38,
+       0x7b6cb7db3f8097cf, 0x9dfb8d0b328fbf05, 0x491635a5ebce6211},
+      {0xa31a152390fdd577, 0x334120df1cd2f39c, 0x1d22834e6b563876,
+       0xfd91b30d10ee5a28, 0x3d7a282d59aee4ea, 0x36814c6b73300a76}},
+     {{0x7b584add6621c251, 0x98da669d4233aba3, 0x4d652b7933aa2065,
+       0x901bcfb8df7b4ed4, 0xb2ce587948012f81, 0xc18e2cd63cb71b88},
+      {0xadb0f2bdff86279d, 0x46d9e5d65bd15866, 0x11b1fb3ec635a4c0,
+       0x8bcd0ad201b1006a, 0x0f6f7502cbab210b, 0xd6cc3e560d6b3995}},
+     {{0xa54a6420137264c5, 0xa6ef0e78f9c2e45e, 0xba8b5a73d58d850c,
+       0xc0209ed86ef6fc3e, 0xe39dd0f391f7518a, 0x74697b8942b3eda6},
+      {0x2dccac36abfc9150, 0x80e4fba298b2f5a5, 0xe0e56fd2771018d5,
+       0xa31fd1684c22bb94, 0x8b0998f71a66ef21, 0xed483e55b5a53ddb}},
+     {{0x95db1c0ef23978eb, 0x80ad1612f04011f4, 0xe76bd1824d7ae83d,
+       0x841d6e668fc3bd60, 0xb68e80796875e2d0, 0xe3965efcd5d9dee7},
+      {0xc488bb7e58930931, 0x52f4de19a907aa24, 0x39aebbdd321cc197,
+       0xd2f5b1f967de5c66, 0x60f1a8c28efe3e76, 0xf40604a0af988831}},
+     {{0x78b5c14c0acb5935, 0xd9ec715c4311d3be, 0xffa22ab209e1759e,
+       0x5a86263db4b2f68c, 0x71e77c516b5be7f4, 0xfb5bea3a19844f6d},
+      {0x2519d0060890ffab, 0x426a03f0f0329ef0, 0x2c6d74a685b3c2a9,
+       0x9306f68fc294f449, 0x552e77c22c69fb46, 0x7c7337ad10bb9886}}
+    },
+    {
+     {{0x3313a9d544b133d9, 0xdb85c25d2da910dd, 0xc0fdef915e4dd5cd,
+       0x902a2a93c565dd67, 0xd8eba4dc7fed05ac, 0xd453995ce157dae9},
+      {0xd655d0b3f250cb55, 0x4194a09e86119222, 0x5b7e525a0652872b,
+       0xaf7968efe68c0ddb, 0x2ec02930f51cb31c, 0x237f3ae4f2be071e}},
+     {{0x9b23ab4e94d0864f, 0x46356266009c9fc1, 0xdbe99e51e798edf9,
+       0x38547449307675c7, 0x23ffaf55628c0fb6, 0x56ccd2a31698c372},
+      {0x39f45a578347ce95, 0xe0aaec744f2c6118, 0x2a89079e4af138fc,
+       0xb86371ea2ee4ecc0, 0x076d256a06bbf92f, 0x9073adb8ae3c4c51}},
+     {{0xdaa77b434c99252c, 0x59e38731326cb0e1, 0x281a38cc03ca6c85,
+       0x83565666433835a0, 0x3654ec9e30a928fd, 0x1c82abca7cb281f8},
+      {0xbeba0fe513fafa6f, 0x6743229299440e63, 0xd62777af0034d0cf,
+       0xd42b95fe9cde52a0, 0xb5b891bc6a23630f, 0x8e4d298464594976}},
+     {{0xba2e9543743c15d9, 0x7d5812db1c99c984, 0xf94db95145bdc19e,
+       0x951d00ae382e77bd, 0x9940a5fbb220b29a, 0x6908d50e58fc91f1},
+      {0x682e42eadd0940fe, 0x2124e23aa1d32009, 0xbe15810016294d05,
+       0xaea13fe32e326d68, 0xc0dfe1ef15e64fce, 0x32dbc0b5b8237a8a}},
+     {{0xea6f1448663771f8, 0xbf11f1269a0906cb, 0x8c08219dd1a6a6a5,
+       0xf2af6e04dd56f277, 0x8ad26705d569188a, 0xf05476316e071c9b},
+      {0x945f40bdfd4aa6ec, 0xbd6a8a8d8486987c, 0x4f577728b947b6f2,
+       0xe2754a8e7aab6bc1, 0x918d02cdfb48a9ab, 0x7e3ddaeabf904200}},
+     {{0xe59b80020bc28725, 0xc6f8fa54149f8991, 0x8799172a5af5b47e,
+       0xf72c9780160d7e8d, 0x1d1ce972b2f9a549, 0x8fce3f164857b44a},
+      {0x2545bdd71ed5e0e5, 0x222c33a7c259176a, 0x5a60343a4e23c064,
+       0x986779f91d1fd9cd, 0x5bd5611b3570b5b3, 0x2758caeaf9d765a3}},
+     {{0xd8135f003a16e352, 0xbfc784b255d4e996, 0x5da463210a6874d0,
+       0xf1635286e8e1e4d0, 0xe71332b3a0e9c4de, 0x5f07611760fc995e},
+      {0x1c1305d1c19ebb59, 0x1d5987f24603baa2, 0x6b7885b0ea7c9f9c,
+       0x362734e8fe9ba1fc, 0x49a3ff32b3892110, 0x0e5b2166d4997512}},
+     {{0x6ee65a08c36d3f25, 0x7b6c811fe393e4d4, 0xc4a2cc382876e523,
+       0xab7aba26d3bf53aa, 0x5bf00871db7f290c, 0x3cb1cd131ee6d5bd},
+      {0x4cafb218de998ada, 0xa1ecf36af6319101, 0xa1fe785520b281cc,
+       0xe457198e64d9c65e, 0xa3d1a6d0c5a0e67b, 0x69ddbc3290cc468a}},
+     {{0x3f3cb2a553a38094, 0xc93081523b19448a, 0x9cf32819925ba579,
+       0x44b9590a1801e686, 0xab6b284cdf04be40, 0xc40a58e62c216ae7},
+      {0xa6ced619018a60e8, 0x83d4cde183e5cc65, 0xe2559f51b5a91945,
+       0x53d9122bef0f53ee, 0x474c281b32e40a83, 0x332324a7944dfe65}},
+     {{0xcb0a3657a1fd057d, 0xad79ae60b4aa013b, 0x0b85210997ed887a,
+       0x5fec3e1f30d9b297, 0x4ce4149f10fb9c74, 0x4e08b4d98cbff785},
+      {0x81b0d7b42f07cbae, 0x08bc321e495230ae, 0xaec221de2b841eb8,
+       0x62c7d86ad83c22e6, 0x5504dcf885affe91, 0x785a06f1f445481d}},
+     {{0x8b68acc418670cf4, 0x64073a95cba49dca, 0x633757b09f508534,
+       0x78ad9df7916f3a09, 0x46187c9208617468, 0x48f37eb6c5f77b94},
+      {0x333224f0d058bb27, 0x7f28ace7d8852abb, 0x8c9f634fa2e62327,
+       0x75212283c4116c1b, 0xb7723ad0cc0c0851, 0xc8a4cff15b72e5aa}},
+     {{0xd4ee3f7f6dadc46f, 0xa1f3dc925d7febd6, 0x4c0bee1363ebab5b,
+       0x70e32d77005ec237, 0x302fc73dc52fb006, 0x1af84c0a8f159899},
+      {0x42a5478f0686232a, 0xb4fc56348a308687, 0x042c4970c8378f0d,
+       0x70c195758e2c86c5, 0x61a95e6884c7c767, 0xd96a8216d6fb43a8}},
+     {{0x67f8fa3e1a2db746, 0x2f041d4aba267cad, 0xdf8126ea65bafbee,
+       0xf63fc68ffad7b234, 0x4280e1e1702db8ab, 0xbe6122f202468fc2},
+      {0x06b076d0c89b74de, 0xc25155434bbdb7cc, 0xae82a08f50eb6108,
+       0xf49da2342f0f3f5e, 0x7d1923b2eca6448e, 0x9e01d58c70b144ab}},
+     {{0xeaf237a8ee49a1bf, 0x78bf04bf4ea1da86, 0x5fbffa473f251ad5,
+       0xc40570f6d828578e, 0x5cc65c0dd4e118ad, 0x9e18ff965da48548},
+      {0xe27fc2e7ef7e714b, 0x19ff3f7c13df7524, 0x35a32fa55e27fb12,
+       0x7fcfd72810003fae, 0xc74b50a3f49800c1, 0xbf0732ebdbafb2e6}},
+     {{0x1d1b02abc1238c95, 0x85b3878aee8c4d2b, 0x23ba366cc761afd0,
+       0x47324d034f023bb7, 0x75902ccc388c8e5b, 0x374484b986e2e6b6},
+      {0x38360f849f548719, 0xdf99991641cbc7ef, 0xa9cbe2985091ed27,
+       0xcf5a1440c5f2cb5d, 0x5bdff729d413500d, 0x55530d56373f8b2d}},
+     {{0x0c62fd2d543c1255, 0x71ea9c6fef361a27, 0x76b0933dcef3f9e3,
+       0x51b1ec2d9889ffa2, 0x9e84b2ba9a3c88d2, 0xc8996b961913e52f},
+      {0xbafc5e94cee43e36, 0xd9898d2470c658b7, 0x4e9bcc41bed17108,
+       0x0db5b7336c7a41c8, 0xd4be07a7795369cd, 0xb899f92f7bd3a934}}
+    },
+    {
+     {{0x3f2eff53de1e4e55, 0x6b749943e4d3ecc4, 0xaf10b18a0dde190d,
+       0xf491b98da26b0409, 0x66080782a2b1d944, 0x59277dc697e8c541},
+      {0xfdbfc5f6006f18aa, 0x435d165bfadd8be1, 0x8e5d263857645ef4,
+       0x31bcfda6a0258363, 0xf5330ab8d35d2503, 0xb71369f0c7cab285}},
+     {{0xf16938f514c5969b, 0xde2e3cf0944b2271, 0x2d5095530b6490d6,
+       0x8432fef1a28a296a, 0x6f254dd08d26415c, 0x3780eeadd50c2865},
+      {0x4f5bc455665b8794, 0xef31fb9e56cb7018, 0xbab8dd6e65e59340,
+       0x676baca2a56dc2ea, 0x38eea06beaa90e05, 0x26e64224174bada0}},
+     {{0xe6a19dcc40acc5a8, 0x1c3a1ff1dbc6dbf8, 0xb4d89b9fc6455613,
+       0x6cb0fe44a7390d0e, 0xade197a459ea135a, 0xda6aa86520680982},
+      {0x03db9be95a442c1b, 0x221a2d732bfb93f2, 0x44dee8d4753c196c,
+       0x59adcc700b7c6ff5, 0xc6260ec24ca1b142, 0x4c3cb5c646cbd4f2}},
+     {{0xa35e411c2cb40964, 0xdd7d4f4cc331a3d6, 0x7c7c859e89a66f2b,
+       0x9908c37e0def8ecd, 0x8274124e344947b7, 0x0d279f7b568b0ce8},
+      {0xe5291961866091ec, 0xb056e3bf3a08acc7, 0x60fb39e156bd3a7d,
+       0xe56a34d6268f8562, 0xb3a1fe1613fd8293, 0x6a41e1a967537fcb}},
+     {{0x8a15d6fea417111f, 0xfe4a16bd71d93fcc, 0x7a7ee38c55bbe732,
+       0xeff146a51ff94a9d, 0xe572d13edd585ab5, 0xd879790e06491a5d},
+      {0x9c84e1c52a58cb2e, 0xd79d13746c938630, 0xdb12cd9b385f06c7,
+       0x0c93eb977a7759c3, 0xf1f5b0fe683bd706, 0x541e4f7285ec3d50}},
+     {{0x89e48d8bc6bb5e5f, 0x0880ede01ea95a10, 0x60f033d7302c0daa,
+       0x15e4578a048eefe3, 0xfd6dec89b0a72244, 0x1f7cd75e309489cd},
+      {0x7cdcc2a0e9aba7fd, 0xd18dc5c7f28ba00f, 0xa6300a455812b55f,
+       0x8fa5c4152ca31d8c, 0x36aa3c234f3a5b5a, 0xd128739ec86cf4e0}},
+     {{0x9a0e153581833608, 0x5cce871e6e2833ac, 0xc17059eafb29777c,
+       0x7e40e5fae354cafd, 0x9cf594054d07c371, 0x64ce36b2a71c3945},
+      {0x69309e9656caf487, 0x3d719e9f1ae3454b, 0xf2164070e25823b6,
+       0xead851bd0bc27359, 0x3d21bfe8b0925094, 0xa783b1e934a97f4e}},
+     {{0xd927283013575004, 0x01a330d620b2275e, 0x58b9207f450db713,
+       0xae95338423e16d95, 0x4f10c6d4e60e349c, 0x541d03ecfeb122bc},
+      {0x22548cd22c648211, 0x5c2dc84cd01354f5, 0xa1c6f912b6167b3c,
+       0x6967bab27902d2ba, 0xebbe0b0836de34ba, 0x6985b33a4b79625e}},
+     {{0x406b0c269546491a, 0x9e5e15e2f293c4e5, 0xc60d641315b164db,
+       0x0da46f530c75a78e, 0x7c599bb7ea0c656b, 0x0f07a5121b1a8122},
+      {0x14c7204a15172686, 0x8faedff85165625d, 0x20f260ce37aede40,
+       0xc81f771e8f357ffe, 0x25499197b0912557, 0x736197dc4c739c74}},
+     {{0xf2d015bdaefdd5e1, 0x33b4e21c4bf9edae, 0x4860aadc64b35fcc,
+       0x77b657e9f13f8112, 0x65f2862590dc84fe, 0x4eabfd22d66be036},
+      {0xb02131236ff05dd0, 0xa104d4aaa9fe5d11, 0xdc7efe3b9b8ae390,
+       0x46918b54eb87fb5c, 0xf5771d7172b7172a, 0x41e49e4713587bf0}},
+     {{0x6151bab1381b3462, 0x27e5a07843dbd344, 0x2cb05bd6a1c3e9fb,
+       0x2a75976027cf2a11, 0x0adcf9dbff43e702, 0x4bbf03e21f484146},
+      {0x0e74997f55b6521a, 0x15629231ade17086, 0x7f143e867493fc58,
+       0x60869095af8b9670, 0x482cfcd77e524869, 0x9e8060c31d454756}},
+     {{0x3ec55ddc9004b845, 0x5101127cbe7b06eb, 0xdddafd57fc4176e9,
+       0xd8cb31c0e4a31ddc, 0x94e83a89d42feabb, 0xd4401def2f74ec68},
+      {0x9c9defb65adb654d, 0x9a3513f05053eeda, 0xceab2dec7cdb455e,
+       0x9954280859d24f59, 0x22ead45231d30504, 0xe9df48f90521a229}},
+     {{0xe495747ac88b4d3b, 0xb7559835ae8a948f, 0x67eef3a9deb56853,
+       0x0e20e2699dee5adf, 0x9031af6761f0a1aa, 0x76669d32683402bc},
+      {0x90bd231306718b16, 0xe1b22a21864efdac, 0xe4ffe9096620089f,
+       0xb84c842e3428e2d9, 0x0e28c880fe3871fc, 0x8932f6983f21c200}},
+     {{0x36dd28ea441d0806, 0x6680c72c21518207, 0xc5d40e280a484dbc,
+       0xdb1170c6a3a2ba6e, 0x07290fd140a91c7d, 0xdd12571695ee9ca2},
+      {0x595dad6307876188, 0x6fcf18c0499d4827, 0xdcd946a3206e617d,
+       0x6cf08f51e7bceaef, 0x7a85c02db19a06ac, 0xf1365fc67140a7df}},
+     {{0x603f00ce6c90ea5d, 0x6473930740a2f693, 0xaf65148b2174e517,
+       0x162fc2caf784ae74, 0x0d9a88254d5f6458, 0x0c2d586143aace93},
+      {0xbf1eadde9f73cbfc, 0xde9c34c09c68bbca, 0x6d95602d67ef8a1a,
+       0x0af2581ba791b241, 0x14f7736112cad604, 0x19f2354de2acd1ad}},
+     {{0x9e857f33771560ab, 0x4ae1ba22250f109d, 0xf8538d68ff4f6566,
+       0x35380f15ac339148, 0xfef0bfdd5ddfc12f, 0xf706c6bf1387d93e},
+      {0x618ce77d5357e131, 0xf0921744236478c4, 0x24eaf06e00dc0da5,
+       0x049113be07603cc7, 0x5cf489088f6963c7, 0xbe5eb9e6ede4a300}}
+    },
+    {
+     {{0x77e486f85d066c15, 0x0c05b6c24ed5307d, 0x322b28ab7df36628,
+       0x2d14d1316704dcd6, 0xd359977af29a3567, 0xc29bb132ec96d3b6},
+      {0xfd6e400ae6bfa701, 0x03db99244c7e5101, 0x62d81c7d9b8533af,
+       0xefa638c28de66eb8, 0x7405a9d7e86784ee, 0xafaa74efa6c22223}},
+     {{0xf9b2dba4b9d36e91, 0x5fb4f6cefda9b2c4, 0x7692a4f33b8104ee,
+       0x5da885b0e4e1896e, 0xc2a30fec73d2aa36, 0x7d06e6af86f60bca},
+      {0xbc8bf16d87287887, 0x6c3dd86a3d701bec, 0x8e79e2f37e35610a,
+       0x981139f482f9d71c, 0xf8997ec424e62733, 0x330d989aa3518061}},
+     {{0x4e6ef410ca89fbad, 0xe0fc53ba53933b78, 0xa4f03403fd41d143,
+       0x3a507177e0774c37, 0x078e8c568ec7484a, 0xfb73c6b6fbb3f66b},
+      {0x169c94753bfbdff6, 0x44d286060a232243, 0x3e8e968508303114,
+       0x7a9797b8fad0def2, 0x0ad14404efc1c8da, 0x6daae4e921ced721}},
+     {{0xc7e9ddef88dd2dc2, 0x2c21a99819a0c0b5, 0x6bc0746db239bb82,
+       0xc811a8eb28ea1341, 0x5f714ca71d1309b0, 0x79eabd20d4eb9b34},
+      {0xe0e5afdcdf0fb30f, 0x1b01a16d8c0814c6, 0x670e1e7b84334366,
+       0xc8c38f9a0eed1116, 0xf914fae2619bbd50, 0x1ed062cb51c1995a}},
+     {{0xd4e60e15cb583422, 0xc6b1ef90320f296f, 0x0714bad0d9bfc834,
+       0x5ee2ca8c9050e2c2, 0x074a8ca824f7cf1d, 0xb975024910df8516},
+      {0xecee8ab7c2636d2c, 0x308e5af13b4b7bbd, 0xfed4f27eee2ae021,
+       0x7cd4bb192065253b, 0x6b21a3f84de525b4, 0x0f10e7bdac27fddb}},
+     {{0xd5068487870e29cb, 0xf9420b85fc52d5cb, 0x50c3265a496d000d,
+       0xe605414a166bd6b4, 0x4de8d724c62b2a6c, 0x16af06f2a1a11048},
+      {0x5406bde945f43c4c, 0x5e15bf6c751ad18e, 0xa846e665b6a59587,
+       0xcdb28a7d1816ac55, 0x899b3551819b73f8, 0x2d46297bbc848d08}},
+     {{0xdc4cc720299127be, 0x5b34e762faab8165, 0x2289b2f7b39c120d,
+       0x687a78d06e52b913, 0xd2a091dd2a3ea6a5, 0xc61eced638eab329},
+      {0x652231ea7887ff2b, 0x77a568750479db4e, 0x1ef471c8d43c5722,
+       0xf82bf436f3764c34, 0x962af4050445cafe, 0xed8b227f5ff47259}},
+     {{0xde849cd1d89594ab, 0x00e2d2b10ec4fb3a, 0x3fbd9e3dabe92fba,
+       0x785414d43324900a, 0xdaead1abde20904e, 0xb493e121aa5f1ba8},
+      {0xd60a4f2d6eaea0dc, 0x394746b56fca8596, 0x163dc78934efa243,
+       0x3067dccf216a8d8c, 0x116b6534a901617b, 0x8c4bd099bbabe51e}},
+     {{0xc8c2df45ac3a082c, 0xc353d074c8d4c40e, 0xb214f9c05a3c2de7,
+       0x504bc42cf86b0214, 0xc82df5cbd1922a58, 0x40887948a5bc3267},
+      {0x04bcd21788ba8bb2, 0xe21b3e7f046fd401, 0x8419c338616af5cf,
+       0x7f24760baedfce9d, 0xded8035bddbd519a, 0x1f1fb0d71693faab}},
+     {{0xbb067b49d02ffcf6, 0x7cedf8f93e657299, 0xc3829961406bbfe3,
+       0xefe4b5aa37c12472, 0x7dc01cf9fec7dee8, 0x70a9db2389472f50},
+      {0x29c269f8b31bf737, 0xa26deac3ae3fa7db, 0x0046e91233caca41,
+       0x3bf4bc8ab6e78b55, 0xca83bc6cd9eb5ef1, 0x73f25c62c0c5deff}},
+     {{0x697dc47d44b4aae8, 0xb3525cc0782c331c, 0xff71cca40bd7c78c,
+       0x5f3d776610c0ab69, 0xbdc10267e2ba07e3, 0xc656f75ce6373f6e},
+      {0x9e2938b4b5607b62, 0xa65017d410b0a0f7, 0x8dad31195cc6ac25,
+       0x00f8f2d18ba5d1e6, 0x608137bc43305aef, 0xddad34bbdcb81cb1}},
+     {{0xe133d941b1f82ca5, 0x2af8b98bfdf115bf, 0xdc6179c857aaa6f3,
+       0xabaa83e9130ade06, 0x7836b6fb0e8bffd1, 0xc479751ffa103703},
+      {0x0ff3c1299c89963b, 0xe64072560b84c24f, 0xa92a4ea2f34f6bc9,
+       0xba45b3053197989b, 0xd12b5a0199243aab, 0x3015772c442af625}},
+     {{0xd95fca81e6f065c5, 0x45e886d5fc8655de, 0x3580957727cff79e,
+       0x92a39a34625877d9, 0xdda02684dfee17ee, 0x6354f871986f635b},
+      {0xb3a6e9edd409c182, 0xf0b1c8d9c4fbbb3a, 0x28721c019b77aded,
+       0x3c356df1bf94f028, 0xff221bd229a81f1a, 0x20edf2e856b20b0d}},
+     {{0x97fff124835fda9e, 0xa79ceb2f0bc68512, 0x70ba93d1a2fc3995,
+       0x62bd28ab9e51c5ee, 0xb95fa624d5bbbaa9, 0x0654dc458c1f571e},
+      {0xb9a4edc665a45ed6, 0xbf5ed1bc21ad0612, 0x74adc1a1b1a3551b,
+       0x3dfa3dc8dbbd6cef, 0xce5dd40b2fa3afd2, 0x14894e0f30a746ca}},
+     {{0x7e729c58b8ca2a2c, 0x0f32ea1ecaac04af, 0x47267f13bdd549e3,
+       0x35b9440690be3b50, 0xad0f2bb14b27f670, 0xd7e5874e92341803},
+      {0x7dc841cf1f9ec462, 0xebeff994512b2a42, 0x22998a7f320dc858,
+       0xf08eb5c719946f59, 0x228c8dcda68ea75e, 0x40dc6dc37b20dee5}},
+     {{0x929454f6b3952db4, 0x412142ec4d3f69f5, 0xf5b0a7c5ee25c0b0,
+       0x7d3372ff2e752295, 0xd6dadc7d6eacac68, 0x5f0076cca96a8e3c},
+      {0xea831db671725b3a, 0x4a286c89c29ab454, 0x5ff817e572e3c00c,
+       0xb022e25d2a5fb6ba, 0xb611c5bcbb392476, 0x062c14dc190485a0}}
+    },
+    {
+     {{0x0372678dc419b0aa, 0xf95031d8c13fdf17, 0xebaebca4b79594c3,
+       0xe587850baf3b75cf, 0x534183ac2c1e09c6, 0x3f5b0bfdc08204cd},
+      {0xdac2cf06e297cc77, 0x5e47d9c6d0487084, 0xf6f509f490b0f6c2,
+       0x3ffc3cd6c2c62207, 0xbb21eb1132ff1887, 0x2116a023e62ccc6f}},
+     {{0x406a7e2116960728, 0xd03923f85597d8c4, 0xd4402eff020748ee,
+       0x7827442af39b58db, 0x77e3f2768d8cfb04, 0xf6eb49c8e45a978f},
+      {0x9db0829949247f6a, 0xce71a74706669fe5, 0xe434ce47b82775f5,
+       0xe84995ef63910016, 0xa35e8b971e47792f, 0xc779cb3d7c6aaeb9}},
+     {{0x66428800ff381db7, 0xa9b9d01955574ac6, 0x30cdc21fbdf4a86c,
+       0x2ec38d35741c4a26, 0x35496c230b6be057, 0xaecc67e601656b1f},
+      {0x781af00ff7d70324, 0xac0e65795d7ee71e, 0x60a35c6ca6b14e3a,
+       0xacd6813b0e6c1c3a, 0xd7f770241faeef73, 0xd2254b8f23eddf05}},
+     {{0x1fa064cfaf31ea1d, 0x2a9547a848e8d974, 0xda8102a1fa9d9453,
+       0x786aecabdc6bd7ea, 0xcaf91e3bca2f6044, 0x67d86ea78573f208},
+      {0xd309fce9c505ae24, 0x67ddc5b17f86eb8e, 0x57791ae0f3d53056,
+       0x26b053f00d1fd61e, 0x91c962c0045ebfa6, 0xe95246de076ed979}},
+     {{0xc49c99895f6e9ea4, 0x4a91578be16ec8e4, 0xa1c54e890aeb5ac5,
+       0xa9094b07ee09b9a0, 0x3587752f09a74b27, 0x973bf8b044bbfed0},
+      {0x91c26f235636a52e, 0x8ac948b8eb7e3b41, 0x14234675fc457d56,
+       0xde98e4fac76398a3, 0xa80f73110f4a46e0, 0xcba089bd22b66fa3}},
+     {{0x156eaf570746d174, 0xa2d4a83dcda35250, 0x60a9f48c0290fa02,
+       0x9855d26d5c33b4ac, 0x06e379c697eb1c30, 0x4f2e2dbe6e219664},
+      {0x6b7448f829006065, 0x237a1f31115062a9, 0x5c635a90ad92cb24,
+       0x2e857f8c2eed977e, 0x3d512df7856dc88a, 0xbde85263e597a27b}},
+     {{0x0b114aea10a98e42, 0x6133aa52ae19dd14, 0x0c235df2a99eb2c5,
+       0x0085a6197f59582c, 0xf9002bba8cf7feba, 0x275742d7af6a3261},
+      {0x302b4823249e8e9e, 0xa142aba9ce696f91, 0xdeb28c4464c37b14,
+       0x14bb8f230766002f, 0xafeff88bc52fe891, 0xb9d493ae46faeb2d}},
+     {{0x49f24994e7c03ce4, 0x274a8c132aed9ba3, 0x897b9103d5e91bc0,
+       0x63db1efbcb404f68, 0x70efd9d842f7fc02, 0xd6e02921c6a230af},
+      {0x8d5b199f11ae0a56, 0xc98287dece33da6a, 0xde583d34504dd889,
+       0x03756001f823686f, 0xf19ab86f95fc73dc, 0x300406c693f12f42}},
+     {{0x68fdb78aa427d89c, 0x84e9ba49a3944c0d, 0x1c3569b1c1833422,
+       0x30773fc01a01f4b9, 0x18b8f17d7da01321, 0x8370fb0f7198c85e},
+      {0xda12c8d499a898e3, 0x7667b46a8ba82ded, 0x2aab259b77e1e31f,
+       0xd03f7708be71c9bc, 0x9f784cce8e43eb38, 0x7ddedc8b21c1208c}},
+     {{0x2f73595f7759701c, 0x8dc2069a6fe0e0d9, 0xb7de7114c286a65d,
+       0xfecc429e84c0e487, 0x51061a2c14344c07, 0x4d70972596869e37},
+      {0x8b02781f2be9403b, 0x6cb6aa02de3ab5d9, 0xb013508eff6bdc9a,
+       0x568d2e84e5438c58, 0x7b35a979e4206c3b, 0x0bb793c0b17a8bc7}},
+     {{0x4124805257ed2360, 0xfc0cb1b66ba9bd95, 0x342f16db2337a8fd,
+       0xe141741188099007, 0xc96c29ee8cd74752, 0x376047ccedf5fb4a},
+      {0x5f40ce08439546c1, 0x14d2c6661a235de8, 0x9b66892d98e355f0,
+       0x8a65f6dda4bb19e9, 0xf72848f8046a2581, 0xfed74b3b8373b2b6}},
+     {{0x3f896ca9fa4dd561, 0x4b9a98abd2de2ecb, 0xd0741632600e4e2a,
+       0x87c7db5f69e702d5, 0x1f5a3b8053e0df2b, 0xe1e24b49f443dfba},
+      {0xeb90e2305eef3a1d, 0x8f3fc8a6d38f73fc, 0xfb1e8299a5aa335a,
+       0xd78504cd4197b32a, 0x0e7a79cc6755918e, 0xc7c98ae2883b1c72}},
+     {{0x4b74fcbd969088c1, 0x4d16f895361a8c96, 0xefcb6ced760d61fa,
+       0x3f14a7cbcc3e8808, 0x51f5fd2c664ea335, 0xe0cad0903a65d305},
+      {0x86409de9031a6911, 0x23ea4aede5f9715b, 0x6e5b8cea1f3532c6,
+       0x33fc873e11271ead, 0x842b59a65b8131d7, 0xbd95818a61b7bf60}},
+     {{0x1a12727c03d2becc, 0x810a37dfc6741372, 0x44ac483fb7049f39,
+       0xab73e5e7a36fc614, 0x298d453feeff8aeb, 0x2127dd167e1b586b},
+      {0xeadc5c54e07bd60c, 0x67cdae00f5e2d2e2, 0x03fe0446c9d2f10a,
+       0x0784098795e38ed2, 0x5d348a7ce1a6306e, 0x4903f1b6562f5463}},
+     {{0x906ab8a84a3862e8, 0x8fc76114b2f5c878, 0x2dac39522035287f,
+       0xaa8372f318af4378, 0x915050c9dbf64476, 0x896f734de992d0c8},
+      {0x5c3e36da3a35846c, 0xfe774b4aac8f4fc3, 0x66347050aadd8a59,
+       0xea94ebda2cd12be8, 0x45b1e7e2dab94de0, 0x539d580e264b508c}},
+     {{0xbf66baa5b44b1d0c, 0xbbed18eda44f8eda, 0x80bc32abeaaa466c,
+       0x605b7897e5f2733b, 0xe9e7e3a1a2531afa, 0x25d66db33deb8369},
+      {0x36212ea3b2f25d10, 0x52d6b3f4a08d303e, 0xefa54b31444e9e9f,
+       0x9c2229a169530c1b, 0x68feb9854b79bdd1, 0xd570e84f8b984cc3}}
+    },
+    {
+     {{0xd6a4d25c845f26e4, 0x71e554ce1b039dff, 0x942059731cdedfc0,
+       0x0c4e385603d6502f, 0x981a4fc5e15ce8c8, 0x85d1b0f17aca30b7},
+      {0xf2037ef777bb9e43, 0xc52804f4e87ae187, 0x9c98a23c71f3e4e3,
+       0xa73c8b89f47b504b, 0xb9e33f54023233aa, 0xf2bcfc17f92c9f68}},
+     {{0xba03ba3b7b3b336d, 0xe57ce50928c9c55d, 0xf96b8cfe4f0f60b2,
+       0xb908d77e6fcccd96, 0x7208ef7de79dd17a, 0x739095333ec3d048},
+      {0x9c5ad2da1163fe78, 0x4e2a8685cd4a15c2, 0xac999449470eb938,
+       0xfaaf27fbee7d772f, 0xfbe402abd0b7ad09, 0x704d4f0e57db00a9}},
+     {{0xe93ee31ae12b4e64, 0x2ab8e378662d17f4, 0x2544bd9969516582,
+       0x7bf80e4b2e1e5485, 0xf30f0b14729d9361, 0xb3ffb5d18268d40f},
+      {0x34605055ac193a63, 0x9e5ca9a9f8e04d69, 0xcbbeebc1085ecbb2,
+       0xda03b75bf340eac4, 0x3bf9468a84436462, 0xdfa8b4c80f26f20c}},
+     {{0x10c082a63fc14a85, 0x59389ebc1c0b14c4, 0x785d935b4cb291a7,
+       0xfc2ae15313e9ce08, 0x3146fabf4df6f1c4, 0xa2a4a457c87dd24c},
+      {0x85fdd8771deb49bb, 0x2b7843709b055934, 0xc81d05013e7e0297,
+       0xb56ddd1fb92df904, 0x4612df9f295ddccb, 0xc24bd4cf0e27cf1d}},
+     {{0x5564875b422ea2c0, 0xabc2e7de8285b03f, 0xfd662091733e9f1f,
+       0x68f1674568465da3, 0x965a0a0538fa6f63, 0x0ed70feedfae710d},
+      {0x56c6227f153b24da, 0xf1dcf57401470f6e, 0x9992caa8f51771cf,
+       0xa884b48114a9b029, 0xad11cbaa7b9a4062, 0x60ec99d8e55533e0}},
+     {{0x86d9b06018674f49, 0x81b0648697bb1a7d, 0x9b6e8e7c27d9d64c,
+       0x79bd66baba04e6ad, 0x77e4d0b0828abbbe, 0xae7548accc540d04},
+      {0xf5d8a46f869cbebf, 0x99fb1a6338a6cc83, 0xb93bb852563fe6b4,
+       0x06bb3ae997cdd04f, 0x07f011d48b7de47d, 0x8d90e2e4de78f61c}},
+     {{0x731c6dd6d33cb6e2, 0xa3ea317e8cce0290, 0xdca9b2f91c42206e,
+       0x6acbbce9d1e5dfd9, 0x407458462fc948cd, 0xc7a50d91a82f9cec},
+      {0xb906d69e4c1aa161, 0x3a9b14be0ebe948e, 0x11a9f12cb63aeb70,
+       0x0365b4ccead745f2, 0x5f6c2bbdf9f16c17, 0x89131238a03e558e}},
+     {{0x7830460fd1944d1b, 0xc56f08e784350af2, 0x73bee2aa307d9c78,
+       0x1b02af1b5aad8b6c, 0x5e31882703848db5, 0x4785958bf230f476},
+      {0x4ea6535d4f80e25d, 0x9958c9c7d23c7f72, 0x4c197b332fd33cab,
+       0x24c7b0b1c566914f, 0x956ce3c371952d3b, 0x8735694bfabae5f2}},
+     {{0xde37ae2840ec913c, 0xdc915f83056685b3, 0xf7bc3488f66a4501,
+       0x30e610426a900e5f, 0x505525c1ca3cf645, 0x35338c53b1f3ed40},
+      {0x6823159ad70b7c41, 0x660f518a7384ba7c, 0xc6cf6a4b2482056b,
+       0xb308b2151df15990, 0xba63b2e3fb5c130b, 0x1c660db8277b7515}},
+     {{0x8a95e5c1fddc9fdd, 0x679d4e0f5adab0c3, 0x1859df6acda40bc0,
+       0xf9097aa58234471d, 0xaddc0c9b783c0100, 0x55388dc8feb7067c},
+      {0xe3805fd180a2eac7, 0xf800a75cec886879, 0xa45999921943a0a0,
+       0xb47f06191dfe627e, 0x313d4f09da06515f, 0xde26052d1f54a73e}},
+     {{0x85a1b8796827365d, 0x595a6915667debe8, 0x214670fb93a3d50f,
+       0x9dfb028eb37de08e, 0xdd077e2f9c6cf2a9, 0x96897d8fc9b96e8e},
+      {0xe6e93c07efd39543, 0x19dcdaa44454e73d, 0x4a67424fd7b8c758,
+       0x03d4de0db1e91e2a, 0x7c843988e887b6b6, 0x7db4f3da6ffdcfff}},
+     {{0x0db87bc3d8bb43ec, 0xbf71d27c13a7b669, 0xea81e9c4a3fd2a60,
+       0x190c9c71c9f017e5, 0x21864180bcc75768, 0x137bd61543dbcde6},
+      {0x5b090c715d468ff5, 0x3a622b60126c6bc6, 0xfef3d268a918bf24,
+       0xe10c52c8ae204f49, 0xf4be898d86d7c356, 0x8276da182fdb5a17}},
+     {{0x89c992af7f2ad562, 0x7e1459d9afc83ad3, 0x4c0d96819278dd04,
+       0x4496d9a7d8eebe36, 0x7c037261b8d4b1a2, 0x827c49a5bad3d6d7},
+      {0xf4d94deb836926ae, 0x65417bf64064af58, 0xa79471acfcdafc9f,
+       0x3f85ccb48123312d, 0x4d374cada3360be4, 0x56b476d6ee325a2b}},
+     {{0x0079c69d41af8c08, 0x7dcfa4f4acbe515e, 0xb8d1866601396859,
+       0x08590ca4946fbedd, 0x7fecd9b9641aace4, 0xaad5cc442936a1b6},
+      {0x925b6235f92c5958, 0x7b1442f182d6231e, 0x971e663d8c6fb34a,
+       0x543146dc2fc1c10d, 0x6e4053c70642b822, 0x4a49f247492e524d}},
+     {{0x1b51f7b417ba53f1, 0x170ff1eb3d5c43bf, 0xc2f160f8681f7ee7,
+       0x4c0a54d047814310, 0xfc689a13a83d061c, 0x1cbc99b47ff6333d},
+      {0xe19fd7906581cd16, 0x67da79c79ca37b0c, 0x2507d16763bd0b5c,
+       0x4449985b1befb82b, 0x6bea3969914699ec, 0x9f606dd4ef202abb}},
+     {{0xca9872e1597bd10e, 0x6725cc9a4aed951f, 0x96b17cb84e05b280,
+       0x97987146fa234d45, 0xba78949ebb35a7d8, 0xb82e9b9f6fc59384},
+      {0xa303e54a70f165c7, 0xfd6bb0dcb9c2cad9, 0xe57e2de8ee722045,
+       0xa05c106563e27035, 0xaa38e86602d2fe6f, 0x78e02fa8ee2f6aad}}
+    },
+    {
+     {{0xc0426b775e3c647b, 0xbfcbd9398cf05348, 0x31d312e3172c0d3d,
+       0x5f49fde6ee754737, 0x895530f06da7ee61, 0xcf281b0ae8b3a5fb},
+      {0xfd14973541b8a543, 0x41a625a73080dd30, 0xe2baae07653908cf,
+       0xc3d01436ba02a278, 0xa0d0222e7b21b8f8, 0xfdc270e9d7ec1297}},
+     {{0x4f120aa7e2a07891, 0x9158bab3a25d3225, 0xc96bac5ecfe5f7a8,
+       0xd4e73d59bbf3cec6, 0xed8d233560361cd5, 0x9b1a252c562f444c},
+      {0xbd37d3cfc70f23c2, 0xf13b3b6ea52ea19e, 0x7e35535a3d2f41ed,
+       0x0353b52ee8b1743e, 0x31d89dfd7b5a2765, 0x2b7ac6848d9ea8b8}},
+     {{0x06a67bd29f101e64, 0xcb6e0ac7e1733a4a, 0xee0b5d5197bc62d2,
+       0x52b1703924c51874, 0xfed1f42382a1a0d5, 0x55d90569db6270ac},
+      {0x36be4a9c5d73d533, 0xbe9266d6976ed4d5, 0xc17436d3b8f8074b,
+       0x3bb4d399718545c6, 0x8e1ea3555c757d21, 0xf7edbc978c474366}},
+     {{0x73457010c46db855, 0xccb68c43dd579fb8, 0x705b0e8c9c25fe5b,
+       0x40f36ea182dd0485, 0x3d55bc8527ac2805, 0x15177c6fad921b92},
+      {0x51586cd55ab18cab, 0xf51b5296cbb4488c, 0xbb4e605e84f0abca,
+       0x354ef8e3772dd0da, 0x7f1a8f795e4e1d41, 0x93461f09de5d8491}},
+     {{0xec72c6506ea83242, 0xf7de7be51b2d237f, 0x3c5e22001819efb0,
+       0xdf5ab6d68cdde870, 0x75a44e9d92a87aee, 0xbddc46f4bcf77f19},
+      {0x8191efbd669b674d, 0x52884df9ed71768f, 0xe62be58265cf242c,
+       0xae99a3b180b1d17b, 0x48cbb44692de59a9, 0xd3c226cf2dcb3ce2}},
+     {{0xf38995589311182c, 0x1bee4c4bb657a7b7, 0x0b1c4fd32df8d1a7,
+       0xf16bcc2376d3fbbf, 0xd5888916f4fd52bc, 0x3de6cfb4d5cde1f0},
+      {0x764ffffdd4a07dfd, 0x5e674426e2642182, 0x34f64762ccd57b85,
+       0x2233a4c329351062, 0xdf076095d9c642f3, 0xac917a2c59f0df34}},
+     {{0x9580cdfb9fd94ec4, 0xed273a6c28631ad9, 0x5d3d5f77c327f3e7,
+       0x05d5339c35353c5f, 0xc56fb5fe5c258eb1, 0xeff8425eedce1f79},
+      {0xab7aa141cf83cf9c, 0xbd2a690a207d6d4f, 0xe1241491458d9e52,
+       0xdd2448ccaa7f0f31, 0xec58d3c7f0fda7ab, 0x7b6e122dc91bba4d}},
+     {{0x3bd258d8775f516f, 0x4bedebd5c715927f, 0x5b432512e3f966a0,
+       0x338bfca7709d0c2d, 0xd142cc1049658259, 0xfabc6138636b8023},
+      {0xa9ef94014d4ef14d, 0xd5917ac1c54c570c, 0xfd2f63c55cb64487,
+       0xbae949b11cea475b, 0xa45446031e67a25f, 0xa547abc1dc6a7a6a}},
+     {{0x2a2dedafb1b48156, 0xa0a2c63abb93db87, 0xc655907808acd99e,
+       0x03ea42affe4ac331, 0x43d2c14aeb180ed6, 0xc2f293ddb1156a1a},
+      {0x1fafabf5a9d81249, 0x39addead9a8eee87, 0x21e206f2119e2e92,
+       0xbc5dcc2ed74dceb6, 0x86647fa30a73a358, 0xead8bea42f53f642}},
+     {{0x158d814db12c4bb1, 0xe52f75d22f0cf4fa, 0xf106023e6141b59c,
+       0x5eb8b8ebbeb9d941, 0x1dd3972990cf579c, 0xb273252e69ee6efa},
+      {0xe43a3c593e9947a0, 0xd605124f6c19dd01, 0x8090fdbd05c578b0,
+       0x8e6c535a622ff18c, 0x3600b0c257d12071, 0x6d026e5c78d001d7}},
+     {{0x636225f591c09091, 0xccf5070a71bdcfdf, 0x0ef8d625b9668ee2,
+       0x57bdf6cdb5e04e4f, 0xfc6ab0a67c75ea43, 0xeb6b8afbf7fd6ef3},
+      {0x5b2aeef02a3df404, 0x31fd3b48b9823197, 0x56226db683a7eb23,
+       0x3772c21e5bb1ed2f, 0x3e833624cd1aba6a, 0xbae58ffaac672dad}},
+     {{0x00e0a003daff1807, 0xcb9d155992c94fd0, 0x3c2b5c3dcebbf905,
+       0x9c799ec7d338afa9, 0x60b9908c4e2cfccc, 0x4bfe1a57ae3c6f92},
+      {0x480d310efb116150, 0xa1ed6c31e3e7888e, 0x841a11d9720b5196,
+       0xcc337d178adff37d, 0x08c668265faa86c5, 0x945c90d49dfcc7ad}},
+     {{0xce92224d31ba1705, 0x022c6ed2f0197f63, 0x21f18d99a4dc1113,
+       0x5cd04de803616bf1, 0x6f9006799ff12e08, 0xf59a331548e61ddf},
+      {0x9474d42cb51bd024, 0x11a0a4139051e49d, 0x79c92705dce70edb,
+       0x113ce27834198426, 0x8978396fea8616d2, 0x9a2a14d0ea894c36}},
+     {{0x9f9ac9608e2941a6, 0x43e7ff902fc4fe1e, 0x5ec413596033e041,
+       0x5ce791c46f6ff0f3, 0x8d134b899d907343, 0x7bd15c7786304df2},
+      {0x2cd2ebc777c4a913, 0xcd86a39d45f07153, 0xe7e12d2e88bc423b,
+       0x478e814b0b3163f4, 0x78bd9c8abe8ec766, 0x6a5763e87709ce48}},
+     {{0x4f1e1254604f6e4a, 0x4513b0880187d585, 0x9022f25719e0f482,
+       0x51fb2a80e2239dbf, 0x49940d9e998ed9d5, 0x0583d2416c932c5d},
+      {0x1188cec8f25b73f7, 0xa28788cb3b3d06cd, 0xdea194eca083db5a,
+       0xd93a4f7e22df4272, 0x8d84e4bf6a009c49, 0x893d8dd93e3e4a9e}},
+     {{0xd699ea2d8d095606, 0x3cd080c51e0ddd3a, 0x46604bad66a8b35b,
+       0x0c779b624233fccb, 0x578458acbfd3cf0c, 0x6820f66596bf57af},
+      {0xa9724245bf1f302c, 0xbbde24da277a6c3e, 0x0980a5b8c6be8c14,
+       0x6230e3ec774d62c4, 0xda1467d84fbde24b, 0xd9d68d07cc862204}}
+    },
+    {
+     {{0x67c516347378f90d, 0xbc201a7966647082, 0x77fcc8dc9ee450cf,
+       0x8dd2b318b41a3e2f, 0xdf6a935e93bf0689, 0x75edabf3a92e5464},
+      {0x49afcd9f604d208a, 0x372f0ea7d465ca48, 0xcdbd8ad2c7ea7810,
+       0xfe61571e550822b2, 0x744a4f9386606adc, 0x6beb3c9cd9d4e110}},
+     {{0x1fef389ce700b9f2, 0x63029466425bc8ab, 0xbd770a1437f04a33,
+       0xc7438e29d0169369, 0x6b265742e2377cc3, 0xdf24bf96c369fa4f},
+      {0xdfdbcf470ad94e08, 0xd101b8617f75a7dc, 0x5574a0b82a9c483c,
+       0x0563fe942de43228, 0x58ca0e8aead1fabe, 0xdc3d9a8466023966}},
+     {{0x383bda07c3fd20e5, 0x9619b1df5c29449b, 0x6f3c717d369f39bf,
+       0x1bb593d11a5a3900, 0xd0f07ecc2aec6c2b, 0x9d72eb2a4240b202},
+      {0x35342f6cc50e4a0c, 0x701b46626b93bf61, 0xfcd6eb09ccb6a888,
+       0xabb7a6f785aa42c5, 0x952f8824aa4e5895, 0x49860db85c406582}},
+     {{0x3667a7203955812b, 0x0d73483b284d1dac, 0xe084535efc62f791,
+       0x5bc1652b389faf7f, 0x40cf51683a71b7f6, 0x8a4b19fad4f39703},
+      {0x823e754a2a8eff13, 0xf01b2021bffa5afc, 0x5639ee027225b319,
+       0x7533bc86fc282f16, 0x710009d2c69f61ae, 0xe30c499dbf65e803}},
+     {{0x0da7ac1b734b4ec3, 0xf47fc1d012a2afbe, 0xbbbc99be87dce4a2,
+       0xf7264b4edd5c6378, 0xe9409305f618ffdc, 0xafadda9bd1846ac1},
+      {0xe734f9d0a21850d4, 0x199cb44f8722a316, 0xcfe8704b38cae89f,
+       0x2db1e56b6b151b57, 0x116ca5cf69ce7b2c, 0xe9b8625f57de97c8}},
+     {{0x18811bd5af247c49, 0xbc180793e124dbda, 0xed978d3a21234fc4,
+       0x516dd9a70616ae15, 0x8f80677774e430b8, 0x9094256906e8fc49},
+      {0x4ca03fb5a4e61235, 0xb91de709b617f361, 0x0898d82d0ed08bc3,
+       0x2bd712368cb08146, 0x45b92d45e213176d, 0x05894791f2bf5b9c}},
+     {{0x0d79cb892695ea2b, 0x2cb0f8dfc88e538a, 0xc1b8dc3da80f36fe,
+       0xd756fa6684f00cc2, 0xa6f1cdec9cb9efb2, 0x5c3f15a8a6a21818},
+      {0x9a7ee3516995d09f, 0x88885463d70434bf, 0x18cecc6d4f7d5d33,
+       0x3f0138866b353bd1, 0x53bf798b0d9ad368, 0xeffd465a28dbc3ee}},
+     {{0xeb29e44cb5d98ac1, 0xe47e57f80e227a4f, 0xd09c04943d2bf688,
+       0x3ab7799a47428dd2, 0xdc558d6be9aafac8, 0xc042c4cd87f9f6e0},
+      {0x93842bcd89fb4693, 0x62dbc82f7068fbf7, 0x164552687e6d47b5,
+       0xab304b7a4c37eeee, 0xdbb3d4e13fc412ce, 0x4f65dad0a726a2c8}},
+     {{0xb25e01b2605cdaee, 0x74abec55bc57969d, 0x9c57bfabcdd9d41a,
+       0xa3330e3f4a9e32a3, 0x5929a0d8e5792fd8, 0x830b4ea271ea2cde},
+      {0x80065ac1fd06d246, 0xa2b416e632e64a25, 0x3950bde7c0c927a9,
+       0x9951f3bd679d9b8c, 0xc235a274651b6855, 0xbfe5e08e5ad97bc1}},
+     {{0x4409a5b6744ae145, 0x5e83fa0b7f620908, 0xfc489bec2e140aa0,
+       0x5805a462e3cae337, 0xe56e9ff7c2211c21, 0xb722f2b40c955362},
+      {0xb098a32f41371f33, 0xe6cceceabb4923d6, 0x1cfbe2b3d82a311c,
+       0xcf9428936b98f917, 0xd60dc62492ef848c, 0x34af446e5adb5228}},
+     {{0x0eb7e743796ce1ca, 0x138653e5d851377c, 0x69c7c86f2b11c8e0,
+       0x878ec1decdf2b205, 0x03e6688aae0e8562, 0x20810666935a36a8},
+      {0xc8ab7c7f26635c50, 0xe75cdb06744a21db, 0x4e26f32fd720e198,
+       0xa1c6395ad8cded81, 0xb75dc6ea6ce4fc04, 0x71750b33004623b5}},
+     {{0xbdef84077e60c447, 0x88570f712a65acca, 0xef3d4a400bb6aa79,
+       0x5c9d189060212976, 0x80179ea21d96c43c, 0x3f002e6d53d2948e},
+      {0x14b2cc9149d78183, 0x7a549c71b496c279, 0xf4beac3f44995f6d,
+       0x5a34239800bc78fe, 0xa874dc1b60e42da0, 0x3a984010cf5824d5}},
+     {{0xe514ee06dfb9760c, 0xb8862d7577b8951f, 0x0144676ef8ee1141,
+       0x49561a3002eb3e82, 0xb3541c154ff9f897, 0x1670edf0a7a99791},
+      {0xd41d603564aea7f9, 0xf66ffd092b3463b4, 0x0784e015c3b26fb6,
+       0x88edce33ec46f8c8, 0x1b1e25a3b6381011, 0xbfaadc03ff95ab97}},
+     {{0x727a59fe0c7be4e1, 0x75a7d5e3f58ced15, 0x146fc0d990f569e7,
+       0x94dbccd2b7f1dc54, 0x0df1ef90b75bf232, 0x2943a082a2568190},
+      {0x75f2f80d67837b06, 0x07e3506f24b44b6e, 0x7c30829ad0d2231b,
+       0x9ce577ca93277abf, 0xa19d1868b17549ec, 0x0ad6ff5525e8c4d7}},
+     {{0x16b38dfe1c24d075, 0x3acd4c36992959f6, 0xdaf2fe88ac2da7ab,
+       0x76e8ff0e89644935, 0xb8547c26e85f7076, 0x9f149faa1cdea7ce},
+      {0x181a60729e125d84, 0xc4aef9fa18751ce6, 0x451c84660e00f00a,
+       0x662b3e7ac4e3e6b8, 0x57b7114ec6b64507, 0x07aeb1980b37fb70}},
+     {{0x79d88e004516234a, 0x98dd3cb931f9ceda, 0xb528000fce7d606e,
+       0xc773557e2fa27fd3, 0x55b53dd3e19436af, 0x675084b3e10b64c7},
+      {0xe583266556d56374, 0xf8f7fd2a307e2e60, 0x7b93bf537af3e3dc,
+       0x94fafa2cf47d298c, 0x94c2ff9a21121369, 0xa41de95f33468ff6}}
+    },
+    {
+     {{0xbe45d81a1b270599, 0x50696e7d97d6c603, 0x63c5a516b078ea89,
+       0x9f3efe41b4464764, 0x84580e24101e5232, 0x00850a1ac8ae8220},
+      {0xbff4077ded55c404, 0xd74de734f2e7bf50, 0x4df4eef207e1c03d,
+       0x4ab3d0396e654d58, 0xb20056cd086f1596, 0xe4d08a278acd7cd5}},
+     {{0x8cd6c9f7c90b13f5, 0xec0c187d52a9d469, 0x9c0db0f589b8ad2b,
+       0x692a8db70d9c999d, 0xa407fd03c9f84ab4, 0xa5742fd1cc9a906c},
+      {0x4813a765c8e72867, 0x9c65943de2e9a10f, 0xca6bf2934fa0a23e,
+       0x1dfa3af7cb1f8d7a, 0x28036f5498d10c53, 0x7bfbcaf20e012c13}},
+     {{0x2d9513a9893e8032, 0x49257f7af4688db4, 0x73d8b12c3af4d9ac,
+       0x903dc9fa48a13c4d, 0x6190753e60709433, 0xa093364e49387d24},
+      {0x0436949e3b261e16, 0x96db3b274a3055b6, 0x514eacc7e85dfe23,
+       0x1538b25c5d8805c9, 0xd4c6b75b664a20f6, 0xd1984f214753292d}},
+     {{0xa53f1a104ec177f6, 0x4a2ef9aa3faa5ca8, 0x30efed8532976d13,
+       0xcf5ada165ee692d1, 0x3ceda69d259e7cc1, 0x2aae29e99baab472},
+      {0x7ee5baef737cc8bc, 0x1717af747fe68ded, 0x9e5c8ddacfdaff63,
+       0x575c8db9cec07693, 0x9afc8ae0fdfb509d, 0x27836d3685651697}},
+     {{0x9d15283985e79c26, 0x8d87faadd36ab6f7, 0x08d4fe09a87afe15,
+       0x1e10b10ffab81fd4, 0x3cbd17d393c98a84, 0xbd40a4e8246ceed3},
+      {0x582d9de09a09d134, 0x120440c24ee37dec, 0x4d4ff9342f1073e4,
+       0x7da76757f45e648d, 0x4427a608ebcbb80b, 0xc6bccb5430e661a7}},
+     {{0xb7b7628f135e2a30, 0x863552c4b526fa7b, 0x6ec18d05e0e30451,
+       0x1b36c93a5769db60, 0xf0fe0007170c236c, 0xeceb540c66130046},
+      {0x86a7a74d3fc4bdbe, 0x066b097bfbae3320, 0x78fb52476e5c21ae,
+       0x3e19e9fce1adf398, 0x429b9cbd1a32a745, 0xedd2c40f36d1a2b8}},
+     {{0x993ca8a9ceeaeed7, 0xb2d2868162545429, 0x2400373791cf32d4,
+       0xda9ef96fd88bd4f0, 0x916a4947e1b2d52a, 0x5ef7f9d0f31b107c},
+      {0x3c424ba862d3d3cb, 0xab155cc27c3c3bba, 0x6a0404b24bae8070,
+       0x5f3d0592df36677c, 0x7c9f2bef9a0e4800, 0x6babbcb497959a09}},
+     {{0xa7342f9517eb9264, 0x9264a6a00a8a6eef, 0x50e48bf07471c384,
+       0x729e5ab130827f34, 0x17199191ea779c23, 0xd13ab8539fa9fd58},
+      {0x7d5799373b1d773e, 0x65f8e7c6d196c3df, 0x253f7d51e8541725,
+       0x107a793dec720355, 0x1c14d0566aa16268, 0x9dc5fca38bbb231b}},
+     {{0x69935431897a05a4, 0x34397b6851eaa290, 0x90ec1a37f58fb7a5,
+       0xf10d078350c4d76b, 0xeb9db48ccc47f990, 0xef0b97a20cea5865},
+      {0x04708d6fd9f94396, 0x82ff577141c21452, 0x772d8493dbb65bdd,
+       0x561abc8bddf73c8c, 0x98a564639830ff05, 0x73e282969f0d4cad}},
+     {{0x7fa7064e589cb234, 0xdfa4e84665ca4f3c, 0x476b6618792d5254,
+       0xc0ce93bc583bdaeb, 0x30b11dace4ab5dc9, 0x237a64e5f5c89e2f},
+      {0x54339fad7dba60b7, 0x0072505a084b09ed, 0x5e89c81fb140717a,
+       0xd56de3a2b407595d, 0x9f3a6c420aab0d25, 0x6c2aa69da685543d}},
+     {{0xda5fcddc6cd00d89, 0x0b8c3febac9ef99d, 0x16569ca8a19298e3,
+       0x5d998d562783ac1d, 0x298c681cc18ecbdf, 0x209323d1e6e13de4},
+      {0xe064255ebd75118d, 0x78f69fd343f945ef, 0x9a4d591f95e6ff8f,
+       0xfa621d463b378848, 0x4c951f31e4d12bb8, 0xefe8d01b00ebfea6}},
+     {{0xf5689c5e12b09f53, 0xc1da32e19e87ff7d, 0x1af879d012eaa533,
+       0xdba775e6d9271e94, 0x60f8507310e63c34, 0x445f3e21a686a24b},
+      {0xed5ca8fa15bc277e, 0x9839198a364ab7ab, 0xe2ee39426d90a7d4,
+       0xe5b3e4cbccd37e76, 0x9013bd08f1412e0f, 0x82f5c532ce999048}},
+     {{0xdd7ff816f4bbf123, 0xbf1a5fd0de3e9923, 0x8c388f8c68d10f94,
+       0x4e9cf0c445057388, 0xcff64aa38d010855, 0x4b6395967d8f55fc},
+      {0xca314522bddc00c5, 0x95482d723da89cfa, 0xb9bf18b89eb9a710,
+       0x0936a88e4651cc5d, 0xec20ac01f59d0f45, 0x011a48688ba74374}},
+     {{0x07252272f9c4caf8, 0x9b016799290ab63f, 0xeaa616bb558d649d,
+       0x00f2ef38a66d8089, 0x284b0146f72863ae, 0x9a207d771968cf45},
+      {0x33d7bac8bdcbb689, 0x393f34d5e5348dae, 0xeb86c8f16f524620,
+       0x62500c62610689f8, 0x66febc056b7fa65e, 0x39c8a70bfb836b3e}},
+     {{0xb91977b55e4d0351, 0xd8ed39aa9e8dddf7, 0x9ae994c29d1b25c3,
+       0x7369e1896ca7b19b, 0x33deb695ec0d7c2c, 0xddcc6250ede6435b},
+      {0x44b7ba23145a654d, 0x653ee81ad280567e, 0x7694c9720a39d324,
+       0xf0af25b1e97e1710, 0x6e1546463ee1a076, 0x062ce9837ccfde8c}},
+     {{0x61d0e01bf3fe3441, 0x674e52332af47609, 0xd4a4e224b362902d,
+       0x45923c129e0a5d16, 0x4fc2bdd495e580e9, 0x6d1d974ca8c3d954},
+      {0xaeff1135d0bbeaaa, 0x013ab5b31baafc9e, 0x80907d3eab8f9f31,
+       0xaf2c12166d566c15, 0x0082daba952e6fa7, 0xa46710032df9e03a}}
+    },
+    {
+     {{0x5f79f0df1fd64063, 0xd2d39dd381e118ec, 0xd631a68e11571c5b,
+       0x6d072b4e2474faf7, 0x5e043a6d862a924a, 0xcae58bd8b0fc8d7a},
+      {0xf54bb7f3b1351f28, 0x4588b6280413275e, 0x81459f4c5909ec04,
+       0xd28cda25abd16460, 0xbb676d018db1c69e, 0xc0056e2dac5036f4}},
+     {{0xdbe04c3044ce3ad8, 0x995fbb1b4ce8aad5, 0xdbf8b54670911457,
+       0x9e683b5b3f7a1757, 0x7b89a08a9c7bd62c, 0x448865a40b3fc97e},
+      {0x0ac9abfc3bb01e94, 0xa07760421e756124, 0x0aa6c335d9deed97,
+       0xe270580f72603e08, 0x70857a946c783bb2, 0xa0047774caa929ae}},
+     {{0x292f8874b25c4d4a, 0x54961fd87e79f526, 0x949a1fae008c6ec9,
+       0x6ae82f0d525524fd, 0xd1f6f4ef2edbcb1a, 0x41617a6d977ddffb},
+      {0x6ae38fb71baf0668, 0xa79ea228d538ab3c, 0x70babb05fc44e273,
+       0x247384fbbca85910, 0xdc0e069b6a564959, 0x37a9c5521a7438ad}},
+     {{0xf071c9878fa06859, 0x0083e5311a52390b, 0x845eb12a61483bc2,
+       0x17471d801caf6dd6, 0x7b603616ddc21b92, 0xd38fe0f6b992536d},
+      {0x433f0652297c25a4, 0x03d4d8fcb1c4bf41, 0xdf617386a9adf49b,
+       0x4bfeb3992cb2944f, 0xbf288427b3d9c076, 0x17818c3e965b4576}},
+     {{0x2bb798ff689f43ef, 0x5813e4415f26ec54, 0x51f64c495005c929,
+       0x60e213a54b42e417, 0xc152844262cc3734, 0x6ecd6c3b09d994e1},
+      {0xa6e72f7183dd047f, 0x3836f663b0019803, 0xbcf1265b257493cb,
+       0x59b15ff09e62d78b, 0xaac5ed5b6cb92ecf, 0x37e6ad7d9662651c}},
+     {{0xce23a19aa17e560c, 0x6491b95f62550e2b, 0xc72000121d15a005,
+       0x15fde735f4355a1f, 0x3849761f607f7807, 0xcbe322d018204691},
+      {0x75756e4ea95e8e91, 0x365959fe817a9b8e, 0x631232763d4ce3dc,
+       0xa769d2fef1d66e00, 0x8624ddbac28829e6, 0x03274297d2df06ef}},
+     {{0x52fced3116f01d7b, 0x88c6b172daf046aa, 0x1a189403fe7a338e,
+       0x39741ecd61798b1e, 0x6a47b0712934b879, 0x3b1a5dd1828d1e9d},
+      {0xd4bd48487f35a7ef, 0x71774b5bc1eebaf8, 0xa86471e5d55344ba,
+       0xfbf145f17b8a483a, 0x70f9b214aa53802c, 0x995af93010b066e1}},
+     {{0x9ec1159727a28f9d, 0x96f2c44bb847cd83, 0xacf794e131fca111,
+       0x438b917896076f45, 0xad71035b51732588, 0x2db32f32a5d910da},
+      {0xefaad0e8fe1cc184, 0x6f0360b52e00bbed, 0x99402426474ce326,
+       0xd53b687a2aa270da, 0x96c8bb78d78fa6eb, 0xd07f3bba6e699411}},
+     {{0x07276886361dae4c, 0xb26f257984c57896, 0xe8b59ef55f0c2bf4,
+       0xf544c145dd64aaac, 0xa9dc03bb9fdcb039, 0xeb1e9aeb58c44b72},
+      {0x39a4fe8e1d6bf26e, 0x2c4285cceaf8e241, 0x647ce58414770f31,
+       0xe5bfeb70062f0912, 0x7031db80e8314467, 0xac970937d658d2cd}},
+     {{0x2dfc39e6efe1757b, 0xab52fbf3b5d2cb93, 0x1cf12123313aa477,
+       0x785b025b9c6acbd1, 0xb4aeb5b8e4d54177, 0xde3d28f8d943c1ea},
+      {0x7892db855b0b1921, 0xc09ff90358caff2d, 0xbdee13c61cbd3231,
+       0x873e0a7700b6c34e, 0xb279505ae23de32b, 0xf056ffdcc5a03302}},
+     {{0x0ac769596ba563ee, 0x2053a5fbb9a51868, 0x60e2555f06178e3c,
+       0x1bc99e72c0933775, 0x4a2d31b2b7d5160e, 0x7cc03ff3895d1db8},
+      {0x98fb331eee53e79f, 0xc2f0a93f8583b893, 0x8fa79ed849802eb4,
+       0xe954817555ce8dcd, 0xb5155a211d4d44f1, 0xbb044d2889570a82}},
+     {{0x430b669fe1f833e0, 0x1797ac3a6d8127bd, 0x01ad730c4c33493e,
+       0x8c882c1fca00ed39, 0xab2e9c89d24a5516, 0x21a49e0af5d0327d},
+      {0x46488bd858a280d1, 0xfc4a1e8a772ed759, 0xf9f60e90aecfac7c,
+       0x4afd1f5fac6a9e8c, 0x57a20bf8c98bcda8, 0xa1107ea08b46b998}},
+     {{0xe931c21b45fc08c4, 0x13fad41f3aca653f, 0xf28a3515ec1fe395,
+       0x191a4f2dcf55cc91, 0x46fb07b790535f59, 0x76c60cc1d69686a9},
+      {0x1e7dec15c8122c04, 0x0743fcf01b72798c, 0xb10c96bd1e5939fd,
+       0x261e6c0a6e8338e5, 0x56148d3ce5cdaa43, 0x3f004371a031239a}},
+     {{0x1f2f6c1f0db0c9c0, 0xca4e1964ac770b5f, 0x20dce4a6569c090b,
+       0xe4f7401adb3986d0, 0x1389799485f553ea, 0x119ad50d09026bff},
+      {0x88067aa7e265a0a9, 0x209c62b47f749167, 0x84165019459bf269,
+       0xec125bd58b6e76f6, 0xd636f9321f0d2434, 0xf6023a4c8e05e0b0}},
+     {{0x84c14e3165ea2b23, 0xb68121be19e93301, 0x9c1a873fb25d9a83,
+       0xafb9d04cd13773f0, 0xd05014da51c32d57, 0xff2e350b0904efdc},
+      {0x20bd7d22a0a01069, 0x3e74eb0f6c3b3fd8, 0x643ea531b743b72c,
+       0xa2fe74148e3ae785, 0xb8fe89bf92e8d320, 0x58985dc1495f6d28}},
+     {{0xfe1f11ad389283ba, 0xc87e20b60cd91b22, 0x99d0015a3c5babf8,
+       0x7e795b4d5929ea0a, 0xc9cf68331dfb7b7e, 0xc1c07346a64992e8},
+      {0x0b7e0dd89889746d, 0xa89d7b461c43ea4a, 0x64023cf034f02b96,
+       0xf7dd410a5662f0c8, 0xa3bb6088a1058cca, 0xedb25dc34e7801ed}}
+    },
+    {
+     {{0x140a0f9fdd93d50a, 0x4799ffde83b7abac, 0x78ff7c2304a1f742,
+       0xc0568f51195ba34e, 0xe97183603b7f78b4, 0x9cfd1ff1f9efaa53},
+      {0xe924d2c5bb06022e, 0x9987fa86faa2af6d, 0x4b12e73f6ee37e0f,
+       0x1836fdfa5e5a1dde, 0x7f1b92259dcd6416, 0xcb2c1b4d677544d8}},
+     {{0x279fd119da1c29ab, 0xbd0688022b30d40c, 0xd8f57da4da44105d,
+       0xb1814b7a28223fe1, 0xcf2fd241e06f2d2e, 0x99003a0201dfde06},
+      {0x876a31affded7e4b, 0x1efaf8272f725094, 0x5117d608493a6a0a,
+       0xdcec8088a88c03e7, 0xeae1d352ea916897, 0x8cdc28106e8b2c57}},
+     {{0x0254486d9c213d95, 0x68a9db56cb2f6e94, 0xfb5858ba000f5491,
+       0x1315bdd934009fb6, 0xb18a8e0ac42bde30, 0xfdcf93d1f1070358},
+      {0xbeb1db753022937e, 0x9b9eca7acac20db4, 0x152214d4e4122b20,
+       0xd3e673f2aabccc7b, 0x94c50f64aed07571, 0xd767059ae66b4f17}},
+     {{0x09f8bb0654e93c1e, 0xb0045884ad81e27c, 0x26ebc7b6076e13eb,
+       0xbda0b5535d5ac07f, 0xbcb8132248ab69e6, 0xd3847d2e1c0f21fa},
+      {0x7a466528c834d740, 0x6c67a79ae0823ff2, 0x85dd11864c1d7cb8,
+       0x096f849f2d081301, 0xb4f503dd8a5ea0f0, 0x71ee0889d1bf69b2}},
+     {{0x40336b12dcd6d14b, 0xf6bcff5de3b4919c, 0xc337048d9c841f0c,
+       0x4ce6d0251d617f50, 0x00fef2198117d379, 0x18b7c4e9f95be243},
+      {0x98de119e38df08ff, 0xdfd803bd8d772d20, 0x94125b720f9678bd,
+       0xfc5b57cd334ace30, 0x09486527b7e86e04, 0xfe9f8bcc6e552039}},
+     {{0x4ab7a22c02a2d1e6, 0x967e19a31371d5a4, 0x20f59f95078de336,
+       0xfd28fa36f7869245, 0x1de42581cbf1d96f, 0x2e0127d7366e1f0f},
+      {0xbc65fa9d2258c741, 0x1f2f3356dd6d65f8, 0x06384f3a4a0822a9,
+       0x1c81332bfd05a0aa, 0xbfb12361d95ee3ce, 0x180aaf0642016d00}},
+     {{0x3b75c45bd6f5a10e, 0xfd4680f4c1c35f38, 0x5450227df8e0a113,
+       0x5e69f1ae73ddba24, 0x2007b80e57f24645, 0xc63695dc3d159741},
+      {0xcbe54d294530f623, 0x986ad5732869586b, 0xe19f70594cc39f73,
+       0x80f00ab32b1b8da9, 0xb765aaf973f68d26, 0xbc79a394e993f829}},
+     {{0x0a159f6295b3287d, 0xb18f875948cecad0, 0x6d1ab8ee1661a23f,
+       0xcae7f40ec95c41b3, 0xbc3d20407c51eb56, 0xa7527283e8754250},
+      {0x815610561f9e668a, 0xb8aa7296900f5912, 0xabdbc1bf6af2a00c,
+       0xe9a942542d0a56c0, 0x4774a7b77bc8959e, 0x0a837ff019cef2f3}},
+     {{0x9c441043f310d2a0, 0x2865ee58dc5eb106, 0x71a959229cb8065c,
+       0x8eb3a733a052af0f, 0x56009f42b09d716e, 0xa7f923c5abcbe6ad},
+      {0x263b7669fa375c01, 0x641c47e521ef27a2, 0xa89b474eb08ffd25,
+       0x5be8ec3ff0a239f3, 0x0e79957a242a6c5a, 0x1dfb26d00c6c75f5}},
+     {{0x36f3a3d8a084fae6, 0x759835899a9b0d95, 0x70722186cc80fcb6,
+       0xf28ed0c796d84c04, 0x95a32263ffb63f90, 0xdd7d60a098766034},
+      {0xe193a31f1d5c387c, 0x6c5eca7eb8310f8b, 0xfe61d523c083ff47,
+       0x90c832dbcb2944e9, 0xa9f3f293593334b7, 0xe6cde2e12d7d1c33}},
+     {{0x2fd97b9b9dfbf22a, 0xdec16cc85643532d, 0xdf0e6e3960fee7c3,
+       0xd09ad7b6545860c8, 0xcc16e98473fc3b7c, 0x6ce734c10d4e1555},
+      {0xc6efe68b4b5f6032, 0x3a64f34c14f54073, 0x25da689cac44dc95,
+       0x990c477e5358ad8a, 0x00e958a5f36da7de, 0x902b7360c9b6f161}},
+     {{0xbd079cf1f144b6cc, 0x7f86e29bb4f4a764, 0x5b08b290f21f9cbf,
+       0xada0c85b75e3aeb9, 0xd0789f8b6666c2df, 0xcf5d8a8cd71ec2ec},
+      {0x6f7780c3e7e4364b, 0xdd9a652985d2eb75, 0x8222f66bd952a38e,
+       0x9dd5f7eb27260a29, 0xce49b34457947178, 0xaa215f82cdda7e39}},
+     {{0x454ab42c9347b90a, 0xcaebe64aa698b02b, 0x119cdc69fb86fa40,
+       0x2e5cb7adc3109281, 0x67bb1ec5cd0c3d00, 0x5d430bc783f25bbf},
+      {0x69fd84a85cde0abb, 0x69da263e9816b688, 0xe52d93df0e53cbb8,
+       0x42cf6f25add2d5a7, 0x227ba59dc87ca88f, 0x7a1ca876da738554}},
+     {{0xaa44b2863004db31, 0x86f43d7ad43e4430, 0xdc4874cdb0b0240d,
+       0x79986a23adc45a06, 0xbb275b443cee4631, 0x21daee8a63a217aa},
+      {0x1e7c5397d7b25c02, 0xe677d3cbc5e668fa, 0xc7c84e28ed51b4bf,
+       0x7ca19e99923e5408, 0xc6f8a595c3f832e7, 0x2d0a789c5fb049a3}},
+     {{0x3fa5c1051cac82c4, 0x23c760878a78c9be, 0xe98cdad61c5cfa42,
+       0x09c302520a6c0421, 0x149bac7c42fc61b9, 0x3a1c22ac3004a3e2},
+      {0xde6b0d6e202c7fed, 0xb2457377e7e63052, 0x31725fd43706b3ef,
+       0xe16a347d2b1afdbf, 0xbe4850c48c29cf66, 0x8f51cc4d2939f23c}},
+     {{0x114a25c844922386, 0xdd084d446d4e8b57, 0xc49b68411e7bd7de,
+       0x5b0359fad6da54db, 0xa6e6e5f93f0da321, 0xb65ec55cd640a87e},
+      {0xc1a4f6ceae64020e, 0x91e29cd2088e1337, 0xf44ceb8e3c0a631c,
+       0x0205b11db756445f, 0x04844e845bc8880e, 0xb630ddc0b85e00d3}}
+    },
+    {
+     {{0xe76894c3ae7ce296, 0x87737ee2a6cafc34, 0x566dfcfbe55cd1e6,
+       0x5421a9f23a7ad5b9, 0xa005838a4687a4ef, 0x3837219a23a2c423},
+      {0x4b7800128a82cd1b, 0x401c07bec728b588, 0x2b5f69e937ced8f3,
+       0x306b621d8c1e1eaa, 0x8acbbe71d389cc4d, 0x922fa665f4ab7774}},
+     {{0x2df6f242d35c2d80, 0xf65a99a93493ce97, 0x9e80232b372bcc87,
+       0x26ba13b86e428cc5, 0x2526ef1f13a1b763, 0xcef3edcddc97c5f3},
+      {0x4954867fbde16b73, 0x9817813d368ff6cb, 0x7e39fa69be143027,
+       0x12329463cf54f28b, 0xcf0991dc7597c2da, 0x0cda396952e07099}},
+     {{0xdc9daeefee993749, 0xd40c8a547ff3d775, 0x206d2271ca53d53d,
+       0xb05463354d1aa50b, 0x52bca91088001e99, 0x25c117c217fb7aa4},
+      {0xfff3af9542685945, 0x083fd4de8f4ce0fb, 0xaac004be24753989,
+       0x4a5de2b6e90950c6, 0xb46af0ab738efe5b, 0xcf80a17fdb4459f9}},
+     {{0x412f64a3f303955d, 0xe92bdca9bd692593, 0xfbe6cdc2c2e964e0,
+       0xe9a3b1fd0011cb01, 0x6c30762dcf228f23, 0x1270b84abe9199a1},
+      {0x732711dfe3c9cbb1, 0xa3aabe37d91d9513, 0x8ee08ba0c6eceba7,
+       0xb1711531f3c3d31d, 0x65060b633c716948, 0x046b4ea12ff2cadd}},
+     {{0xdeb7a462961719fe, 0x5e22796d76ba6ed7, 0x5907daf225d22208,
+       0xd98260a72c21c04c, 0x56b24923e090f349, 0xb5960ad9a31a8f95},
+      {0xb6ac57cef8b1da62, 0xe47d09959f14f70f, 0x0ba6eb0104dba20b,
+       0x41ca71c846b60e27, 0x2bbfdb306bf5eeef, 0x58e16788f075b238}},
+     {{0x25d1124fbab220c6, 0xcd1423c861524e3e, 0x75e4f45f0434fb51,
+       0xb5180a8f5180ab2b, 0x144e214e5b22e388, 0x6b16dad192263054},
+      {0x3ea7590740863566, 0x372d5abddada3b46, 0xb3ff5a3a893d210f,
+       0x39f8d1ce5e29f3dc, 0x559186ce68200e82, 0xf48764541202cb66}},
+     {{0x699c2db9eaf4f2a1, 0x8cd3322761c0c17c, 0x971b50d464f16a56,
+       0xcd00d42b102bbe10, 0x928d0ae2b05f3cac, 0x245dbe3814bcf472},
+      {0x43d29526947c0184, 0x240899684612a4ea, 0xbc763fcd6c2b4541,
+       0xb4e7ae0ff82448fa, 0x94f1fa15b02b6459, 0xbcafa1ec67d39bbd}},
+     {{0x6f178dbf8b540904, 0x0264bccd8720472a, 0xa6e8b4b459b46611,
+       0xafce8267c72b4a58, 0x21142175a45985ad, 0xd23401dfe649d733},
+      {0x6bf42fe085dc7720, 0xc5c8ab9440e3f2f5, 0xb0c8a58acd029197,
+       0xa73ff329215492e1, 0x895c545eb1b5a5f0, 0x6dbc24456fcaf49b}},
+     {{0x705ad3d844cc852a, 0x10bb5addb80518e0, 0xa34905bb0de9f160,
+       0x7d45aae394b1aacd, 0xd30411d07fd5de7a, 0xe2fc62064d0167cd},
+      {0xd3b1961210ce71cf, 0x8e8096b6b28225fd, 0x4b46fa8064a1c849,
+       0x160479aca51364e9, 0x9ebb6fdbfaa3f0f2, 0x9ce029b9f1511754}},
+     {{0x25ef32d60f2d76a3, 0x540650b9af4a7d46, 0x8979a4b8d991d7f4,
+       0xdaa706c299202400, 0x8a729680f19d281d, 0xde25bdc44ec44de2},
+      {0x0fc50832c2054496, 0xfee72fb60aaf2941, 0xc8263e64b82ed4f0,
+       0x91a8cb736f49055c, 0xb7585458f2bb515c, 0x03d2b23ab855e6c6}},
+     {{0x8e11e8e8a0879d68, 0x2bea77a3bf7a84ac, 0x98140930a74b45d0,
+       0x1ce28654810e587c, 0x0a30756b8869daac, 0xbf5e824539d2fe12},
+      {0xe6414992cac16a87, 0xd2fa182d437aff7b, 0x4e61412db6146094,
+       0x30a949ec2f31bb4b, 0xf254c71f22dc8ac6, 0x1d9ed85c1ab2a0bd}},
+     {{0x09ec1e3dcfd3f182, 0x1f1c30b5adae7af9, 0xf3a33f7c6b454164,
+       0x0318926f94647c4f, 0x8e37bdd787db14ec, 0x811cbd342ab364d3},
+      {0x1dd1e5077c2b369d, 0x7a57bc46a28056bd, 0xfca5be4b089efe44,
+       0xb3bd84d76dc1290e, 0x40d7af098793e6ae, 0x4e08e11fa3723942}},
+     {{0x649eeabbeb73ec7d, 0x1098330426a9aaf9, 0xf22e45144e296235,
+       0x695c8df47b85f801, 0xd45533443ae7caaa, 0x3e35bd47ffbba90e},
+      {0xdd04f7c95d13b9ec, 0xe39a5d12e259f70d, 0x39073063201ae17c,
+       0xdba3eda06a85435f, 0x6df48093e948924a, 0x9ffc4dcf00e3394f}},
+     {{0xca3709ad899ffebb, 0x1a87377877c00602, 0x5ff40c2aa99b4af0,
+       0x680464e5a80e870c, 0xd2f7f04494e10b1d, 0xee9b206c4e9aa1a7},
+      {0xb536d67596cbe950, 0x841856899e8305f3, 0xae1b669c369fa255,
+       0x62e260267233e1ea, 0xac05c5136aa60c24, 0xdfc6814fd2691677}},
+     {{0xbe414528397147d6, 0x7485131442592203, 0x9084d3300364b0eb,
+       0xf8e5d6d56ad70814, 0xfcd4e0e3ffb4ac5f, 0xf652417a1fbf8899},
+      {0xb1165da7ccbd7eaa, 0xf5dbd11a6e2d4e8c, 0x5dab120a32ddcea8,
+       0x30aaa56f9892f728, 0x71c2412dd3d73838, 0xbc0253d1d2e2becb}},
+     {{0x8baef5df0a02b0fb, 0x58a2b06bc2b92b02, 0x268558d754c8267a,
+       0xf924f795ccf70393, 0xe3763f30f68ee021, 0xc1e856f05c01ba4b},
+      {0xcc01a3e9722b6bff, 0xd2be4623ed5b3b02, 0x1ab3512e6c45e33f,
+       0xa978fe484ef433f6, 0x23e2ea018e21f5af, 0x49647d8811524a40}}
+    },
+    {
+     {{0xe1d42d94d087b788, 0xfbfb221aba0e176a, 0x5f6698e783686966,
+       0xbb5e159474a30dbf, 0xef86bb5bcfd20230, 0xf055a1c5403b8f8b},
+      {0xf249aac8d9d85ea7, 0x7318f7bc3d200198, 0x3b80960cefca9a90,
+       0xf28e33888f449c4b, 0x0cdfc61bf0cfe09e, 0x3b169c638b22cd26}},
+     {{0x923e948c203bb368, 0x58e37a2b231a80e0, 0x345a011a6df27deb,
+       0xba6784c1d57f4ca2, 0xf01b3703114196e9, 0x981a63eb1aab426d},
+      {0x2ffdc97851770c1c, 0xddd19da6efa722fc, 0x5ca1c01216f09c1e,
+       0x612021de5b9cc0b6, 0x910e10e95e150569, 0xacace9dce2ab93ea}},
+     {{0x0cdd83725070e0a9, 0x7c5ad562ec550783, 0x9652b8474f3b8d2b,
+       0xfdd60d93e6e98d73, 0xd51cae2ca3479d0b, 0x11b93b6dee05c006},
+      {0x9d72b82d8a3b40d5, 0xc6e996fea7d24855, 0x420672f7398603de,
+       0xd551b34a9a1af2ce, 0xdeb8c1d913bdce0c, 0x56ca926debbeba7a}},
+     {{0xac58c9e09db9ca19, 0xd308ea5d390054d0, 0x32ef4afc2cc42529,
+       0x08bd48b397c2bdf9, 0xac8a7803a849e19a, 0xcd51c0da75c31496},
+      {0x733dc7def0e2d49f, 0x7c9caad1b44b8cc5, 0x6d9c5b0847be21a8,
+       0xfab0fdc55ebf426f, 0xd60748caf94e9e5b, 0x3072e59269366089}},
+     {{0x8f24cfd9007d3d4d, 0x2f4f7195cb27ae66, 0x8166162e9c1ed35e,
+       0xfdcf76664f4bdfd8, 0x6dc993bc3b5373ca, 0x2faa34d6a3ec42d5},
+      {0x1cce84cbc6b6109e, 0x7a4178ad43632b7e, 0x6899adb5b2aab55b,
+       0x080e42bd683c1397, 0x34d5e19210960bfe, 0x65415d217223406a}},
+     {{0x8acd0a3e6254954d, 0x708f93591d8c2442, 0x85f591356dab2ff9,
+       0x9df9200733a9d96a, 0xac9849a7caa797ad, 0xcea2067ffe95aa38},
+      {0x5a3c21b4995cb879, 0x5c981a5d69d4f07d, 0x028cf95df0dc9aa6,
+       0xcc5cee93c68fd96a, 0x8a5e73ee0b69676f, 0x190a7229832d230b}},
+     {{0xc0ab244bd40c5d9f, 0xc05a11cff3ef03ed, 0x1593d8ad650ea714,
+       0x1edb6cbdfc6a1235, 0xead76e1e4e451d0b, 0x4759e3c0ae7ee558},
+      {0x480627be7c8145e2, 0x82cec2c788a339a2, 0x17e887b6752b0f58,
+       0x91c866d0aa6c9df1, 0xd9a5484829b3b1d3, 0x17ae47aef641bbc1}},
+     {{0xb06c17a3f0ef77c5, 0xc144e7846df6bf59, 0x2440ae990038aeb2,
+       0x83bf711b58b402ca, 0xb8763e00b577732a, 0x509e91eff651a932},
+      {0xbe02ab9d00ac109e, 0xfbcb426c8dfd78f1, 0x7ed272f64283f80f,
+       0x098cf0572365da5e, 0xd90e6f1805dc6beb, 0x09ef177fcf7b9d72}},
+     {{0xebee13d1199785d5, 0x3d37064892f8f141, 0x56595c8315e3a026,
+       0xa0f4960ee6e5c659, 0x27d5bc54c052f5d6, 0x9c5437dc8677ef24},
+      {0x28ae53a3db9b78fc, 0x025b81a7d91113f9, 0xfb423fb36ac445f9,
+       0xb555a8b5575649cf, 0x3ac93b0806ae0cb6, 0x7a706bb58d2e3be1}},
+     {{0xcabd730197c0cb32, 0x1698cfd365f83e1d, 0x4483325462043a8b,
+       0x43d1641f3b4c8bac, 0xcc394a5be344a05a, 0x9e085b71853c1f6d},
+      {0x35a67867cf627733, 0x9d668c2beab971dc, 0x458a801d46c5f3bd,
+       0xb7b08696446c5e3b, 0x468ae44ac15fc828, 0x9503fd49ab2761ff}},
+     {{0x7278f12fce8d4427, 0x036aef18eb15f81f, 0xcbe64b86a58e95ea,
+       0xf933a85059b2428c, 0x8d117bfc52f1b0fb, 0xba9dbc6f0bed33e2},
+      {0x3e152fb56ece7dc5, 0x90e88871eb80d7ff, 0x0aa265aaddf09489,
+       0xa17584cc2476414f, 0x2d241d33cb0418ea, 0x1c40e835c3a7529b}},
+     {{0x89b2edbae3e1aee9, 0x33533137e55e4aca, 0x1dded9ce8943fce4,
+       0xaaf07ff45a2ff996, 0x69e60f92c96e87fe, 0xc2e5c1d5b9ee808c},
+      {0x79d6d8c6be466616, 0x897f6c2fdffe4e28, 0xc8a65267350b7fc9,
+       0xe9fcb46d8a2abab0, 0x57c3bfc62c4faf7c, 0x41a8cc2aa8207c8a}},
+     {{0xb60e8daaa74858fb, 0xaa4c8ca550c7c2f8, 0x9eb3709631a39837,
+       0x5742fb3269f44aa5, 0x086aa47951e793a0, 0x9bcaf65755e7c373},
+      {0x63cee90c1b13101d, 0xbc410452e7d42d91, 0x3041007f913aa0fb,
+       0x9a00ad14502be876, 0xa137a443b8677568, 0x5b26b99546ca4efa}},
+     {{0xe33585b7aed60a78, 0xd208deea3cbb2e24, 0xff32cccb1aca34e8,
+       0x52ebce077b64d250, 0x93a4d0a184d8b907, 0xd759bef077de8d42},
+      {0xbd60c87a5d07487d, 0x63620986c74f79df, 0x54f5f2c84a52f837,
+       0x340a1f53f3cec619, 0x1e922bc4fc85bf85, 0xc92e7b85c3bfdf09}},
+     {{0xeb1a37c30eb9e6bc, 0x8c393d894fbf1cb1, 0x6ac9427ed1f10389,
+       0x77b8cfc17c8caefc, 0x554ab4af1a61bdd5, 0x661a99f1ad75e46b},
+      {0x11fc01bb439a0456, 0x5b7fedd28d0046c9, 0xcfded2effbece9e3,
+       0x4e4dcb0b11440124, 0x2a5fd0fadee23c7d, 0xaa5f345af662402c}},
+     {{0x6f101762eeb791c4, 0x0d942184df261eff, 0x2c58e2aaac1dc827,
+       0x51410e89f835a1b6, 0x981333a7629915a4, 0x371891b60c14148d},
+      {0x4d20b3d3c0904446, 0xdda7ecc8949776d8, 0xa664b68c2a2645f7,
+       0x7a6bc857add082ea, 0xe7467dc63e5ff206, 0x40a6c34004e2dfcc}}
+    },
+    {
+     {{0xa235456903744726, 0xd2169e6dd8d275ac, 0xab0c247b132c5689,
+       0x129a5c9dcc4760bb, 0x03eba46726ae821b, 0x67a33fda3df1cf83},
+      {0x010813cfb8421b7a, 0x7b0f507098cd6d76, 0x907320b31fe4b600,
+       0xda3bfeb398dd3239, 0x23f1ed1641abb34c, 0x01b30f29946f85f1}},
+     {{0x285248309666f8ea, 0xd579b3dfeff6502b, 0x3a66fa9900e4f78a,
+       0xfd8a65bb54a3f7a3, 0x505d3f631965a79a, 0x9524972c1891469a},
+      {0x78367cbc3354da3a, 0xbfe1fe3de4941c6e, 0xe41bb3f6f5af173e,
+       0x57cb03ca5ca36597, 0x27f86cb87b99f795, 0x5cae6514ad4dcef1}},
+     {{0x4952a350d87a86c9, 0x08ed7da7034f45f9, 0x1e9ff8272bd716d0,
+       0x2471fd15f1d9331f, 0x0c708362d7370b75, 0xaddedde6fc1a1051},
+      {0xf4475288db27b186, 0x5be4d46b3760bc11, 0xe44435d906d47ee1,
+       0x865cf7c8d0b7c8a2, 0xdb412be08d31a252, 0x4b90a9322f24d71c}},
+     {{0x38a49bf555f0ad9f, 0x1a84c6b8f3618639, 0x5f709eca01b2f7c2,
+       0xc479a6505be8359f, 0x6b6a22bfd6646b3f, 0xcce78878cc5b711b},
+      {0x8e7dbc63b446cc63, 0x231bd027218f800f, 0x2d3a7e04030271eb,
+       0xb08b5978e22fb3c7, 0x860d62789be0d46c, 0x253a31c21d49a915}},
+     {{0xbad6b669376bdc3f, 0xc4a8e7bc23a9ff38, 0x3f54d8c4555fb0a3,
+       0xfb3d5e1d2b23db1b, 0x6379f78af0d7eba9, 0x36004febfa0beffa},
+      {0xdf0a373c334ff01a, 0x10314749dff12a1c, 0x1d52ddc7f184c1b3,
+       0x79431663ab02d404, 0x1a6488c17f4d3795, 0x3363660f7cca9102}},
+     {{0x56d6515604dc109c, 0xcd740cc809c1d307, 0xef9e049f10dfaead,
+       0x19750b3ae30b70b8, 0x11ed860015c6a562, 0x53bdf97e12097026},
+      {0x79559d056c0d908f, 0x8f1d75bab506d527, 0xd6fd7323ae8fb3c4,
+       0x834639c9a4111f88, 0xfc69a029a310a683, 0xa4467bbb255f2e9a}},
+     {{0x5f0a58a8a3526fec, 0x849c171b02f028c1, 0x34d77ce856a5d3b5,
+       0x9701621754d5a92b, 0x0cce35c12cc5b70b, 0xd9d5a00ae83f1f4a},
+      {0x064223f826a0368b, 0x328a9f6940e16452, 0x3a6ac093d305ad2c,
+       0x759d9a16beba7c44, 0x86021de7637ce7c8, 0x276bed61cc80c1cc}},
+     {{0x66797f56bbe4bdda, 0xb92a369eda51b1a2, 0x18eef4a531adb034,
+       0xcf1cb5ee5d185cfc, 0xf596a59bbd53c27b, 0x1e1dd6f569002569},
+      {0xd9433e797687e48a, 0x7d8d24c20cbcb9ce, 0x233cd7ed65d68ecd,
+       0x201bbe09fb2aded8, 0x987f4975ac9b750e, 0x949da385337f7f25}},
+     {{0x00c2ee1c9c7de99f, 0x28a7461d15e50391, 0x1bdc0e32a1c77952,
+       0xe98242c4d53d640d, 0x1a4724d2cf153c7d, 0x194e5dccba477d46},
+      {0x871c8cfe3a0d4ccd, 0x62010af09af451fb, 0x9b354f9e6ddec75c,
+       0xe5db0a5d680e3511, 0x183d1270d247745b, 0x9910867aeecf52dc}},
+     {{0x6fb6b7bc0410ca0b, 0x0e16eed2b3c13935, 0x98ad89d8316ff531,
+       0x4800ee179894d65f, 0x034ea3c448280170, 0x8126d12dc30be537},
+      {0x43c2d27e5120e525, 0x96a5d498ee65df90, 0x654540105eaef29a,
+       0x1d8f07a17b678fc7, 0x54bc6f737b301270, 0xe58a8102e9473365}},
+     {{0x460c29904ac6cf02, 0x01482cfa420a35b7, 0xf793933a34680972,
+       0x2cd1f50017e2367b, 0x2411c3523944f060, 0x3d58b97411c06b05},
+      {0x4552e369cddebb3b, 0xe1c38aec009aeab9, 0x9d34737c353b6e4f,
+       0xf2c99e2cb16d7b0c, 0x57029fa47bbba6a2, 0x0565d1bcd13ef64d}},
+     {{0x3561b3fea329deb1, 0xfdca0e34f1c3c3e4, 0x4374831347fb79d6,
+       0xa7f497e1c48002ed, 0x86221cce2c44dcb0, 0x65e3f04643785e06},
+      {0x9ee9061fdf4cf461, 0xc7479e8cf022d27a, 0x1d8de85b76f7f52b,
+       0x39a713c90fd6c65f, 0xf74ca067711f8a39, 0xad1119ad8ebc640a}},
+     {{0x59753bf68ba85dff, 0xec8b82efd1c89bce, 0xd7f1a651b8b6a683,
+       0x9c329bf36f84416d, 0xaecbf4b9e68db225, 0x94ec3b0f5a614d23},
+      {0xbcb6672593a9543d, 0x90c46c46f19132ed, 0x4767c73c950b080f,
+       0x0b9b143e971fd9e5, 0xbce6886f8ec8c68d, 0x167b0f8ad47f512e}},
+     {{0x1942c2ffcd74009d, 0x71c4d5f5e9c286a4, 0xf3c152b5771a5972,
+       0x4cfb1e74363c2048, 0xcd2ce8249ddb8da2, 0x5d97c8e0a5ee443d},
+      {0x6fa84b3d68d7b3d5, 0x97eaa76d9ce14ec3, 0x2e4571368e13869d,
+       0x39ac6a0c96f0f8a1, 0xe24458ac42d93dc0, 0x7eb3689d5f60bec9}},
+     {{0x29544fe8588360ec, 0xa1aa9b9fffb550ea, 0xe1f6cf994af4d28d,
+       0x723d48b00c6fd477, 0xf51f1b2f5c81b252, 0x88ec11c04f5a33ee},
+      {0x7747f0432cd72de4, 0xcca69b0ad71c92c1, 0x9455d86e4e8cc763,
+       0xc9e0aa1bc08444e0, 0x93803b68e8fffa63, 0xc296af292d781b7d}},
+     {{0x514cc1dcb08d2d0e, 0x4e6b379e30e93536, 0xf0e422ac2fc9230f,
+       0xaa50a1ad92e23e21, 0x70ac46d8676d1ac0, 0x698b9991f9f54493},
+      {0x59a6b86a8649519f, 0xc1f11ad6e3511da4, 0xd3d9cff13192968c,
+       0x13e700b40b342dd8, 0xfd5dc7bb3b1da441, 0x02426e7c2c883760}}
+    },
+    {
+     {{0x9e9af3151c4c9d90, 0x8665c5a9d12e0a89, 0x204abd9258286493,
+       0x79959889b2e09205, 0x0c727a3dfe56b101, 0xf366244c8b657f26},
+      {0xde35d954cca65be2, 0x52ee1230b0fd41ce, 0xfa03261f36019fee,
+       0xafda42d966511d8f, 0xf63211dd821148b9, 0x7b56af7e6f13a3e1}},
+     {{0x3997900ecc8998d6, 0x8fa564b7baa60da1, 0x71bf5b0a661f3c57,
+       0x44b13388aab1292b, 0xcbe80cb9d4d993f2, 0x0b19b4c92203f966},
+      {0xbc82a6520080f259, 0x870ebc08ad96dea3, 0xa388c7e7502f0003,
+       0x9c704ef056a38f73, 0x93cde8a73487d9b0, 0x5e9148b0ec11a1f3}},
+     {{0x47fe47995913e184, 0x5bbe584c82145900, 0xb76cfa8b9a867173,
+       0x9bc87bf0514bf471, 0x37392dce71dcf1fc, 0xec3efae03ad1efa8},
+      {0xbbea5a3414876451, 0x96e5f5436217090f, 0x5b3d4ecd9b1665a9,
+       0xe7b0df26e329df22, 0x18fb438e0baa808d, 0x90757ebfdd516faf}},
+     {{0x63f27a25a748b8f5, 0x68c8f3ec2cd246c4, 0x5d317cd965f9ce38,
+       0x162c92e0635ba300, 0x5259f64ffe343662, 0x4a6b2b668e614ac8},
+      {0x97fb55bb01177c3b, 0xfb586c21a705cb01, 0xa57e732578061824,
+       0x892f6b386c1e6306, 0xf12e4c072367b14c, 0x580d5fe2c83a48c5}},
+     {{0x1e6f9a95d5a98d68, 0x759ea7df849da828, 0x365d56256e8b4198,
+       0xe1b9c53b7a4a53f9, 0x55dc1d50e32b9b16, 0xa4657ebbbb6d5701},
+      {0x4c270249eacc76e2, 0xbe49ec75162b1cc7, 0x19a95b610689902b,
+       0xdd5706bfa4cfc5a8, 0xd33bdb7314e5b424, 0x21311bd1e69eba87}},
+     {{0x6897401cea2bafb3, 0x7b96ecc215c56fe4, 0xe511b32939e2b43b,
+       0x39522861bf809331, 0x815f6c1dc958f8f4, 0x2abbdf6bc213e727},
+      {0xeb09ae59c39bc01f, 0xffe3b831676b56a5, 0x8f4815a2a20f86c6,
+       0x748a17669aa30807, 0xf1f46a211b758878, 0xbd421fe76f6fc3d7}},
+     {{0x75ba2f9b72a21acc, 0x356688d4a28edb4c, 0x3c339e0b610d080f,
+       0x614ac29333a99c2f, 0xa5e23af2aa580aff, 0xa6bcb860e1fdba3a},
+      {0xaa603365b43f9425, 0xae8d7126f7ee4635, 0xa2b2524456330a32,
+       0xc396b5bb9e025aa3, 0xabbf77faf8a0d5cf, 0xb322ee30ea31c83b}},
+     {{0x300b04840d6ded89, 0x0b1092cbc3ab55ed, 0x17d9c5420cc10a74,
+       0x7f637e84eff9d010, 0xd732aa1e27aa1285, 0xedb97340e2a77114},
+      {0x62acf1585ef4dfb0, 0x1e94fc6eba1d7b81, 0x88bec5d22e6eb2db,
+       0xaec272028d18263d, 0x4b687353e4bbd6ac, 0x031be3510ff7e4c0}},
+     {{0x048813847890e234, 0x387f1159672e70c6, 0x1468a6147b307f75,
+       0x56335b52ed85ec96, 0xda1bb60fd45bcae9, 0x4d94f3f0f9faeadd},
+      {0x6c6a7183fc78d86b, 0xa425b5c73018dec6, 0xb1549c332d877399,
+       0x6c41c50c92b2bc37, 0x3a9f380c83ee0ddb, 0xded5feb6c4599e73}},
+     {{0x6c00f388f086d06c, 0x17ee45035add0cf4, 0xf96984c707caf89c,
+       0x9d49d667648ed5e9, 0x3ef95015a0164881, 0x39e28e447d9c651f},
+      {0xb13ad24059f37780, 0x08cee349b9522225, 0x9245ee6f2ba1b214,
+       0x12bedaa9a886d8d2, 0xe139ae08fcb8186f, 0x99203fb6fc2ef864}},
+     {{0x14d34c210b7f8354, 0x1475a1cd9177ce45, 0x9f5f764a9b926e4b,
+       0x77260d1e05dd21fe, 0x3c882480c4b937f7, 0xc92dcd39722372f2},
+      {0xf636a1beec6f657e, 0xb0e6c3121d30dd35, 0xfe4b0528e4654efe,
+       0x1c4a682021d230d2, 0x615d2e4898fa45ab, 0x1f35d6d801fdbabf}},
+     {{0x3c29284764c9323d, 0x40115a890491f77d, 0xec141ade2d7a05f5,
+       0x0c35e4d9222a5f9f, 0x5ea51791442a3e9b, 0x17e68ecee51b841e},
+      {0x415c0f6cd6ae9174, 0xe6df85f89ffd7595, 0x65fc694f8dedf59c,
+       0xc609503efee92718, 0x57d2592e97d565ae, 0xb761bf157e20862b}},
+     {{0xa636eeb83a7b10d1, 0x4e1ae352f4a29e73, 0x01704f5fe6bb1ec7,
+       0x75c04f720ef020ae, 0x448d8cee5a31e6a6, 0xe40a9c29208f994b},
+      {0x69e09a30fd8f9d5d, 0xe6a5f7eb449bab7e, 0xf25bc18a2aa1768b,
+       0x9449e4043c841234, 0x7a3bf43e016a7bef, 0xf25803e82a150b60}},
+     {{0xd443b26582376117, 0xb91087c11a1beb0d, 0x3fe62a6545cc5951,
+       0x49c754bce6e472d5, 0x7e60bb8177c424eb, 0xbcd4088e830cbb97},
+      {0x3da5c94eba26df7b, 0x508b4f55f72b4338, 0x409c5c7469ad7784,
+       0x82e5f1b0fdf44d6a, 0x10654a1ceed2766f, 0xef1e65faa6e83f4a}},
+     {{0xe44a2a57b215f9e0, 0x38b34dce19066f0a, 0x8bb91dad40bb1bfb,
+       0x64c9f775e67735fc, 0xde14241788d613cd, 0xc5014ff51901d88d},
+      {0xa250341df38116b0, 0xf96b9dd49d6cbcb2, 0x15ec6c7276b3fac2,
+       0x88f1952f8124c1e9, 0x6b72f8ea975be4f5, 0x23d288ff061f7530}},
+     {{0xa6e19d0a5f56dc3c, 0xe387e2690b88326a, 0xef7380950ee527a4,
+       0x78b7174b7c4278a6, 0xc133d867e70798ff, 0x9d0fef759e9230ca},
+      {0x7431eef01a955ab9, 0x3772e7038868d922, 0xf7a4306a8d6af3f7,
+       0x633bb5a0bbec076a, 0x6d07623e7a257ca3, 0xffb5e16521c00663}}
+    },
+    {
+     {{0x35ae891bbb71e9b0, 0x1f6ce6ca522b77f0, 0xc2dab3cae63745c4,
+       0x55b8c185f218d139, 0x6ab039c889f3b0e2, 0xd9e25bfdc644c3fa},
+      {0xc8496f203e2ed47b, 0xc395ec028d67e17c, 0x5c67839292114918,
+       0xe962e52fef73f345, 0x3818baf354fcfb22, 0x4d75d65d9d4bc911}},
+     {{0x7f1f985c022ea83a, 0x90a22662a7584e7f, 0xb40a930a5188fcf6,
+       0x3fad79aba3a82904, 0x7bee8d22f3151027, 0x79a1a838c2c3e17b},
+      {0x1fbe06e933cc3509, 0x629c56aa9abd5cca, 0xfff290ec2d9cf7a5,
+       0x5d0dedaa9bd062c5, 0x080344abd7d35381, 0x0848373af5cf9eda}},
+     {{0x170098dea1b31832, 0xc6876bf92cd8c540, 0x35b1b04b8660d773,
+       0x8b4b6c4b5152ad1e, 0x0b0bd1c24a8e92aa, 0xd814f6f488172f4e},
+      {0x13a7689941ac83d1, 0x355933b4f1d80357, 0x4b394f973dc17e72,
+       0x1b0cd1660a7124b2, 0x7549880cce8a372c, 0x79f53f7ee712603b}},
+     {{0x31d31f7a7a0c0bc0, 0x7a37a84ab251d2bf, 0x1793362e52f04d67,
+       0x5808e70921c7b651, 0x33fe9123ed6f47f6, 0xdeb1dde958f71405},
+      {0x821d3045ae56b472, 0x9f61f761e02043ad, 0x932ddb145b2048a9,
+       0x17d989fed7811330, 0x032ae4cb128fd85f, 0x8f1956b47d1ef434}},
+     {{0x30cc44e0ce1d819c, 0x3c2c4f0415a3a414, 0x7f06d2c2665b634b,
+       0xf609fe647df0bd69, 0x4b0c8c366a0dbf94, 0xd0a3a75246e9b487},
+      {0x7407e1579578a83f, 0xc46ffa4ffe0f975f, 0xb086f1991efaeccf,
+       0xf984b69d64796c18, 0x14de44fa8ebfb97d, 0x47bcb675f5245ba6}},
+     {{0xed58c1ab0dbafc49, 0x41995a5a6fa8b473, 0x3af3853d85450ccb,
+       0x18d1a7be601fe529, 0xd196520fdab2d926, 0xd1f2c1e956213ae9},
+      {0x3721825577ded01d, 0x366c552da7905433, 0x023d03737d9430d1,
+       0x65d70cb69ddf69ea, 0x6321df7ad4d3fa24, 0x77b1c2bfb91084c3}},
+     {{0x2434dbdf0aef0ff7, 0xca74413e9cc3d2ba, 0x0aee0d653dcbaeb9,
+       0x895680764184a72e, 0x3d7e4f61be7d4e0f, 0x284a8608ae441b4c},
+      {0x7274fd926a67283c, 0xa222be15c06e0b84, 0xa0713cd7e4623e88,
+       0x0ff4a3174710aa33, 0xc9a35a65044dcecd, 0x7bae1ecade77a24b}},
+     {{0x070d34e116973cf4, 0x20aee08b7e4f34f7, 0x269af9b95eb8ad29,
+       0xdde0a036a6a45dda, 0xa18b528e63df41e0, 0x03cc71b2a260df2a},
+      {0x24a6770aa06b1dd7, 0x5bfa9c119d2675d3, 0x73c1e2a196844432,
+       0x3660558d131a6cf0, 0xb0289c832ee79454, 0xa6aefb01c6d8ddcd}},
+     {{0xda10f55281069df0, 0x70088f4e560ea55a, 0xdcee31afda8cbaa5,
+       0x1213b76abe16a7b7, 0x4fffa388781114d1, 0x2cc19aa9904479d2},
+      {0xc4ebf9be85eec3cd, 0x48ea527abaff7431, 0xa5b6fdca52d3ce22,
+       0xbcb078357e139d7a, 0xc7f175515de5de75, 0x005ab4d915bcf7aa}},
+     {{0x041511b041383866, 0x7c90692adb9c2b4c, 0x736cc6af61deb106,
+       0x57d428cbb5b84abe, 0x14bc498135dbcca9, 0xece9004137f3ef2e},
+      {0xe2c3371185066bd0, 0x335bd50babef34c2, 0x755f513db017a337,
+       0x28d263e2284445ad, 0x83402ba9ecb8436e, 0x66357324f31d28d4}},
+     {{0x05fb9811bce3cea0, 0x74adb5b5df2b07df, 0x870e63b80c4e5e2a,
+       0xe873cba7e5fec889, 0x28b0e00519cd8a3e, 0xbb16491b48112c8c},
+      {0xddb8cfb55df42faa, 0x35f952ae2ab1a097, 0x35e885e1d2dfa18f,
+       0xc3ec23255b4a0277, 0xdbe2e40cc5aecee0, 0x133383c90690080a}},
+     {{0xe5d473dc7521f457, 0xe9ef09bda00be577, 0xf6d0965fb6eaa640,
+       0xeb49486875726560, 0x452116d528817302, 0xf0424fdbfbde3597},
+      {0xd6096da3bb454915, 0xde48280841422141, 0x7a1351972d19fac0,
+       0xdc9a5ec421393f6f, 0xcabcc1e3eb2c8ada, 0xd436643142d8c4f2}},
+     {{0x46c7b43834246834, 0xa0a570c32eb9f9bc, 0x3e01db21586a0fdd,
+       0x15732b079d21192c, 0xe544b5c9fd747dd8, 0xeee7e1047ed374fb},
+      {0xfa6190863b75a586, 0x9d0909f4e8a4cfd4, 0x30e0e476ccd93fa4,
+       0x5bdc5c02a14595d4, 0xf6f8ab6ae245400f, 0x7bd194cea4198419}},
+     {{0x713a654c68e190a6, 0x6317f6ab3037a8e6, 0x005f412a6b6bafef,
+       0xf67f8201b53eb41a, 0x96585fcbf51ccf93, 0x68ed706e045104e0},
+      {0x535dc2a740db03d9, 0xb9f0b69dda583d56, 0xeed71cb1414dc76a,
+       0x7368aabdc5e7698e, 0x3eb6a4f14689da93, 0x753fa65afcb73b42}},
+     {{0xf5131aad9b860b0f, 0x19af93ced9bcf9c9, 0x69b9765d307ca1ca,
+       0x0b73580887936c0b, 0x10eaf7ae1107f1cb, 0x15211ad516dfe03b},
+      {0x9bde40d5b11c8af6, 0x513ea01aed1fc8be, 0x2f04be275412ab86,
+       0x2a1adc4a9de582fc, 0xb0c4323500de0043, 0x689e15e4006efb33}},
+     {{0x0ed1082f89e4e449, 0xdb1fb471833f2378, 0xa35fef0eece77352,
+       0x76adaa464bf0c426, 0xfbab929aa011b2fb, 0x6f475d5b9d8cc4d3},
+      {0xbe6d7f2174351480, 0x2d1362d193e4a7ae, 0xc7e2cba5106ceaab,
+       0xfe94528a45258697, 0x7109b17d075945b0, 0xfd395b2ccae17f7a}}
+    },
+    {
+     {{0xfc1faedc310404a8, 0xea339148d3bcb128, 0xf00485456416defd,
+       0x75de7770c58653e7, 0xdd2dcbebe2f6f99e, 0xa4380ef4d159ac07},
+      {0x45dd713ce4173608, 0x44919b61446a6789, 0x3f73756b6b962b38,
+       0x3cb9f53bbffd3f0c, 0xd723c40b7f08ebae, 0x998a9b170c3cddba}},
+     {{0xf6377e3bf6ba1469, 0xc334fb6c09c832d3, 0x7f85ac42c21c0cf1,
+       0x7a3e31c9857d8edb, 0x2eb1076327b77ed6, 0x2bfbbdbc38dae10b},
+      {0xed7c6fb17bae3b4f, 0xc5911d9f36d04e6f, 0x4dc435504569e72f,
+       0xaa82fb97bedae3ab, 0x06d37bef4f27e463, 0xd0dbce6df0c35a11}},
+     {{0x43c78835661019ec, 0x68e916b124e66d29, 0x02c0f3a224094671,
+       0xab6f1c05d0f17d86, 0x6d3bac72a22d4264, 0xd7b8f152f6e5fafe},
+      {0x95627c6339447eb3, 0xfd15901879e1ff93, 0x39277c835ad80806,
+       0x758aafc90d7c7b74, 0x605ad8ca4cb8bec9, 0x6a90085c5741828a}},
+     {{0x6edf5561ff8b1fbe, 0x614b788ef6eac0c0, 0x7699ae56d8d66d29,
+       0x5f81602ae9d58eb2, 0xd0c04874faf9176d, 0x4b3a0046523153b1},
+      {0x9690930ff6315883, 0xa81c0b44a60ca92d, 0x2d0e725873bcba90,
+       0x57efe72de902e329, 0x3fcd598676bc27b9, 0x492adf0393940c09}},
+     {{0x6895dbe2f820c195, 0x3787a5003f6c7b40, 0xdc718243ac1e90f3,
+       0x352f8c91ba5d0870, 0xf3d1c53eec0112b5, 0x08a0782f6b84f64a},
+      {0xd659e6358eedd5d4, 0xfc30df6c29537276, 0xbfb09978a1755ce0,
+       0x227f7b12aa2b4187, 0x828730b9226539d2, 0x9051a37cb2472c95}},
+     {{0x7de743e2b39317b8, 0x9205d4472d372acf, 0x8226fc303eeb0012,
+       0xab2a3e052af74be6, 0xbe4767804af91ac0, 0x98497c710ca36bf4},
+      {0x74fdf7cd8d6dedb4, 0xb50778eea0fc5919, 0x5d5ec33f2fcd7c63,
+       0x667b81937f33cde0, 0xce48ae4b38364d44, 0xb8578963223ed67e}},
+     {{0x4b20d1829567f5f4, 0xde7e814918f02b34, 0xc9a4be7becff9dd7,
+       0xe2f70bbe9812fd3f, 0x471bf90c9c889263, 0xb60d01b53e61f5bf},
+      {0x258c7f89d22d855b, 0x35ef5c15b75a7d4f, 0x26d8e1dab247f27d,
+       0xcf1361998d0f7757, 0x312447803f8e894d, 0x8d2a20bae1a3d47d}},
+     {{0xc68b641ec795a2c7, 0x4fe559b15a4d6647, 0xeda98cbad89ce668,
+       0x15f84dc06c269d8e, 0xf0eb685ecbf34023, 0x3668c530c032634a},
+      {0x2e3d7fffe4531f59, 0xe627030685494d06, 0xf02cabcfa3e050df,
+       0xccd2da67c001dcd9, 0x50aa3723066d2d52, 0xdb0756507224a41f}},
+     {{0xeaf0b05d43c1e526, 0x7eddb25a5c673e17, 0xfce700dec1f9bda7,
+       0x4e6f4c70646a1550, 0xae06c3e58ba60c35, 0x1a57101fc0c89c50},
+      {0xdb35b1f360a36192, 0xf740a467265c3ed1, 0xeab65a886175e771,
+       0xd94c8cc6cbe28ed4, 0xac347e7b465dd7a8, 0xca927337ca9b899d}},
+     {{0x3499422edd045c9e, 0x5119c675727f1f25, 0xf44a89aed76e7077,
+       0x9d6967b58eb17f39, 0x49b39b812bbed398, 0x05b3a45507deb5e9},
+      {0x8fa1ebf362039ba0, 0x52c3d14b0b650544, 0x2603aaf737d3fd20,
+       0xb6fe1148ec70bfc0, 0xe68b8475feb74df8, 0x56fafdcbe1f4aba2}},
+     {{0xd061bce6a05b2adf, 0xdb6e93248b7cf4c6, 0x6344c3b6189f7ce1,
+       0x06993dc93cfe678d, 0xb00b5227b6e22f1b, 0x8f836e4c780137c1},
+      {0xaf8229531e9ad145, 0xb438997cdfaaa159, 0x03e27459904396e6,
+       0xd06a0fdbc8259d86, 0x8afe766be040907b, 0x0f5ff265038fbdba}},
+     {{0x4b1f8698e1aa5953, 0x94af5c0cbf0a531c, 0xba1c49f56536e156,
+       0x31c3163109c95a75, 0x268a308f0a6d9af1, 0x185b9762fa9ca8b7},
+      {0xc3b1cbcd65035840, 0x17b276c6b429c82a, 0x1b4ec7b334396850,
+       0x42f21d5a048a6943, 0x0bf948f55b5820bf, 0xac944487b48dca58}},
+     {{0xefa91b2eac575242, 0x58280b99cdaca77a, 0x5c3f8382cf39d117,
+       0x4d460dba70e5d17c, 0x440b4db812f6d6ad, 0x14b9b3357f3a6bb8},
+      {0xfbb3746a837833cf, 0xbbf4735bda482df0, 0x4efe32c09fbf146f,
+       0x65e5d7c2346e3b9e, 0x742e81ce434ce5d5, 0x87e2b7723bb80bd5}},
+     {{0x18d0983be02f8540, 0x708654c7e8058c66, 0x0b137f6892894720,
+       0x0b8b62e94345444d, 0x426807d3bfd043d0, 0x17ac2e642a1ac390},
+      {0xd037e79cf2076839, 0x991d4ff03ba4d3f2, 0x3937247ed3724bfa,
+       0xb5b50d34218413d1, 0x2accc17228157b81, 0xd07f18b7c472e8b2}},
+     {{0x0df64ab2ca12be15, 0xdbac68f8c2f0d0f9, 0x5772ba8ba2107d3e,
+       0x32c43ac976724cfe, 0x6f4a367e166229b7, 0x9c8bdb42230b3527},
+      {0x343d644de71f261d, 0x45c849bf26283547, 0x3a42b9b8d8e4c7b0,
+       0x0aff84ad9f8af5c7, 0x453c3a30418cfee8, 0x6be57cdba241633a}},
+     {{0x04418b5965b55050, 0xa8a797c3d324aa67, 0x5f87e22c7c65a6d9,
+       0xaac710651dbeffe4, 0xff619d64bd3cc05c, 0x9a29c966e65c92c4},
+      {0x23af2b21dad7fcbd, 0x4950a767153b817f, 0xc34a7efac6478c55,
+       0x57cde95af6cd140e, 0x64b74575f5a0db2e, 0xd4b5ea5275d7fb76}}
+    },
+    {
+     {{0x284050628e72aafb, 0x655bf3538ea8bf00, 0x789d944405547f7b,
+       0x7fa445ed3441e472, 0xfeb198254a44ce87, 0xccb5f12c129aed14},
+      {0x22b05de3af94fb34, 0x7422a040d3f03199, 0xfba252caa83f7f08,
+       0x0f6ad6e6cefaa757, 0xe1ad18716517d806, 0xd16dc8ed8e9d97ad}},
+     {{0xcbb99194a3736eb6, 0xdd5161cd36dcf470, 0xd50b24aab6ab6c03,
+       0x419d2810bc41f4b7, 0xe2e88d7a295496cf, 0x350713f2f2457ac0},
+      {0x838e4a360427e2ae, 0x7631472a4d974e5a, 0x9fa3ab1c7a5c5fdc,
+       0x324798cdde34cb8d, 0xbfa5a9d0889105fe, 0xd05dad34fd0df249}},
+     {{0x536e5657cb419fc3, 0xe8c208bc1d271dd1, 0x6a3713bd22d2b9ad,
+       0xa4c761a7471d808d, 0xd93aafb67e6dca35, 0xc46c0ae38f55ca32},
+      {0x55dc0de7a78bfca0, 0xe9cfb3013407d0ca, 0x777e2a60b3256c14,
+       0x32b2238c6d8fee02, 0xe8b3539646e43ee8, 0x310bc1ba247985dd}},
+     {{0x9974759c581f9d3c, 0x9e76a970e5cb1973, 0x8afec58ec64941ca,
+       0x2d7c57fa01d05575, 0xc07c74cc5c448db5, 0xa52474ce01bb1440},
+      {0x93162d9700115bbb, 0x483b6147fd7480f9, 0x4f28c57e6af18ded,
+       0x36faed8f174a3089, 0x702dbd64a3dd6265, 0x86a9c43f6adc0d7b}},
+     {{0xa3510710b9de7b63, 0x9f364ad14019c9df, 0x5b66a5d79b5bdce3,
+       0x2b2f695178b1b385, 0x3e4783d33cfa9f99, 0x1af517506bd6bcf4},
+      {0xf9c0686a81d8d7ef, 0xdc0f22ec37c068d3, 0xe1b8665393545faf,
+       0x37ca8501a8a52881, 0x07ac5c8a5603e359, 0x98fb2bab542cc937}},
+     {{0x4981be690c5bbd3e, 0xb047df0a185fdb55, 0x3168e05074cff00c,
+       0x111150a1b52c7f9c, 0x0db2ed84a51c7986, 0x7d991630e61272ad},
+      {0x7443d93628de14dd, 0xfdf31f41a5daed5f, 0x71e0ef4e866b5e40,
+       0x05c57a45b965a670, 0x85bdb58c70e1aa77, 0xe4d1fe2a9df3ce32}},
+     {{0x5d4618982f722563, 0x11d22b39567db14c, 0x9a8f004e6779cd40,
+       0x0812ae3d5473ecd5, 0x4ed828624e6c296a, 0x2d9ce40c064ee61f},
+      {0x4856d586d8a9eb1e, 0x2ddd6b125d1b5e3a, 0x0ab5eec0382fba3c,
+       0x302018dffcf4a9c8, 0x7b4e6fd2ab3cdedb, 0x266c246a8f64cb1d}},
+     {{0xc41e4aedf5c3af59, 0xa0284ad06de9a78a, 0xf5eaab7b8ed812d2,
+       0x7801fbb81afb58b8, 0xbe5cdba671efcc3a, 0xe31a0e3ccd10cb91},
+      {0x882e821e85dc0bc6, 0xd3ad070fbb32e506, 0x3afede2bd8a0f038,
+       0xe20a117c857fd3a0, 0xebaa2aa43060f767, 0x6524aa0d2b9d1da1}},
+     {{0x9cc5847c88cffe33, 0xff726b0f6e8eb6c1, 0x9bb2ca161bc45d8e,
+       0xe7903009a6d8a5a6, 0x4f089cc047db2201, 0x4135884de6b5928a},
+      {0xb1a86a0ae5c017cf, 0xb1d9bf6db0a393df, 0x33d9c1c628bb3277,
+       0xcb05b67b45b582ce, 0xa72585fcf33792c5, 0x78b7c5e8a7d1ed84}},
+     {{0x70e478fb9346df25, 0x01dc0c2eb4a4ada5, 0xaec82b005be36ea7,
+       0x82618b8f6717e06a, 0x2db1f6d4008f1977, 0x4e493f3b16b390d1},
+      {0xfe86fd4d990a75eb, 0xa1cf7f99783f6076, 0x6cbb23e70c049158,
+       0xd05be7e5ed456235, 0x601374069bd836ef, 0x94ec964432e5f604}},
+     {{0x3361e1ce3d87bfa8, 0x92f235e78dcca4f0, 0xc8084cb4be323fd1,
+       0x3fd481a5c24c6d16, 0x9b1bd9402cea81ba, 0xf50911910c5aa59f},
+      {0x4cd8c9eff81d5e2a, 0x5ad000131550bff4, 0x29d47b9f8cc32e55,
+       0x66e3e6f111694ece, 0xd5edf7017950dd7e, 0x9ccb10960f6350c6}},
+     {{0x09db138d18f2470c, 0x63bd2290f613658f, 0x0bb647794feebab9,
+       0xfce4aee17fdb1e71, 0x7d5c0c61a7f1f65d, 0x46405b618d02d6cd},
+      {0x7cac04856fdcb0d0, 0x85224c4b2f8ec5af, 0xb5879a59db0aa864,
+       0x75f391b8ff94f8b5, 0xa6c994ae49c97f8e, 0x4d968fadd690b232}},
+     {{0xf5cd290a67e0b4e7, 0xaa6fa6807c1594b6, 0xebedfbd7b63270be,
+       0x574b410ba369bfee, 0x431cba5a020ea888, 0xd3a3102f56c71d47},
+      {0x4894bfe0a90a853a, 0xd78bd98b5f9c4b6b, 0x9b1324f6d900c5c1,
+       0xc65c944d718c2147, 0xf661de6ba987f634, 0x0315e69f172628d8}},
+     {{0x07c60c7522ea5f1c, 0x35beae34a36bee4f, 0xa8b00a09dcba8997,
+       0xa77f1f3a802ce50c, 0x6c4050df2a2144b0, 0xf79bfa96ab1b10db},
+      {0x9025d470433a9b1c, 0xaf3e391790d9eec8, 0xbcad2d629ae2d535,
+       0x7a152829eff0f6a9, 0xe87345cd925fa5a0, 0x6ce007200e84039c}},
+     {{0xdae449c007f6a05a, 0xbc1b84f55bf26c9e, 0xe3b3f9edb1c13820,
+       0x5442ad5b4090598b, 0x794ef65613749e4d, 0xde809180948b71c5},
+      {0x4c72dc7de203c5b5, 0x8902b0971b349fc4, 0xa899bedb225a1569,
+       0xeb7da73de6ff3f53, 0x6ee8e1607c0be37b, 0x9ee667d2a31bf943}},
+     {{0x5017e145db81146d, 0xc7d2086d45c54db8, 0x2541059dfa98234a,
+       0x4bf344d99985af98, 0x39737ed67b5b7b1c, 0x8e24691987c411ad},
+      {0x2fad8cedb877a75f, 0xe42352df17e60ee2, 0x1a53d856404043f7,
+       0x6c1f07a5863927a1, 0x38d3a4f4b6892121, 0xf4c1092001976c8f}}
+    },
+    {
+     {{0xbcc88422c2ec3731, 0x78a3e4d410dc4ec2, 0x745da1ef2571d6b1,
+       0xf01c2921739a956e, 0xeffd8065e4bffc16, 0x6efe62a1f36fe72c},
+      {0xf49e90d20f4629a4, 0xadd1dcc78ce646f4, 0xcb78b583b7240d91,
+       0x2e1a7c3c03f8387f, 0x16566c223200f2d9, 0x2361b14baaf80a84}},
+     {{0x7a1a522b246dc690, 0xb563cbe14b61ab70, 0x41bb4abe3d4ac4ab,
+       0xc52950b337f996e8, 0x01d991e679727761, 0x35de93bd978fd7d2},
+      {0x86bad5e65706d336, 0x10844155e7f26c20, 0x58ffeb7705757453,
+       0xbb1861293939df77, 0xbfdd394a6a78ea0f, 0x907ff0546e33e1d3}},
+     {{0xdb1cffd2b5733309, 0x24bc250b0f9dd939, 0xa4181e5aa3c1db85,
+       0xe5183e51ac55d391, 0x2793d5efefd270d0, 0x7d56f63dc0631546},
+      {0xecb40a590c1ee59d, 0xe613a9e4bb5bfa2c, 0xa89b14ab6c5830f9,
+       0x4dc477dca03f201e, 0x5604f5dac88c54f6, 0xd49264dc2acfc66e}},
+     {{0xa7f295320df93b34, 0x855934f25c14df30, 0xd2f54ce9efae348c,
+       0x5acb931cac52758d, 0x287b3e18d22961a4, 0x42a5516d748f8fe1},
+      {0x1b62b341877224ca, 0xaff58db3d30a4aa7, 0xbad78dadbe8da847,
+       0x85fa710954f18276, 0xe2cc9d287c4bfdad, 0xbb131f762c75f237}},
+     {{0x283dd7f01c4dfa95, 0xb898cc2c62c0b160, 0xba08c095870282aa,
+       0xb02b00d8f4e36324, 0x53aaddc0604cecf2, 0xf1f927d384ddd24e},
+      {0x34bc00a0e2abc9e1, 0x2da1227d60289f88, 0x5228eaaacef68f74,
+       0x40a790d23c029351, 0xe0e9af5c8442e3b7, 0xa3214142a9f141e0}},
+     {{0xcdcdd7d703844670, 0x79ec59afb4a23f91, 0x5923c569c00ce5c3,
+       0x099c17ffc589d0c7, 0x0335eeea89fa6fe6, 0x916bcacaa4e868c4},
+      {0xb7037325fb687bd5, 0x57d6bca79853b564, 0xdf3132efd5e26d28,
+       0x7ed994b8de919cbe, 0x12df67cd6fbbb18d, 0x516e07c06baff508}},
+     {{0x72f4949ef9a58e3d, 0x738c700ba48660a6, 0x71b04726092a5805,
+       0xad5c3c110f5cdb72, 0xd4951f9e554bfc49, 0xee594ee56131ebe7},
+      {0x37da59f33c1af0a9, 0xd7afc73bcb040a63, 0xd020962a4d89fa65,
+       0x2610c61e71d824f5, 0x9c917da73c050e31, 0x3840f92fe6e7ebfb}},
+     {{0xf2ec9ef597e833e4, 0x97bdef9734ec7e41, 0x90e2b2387d2ac6e3,
+       0xcf682b120318a3b7, 0x7fe76089ea84a7a0, 0x85c489f916546d05},
+      {0xf987118f6abdda05, 0x675cf998aa4b95fc, 0x544c7774888a7e8c,
+       0xbd2647ba63ec5831, 0xb479cea3fd2fe985, 0xa042134528d163e8}},
+     {{0x50fbd7fe8d8b8ced, 0xc7282f7547d240ae, 0x79646a471930ff73,
+       0x2e0bac4e2f7f5a77, 0x0ee44fa526127e0b, 0x678881b782bc2aa7},
+      {0xb9e5d38467f5f497, 0x8f94a7d4a9b7106b, 0xbf7e0b079d329f68,
+       0x169b93ea45d192fb, 0xccaa946720dbe8c0, 0xd4513a50938f9574}},
+     {{0xd93506a4e5947c6f, 0x4340d76a39b81d08, 0x741aee5917930d30,
+       0xfea3d99a18fdb81c, 0x1088ff6b289bcb07, 0xc6b45602b7c082c6},
+      {0x50e2baab453d8d69, 0xda9bf561e893e183, 0x0af25f86b29a284d,
+       0x0e92e67473e01380, 0xe173a0e32be00e59, 0x402d2f3dada8954a}},
+     {{0x841c96b4054cb874, 0xd75b1af1a3c26834, 0x7237169dee6575f0,
+       0xd71fc7e50322aadc, 0xd7a23f1e949e3a8e, 0x77e2d102dd31d8c7},
+      {0x5ad69d09d10f5a1f, 0x526c9cb4b99d9a0b, 0x521bb10b972b237d,
+       0x1e4cd42fa326f342, 0x5bb6db27f0f126ca, 0x587af22ca4a515ad}},
+     {{0xca9cb3890399721d, 0x03ad9f4aa3291479, 0xd85b5df56dee003d,
+       0xe1fa7b0264a4f83a, 0x01c4cbfdb73f7324, 0x707010d45cf2ddf4},
+      {0x3c6df430b12e02f8, 0x921a290185531489, 0x302fc77c91d1022c,
+       0xc3733ec0342d8f3f, 0xb83bc75f6195a665, 0x4a14b9e7a79f8027}},
+     {{0x1123a531b12e542f, 0x1d01a64db9eb2811, 0xa4a3515bf2d70f87,
+       0xfa205234b4bd0270, 0x74b818305eda26b9, 0x9305d6e656578e75},
+      {0xf38e69de9f11be19, 0x1e2a5c2344dbe89f, 0x1077e7bcfd286654,
+       0xd36698940fca4741, 0x893bf904278f8497, 0xd6ac5f83eb3e14f4}},
+     {{0x9f0e5428e2a57359, 0xc690a3c714998c16, 0xd73c3ca2de37e07e,
+       0x2ddf91b8dba0bc0d, 0x69d834b27570ae71, 0x2ac8bed4735195a6},
+      {0xcd8c51ff3b1fcc5c, 0x7aa8cf4e1ba6863f, 0xebb69e72ae70f428,
+       0xa29409dfaa9e936d, 0x43f6ee805a332b9b, 0x0de49efac2eab0a9}},
+     {{0x327b9dab488f5f74, 0x2b44f4b8cab7364f, 0xb4a6d22d19b6c6bd,
+       0xa087e613fc77cd3e, 0x4558e327b0b49bc7, 0x188805becd835d35},
+      {0x592f293cc1dc1007, 0xfaee660f6af02b44, 0x5bfbb3bf904035f2,
+       0xd7c9ae6079c07e70, 0xc5287dd4234896c2, 0xc4ce4523cb0e4121}},
+     {{0x04baa1762310333e, 0xdc75e35f7b9bad46, 0xc4a6031dc6cd6108,
+       0xba2534d030bf87a5, 0x7ebc6e2131e497cc, 0x8a2a82b4851fd665},
+      {0x9ecae0116d5faf40, 0xfa3a6d7f96956ecb, 0x39e8a9c22fa52782,
+       0x74c93801236d442e, 0x8b21ba23b1c289ce, 0x7f3e221b25c769cf}}
+    },
+    {
+     {{0x761e10e2ca114c4a, 0xe39d121d894301b3, 0xa0870ff43dbc6fca,
+       0x97651286cbe0ba8a, 0x47d46075c0f1ff6a, 0x18669c843abeb5b6},
+      {0x1234c80ead8d9309, 0x1ccbe4d51f6f97ff, 0x399a2d41d82ab780,
+       0x8a03afafde426e50, 0xa2bcb109ca6dde77, 0x840e13b00618f5ec}},
+     {{0x15d47e52ec645a62, 0xabe0ddb38d6d4423, 0x51226a3070cddb11,
+       0x63a253d32b5a8db7, 0xe8be4d1fbef37d65, 0x41e625d9c0920b91},
+      {0x08b713a8d9d040ec, 0x467fb08dc450cdba, 0xa8975877917ee393,
+       0x294792e91528cd12, 0x4512dc8c37daf6aa, 0xa83becc9197a99b9}},
+     {{0x3b21dc1f538d92d8, 0xc80b22b3c005aa86, 0xf536e5d30da87d65,
+       0x4ce10edf0cd999a0, 0x8949181450e08f5d, 0x77fd8f2e526647e6},
+      {0xcb207ee9250099fd, 0x03c7d1abfd6aa078, 0x7d4940d225e0cf15,
+       0xb688b311067fa052, 0x89308326a98b2e21, 0x3ee4cc2b72311eab}},
+     {{0x37be5d3f68d7dfcf, 0x97bdbd49b945e6f2, 0x165a24b59d1569e7,
+       0x254aaf59b4e293ab, 0x3c751fbd6fb7c0a4, 0x14eda4ba5018cb18},
+      {0xacb3b8971b5f6aed, 0x6d10be441e4b6b78, 0x245d7258621df6d7,
+       0x2af0e283185f0e2a, 0x1e7edc818fddbd81, 0xbd1e6c72c538d02a}},
+     {{0x12014812aa006a4f, 0xf84aa1a283374604, 0x9f8475d90ee4a8ae,
+       0x37a1b21d135811df, 0x341431711166af52, 0x204dd449f5a33016},
+      {0xc838d3d5372b6edd, 0x314f30533987611c, 0x819adbe0d112605c,
+       0x45da01aef6b32c5c, 0x3deb30187e3b13a9, 0x0e78a3a279058926}},
+     {{0xaab5f0c742adface, 0x50d9f53fcb580132, 0x68a3c689b5fd6ebf,
+       0xdea2f2ee9cde184a, 0x8c174c4413a98466, 0x8c4e2ae1cb4d921b},
+      {0xba973c6c2d4c6d5a, 0xc615071461d2ec5f, 0x2aba1375666d8bf9,
+       0x2fa2768fd41272cd, 0x49f3b8d7a0bc34bf, 0x61118166ca45e5fc}},
+     {{0x92f565ea2665ae2e, 0xaaa91acf1aefd472, 0x3878c718fbb062aa,
+       0xde46e7d87de3c64d, 0xff9900a4bd506a76, 0x4e30ed723daa73b9},
+      {0xd6be94467cbaff42, 0x26fe63055dd691f4, 0x64ef093c6d393800,
+       0x2448c67a7bb8f155, 0x9da6e75fe5d732d7, 0xe837a60250b080e0}},
+     {{0x6858b674844626a2, 0x610cd40f0cbba6a6, 0x324e674e29d9194d,
+       0x2dc6fdf6dcb30a51, 0x3f3ecb77528aa549, 0x0721f8f923ffaa92},
+      {0xd8efcbd627a77538, 0xf4e642bfd6162c9c, 0x04f2b0b74cf4a16f,
+       0xbc0bb49fbbf335fd, 0xc6b6e5bd5a928c36, 0x981b01f4d893dd45}},
+     {{0x2836b977518f01dc, 0x117e833ea06c7362, 0xcda89f2c31152b22,
+       0x2084c5c434be0102, 0x6478de752bfac8c2, 0x9f7e901aebda5ede},
+      {0x5f43adfc5aa25b6f, 0xfb719dcacdd0eee3, 0x14431b2df9b16d84,
+       0x846261af97f04b2b, 0xcc6100b81edd7d4d, 0x6197c87f87cde5f4}},
+     {{0x4a9e6281a01cb6d9, 0x699c071987065307, 0xa8ca4971dffa58be,
+       0x8adc304f89efaadd, 0xeef0af151f3c79d2, 0xb3be9c6c581587e8},
+      {0x79010ad2da0be326, 0x4f361e1e4be00f8b, 0x180e66bac53f3c74,
+       0xa668c3f3b2521c2d, 0x60bc2fa6abb73a09, 0x0bda0ff64392692f}},
+     {{0x2e88f3089aa349d0, 0x9f19df26a7cf751f, 0x1e0229c74885be75,
+       0x6770eee2a32fce2e, 0x448366e4562d99d7, 0x7670bd688bc7484a},
+      {0x1537483792d83c6b, 0xe0f499f814f7c403, 0x4cf026718a6b78f6,
+       0x75f6e30a9849e689, 0xaf6fe2a5cad5065a, 0x6378401b43ba98aa}},
+     {{0x26d6d225d2446552, 0x9b74929ed2600e42, 0xcef3a052447126d2,
+       0xcba2f70c4d1c7e0a, 0x0250a96f020d33a3, 0x9c946f94a5e587d9},
+      {0xc7d4343f86653ae6, 0x9c8328598884e9c6, 0xa44fa8c51c234f88,
+       0x7193e6db987f04dc, 0x24efebac6a25ff37, 0xe23f0a14953b3db8}},
+     {{0xb13db9bb491d9ba9, 0x7105da915556de42, 0xafa75d3bbd48b3d9,
+       0x10246797ed6c519c, 0x83b278821aa866f5, 0x66f4ceaa54f64e96},
+      {0xf4f03faf43c07b18, 0x97eed374dd18ddec, 0x43b702f16c454f23,
+       0x3c53810c3cb61e31, 0x8a50cfe9edcaea49, 0xfb70772b89a6acd9}},
+     {{0xedc09655a01edb12, 0xdaa9f8237ad80675, 0xb7f23b6cf6a1052d,
+       0x22dc809f697dc18b, 0x0453593f6c8bcd69, 0x80f76d8bc9b43cf0},
+      {0x8e781e178c5b3ba9, 0x66544c7c66a0b318, 0xedd99cbd9d95b620,
+       0xc36c4334bdf0933e, 0x3d550b688b59acf3, 0xcd7d17016ca6a2b7}},
+     {{0x94457602c3d5ad9a, 0xa1a9608e3a7a1abc, 0x16eb231031a107cb,
+       0x5d921026987bf106, 0xec2e5789d2ccc296, 0x87b86d1bb8f2fbd4},
+      {0x939b58026da88d7d, 0x22fa6ef8e19707e2, 0x8b95bd5dc547ce83,
+       0x91268688d16fb119, 0xbf1991486e3627f2, 0xd072bdf2c31ab346}},
+     {{0xfb083c2af810465b, 0xb66a8de902ce0dee, 0x6e4130e747a81b95,
+       0xcd704dc658a98737, 0x842ae329592829c9, 0x99bedc34be20dd63},
+      {0xabee8e55d53b2df4, 0x6ce657586010b37c, 0x781f39b2467112b9,
+       0x6f06058fbe341038, 0x5effdca512a2f8be, 0xaa9bdad7af34466e}}
+    },
+    {
+     {{0xab86639e9c216137, 0x45a12fb882b18d64, 0xb5734418d763f0bb,
+       0xd2cc332211a9802c, 0xe41d7db881269b8a, 0x91072fc12ecfa355},
+      {0x59d6912504ce306f, 0x916d9d4da131b86d, 0x84478b6b8a739738,
+       0xe86ad7d91cc83ae3, 0xbc9b2084797ccd97, 0xc1e94af4694944c6}},
+     {{0x585edee3895c0318, 0x775e142f45e8205b, 0x3bd7924fd85ad31f,
+       0x2e7d8f919124bffa, 0x885397c044c62868, 0xc0c2dff47fda9f5d},
+      {0xd302582ec14e693d, 0x53d6e33a6cec31ba, 0xb0216b5b63653c06,
+       0x8f08a1ad9c70dad4, 0xccf014aaffbba93d, 0x900b0d2ca33f12b7}},
+     {{0x0dd2395e9b8cfa41, 0x50e203abd4f92a44, 0x7280aff16630023b,
+       0xfcce59dc07de820e, 0xa686be05bc8189ad, 0xac4b59bfaac70b7e},
+      {0xd2c0070e7a3c71ac, 0x1d550add35ac1c47, 0xd42b6389fb881c1b,
+       0x57ca3fccd0dafd42, 0x909e8284be26ccc9, 0x1abe7595a002235c}},
+     {{0x1e34781aa6a1913d, 0x9a8f32287d0adc38, 0xfc185ccc28af85ba,
+       0xc923d78b3ae9ba11, 0x7d494d7ea7bdb313, 0xf774dfa5af8f8b87},
+      {0xc178ccc116e863b8, 0x2d472f2aa8899691, 0x608747cc80a50372,
+       0x8147aa90e6f90197, 0x4683d4c978c2f216, 0x8323652c552f3b51}},
+     {{0xa5c08e8bcc2c9a2a, 0x70e1b4058baaf0fc, 0xf29e1e5c9e36e50c,
+       0xa3d9080080f258c5, 0xc9ceac25ecad4498, 0xcb73130fca32f3fe},
+      {0x2dbe620c48b3863d, 0x8c52727f14ff53bf, 0xb60b22a86b45e9b8,
+       0x81e05bc0f6483c5d, 0x217caa6bcd542972, 0xffab716afa780778}},
+     {{0xe5d3e0d80d7410d6, 0xcfa9ed742be432c9, 0x60044434a85a0686,
+       0x93b357166ad6918a, 0x1a3c3e6d051762be, 0x80813589b0ab32d6},
+      {0x64214b92aad403fd, 0x684befc14d3fb746, 0xaca5a51479515046,
+       0xacdba03472e84485, 0x61aa2834287d9e97, 0x07a515a5cad222e7}},
+     {{0xb03093068af19670, 0xd784125a34c6bf0f, 0x0b425ee0255a8396,
+       0x91076433fb541162, 0xc4d8188586f47a0e, 0x3b767d54fd7bc7c1},
+      {0x98b405d3bee196e9, 0x4ef9c511edaccf4a, 0x5a6deb6503f4f1a6,
+       0x4a22ca641b4c5104, 0x2cce36679145ce41, 0xd05187523206810d}},
+     {{0x29d81538037bebad, 0x76e52c73d9e0b78c, 0xaa4ace6e8783d1fd,
+       0x9c14ebddf0e3c126, 0x0eb1c08d6eca4b71, 0xd10c6b961c91df35},
+      {0xdb8119bbe81bb84a, 0xf784d3c117e3ceef, 0x053c916835436f81,
+       0xeb41ccbb9b18d212, 0x93b3fb43b1bc3497, 0xd85a7c758c1ced81}},
+     {{0x004105c3811af84a, 0x01307934a7934a0f, 0x179fd49b9b3226a1,
+       0x195d9e5cde6834b4, 0xfbb79dc00e6051bd, 0x354273ed367f4487},
+      {0x4afa9d4574fb892d, 0x03ae905ea1b7f3bb, 0xea32cd5d592f6122,
+       0xa758eed2f1103301, 0x9dde4238c59d1cc8, 0xe2760bcc51022a42}},
+     {{0x54f84d70d377d7b0, 0xb745d1903344bc4e, 0x1c693ed08f33aa53,
+       0x990ed45f8bfbee7f, 0xad620c9fe9b258fb, 0x465ccb101a54bf46},
+      {0x5330a0d3ebc40951, 0x34423e8ca405da61, 0xeef1ce78b83043b6,
+       0x99678f22ac06d182, 0x9213f57d1802f14c, 0xf8549616adf11fda}},
+     {{0xf31796d2b6e392e1, 0x199d624893b3395e, 0xef14c7c212f9b763,
+       0x721ebf2143edb7a5, 0xa40b88945e96f3ba, 0x8770608c4cff8394},
+      {0x990c99ae8d0def0e, 0x292b26dfa15a5649, 0xa98fda2c91ca89d7,
+       0x916cb1b4973e5f5f, 0xa2823f13a72de0bb, 0x415f7bd28cd3219d}},
+     {{0x521f4af73ed03d5f, 0xe3461f66eaf9064c, 0xad099ab7ae03777f,
+       0x541cadcdb65f73ff, 0x53430463a86059b9, 0x8ff88fe5043e9f82},
+      {0xd515f4c7e42cde45, 0xf7f3dec3f41c3269, 0x7bed53567ef1b8ff,
+       0x8782b45f1295b5fe, 0xab54ebaa03917627, 0x8516beb28787ed9f}},
+     {{0xba7df5a965b68624, 0x30b4d6ed6e7d58bb, 0x67e52341dbb81762,
+       0xd697ab1b0deeac1d, 0x01d15e8e5577ea92, 0xbb12d72498fb38da},
+      {0x302faa6d4e04908d, 0x66cf6cb909b90a9c, 0xcd665dbd98d96736,
+       0xf7d3c528b86f3af4, 0x4844c7541d8b07f4, 0x2a77d7b91eaf7dc0}},
+     {{0x53e59f251d70eb73, 0x8aed17afe69d0525, 0x26ddc17864413768,
+       0xa7c8d40f5e48c349, 0x29ad92d187ff01fb, 0x8f4e1b3b965b2de1},
+      {0xb83cfadf1446eca2, 0x7432bda4e609d416, 0xcf97e8a3f1c7de69,
+       0x45899bd832f55f07, 0x41a6811751175738, 0x89eeb115b8efff21}},
+     {{0x54a01e60936c3eba, 0xf326fe96ec01b12c, 0xcdfaf00366e4de2e,
+       0xc53dba07392fd0a8, 0x00d9b80f6ec46004, 0x84d59be83ba63f8d},
+      {0xbac4ea439dea6062, 0xb4b4845badd568ca, 0xa6ca3d34d225e2d0,
+       0xce72955db50070a2, 0x56e5c91321c78b68, 0x888eb198999488a3}},
+     {{0x5255508c11c92f34, 0x9a346cf3a294d382, 0xd9765eea3095205b,
+       0xfea2ed702c470ef7, 0xf5e8a0fc9c40bf0a, 0xb572390ee4137a16},
+      {0xb91753712bf2f545, 0x2c2d0f4c58cd9cc7, 0xbea6bce902385486,
+       0x46208408a8bc3a94, 0x64a87a2a3ac45044, 0xe40da33c7df70151}}
+    },
+    {
+     {{0xee9e25d939161b8a, 0x8763f2a2e2eead91, 0xd2fc1157d2d91300,
+       0xe7597e2fffcbe50f, 0x4be3814fe11d376e, 0x1eab3d7edbf14562},
+      {0x38a107c0c0ad183a, 0x829766267c753bbf, 0x18014e09caebd481,
+       0xb28c331bf9ace60d, 0xe8fba04f211cb8e7, 0x41c4b797e42dc65e}},
+     {{0x009dc2f4c3e88580, 0x4a405be899db1fb5, 0xc89bfaa2ec5d91fe,
+       0x461be9a0f160afcb, 0xfdd084bb7d7566b5, 0x795275e8e48099a2},
+      {0x1b461fc9fe9815db, 0x576214cd73627bbc, 0x3246332d9f09a206,
+       0xbde4c0c36941d6ef, 0x44ef03fdf387f5f6, 0x99c8ac0157b63400}},
+     {{0xaa512f202f6e4301, 0xef668a5fbf94a1cc, 0x08713c3015861b88,
+       0x49d47551c99bb2b6, 0x6db5f812e2f0258e, 0x70c9b299998d7435},
+      {0x46168e1c5d176ae0, 0xec3306e4f730ec30, 0x49439df3ab69c15d,
+       0x1040408bea0143e4, 0xb48ab8eabc549b0a, 0x4aa38bbf10f89223}},
+     {{0x7e4851599598f49a, 0xbdac3d5e9629305b, 0x20de0dafa6fbabfb,
+       0x04f015838f09fff7, 0x5a0562976a06994f, 0xf51dac8f6e3ccd33},
+      {0xc087ef9c3af507b8, 0x525ab76e6a5c6663, 0x4fc04814d916ee93,
+       0x3369c978d23d140b, 0xb0fcd70f1662028f, 0x2ca77de2e1e28adb}},
+     {{0x838acd1bc512bc71, 0xac06d6bddc18afd0, 0xc991c1e39ec45f4b,
+       0x667c5e89cc27c68e, 0x0e059b04ed07f829, 0xceccf1d4cec4b3a7},
+      {0x3d9c2dc9b953f9a1, 0x4be2f7e72d599b16, 0x1a2054b197256c26,
+       0xcf66fa478b4fdfeb, 0x896cc1b38134d7ef, 0xa17264cad41dadbc}},
+     {{0xe3ccfe8e37627e56, 0x00733a867b6b21a6, 0x3f13e2cbb605c427,
+       0x5ee12395b0d80992, 0x4dcaea94b9991381, 0x4cfed7ee8c4c4b6e},
+      {0xd7aad54b7f7f45df, 0x2229407fb3809bf8, 0x6eb31eee68048fd9,
+       0x693842dfd57225fc, 0x3e62cd85a88dfd3f, 0xc6307d53d5462cf1}},
+     {{0x2d15615ef344f5fd, 0xe0ba6a8aa7f23989, 0xbbfc58041c84e3f2,
+       0x22ffeaae6f4ba826, 0x1e9bf27494292682, 0xc768f89146c02af9},
+      {0x894127d6177cdafa, 0x8d0523da2acdc791, 0x71ada9aedc78c3c4,
+       0xf21dbbb92c532a01, 0x0c797d5eacb20fda, 0x1ff99d7616cf57b0}},
+     {{0x99b5f150493c1d64, 0x3422b656fb74075e, 0xe7493900ff19bf24,
+       0xc82e5b80260925ed, 0x3398d340c0ea1eaf, 0xe7de2ba11287121e},
+      {0xea6dfb0b87847031, 0x73bed0a1566af2f2, 0xe26678bf12012999,
+       0xb5369e4d32e5cebc, 0x2304eac86d181e32, 0xafdbd9543d364add}},
+     {{0x5b1a53ca75da4189, 0xa90485802eb4862b, 0x319424092783ad6a,
+       0x15a4c5e11a9e025e, 0x841bc53313837199, 0x6e9d3e14e642954a},
+      {0xf4a02bbdd436ec5c, 0x62fe177bc6d6ad53, 0xedbf1e4eac86425a,
+       0xff9359c8d9f752f5, 0x79c685d92d7ad656, 0x8d82c0c4fdde9052}},
+     {{0xf55f868e702f640d, 0xe459aa9b1dedda11, 0xbec0ff9bbb5ba193,
+       0xf7325c4957724703, 0x5ab8f06323e0e4fb, 0xfbf02e91ecb0fd7c},
+      {0xcc72e8daa2e5fa31, 0x47de252832cb53cf, 0xbfa646e64252763c,
+       0x7a769efeb8d81de3, 0xf5ec70031e772f00, 0x049bea9a2729aa5e}},
+     {{0xe987ba54759090d6, 0x904d6901619ef08b, 0x9e16d1382024a6fc,
+       0xb6f0459ba9f3b7e4, 0x1f2a530817ee069a, 0x99403b2e2be31049},
+      {0xba1663c6bfb2f288, 0xf829195cc7a92b41, 0x89b915ee8ae621b1,
+       0x3fbbb1e150f8ea92, 0xb1fe7f978c901ddc, 0x16d1f62cbbc69ca4}},
+     {{0x51f19bb3fda072db, 0xa815459fe3f7e0a2, 0x5f7cde2f987112ca,
+       0xdc51d948759de2cb, 0x9d05c410ed49bd98, 0xf063ab99364341fd},
+      {0xd7869d68d1aa0a11, 0xc20291065d862d01, 0x7f258180c2591073,
+       0x7b90fc7a6ebc4ebc, 0x5565390f3dda1d68, 0xae77fca8a44e4493}},
+     {{0x97564e4847c49ee8, 0xc56bb5a9ab4ebef5, 0x80d969417b4f86bc,
+       0xa594b4e541026cf0, 0xd56c89965a89ece9, 0xbcf609316a0f922b},
+      {0x702596161103475c, 0xb1224fb58a2a2abb, 0x0a437a03715cd61b,
+       0xcbe2d2b2739921ed, 0xf3b1b5e9385541c4, 0x5d0984f4ae010520}},
+     {{0xb4a2742dcfd9295e, 0x9cd36774ae929cd0, 0xb15fadccdd7fcf4f,
+       0x0b1fa2b337d4fcc6, 0x242c7b26f01c7ab7, 0x2be8131b50574cc9},
+      {0x6ee50f42bd89a03c, 0xc7f6ff8f005e7765, 0x04d13af18420501b,
+       0xc22e092b1b6e7d2a, 0xa393be7ee9516f80, 0xa2593652b80bb5b5}},
+     {{0x5caa5da68b23bebb, 0xa1ad33e81fdbbdf4, 0x18dc93cf4e5c1de0,
+       0xc3e6addb5bd9e178, 0xf30d517e7cb8cd03, 0xbb84ce54f1abc417},
+      {0x0774b64c67699659, 0x228005b9b7d4a401, 0xd8c2ec5b80b2d3d2,
+       0x419c4cd93450ba7f, 0x520ae681789286a6, 0x24b67ea9aa8bcfbb}},
+     {{0x9e41b9b70f74808f, 0x2d835dae0c061bdb, 0x67e50c8cf272346c,
+       0xc98a5ef5def57493, 0xc2dea8afa02676fc, 0x59508de26ace4659},
+      {0xc2b707aada6cd733, 0x6c1f226a4be7bfb9, 0x5b580fa2a778c20b,
+       0x272c3a1d57af166b, 0xe47a64a9ca78ce62, 0xd12db7d771d35087}}
+    },
+    {
+     {{0xc20fb9111a42e5e7, 0x075a678b81d12863, 0x12bcbc6a5cc0aa89,
+       0x5279c6ab4fb9f01e, 0xbc8e178911ae1b89, 0xae74a706c290003c},
+      {0x9949d6ec79df3f45, 0xba18e26296c8d37f, 0x68de6ee2dd2275bf,
+       0xa9e4fff8c419f1d5, 0xbc759ca4a52b5a40, 0xff18cbd863b0996d}},
+     {{0xf6827150844eefc5, 0x002e82c44515ef68, 0xa46c8f55c51916c4,
+       0x98c3524b61ee081f, 0x5ab7f2c2ad64872a, 0x0b503ff07e555faa},
+      {0x802e0d23b4c58d29, 0x122890402fd917fe, 0xb56d19087af20d26,
+       0x8d619e216be50784, 0x10fdbb721372b851, 0xf2c1673e4935576e}},
+     {{0x73c57fded7dd47e5, 0xb0fe5479d49a7f5d, 0xd25c71f1cfb9821e,
+       0x9427e209cf6a1d68, 0xbf3c3916acd24e64, 0x7e9f5583bda7b8b5},
+      {0xe7c5f7c8cf971e11, 0xec16d5d73c7f035e, 0x818dc472e66b277c,
+       0x4413fd47b2816f1e, 0x40f262af48383c6d, 0xfb0575844f190537}},
+     {{0xd97a9b1451a135f6, 0x6d16aaf597b4df14, 0xc57160c254818818,
+       0x4dbdeab61d59be44, 0xb93a9dad81f2b247, 0xe2868cf5ecbcab33},
+      {0x5e1ce82883a86711, 0x29a9ca2f29c55428, 0xe716273a2d82b0df,
+       0xb017f5f6ac8ff52f, 0x7563e79970ea7ccd, 0x5fedf0a63f0e674b}},
+     {{0x487edc0708962f6b, 0x6002f1e7190a7e55, 0x7fc62bea10fdba0c,
+       0xc836bbc52c3dbf33, 0x4fdfb5c34f7d2a46, 0x824654dedca0df71},
+      {0x30a076760c23902b, 0x7f1ebb9377fbbf37, 0xd307d49dfacc13db,
+       0x148d673aae1a261a, 0xe008f95b52d98650, 0xc76144409f558fde}},
+     {{0xd084564baf907da2, 0x5b2ae48751d4997a, 0x24bd4bf63bc7206d,
+       0xdd37b4effc3d5772, 0x8156d6f635c4924f, 0x21e067c31d1d396e},
+      {0x977b3b39d40c7db8, 0x7ea4ecb4f5ad63bc, 0xe581f9c4ae811d70,
+       0xe5441d5ca06c7f0d, 0x0275c92b1949d87f, 0x511fd3e1780469bb}},
+     {{0x17cd6af69cb16650, 0x86cc27c169f4eebe, 0x7e495b1d78822432,
+       0xfed338e31b974525, 0x527743d386f3ce21, 0x87948ad3b515c896},
+      {0x9fde7039b17f2fb8, 0xa2fa9a5fd9b89d96, 0x5d46600b36ff74dc,
+       0x8ea74b048302c3c9, 0xd560f570f744b5eb, 0xc921023bfe762402}},
+     {{0xa7f8501488d7b3fb, 0x3b5ec513ec78386e, 0xc6586b8a2ad5053d,
+       0x88c09a43fbcebe43, 0xde7f2a4a20054f16, 0x63daba80bbbb147f},
+      {0x087e48f37d352b55, 0x997e32a08317ab79, 0x8ae802ff7f27cac7,
+       0xb01a131c37b1f6e1, 0x3f0d4c2e9a6d1dea, 0xe06114fce7ceef80}},
+     {{0xa35ab657fff4c8ed, 0x017c61248a5fabd7, 0x5646302509acda28,
+       0x6038d36114cf238a, 0x1428b1b6af1b9f07, 0x5827ff447482e95c},
+      {0xcb997e18780ff362, 0x2b89d702e0bcac1e, 0xc632a0b5a837ddc8,
+       0xf3efcf1f59762647, 0xe9ba309a38b0d60a, 0x05deabdd20b5fb37}},
+     {{0x1e2a4fb1e5ea795b, 0x862616a289ef6c3d, 0x24617f4ff69e2f1d,
+       0xe0be24feffa0eb28, 0x0ffb092f4b76a8ad, 0x215490903a0dc9e8},
+      {0xf255fe06e9080e04, 0xd270d25e39228e7f, 0x198e45db5d6c6f1c,
+       0x6c9060ad4373044c, 0x3af9346461a8cc25, 0x1945bf59f22bbaa3}},
+     {{0xd44e5dbacb8af047, 0x15400cb4943cfe82, 0xdbd695759df88b67,
+       0x8299db2bb2405a7d, 0x46e3bf770b1d80cd, 0xc50cf66ce82ba3d9},
+      {0xb2910a07f2f747a9, 0xf6b669db5adc89c1, 0x3b5ef1a09052b081,
+       0x0f5d5ed3b594ace2, 0xda30b8d5d5f01320, 0x0d688c5eaafcd58f}},
+     {{0x311df84c359590bf, 0xf907d69ddf6ca4b4, 0x876fd36782f22c64,
+       0x64c4d14d9713e68c, 0xd431858d6b07f539, 0x39dfea3384990283},
+      {0x6afb8cf080cf6498, 0x327056bcde060e9e, 0x5103ce4a49a71086,
+       0xfc94be75cdf853ab, 0x2bfb105f8ca579cd, 0x02d19c3a50454b41}},
+     {{0x5eee3a312a161074, 0x6baaae56efe2be37, 0xf9787f61e3d78698,
+       0xc6836b2650630a30, 0x7445b85d1445def1, 0xd72016a2d568a6a5},
+      {0x9dd6f533e355614f, 0x637e7e5f91e04588, 0x42e142f3b9fb1391,
+       0x0d07c05c41afe5da, 0xd7cd25c81394edf1, 0xebe6a0fcb99288ee}},
+     {{0xd9e2c5ee7d4867b7, 0x2c5602e087873152, 0xb3358aa62c06b73a,
+       0x967aec3909063076, 0x94dec534d2f654fc, 0x119aa4edd69f485e},
+      {0xb7c597b835bc085d, 0x8781396dbdbe0d0c, 0xba68892922f92ef5,
+       0xeece3d4ed438f5ec, 0x4ead06f844faac8b, 0x86a01ba99ef7c5f1}},
+     {{0xb8e63b7bbabbad86, 0x63226a9f90d66766, 0x263818365cf26666,
+       0xccbd142d4cadd0bf, 0xa070965e9ac29470, 0x6bdca26025ff23ed},
+      {0xd4e00fd487dca7b3, 0xa50978339e0e8734, 0xf73f162e048173a4,
+       0xd23f91969c3c2fa2, 0x9ab98b45e4ac397a, 0x2baa0300543f2d4b}},
+     {{0xaa03b474cde121c7, 0x74a648cb55e52c76, 0xb286ef86f37b57bc,
+       0x95b797eb2a6371d2, 0xa489ef894077ccbd, 0xf46ade048e99ca6d},
+      {0x5cf9e23723242d03, 0x33c7d32acb708390, 0x329523b6ba7ba477,
+       0xd406ab8757de30bf, 0xaa10e4a21536ca01, 0xdcec94f4dfa7aac5}}
+    },
+    {
+     {{0x762a5eec1f5a9609, 0xfe4f5f6a765b337f, 0x0fd534aeaa4f964a,
+       0xcf46648ed6526f01, 0xbc62a54a18d71d72, 0x48d94f2a4f8488ea},
+      {0x62c40de7a0c72a86, 0xd73ac51a725dd2ef, 0x3a51d7466ab19096,
+       0xf07bea4b2dd1ad3d, 0x2a0ec4672ef88078, 0x92598cb3664e435d}},
+     {{0xee6e7006b515fff5, 0xaedf6e3913258ed5, 0x373adf7dfc45111b,
+       0x0c7535b1875c23c8, 0x2a7e04f897039d49, 0xd76787ae9afd1a06},
+      {0x049dd38591b6dc89, 0x8f0c8ad0932dab78, 0xdce057b9925498c2,
+       0x7b9c9bd2da25daa3, 0x6d0b70a3d4decb7d, 0x099a218303df76ef}},
+     {{0x779905b6d8948f95, 0x3c7085b591cd0206, 0xce9af0aa679096db,
+       0xfdf04f10f558913c, 0x05300cb06f24a2e2, 0xf9d9a2f25d581b35},
+      {0x855c8de96a713751, 0xc9ac24bc0e0c0dfb, 0x67612a4197740d65,
+       0x7588a52744c9360d, 0x928ac910325cc880, 0xa74abdafacdd3188}},
+     {{0x3c6c5618b9d926c2, 0x7e14c3ae4a9099f9, 0xb3259c90ae2fb830,
+       0xf7cc6e43ec31a504, 0x83bb13c6126230bd, 0x5a1f4313ff1dae3a},
+      {0x0cc6c1a549b0b65b, 0x67fa836a274a84c2, 0xd454c75fe604a58d,
+       0xceadfd912491f872, 0x6c5575da9ce116a5, 0xfaa4903fb24a4481}},
+     {{0x7a8a898d5a4703aa, 0xc59933ea1cd6f9d6, 0x703265f5d28124cd,
+       0xe1c1bee10178d1fe, 0x9ff31cd4241262e9, 0x9174a939a3c9f80f},
+      {0x0f7a3d2dbc2a62ee, 0x0454051c62f1b3ac, 0x83502c9ea2421254,
+       0xb4fa51fcb684199b, 0x257e9e2bc5e36a44, 0x14efeed597d8647f}},
+     {{0x6e96a8195cecb21f, 0x3a58d8b2d8beecae, 0x93c3cbb0c0c715a8,
+       0xfb06f977541759b7, 0xf25ba095771c3d2c, 0x7560446ea3bfd322},
+      {0x7cd99f35a015cb4f, 0xa0e541960786f235, 0x0f868f768b8e291a,
+       0xc8260b0b2f95050b, 0xaf38376ef4c0a462, 0x2b3c0f3b98a3395d}},
+     {{0x0952b888b9d0bdf0, 0x3973763c8ce32fb7, 0x221f0ba56dd860c7,
+       0xbb7a27feb16ac501, 0xf113b194bc8fe58f, 0x18f3297a65839ffb},
+      {0xa2d4eb7c8dc30003, 0x3fb4b4878e334479, 0xa4f32c651a8310e3,
+       0x944cd644f78f46ac, 0x14e40c4af96fb91f, 0xc31402bd4ddf6e72}},
+     {{0xc5ad791eb45a8002, 0x4a23fd68ba2d7a40, 0x673b9e4998544bc4,
+       0x934d8f55d273c360, 0x7fb48d0768a75a8c, 0x2e6201055e0fac97},
+      {0xbe01655ff10ed580, 0xd21d52ae9e96731f, 0x74f830de53325138,
+       0xa7240331de9f3fc5, 0x96b25206a7e01fa5, 0x3fcfedee07eda4b4}},
+     {{0xf1b08a429336b8bb, 0xbaaa55719a768ca6, 0x70180b4c2c0a2938,
+       0x8e73543692dd3c07, 0x2dd3af0be3fd5b1c, 0x3cf3d1791f1af8b8},
+      {0xaff210c6d558c174, 0x1007938ae2560d5e, 0xa625558c8f99a78f,
+       0xa61d5edfc1b91dea, 0xa86a4e5bdab80815, 0x88944bfe78283ea3}},
+     {{0xeec9b1180ee6d492, 0xf2bd388fb7ef00fc, 0x5c6c0bbf3191c902,
+       0x6796929ad42366de, 0xeecb5b3f3285710d, 0x58d6773d41bad8a3},
+      {0x7cdbade6d0f05005, 0xb117e1ba0e25444b, 0xa52b4926fe4dc071,
+       0xce8a1b69e0669f10, 0x5e7654390db21d46, 0xc5dcdea4d929bfab}},
+     {{0x67832f48a36aea84, 0x25256118fc78df1d, 0x5a085d7003b8f04d,
+       0x19a25d9c108969c2, 0xb6fe713bb70b14b7, 0xba23ac4afa6b89d8},
+      {0x6a88e4e7c2684b8c, 0x3e8166096ab59297, 0xdb7927fe30151aaf,
+       0x0fd67681aa7d95da, 0xc60e5dd517432b4c, 0x3192dc27ed48ccda}},
+     {{0x2116a0178af859e2, 0x8a77a7a2bd9f8800, 0xc78836fbf1f2034d,
+       0x8fd4299a3864566b, 0x0386eead29f9deca, 0x2042ef182f1a677c},
+      {0xed4511c02af95cc8, 0xdb0a334dc93dfbc5, 0x0d788ac9b64ab345,
+       0xd8410402b20638f2, 0x8aca5131592448e6, 0x3ac508d2000de69b}},
+     {{0x1ee6d3b54f9b2400, 0x4c71999a00c9c182, 0xd6b1c47035fc481e,
+       0xf41ef454f8b5d59c, 0x7edbc3c92824a13d, 0xa3baba91b7aa0ade},
+      {0x75c77e712b97b392, 0x8ec107d69cc2d53c, 0x652146fe29322233,
+       0x710578dfe679e990, 0x47f838ba260547db, 0xa4e57bec23a78365}},
+     {{0xe4320313efb058db, 0xaad2377c3d04e752, 0x3f8cbca99865c63e,
+       0xe89238a53009e55d, 0x58fad5fe12519936, 0x03b16a00b024b695},
+      {0xa556d096f8f3b8c7, 0xce6df197d8a599c4, 0x45ac8a256a13b031,
+       0x31af2dccca6819e8, 0x7a4dce86390418e9, 0xdd24b0bd4600d7f4}},
+     {{0x88a8aa87b96e667f, 0xb9a76c184e704eaa, 0x25d4edc172c924b7,
+       0xe56872a816b67f80, 0xda0dbb11c464e4ff, 0x0435f391c8cec410},
+      {0x8d9b40430983fd7a, 0x51ec5bc1e7ff343c, 0x8bc85fc485994bc9,
+       0x69c788348806c150, 0x542cec893db3665b, 0x931bc4b0fd720bde}},
+     {{0x3e6e93818d5c039f, 0x809494228a8d2cc9, 0xf2d7c8b4b843ec06,
+       0x0055d882af8a23f1, 0xe848010ed3792335, 0x9b41a55f55e08e74},
+      {0x956ea8e95de83059, 0xf159a9973263678e, 0x5f7b9271cca1b548,
+       0xd41d2281f1d0b7f1, 0xb187047b5c9963fb, 0x213ff6af02536cd8}}
+    },
+    {
+     {{0xe51a95700d0fa76c, 0x67c7890e4d2e9c8e, 0xc6160fa2f974d2cb,
+       0xe00474f74c6a78de, 0xee916e510ac89d11, 0x1adad97af826f133},
+      {0x3fc65d3f8d2d77f3, 0xda9420750ba6c300, 0x5237a82e0b9196b1,
+       0x4975e680a572b6f5, 0x41ea8b92b9bed2bc, 0xbe0ad7109826825e}},
+     {{0x8a390dca9fcaba39, 0x3879f0b4278d22b3, 0x77bbea69bc5e82f1,
+       0x71f02e2d4628d6f1, 0x6260790cf968e240, 0x1c7f3df5665270ee},
+      {0x336395451a87b1c8, 0x2011fd214ffd9fb8, 0x69060f867807ed55,
+       0x1b0ac0119dfa452c, 0xbbdb25fe06d27c0d, 0x5c25d23aa60ef90c}},
+     {{0xd3eb69e4734b2e9c, 0x1c2754e2c35ff1b3, 0xa26681e69f3e8c51,
+       0x7892ad11a2cae737, 0x88b1da43cbd8bda6, 0x8a576942419d21c4},
+      {0x7c124343c90f4545, 0xa5a8d93b26453bae, 0x9a4c08fd76ae72e8,
+       0xa08b82d97b064e94, 0x4f803ba083725330, 0x33672455865235f3}},
+     {{0x1877dfd0c8110f1f, 0xea88f59d18db27c2, 0x9d089536c78e295e,
+       0xcbb5d55374a04cc5, 0xe3666006827f75ed, 0x8557b81a61e7378c},
+      {0x74170170ed223f48, 0x84197a6ed86ee829, 0xd75a30f8ac1c4a0f,
+       0xd7e7be0d3cd92824, 0x5ea0abdb1b5e86d4, 0x41146ae1b3b615ef}},
+     {{0x570deceb1ae5e9da, 0x5c079c70b73ead01, 0x522a30a6d2ce6639,
+       0x71dc5c3ff4056ac9, 0xd93c7a2dbaac149f, 0x5c3298b8f1844ceb},
+      {0x282adf408c23c0dc, 0xbe4981899b646f86, 0xe77c1950628da9e5,
+       0x38cc27baa1fd5a18, 0xb5579728aacdca52, 0x8d34fdb4c8e1ecbd}},
+     {{0x323f2102adea7d6a, 0x035b354eb694b253, 0x66dc4e4a5b8a36c2,
+       0xb609222471795ca4, 0xd8c6d7eed300d80f, 0xf31f258db3b94954},
+      {0x0f2eb679277ced5b, 0x0b16efa3eba40e3f, 0x400035070dca4f36,
+       0xd34c91cb59a9a3a1, 0x5e8fea3286da6408, 0xf237959f03f31728}},
+     {{0x1b5bc630bbaaedc6, 0xe7d25088b49cbb3b, 0x5622cbf70deb8cf0,
+       0x3b20803cd309c3ba, 0x64c2e7deff45e2fc, 0xfa730ffb9aab84a5},
+      {0xba83cc514edfb52e, 0xe05c0140748bbd69, 0x27bbb5f52254ec43,
+       0xca740989324c8c40, 0xa21488b1d26491b4, 0xe2753a1f69d8626b}},
+     {{0x618ca06b8956146c, 0xd51f1e6f552cdecf, 0x981372cca3b6ce7d,
+       0xb44a68ee5f14bb57, 0xfc1167e96373abbb, 0x3d621f8b767d4c0a},
+      {0xc6dcdfebf6ecc778, 0xddda926282d1fbdd, 0x477501aabfcbf2f7,
+       0x0be7228a67aa8277, 0x5de7b8331daab9cd, 0xb88a4f9a262feb4a}},
+     {{0x28f18586936fb33f, 0x9809b2ab381bf7bb, 0xf6e16931eac3c252,
+       0x366d18335e151187, 0xe5b4c2357a3b6460, 0x693a9fa50a68bc91},
+      {0xa35f104a6a7f8b6e, 0x3e5d6981688676c4, 0xc0c081b10651a609,
+       0x6df5da2dd77057c9, 0x8bb271bbc4602847, 0x322547b3c4bd07d8}},
+     {{0x8c283529233d39e4, 0x96300796c6092096, 0x2c549de55dde766c,
+       0x27e0b444b4151002, 0x802e5fc3f2f88f1b, 0x2af579c28ba1956d},
+      {0x52edd04ed68196c7, 0x2e22e71474a202b0, 0x338948248bf66459,
+       0x8f0d8c259e39df55, 0xee4f109e6c5276d9, 0xc0c893f0c5dc0bf0}},
+     {{0x06054c76f8482849, 0xc24b4a6a5fcca65d, 0x71c27e01a17ebda3,
+       0x1ffce0281be9dfb8, 0x3784c950ebc43854, 0xcf0ecc2dd5086510},
+      {0x86d0fc3cbe24d8eb, 0x5bad01911f21788e, 0xe2c3bcb9c49b3a12,
+       0x66f82433f7d5992d, 0xf7cc5eb913969246, 0xe52defd48660a6da}},
+     {{0x7a9623b653fd1a04, 0x13bd35bf3a3b8500, 0xf8a5dec9e0f8e530,
+       0x88bcbe291d65dcd4, 0x09fe38036739541c, 0xebd04b7fe716a97a},
+      {0xbd8e34df1e5ef7cb, 0xddfc4243d7c4fd6c, 0x0183d9053519411f,
+       0x63450996f7a3c483, 0x18283cea01355739, 0x8c1d72cf9aaa72f7}},
+     {{0x551e1b4e8dc72468, 0x8a926cb2a7b2f1ac, 0xb873e83b0fd12fad,
+       0xb6cde14fa4e7fb13, 0x81ae41415befc256, 0xffb0c636b4c7631c},
+      {0x80f1408f8a2478fe, 0xde6d051d44fa7605, 0x5a15b1f84d44a1e4,
+       0x1a0031c5a0daafe3, 0x304338dd597652a7, 0x6830dcc7f257f17a}},
+     {{0x4a67ec76193aabbc, 0x3da6dec6d74761f9, 0x751720c90b35bb70,
+       0xe5e049058d9e0f8b, 0x3cd37c840858f29c, 0x7ff1abfbb881733e},
+      {0xa0c2698b0c4f7694, 0xc736419296b95e4e, 0xcfa55c5537ece651,
+       0xa2bbd6ae7cb1e9e1, 0xcd2292b9a0eb0e8a, 0x8aba99e18d5030d0}},
+     {{0xb7c74c58dc4a1d3e, 0xe3ec30160331ea39, 0x83afb271023c8712,
+       0xc2670d56c9c82680, 0xd426f350feca1061, 0xe8aee692ba6edc01},
+      {0xc916fbe546e801d9, 0xcb001c377097286e, 0xfcf79d2678ee1328,
+       0xb05b0634b6a4afb3, 0x2ab327bb306da14f, 0xc11a0294ba5ff534}},
+     {{0x7b7da028e19763dd, 0x662f54df8b98ff78, 0xc056d83c51f3dbd9,
+       0xe2f4d46fa91d085a, 0x31759c9ceb35262d, 0x624d0cf20c9dd29e},
+      {0x108cf9bb1624b02d, 0xa241444e345531d6, 0xf69816b273d372b2,
+       0x126575a7d5415e53, 0x546bb4c1306b8b0e, 0x82bb0c124d54ea5e}}
+    },
+    {
+     {{0xdaa7fcc9f9474bb7, 0x3c82e74bafa5db2a, 0xfbf918c59894edce,
+       0x470c45eda9ac29a7, 0xdfd44f6fbc372f2c, 0x73a4790aa1e38d3f},
+      {0x23d2400ba9674837, 0x3dad71bc136a92da, 0xc76a488148baa4ab,
+       0x73227e4ebc26e6b0, 0xe732edcfe8ef5662, 0xfe96aa5f0c5662bb}},
+     {{0x87c7dd7d139b3239, 0x8b57824e4d833bae, 0xbcbc48789fff0015,
+       0x8ffcef8b909eaf1a, 0x9905f4eef1443a78, 0x020dd4a2e15cbfed},
+      {0xca2969eca306d695, 0xdf940cadb93caf60, 0x67f7fab787ea6e39,
+       0x0d0ee10ff98c4fe5, 0xc646879ac19cb91e, 0x4b4ea50c7d1d7ab4}},
+     {{0x7e047d9ce2fdc88b, 0x4f6166d9715be007, 0xd9661068d0debb0a,
+       0x82f02fd3c3dafce2, 0x41a6b64400f8df79, 0xccd5a7986cedd3a8},
+      {0xb6617354f11431b2, 0x116d02748a677e83, 0x2f39939089ef485a,
+       0x3ee068625e2270d2, 0x8c9a70de06d6c72f, 0xd7e691774e4497e3}},
+     {{0xcfbcbc4a7db62b5a, 0x2919bf514ab45dde, 0x735de05622322f91,
+       0xd2590bda7662ae23, 0x63d468fed82be7a6, 0xc84d0435695ea172},
+      {0xc50f494120a6fccd, 0x2d613990620f44f1, 0x680ccd041fd25778,
+       0x25ddac444a3d0808, 0x41d8b738c4684cba, 0x2611645f53963888}},
+     {{0xffe6bb22e9f43747, 0xf387957b22f6cd09, 0x3eb09302607a4892,
+       0x52c733a8f3d2f552, 0xcc935b2e741bd215, 0x5fff37e31ae0b28e},
+      {0x4234e33cc2e9bc20, 0x4ee1488e39ea2555, 0xb8821daf17156a8a,
+       0xc7b458441af16ade, 0xc1009ec75b4fa74d, 0xe0262e655d7cf8bd}},
+     {{0xb05cb834b0279be5, 0x2de7d0ebf08c5f93, 0xf023b5aaefa9e4f0,
+       0xb8061e5d9bd075ec, 0x7d2ba50f1aa41bfb, 0x8963f3e390865d96},
+      {0x7f221a794713ec7a, 0xc83bc5178500b4c3, 0x085feb6af6ab1540,
+       0xfd141024dc87cd93, 0x3e196fdb3239dbf6, 0xb7cf3e16dbcd5364}},
+     {{0x72544edb41a64252, 0x5f3d376fa6fe493d, 0x17ae424fd635df1e,
+       0x69cb55a0df598c63, 0x31297f4a6ce0f1d5, 0x4573bb7d1bd11b61},
+      {0x1d8a65c145a1e918, 0x2729ab25e5dc2e63, 0xa3dd0df03ecc307b,
+       0x4856546f952019dd, 0xf8d39888c784e4fe, 0xdc6732c70043b09e}},
+     {{0x1466c9f5e03a2fb4, 0xb866c006862a58a2, 0x291e8c75b5865550,
+       0x1ddb7154e65862cc, 0x285153bc2b997167, 0xe2fce0e7954b6c19},
+      {0x985d450616dc2937, 0xf7f14216ee41d9c3, 0x39e098dafa5fe5e5,
+       0x3fc26046f90f231d, 0xde5d5ced32afd0b5, 0xad688b1d60c09c18}},
+     {{0xefd9aed08f84e987, 0x5ee0c707ae8c8308, 0x4c8a76532aafc403,
+       0xfafb60cea232436a, 0xc641294d9934f053, 0xc673e5b230310529},
+      {0x3c8fa99a9066469d, 0x5626038b7c09af37, 0x6ffd8f9babd66748,
+       0x21ced048cea58a67, 0x310712131496d048, 0xfa575242a9c28d0d}},
+     {{0x3720b1720f806b59, 0x1f696d47f224597b, 0x03c46e315b54eefc,
+       0x387e466472b0edaa, 0xfc59b03dee77476e, 0x86854e54607a7259},
+      {0x1478bcee3e9320dc, 0x4aa825a88c9d87e4, 0x71272f72cf272ee0,
+       0x19e3a4a38bd885cd, 0x9af6415b376ba31c, 0x6394b5a7807b2b36}},
+     {{0x1bf6c56b77460193, 0xd6f7fabf5666ae6d, 0xdf677909e3e839d1,
+       0x9124d34108cb9984, 0xbb6b591d86a0c7c3, 0x4bf334238f527a6a},
+      {0x7d13779026941bfe, 0x15a0b541cf6e4481, 0xdf833b87124d5b9b,
+       0x85827dc5a7fdf95d, 0xf05a2c4549e520af, 0xfb506d5391e0645a}},
+     {{0xdbfcfa75e572e06d, 0xafa019d08b7d5653, 0xcc6c851d67a19b60,
+       0xace88bf431ae1a67, 0x74554a6193d1e135, 0x51ba2cdd4211890a},
+      {0x7cb326899e8d1f02, 0x29a6b8258b66ab99, 0x0a672c21766e72f3,
+       0x24bb718a880642e3, 0x425dc41d184d2b36, 0x96a1468e891024ab}},
+     {{0xeff22b64665fe173, 0x38efdef6ef2eabea, 0x8a1f379121a309df,
+       0xa9cf02cf2431e2ed, 0xf38507dc1d939394, 0xf116b08582fc3178},
+      {0x4c5460dcc7571366, 0x99efd9dd978495fd, 0x5159dd41f26e347d,
+       0x692962cee97ee9f1, 0x1e2f3af26a288815, 0x03512344a71ade78}},
+     {{0x3180789c26df7050, 0xe375a43e96cdfd31, 0x7951b895e99e922d,
+       0x987ea2503d0bbe80, 0x6d2f49f0e2fe79c0, 0xc9c2c636c2b18d2a},
+      {0x707798f3d8c8620c, 0xc2d603dad5c6a0ee, 0x46cf1e32bc447940,
+       0x4dfc145938a845f3, 0x210083fe455e5d92, 0x6be989eaa1fedc3f}},
+     {{0x55d4fdc39f019162, 0xa8222d08f1ec4585, 0xd987e3eb3a0ae4f9,
+       0x07deda59a9c7a693, 0xc06567d9f04ee53f, 0x9394578871364c4d},
+      {0xbb2a2422baa5bc16, 0x89574a5dbfa3931a, 0xf09b331ef300f081,
+       0x644de9b71a0ff82b, 0xae023ce4a5ecdf9b, 0x5b67cf8bc1907aac}},
+     {{0x72fc8198dacc038c, 0x5fdae1d9f1077bbd, 0x369198bbd99e3036,
+       0x6b68390a0efddfca, 0x8c35f3e4f0914741, 0xd2bc54ecca7d7807},
+      {0x564d991e3a8695d1, 0x5e1e14c81b0d937d, 0x51f30dab5d635893,
+       0x0427e346f944e49a, 0x1e0bf1b56a233bc0, 0x75b0ee6c617bf93e}}
+    },
+    {
+     {{0xd23658c8d2e15a8c, 0x23f93df716ba28ca, 0x6dab10ec082210f1,
+       0xfb1add91bfc36490, 0xeda8b02f9a4f2d14, 0x9060318c56560443},
+      {0x6c01479e64711ab2, 0x41446fc7e337eb85, 0x4dcf3c1d71888397,
+       0x87a9c04e13c34fd2, 0xfe0e08ec510c15ac, 0xfc0d0413c0f495d2}},
+     {{0xb097b2c5c4e81268, 0x7ef175521d50ca8c, 0x638266e942099644,
+       0x43d059deff729073, 0xeebb5fe1148c3940, 0xb82e73d1daa8e925},
+      {0xf43c78d8254380fd, 0x2beabc58fce37fa0, 0xcdd5a7d66b636357,
+       0x8b70a2ebe096a954, 0x011d5419d0afa2fc, 0x3e49eb6704fb095a}},
+     {{0xeb05c516156636c2, 0x2f613aba090e93fc, 0xcfd573cd489576f5,
+       0xe6535380535a8d57, 0x13947314671436c4, 0x1172fb0c5f0a122d},
+      {0xaecc7ec1c12f58f6, 0xfe42f9578e41afd2, 0xdf96f6523d4221aa,
+       0xfef5649f2851996b, 0x46fb9f26d5cfb67e, 0xb047bfc7ef5c4052}},
+     {{0x88e7ac8e168d5e60, 0x53abd5696188a98f, 0x3b96d52918be419a,
+       0x7e75e354c057621c, 0xcb1b709f5ce57e59, 0xe78befa2844f2463},
+      {0x536081993276d4a0, 0x92636ade157f2024, 0x6dd0d348e0411414,
+       0x5b28e9504d73eeae, 0x08439232690ed85e, 0xdde1a3496da14b58}},
+     {{0x5cbdc442f4484374, 0x6b156957f92452ef, 0x58a26886c118d02a,
+       0x87ff74e675aaf276, 0xb133be95f65f6ec1, 0xa89b62844b1b8d32},
+      {0xdd8a8ef309c81004, 0x7f8225db0cf21991, 0xd525a6db26623faf,
+       0xf2368d40bae15453, 0x55d6a84d84f89fc9, 0xaf38358a86021a3e}},
+     {{0x10520b2733c12f53, 0x97d4ef439286a1f5, 0x12468ef88948f78b,
+       0x40a9d27550ad452e, 0x5e382347c1c48470, 0x5cd739fd33e73ace},
+      {0x7d83d02f1041f8f3, 0x32642eb0e314ad92, 0x6716d448885679e6,
+       0x0e12bdd5fc95919c, 0x7da4420492c2194a, 0x78956db115ffcd2d}},
+     {{0xbd048bdcff52e280, 0x8a51d0b2526a1795, 0x40aaa758a985ac0f,
+       0x6039bcdcf2c7ace9, 0x712092cc6aec347d, 0x7976d0906b5acab7},
+      {0x1ebcf80d6eed9617, 0xb3a63149b0f404a4, 0x3fdd3d1ad0b610ef,
+       0xdd3f6f9498c28ac7, 0x650b77943a59750f, 0xec59bab12d3991ac}},
+     {{0x6cbd275739ed9ec9, 0x5db68a68fe5d4aa8, 0x177eaa0be4c58c7b,
+       0x603551ef0e488784, 0xc8eba131df916b0f, 0xd0dbceda159732e2},
+      {0x55acca84b0834afa, 0xdbe98440b59ffbf5, 0x162a2c703bd3b202,
+       0x4c5e5d256ddd8eba, 0x66e7844a77b1d93d, 0x1292bc0e110b9dcf}},
+     {{0x01f40e882e552766, 0x1fe3d50966f5354f, 0x0e46d006b3a8ea7f,
+       0xf75ab629f831cd6a, 0xdad808d791465119, 0x442405af17ef9b10},
+      {0xd5fe0a96672bdfcb, 0xa9dfa422355dbdec, 0xfdb79aa179b25636,
+       0xe7f26ffdeece8aec, 0xb59255507edd5aa2, 0x2c8f6ff08eb3a6c2}},
+     {{0x34a4632c9341a2e0, 0x05ca421bc525bc5a, 0x441cf2eb4ae3284a,
+       0x1a57684e146012ab, 0x23a52ee330acfd0e, 0xc3f4d94a7d29e389},
+      {0xfbd4d48eb4154640, 0x2352e791af9ec396, 0x45813e8e7327caee,
+       0x977f7a08d9db7e81, 0xbe55b6305f53d15d, 0xee182ac66a23f0dc}},
+     {{0x88887756757d6136, 0xad9ac18388b92e72, 0x92cb2fc48785d3eb,
+       0xd1a542fe9319764b, 0xaf4cc78f626a62f8, 0x7f3f5fc926bffaae},
+      {0x0a203d4340ae2231, 0xa8bfd9e0387898e8, 0x1a0c379c474b7ddd,
+       0x03855e0a34fd49ea, 0x02b26223b3ef4ae1, 0x804bd8cfe399e0a3}},
+     {{0x22723fa37cdc2211, 0x1d33923231ddb2bd, 0x63f354c146626fe6,
+       0xd0f68526f67a4257, 0x79aa889b8d3d00b6, 0xca5fc8a70de4c413},
+      {0xe311a966d2879266, 0xc8d982fe5f21e1dd, 0xc51f1604cbb159ff,
+       0xb449deb8092d83ce, 0x4a5f68f8644fd0be, 0xeef3fa4dbffb0088}},
+     {{0x11a9f3d0de865713, 0x81e36b6bbde98821, 0x324996c86aa891d0,
+       0x7b95bdc1395682b5, 0x47bf2219c1600563, 0x7a473f50643e38b4},
+      {0x0911f50af5738288, 0xdf947a706f9c415b, 0xbdb994f267a067f6,
+       0x3f4bec1b88be96cd, 0x9820e931e56dd6d9, 0xb138f14f0a80f419}},
+     {{0x2b4056a43b32932e, 0x1c74deb6bd8a1cb8, 0x09601843b181b5a0,
+       0x50a92353dc6a92d8, 0xe86c022c2d6f4331, 0x0d9671dc3a3ae821},
+      {0x3d618a20c8228d82, 0x20e809c1a5292169, 0x3b2fe5e73803f840,
+       0x1f2978e9416eb670, 0x44dcc410c35b795c, 0xbf5065c0503ce975}},
+     {{0xa11a1a8f0429077a, 0x2bb1e33d10351c68, 0x3c25abfe89459a27,
+       0x2d0091b86b8ac774, 0xdafc78533b2415d9, 0xde713cf19201680d},
+      {0x8e5f445d68889d57, 0x608b209c60eabf5b, 0x10ec0accf9cfa408,
+       0xd5256b9d4d1ee754, 0xff866bab0aa6c18d, 0x9d196db8acb90a45}},
+     {{0x1b66faabf9e89bea, 0xc81c5ddc3a441284, 0x1a82f3a0a675f7c8,
+       0x82884a2f30313a71, 0x7ac5d7b058aea9e6, 0x1954f075cd5ff05d},
+      {0x7c29638d6178d270, 0x6af7f8ba19381929, 0xe85e3c47a17ae3a7,
+       0x91b107c77009e38a, 0xf3b777d8f1f9c52e, 0x5b7b74ff11b688a0}}
+    },
+    {
+     {{0x4ae3d232c0385874, 0x83bda9e6cbf96d2a, 0xba73c769ec62fd6a,
+       0xd586ba7f62a4720c, 0x6497cd140cc1f491, 0x8b012b707b2ac571},
+      {0xa65eabb6268fd705, 0x8caf100a1431873d, 0x25b31b84231457d7,
+       0xcab62f75901645c5, 0x2377d74db2f7b656, 0x4008277c2d33c95c}},
+     {{0xaae2f448ed001c43, 0x08ad1d9bcf4be493, 0x3262b2f482c1f372,
+       0x5521febd351a5f7f, 0xf8ec9190916c75a8, 0xf3c258c72728dfb8},
+      {0x5dd4ff4f8af19574, 0xefddf5795d076b1c, 0x318b5b98ba8b777a,
+       0xd971d426fb7f8409, 0xed1465e8b0fd31db, 0x80d24d4300f66347}},
+     {{0x5ba5288c1ae586a2, 0x044f1fc61b715821, 0xc1a9a997602f3c65,
+       0xc5c7512fe08c0223, 0x48a19c3c367e6f1d, 0xa9f2195dfb241597},
+      {0x9f674a5fb5ba32a6, 0x275a060f0a312742, 0x5aeb8c4303d6f13e,
+       0x0fed575d917433fb, 0xe4a5ef9a59f53490, 0xa9f86145f315e616}},
+     {{0x315ad7a47e5a59f4, 0x1c615bfc543c8b00, 0xe12f97a8baa56473,
+       0xf263db4446edcfcb, 0x47cf91d53c1a968e, 0x1a1165b4c15db875},
+      {0x5d35e53a3479616a, 0x649f87b45c59958f, 0x5d3d11ea246da3d3,
+       0xc1ddfcc653f06820, 0x8169d7116610c00f, 0x15f16ba54bddc8c7}},
+     {{0xcf19fb2a1e548ef0, 0x8bb6dfa0cc694171, 0xeb1668ca5c5e390f,
+       0xf5a3485be1975263, 0x4edfc596442cc850, 0x9901f447f9627d74},
+      {0x3a6b85c984d0413a, 0x1466366167de639c, 0x9fc9fdcf11705bbb,
+       0x6d066e2bbff2cf80, 0x38dedc2fdc3026fd, 0xad533a981b828538}},
+     {{0x6c75bc93b7bfa29e, 0xf86f22b218ef6d69, 0x90ce6a1536dcadf2,
+       0xf11f711c7ce50921, 0x0739ceda38a479e3, 0x840b825e6ec3dbc6},
+      {0x7c36c0a59fa23481, 0xceb61fd170cb186d, 0xac6f7d3c26e4754d,
+       0x4076d3b5f317b385, 0x52f1bd723fd9e9c7, 0x6649d8b6bf316043}},
+     {{0xdc2870f8243cfbd5, 0x000b71b31ab496f3, 0x53511a3f708f4507,
+       0xbd7bd0381949d835, 0x723a007d938f4db6, 0x5bc8679e2d04e9fd},
+      {0x51ca5fd176ec7fc4, 0x86c4205c988f354e, 0x9042e76b2a0a4a90,
+       0x368f52a84ad44d2d, 0xddc2cab8912edfb7, 0xde74ccf5cde80199}},
+     {{0x8002f4583e455a61, 0xafbafd375bea205a, 0xa8ced112fb93f735,
+       0x27cb6292196e3084, 0x72395bdd77e8c744, 0x02e018d8ee71f5ff},
+      {0x7cfc14d9c1337a1d, 0x94e14c0ad7b4d86e, 0x66e50129d213738e,
+       0x7a905d91bc0b5ea3, 0x92cb630afca06700, 0x65e06d5cbf3a0821}},
+     {{0xa81e4a4e55c2369d, 0x394de01b60a0f544, 0x22acfd07a8906e17,
+       0xf59b37a6cc9bc4d0, 0xdd16a22c7ffec12f, 0x07decc2ad5976455},
+      {0xc5019463abe1d122, 0x2bf0ac0ce318c92c, 0xfa50280ab2bfc47b,
+       0x53354fc5c7cf8bff, 0xaea1d293e20ca341, 0xec25ecda8b626244}},
+     {{0x313b66cafd8ba33e, 0x10bdb130fabe27dd, 0x1181334c125e2b8c,
+       0x0f4f198fdb6f94ba, 0xf7000076ac3f5de9, 0x1a78813d9d6402ae},
+      {0x3427f75dc8a9e758, 0xcdac8b34b01f791f, 0x922c36d12a9ebaf5,
+       0x195ea05fb0487cc4, 0xe33de901a808baec, 0x15e1d5ac57291d89}},
+     {{0x4e2a05c1c21cdd1f, 0x8a232097dd46e76a, 0x8b55313cd871b1d6,
+       0x976ce5f6af396bc4, 0xeb91527dafd381b1, 0x6cfd449014455ee2},
+      {0x8723be9e1f274d1e, 0x1c63fd011999fa9f, 0x5f1726258049b6f8,
+       0xe18a3ecd99a51b4d, 0x329fc2c1b13d4e65, 0x94da252b0f18f300}},
+     {{0x7b151b98e28fd10d, 0x8fc01ce81dd884cf, 0x1f0ffb5098d56c2c,
+       0xf9df1fa2b084606d, 0xf86232bfdc7d2008, 0xeae5cb8fd8751699},
+      {0x70f0229883ed54fd, 0xb575283a86087697, 0xad2191350302e2c3,
+       0x1c09a0d6c4b57e01, 0x0f65e1e1c541b9fb, 0x85493d9bf4fe76c0}},
+     {{0x353718ce191c21cc, 0x08e6edf64ad6bd18, 0xc2bb0d6e4dc5b572,
+       0x328e19df88193daa, 0xccc9f6ab7211c958, 0x377d99ef58aae5c5},
+      {0x40e2ecc91c823442, 0x036d6d528b0d36ab, 0x2fe0cd7eda4d0ad3,
+       0xb8fc3c7ffc8af791, 0xdb7e44a42b201b20, 0xa5176004ebcf527d}},
+     {{0xe19b7576fa5256d2, 0x418d5425db3f8bfd, 0x00424869951a1719,
+       0x2383c7a8533b69b0, 0x166a38e2e67a86fd, 0xa6baa01c5876c435},
+      {0x574ddc4584a208f5, 0x8cee30b826b18dbb, 0xeced99c1e9f6b30d,
+       0xb638d88da7d34bea, 0xa4836806069adedf, 0x62beb7ee7a07c593}},
+     {{0x5093950b724fb94d, 0x107822718117ff50, 0xdc9e34b59f5961d7,
+       0xfaa2fc012351a33e, 0xb9e0f1d9d5fc462e, 0x276a5b3bdd9c6914},
+      {0xe6136d1775365ca5, 0x228b77e2a91eed68, 0x5cd6a269411e4770,
+       0xd8857b0e17590390, 0xe7094f3aa0d45faf, 0xe52d11dcf40693e4}},
+     {{0xe96c4aebe5f5b545, 0x10a85a002d4c43b0, 0xf86ad2f632f9151d,
+       0x05daf874302b99e2, 0x4299dbfa14fd3171, 0x27cbedd6812cfc62},
+      {0x42e61536b8772164, 0x52eecef76a5423ef, 0xc34c6c70548fffa3,
+       0x1fbed7777b6db825, 0x850bded44ef2989e, 0x3b8a542c815463ee}}
+    },
+    {
+     {{0x9decf2173079fe2f, 0xc32ec5707c817f6d, 0xd5649ce8aeb36b92,
+       0xab9f77d158fb4dc8, 0x66b11fb6b52d60cf, 0xe217941deaaa4619},
+      {0xf3522a9a1607c412, 0xea2eba4fc2a3d8c9, 0x267997c625e38722,
+       0xed5047b72d4595ee, 0xaaa41e5f55e5456c, 0x891e3d1278cfc6fe}},
+     {{0xa438634ed7357a51, 0x918f14cd18c04d59, 0x2ab4dedfac40dd56,
+       0x758e95ee4956a5de, 0xfc11e3945113f84d, 0x6d71b6736059f16c},
+      {0xfd8e2236fb357c3f, 0xd7c8681232dca873, 0x02aeb1538ea13b44,
+       0xde1275d3013d3827, 0x470a7b7e659ca201, 0x862c83c55c77b351}},
+     {{0xfc9b800f05084cfb, 0x1c4d4510496f23fc, 0xfea0003cc1d08465,
+       0xf0281da09af48a41, 0xa5c0d97144d32eed, 0x2613b73e023a2e31},
+      {0x455013c87dc8ac1a, 0x581b13195958b3da, 0xd293f2f22290aaea,
+       0xa068256496f6223b, 0x38fd18fa69410ef6, 0x74eaf35f2b2cf629}},
+     {{0x281f6e58c7ff5b50, 0xbc67791ecf9cd114, 0xe29fa41afd89abd8,
+       0xfcb0b0b07984feef, 0x0b0928a6d9d20a64, 0x2fd385c46979ccd5},
+      {0xce9c34c81fbe72e4, 0x69364344aad0135f, 0xd464635250946a5b,
+       0xb09a97c6f39f53b9, 0x1d47bc20dcbc8b64, 0xcda5c7bdd458b0d6}},
+     {{0xad5b8c2887eff3b3, 0xa8a3917d9937833a, 0xbafdc493200c3b49,
+       0x9e27aac5972c6fbf, 0xfd292bb20518c97d, 0xa62126db33515a63},
+      {0x9892a8bb1bcfc875, 0x93b066b7e0b674d1, 0xcde9b0087fd3d080,
+       0x1e285a8859401ae8, 0x4679e32982cfea96, 0x52406ea023e615d3}},
+     {{0x27de61138b6e9462, 0xb8ade1dc473464bf, 0x911ad49394dacc08,
+       0xd036f28e44252cb1, 0x3865abf6d13dc20d, 0xcea487cdd528f0ba},
+      {0x14d77eaf4fc290fe, 0x5106533bc5084101, 0x11001dc7cda9eccd,
+       0xb79ad4bc49fc4a78, 0x4f6369f54567f8a9, 0x64050aa2df7ab817}},
+     {{0xffe057aade07f615, 0xf3f91b55342700bd, 0x294761e127a839f9,
+       0x6411a2b480eafe1c, 0x4900eb120737b80a, 0xa1134d10bb73264c},
+      {0x0ebfad730ddbf7f1, 0x57bbe692cd1f73ec, 0x675931fca20f8944,
+       0x1950eefffad2ad19, 0x60d304029cdf88a0, 0x121af89e33fd2c6e}},
+     {{0x763e3664295c4db2, 0x632fd676dbbaa92d, 0x62ab11a8c66b40e9,
+       0x06244698f384b708, 0xe7cdf3bd69197876, 0x9cc79c48064f8837},
+      {0x95900a229486589e, 0x7953f6e72ff01639, 0x3f65fbbddd3e6e46,
+       0x84f52e06baa2e2a0, 0x1dc462a8e3852824, 0x9be69c3f7e4c032c}},
+     {{0xa40afc3670977e01, 0x965f110da6c3b289, 0xc4952f87805a8491,
+       0xb36804b80b65e2d3, 0xd3f6f5ace8cf2b2b, 0x0f37a79da4b71938},
+      {0xb2f810d9489ef671, 0x1feae0262df23cd8, 0x7412eee321a14e4f,
+       0x1458b8ad179d51fa, 0x2156a90ee201509c, 0x39f29fca72605867}},
+     {{0x231f70adb2e066e3, 0xf09db880bb477a19, 0xdfa0e503907e5c63,
+       0x12fe09f4f97022ad, 0xdbf06f3620bce7dd, 0x0140e197f1371cba},
+      {0x917b6da464b0b4b0, 0x9a6f4d9b20fe3320, 0x0981d60ed66bdf87,
+       0xb430e4e062d3487c, 0xc3440fb934dc4a94, 0xe7972dda09a5e3c9}},
+     {{0x29d6394093f47052, 0xadf04e70847e5937, 0xa0ef4fee731bab6f,
+       0x21de31956ee7d7bd, 0x99af4a8dbd716777, 0x9e15c983df4c569e},
+      {0x2ec7bc0ce94401ea, 0xda1835ad85727722, 0x2b5862ce5dad81da,
+       0xb2be508188dddc2e, 0xa02482101414286b, 0xc52c436d8ea33f3f}},
+     {{0xcc580ea73b24e776, 0x0f3a8b189d721d6e, 0x8665604fb23480cf,
+       0x95787cba34414689, 0x425d7c6f4d10a945, 0xb5ec2626b2f1cc78},
+      {0x55da88858658de6b, 0xb50919d1e9aba03e, 0xc64881d7d99e417e,
+       0x1eeba5aabf28fba2, 0x20feb7b3504eff80, 0x9f5f9db650debfb7}},
+     {{0x4eb94584230923db, 0xba8611287b3a6929, 0x5aa7faa3ab1d6b31,
+       0x95c1e23916ae0966, 0x98674fd3a2fe2297, 0xa8da0ee53c42d488},
+      {0x103cabace0740db0, 0xf0b860d45bf16882, 0x03cb0cdc289e48ce,
+       0x3c15d3759e52c7d5, 0x524f731998103ca2, 0x828ed65cc609ffeb}},
+     {{0x518f231b83dfb993, 0x4b0987db37c0826c, 0x0c34961cd5177ead,
+       0x9d882d3e452c92da, 0xbfeaf5588765bced, 0x83957b62b9962295},
+      {0x2d1d01757bb084cf, 0x04c4cfcde8cffcfc, 0x2f35e33d8d4536c1,
+       0xbebb31cbd83124cf, 0xe342bed2abb29019, 0x2af0fcde2692a0d3}},
+     {{0xece5d865c7e3b29f, 0xe58106a4622839dd, 0xf5272d43f2969d76,
+       0x90c72c1b2a1a240f, 0x1e2aa0acaf15e14f, 0xfa2f1c7bf1b6b5a0},
+      {0xfb5d343d880224a5, 0x47b88a84f91881c5, 0x140f5ee9dd142fe7,
+       0x4e76982e24b37c44, 0x6aaf61e9578b482b, 0x01950e22765bc4e2}},
+     {{0x20ebf79ce8a2e8f0, 0xec040d0daca418a2, 0x016c07e78d630d2a,
+       0x20021d57fa605dcb, 0x6190f3e942d04705, 0x4e000df58974b7e6},
+      {0x6710da6c5abcedac, 0xf31aa4965f95d37c, 0x192c4b8ba5830899,
+       0x171ab8c4ea7dbcdd, 0x715f60818cdf1097, 0x0e0135bf205d10ed}}
+    },
+    {
+     {{0xd2db4d35c8d2bf7b, 0x52105d0981571d06, 0x447565cc723a57bf,
+       0xd98c3597d8ded62c, 0x0aeac6d9de2f1a9e, 0xd363b0b70a98d3b2},
+      {0xd9708f0702ad9933, 0x9334677564f5809d, 0x499332cf49cda010,
+       0x546df74a858467e2, 0x8b84a55093748e8e, 0x9e88ef9706f09073}},
+     {{0xc0a40cac52133095, 0xfe1b22fd93c162bb, 0x8625898c34018741,
+       0x69c9f3f636d9e57a, 0x69d9d7f3378aa211, 0x6b03f897e7dca168},
+      {0x24d49aebf997a48f, 0x1d984c67c149ac40, 0x667c1d01576f533f,
+       0x372eee199ef82ece, 0x577723c0c207c14d, 0x4225907a0eed37f6}},
+     {{0xb8623f36c5a5a001, 0x21847b8086878b74, 0xd19f57f6d05ac443,
+       0x9bd22882b9f8acec, 0x128186d82b41b60a, 0x1772e6b071980fd1},
+      {0x22c5ee68812dfff5, 0xccbd2fe27f952796, 0x0d49bfde7da6d35a,
+       0x348b48dbc249f319, 0xdb376657c16a8c0f, 0x28ef362a002cf8b4}},
+     {{0xc61db977bc0e0903, 0xbaf6e4da645c32fb, 0xce89b8ca060b1adb,
+       0x41db448188e2c178, 0xba6339f3923bdd3c, 0xff25b818d29db42c},
+      {0x3521116ee6d6b35d, 0x4e1bd283b22f16ac, 0x9357c984bd79fe5d,
+       0x2eda73be9d45eee4, 0x1a50c59f6288e01f, 0x37baf64975018873}},
+     {{0x431ea808751f66f6, 0x06feeefaf1b8e577, 0xd109d9f0488a8eee,
+       0xeb826b96c69843c5, 0x972272e98b42da29, 0xa9ea9ad1a137ee9c},
+      {0x0385aa9525163be5, 0x963e964034c32f2b, 0x9067aa894dfd935a,
+       0x6ab23131bc3f5f3c, 0xb96c3406f302e0e1, 0xc8caad4ed65f811a}},
+     {{0xf323953b750261dc, 0xb8563bf138552a8c, 0x2937dfd9bd32cb8c,
+       0x07c4e5637ecf3538, 0xb573960eb6399415, 0xc1ced6c1dd1a4a06},
+      {0xc625f400787ddf7a, 0xd998c28b1ce6778f, 0x66c51e5b6220f24d,
+       0x9f97d75827d01c6f, 0x60b157240412372d, 0x2253abc104d55048}},
+     {{0x15952eb8fad177ed, 0x57aaf91d05058d9f, 0x268ba7308ab1b9d9,
+       0x7decfc47d5b8f86a, 0x596353e70879ab02, 0xa3ff23119a68d5a4},
+      {0x257c68a17534fb5a, 0x84f7c9de160ec5ea, 0x1b2b770c6754185f,
+       0xf321ac71a74562f7, 0x28bf0a15264a1961, 0x0093db7386a033ae}},
+     {{0xc552c6c6097f322f, 0xdf59a3028bc06287, 0xc9ed375c19610b0c,
+       0xf0e7b4ebb051dad5, 0x7267a304c6556643, 0x0044f6d8c96dc1d8},
+      {0xf0ed5f9af4fc3725, 0xbbaf9f2c9de8e1ff, 0xef5d66f4af5a4b4b,
+       0x0b5bed3d20644cf2, 0xf7e4543a75ae23c0, 0x696f60dc41325b66}},
+     {{0x4fd0b582cfc0dd38, 0x47fd984f55b7b68a, 0x2722a0cb699460ec,
+       0x81b4afd8fa26d4c4, 0xb921d0d5941c86e4, 0x7208f094ef4db114},
+      {0x2997f43c17ddadf8, 0xd1aabdea21bc290d, 0x64e20e0086182be1,
+       0x9bd11568cbddb8eb, 0x639db1d43ba0e6b5, 0xb99b11fb429a6b4f}},
+     {{0x04ef7ad5aaa48cd8, 0xb97a65018a8ac319, 0x9ae38a6a47591d88,
+       0x27d912546902edb4, 0x5dae3d83812b143a, 0x02ee135393a2fdf6},
+      {0x07a0038972410377, 0xa2fbd34356e10c82, 0x3fd6c17172b1bcb9,
+       0xa8d70f932d0033c7, 0x9ea9eea32916c28a, 0xecb7e486423edad7}},
+     {{0x5525fbb0c515bacf, 0x48a72394a2aa22ba, 0x9bcd64c90b9e3fe3,
+       0xe9e11d171975aa86, 0xa435bbf0c9dbdaac, 0xe8451f6ce30c8911},
+      {0xa1706d895bc2d12f, 0xfe73ff43406d4883, 0xb713efc649d5739c,
+       0xdfd0bbf805c1ec9a, 0xde17c52c5e6b3bd0, 0x57e060345be196af}},
+     {{0x9949b33d2c20f868, 0xdb3aa790b5706250, 0x88ce71e788e17f2b,
+       0xd851baf2da9c0881, 0xe869c5ba86d8c9e9, 0x1af68d65a01425b6},
+      {0xeae8b1c69bbd3963, 0xf34900b1ec087425, 0x14942910c374bb96,
+       0x3e13c45705487483, 0xe0e6fad435bc6ee1, 0xc7c38dc7b54d247b}},
+     {{0x420dd8f68bd92789, 0x3831b0e94ce541dd, 0xbde477e431ed7f7f,
+       0xb46eb7f229c5557b, 0x00a07499c56940e0, 0xabb9d567abacf00e},
+      {0x9f63b87dc5ba9d0c, 0xf4c5c4a3708d4f4c, 0xdbde9879de7fcf63,
+       0xbe88f949616cf5d6, 0x17560674d1aa38be, 0x160ec3659c436175}},
+     {{0x9c85e50ab9bd0afb, 0x2b66a1c0d26ac425, 0xcb78ce81807f33db,
+       0x9d337d8a3db81e06, 0xe223eae472638d70, 0x7f9ea2176bf2ebab},
+      {0x2804b59c9b634059, 0x1043fbf4f3dc8d46, 0x321eca1e7bc6949c,
+       0xbf2906c08f051155, 0xb802a3289c539f40, 0x08bcca20073cd808}},
+     {{0x08cb6315cea8bf63, 0x7ac2699db59ee7fa, 0x4cd2c8a98d1601e0,
+       0x6d7188e37b90d9c3, 0x634867166bfe73d3, 0x49ed7faacf9f30b0},
+      {0xf7edf5d6c9515fd6, 0xbb3ab8488a8ae607, 0xe6e6b20921c5c388,
+       0x5dca0a1d5b1e03bc, 0x15670f5994a8b174, 0x6f79e38168c27a97}},
+     {{0x6d34bdf6ab463fa6, 0x7bb127b60093b9cb, 0x61d051135a3bfdd0,
+       0x4abab575f1296bdd, 0x72da68494d2e9a7c, 0x90267bca8d11f03d},
+      {0x478111223e9b310b, 0x8ffe91d31b1920cd, 0xec293ec67521898e,
+       0xf0cf026996c1da75, 0xb0dbd4c380f2c7b3, 0xe528175534e4baf8}}
+    },
+    {
+     {{0xc32730e8dd14d47e, 0xcdc1fd42c0f01e0f, 0x2bacfdbf3f5cd846,
+       0x45f364167272d4dd, 0xdd813a795eb75776, 0xb57885e450997be2},
+      {0xda054e2bdb8c9829, 0x4161d820aab5a594, 0x4c428f31026116a3,
+       0x372af9a0dcd85e91, 0xfda6e903673adc2d, 0x4526b8aca8db59e6}},
+     {{0x51a033a5cecb916f, 0x2ac62f638d7de61c, 0x92eece49a42a266e,
+       0x87e037db82c4d11e, 0x875be1416fbae08a, 0xf348fe26c539478c},
+      {0x51f8b907ff94c01e, 0xc46cc0e019695a9d, 0x2c74bd666c51b9c2,
+       0x635d3d24ee565de8, 0x6bd656638982c8c3, 0x5c345b79daf6a93c}},
+     {{0x68fe359de23a8472, 0x43eb12bd4ce3c101, 0x0ec652c3fc704935,
+       0x1eeff1f952e4e22d, 0xba6777cb083e3ada, 0xab52d7dc8befc871},
+      {0x4ede689f497cbd59, 0xc8ae42b927577dd9, 0xe0f080517ab83c27,
+       0x1f3d5f252c8c1f48, 0x57991607af241aac, 0xc4458b0ab8a337e0}},
+     {{0x179c59cf210c3144, 0xfb613c5733eebbc4, 0xdda75cfdba0cf384,
+       0x94081a5b3a8fbafa, 0xb91de90a33384e0b, 0x7d1f8f4027aa2a45},
+      {0x0747bcc162031148, 0xd2db8e39f324160b, 0x9c1ce3e9722484f0,
+       0x13a7ee5da62d1dda, 0x77fd79343a963bce, 0xcd3d871783d2f21b}},
+     {{0x3dbb3fa651dd1ba9, 0xe53c1c4d545e960b, 0x35ac6574793ce803,
+       0xb2697dc783dbce4f, 0xe35c5bf2e13cf6b0, 0x35034280b0c4a164},
+      {0xaa490908d9c0d3c1, 0x2cce614dcb4d2e90, 0xf646e96c54d504e4,
+       0xd74e7541b73310a3, 0xead7159618bde5da, 0x96e7f4a8aa09aef7}},
+     {{0x609deb162d8bcd6e, 0xe42f23a92591750d, 0x4a9f3132b378305c,
+       0xf101799869275f5e, 0x14be746761b089b5, 0x05f620d20c81b0c5},
+      {0xca90a9c06cb8412e, 0xfe0f6a8915b1b0d5, 0x1b25ac9620c71988,
+       0xb971b61a390aedd0, 0x995214d779d8cd39, 0xd7fa135b65c6e11a}},
+     {{0xa8393a245d6e5f48, 0x2c8d7ea2f9175ce8, 0xd8824e0255a20268,
+       0x9dd9a272a446bcc6, 0xc929cded5351499b, 0xea5ad9eccfe76535},
+      {0x26f3d7d9dc32d001, 0x51c3be8343eb9689, 0x91fdcc06759e6ddb,
+       0xac2e1904e302b891, 0xad25c645c207e1f7, 0x28a70f0dab3deb4a}},
+     {{0xa13f19b40f3ff12d, 0x57ee08b1019564aa, 0x00ec0c997044a6f4,
+       0xaf5665f8dca1075c, 0xded5ca3f0620ab0c, 0x9b2cb8c7a896deff},
+      {0x032ab2b307df2345, 0x964d109ef1da3f88, 0x2286b6f725133304,
+       0x0d16d531977a4567, 0x00a66036f1abae4f, 0x5debab1d95f0103b}},
+     {{0x922d7f9703bea8f1, 0x3ad820d4584570be, 0x0ce0a8503cd46b43,
+       0x4c07911fae66743d, 0x66519eb9fda60023, 0x7f83004bec2acd9c},
+      {0x001e0b80c3117ead, 0xbb72d5410722ba25, 0x3af7db966e9a5078,
+       0x86c5774e701b6b4c, 0xbd2c0e8e37824db5, 0x3ae3028cbfac286d}},
+     {{0xfd1b413f5fb7c5a8, 0x6152b9de0206cba1, 0x487f8e3ad8f51960,
+       0xac34a23c033ca1bc, 0x90bba98f60258d55, 0x30421acfbd9098f2},
+      {0xd9c601f989c0ce44, 0x621bda832f2f1af1, 0x14fa7ef638c45441,
+       0xbd5dc10fe47faa31, 0x9dce0dcb74eeb6a1, 0x2cca3e6606346849}},
+     {{0x83d4d4a8a33e071b, 0x881c0a9261444bb5, 0xeea1e292520e3bc3,
+       0x5a5f4c3c2aaab729, 0x0b766c5ee63c7c94, 0x62bb8a9fbb2cc79c},
+      {0x97adc7d2aa5dc49d, 0x30cc26b331718681, 0xac86e6ff56e86ede,
+       0x37bca7a2cd52f7f2, 0x734d2c949ce6d87f, 0x06a71d71c2f7e0ca}},
+     {{0xcdb67ea920066faf, 0x929b4d2ac7fb7154, 0x5842d9687fdeb411,
+       0x2ddf764aafe55cb9, 0x608bf76f47df3cf4, 0x1862463b5984e339},
+      {0x7feea86f944d22a2, 0xf8562c30281f2b84, 0x332a54d2bd358ea4,
+       0xa54dec9fe7fe1ede, 0x9c8e52a4932264d4, 0x428acd1a89817f5b}},
+     {{0x559dcf75c6357d33, 0x4616d940652517de, 0x3d576b981ccf207b,
+       0x51e2d1ef1979f631, 0x57517ddd06ae8296, 0x309a3d7fd6e7151f},
+      {0xba2a23e60e3a6fe5, 0x76cf674ad28b22c3, 0xd235ad07f8b808c3,
+       0x7bbf4c586b71213a, 0x0676792e93271ebb, 0x2cfd2c7605b1fc31}},
+     {{0x42aeebc4eda2fa8f, 0xda91ada3e77a9c5b, 0x29b9d55fc585a572,
+       0xb0e52414a256353d, 0x1d0e7d5f29adbd21, 0x7ee5ff9cd057d175},
+      {0x0bf76fcfc9097bf9, 0x023170f8fe09f5b3, 0x8a67c1240799f989,
+       0x4ce28eebc6a20819, 0xfc1d7c9179502d13, 0x7922d2d9de43f895}},
+     {{0x4258e5c037a450f5, 0xc3245f1b52d2b118, 0x6df7b48482bc5963,
+       0xe520da4d9c273d1e, 0xed78e0122c3010e5, 0x112229483c1d4c05},
+      {0xe3dae5afc692b490, 0x3272bd10c197f793, 0xf7eae411e709acaa,
+       0x00b0c95f778270a6, 0x4da76ee1220d4350, 0x521e1461ab71e308}},
+     {{0xf2cdae3196230a58, 0x47cf36b4f304e1ea, 0x9d14f25ad750b29b,
+       0x931b9c65dba15f3e, 0x34db169ebf9fe2dd, 0x8a89e47c52663433},
+      {0x8859a4f8026ec31f, 0xeeb703eaa913ceea, 0x74638d6a67ac4db7,
+       0x5c8ea7b2be25d755, 0x8a0f0a8738db10ee, 0x96a26bace890bcd3}}
+    },
+    {
+     {{0x883533af64a5e869, 0xaaa778c26973ec23, 0x8f0b5fb546d0fcf3,
+       0x7e6b0a0a4ab05da7, 0xcd91a869c67b6614, 0x7de9f2ff6c6f7cf2},
+      {0xc072a106d1ec14c3, 0x3f4b960642a128ee, 0x7378192c8f0ce946,
+       0xdf2e7b9fd1149441, 0x4fa17cb614ccf45a, 0x575680e945f03568}},
+     {{0x8b70e94f8f458c68, 0x292726544160ecc7, 0xe22219ba4d3ef22f,
+       0x7f8a712a1999f948, 0x25575e96abfe7302, 0x21c6ffc6564a1af0},
+      {0x045e9c667e8500da, 0xef7c3cf704ef8ea6, 0xdd23b825c3db161a,
+       0x05fb173aba33a906, 0x9a8b5ecb870e41f2, 0xf3d9db0bccc30d1d}},
+     {{0xd9243926e873ff0f, 0x2e2a5ab6f20b0e49, 0xa1bcfeee0e35f201,
+       0xd25be5f3196f23f3, 0x298c67f2ffc1d068, 0x77dae55c0c3d950b},
+      {0x5e15ab998822c996, 0x52de2e6d83f60a98, 0xa9f82ec947a7e269,
+       0xf02af9a22ac22e49, 0xdfb3103fa706f090, 0x125599623cf8dcb0}},
+     {{0xb7b8562588ad12b2, 0x81f5958b1e44b254, 0xb4ebddd5c91b8ffd,
+       0xef815ae155d38511, 0x98587d551b0da525, 0x1d41817734a9ebbd},
+      {0x844811fb1e6057d7, 0x0c16977176e5976d, 0x4b268bb4f623789b,
+       0xb26ae5be40498058, 0xb47a5ded3c2b435a, 0xe15a684b8fceceb3}},
+     {{0x122a3eedd09dc3c8, 0x6a19907faefe0819, 0x057aafa1da325339,
+       0x138033bdd42a5345, 0x8ac206af1a065ebe, 0x0a46f5ae25c31ed6},
+      {0x7fc577a9d7e379db, 0xc6df694369dcee54, 0x4c167ba2a8336bc1,
+       0x0fbd9708f3a1339c, 0xc6b8c01f226f612f, 0x5d4ed789d51332e1}},
+     {{0x26aa2c2e5a1abcd8, 0x2b16a12e9609d9d8, 0xe485a551a2bee00c,
+       0xfa28c30bf4f2292e, 0x99abef78b7358f1b, 0xda6b3cdf10a276a1},
+      {0xbd3858b747c03f71, 0x4f0bf5f0b22d05d1, 0x2d80f5d28250f760,
+       0x060f9b278cd9666c, 0x6a6c40b0b1b014a9, 0x44537af38c440a9e}},
+     {{0xb564cfd676faaca5, 0x8a6e3925920dd223, 0xee59a140a590a383,
+       0x9e29b552a1922ad9, 0x604367de60a0da63, 0xc498aca592c35fd0},
+      {0x74135082250ed8a0, 0x5d109d1a6c7c3e77, 0xf9e2d84dc63dff94,
+       0xca50f5e4f7aa2b0e, 0x7cba9e87d543d389, 0xaf5fbbefd8fd1292}},
+     {{0x707656834fc11c3a, 0x53a9403166aac4d1, 0x2a935ef0a6db6169,
+       0x002927612032d599, 0xb5babb2d3a6f1316, 0x601a7dfadb26af51},
+      {0x00c340131322d983, 0x45b062ec2bb507c5, 0xa1bbe2ed0f9b3656,
+       0xe17a5d4934031d18, 0xe3661047f8fe1224, 0x0e4f3b3d623c6cf5}},
+     {{0xffaac084ca45cccf, 0xaea5cc3d061ffe3c, 0x7c5d7c60b355f387,
+       0x4bbb2a0c99cba92d, 0x6b4ba3ef2f7768d6, 0xc7484ed2cc5f9c40},
+      {0x5d4e92fc52b57a7e, 0xba9f16c4ca2c200b, 0xebe02a8a3797ccba,
+       0xb6b3f42138c4133a, 0xad5d85b68153d033, 0x782d6ee85714f269}},
+     {{0x7845b6969c0cf752, 0xb82d052b5a732acf, 0x7760564c1262877b,
+       0x29b3c57a8ecc7aa5, 0xb58eccb0df1ebbed, 0x86fc15443c3a3303},
+      {0x44761ddf13060f0e, 0x5a3dacfd7371a5a8, 0x846f6faaf7cbc2bc,
+       0xf5e098b0368caabf, 0xe23ea10710c08769, 0xbc5df1db1563fcda}},
+     {{0x65c3a54e142d8955, 0x5c6583cce7814f25, 0xbd5a07d8d924dc7d,
+       0x9f717bd9c28f6e8e, 0xa0c4ec4e3b6540a7, 0x3153bb2b142b3283},
+      {0x53bf403c9b296946, 0x659a828ab1cdb6d2, 0xe9517d811369af19,
+       0xd8c7a0998990e7a0, 0xbaa9f59de535cd04, 0xbb0cc68e0f269551}},
+     {{0x3c00ac526a78c6e5, 0x9c61aca6defaa52c, 0x0034128939794a09,
+       0xe08910d141cd7c0a, 0xa58ffbb6a732e3bc, 0x87bf51ab91fe8fd8},
+      {0xc4f4f2674a59e2be, 0xdeb512c7438071c8, 0xddf82842e9cd290b,
+       0x3e17311d6ae85fe0, 0x6e9236a9b41be881, 0xbb9ddf9853555ebf}},
+     {{0xccc163ea09f3f0be, 0x9932b56f6a5b0a63, 0xf89fae919c69668e,
+       0x555f98215ce13021, 0x4b02693f37037aa9, 0xc4afee79bde50f35},
+      {0x4b0919c202aa6c7a, 0x3166de2a991e15e9, 0x284baa3e7077fb38,
+       0xbb7a6416a116ddec, 0xe8c89547b7636772, 0xff9403620ef92c54}},
+     {{0xd5d81275e2ce6008, 0xc45bdf250b3b9d10, 0x15ab5da36cbc83e2,
+       0x85a18cf8c52a66cb, 0x77e202b8b042c047, 0xc4dc3de2e7e7997e},
+      {0xfe9335b1995fa67a, 0x809e161d75b96a00, 0xfb03c2a5a0c3baea,
+       0x5c7e0523888c2f77, 0xa8fda1c887ad10e2, 0x90484f78858a3577}},
+     {{0x49e41f0af9fde126, 0xec9600443613d3c2, 0x2c62a49d10421d3b,
+       0xe24024648131a0d8, 0x8a7ce188bdf794fc, 0x704dea7d4665b1b6},
+      {0xbdb9c18e4d57c6ba, 0x5288a053f669b3c0, 0xbf7d01b878a5e252,
+       0xb26cccf926b9cb7d, 0x14191a3284326c47, 0x460ff74791f8425b}},
+     {{0x59367582bd27be7b, 0x92bf5bbc1ab2c596, 0x5d96351af6a27741,
+       0xeab94db87f929e0d, 0x865ba011043f1afb, 0x43acea125fb631dd},
+      {0x192e0652b2fd1436, 0x44f22ff17b38d121, 0x7bcc228db7cae5f6,
+       0x02eaeccd6a828b03, 0x7c48a2ea91f301aa, 0x1e090717f5eb1a07}}
+    },
+    {
+     {{0xdf0ae8df941948e3, 0x123fee901d010bcd, 0xde3717ca1dd28691,
+       0x0c1db879709b678e, 0x0288959a400acdc6, 0x66c691815ca2d03a},
+      {0xe52534b3dbbb75de, 0xe914938c3de927cf, 0x1a9a34f873eece30,
+       0x0fb0c7bd642a6799, 0x375cc0cfeaa7e8a8, 0x75fb9eb5d00ec238}},
+     {{0x9ca8cc9db72958eb, 0x3c8cd0db1014f562, 0x72115d53059b2bba,
+       0x8fe7ac30730e5dc3, 0x4e67ef69841d8998, 0xfb6439ffc8ed37a5},
+      {0x48164b3e26df84c4, 0x37d492ad365bc99e, 0xb7fd4643beed38ce,
+       0x993cfa9fa3e30b3d, 0xdcc5e7af01ddd484, 0x5edf3ac06840175d}},
+     {{0x3ee87e540c19c625, 0xe4ae611ff4a10f9a, 0x27d655120aec21e5,
+       0x737578f58bea1b16, 0x6e2b6bf75fb7a3a2, 0xecc5925114f65000},
+      {0x53e1167cb8dd544c, 0xee60e60fc5862fdc, 0xc86582cf6cccabeb,
+       0x849fc15d8b4d37c6, 0xaa7960ad8f4a87bc, 0x17fe10823b7f0a6d}},
+     {{0x79768e9f51d33c11, 0xeec34505a4b24889, 0xc194821bbe0c67d7,
+       0x537a6a4a6909fdfc, 0xae6d705195ccdda7, 0xed4b722292b3926c},
+      {0x2c5dd6af6b24a3d4, 0x9282ec39e4386095, 0xdd3c7388397a3bd3,
+       0x9d176c6a8baf59c2, 0xd5c6219e380ec958, 0x194fc11654e8e315}},
+     {{0x3c67c65c79650de1, 0x8e2a220b00bfb2ac, 0x59d225dc42f02a3d,
+       0xc52ce4b25d60e54f, 0x8894e3cb3f306112, 0xb78a037b50d85aec},
+      {0xeeeb3b402d85f328, 0x3d391b37e0406ddd, 0x5273ebe90502141b,
+       0xd17023e7e092bfeb, 0x04564385282f5aed, 0x7e55a4e255d82356}},
+     {{0x0b7576f901ec1432, 0x84b30eecabc5f603, 0xdaaf7ba9f4a84b7a,
+       0x9e3a5daa3bb37a99, 0x56bd964880378cff, 0x2fdeeeb78e6ed856},
+      {0x079014a73c81ac34, 0xf8de4004b4211c27, 0x0cee3df97fe4391e,
+       0x441aa7fb2fd2fc38, 0xeba7be864d1b575a, 0xca2fb5b7231c2d01}},
+     {{0x8307bc81d205869c, 0xdd2828099388e917, 0xdd4cb2debb572a87,
+       0x5a41595d14f0db39, 0xd5db5f59f4e5c71e, 0xcc9c9f6f4a87f672},
+      {0x4ddce8c3012e65ce, 0xaae28eafab3a94d3, 0xd4b950110b333aba,
+       0x3e171506914eb476, 0x109ee9ab69bbfa63, 0xbddba0985dff5471}},
+     {{0x0683349e463a8251, 0x97dc4f475103e72c, 0x47c7181050663b9e,
+       0xf327d1499733dac6, 0x03f55e4a292137c5, 0xccc6232ada59e1c7},
+      {0xbaa8b4ddadc59cb8, 0x45370d35fe7486e4, 0x99a88c1db0322df9,
+       0x394440a7fd69954f, 0x9060473da5a29889, 0xc8ca43e32f04864a}},
+     {{0xf08c8efc9451d422, 0xc8beae41ba846ac3, 0x0157f46c807df062,
+       0x080eac20deaada6a, 0xdf146f3da3bfddd0, 0x8ed7c2c6617d19d7},
+      {0x314ea3e740439488, 0x544132c7b3e6806f, 0x9b9bb477a215a3a2,
+       0x9310fee9e33f80b0, 0xf277895ce71769af, 0xe8218e1a7d99d5b9}},
+     {{0xd5c7241add8b9644, 0x45a5f2d1993116d2, 0xbacacd4a823048df,
+       0xa278fa042568547a, 0x3a4f2482bff72820, 0x1305d1a713e4314a},
+      {0x9d84c33334ba28e3, 0x9995b5bb6a32fb41, 0xb0f75f3c520946d8,
+       0xd7c4b8b7de98aa63, 0xee5efcf3ba856b6b, 0x36af33683324ed66}},
+     {{0x29c741c3bb2af5fb, 0xb9c92da689e6241e, 0x07dace3c474b7c0f,
+       0xd0b3f9bcd996b6a8, 0xe97e384707c662de, 0xbf6d1e056c851030},
+      {0x150c5e9399f1aade, 0x9c1e23519bd848d5, 0xeb808a5509cab3db,
+       0x1bfbe08d9a49916f, 0xc6a70ea764ab0e4e, 0x77d189f27823f505}},
+     {{0x90762c1f5827fe2c, 0x20160f7aeaffda88, 0x7420849f5c47c645,
+       0xb08231956d72e748, 0xaeac683b8ee11773, 0x8c2a0a79fb5c550e},
+      {0x6d986d696c07cc1e, 0x57269140ba8398b9, 0xd13e136fd94d5223,
+       0x1aa75419ed5b01c6, 0x7c2014b1408fcdcc, 0x0680a985cffde5ee}},
+     {{0xfbe88fce23133885, 0x3c2e36697c5a5c4b, 0xe36cf261bbacc6e1,
+       0xa72c7bb196ae3cad, 0x08e371034cb1a375, 0x5521f4452a02baee},
+      {0xda9329bac157e471, 0x3f90cad168470808, 0x24182208a657de60,
+       0x17c082b767c10d1b, 0x9e2226489928d6fd, 0x1578c89536ced38f}},
+     {{0x92fc9a3342c5a7ee, 0x8768614af9f0ed71, 0x1ea5f7ed87ebfb66,
+       0x296852ded361069c, 0x1cec6f1a0192498e, 0xbfd4858fa9cca3aa},
+      {0xfba98c242ef240e8, 0xc8b500e4ab635d9f, 0x9f49c572913a3edd,
+       0xe6181f93d42b2d4d, 0xf96b5db26aa77fa3, 0xdfb2241fe43558d8}},
+     {{0x8f8a19647481cd31, 0xd5b8197e17b37aa7, 0x7cfbcd197ac0dbf6,
+       0x4ecd895493662f46, 0x104a090d0501365f, 0x828694cd7f097083},
+      {0x60b865f36dc105dd, 0x00549f1b85cd4ed7, 0xd262e38bcc197cc9,
+       0x5d3271de9a262b4f, 0xc7df47e9a953d539, 0xab8f1c8a5b9a86a6}},
+     {{0xc7d0abb2edee15a5, 0x72dc0105228cc4a1, 0xeb67defca80767de,
+       0x6fa174d871820908, 0x3215df485674d19a, 0xf944531a960a081a},
+      {0x93ed7180ef2cce62, 0xb318edbfc8bcfc0d, 0x0909d56efe787e58,
+       0x5ae74fc98fe8b96f, 0x8fc342c435ab6811, 0x6fc6cc5c0b991e0c}}
+    },
+    {
+     {{0x55671129542f4e90, 0x43bedccf0623d4cd, 0x7e21207ce99ca16b,
+       0x785fa1057c7a26b9, 0x33c28658c2c3ab00, 0xcce42a48d79cd59f},
+      {0x9a674db4b8c3bc75, 0xea701d156904e3fe, 0x990e722166bf2c6c,
+       0xba29affabd4c3791, 0xd98510cf20696ee1, 0x722ed471f93d26a5}},
+     {{0xe7cf5bacbc579793, 0x11db7ddfd73f881c, 0x9c1a531d04fa8473,
+       0x399e84845780efda, 0x6e9c12be4f62cb5a, 0xf21bdc4994a5df3b},
+      {0x3c15fe1211da2a4f, 0xdea123bb23e631d1, 0x3ef76da4be294c90,
+       0x5cf21d5aa99b8398, 0x50679cf8751b9f6a, 0x4b3f3b9c54d0b7bf}},
+     {{0x6c8d97e075a46271, 0x0fa0c4cd9dbed39f, 0xfb6da5e2de74ac6c,
+       0x041ce886c17c1ec5, 0xb42941a8d7419105, 0x79768eee002fdfd5},
+      {0x64849afd88c8111f, 0xf425fe14814192d6, 0xe916e8640448fd7e,
+       0x31e224ad72ed351f, 0x73e6e6ac7c0183c1, 0x375657c621bf7ceb}},
+     {{0xc84f917203bdf6d6, 0xcfc4718769f60e03, 0xcdc4753ba05068ea,
+       0xa177ad14077777ef, 0x0b7f54eb7e4cf44a, 0x4ee443f91860144e},
+      {0x1279ed4d42bb6a93, 0x511137d7436c1b54, 0xebc958fab8cdb6ce,
+       0xbc4f93f4a0c7614a, 0xc5bd6cde7b2c6d8e, 0xecff7dd78d65f38a}},
+     {{0x9a4af7afe45543d5, 0xb7478fe06a04c87b, 0x974eebba66f72454,
+       0x682578fa5901d1ec, 0xc3595199e82b048b, 0x83da52fbbbc19ba2},
+      {0x40f337af90450b02, 0xbd1ea60b439c46d7, 0x4f3e481800d0ed85,
+       0x59d0a0a9766d9e20, 0xe81dc4d656a16718, 0xac872a21df3d3d98}},
+     {{0x4da7d63abbaae09b, 0xcae05f370783fab2, 0x1e8c001668841d1e,
+       0x0688f485b10366f6, 0x38ee34b005b121e9, 0x2779f00914e0dc1e},
+      {0x83c1d44edbff60ce, 0x63fbcf824105c8c2, 0x6b73274453715349,
+       0x5065bdcdc5ca18f6, 0x677313cf2def86e3, 0x6c54d22433ebff5d}},
+     {{0x35361c9188b3fc7b, 0x706cf8c5c22a219e, 0x545bb34b886348e9,
+       0xf25eef254594a530, 0x59427ed073843cbb, 0x39638f20beea8c4d},
+      {0x4e7d445f960e3c28, 0x989abc64d383df18, 0xb4238e0204694ba7,
+       0xa37531370203d67f, 0x404bc42186d01fc1, 0x1af37190b162392d}},
+     {{0xffec6674f65de0f5, 0x4043079cd23ad193, 0x31811365ee61bc95,
+       0x358bbd6e8948b6e2, 0x1cd9c342e31644be, 0xbab3aa8c60a8a7a7},
+      {0xe065519fa375beb6, 0xf7d0b0414439990c, 0x8957c03b8517ae8a,
+       0xc96a040173750d6e, 0x4eb2e364b2aee6d7, 0x813054feed099114}},
+     {{0x79d98e89ec3c19fe, 0x860ec5a6429341e7, 0x80ab856825dd60c0,
+       0x7d0b3f3fe47973db, 0x654435bdf7899dfb, 0x54c59689e6542b1d},
+      {0x171c6842bed69ab6, 0x82b8024d188a3126, 0x31bf057d9c37538d,
+       0xe079326acb0be742, 0x0232e98129ace4e3, 0x7b06fb86ce8596ab}},
+     {{0x71714896caada268, 0xbb3d05dcfd0e302c, 0xb0785f33fe56d08f,
+       0xdd43e0f638a1b2ef, 0x2df35cfb360fc15a, 0x97173f0f90b3ed36},
+      {0xd4970bddb720544e, 0xb6075f7694a01944, 0xc99e8a3e4a43c4f3,
+       0x8013609fd9cb4808, 0xf3fef0eaecc3d094, 0x3829fac78642d223}},
+     {{0xb7613dab0402156b, 0x4ad70f1c0b20ec7a, 0xd9189b209c46dd4d,
+       0x4b22485f4bd5235a, 0x6e97203188822a0d, 0x3cf8d8232c136807},
+      {0x5997fa640884e550, 0x73110b25293aedb8, 0x7e82016835319a22,
+       0x2222c809a6c668ba, 0x2f316be231e0bfb8, 0x86cf3a2d0d832198}},
+     {{0xffe3104b684456b1, 0x37ba0db6f0f49278, 0x15aaed42cca2f150,
+       0x8618aa02c421c694, 0x4d6a091dfab87b36, 0x304eaea00e786d5f},
+      {0x0be977472c114074, 0xf57e3a19ad387a8d, 0x6094823b7a70d421,
+       0x5928791809de860f, 0x7f7fca496dcf6020, 0x57580c615f46086e}},
+     {{0xeab346165d89002f, 0xb311562872a01a68, 0x2f0ced58dce0c191,
+       0xec08b09a1a895760, 0x206faa7fae62153c, 0xc31e3815cf2895bf},
+      {0xd57fbf579ac88636, 0x966f5a84ce91affd, 0x092458b963620a73,
+       0xda7b491050805fc1, 0x1fc60a255c561649, 0x8110a1a94f899e20}},
+     {{0xb509f702f0cb1370, 0xbdfcf4a0c658441f, 0x853d832a7f07f328,
+       0x074fdecd8fbdcb83, 0x80ed8de9d6a4650d, 0x61c39ce8a5d68720},
+      {0xe66666d23177feb4, 0xdbf3fc57afacf38b, 0x7e2d99510da620fb,
+       0x901145ffdf866f77, 0x442a37e5db045beb, 0x0cb0600fbeb1b008}},
+     {{0x1e6604d354d7a6af, 0xba6ae4d007c97f80, 0x5e3d978b77c527fb,
+       0xd0642c72e93a0d78, 0x06d8ae5cb3c3c215, 0x8bf36e5a4eb9a4c9},
+      {0x1ca6403c4d505a53, 0x0187be5ad2f5c7a3, 0x68cce2ba9f850eac,
+       0x81055e4a5805353b, 0x3c242c1d89b4eb85, 0xee4a6691dda42eb8}},
+     {{0xbb39a17a7c34f095, 0x7be330a822fbbe61, 0x6be6abe3b91f1482,
+       0xf972804fbd39a2bc, 0x06737e54f91d813e, 0xbd6066681a87cd4a},
+      {0xbf88b2e5f538d56e, 0xb8206a8134afd68f, 0x7a93aedfa58af042,
+       0x8853cdf6ac0511b0, 0x9d7f416d067e2c19, 0x5d0bc923f9671d8a}}
+    },
+    {
+     {{0x2e7d0a16204be028, 0x4f1d082ed0e41851, 0x15f1ddc63eb317f9,
+       0xf02750715adf71d7, 0x2ce33c2eee858bc3, 0xa24c76d1da73b71a},
+      {0x9ef6a70a6c70c483, 0xefcf170505cf9612, 0x9f5bf5a67502de64,
+       0xd11122a1a4701973, 0x82cfaac2a2ea7b24, 0x6cad67cc0a4582e1}},
+     {{0x96a1e74f51e4de5e, 0x72913696e37f5006, 0x12449c4fbe35109c,
+       0x1fad8b304521d7e6, 0xc85eb23d57d00293, 0x4ebd334b35f68229},
+      {0x7c5b86682df5acf1, 0xc2b4da6e5463de2e, 0x067b0456757cd570,
+       0xeaab81be3a1c866b, 0x72a6af75bbba88c0, 0xaed4dbde0ef567dc}},
+     {{0x597a26ffb4dc8600, 0x264a09f3f9288555, 0x0b06aff65c27f5f6,
+       0xce5ab665d8d544e6, 0x92f031be99275c32, 0xaf51c5bbf42e0e7c},
+      {0x5bb28b061e37b36d, 0x583fba6a8473543a, 0xe73fd299f93fb7dc,
+       0xfcd999a86e2ccad9, 0xb8c8a6df334d4f57, 0x5adb28dd9a2acc9b}},
+     {{0x3afdee277d221ab6, 0xecf10abc47bb619e, 0x340c8ee3ba4a3301,
+       0x1a6ea51a2a883b7f, 0x64f27976d5d7412b, 0x7fcf0ecc91251b6e},
+      {0x5f3f8f41365b18b7, 0x38e48b96e2e13e58, 0xde3b73d6ad61b2cb,
+       0xf08398d5d542676d, 0xd373931e8e7d712b, 0x89325d7a7f96e023}},
+     {{0x5adf3d9a111792b9, 0x1c77a3054f1e0d09, 0xf9fbce33a82d3736,
+       0xf307823e718c8aa3, 0x860578cf416ccf69, 0xb942add81ef8465b},
+      {0x9ee0cf97cd9472e1, 0xe6792eefb01528a8, 0xf99b9a8dc09da90b,
+       0x1f521c2dcbf3ccb8, 0x6bf6694891a62632, 0xcc7a9ceb854fe9da}},
+     {{0xe44e3f864b3759cf, 0x90cab0eb9d74e3f6, 0x1004254501c4e171,
+       0xc12df68cce52defb, 0xb1fae2fbf363100a, 0x5016c8533573235f},
+      {0x8d4deb661d922e9b, 0x8a20d42317f84ef2, 0x324985835a4e118e,
+       0x5abfa961308772e9, 0x41c7611ff54e4876, 0xc1da40d31f5867b2}},
+     {{0x46303171491ccb92, 0xa80a8c0d2771235b, 0xd8e497fff172c7cf,
+       0x7f7009d735b193cf, 0x6b9fd3f7f19df4bc, 0xada548c3b46f1e37},
+      {0x87c6eaa9c7a20270, 0xef2245d6ae78ef99, 0x2a121042539eab95,
+       0x29a6d5d779b8f5cc, 0x33803a10b77840dc, 0xfedd3a7011a6a30f}},
+     {{0x3c90a59f85adde98, 0x35414174e5269140, 0x9aca885c1a0d58e2,
+       0x77b9b6dd6816b009, 0x8e5c12139ee4718f, 0x60ad991e4e4eac45},
+      {0xc00c35694d71f624, 0xacbf4eb25bc5fd2a, 0xcba1ffc75eaf3eaa,
+       0x5f99092d42a87e32, 0x2e7b49c76f7a882f, 0x5e9bfc5c29040512}},
+     {{0xfa070e22142403d1, 0x68ff316015c6f7f5, 0xe09f04e6223a0ce8,
+       0x22bbd01853e14183, 0x35d9fafccf45b75b, 0x3a34819d7eceec88},
+      {0xd9cf7568d33262d2, 0x431036d5841d1505, 0x0c8005659eb2a79a,
+       0x8e77d9f05f7edc6a, 0x19e12d0565e800aa, 0x335c8d36b7784e7c}},
+     {{0x75cba9d530a3ada1, 0xb69e308bf8ae9565, 0x990e3425ca7b8369,
+       0x9f67567fe0a7ad0b, 0x76ed6fe718bd01b7, 0x282358aa2ff95cfe},
+      {0x28d2ea41410f8841, 0x89d1533fccd67c81, 0x969bb272b6a7b8f9,
+       0x54f8664c26330782, 0xb89f3ae81dcd9164, 0x54d845b93d962c14}},
+     {{0x8b2fc4e96484fd40, 0xee702764a35d24ea, 0x15b28ac7b871c3f3,
+       0x805b4048e097047f, 0xd6f1b8df647cad2f, 0xf1d5b458dc7dd67f},
+      {0x324c529c25148803, 0xf6185ebe21274faf, 0xaf14751e95148b55,
+       0x283ed89d28f284f4, 0x93ad20e74cbebf1a, 0x5f6ec65d882935e1}},
+     {{0xb3984b176c0f3509, 0xf9fa4483d8b4d6bc, 0xf4ac2b677dec20d2,
+       0x67ef024eb3dbe034, 0x2dcc51180f94f4d7, 0x024cdcfd74a51393},
+      {0xf1c0fead20e7abcb, 0xffc18f81d3a7414f, 0xb00ce5567062cb0b,
+       0xeccb0521817bc8d1, 0xa0c0fe6040411c15, 0x053113221defbe00}},
+     {{0xe222eba4a4dcefe9, 0x63ad235fec1ceb74, 0x2e0bf749e05b18e7,
+       0x547bd050b48bdd87, 0x0490c970f5aa2fc4, 0xced5e4cf2b431390},
+      {0x07d8270451d2898e, 0x44b72442083b57d4, 0xa4ada2305037fce8,
+       0x55f7905e50510da6, 0xd8ee724f8d890a98, 0x925a8e7c11b85640}},
+     {{0xda828fe556467257, 0x5e9abf67d640c2a1, 0x0eed233cc25c696a,
+       0x72483dc5b3e1d84f, 0x30bf1ee34f114abc, 0xf58b321ed1f9bce8},
+      {0xcb26564c97524f33, 0xdc2f105e1e453229, 0x9da43ceb72a982dd,
+       0xecf5649dfeef8862, 0xd8afda341fa2f06d, 0xf0d0ced355035432}},
+     {{0x5bfa10cd1ca459ed, 0x593f085a6dcf56bf, 0xe6f0ad9bc0579c3e,
+       0xc11c95a22527c1ad, 0x7cfa71e1cf1cb8b3, 0xedcff8331d6dc79d},
+      {0x581c4bbe432521c9, 0xbf620096144e11a0, 0x54c38b71be3a107b,
+       0xed555e37e2606ec0, 0x3fb148b8d721d034, 0x79d53dad0091bc90}},
+     {{0xcf17f9dc08d1be5d, 0xb55de4c8afdfeb23, 0xa69454ffe437b29c,
+       0x6628d789e27ee9e2, 0x56e3b975ee3af03b, 0x0083fe9c2f532d62},
+      {0xcae15213e63e7511, 0xdb5384f386ed849c, 0x902ba959fa4d825f,
+       0xbad700d55ae17566, 0x16b2c5dc14c82eb4, 0xa4b057a736708ea7}}
+    }
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright 2011-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2011-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -32,7 +32,8 @@
 #include <openssl/opensslconf.h>
 
 /*
- * Common utility functions for ecp_nistp224.c, ecp_nistp256.c, ecp_nistp521.c.
+ * Common utility functions for ecp_nistp224.c, ecp_nistp256.c, ecp_nistp384.c
+ * and ecp_nistp521.c.
  */
 
 #include <stddef.h>
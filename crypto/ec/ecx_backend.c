@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -101,6 +101,9 @@ int ossl_ecx_key_fromdata(ECX_KEY *ecx, const OSSL_PARAM params[],
     if (param_pub_key == NULL && !ossl_ecx_public_from_private(ecx))
         return 0;
 
+    /* Any table of multiples belonged to the previous public key */
+    ossl_ed25519_precomp_free(ecx->ed25519_precomp);
+    ecx->ed25519_precomp = NULL;
     ecx->haspubkey = 1;
 
     return 1;
@@ -123,6 +126,7 @@ ECX_KEY *ossl_ecx_key_dup(const ECX_KEY *key, int selection)
     ret->haspubkey = key->haspubkey;
     ret->keylen = key->keylen;
     ret->type = key->type;
+    ret->precompute_verify = key->precompute_verify;
     ret->references = 1;
 
     if (key->propq != NULL) {
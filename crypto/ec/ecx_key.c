@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -12,6 +12,7 @@
 #include <openssl/proverr.h>
 #include "crypto/ecx.h"
 #include "internal/common.h" /* for ossl_assert() */
+#include "internal/rcu.h"
 
 #ifdef S390X_EC_ASM
 # include "s390x_arch.h"
@@ -80,6 +81,7 @@ void ossl_ecx_key_free(ECX_KEY *key)
 
     OPENSSL_free(key->propq);
     OPENSSL_secure_clear_free(key->privkey, key->keylen);
+    ossl_ed25519_precomp_free(key->ed25519_precomp);
     CRYPTO_THREAD_lock_free(key->lock);
     OPENSSL_free(key);
 }
@@ -101,6 +103,40 @@ int ossl_ecx_key_up_ref(ECX_KEY *key)
     return ((i > 1) ? 1 : 0);
 }
 
+/*
+ * Returns the multiples of the public key of an Ed25519 |key| for which
+ * verification precomputation was requested, building them on first use.
+ * Verifiers race to build the table, the first one to store it wins.
+ */
+const ED25519_PRECOMP *ossl_ecx_key_get0_ed25519_precomp(ECX_KEY *key)
+{
+    ED25519_PRECOMP *pre, *ret;
+
+    if (!key->precompute_verify || key->type != ECX_KEY_TYPE_ED25519
+            || !key->haspubkey)
+        return NULL;
+
+    if ((ret = ossl_rcu_deref(&key->ed25519_precomp)) != NULL)
+        return ret;
+
+    if ((pre = ossl_ed25519_precomp_new(key->pubkey)) == NULL)
+        return NULL;
+
+    if (!CRYPTO_THREAD_write_lock(key->lock)) {
+        ossl_ed25519_precomp_free(pre);
+        return NULL;
+    }
+    if ((ret = key->ed25519_precomp) == NULL) {
+        ossl_rcu_assign_ptr(&key->ed25519_precomp, pre);
+        ret = pre;
+        pre = NULL;
+    }
+    CRYPTO_THREAD_unlock(key->lock);
+
+    ossl_ed25519_precomp_free(pre);
+    return ret;
+}
+
 unsigned char *ossl_ecx_key_allocate_privkey(ECX_KEY *key)
 {
     key->privkey = OPENSSL_secure_zalloc(key->keylen);
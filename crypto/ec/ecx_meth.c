@@ -1,5 +1,5 @@
 /*
- * Copyright 2006-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2006-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -871,7 +871,7 @@ static int pkey_ecd_digestverify25519(EVP_MD_CTX *ctx, const unsigned char *sig,
     if (siglen != ED25519_SIGSIZE)
         return 0;
 
-    return ossl_ed25519_verify(tbs, tbslen, sig, edkey->pubkey,
+    return ossl_ed25519_verify(tbs, tbslen, sig, edkey->pubkey, NULL,
                                0, 0, 0,
                                NULL, 0,
                                edkey->libctx, edkey->propq);
@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -435,6 +435,9 @@ int ossl_decoder_store_cache_flush(OSSL_LIB_CTX *libctx)
 {
     OSSL_METHOD_STORE *store = get_decoder_store(libctx);
 
+    /* Decoder chains built with the old set of decoders are no longer valid */
+    if (!ossl_decoder_cache_flush(libctx))
+        return 0;
     if (store != NULL)
         return ossl_method_store_cache_flush_all(store);
     return 1;
@@ -445,6 +448,9 @@ int ossl_decoder_store_remove_all_provided(const OSSL_PROVIDER *prov)
     OSSL_LIB_CTX *libctx = ossl_provider_libctx(prov);
     OSSL_METHOD_STORE *store = get_decoder_store(libctx);
 
+    /* Cached decoder chains may refer to this provider's implementations */
+    if (!ossl_decoder_cache_flush(libctx))
+        return 0;
     if (store != NULL)
         return ossl_method_store_remove_all_provided(store, prov);
     return 1;
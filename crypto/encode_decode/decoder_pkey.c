@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -18,7 +18,9 @@
 #include "crypto/evp.h"
 #include "crypto/decoder.h"
 #include "crypto/evp/evp_local.h"
+#include "crypto/context.h"
 #include "encoder_local.h"
+#include "internal/cryptlib.h"
 #include "internal/namemap.h"
 
 int OSSL_DECODER_CTX_set_passphrase(OSSL_DECODER_CTX *ctx,
@@ -470,12 +472,295 @@ int ossl_decoder_ctx_setup_for_pkey(OSSL_DECODER_CTX *ctx,
     return ok;
 }
 
-OSSL_DECODER_CTX *
-OSSL_DECODER_CTX_new_for_pkey(EVP_PKEY **pkey,
+static EVP_KEYMGMT *keymgmt_dup(const EVP_KEYMGMT *keymgmt)
+{
+    if (!EVP_KEYMGMT_up_ref((EVP_KEYMGMT *)keymgmt))
+        return NULL;
+
+    return (EVP_KEYMGMT *)keymgmt;
+}
+
+static OSSL_DECODER_CTX *
+ossl_decoder_ctx_for_pkey_dup(OSSL_DECODER_CTX *src,
+                              EVP_PKEY **pkey,
                               const char *input_type,
-                              const char *input_structure,
-                              const char *keytype, int selection,
-                              OSSL_LIB_CTX *libctx, const char *propquery)
+                              const char *input_structure)
+{
+    OSSL_DECODER_CTX *dest;
+    struct decoder_pkey_data_st *process_data_src, *process_data_dest = NULL;
+
+    if (src == NULL)
+        return NULL;
+
+    if ((dest = OSSL_DECODER_CTX_new()) == NULL) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        return NULL;
+    }
+
+    if (!OSSL_DECODER_CTX_set_input_type(dest, input_type)
+            || !OSSL_DECODER_CTX_set_input_structure(dest, input_structure)) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        goto err;
+    }
+    dest->selection = src->selection;
+
+    if (src->decoder_insts != NULL) {
+        dest->decoder_insts
+            = sk_OSSL_DECODER_INSTANCE_deep_copy(src->decoder_insts,
+                                                 ossl_decoder_instance_dup,
+                                                 ossl_decoder_instance_free);
+        if (dest->decoder_insts == NULL) {
+            ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+            goto err;
+        }
+    }
+
+    if (!OSSL_DECODER_CTX_set_construct(dest,
+                                        OSSL_DECODER_CTX_get_construct(src))) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        goto err;
+    }
+
+    process_data_src = OSSL_DECODER_CTX_get_construct_data(src);
+    if (process_data_src != NULL) {
+        process_data_dest = OPENSSL_zalloc(sizeof(*process_data_dest));
+        if (process_data_dest == NULL) {
+            ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_CRYPTO_LIB);
+            goto err;
+        }
+        if (process_data_src->propq != NULL) {
+            process_data_dest->propq = OPENSSL_strdup(process_data_src->propq);
+            if (process_data_dest->propq == NULL) {
+                ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_CRYPTO_LIB);
+                goto err;
+            }
+        }
+
+        if (process_data_src->keymgmts != NULL) {
+            process_data_dest->keymgmts
+                = sk_EVP_KEYMGMT_deep_copy(process_data_src->keymgmts,
+                                           keymgmt_dup,
+                                           EVP_KEYMGMT_free);
+            if (process_data_dest->keymgmts == NULL) {
+                ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_EVP_LIB);
+                goto err;
+            }
+        }
+
+        process_data_dest->object    = (void **)pkey;
+        process_data_dest->libctx    = process_data_src->libctx;
+        process_data_dest->selection = process_data_src->selection;
+        if (!OSSL_DECODER_CTX_set_construct_data(dest, process_data_dest)) {
+            ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+            goto err;
+        }
+        process_data_dest = NULL;
+    }
+
+    if (!OSSL_DECODER_CTX_set_cleanup(dest,
+                                      OSSL_DECODER_CTX_get_cleanup(src))) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        goto err;
+    }
+
+    return dest;
+ err:
+    decoder_clean_pkey_construct_arg(process_data_dest);
+    OSSL_DECODER_CTX_free(dest);
+    return NULL;
+}
+
+/*
+ * Building the decoder chain for OSSL_DECODER_CTX_new_for_pkey() means
+ * enumerating every keymgmt and decoder, so the result is cached per library
+ * context as a template OSSL_DECODER_CTX, keyed by the parameters that
+ * determine it.  The cache is flushed whenever the set of available decoders
+ * changes, i.e. when a provider is activated or deactivated.
+ */
+#define DECODER_CACHE_MAX_ENTRIES   1024
+
+typedef struct {
+    char *input_type;
+    char *input_structure;
+    char *keytype;
+    int selection;
+    char *propquery;
+    OSSL_DECODER_CTX *template;
+} DECODER_CACHE_ENTRY;
+
+DEFINE_LHASH_OF_EX(DECODER_CACHE_ENTRY);
+
+typedef struct {
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(DECODER_CACHE_ENTRY) *hashtable;
+    /* Incremented on each flush, to detect entries built across a flush */
+    unsigned int generation;
+} DECODER_CACHE;
+
+static void decoder_cache_entry_free(DECODER_CACHE_ENTRY *entry)
+{
+    if (entry == NULL)
+        return;
+    OPENSSL_free(entry->input_type);
+    OPENSSL_free(entry->input_structure);
+    OPENSSL_free(entry->keytype);
+    OPENSSL_free(entry->propquery);
+    OSSL_DECODER_CTX_free(entry->template);
+    OPENSSL_free(entry);
+}
+
+static unsigned long decoder_cache_entry_hash(const DECODER_CACHE_ENTRY *entry)
+{
+    unsigned long hash = 17;
+
+    hash = (hash * 23)
+           + (entry->propquery == NULL
+              ? 0 : OPENSSL_LH_strhash(entry->propquery));
+    hash = (hash * 23)
+           + (entry->input_structure == NULL
+              ? 0 : OPENSSL_LH_strhash(entry->input_structure));
+    hash = (hash * 23)
+           + (entry->input_type == NULL
+              ? 0 : OPENSSL_LH_strhash(entry->input_type));
+    hash = (hash * 23)
+           + (entry->keytype == NULL
+              ? 0 : OPENSSL_LH_strhash(entry->keytype));
+
+    hash ^= entry->selection;
+
+    return hash;
+}
+
+static ossl_inline int nullstrcmp(const char *a, const char *b)
+{
+    if (a == NULL || b == NULL) {
+        if (a == NULL) {
+            if (b == NULL)
+                return 0;
+            else
+                return 1;
+        } else {
+            return -1;
+        }
+    }
+    return strcmp(a, b);
+}
+
+static int decoder_cache_entry_cmp(const DECODER_CACHE_ENTRY *a,
+                                   const DECODER_CACHE_ENTRY *b)
+{
+    int cmp;
+
+    if (a->selection != b->selection)
+        return a->selection < b->selection ? -1 : 1;
+
+    cmp = nullstrcmp(a->keytype, b->keytype);
+    if (cmp != 0)
+        return cmp;
+
+    cmp = nullstrcmp(a->input_type, b->input_type);
+    if (cmp != 0)
+        return cmp;
+
+    cmp = nullstrcmp(a->input_structure, b->input_structure);
+    if (cmp != 0)
+        return cmp;
+
+    return nullstrcmp(a->propquery, b->propquery);
+}
+
+void *ossl_decoder_cache_new(OSSL_LIB_CTX *ctx)
+{
+    DECODER_CACHE *cache = OPENSSL_malloc(sizeof(*cache));
+
+    if (cache == NULL)
+        return NULL;
+
+    cache->generation = 0;
+    cache->lock = CRYPTO_THREAD_lock_new();
+    if (cache->lock == NULL) {
+        OPENSSL_free(cache);
+        return NULL;
+    }
+    cache->hashtable = lh_DECODER_CACHE_ENTRY_new(decoder_cache_entry_hash,
+                                                  decoder_cache_entry_cmp);
+    if (cache->hashtable == NULL) {
+        CRYPTO_THREAD_lock_free(cache->lock);
+        OPENSSL_free(cache);
+        return NULL;
+    }
+
+    return cache;
+}
+
+void ossl_decoder_cache_free(void *vcache)
+{
+    DECODER_CACHE *cache = (DECODER_CACHE *)vcache;
+
+    lh_DECODER_CACHE_ENTRY_doall(cache->hashtable, decoder_cache_entry_free);
+    lh_DECODER_CACHE_ENTRY_free(cache->hashtable);
+    CRYPTO_THREAD_lock_free(cache->lock);
+    OPENSSL_free(cache);
+}
+
+/*
+ * Called whenever a provider gets activated/deactivated. In that case the
+ * decoders that are available might change so we flush our cache.
+ */
+int ossl_decoder_cache_flush(OSSL_LIB_CTX *libctx)
+{
+    DECODER_CACHE *cache
+        = ossl_lib_ctx_get_data(libctx, OSSL_LIB_CTX_DECODER_CACHE_INDEX);
+
+    if (cache == NULL)
+        return 0;
+
+    if (!CRYPTO_THREAD_write_lock(cache->lock)) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        return 0;
+    }
+
+    lh_DECODER_CACHE_ENTRY_doall(cache->hashtable, decoder_cache_entry_free);
+    lh_DECODER_CACHE_ENTRY_flush(cache->hashtable);
+    cache->generation++;
+
+    CRYPTO_THREAD_unlock(cache->lock);
+    return 1;
+}
+
+static DECODER_CACHE_ENTRY *
+decoder_cache_entry_new(const char *input_type, const char *input_structure,
+                        const char *keytype, int selection,
+                        const char *propquery)
+{
+    DECODER_CACHE_ENTRY *entry = OPENSSL_zalloc(sizeof(*entry));
+
+    if (entry == NULL)
+        return NULL;
+
+    entry->selection = selection;
+    if ((input_type != NULL
+         && (entry->input_type = OPENSSL_strdup(input_type)) == NULL)
+        || (input_structure != NULL
+            && (entry->input_structure
+                = OPENSSL_strdup(input_structure)) == NULL)
+        || (keytype != NULL
+            && (entry->keytype = OPENSSL_strdup(keytype)) == NULL)
+        || (propquery != NULL
+            && (entry->propquery = OPENSSL_strdup(propquery)) == NULL)) {
+        decoder_cache_entry_free(entry);
+        return NULL;
+    }
+
+    return entry;
+}
+
+static OSSL_DECODER_CTX *
+decoder_ctx_new_for_pkey_int(EVP_PKEY **pkey,
+                             const char *input_type,
+                             const char *input_structure,
+                             const char *keytype, int selection,
+                             OSSL_LIB_CTX *libctx, const char *propquery)
 {
     OSSL_DECODER_CTX *ctx = NULL;
 
@@ -508,3 +793,95 @@ OSSL_DECODER_CTX_new_for_pkey(EVP_PKEY **pkey,
     OSSL_DECODER_CTX_free(ctx);
     return NULL;
 }
+
+OSSL_DECODER_CTX *
+OSSL_DECODER_CTX_new_for_pkey(EVP_PKEY **pkey,
+                              const char *input_type,
+                              const char *input_structure,
+                              const char *keytype, int selection,
+                              OSSL_LIB_CTX *libctx, const char *propquery)
+{
+    OSSL_DECODER_CTX *ctx = NULL;
+    DECODER_CACHE *cache
+        = ossl_lib_ctx_get_data(libctx, OSSL_LIB_CTX_DECODER_CACHE_INDEX);
+    DECODER_CACHE_ENTRY cacheent, *res, *newcache = NULL;
+    unsigned int generation;
+
+    if (cache == NULL) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_OSSL_DECODER_LIB);
+        return NULL;
+    }
+
+    /* It is safe to cast away the const here */
+    cacheent.input_type = (char *)input_type;
+    cacheent.input_structure = (char *)input_structure;
+    cacheent.keytype = (char *)keytype;
+    cacheent.selection = selection;
+    cacheent.propquery = (char *)propquery;
+
+    if (!CRYPTO_THREAD_read_lock(cache->lock)) {
+        ERR_raise(ERR_LIB_OSSL_DECODER, ERR_R_CRYPTO_LIB);
+        return NULL;
+    }
+
+    res = lh_DECODER_CACHE_ENTRY_retrieve(cache->hashtable, &cacheent);
+    if (res != NULL)
+        ctx = ossl_decoder_ctx_for_pkey_dup(res->template, pkey, input_type,
+                                            input_structure);
+    generation = cache->generation;
+    CRYPTO_THREAD_unlock(cache->lock);
+
+    if (res != NULL)
+        return ctx;
+
+    /* Not cached yet, build a template without holding the lock */
+    newcache = decoder_cache_entry_new(input_type, input_structure, keytype,
+                                       selection, propquery);
+    if (newcache == NULL)
+        return NULL;
+
+    newcache->template
+        = decoder_ctx_new_for_pkey_int(NULL, newcache->input_type,
+                                       newcache->input_structure,
+                                       newcache->keytype, selection, libctx,
+                                       newcache->propquery);
+    if (newcache->template == NULL) {
+        decoder_cache_entry_free(newcache);
+        return NULL;
+    }
+
+    ctx = ossl_decoder_ctx_for_pkey_dup(newcache->template, pkey, input_type,
+                                        input_structure);
+    if (ctx == NULL) {
+        decoder_cache_entry_free(newcache);
+        return NULL;
+    }
+
+    if (!CRYPTO_THREAD_write_lock(cache->lock)) {
+        decoder_cache_entry_free(newcache);
+        return ctx;
+    }
+
+    /*
+     * Only keep the template if the cache hasn't been flushed while it was
+     * being built, and no other thread got there first.  Failing to cache it
+     * isn't an error.
+     */
+    if (cache->generation == generation
+            && lh_DECODER_CACHE_ENTRY_retrieve(cache->hashtable,
+                                               newcache) == NULL) {
+        if (lh_DECODER_CACHE_ENTRY_num_items(cache->hashtable)
+                >= DECODER_CACHE_MAX_ENTRIES) {
+            lh_DECODER_CACHE_ENTRY_doall(cache->hashtable,
+                                         decoder_cache_entry_free);
+            lh_DECODER_CACHE_ENTRY_flush(cache->hashtable);
+        }
+        (void)lh_DECODER_CACHE_ENTRY_insert(cache->hashtable, newcache);
+        if (!lh_DECODER_CACHE_ENTRY_error(cache->hashtable))
+            newcache = NULL;
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+
+    decoder_cache_entry_free(newcache);
+    return ctx;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -690,7 +690,7 @@ ERR_STATE *ossl_err_get_state_int(void)
             return NULL;
 
         /* calling CRYPTO_zalloc(.., NULL, 0) prevents mem alloc error loop */
-        state = CRYPTO_zalloc(sizeof(*state), NULL, 0);
+        state = CRYPTO_zalloc(sizeof(ERR_STATE_INT), NULL, 0);
         if (state == NULL) {
             CRYPTO_THREAD_set_local(&err_thread_local, NULL);
             return NULL;
@@ -833,12 +833,16 @@ void ERR_add_error_vdata(int num, va_list args)
     i = es->top;
 
     /*
-     * If err_data is allocated already, re-use the space.
+     * If err_data is allocated already, re-use the space.  This includes
+     * a buffer left behind by a previous error in this slot.
      * Otherwise, allocate a small new buffer.
      */
-    if ((es->err_data_flags[i] & flags) == flags) {
+    if ((es->err_data_flags[i] & ERR_TXT_MALLOCED) != 0
+            && es->err_data[i] != NULL && es->err_data_size[i] > 0) {
         str = es->err_data[i];
         size = es->err_data_size[i];
+        if ((es->err_data_flags[i] & ERR_TXT_STRING) == 0)
+            str[0] = '\0';
 
         /*
          * To protect the string we just grabbed from tampering by other
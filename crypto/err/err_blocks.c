@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -60,11 +60,25 @@ void ERR_vset_error(int lib, int reason, const char *fmt, va_list args)
     i = es->top;
 
     if (fmt != NULL) {
-        int printed_len = 0;
-        char *rbuf = NULL;
+        char tmp[ERR_MAX_DATA_SIZE];
+        int printed_len;
+
+        /*
+         * Format on the stack first, so that the buffer already held by this
+         * slot can be reused when it is large enough.  In steady state this
+         * avoids any allocation.
+         */
+        printed_len = BIO_vsnprintf(tmp, sizeof(tmp), fmt, args);
+        if (printed_len < 0)
+            printed_len = 0;
+        tmp[printed_len] = '\0';
 
         buf = es->err_data[i];
         buf_size = es->err_data_size[i];
+        if ((es->err_data_flags[i] & ERR_TXT_MALLOCED) == 0) {
+            buf = NULL;
+            buf_size = 0;
+        }
 
         /*
          * To protect the string we just grabbed from tampering by other
@@ -76,38 +90,23 @@ void ERR_vset_error(int lib, int reason, const char *fmt, va_list args)
         es->err_data[i] = NULL;
         es->err_data_flags[i] = 0;
 
-        /*
-         * Try to maximize the space available.  If that fails, we use what
-         * we have.
-         */
-        if (buf_size < ERR_MAX_DATA_SIZE
-            && (rbuf = OPENSSL_realloc(buf, ERR_MAX_DATA_SIZE)) != NULL) {
-            buf = rbuf;
-            buf_size = ERR_MAX_DATA_SIZE;
+        if (buf_size < (size_t)printed_len + 1) {
+            char *rbuf = OPENSSL_realloc(buf, printed_len + 1);
+
+            if (rbuf == NULL) {
+                OPENSSL_free(buf);
+                buf = NULL;
+                buf_size = 0;
+            } else {
+                buf = rbuf;
+                buf_size = printed_len + 1;
+            }
         }
 
         if (buf != NULL) {
-            printed_len = BIO_vsnprintf(buf, buf_size, fmt, args);
-        }
-        if (printed_len < 0)
-            printed_len = 0;
-        if (buf != NULL)
-            buf[printed_len] = '\0';
-
-        /*
-         * Try to reduce the size, but only if we maximized above.  If that
-         * fails, we keep what we have.
-         * (According to documentation, realloc leaves the old buffer untouched
-         * if it fails)
-         */
-        if ((rbuf = OPENSSL_realloc(buf, printed_len + 1)) != NULL) {
-            buf = rbuf;
-            buf_size = printed_len + 1;
-            buf[printed_len] = '\0';
-        }
-
-        if (buf != NULL)
+            memcpy(buf, tmp, printed_len + 1);
             flags = ERR_TXT_MALLOCED | ERR_TXT_STRING;
+        }
     }
 
     err_clear_data(es, es->top, 0);
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -11,6 +11,56 @@
 #include <openssl/err.h>
 #include <openssl/e_os2.h>
 
+/*
+ * Sizes of the per slot buffers holding the file and function names of an
+ * error.  Longer names are allocated separately.
+ */
+#define ERR_FILE_BUF_SIZE   128
+#define ERR_FUNC_BUF_SIZE   64
+
+/*
+ * The thread local error state.  The file and function names passed with an
+ * error are copied into the buffers here rather than allocated, so raising an
+ * error and popping it again, e.g. with ERR_set_mark() and ERR_pop_to_mark(),
+ * doesn't cost any allocation.
+ */
+typedef struct err_state_int_st {
+    ERR_STATE es;
+    char file_buf[ERR_NUM_ERRORS][ERR_FILE_BUF_SIZE];
+    char func_buf[ERR_NUM_ERRORS][ERR_FUNC_BUF_SIZE];
+} ERR_STATE_INT;
+
+static ossl_inline ERR_STATE_INT *err_state_int(ERR_STATE *es)
+{
+    return (ERR_STATE_INT *)es;
+}
+
+static ossl_inline void err_free_debug_str(char **str, char *buf)
+{
+    if (*str != buf)
+        OPENSSL_free(*str);
+    *str = NULL;
+}
+
+static ossl_inline void err_set_debug_str(char **str, const char *src,
+                                          char *buf, size_t buf_size)
+{
+    size_t len;
+
+    err_free_debug_str(str, buf);
+    if (src == NULL || src[0] == '\0')
+        return;
+
+    len = strlen(src) + 1;
+    if (len <= buf_size)
+        *str = buf;
+    else
+        /* calling CRYPTO_malloc(.., NULL, 0) prevents mem alloc error loop */
+        *str = CRYPTO_malloc(len, NULL, 0);
+    if (*str != NULL)
+        memcpy(*str, src, len);
+}
+
 static ossl_inline void err_get_slot(ERR_STATE *es)
 {
     es->top = (es->top + 1) % ERR_NUM_ERRORS;
@@ -50,24 +100,17 @@ static ossl_inline void err_set_debug(ERR_STATE *es, size_t i,
                                       const char *file, int line,
                                       const char *fn)
 {
+    ERR_STATE_INT *esi = err_state_int(es);
+
     /*
-     * We dup the file and fn strings because they may be provider owned. If the
-     * provider gets unloaded, they may not be valid anymore.
+     * We copy the file and fn strings because they may be provider owned. If
+     * the provider gets unloaded, they may not be valid anymore.
      */
-    OPENSSL_free(es->err_file[i]);
-    if (file == NULL || file[0] == '\0')
-        es->err_file[i] = NULL;
-    else if ((es->err_file[i] = CRYPTO_malloc(strlen(file) + 1,
-                                              NULL, 0)) != NULL)
-        /* We cannot use OPENSSL_strdup due to possible recursion */
-        strcpy(es->err_file[i], file);
-
+    err_set_debug_str(&es->err_file[i], file, esi->file_buf[i],
+                      sizeof(esi->file_buf[i]));
     es->err_line[i] = line;
-    OPENSSL_free(es->err_func[i]);
-    if (fn == NULL || fn[0] == '\0')
-        es->err_func[i] = NULL;
-    else
-        es->err_func[i] = OPENSSL_strdup(fn);
+    err_set_debug_str(&es->err_func[i], fn, esi->func_buf[i],
+                      sizeof(esi->func_buf[i]));
 }
 
 static ossl_inline void err_set_data(ERR_STATE *es, size_t i,
@@ -82,15 +125,15 @@ static ossl_inline void err_set_data(ERR_STATE *es, size_t i,
 
 static ossl_inline void err_clear(ERR_STATE *es, size_t i, int deall)
 {
+    ERR_STATE_INT *esi = err_state_int(es);
+
     err_clear_data(es, i, (deall));
     es->err_marks[i] = 0;
     es->err_flags[i] = 0;
     es->err_buffer[i] = 0;
     es->err_line[i] = -1;
-    OPENSSL_free(es->err_file[i]);
-    es->err_file[i] = NULL;
-    OPENSSL_free(es->err_func[i]);
-    es->err_func[i] = NULL;
+    err_free_debug_str(&es->err_file[i], esi->file_buf[i]);
+    err_free_debug_str(&es->err_func[i], esi->func_buf[i]);
 }
 
 ERR_STATE *ossl_err_get_state_int(void);
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -700,6 +700,49 @@ int EVP_Digest(const void *data, size_t count,
     return ret;
 }
 
+int EVP_Digest_many(const void *const data[], const size_t count[],
+                    unsigned char *const md[], size_t num,
+                    const EVP_MD *type, ENGINE *impl)
+{
+    EVP_MD_CTX *ctx;
+    const EVP_MD *digest;
+    size_t i;
+    int ret, size;
+
+    if (num == 0)
+        return 1;
+    if (data == NULL || count == NULL || md == NULL) {
+        ERR_raise(ERR_LIB_EVP, ERR_R_PASSED_NULL_PARAMETER);
+        return 0;
+    }
+
+    ctx = EVP_MD_CTX_new();
+    if (ctx == NULL)
+        return 0;
+    EVP_MD_CTX_set_flags(ctx, EVP_MD_CTX_FLAG_ONESHOT);
+    ret = EVP_DigestInit_ex(ctx, type, impl);
+    if (!ret)
+        goto end;
+
+    digest = ctx->digest;
+    if (digest->prov != NULL && digest->digest_many != NULL
+            && (size = EVP_MD_get_size(digest)) > 0) {
+        ret = digest->digest_many(ossl_provider_ctx(digest->prov), num,
+                                  (const unsigned char *const *)data, count,
+                                  md, (size_t)size);
+        goto end;
+    }
+
+    /* No native support, hash the messages one at a time on one context */
+    for (i = 0; ret && i < num; i++)
+        ret = (i == 0 || EVP_DigestInit_ex(ctx, NULL, NULL))
+            && EVP_DigestUpdate(ctx, data[i], count[i])
+            && EVP_DigestFinal_ex(ctx, md[i], NULL);
+ end:
+    EVP_MD_CTX_free(ctx);
+    return ret;
+}
+
 int EVP_Q_digest(OSSL_LIB_CTX *libctx, const char *name, const char *propq,
                  const void *data, size_t datalen,
                  unsigned char *md, size_t *mdlen)
@@ -1032,6 +1075,11 @@ static void *evp_md_from_algorithm(int name_id,
                 md->digest = OSSL_FUNC_digest_digest(fns);
             /* We don't increment fnct for this as it is stand alone */
             break;
+        case OSSL_FUNC_DIGEST_DIGEST_MANY:
+            if (md->digest_many == NULL)
+                md->digest_many = OSSL_FUNC_digest_digest_many(fns);
+            /* Stand alone as well */
+            break;
         case OSSL_FUNC_DIGEST_FREECTX:
             if (md->freectx == NULL) {
                 md->freectx = OSSL_FUNC_digest_freectx(fns);
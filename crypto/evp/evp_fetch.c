@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -18,6 +18,7 @@
 #include "internal/provider.h"
 #include "internal/namemap.h"
 #include "crypto/evp.h"    /* evp_local.h needs it */
+#include "crypto/decoder.h"
 #include "evp_local.h"
 
 #define NAME_SEPARATOR ':'
@@ -455,8 +456,18 @@ static int evp_set_parsed_default_properties(OSSL_LIB_CTX *libctx,
 #endif
         ossl_property_free(*plp);
         *plp = def_prop;
-        if (store != NULL)
-            return ossl_method_store_cache_flush_all(store);
+
+        /*
+         * The cached methods and decoder chains were selected with the old
+         * properties.  |def_prop| is installed by now, so failing to flush
+         * them must not be reported as failure: the caller would free it.
+         */
+        if (!ossl_method_store_cache_flush_all(store))
+            ERR_raise(ERR_LIB_EVP, ERR_R_UNABLE_TO_GET_WRITE_LOCK);
+#ifndef FIPS_MODULE
+        (void)ossl_decoder_cache_flush(libctx);
+#endif
+        return 1;
     }
     ERR_raise(ERR_LIB_EVP, ERR_R_INTERNAL_ERROR);
     return 0;
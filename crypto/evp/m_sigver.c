@@ -1,5 +1,5 @@
 /*
- * Copyright 2006-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2006-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -64,7 +64,8 @@ static int do_sigver_init(EVP_MD_CTX *ctx, EVP_PKEY_CTX **pctx,
     if (ctx->pctx == NULL)
         return 0;
 
-    EVP_MD_CTX_clear_flags(ctx, EVP_MD_CTX_FLAG_FINALISED);
+    EVP_MD_CTX_clear_flags(ctx, EVP_MD_CTX_FLAG_FINALISED
+                                | EVP_MD_CTX_FLAG_UPDATED);
 
     locpctx = ctx->pctx;
     ERR_set_mark();
@@ -442,6 +443,7 @@ int EVP_DigestVerifyUpdate(EVP_MD_CTX *ctx, const void *data, size_t dsize)
         ERR_raise(ERR_LIB_EVP, EVP_R_UPDATE_ERROR);
         return 0;
     }
+    ctx->flags |= EVP_MD_CTX_FLAG_UPDATED;
 
     if (pctx == NULL
             || pctx->operation != EVP_PKEY_OP_VERIFYCTX
@@ -715,4 +717,59 @@ int EVP_DigestVerify(EVP_MD_CTX *ctx, const unsigned char *sigret,
         return -1;
     return EVP_DigestVerifyFinal(ctx, sigret, siglen);
 }
+
+int EVP_DigestVerifyBatch(EVP_MD_CTX *ctx, const unsigned char *const sigs[],
+                          const size_t siglens[],
+                          const unsigned char *const tbs[],
+                          const size_t tbslens[], size_t num)
+{
+    EVP_PKEY_CTX *pctx = ctx->pctx;
+    EVP_MD_CTX *tmp_ctx;
+    size_t i;
+    int r = 1;
+
+    if ((ctx->flags & EVP_MD_CTX_FLAG_FINALISED) != 0) {
+        ERR_raise(ERR_LIB_EVP, EVP_R_FINAL_ERROR);
+        return 0;
+    }
+    /* The batch would otherwise be verified as a suffix of that data */
+    if ((ctx->flags & EVP_MD_CTX_FLAG_UPDATED) != 0) {
+        ERR_raise(ERR_LIB_EVP, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+    if (pctx == NULL) {
+        ERR_raise(ERR_LIB_EVP, EVP_R_INITIALIZATION_ERROR);
+        return -1;
+    }
+    if (num == 0)
+        return 1;
+    if (sigs == NULL || siglens == NULL || tbs == NULL || tbslens == NULL) {
+        ERR_raise(ERR_LIB_EVP, ERR_R_PASSED_NULL_PARAMETER);
+        return -1;
+    }
+
+    if (pctx->operation == EVP_PKEY_OP_VERIFYCTX
+            && pctx->op.sig.algctx != NULL
+            && pctx->op.sig.signature != NULL
+            && pctx->op.sig.signature->digest_verify_batch != NULL)
+        return pctx->op.sig.signature->digest_verify_batch(pctx->op.sig.algctx,
+                                                           sigs, siglens,
+                                                           tbs, tbslens, num);
+
+    /*
+     * The provider cannot verify batches itself, so verify each signature
+     * on a copy of |ctx| which leaves |ctx| usable for further batches.
+     */
+    if ((tmp_ctx = EVP_MD_CTX_new()) == NULL)
+        return -1;
+    for (i = 0; i < num && r == 1; i++) {
+        if (!EVP_MD_CTX_copy_ex(tmp_ctx, ctx)) {
+            r = -1;
+            break;
+        }
+        r = EVP_DigestVerify(tmp_ctx, sigs[i], siglens[i], tbs[i], tbslens[i]);
+    }
+    EVP_MD_CTX_free(tmp_ctx);
+    return r;
+}
 #endif /* FIPS_MODULE */
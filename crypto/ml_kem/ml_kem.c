@@ -0,0 +1,971 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * ML-KEM, the Module-Lattice-Based Key-Encapsulation Mechanism of NIST
+ * FIPS 203.
+ *
+ * Polynomial coefficients are kept as signed 16-bit values and reduced
+ * lazily: products are brought back into (-q, q) with a Montgomery
+ * reduction (R = 2^16) and sums with a Barrett reduction, as in the
+ * reference implementation.  Only the encodings are canonical.  The NTT,
+ * its inverse and the NTT-domain multiplication have AVX2 versions on
+ * x86_64.
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include <openssl/core_dispatch.h>
+#include "internal/constant_time.h"
+#include "internal/nelem.h"
+#include "internal/sha3.h"
+#include "crypto/ml_kem.h"
+
+#define DEGREE          256
+#define Q               3329
+#define QINV            -3327           /* q^-1 mod 2^16 */
+#define BARRETT_V       20159           /* round(2^26 / q) */
+#define MONT_SQ         1353            /* 2^32 mod q */
+#define INVNTT_F        1441            /* 2^32 / 128 mod q */
+#define POLY_BYTES      384             /* 12 bits per coefficient */
+#define SYM_BYTES       32
+#define MAX_K           4
+#define MAX_ETA         3
+
+#define SHAKE128_RATE   168
+#define SHAKE256_RATE   136
+/* Enough for 256 coefficients with overwhelming probability */
+#define XOF_BYTES       (3 * SHAKE128_RATE)
+
+typedef struct {
+    int16_t c[DEGREE];
+} POLY;
+
+struct ml_kem_key_st {
+    const ML_KEM_VINFO *vinfo;
+    OSSL_LIB_CTX *libctx;
+    POLY *polys;                /* t, then m, then s */
+    POLY *t;                    /* k polynomials, NTT domain */
+    POLY *m;                    /* the k x k matrix A-hat, row by row */
+    POLY *s;                    /* k polynomials, NTT domain */
+    uint8_t rho[SYM_BYTES];
+    uint8_t pkhash[SYM_BYTES];  /* H(ek) */
+    uint8_t z[SYM_BYTES];       /* implicit rejection secret */
+    uint8_t seed[ML_KEM_SEED_BYTES];
+    unsigned int have_pub:1;
+    unsigned int have_prv:1;
+    unsigned int have_seed:1;
+};
+
+static const ML_KEM_VINFO vinfo_map[] = {
+    { "ML-KEM-512", ML_KEM_512, 512, 128, 2, 3, 10, 4, 800, 1632, 768 },
+    { "ML-KEM-768", ML_KEM_768, 768, 192, 3, 2, 10, 4, 1184, 2400, 1088 },
+    { "ML-KEM-1024", ML_KEM_1024, 1024, 256, 4, 2, 11, 5, 1568, 3168, 1568 }
+};
+
+/* Powers of 17 in bit-reversed order, in Montgomery form */
+static const int16_t zetas[128] = {
+    -1044,  -758,  -359, -1517,  1493,  1422,   287,   202,
+     -171,   622,  1577,   182,   962, -1202, -1474,  1468,
+      573, -1325,   264,   383,  -829,  1458, -1602,  -130,
+     -681,  1017,   732,   608, -1542,   411,  -205, -1571,
+     1223,   652,  -552,  1015, -1293,  1491,  -282, -1544,
+      516,    -8,  -320,  -666, -1618, -1162,   126,  1469,
+     -853,   -90,  -271,   830,   107, -1421,  -247,  -951,
+     -398,   961, -1508,  -725,   448, -1065,   677, -1275,
+    -1103,   430,   555,   843, -1251,   871,  1550,   105,
+      422,   587,   177,  -235,  -291,  -460,  1574,  1653,
+     -246,   778,  1159,  -147,  -777,  1483,  -602,  1119,
+    -1590,   644,  -872,   349,   418,   329,  -156,   -75,
+      817,  1097,   603,   610,  1322, -1285, -1465,   384,
+    -1215,  -136,  1218, -1335,  -874,   220, -1187, -1659,
+    -1185, -1530, -1278,   794, -1510,  -854,  -870,   478,
+     -108,  -308,   996,   991,   958, -1460,  1522,  1628
+};
+
+#ifdef ML_KEM_ASM
+int ossl_ml_kem_avx2_capable(void);
+void ossl_ml_kem_ntt_avx2(int16_t r[DEGREE]);
+void ossl_ml_kem_invntt_avx2(int16_t r[DEGREE]);
+void ossl_ml_kem_basemul_avx2(int16_t r[DEGREE], const int16_t a[DEGREE],
+                              const int16_t b[DEGREE]);
+#endif
+
+/*-
+ * Field arithmetic
+ * ================
+ */
+
+/* Returns a value congruent to a * 2^-16 in (-q, q), for |a| < q * 2^15 */
+static ossl_inline int16_t montgomery_reduce(int32_t a)
+{
+    int16_t t = (int16_t)((uint32_t)a * (uint32_t)QINV);
+
+    return (int16_t)((a - (int32_t)t * Q) >> 16);
+}
+
+/* Returns the representative of a in [-(q-1)/2, (q-1)/2] */
+static ossl_inline int16_t barrett_reduce(int16_t a)
+{
+    int16_t t = (int16_t)(((int32_t)BARRETT_V * a + (1 << 25)) >> 26);
+
+    return a - t * Q;
+}
+
+static ossl_inline int16_t fqmul(int16_t a, int16_t b)
+{
+    return montgomery_reduce((int32_t)a * b);
+}
+
+/* Maps a value in (-q, q) to [0, q) */
+static ossl_inline uint16_t to_unsigned(int16_t a)
+{
+    return (uint16_t)(a + ((a >> 15) & Q));
+}
+
+/* round(2^d * x / q) mod 2^d for x in [0, q), d <= 11, in constant time */
+static ossl_inline uint32_t compress(uint16_t x, int d)
+{
+    uint64_t n = ((uint64_t)x << d) + (Q - 1) / 2;
+
+    return (uint32_t)((n * 1290168) >> 32) & ((1U << d) - 1);
+}
+
+static ossl_inline int16_t decompress(uint32_t y, int d)
+{
+    return (int16_t)((y * Q + (1U << (d - 1))) >> d);
+}
+
+/*-
+ * Polynomials
+ * ===========
+ */
+
+static void ntt(int16_t r[DEGREE])
+{
+    unsigned int len, start, j, k = 1;
+    int16_t t, zeta;
+
+    for (len = 128; len >= 2; len >>= 1) {
+        for (start = 0; start < DEGREE; start = j + len) {
+            zeta = zetas[k++];
+            for (j = start; j < start + len; j++) {
+                t = fqmul(zeta, r[j + len]);
+                r[j + len] = r[j] - t;
+                r[j] = r[j] + t;
+            }
+        }
+    }
+}
+
+/* The inverse NTT, which also multiplies by the Montgomery factor 2^16 */
+static void invntt(int16_t r[DEGREE])
+{
+    unsigned int len, start, j, k = 127;
+    int16_t t, zeta;
+
+    for (len = 2; len <= 128; len <<= 1) {
+        for (start = 0; start < DEGREE; start = j + len) {
+            zeta = zetas[k--];
+            for (j = start; j < start + len; j++) {
+                t = r[j];
+                r[j] = barrett_reduce(t + r[j + len]);
+                r[j + len] = fqmul(zeta, r[j + len] - t);
+            }
+        }
+    }
+    for (j = 0; j < DEGREE; j++)
+        r[j] = fqmul(r[j], INVNTT_F);
+}
+
+/* Multiplication in Z_q[X] / (X^2 - zeta) */
+static ossl_inline void basemul(int16_t r[2], const int16_t a[2],
+                                const int16_t b[2], int16_t zeta)
+{
+    r[0] = fqmul(fqmul(a[1], b[1]), zeta) + fqmul(a[0], b[0]);
+    r[1] = fqmul(a[0], b[1]) + fqmul(a[1], b[0]);
+}
+
+static void poly_reduce(POLY *p)
+{
+    int i;
+
+    for (i = 0; i < DEGREE; i++)
+        p->c[i] = barrett_reduce(p->c[i]);
+}
+
+static void poly_add(POLY *r, const POLY *a)
+{
+    int i;
+
+    for (i = 0; i < DEGREE; i++)
+        r->c[i] += a->c[i];
+}
+
+static void poly_sub(POLY *r, const POLY *a, const POLY *b)
+{
+    int i;
+
+    for (i = 0; i < DEGREE; i++)
+        r->c[i] = a->c[i] - b->c[i];
+}
+
+static void poly_tomont(POLY *p)
+{
+    int i;
+
+    for (i = 0; i < DEGREE; i++)
+        p->c[i] = fqmul(p->c[i], MONT_SQ);
+}
+
+/* Output coefficients are in [-(q-1)/2, (q-1)/2] */
+static void poly_ntt(POLY *p)
+{
+#ifdef ML_KEM_ASM
+    if (ossl_ml_kem_avx2_capable())
+        ossl_ml_kem_ntt_avx2(p->c);
+    else
+#endif
+        ntt(p->c);
+    poly_reduce(p);
+}
+
+/* Output coefficients are in (-q, q) */
+static void poly_invntt_tomont(POLY *p)
+{
+#ifdef ML_KEM_ASM
+    if (ossl_ml_kem_avx2_capable()) {
+        ossl_ml_kem_invntt_avx2(p->c);
+        return;
+    }
+#endif
+    invntt(p->c);
+}
+
+/* r = a * b * 2^-16 in the NTT domain, with coefficients in (-2q, 2q) */
+static void poly_basemul_montgomery(POLY *r, const POLY *a, const POLY *b)
+{
+    int i;
+
+#ifdef ML_KEM_ASM
+    if (ossl_ml_kem_avx2_capable()) {
+        ossl_ml_kem_basemul_avx2(r->c, a->c, b->c);
+        return;
+    }
+#endif
+    for (i = 0; i < DEGREE / 4; i++) {
+        basemul(&r->c[4 * i], &a->c[4 * i], &b->c[4 * i], zetas[64 + i]);
+        basemul(&r->c[4 * i + 2], &a->c[4 * i + 2], &b->c[4 * i + 2],
+                -zetas[64 + i]);
+    }
+}
+
+/*
+ * r = sum(a[i * stride] * b[i]) * 2^-16 over the k terms.  A stride of 1
+ * takes a row of a matrix, a stride of k a column.
+ */
+static void poly_basemul_acc(POLY *r, const POLY *a, size_t stride,
+                             const POLY *b, int k)
+{
+    POLY t;
+    int i;
+
+    poly_basemul_montgomery(r, &a[0], &b[0]);
+    for (i = 1; i < k; i++) {
+        poly_basemul_montgomery(&t, &a[i * stride], &b[i]);
+        poly_add(r, &t);
+    }
+    poly_reduce(r);
+}
+
+/*-
+ * Encodings
+ * =========
+ */
+
+/* ByteEncode_12, for coefficients in (-q, q) */
+static void poly_tobytes(uint8_t r[POLY_BYTES], const POLY *p)
+{
+    uint16_t t0, t1;
+    int i;
+
+    for (i = 0; i < DEGREE / 2; i++) {
+        t0 = to_unsigned(p->c[2 * i]);
+        t1 = to_unsigned(p->c[2 * i + 1]);
+        r[3 * i] = (uint8_t)t0;
+        r[3 * i + 1] = (uint8_t)((t0 >> 8) | (t1 << 4));
+        r[3 * i + 2] = (uint8_t)(t1 >> 4);
+    }
+}
+
+/*
+ * ByteDecode_12.  Returns 0 if a coefficient is not reduced mod q, which
+ * fails the modulus check of encapsulation keys.
+ */
+static int poly_frombytes(POLY *p, const uint8_t a[POLY_BYTES])
+{
+    uint16_t t0, t1, bad = 0;
+    int i;
+
+    for (i = 0; i < DEGREE / 2; i++) {
+        t0 = (a[3 * i] | ((uint16_t)a[3 * i + 1] << 8)) & 0xfff;
+        t1 = ((a[3 * i + 1] >> 4) | ((uint16_t)a[3 * i + 2] << 4)) & 0xfff;
+        bad |= constant_time_ge(t0, Q) | constant_time_ge(t1, Q);
+        p->c[2 * i] = (int16_t)t0;
+        p->c[2 * i + 1] = (int16_t)t1;
+    }
+    return bad == 0;
+}
+
+/* ByteEncode_d(Compress_d(p)), for coefficients in (-q, q) */
+static void poly_compress(uint8_t *r, const POLY *p, int d)
+{
+    uint32_t acc = 0;
+    int i, bits = 0;
+
+    for (i = 0; i < DEGREE; i++) {
+        acc |= compress(to_unsigned(p->c[i]), d) << bits;
+        for (bits += d; bits >= 8; bits -= 8) {
+            *r++ = (uint8_t)acc;
+            acc >>= 8;
+        }
+    }
+}
+
+/* Decompress_d(ByteDecode_d(a)) */
+static void poly_decompress(POLY *p, const uint8_t *a, int d)
+{
+    uint32_t acc = 0, mask = (1U << d) - 1;
+    int i, bits = 0;
+
+    for (i = 0; i < DEGREE; i++) {
+        for (; bits < d; bits += 8)
+            acc |= (uint32_t)*a++ << bits;
+        p->c[i] = decompress(acc & mask, d);
+        acc >>= d;
+        bits -= d;
+    }
+}
+
+static void poly_frommsg(POLY *p, const uint8_t msg[SYM_BYTES])
+{
+    int i;
+
+    for (i = 0; i < DEGREE; i++)
+        p->c[i] = (int16_t)(-(int16_t)((msg[i / 8] >> (i % 8)) & 1)
+                            & ((Q + 1) / 2));
+}
+
+/*-
+ * Sampling
+ * ========
+ */
+
+/* Parses uniform coefficients below q, returns the new count */
+static unsigned int rej_uniform(int16_t *r, unsigned int ctr,
+                                const uint8_t *buf, size_t len)
+{
+    size_t pos;
+    uint16_t d1, d2;
+
+    for (pos = 0; ctr < DEGREE && pos + 3 <= len; pos += 3) {
+        d1 = (buf[pos] | ((uint16_t)buf[pos + 1] << 8)) & 0xfff;
+        d2 = (buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4);
+        if (d1 < Q)
+            r[ctr++] = (int16_t)d1;
+        if (d2 < Q && ctr < DEGREE)
+            r[ctr++] = (int16_t)d2;
+    }
+    return ctr;
+}
+
+static void cbd2(POLY *p, const uint8_t buf[2 * DEGREE / 4])
+{
+    uint32_t t, d;
+    int i, j;
+
+    for (i = 0; i < DEGREE / 8; i++) {
+        t = buf[4 * i] | ((uint32_t)buf[4 * i + 1] << 8)
+            | ((uint32_t)buf[4 * i + 2] << 16) | ((uint32_t)buf[4 * i + 3] << 24);
+        d = (t & 0x55555555) + ((t >> 1) & 0x55555555);
+        for (j = 0; j < 8; j++)
+            p->c[8 * i + j] = (int16_t)((d >> (4 * j)) & 3)
+                              - (int16_t)((d >> (4 * j + 2)) & 3);
+    }
+}
+
+static void cbd3(POLY *p, const uint8_t buf[3 * DEGREE / 4])
+{
+    uint32_t t, d;
+    int i, j;
+
+    for (i = 0; i < DEGREE / 4; i++) {
+        t = buf[3 * i] | ((uint32_t)buf[3 * i + 1] << 8)
+            | ((uint32_t)buf[3 * i + 2] << 16);
+        d = (t & 0x249249) + ((t >> 1) & 0x249249) + ((t >> 2) & 0x249249);
+        for (j = 0; j < 4; j++)
+            p->c[4 * i + j] = (int16_t)((d >> (6 * j)) & 7)
+                              - (int16_t)((d >> (6 * j + 3)) & 7);
+    }
+}
+
+/*-
+ * Hash functions
+ * ==============
+ */
+
+static void sha3(uint8_t *out, size_t bitlen, const uint8_t *in1,
+                 size_t len1, const uint8_t *in2, size_t len2)
+{
+    KECCAK1600_CTX c;
+
+    ossl_sha3_init(&c, '\x06', bitlen);
+    ossl_sha3_update(&c, in1, len1);
+    ossl_sha3_update(&c, in2, len2);
+    ossl_sha3_final(out, &c);
+    OPENSSL_cleanse(&c, sizeof(c));
+}
+
+/* H, G and J */
+#define hash_h(out, in, len) sha3(out, 256, in, len, NULL, 0)
+#define hash_g(out, in1, len1, in2, len2) sha3(out, 512, in1, len1, in2, len2)
+
+static void hash_j(uint8_t out[SYM_BYTES], const uint8_t z[SYM_BYTES],
+                   const uint8_t *ct, size_t ctlen)
+{
+    KECCAK1600_CTX c;
+
+    ossl_sha3_init(&c, '\x1f', 256);
+    c.md_size = SYM_BYTES;
+    ossl_sha3_update(&c, z, SYM_BYTES);
+    ossl_sha3_update(&c, ct, ctlen);
+    ossl_sha3_final(out, &c);
+    OPENSSL_cleanse(&c, sizeof(c));
+}
+
+/*
+ * Expands rho into the matrix A-hat, A-hat[i][j] = SampleNTT(rho || j || i).
+ * All k^2 XOF instances run through ossl_sha3_many(), which hashes up to
+ * eight of them at a time where possible.
+ */
+static int gen_matrix(POLY *m, const uint8_t rho[SYM_BYTES], int k)
+{
+    uint8_t in[MAX_K * MAX_K][SYM_BYTES + 2];
+    uint8_t *out = NULL, *more = NULL;
+    const unsigned char *inp[MAX_K * MAX_K];
+    unsigned char *outp[MAX_K * MAX_K];
+    size_t inl[MAX_K * MAX_K], len;
+    KECCAK1600_CTX c;
+    unsigned int n;
+    int i, j, ret = 0;
+
+    out = OPENSSL_malloc(k * k * XOF_BYTES);
+    if (out == NULL)
+        return 0;
+    for (i = 0; i < k; i++) {
+        for (j = 0; j < k; j++) {
+            memcpy(in[i * k + j], rho, SYM_BYTES);
+            in[i * k + j][SYM_BYTES] = (uint8_t)j;
+            in[i * k + j][SYM_BYTES + 1] = (uint8_t)i;
+            inp[i * k + j] = in[i * k + j];
+            inl[i * k + j] = SYM_BYTES + 2;
+            outp[i * k + j] = out + (i * k + j) * XOF_BYTES;
+        }
+    }
+    ossl_sha3_init(&c, '\x1f', 128);
+    c.md_size = XOF_BYTES;
+    ossl_sha3_many(&c, k * k, inp, inl, outp);
+
+    for (i = 0; i < k * k; i++) {
+        n = rej_uniform(m[i].c, 0, outp[i], XOF_BYTES);
+        /*
+         * Too many rejections, which only depends on the public rho and is
+         * very unlikely.  Squeeze a longer output and parse that instead.
+         */
+        for (len = 2 * XOF_BYTES; n < DEGREE; len *= 2) {
+            OPENSSL_free(more);
+            if ((more = OPENSSL_malloc(len)) == NULL)
+                goto err;
+            ossl_sha3_init(&c, '\x1f', 128);
+            c.md_size = len;
+            ossl_sha3_update(&c, inp[i], inl[i]);
+            ossl_sha3_final(more, &c);
+            n = rej_uniform(m[i].c, 0, more, len);
+        }
+    }
+    ret = 1;
+ err:
+    OPENSSL_free(more);
+    OPENSSL_free(out);
+    return ret;
+}
+
+/*
+ * Samples |num| polynomials from the centered binomial distributions with
+ * PRF_eta(sigma, nonce + i).  The first |num1| use eta1, the others eta2.
+ * As SHAKE256 outputs are prefixes of each other all are squeezed to the
+ * larger length.
+ */
+static void gen_noise(POLY *p, const uint8_t sigma[SYM_BYTES], uint8_t nonce,
+                      int num, int num1, int eta1)
+{
+    uint8_t in[2 * MAX_K + 1][SYM_BYTES + 1];
+    uint8_t out[2 * MAX_K + 1][MAX_ETA * DEGREE / 4];
+    const unsigned char *inp[2 * MAX_K + 1];
+    unsigned char *outp[2 * MAX_K + 1];
+    size_t inl[2 * MAX_K + 1];
+    KECCAK1600_CTX c;
+    int i;
+
+    for (i = 0; i < num; i++) {
+        memcpy(in[i], sigma, SYM_BYTES);
+        in[i][SYM_BYTES] = (uint8_t)(nonce + i);
+        inp[i] = in[i];
+        inl[i] = SYM_BYTES + 1;
+        outp[i] = out[i];
+    }
+    ossl_sha3_init(&c, '\x1f', 256);
+    c.md_size = eta1 * DEGREE / 4;
+    ossl_sha3_many(&c, num, inp, inl, outp);
+
+    for (i = 0; i < num; i++) {
+        if (i < num1 && eta1 == 3)
+            cbd3(&p[i], out[i]);
+        else
+            cbd2(&p[i], out[i]);
+    }
+    OPENSSL_cleanse(in, sizeof(in));
+    OPENSSL_cleanse(out, sizeof(out));
+}
+
+/*-
+ * K-PKE
+ * =====
+ */
+
+static int pke_keygen(ML_KEM_KEY *key, const uint8_t d[SYM_BYTES])
+{
+    int k = key->vinfo->k, i;
+    uint8_t buf[2 * SYM_BYTES], kb = (uint8_t)k;
+    POLY e[MAX_K];
+
+    /* (rho, sigma) = G(d || k) */
+    hash_g(buf, d, SYM_BYTES, &kb, 1);
+    memcpy(key->rho, buf, SYM_BYTES);
+    if (!gen_matrix(key->m, key->rho, k)) {
+        OPENSSL_cleanse(buf, sizeof(buf));
+        return 0;
+    }
+
+    gen_noise(key->s, buf + SYM_BYTES, 0, k, k, key->vinfo->eta1);
+    gen_noise(e, buf + SYM_BYTES, (uint8_t)k, k, k, key->vinfo->eta1);
+    for (i = 0; i < k; i++) {
+        poly_ntt(&key->s[i]);
+        poly_ntt(&e[i]);
+    }
+
+    for (i = 0; i < k; i++) {
+        poly_basemul_acc(&key->t[i], &key->m[i * k], 1, key->s, k);
+        poly_tomont(&key->t[i]);
+        poly_add(&key->t[i], &e[i]);
+        poly_reduce(&key->t[i]);
+    }
+    OPENSSL_cleanse(buf, sizeof(buf));
+    OPENSSL_cleanse(e, sizeof(e));
+    return 1;
+}
+
+static void pke_encrypt(uint8_t *ct, const ML_KEM_KEY *key,
+                        const uint8_t msg[SYM_BYTES],
+                        const uint8_t r[SYM_BYTES])
+{
+    const ML_KEM_VINFO *vinfo = key->vinfo;
+    int k = vinfo->k, i;
+    POLY y[2 * MAX_K + 1], *e = &y[k], u, v, mu;
+
+    /* y is followed by e1 and e2 */
+    gen_noise(y, r, 0, 2 * k + 1, k, vinfo->eta1);
+    for (i = 0; i < k; i++)
+        poly_ntt(&y[i]);
+
+    /* u = NTT^-1(A-hat^T o y-hat) + e1 */
+    for (i = 0; i < k; i++) {
+        poly_basemul_acc(&u, &key->m[i], k, y, k);
+        poly_invntt_tomont(&u);
+        poly_add(&u, &e[i]);
+        poly_reduce(&u);
+        poly_compress(ct + i * vinfo->du * DEGREE / 8, &u, vinfo->du);
+    }
+
+    /* v = NTT^-1(t-hat^T o y-hat) + e2 + Decompress_1(m) */
+    poly_basemul_acc(&v, key->t, 1, y, k);
+    poly_invntt_tomont(&v);
+    poly_add(&v, &e[k]);
+    poly_frommsg(&mu, msg);
+    poly_add(&v, &mu);
+    poly_reduce(&v);
+    poly_compress(ct + k * vinfo->du * DEGREE / 8, &v, vinfo->dv);
+
+    OPENSSL_cleanse(y, sizeof(y));
+    OPENSSL_cleanse(&u, sizeof(u));
+    OPENSSL_cleanse(&v, sizeof(v));
+    OPENSSL_cleanse(&mu, sizeof(mu));
+}
+
+static void pke_decrypt(uint8_t msg[SYM_BYTES], const ML_KEM_KEY *key,
+                        const uint8_t *ct)
+{
+    const ML_KEM_VINFO *vinfo = key->vinfo;
+    int k = vinfo->k, i;
+    POLY u[MAX_K], v, w;
+
+    for (i = 0; i < k; i++) {
+        poly_decompress(&u[i], ct + i * vinfo->du * DEGREE / 8, vinfo->du);
+        poly_ntt(&u[i]);
+    }
+    poly_decompress(&v, ct + k * vinfo->du * DEGREE / 8, vinfo->dv);
+
+    /* w = v - NTT^-1(s-hat^T o NTT(u)) */
+    poly_basemul_acc(&w, key->s, 1, u, k);
+    poly_invntt_tomont(&w);
+    poly_sub(&w, &v, &w);
+    poly_reduce(&w);
+    poly_compress(msg, &w, 1);
+
+    OPENSSL_cleanse(&w, sizeof(w));
+}
+
+/*-
+ * Keys
+ * ====
+ */
+
+const ML_KEM_VINFO *ossl_ml_kem_get_vinfo(int variant)
+{
+    if (variant < 0 || variant >= (int)OSSL_NELEM(vinfo_map))
+        return NULL;
+    return &vinfo_map[variant];
+}
+
+ML_KEM_KEY *ossl_ml_kem_key_new(OSSL_LIB_CTX *libctx, int variant)
+{
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_get_vinfo(variant);
+    ML_KEM_KEY *key;
+    int k;
+
+    if (vinfo == NULL)
+        return NULL;
+    k = vinfo->k;
+    if ((key = OPENSSL_zalloc(sizeof(*key))) == NULL)
+        return NULL;
+    key->polys = OPENSSL_zalloc((2 * k + k * k) * sizeof(POLY));
+    if (key->polys == NULL) {
+        OPENSSL_free(key);
+        return NULL;
+    }
+    key->vinfo = vinfo;
+    key->libctx = libctx;
+    key->t = key->polys;
+    key->m = key->t + k;
+    key->s = key->m + k * k;
+    return key;
+}
+
+void ossl_ml_kem_key_free(ML_KEM_KEY *key)
+{
+    int k;
+
+    if (key == NULL)
+        return;
+    k = key->vinfo->k;
+    OPENSSL_clear_free(key->polys, (2 * k + k * k) * sizeof(POLY));
+    OPENSSL_clear_free(key, sizeof(*key));
+}
+
+ML_KEM_KEY *ossl_ml_kem_key_dup(const ML_KEM_KEY *key, int selection)
+{
+    ML_KEM_KEY *ret;
+    int k;
+
+    if (key == NULL)
+        return NULL;
+    k = key->vinfo->k;
+    if ((ret = ossl_ml_kem_key_new(key->libctx, key->vinfo->variant)) == NULL)
+        return NULL;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return ret;
+    if (key->have_pub) {
+        memcpy(ret->t, key->t, (k + k * k) * sizeof(POLY));
+        memcpy(ret->rho, key->rho, sizeof(key->rho));
+        memcpy(ret->pkhash, key->pkhash, sizeof(key->pkhash));
+        ret->have_pub = 1;
+    }
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0 && key->have_prv) {
+        memcpy(ret->s, key->s, k * sizeof(POLY));
+        memcpy(ret->z, key->z, sizeof(key->z));
+        memcpy(ret->seed, key->seed, sizeof(key->seed));
+        ret->have_seed = key->have_seed;
+        ret->have_prv = 1;
+    }
+    return ret;
+}
+
+const ML_KEM_VINFO *ossl_ml_kem_key_vinfo(const ML_KEM_KEY *key)
+{
+    return key->vinfo;
+}
+
+int ossl_ml_kem_have_pubkey(const ML_KEM_KEY *key)
+{
+    return key != NULL && key->have_pub;
+}
+
+int ossl_ml_kem_have_prvkey(const ML_KEM_KEY *key)
+{
+    return key != NULL && key->have_prv;
+}
+
+int ossl_ml_kem_have_seed(const ML_KEM_KEY *key)
+{
+    return key != NULL && key->have_seed;
+}
+
+/* The hash of the encoded key covers both t and rho */
+int ossl_ml_kem_pubkey_cmp(const ML_KEM_KEY *key1, const ML_KEM_KEY *key2)
+{
+    if (!key1->have_pub || !key2->have_pub)
+        return 0;
+    return key1->vinfo == key2->vinfo
+           && memcmp(key1->pkhash, key2->pkhash, SYM_BYTES) == 0;
+}
+
+int ossl_ml_kem_set_seed(const uint8_t *seed, size_t seedlen, ML_KEM_KEY *key)
+{
+    if (key == NULL || seedlen != ML_KEM_SEED_BYTES
+            || key->have_pub || key->have_prv)
+        return 0;
+    memcpy(key->seed, seed, ML_KEM_SEED_BYTES);
+    key->have_seed = 1;
+    return 1;
+}
+
+int ossl_ml_kem_encode_public_key(uint8_t *out, size_t len,
+                                  const ML_KEM_KEY *key)
+{
+    int k, i;
+
+    if (key == NULL || !key->have_pub || len != key->vinfo->pubkey_bytes)
+        return 0;
+    k = key->vinfo->k;
+    for (i = 0; i < k; i++)
+        poly_tobytes(out + i * POLY_BYTES, &key->t[i]);
+    memcpy(out + k * POLY_BYTES, key->rho, SYM_BYTES);
+    return 1;
+}
+
+/* dk = ByteEncode_12(s-hat) || ek || H(ek) || z */
+int ossl_ml_kem_encode_private_key(uint8_t *out, size_t len,
+                                   const ML_KEM_KEY *key)
+{
+    const ML_KEM_VINFO *vinfo;
+    int k, i;
+
+    if (key == NULL || !key->have_prv || len != key->vinfo->prvkey_bytes)
+        return 0;
+    vinfo = key->vinfo;
+    k = vinfo->k;
+    for (i = 0; i < k; i++)
+        poly_tobytes(out + i * POLY_BYTES, &key->s[i]);
+    out += k * POLY_BYTES;
+    if (!ossl_ml_kem_encode_public_key(out, vinfo->pubkey_bytes, key))
+        return 0;
+    out += vinfo->pubkey_bytes;
+    memcpy(out, key->pkhash, SYM_BYTES);
+    memcpy(out + SYM_BYTES, key->z, SYM_BYTES);
+    return 1;
+}
+
+int ossl_ml_kem_encode_seed(uint8_t *out, size_t len, const ML_KEM_KEY *key)
+{
+    if (key == NULL || !key->have_seed || len != ML_KEM_SEED_BYTES)
+        return 0;
+    memcpy(out, key->seed, ML_KEM_SEED_BYTES);
+    return 1;
+}
+
+static int parse_public_key(const uint8_t *in, ML_KEM_KEY *key)
+{
+    int k = key->vinfo->k, i;
+
+    for (i = 0; i < k; i++) {
+        if (!poly_frombytes(&key->t[i], in + i * POLY_BYTES))
+            return 0;
+    }
+    memcpy(key->rho, in + k * POLY_BYTES, SYM_BYTES);
+    hash_h(key->pkhash, in, key->vinfo->pubkey_bytes);
+    return gen_matrix(key->m, key->rho, k);
+}
+
+int ossl_ml_kem_parse_public_key(const uint8_t *in, size_t len,
+                                 ML_KEM_KEY *key)
+{
+    if (key == NULL || key->have_pub || key->have_prv
+            || len != key->vinfo->pubkey_bytes)
+        return 0;
+    if (!parse_public_key(in, key))
+        return 0;
+    key->have_pub = 1;
+    return 1;
+}
+
+int ossl_ml_kem_parse_private_key(const uint8_t *in, size_t len,
+                                  ML_KEM_KEY *key)
+{
+    const ML_KEM_VINFO *vinfo;
+    uint8_t pkhash[SYM_BYTES];
+    int k, i;
+
+    if (key == NULL || key->have_pub || key->have_prv
+            || len != key->vinfo->prvkey_bytes)
+        return 0;
+    vinfo = key->vinfo;
+    k = vinfo->k;
+
+    /* The hash check of FIPS 203, section 7.3 */
+    hash_h(pkhash, in + k * POLY_BYTES, vinfo->pubkey_bytes);
+    if (memcmp(pkhash, in + k * POLY_BYTES + vinfo->pubkey_bytes,
+               SYM_BYTES) != 0)
+        return 0;
+    if (!parse_public_key(in + k * POLY_BYTES, key))
+        return 0;
+    for (i = 0; i < k; i++)
+        poly_frombytes(&key->s[i], in + i * POLY_BYTES);
+    memcpy(key->z, in + k * POLY_BYTES + vinfo->pubkey_bytes + SYM_BYTES,
+           SYM_BYTES);
+    key->have_seed = 0;
+    key->have_pub = key->have_prv = 1;
+    return 1;
+}
+
+int ossl_ml_kem_genkey(ML_KEM_KEY *key)
+{
+    uint8_t *ek = NULL;
+    size_t eklen;
+    int ret = 0;
+
+    if (key == NULL || key->have_pub || key->have_prv)
+        return 0;
+    if (!key->have_seed) {
+        if (RAND_priv_bytes_ex(key->libctx, key->seed, sizeof(key->seed),
+                               key->vinfo->secbits) <= 0)
+            return 0;
+        key->have_seed = 1;
+    }
+    eklen = key->vinfo->pubkey_bytes;
+    if ((ek = OPENSSL_malloc(eklen)) == NULL)
+        return 0;
+
+    if (!pke_keygen(key, key->seed))
+        goto err;
+    memcpy(key->z, key->seed + SYM_BYTES, SYM_BYTES);
+    key->have_pub = 1;
+    if (!ossl_ml_kem_encode_public_key(ek, eklen, key))
+        goto err;
+    hash_h(key->pkhash, ek, eklen);
+    key->have_prv = 1;
+    ret = 1;
+ err:
+    if (!ret)
+        key->have_pub = 0;
+    OPENSSL_free(ek);
+    return ret;
+}
+
+/*-
+ * Encapsulation and decapsulation
+ * ===============================
+ */
+
+int ossl_ml_kem_encap_seed(uint8_t *ctext, size_t clen,
+                           uint8_t *shared_secret, size_t slen,
+                           const uint8_t *entropy, size_t elen,
+                           const ML_KEM_KEY *key)
+{
+    uint8_t kr[2 * SYM_BYTES];
+
+    if (key == NULL || !key->have_pub
+            || clen != key->vinfo->ctext_bytes
+            || slen != ML_KEM_SHARED_SECRET_BYTES
+            || elen != ML_KEM_RANDOM_BYTES)
+        return 0;
+
+    /* (K, r) = G(m || H(ek)) */
+    hash_g(kr, entropy, SYM_BYTES, key->pkhash, SYM_BYTES);
+    pke_encrypt(ctext, key, entropy, kr + SYM_BYTES);
+    memcpy(shared_secret, kr, ML_KEM_SHARED_SECRET_BYTES);
+    OPENSSL_cleanse(kr, sizeof(kr));
+    return 1;
+}
+
+int ossl_ml_kem_encap_rand(uint8_t *ctext, size_t clen,
+                           uint8_t *shared_secret, size_t slen,
+                           const ML_KEM_KEY *key)
+{
+    uint8_t m[ML_KEM_RANDOM_BYTES];
+    int ret;
+
+    if (key == NULL)
+        return 0;
+    if (RAND_priv_bytes_ex(key->libctx, m, sizeof(m),
+                           key->vinfo->secbits) <= 0)
+        return 0;
+    ret = ossl_ml_kem_encap_seed(ctext, clen, shared_secret, slen,
+                                 m, sizeof(m), key);
+    OPENSSL_cleanse(m, sizeof(m));
+    return ret;
+}
+
+/*
+ * Decapsulation re-encrypts the decrypted message and returns the implicit
+ * rejection secret J(z || c) unless that reproduces |ctext|.  The choice is
+ * made in constant time.
+ */
+int ossl_ml_kem_decap(uint8_t *shared_secret, size_t slen,
+                      const uint8_t *ctext, size_t clen,
+                      const ML_KEM_KEY *key)
+{
+    uint8_t msg[SYM_BYTES], kr[2 * SYM_BYTES], reject[SYM_BYTES];
+    uint8_t *ct2;
+    unsigned char mask;
+    size_t i;
+
+    if (key == NULL || !key->have_prv
+            || clen != key->vinfo->ctext_bytes
+            || slen != ML_KEM_SHARED_SECRET_BYTES)
+        return 0;
+    if ((ct2 = OPENSSL_malloc(clen)) == NULL)
+        return 0;
+
+    pke_decrypt(msg, key, ctext);
+    hash_g(kr, msg, SYM_BYTES, key->pkhash, SYM_BYTES);
+    hash_j(reject, key->z, ctext, clen);
+    pke_encrypt(ct2, key, msg, kr + SYM_BYTES);
+
+    mask = constant_time_eq_int_8(CRYPTO_memcmp(ctext, ct2, clen), 0);
+    for (i = 0; i < ML_KEM_SHARED_SECRET_BYTES; i++)
+        shared_secret[i] = constant_time_select_8(mask, kr[i], reject[i]);
+
+    OPENSSL_cleanse(msg, sizeof(msg));
+    OPENSSL_cleanse(kr, sizeof(kr));
+    OPENSSL_cleanse(reject, sizeof(reject));
+    OPENSSL_free(ct2);
+    return 1;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2019, Oracle and/or its affiliates.  All rights reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -16,6 +16,7 @@
 #include "internal/property.h"
 #include "internal/provider.h"
 #include "internal/tsan_assist.h"
+#include "internal/rcu.h"
 #include "crypto/ctype.h"
 #include <openssl/lhash.h>
 #include <openssl/rand.h>
@@ -38,38 +39,91 @@ typedef struct {
     void (*free)(void *);
 } METHOD;
 
-typedef struct {
+typedef struct implementation_st IMPLEMENTATION;
+struct implementation_st {
     const OSSL_PROVIDER *provider;
     OSSL_PROPERTY_LIST *properties;
     METHOD method;
-} IMPLEMENTATION;
+    IMPLEMENTATION *next_retired;
+};
 
 DEFINE_STACK_OF(IMPLEMENTATION)
 
-typedef struct {
+typedef struct query_st QUERY;
+struct query_st {
     const OSSL_PROVIDER *provider;
     const char *query;
     METHOD method;
+    unsigned long hash;
+    QUERY *next_retired;
     char body[1];
-} QUERY;
+};
 
 DEFINE_LHASH_OF_EX(QUERY);
 
+/*
+ * An immutable snapshot of the implementations of an algorithm.  This is what
+ * the lock free readers look at, a new view is published whenever an
+ * implementation is added or removed.
+ */
+typedef struct alg_view_st ALG_VIEW;
+struct alg_view_st {
+    STACK_OF(IMPLEMENTATION) *impls;
+    ALG_VIEW *next_retired;
+};
+
+/*
+ * The query cache of an algorithm as the lock free readers see it, an open
+ * addressed hash table of |size| slots, a power of two.  The writers update
+ * it in place: new entries go into a free slot, a replaced entry is swapped
+ * for its replacement and a removed entry for a tombstone, so that readers
+ * see either the old or the new content of every slot.  Once |used|, the
+ * number of entries and tombstones, would exceed half the slots, a new table
+ * is published instead.
+ */
+typedef struct query_table_st QUERY_TABLE;
+struct query_table_st {
+    size_t size;
+    size_t used;
+    QUERY **slots;
+    QUERY_TABLE *next_retired;
+};
+
 typedef struct {
     int nid;
     STACK_OF(IMPLEMENTATION) *impls;
     LHASH_OF(QUERY) *cache;
+    ALG_VIEW *view;
+    QUERY_TABLE *qtable;
 } ALGORITHM;
 
+/*
+ * An open addressed hash table of all algorithms by nid, for the lock free
+ * readers.  Algorithms are only ever added until the store is freed, so new
+ * entries are stored in place while the table is at most half full.  Beyond
+ * that, a larger copy is published.
+ */
+typedef struct alg_index_st ALG_INDEX;
+struct alg_index_st {
+    size_t size;
+    size_t num;
+    ALGORITHM **algs;
+    ALG_INDEX *next_retired;
+};
+
 struct ossl_method_store_st {
     OSSL_LIB_CTX *ctx;
     SPARSE_ARRAY_OF(ALGORITHM) *algs;
     /*
      * Lock to protect the |algs| array from concurrent writing, when
      * individual implementations or queries are inserted.  This is used
-     * by the appropriate functions here.
+     * by the appropriate functions here.  Fetches and query cache lookups
+     * don't take it, they read |index| and the algorithm views under |rcu|
+     * instead.
      */
     CRYPTO_RWLOCK *lock;
+    CRYPTO_RCU_LOCK *rcu;
+    ALG_INDEX *index;
     /*
      * Lock to reserve the whole store.  This is used when fetching a set
      * of algorithms, via these functions, found in crypto/core_fetch.c:
@@ -85,9 +139,20 @@ struct ossl_method_store_st {
 
     /* Flag: 1 if query cache entries for all algs need flushing */
     int cache_need_flush;
+
+    /*
+     * Objects that have been replaced or removed while holding |lock| and
+     * which can only be freed once no reader can be using them any more.
+     */
+    QUERY *retired_queries;
+    IMPLEMENTATION *retired_impls;
+    ALG_VIEW *retired_views;
+    QUERY_TABLE *retired_tables;
+    ALG_INDEX *retired_index;
 };
 
 typedef struct {
+    OSSL_METHOD_STORE *store;
     LHASH_OF(QUERY) *cache;
     size_t nelem;
     uint32_t seed;
@@ -105,7 +170,6 @@ typedef struct ossl_global_properties_st {
 
 static void ossl_method_cache_flush_alg(OSSL_METHOD_STORE *store,
                                         ALGORITHM *alg);
-static void ossl_method_cache_flush(OSSL_METHOD_STORE *store, int nid);
 
 /* Global properties are stored per library context */
 void ossl_ctx_global_properties_free(void *vglobp)
@@ -213,10 +277,196 @@ static void impl_cache_free(QUERY *elem)
     }
 }
 
-static void impl_cache_flush_alg(ossl_uintmax_t idx, ALGORITHM *alg)
+static void alg_view_free(ALG_VIEW *view)
+{
+    if (view != NULL) {
+        sk_IMPLEMENTATION_free(view->impls);
+        OPENSSL_free(view);
+    }
+}
+
+/*
+ * Objects which readers may still be looking at are not freed straight away
+ * by the writers.  They are queued instead and freed by
+ * ossl_method_store_unlock_reclaim() once a grace period has passed.
+ */
+static void query_retire(QUERY *elem, OSSL_METHOD_STORE *store)
+{
+    if (elem != NULL) {
+        elem->next_retired = store->retired_queries;
+        store->retired_queries = elem;
+    }
+}
+
+static void impl_retire(IMPLEMENTATION *impl, OSSL_METHOD_STORE *store)
+{
+    impl->next_retired = store->retired_impls;
+    store->retired_impls = impl;
+}
+
+/*
+ * Release the write lock and free the objects retired while it was held.
+ * The grace period is waited for once the lock has been released, so that
+ * neither other writers nor readers falling back to the lock are held up.
+ */
+static void ossl_method_store_unlock_reclaim(OSSL_METHOD_STORE *store)
+{
+    QUERY *elem, *queries = store->retired_queries;
+    IMPLEMENTATION *impl, *impls = store->retired_impls;
+    ALG_VIEW *view, *views = store->retired_views;
+    QUERY_TABLE *table, *tables = store->retired_tables;
+    ALG_INDEX *index, *indexes = store->retired_index;
+
+    store->retired_queries = NULL;
+    store->retired_impls = NULL;
+    store->retired_views = NULL;
+    store->retired_tables = NULL;
+    store->retired_index = NULL;
+    ossl_property_unlock(store);
+
+    if (queries == NULL && impls == NULL && views == NULL && tables == NULL
+            && indexes == NULL)
+        return;
+
+    ossl_synchronize_rcu(store->rcu);
+
+    while ((elem = queries) != NULL) {
+        queries = elem->next_retired;
+        impl_cache_free(elem);
+    }
+    while ((impl = impls) != NULL) {
+        impls = impl->next_retired;
+        impl_free(impl);
+    }
+    while ((view = views) != NULL) {
+        views = view->next_retired;
+        alg_view_free(view);
+    }
+    while ((table = tables) != NULL) {
+        tables = table->next_retired;
+        OPENSSL_free(table);
+    }
+    while ((index = indexes) != NULL) {
+        indexes = index->next_retired;
+        OPENSSL_free(index);
+    }
+}
+
+IMPLEMENT_LHASH_DOALL_ARG(QUERY, QUERY_TABLE);
+IMPLEMENT_LHASH_DOALL_ARG(QUERY, OSSL_METHOD_STORE);
+
+/*
+ * Make the current implementations of |alg| visible to the readers.  Must be
+ * called with the write lock held, after the implementations have changed.
+ *
+ * If the new view cannot be allocated, readers see no view at all.  They
+ * then fetch under the read lock instead.
+ */
+static void alg_publish(OSSL_METHOD_STORE *store, ALGORITHM *alg)
+{
+    ALG_VIEW *old = alg->view, *view;
+
+    if ((view = OPENSSL_zalloc(sizeof(*view))) != NULL
+            && (view->impls = sk_IMPLEMENTATION_dup(alg->impls)) == NULL) {
+        OPENSSL_free(view);
+        view = NULL;
+    }
+    ossl_rcu_assign_ptr(&alg->view, view);
+    if (old != NULL) {
+        old->next_retired = store->retired_views;
+        store->retired_views = old;
+    }
+}
+
+/* Stand in for a query cache entry that has been removed */
+static QUERY query_tombstone;
+
+static void qtable_add(QUERY *elem, QUERY_TABLE *table)
+{
+    size_t mask = table->size - 1;
+    size_t i;
+
+    for (i = elem->hash & mask;
+         table->slots[i] != NULL && table->slots[i] != &query_tombstone;
+         i = (i + 1) & mask)
+        continue;
+    if (table->slots[i] == NULL)
+        table->used++;
+    ossl_rcu_assign_ptr(&table->slots[i], elem);
+}
+
+/*
+ * Publish a new query table for |alg| holding the current content of its
+ * query cache, with room for as many entries again.  If the cache is empty or
+ * the table cannot be allocated, readers see no table and treat the query
+ * cache as empty.
+ */
+static void qtable_rebuild(OSSL_METHOD_STORE *store, ALGORITHM *alg)
+{
+    QUERY_TABLE *old = alg->qtable, *table = NULL;
+    size_t n = lh_QUERY_num_items(alg->cache);
+    size_t size;
+
+    if (n > 0) {
+        for (size = 8; size < 4 * n; size <<= 1)
+            continue;
+        table = OPENSSL_zalloc(sizeof(*table) + size * sizeof(*table->slots));
+        if (table != NULL) {
+            table->size = size;
+            table->slots = (QUERY **)(table + 1);
+            lh_QUERY_doall_QUERY_TABLE(alg->cache, &qtable_add, table);
+        }
+    }
+    ossl_rcu_assign_ptr(&alg->qtable, table);
+    if (old != NULL) {
+        old->next_retired = store->retired_tables;
+        store->retired_tables = old;
+    }
+}
+
+/*
+ * Make |elem|, which has just been added to the query cache of |alg|,
+ * visible to the readers.  Must be called with the write lock held.
+ */
+static void qtable_insert(OSSL_METHOD_STORE *store, ALGORITHM *alg,
+                          QUERY *elem)
 {
-    lh_QUERY_doall(alg->cache, &impl_cache_free);
+    QUERY_TABLE *table = alg->qtable;
+
+    if (table != NULL && 2 * (table->used + 1) <= table->size)
+        qtable_add(elem, table);
+    else
+        qtable_rebuild(store, alg);
+}
+
+/*
+ * Replace |old| in the query table of |alg| by |elem|, or by a tombstone if
+ * |elem| is NULL.  Must be called with the write lock held.
+ */
+static void qtable_replace(ALGORITHM *alg, QUERY *old, QUERY *elem)
+{
+    QUERY_TABLE *table = alg->qtable;
+    size_t i, mask;
+
+    if (table == NULL)
+        return;
+    mask = table->size - 1;
+    for (i = old->hash & mask; table->slots[i] != NULL; i = (i + 1) & mask)
+        if (table->slots[i] == old) {
+            ossl_rcu_assign_ptr(&table->slots[i],
+                                elem != NULL ? elem : &query_tombstone);
+            return;
+        }
+}
+
+static void impl_cache_flush_alg(ossl_uintmax_t idx, ALGORITHM *alg, void *arg)
+{
+    OSSL_METHOD_STORE *store = arg;
+
+    lh_QUERY_doall_OSSL_METHOD_STORE(alg->cache, &query_retire, store);
     lh_QUERY_flush(alg->cache);
+    if (alg->qtable != NULL)
+        qtable_rebuild(store, alg);
 }
 
 static void alg_cleanup(ossl_uintmax_t idx, ALGORITHM *a, void *arg)
@@ -227,6 +477,8 @@ static void alg_cleanup(ossl_uintmax_t idx, ALGORITHM *a, void *arg)
         sk_IMPLEMENTATION_pop_free(a->impls, &impl_free);
         lh_QUERY_doall(a->cache, &impl_cache_free);
         lh_QUERY_free(a->cache);
+        alg_view_free(a->view);
+        OPENSSL_free(a->qtable);
         OPENSSL_free(a);
     }
     if (store != NULL)
@@ -246,6 +498,7 @@ OSSL_METHOD_STORE *ossl_method_store_new(OSSL_LIB_CTX *ctx)
         res->ctx = ctx;
         if ((res->algs = ossl_sa_ALGORITHM_new()) == NULL
             || (res->lock = CRYPTO_THREAD_lock_new()) == NULL
+            || (res->rcu = ossl_rcu_lock_new()) == NULL
             || (res->biglock = CRYPTO_THREAD_lock_new()) == NULL) {
             ossl_method_store_free(res);
             return NULL;
@@ -260,6 +513,8 @@ void ossl_method_store_free(OSSL_METHOD_STORE *store)
         if (store->algs != NULL)
             ossl_sa_ALGORITHM_doall_arg(store->algs, &alg_cleanup, store);
         ossl_sa_ALGORITHM_free(store->algs);
+        OPENSSL_free(store->index);
+        ossl_rcu_lock_free(store->rcu);
         CRYPTO_THREAD_lock_free(store->lock);
         CRYPTO_THREAD_lock_free(store->biglock);
         OPENSSL_free(store);
@@ -281,9 +536,83 @@ static ALGORITHM *ossl_method_store_retrieve(OSSL_METHOD_STORE *store, int nid)
     return ossl_sa_ALGORITHM_get(store->algs, nid);
 }
 
+static size_t alg_index_start(const ALG_INDEX *index, int nid)
+{
+    uint32_t h = (uint32_t)nid * 0x9e3779b1U;
+
+    return (h ^ (h >> 16)) & (index->size - 1);
+}
+
+static ALGORITHM **alg_index_free_slot(ALG_INDEX *index, int nid)
+{
+    size_t i;
+
+    for (i = alg_index_start(index, nid); index->algs[i] != NULL;
+         i = (i + 1) & (index->size - 1))
+        continue;
+    return &index->algs[i];
+}
+
+/* Add |alg| to the index, must be called with the write lock held */
+static int alg_index_add(OSSL_METHOD_STORE *store, ALGORITHM *alg)
+{
+    ALG_INDEX *index = store->index, *new_index;
+    size_t i, size;
+
+    if (index != NULL && 2 * (index->num + 1) <= index->size) {
+        ossl_rcu_assign_ptr(alg_index_free_slot(index, alg->nid), alg);
+        index->num++;
+        return 1;
+    }
+
+    size = index != NULL ? 2 * index->size : 16;
+    new_index = OPENSSL_zalloc(sizeof(*new_index)
+                               + size * sizeof(*new_index->algs));
+    if (new_index == NULL)
+        return 0;
+    new_index->size = size;
+    new_index->algs = (ALGORITHM **)(new_index + 1);
+    if (index != NULL) {
+        for (i = 0; i < index->size; i++)
+            if (index->algs[i] != NULL)
+                *alg_index_free_slot(new_index, index->algs[i]->nid)
+                    = index->algs[i];
+        new_index->num = index->num;
+        index->next_retired = store->retired_index;
+        store->retired_index = index;
+    }
+    *alg_index_free_slot(new_index, alg->nid) = alg;
+    new_index->num++;
+    ossl_rcu_assign_ptr(&store->index, new_index);
+    return 1;
+}
+
+/* Find the algorithm for |nid|, must be called in a read side section */
+static ALGORITHM *alg_index_lookup(OSSL_METHOD_STORE *store, int nid)
+{
+    ALG_INDEX *index = ossl_rcu_deref(&store->index);
+    ALGORITHM *alg;
+    size_t i;
+
+    if (index == NULL)
+        return NULL;
+    for (i = alg_index_start(index, nid);
+         (alg = ossl_rcu_deref(&index->algs[i])) != NULL;
+         i = (i + 1) & (index->size - 1))
+        if (alg->nid == nid)
+            return alg;
+    return NULL;
+}
+
 static int ossl_method_store_insert(OSSL_METHOD_STORE *store, ALGORITHM *alg)
 {
-    return ossl_sa_ALGORITHM_set(store->algs, alg->nid, alg);
+    if (!ossl_sa_ALGORITHM_set(store->algs, alg->nid, alg))
+        return 0;
+    if (!alg_index_add(store, alg)) {
+        ossl_sa_ALGORITHM_set(store->algs, alg->nid, NULL);
+        return 0;
+    }
+    return 1;
 }
 
 int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
@@ -291,7 +620,7 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
                           int (*method_up_ref)(void *),
                           void (*method_destruct)(void *))
 {
-    ALGORITHM *alg = NULL;
+    ALGORITHM *alg, *new_alg = NULL;
     IMPLEMENTATION *impl;
     int ret = 0;
     int i;
@@ -322,7 +651,9 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
         OPENSSL_free(impl);
         return 0;
     }
-    ossl_method_cache_flush(store, nid);
+    alg = ossl_method_store_retrieve(store, nid);
+    if (alg != NULL)
+        ossl_method_cache_flush_alg(store, alg);
     if ((impl->properties = ossl_prop_defn_get(store->ctx, properties)) == NULL) {
         impl->properties = ossl_parse_property(store->ctx, properties);
         if (impl->properties == NULL)
@@ -334,15 +665,16 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
         }
     }
 
-    alg = ossl_method_store_retrieve(store, nid);
     if (alg == NULL) {
-        if ((alg = OPENSSL_zalloc(sizeof(*alg))) == NULL
-                || (alg->impls = sk_IMPLEMENTATION_new_null()) == NULL
-                || (alg->cache = lh_QUERY_new(&query_hash, &query_cmp)) == NULL)
+        if ((new_alg = OPENSSL_zalloc(sizeof(*new_alg))) == NULL
+                || (new_alg->impls = sk_IMPLEMENTATION_new_null()) == NULL
+                || (new_alg->cache = lh_QUERY_new(&query_hash,
+                                                  &query_cmp)) == NULL)
             goto err;
-        alg->nid = nid;
-        if (!ossl_method_store_insert(store, alg))
+        new_alg->nid = nid;
+        if (!ossl_method_store_insert(store, new_alg))
             goto err;
+        alg = new_alg;
     }
 
     /* Push onto stack if there isn't one there already */
@@ -356,14 +688,15 @@ int ossl_method_store_add(OSSL_METHOD_STORE *store, const OSSL_PROVIDER *prov,
     if (i == sk_IMPLEMENTATION_num(alg->impls)
         && sk_IMPLEMENTATION_push(alg->impls, impl))
         ret = 1;
-    ossl_property_unlock(store);
+    alg_publish(store, alg);
+    ossl_method_store_unlock_reclaim(store);
     if (ret == 0)
         impl_free(impl);
     return ret;
 
 err:
-    ossl_property_unlock(store);
-    alg_cleanup(0, alg, NULL);
+    ossl_method_store_unlock_reclaim(store);
+    alg_cleanup(0, new_alg, NULL);
     impl_free(impl);
     return 0;
 }
@@ -372,19 +705,19 @@ int ossl_method_store_remove(OSSL_METHOD_STORE *store, int nid,
                              const void *method)
 {
     ALGORITHM *alg = NULL;
-    int i;
+    int i, ret = 0;
 
     if (nid <= 0 || method == NULL || store == NULL)
         return 0;
 
     if (!ossl_property_write_lock(store))
         return 0;
-    ossl_method_cache_flush(store, nid);
     alg = ossl_method_store_retrieve(store, nid);
     if (alg == NULL) {
         ossl_property_unlock(store);
         return 0;
     }
+    ossl_method_cache_flush_alg(store, alg);
 
     /*
      * A sorting find then a delete could be faster but these stacks should be
@@ -395,14 +728,16 @@ int ossl_method_store_remove(OSSL_METHOD_STORE *store, int nid,
         IMPLEMENTATION *impl = sk_IMPLEMENTATION_value(alg->impls, i);
 
         if (impl->method.method == method) {
-            impl_free(impl);
+            impl_retire(impl, store);
             (void)sk_IMPLEMENTATION_delete(alg->impls, i);
-            ossl_property_unlock(store);
-            return 1;
+            ret = 1;
+            break;
         }
     }
-    ossl_property_unlock(store);
-    return 0;
+    if (ret)
+        alg_publish(store, alg);
+    ossl_method_store_unlock_reclaim(store);
+    return ret;
 }
 
 struct alg_cleanup_by_provider_data_st {
@@ -424,7 +759,7 @@ alg_cleanup_by_provider(ossl_uintmax_t idx, ALGORITHM *alg, void *arg)
         IMPLEMENTATION *impl = sk_IMPLEMENTATION_value(alg->impls, i);
 
         if (impl->provider == data->prov) {
-            impl_free(impl);
+            impl_retire(impl, data->store);
             (void)sk_IMPLEMENTATION_delete(alg->impls, i);
             count++;
         }
@@ -436,8 +771,10 @@ alg_cleanup_by_provider(ossl_uintmax_t idx, ALGORITHM *alg, void *arg)
      * There's no point flushing the cache entries where we didn't remove
      * any implementation, though.
      */
-    if (count > 0)
+    if (count > 0) {
         ossl_method_cache_flush_alg(data->store, alg);
+        alg_publish(data->store, alg);
+    }
 }
 
 int ossl_method_store_remove_all_provided(OSSL_METHOD_STORE *store,
@@ -450,7 +787,7 @@ int ossl_method_store_remove_all_provided(OSSL_METHOD_STORE *store,
     data.prov = prov;
     data.store = store;
     ossl_sa_ALGORITHM_doall_arg(store->algs, &alg_cleanup_by_provider, &data);
-    ossl_property_unlock(store);
+    ossl_method_store_unlock_reclaim(store);
     return 1;
 }
 
@@ -490,36 +827,22 @@ void ossl_method_store_do_all(OSSL_METHOD_STORE *store,
         ossl_sa_ALGORITHM_doall_arg(store->algs, alg_do_each, &data);
 }
 
-int ossl_method_store_fetch(OSSL_METHOD_STORE *store,
-                            int nid, const char *prop_query,
-                            const OSSL_PROVIDER **prov_rw, void **method)
+/*
+ * Select the best implementation from |impls|.  This is called either in a
+ * read side critical section with the stack from the published view, or with
+ * the read lock held.
+ */
+static int impl_select(OSSL_METHOD_STORE *store,
+                       STACK_OF(IMPLEMENTATION) *impls, const char *prop_query,
+                       const OSSL_PROVIDER **prov_rw, void **method)
 {
     OSSL_PROPERTY_LIST **plp;
-    ALGORITHM *alg;
     IMPLEMENTATION *impl, *best_impl = NULL;
     OSSL_PROPERTY_LIST *pq = NULL, *p2 = NULL;
     const OSSL_PROVIDER *prov = prov_rw != NULL ? *prov_rw : NULL;
     int ret = 0;
     int j, best = -1, score, optional;
 
-    if (nid <= 0 || method == NULL || store == NULL)
-        return 0;
-
-#ifndef FIPS_MODULE
-    if (ossl_lib_ctx_is_default(store->ctx)
-            && !OPENSSL_init_crypto(OPENSSL_INIT_LOAD_CONFIG, NULL))
-        return 0;
-#endif
-
-    /* This only needs to be a read lock, because the query won't create anything */
-    if (!ossl_property_read_lock(store))
-        return 0;
-    alg = ossl_method_store_retrieve(store, nid);
-    if (alg == NULL) {
-        ossl_property_unlock(store);
-        return 0;
-    }
-
     if (prop_query != NULL)
         p2 = pq = ossl_parse_query(store->ctx, prop_query, 0);
     plp = ossl_ctx_global_properties(store->ctx, 0);
@@ -536,8 +859,8 @@ int ossl_method_store_fetch(OSSL_METHOD_STORE *store,
     }
 
     if (pq == NULL) {
-        for (j = 0; j < sk_IMPLEMENTATION_num(alg->impls); j++) {
-            if ((impl = sk_IMPLEMENTATION_value(alg->impls, j)) != NULL
+        for (j = 0; j < sk_IMPLEMENTATION_num(impls); j++) {
+            if ((impl = sk_IMPLEMENTATION_value(impls, j)) != NULL
                 && (prov == NULL || impl->provider == prov)) {
                 best_impl = impl;
                 ret = 1;
@@ -547,8 +870,8 @@ int ossl_method_store_fetch(OSSL_METHOD_STORE *store,
         goto fin;
     }
     optional = ossl_property_has_optional(pq);
-    for (j = 0; j < sk_IMPLEMENTATION_num(alg->impls); j++) {
-        if ((impl = sk_IMPLEMENTATION_value(alg->impls, j)) != NULL
+    for (j = 0; j < sk_IMPLEMENTATION_num(impls); j++) {
+        if ((impl = sk_IMPLEMENTATION_value(impls, j)) != NULL
             && (prov == NULL || impl->provider == prov)) {
             score = ossl_property_match_count(pq, impl->properties);
             if (score > best) {
@@ -568,33 +891,69 @@ fin:
     } else {
         ret = 0;
     }
-    ossl_property_unlock(store);
     ossl_property_free(p2);
     return ret;
 }
 
-static void ossl_method_cache_flush_alg(OSSL_METHOD_STORE *store,
-                                        ALGORITHM *alg)
+int ossl_method_store_fetch(OSSL_METHOD_STORE *store,
+                            int nid, const char *prop_query,
+                            const OSSL_PROVIDER **prov_rw, void **method)
 {
-    store->cache_nelem -= lh_QUERY_num_items(alg->cache);
-    impl_cache_flush_alg(0, alg);
+    ALGORITHM *alg;
+    ALG_VIEW *view;
+    unsigned int token;
+    int ret;
+
+    if (nid <= 0 || method == NULL || store == NULL)
+        return 0;
+
+#ifndef FIPS_MODULE
+    if (ossl_lib_ctx_is_default(store->ctx)
+            && !OPENSSL_init_crypto(OPENSSL_INIT_LOAD_CONFIG, NULL))
+        return 0;
+#endif
+
+    if (!ossl_rcu_read_lock(store->rcu, &token))
+        return 0;
+    alg = alg_index_lookup(store, nid);
+    if (alg == NULL) {
+        ossl_rcu_read_unlock(store->rcu, token);
+        return 0;
+    }
+
+    view = ossl_rcu_deref(&alg->view);
+    if (view != NULL) {
+        ret = impl_select(store, view->impls, prop_query, prov_rw, method);
+        ossl_rcu_read_unlock(store->rcu, token);
+        return ret;
+    }
+    ossl_rcu_read_unlock(store->rcu, token);
+
+    /*
+     * No view was published for this algorithm.  The query won't create
+     * anything so a read lock is sufficient.
+     */
+    if (!ossl_property_read_lock(store))
+        return 0;
+    ret = impl_select(store, alg->impls, prop_query, prov_rw, method);
+    ossl_property_unlock(store);
+    return ret;
 }
 
-static void ossl_method_cache_flush(OSSL_METHOD_STORE *store, int nid)
+static void ossl_method_cache_flush_alg(OSSL_METHOD_STORE *store,
+                                        ALGORITHM *alg)
 {
-    ALGORITHM *alg = ossl_method_store_retrieve(store, nid);
-
-    if (alg != NULL)
-        ossl_method_cache_flush_alg(store, alg);
+    store->cache_nelem -= lh_QUERY_num_items(alg->cache);
+    impl_cache_flush_alg(0, alg, store);
 }
 
 int ossl_method_store_cache_flush_all(OSSL_METHOD_STORE *store)
 {
     if (!ossl_property_write_lock(store))
         return 0;
-    ossl_sa_ALGORITHM_doall(store->algs, &impl_cache_flush_alg);
+    ossl_sa_ALGORITHM_doall_arg(store->algs, &impl_cache_flush_alg, store);
     store->cache_nelem = 0;
-    ossl_property_unlock(store);
+    ossl_method_store_unlock_reclaim(store);
     return 1;
 }
 
@@ -634,7 +993,7 @@ static void impl_cache_flush_cache(QUERY *c, IMPL_CACHE_FLUSH *state)
     state->seed = n;
 
     if ((n & 1) != 0)
-        impl_cache_free(lh_QUERY_delete(state->cache, c));
+        query_retire(lh_QUERY_delete(state->cache, c), state->store);
     else
         state->nelem++;
 }
@@ -643,10 +1002,13 @@ static void impl_cache_flush_one_alg(ossl_uintmax_t idx, ALGORITHM *alg,
                                      void *v)
 {
     IMPL_CACHE_FLUSH *state = (IMPL_CACHE_FLUSH *)v;
+    unsigned long num = lh_QUERY_num_items(alg->cache);
 
     state->cache = alg->cache;
     lh_QUERY_doall_IMPL_CACHE_FLUSH(state->cache, &impl_cache_flush_cache,
                                     state);
+    if (lh_QUERY_num_items(alg->cache) != num)
+        qtable_rebuild(state->store, alg);
 }
 
 static void ossl_method_cache_flush_some(OSSL_METHOD_STORE *store)
@@ -654,6 +1016,7 @@ static void ossl_method_cache_flush_some(OSSL_METHOD_STORE *store)
     IMPL_CACHE_FLUSH state;
     static TSAN_QUALIFIER uint32_t global_seed = 1;
 
+    state.store = store;
     state.nelem = 0;
     state.using_global_seed = 0;
     if ((state.seed = OPENSSL_rdtsc()) == 0) {
@@ -673,29 +1036,39 @@ int ossl_method_store_cache_get(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
                                 int nid, const char *prop_query, void **method)
 {
     ALGORITHM *alg;
+    QUERY_TABLE *table;
     QUERY elem, *r;
+    unsigned long hash;
+    size_t i, mask;
+    unsigned int token;
     int res = 0;
 
     if (nid <= 0 || store == NULL || prop_query == NULL)
         return 0;
 
-    if (!ossl_property_read_lock(store))
+    if (!ossl_rcu_read_lock(store->rcu, &token))
         return 0;
-    alg = ossl_method_store_retrieve(store, nid);
-    if (alg == NULL)
+    alg = alg_index_lookup(store, nid);
+    if (alg == NULL || (table = ossl_rcu_deref(&alg->qtable)) == NULL)
         goto err;
 
     elem.query = prop_query;
     elem.provider = prov;
-    r = lh_QUERY_retrieve(alg->cache, &elem);
-    if (r == NULL)
-        goto err;
-    if (ossl_method_up_ref(&r->method)) {
-        *method = r->method.method;
-        res = 1;
+    hash = OPENSSL_LH_strhash(prop_query);
+    mask = table->size - 1;
+    for (i = hash & mask; (r = ossl_rcu_deref(&table->slots[i])) != NULL;
+         i = (i + 1) & mask) {
+        if (r == &query_tombstone || r->hash != hash
+                || query_cmp(r, &elem) != 0)
+            continue;
+        if (ossl_method_up_ref(&r->method)) {
+            *method = r->method.method;
+            res = 1;
+        }
+        break;
     }
 err:
-    ossl_property_unlock(store);
+    ossl_rcu_read_unlock(store->rcu, token);
     return res;
 }
 
@@ -727,7 +1100,8 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
         elem.query = prop_query;
         elem.provider = prov;
         if ((old = lh_QUERY_delete(alg->cache, &elem)) != NULL) {
-            impl_cache_free(old);
+            qtable_replace(alg, old, NULL);
+            query_retire(old, store);
             store->cache_nelem--;
         }
         goto end;
@@ -736,6 +1110,7 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
     if (p != NULL) {
         p->query = p->body;
         p->provider = prov;
+        p->hash = OPENSSL_LH_strhash(prop_query);
         p->method.method = method;
         p->method.up_ref = method_up_ref;
         p->method.free = method_destruct;
@@ -743,10 +1118,12 @@ int ossl_method_store_cache_set(OSSL_METHOD_STORE *store, OSSL_PROVIDER *prov,
             goto err;
         memcpy((char *)p->query, prop_query, len + 1);
         if ((old = lh_QUERY_insert(alg->cache, p)) != NULL) {
-            impl_cache_free(old);
+            qtable_replace(alg, old, p);
+            query_retire(old, store);
             goto end;
         }
         if (!lh_QUERY_error(alg->cache)) {
+            qtable_insert(store, alg, p);
             if (++store->cache_nelem >= IMPL_CACHE_FLUSH_THRESHOLD)
                 store->cache_need_flush = 1;
             goto end;
@@ -757,6 +1134,6 @@ err:
     res = 0;
     OPENSSL_free(p);
 end:
-    ossl_property_unlock(store);
+    ossl_method_store_unlock_reclaim(store);
     return res;
 }
@@ -0,0 +1,330 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * Batching of RSA private key operations that run in ASYNC jobs.
+ *
+ * The CRT exponentiations of an operation are queued on the thread and the
+ * job pauses.  When RSA_BATCH_MAX operations are queued, the job that
+ * queued the last one runs all of them at once through
+ * ossl_bn_mod_exp_mont_consttime_many() and wakes the others up.  The
+ * requests live on the stacks of the paused jobs, which stay valid until
+ * the jobs are resumed.  Jobs in a partial batch wait until the
+ * application calls RSA_batch_flush() or resumes one of them.
+ *
+ * A wait context can be freed, and a job resumed, on another thread than
+ * the one that queued the request, so the queues and the requests in them
+ * are only touched with batch_lock held.  The exponentiations run without
+ * it.
+ */
+
+#include <openssl/rsa.h>
+#include <openssl/async.h>
+#include "internal/cryptlib.h"
+#include "internal/thread_once.h"
+#include "crypto/cryptlib.h"
+#include "crypto/async.h"
+#include "crypto/bn.h"
+#include "crypto/rsa.h"
+
+/* RSA operations in a batch, two exponentiations each */
+#define RSA_BATCH_MAX 4
+
+typedef struct {
+    BIGNUM *r[2];
+    const BIGNUM *a[2], *p[2], *m[2];
+    BN_MONT_CTX *mont[2];
+    ASYNC_WAIT_CTX *waitctx;
+    /* The batch the request is queued in, NULL once it is taken out */
+    struct rsa_batch_st *batch;
+    int done, ret;
+} RSA_BATCH_REQ;
+
+typedef struct rsa_batch_st {
+    int enabled;
+    size_t num;
+    RSA_BATCH_REQ *req[RSA_BATCH_MAX];
+} RSA_BATCH;
+
+static CRYPTO_ONCE batch_init = CRYPTO_ONCE_STATIC_INIT;
+static int batch_inited = 0;
+static CRYPTO_THREAD_LOCAL batch_local;
+static CRYPTO_RWLOCK *batch_lock = NULL;
+
+/* The address is the key of the wake-up event in the wait contexts */
+static const char batch_wake_key = 0;
+
+DEFINE_RUN_ONCE_STATIC(do_batch_init)
+{
+    if ((batch_lock = CRYPTO_THREAD_lock_new()) == NULL)
+        return 0;
+    if (!CRYPTO_THREAD_init_local(&batch_local, NULL)) {
+        CRYPTO_THREAD_lock_free(batch_lock);
+        batch_lock = NULL;
+        return 0;
+    }
+    batch_inited = 1;
+    return 1;
+}
+
+/*
+ * Takes the requests out of |batch| into |req|, which has room for
+ * RSA_BATCH_MAX of them, and returns their number.  batch_lock must be
+ * held.
+ */
+static size_t batch_take(RSA_BATCH *batch, RSA_BATCH_REQ **req)
+{
+    size_t i, n = batch->num;
+
+    for (i = 0; i < n; i++) {
+        req[i] = batch->req[i];
+        req[i]->batch = NULL;
+    }
+    batch->num = 0;
+    return n;
+}
+
+/*
+ * Requests that are still queued when their thread goes away are left to
+ * their jobs, which run them on their own once they are resumed.
+ */
+static void batch_delete_thread_state(void *unused)
+{
+    RSA_BATCH *batch = CRYPTO_THREAD_get_local(&batch_local);
+    RSA_BATCH_REQ *req[RSA_BATCH_MAX];
+
+    if (batch == NULL)
+        return;
+    CRYPTO_THREAD_set_local(&batch_local, NULL);
+    if (CRYPTO_THREAD_write_lock(batch_lock)) {
+        batch_take(batch, req);
+        CRYPTO_THREAD_unlock(batch_lock);
+    }
+    OPENSSL_free(batch);
+}
+
+void ossl_rsa_batch_cleanup(void)
+{
+    if (batch_inited) {
+        CRYPTO_THREAD_cleanup_local(&batch_local);
+        CRYPTO_THREAD_lock_free(batch_lock);
+        batch_lock = NULL;
+    }
+    batch_inited = 0;
+}
+
+static RSA_BATCH *batch_get(int create)
+{
+    RSA_BATCH *batch;
+
+    if (!RUN_ONCE(&batch_init, do_batch_init))
+        return NULL;
+    batch = CRYPTO_THREAD_get_local(&batch_local);
+    if (batch != NULL || !create)
+        return batch;
+
+    if ((batch = OPENSSL_zalloc(sizeof(*batch))) == NULL)
+        return NULL;
+    if (!ossl_init_thread_start(NULL, NULL, batch_delete_thread_state)
+        || !CRYPTO_THREAD_set_local(&batch_local, batch)) {
+        OPENSSL_free(batch);
+        return NULL;
+    }
+    return batch;
+}
+
+/*
+ * The wait context of a paused job goes away: take its request out of the
+ * batch it is queued in, if any, and do not wake it up anymore.
+ */
+static void batch_wait_ctx_freed(void *arg)
+{
+    RSA_BATCH_REQ *req = arg;
+    RSA_BATCH *batch;
+    size_t i, j;
+
+    if (!CRYPTO_THREAD_write_lock(batch_lock))
+        return;
+    if ((batch = req->batch) != NULL) {
+        for (i = j = 0; i < batch->num; i++)
+            if (batch->req[i] != req)
+                batch->req[j++] = batch->req[i];
+        batch->num = j;
+        req->batch = NULL;
+    }
+    req->waitctx = NULL;
+    CRYPTO_THREAD_unlock(batch_lock);
+}
+
+/*
+ * Run |n| requests taken out of their batch and wake up their jobs, except
+ * for |self|, which is the caller's own request if any.
+ */
+static void batch_run(RSA_BATCH_REQ **req, size_t n, RSA_BATCH_REQ *self,
+                      BN_CTX *ctx)
+{
+    BIGNUM *r[2 * RSA_BATCH_MAX];
+    const BIGNUM *a[2 * RSA_BATCH_MAX], *p[2 * RSA_BATCH_MAX];
+    const BIGNUM *m[2 * RSA_BATCH_MAX];
+    BN_MONT_CTX *mont[2 * RSA_BATCH_MAX];
+    size_t i, j;
+    int ret, locked;
+
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < 2; j++) {
+            r[2 * i + j] = req[i]->r[j];
+            a[2 * i + j] = req[i]->a[j];
+            p[2 * i + j] = req[i]->p[j];
+            m[2 * i + j] = req[i]->m[j];
+            mont[2 * i + j] = req[i]->mont[j];
+        }
+    }
+
+    ret = ossl_bn_mod_exp_mont_consttime_many(r, a, p, m, mont, 2 * n, ctx);
+
+    locked = CRYPTO_THREAD_write_lock(batch_lock);
+    for (i = 0; i < n; i++) {
+        req[i]->ret = ret;
+        req[i]->done = 1;
+        if (locked && req[i] != self && req[i]->waitctx != NULL)
+            ossl_async_wait_ctx_wake(req[i]->waitctx, &batch_wake_key);
+    }
+    if (locked)
+        CRYPTO_THREAD_unlock(batch_lock);
+}
+
+int RSA_batch_enable(int enable)
+{
+    RSA_BATCH *batch = batch_get(enable);
+
+    if (batch == NULL)
+        return !enable;
+    if (!enable && RSA_batch_flush() < 0)
+        return 0;
+    batch->enabled = enable != 0;
+    return 1;
+}
+
+int RSA_batch_flush(void)
+{
+    RSA_BATCH *batch = batch_get(0);
+    RSA_BATCH_REQ *req[RSA_BATCH_MAX];
+    BN_CTX *ctx;
+    size_t n;
+
+    if (batch == NULL)
+        return 0;
+    if ((ctx = BN_CTX_new()) == NULL)
+        return -1;
+    if (!CRYPTO_THREAD_write_lock(batch_lock)) {
+        BN_CTX_free(ctx);
+        return -1;
+    }
+    n = batch_take(batch, req);
+    CRYPTO_THREAD_unlock(batch_lock);
+    if (n > 0)
+        batch_run(req, n, NULL, ctx);
+    BN_CTX_free(ctx);
+    return (int)n;
+}
+
+/*
+ * Whether an RSA private key operation may pause its ASYNC job while it
+ * waits for its batch, so that state kept in the key cannot be relied upon
+ * across the exponentiations.
+ */
+int ossl_rsa_batch_active(void)
+{
+    RSA_BATCH *batch = batch_get(0);
+
+    return batch != NULL && batch->enabled && ASYNC_get_current_job() != NULL;
+}
+
+/*
+ * BN_mod_exp_mont_consttime_x2() for the CRT exponentiations of
+ * rsa_ossl_mod_exp(), which joins the batch of the thread when batching is
+ * enabled, the caller runs in an ASYNC job and the moduli suit the
+ * multi-lane exponentiation.
+ */
+int ossl_rsa_batch_mod_exp_x2(BIGNUM *rr1, const BIGNUM *a1, const BIGNUM *p1,
+                              const BIGNUM *m1, BN_MONT_CTX *mont1,
+                              BIGNUM *rr2, const BIGNUM *a2, const BIGNUM *p2,
+                              const BIGNUM *m2, BN_MONT_CTX *mont2,
+                              BN_CTX *ctx)
+{
+    RSA_BATCH *batch = batch_get(0);
+    RSA_BATCH_REQ req, *reqs[RSA_BATCH_MAX];
+    ASYNC_WAIT_CTX *waitctx;
+    ASYNC_JOB *job;
+    size_t n;
+    int pause;
+
+    if (batch == NULL || !batch->enabled
+        || (job = ASYNC_get_current_job()) == NULL
+        || (req.waitctx = ASYNC_get_wait_ctx(job)) == NULL
+        || mont1 == NULL || mont2 == NULL
+        || ossl_bn_mod_exp_mont_consttime_lanes(m1) == 0
+        || ossl_bn_mod_exp_mont_consttime_lanes(m2) == 0)
+        return BN_mod_exp_mont_consttime_x2(rr1, a1, p1, m1, mont1,
+                                            rr2, a2, p2, m2, mont2, ctx);
+
+    req.r[0] = rr1;
+    req.a[0] = a1;
+    req.p[0] = p1;
+    req.m[0] = m1;
+    req.mont[0] = mont1;
+    req.r[1] = rr2;
+    req.a[1] = a2;
+    req.p[1] = p2;
+    req.m[1] = m2;
+    req.mont[1] = mont2;
+    req.done = req.ret = 0;
+
+    if (!CRYPTO_THREAD_write_lock(batch_lock))
+        return BN_mod_exp_mont_consttime_x2(rr1, a1, p1, m1, mont1,
+                                            rr2, a2, p2, m2, mont2, ctx);
+    /* Only a job that pauses needs a wake-up event */
+    pause = batch->num + 1 < RSA_BATCH_MAX;
+    if (pause
+        && !ossl_async_wait_ctx_set_wake_fd(req.waitctx, &batch_wake_key,
+                                            batch_wait_ctx_freed, &req)) {
+        CRYPTO_THREAD_unlock(batch_lock);
+        return BN_mod_exp_mont_consttime_x2(rr1, a1, p1, m1, mont1,
+                                            rr2, a2, p2, m2, mont2, ctx);
+    }
+    req.batch = batch;
+    batch->req[batch->num++] = &req;
+    CRYPTO_THREAD_unlock(batch_lock);
+
+    if (pause)
+        ASYNC_pause_job();
+
+    /*
+     * A job that is resumed before its batch has run, or that cannot
+     * pause, runs the batch as it is.  One whose request was taken out of
+     * its batch without being run runs on its own.
+     */
+    if (!CRYPTO_THREAD_write_lock(batch_lock))
+        return 0;
+    waitctx = req.waitctx;
+    if (req.done) {
+        n = 0;
+    } else if (req.batch != NULL) {
+        n = batch_take(req.batch, reqs);
+    } else {
+        reqs[0] = &req;
+        n = 1;
+    }
+    CRYPTO_THREAD_unlock(batch_lock);
+    if (n > 0)
+        batch_run(reqs, n, &req, ctx);
+    if (pause && waitctx != NULL)
+        ossl_async_wait_ctx_clear_wake_fd(waitctx, &batch_wake_key);
+    return req.ret;
+}
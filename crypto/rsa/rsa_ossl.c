@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -197,7 +197,16 @@ static BN_BLINDING *rsa_get_blinding(RSA *rsa, int *local, BN_CTX *ctx)
     if (ret == NULL)
         goto err;
 
-    if (BN_BLINDING_is_current_thread(ret)) {
+    /*
+     * A job that waits for its batch of exponentiations can be interleaved
+     * with other jobs of the same thread, so it must not keep its
+     * unblinding factor in the BN_BLINDING either.
+     */
+    if (BN_BLINDING_is_current_thread(ret)
+#ifndef FIPS_MODULE
+        && !ossl_rsa_batch_active()
+#endif
+        ) {
         /* rsa->blinding is ours! */
 
         *local = 1;
@@ -840,11 +849,20 @@ static int rsa_ossl_mod_exp(BIGNUM *r0, const BIGNUM *I, RSA *rsa, BN_CTX *ctx)
              *    m1 = m1^dmq1 mod q
              *    r1 = r1^dmp1 mod p
              */
+#ifndef FIPS_MODULE
+            /* or as part of a batch of RSA operations */
+            || !ossl_rsa_batch_mod_exp_x2(m1, m1, rsa->dmq1, rsa->q,
+                                          rsa->_method_mod_q,
+                                          r1, r1, rsa->dmp1, rsa->p,
+                                          rsa->_method_mod_p,
+                                          ctx)
+#else
             || !BN_mod_exp_mont_consttime_x2(m1, m1, rsa->dmq1, rsa->q,
                                              rsa->_method_mod_q,
                                              r1, r1, rsa->dmp1, rsa->p,
                                              rsa->_method_mod_p,
                                              ctx)
+#endif
             /* r1 = (r1 - m1) mod p */
             /*
              * bn_mod_sub_fixed_top is not regular modular subtraction,
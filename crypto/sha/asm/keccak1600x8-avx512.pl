@@ -0,0 +1,356 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+#
+# Keccak-f[1600] on eight independent states for AVX-512F.
+#
+# Unlike keccak1600-avx512.pl, which spreads one state over a handful
+# of zmm registers, this module places 64-bit lane [y][x] of eight
+# states in %zmm(5*y+x), so that every step of the permutation is a
+# straight sequence of vertical operations and the five-way XORs of
+# Theta and the Chi step map onto vpternlogq. Pi is folded into Rho by
+# rotating the lanes along the single 24-element cycle of the Pi
+# permutation, with one spare register to break the cycle. This leaves
+# seven of the 32 registers for temporaries.
+#
+# States are interleaved in memory, A[5*y+x][i] being lane [y][x] of the
+# i-th state, and it is up to the caller to absorb and squeeze:
+#
+# void KeccakF1600_x8(uint64_t A[25][8]);
+# int KeccakF1600_x8_capable(void);
+#
+########################################################################
+# Aggregate permutation throughput in MB/s at r=1088, which corresponds
+# to SHA3-256, against the single-state keccak1600-x86_64 module:
+#
+#			this		keccak1600-x86_64
+#
+# Ice Lake-SP		1940		266
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+$avx512=0;
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+		=~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+	$avx512 = ($1>=2.25);
+}
+
+if (!$avx512 && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+	   `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)/) {
+	$avx512 = ($1>=2.12);
+}
+
+if (!$avx512 && `$ENV{CC} -v 2>&1`
+	    =~ /((?:clang|LLVM) version|.*based on LLVM) ([0-9]+)\.([0-9]+)/) {
+	$avx512 = ($2>=4);
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+if ($avx512) {
+
+my @A = map("%zmm$_",(0..24));		# A[5*y+x]
+my @T = map("%zmm$_",(25..31));
+my ($ctx,$iotas,$rounds) = ("%rdi","%r10","%ecx");
+
+my @rhotates = ( 0,  1, 62, 28, 27,
+		36, 44,  6, 55, 20,
+		 3, 10, 43, 25, 39,
+		41, 45, 15, 21,  8,
+		18,  2, 61, 56, 14 );
+
+# Pi sets A[y][x] to A[x][(3*y+x)%5], i.e. lane $i is taken from $pi[$i]
+my @pi = map { my ($y,$x) = (int($_/5),$_%5); 5*$x+(3*$y+$x)%5 } (0..24);
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+
+.globl	KeccakF1600_x8_capable
+.type	KeccakF1600_x8_capable,\@abi-omnipotent
+.align	32
+KeccakF1600_x8_capable:
+.cfi_startproc
+	mov	OPENSSL_ia32cap_P+8(%rip),%eax
+	and	\$`1<<16`,%eax			# AVX512F
+	ret
+.cfi_endproc
+.size	KeccakF1600_x8_capable,.-KeccakF1600_x8_capable
+
+.globl	KeccakF1600_x8
+.type	KeccakF1600_x8,\@function,1
+.align	32
+KeccakF1600_x8:
+.cfi_startproc
+	mov	%rsp,%rax
+.cfi_def_cfa_register	%rax
+___
+$code.=<<___ if ($win64);
+	lea	-0xa8(%rsp),%rsp
+	movaps	%xmm6,0x00(%rsp)
+	movaps	%xmm7,0x10(%rsp)
+	movaps	%xmm8,0x20(%rsp)
+	movaps	%xmm9,0x30(%rsp)
+	movaps	%xmm10,0x40(%rsp)
+	movaps	%xmm11,0x50(%rsp)
+	movaps	%xmm12,0x60(%rsp)
+	movaps	%xmm13,0x70(%rsp)
+	movaps	%xmm14,0x80(%rsp)
+	movaps	%xmm15,0x90(%rsp)
+___
+$code.=<<___;
+.Lbody:
+___
+for (0..24) {
+    $code.="	vmovdqu64	`64*$_`($ctx),$A[$_]\n";
+}
+$code.=<<___;
+	lea	iotas(%rip),$iotas
+	mov	\$24,$rounds
+	jmp	.Loop
+
+.align	32
+.Loop:
+___
+    ######################################### Theta
+    for my $x (0..4) {
+	$code.=<<___;
+	vmovdqa64	$A[$x],$T[$x]
+	vpternlogq	\$0x96,$A[10+$x],$A[5+$x],$T[$x]
+	vpternlogq	\$0x96,$A[20+$x],$A[15+$x],$T[$x]	# C[$x]
+___
+    }
+    $code.=<<___;
+	vprolq		\$1,$T[1],$T[5]
+	vprolq		\$1,$T[4],$T[6]
+	vpxorq		$T[4],$T[5],$T[5]		# D[0]
+	vpxorq		$T[2],$T[6],$T[6]		# D[3]
+	vprolq		\$1,$T[2],$T[4]
+	vprolq		\$1,$T[3],$T[2]
+	vpxorq		$T[0],$T[4],$T[4]		# D[1]
+	vpxorq		$T[1],$T[2],$T[2]		# D[2]
+	vprolq		\$1,$T[0],$T[0]
+	vpxorq		$T[3],$T[0],$T[0]		# D[4]
+___
+    my @D = @T[5,4,2,6,0];
+    for (0..24) {
+	$code.="	vpxorq		$D[$_%5],$A[$_],$A[$_]\n";
+    }
+
+    ######################################### Rho and Pi
+    $code.="	vmovdqa64	$A[1],$T[1]\n";
+    my ($i,$n) = (1,0);
+    while ($pi[$i] != 1) {
+	$code.="	vprolq		\$$rhotates[$pi[$i]],$A[$pi[$i]],$A[$i]\n";
+	$i = $pi[$i]; $n++;
+    }
+    $code.="	vprolq		\$$rhotates[1],$T[1],$A[$i]\n";
+    die "Pi is not a single cycle" if ($n != 23);
+
+    ######################################### Chi
+    for my $y (0..4) {
+	my @B = @A[5*$y..5*$y+4];
+	my ($t0,$t1) = @T[(2*$y)%7,(2*$y+1)%7];
+	$code.=<<___;
+	vmovdqa64	$B[0],$t0
+	vmovdqa64	$B[1],$t1
+	vpternlogq	\$0xd2,$B[2],$B[1],$B[0]	# B[0]^(~B[1]&B[2])
+	vpternlogq	\$0xd2,$B[3],$B[2],$B[1]
+	vpternlogq	\$0xd2,$B[4],$B[3],$B[2]
+	vpternlogq	\$0xd2,$t0,$B[4],$B[3]
+	vpternlogq	\$0xd2,$t1,$t0,$B[4]
+___
+    }
+
+    ######################################### Iota
+$code.=<<___;
+	vpxorq		($iotas){1to8},$A[0],$A[0]
+	lea		8($iotas),$iotas
+	dec		$rounds
+	jnz		.Loop
+
+___
+for (0..24) {
+    $code.="	vmovdqu64	$A[$_],`64*$_`($ctx)\n";
+}
+$code.=<<___;
+	vzeroupper
+___
+$code.=<<___ if ($win64);
+	movaps	-0xa8(%rax),%xmm6
+	movaps	-0x98(%rax),%xmm7
+	movaps	-0x88(%rax),%xmm8
+	movaps	-0x78(%rax),%xmm9
+	movaps	-0x68(%rax),%xmm10
+	movaps	-0x58(%rax),%xmm11
+	movaps	-0x48(%rax),%xmm12
+	movaps	-0x38(%rax),%xmm13
+	movaps	-0x28(%rax),%xmm14
+	movaps	-0x18(%rax),%xmm15
+	lea	(%rax),%rsp
+___
+$code.=<<___;
+.Lepilogue:
+	ret
+.cfi_endproc
+.size	KeccakF1600_x8,.-KeccakF1600_x8
+
+.align	64
+iotas:
+	.quad	0x0000000000000001, 0x0000000000008082
+	.quad	0x800000000000808a, 0x8000000080008000
+	.quad	0x000000000000808b, 0x0000000080000001
+	.quad	0x8000000080008081, 0x8000000000008009
+	.quad	0x000000000000008a, 0x0000000000000088
+	.quad	0x0000000080008009, 0x000000008000000a
+	.quad	0x000000008000808b, 0x800000000000008b
+	.quad	0x8000000000008089, 0x8000000000008003
+	.quad	0x8000000000008002, 0x8000000000000080
+	.quad	0x000000000000800a, 0x800000008000000a
+	.quad	0x8000000080008081, 0x8000000000008080
+	.quad	0x0000000080000001, 0x8000000080008008
+.asciz	"Keccak-1600 x8 for AVX-512F"
+___
+
+if ($win64) {
+# EXCEPTION_DISPOSITION handler (EXCEPTION_RECORD *rec,ULONG64 frame,
+#		CONTEXT *context,DISPATCHER_CONTEXT *disp)
+$rec="%rcx";
+$frame="%rdx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+.type	se_handler,\@abi-omnipotent
+.align	16
+se_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# end of prologue label
+	cmp	%r10,%rbx		# context->Rip<.Lbody
+	jb	.Lin_prologue
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=.Lepilogue
+	jae	.Lin_prologue
+
+	lea	-0xa8(%rax),%rsi
+	lea	512($context),%rdi	# &context.Xmm6
+	mov	\$20,%ecx
+	.long	0xa548f3fc		# cld; rep movsq
+
+.Lin_prologue:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	se_handler,.-se_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_KeccakF1600_x8
+	.rva	.LSEH_end_KeccakF1600_x8
+	.rva	.LSEH_info_KeccakF1600_x8
+
+.section	.xdata
+.align	8
+.LSEH_info_KeccakF1600_x8:
+	.byte	9,0,0,0
+	.rva	se_handler
+	.rva	.Lbody,.Lepilogue			# HandlerData[]
+___
+}
+
+} else {
+# The assembler cannot encode AVX-512, the subroutine is never called.
+$code.=<<___;
+.text
+
+.globl	KeccakF1600_x8_capable
+.type	KeccakF1600_x8_capable,\@abi-omnipotent
+KeccakF1600_x8_capable:
+	xor	%eax,%eax
+	ret
+.size	KeccakF1600_x8_capable,.-KeccakF1600_x8_capable
+
+.globl	KeccakF1600_x8
+.type	KeccakF1600_x8,\@abi-omnipotent
+KeccakF1600_x8:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	KeccakF1600_x8,.-KeccakF1600_x8
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -0,0 +1,781 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+
+# Multi-buffer SHA512 procedure, the 64-bit counterpart of
+# sha256-mb-x86_64.pl. n buffers are processed in parallel by placing
+# buffer data to designated 64-bit lane of SIMD register. There is no
+# SSE or AVX code path, as a 128-bit register holds two lanes only, so n
+# is 4 on AVX2-capable processors and 8 on processors with AVX512F and
+# AVX512BW.
+#
+# The AVX512 code path keeps the whole message schedule in %zmm16-31,
+# gathers input with unaligned row loads and an in-register 8x8
+# transpose, and computes Sigma, Ch and Maj with vprorq and vpternlogq.
+#
+# Aggregate throughput in MB/s, over 4KB buffers, compared to the
+# single-buffer sha512-x86_64 module:
+#
+#			this		sha512		gain
+# -------------------------------------------------------------------
+# Ice Lake-SP, n=8	2200		400		x5.5
+# Ice Lake-SP, n=4(i)	815		400		x2.0
+#
+# (i)	AVX512 masked off in OPENSSL_ia32cap;
+
+# $output is the last argument if it looks like a file (it has an extension)
+# $flavour is the first argument if it doesn't look like a file
+$output = $#ARGV >= 0 && $ARGV[$#ARGV] =~ m|\.\w+$| ? pop : undef;
+$flavour = $#ARGV >= 0 && $ARGV[0] !~ m|\.| ? shift : undef;
+
+$win64=0; $win64=1 if ($flavour =~ /[nm]asm|mingw64/ || $output =~ /\.asm$/);
+
+$0 =~ m/(.*[\/\\])[^\/\\]+$/; $dir=$1;
+( $xlate="${dir}x86_64-xlate.pl" and -f $xlate ) or
+( $xlate="${dir}../../perlasm/x86_64-xlate.pl" and -f $xlate) or
+die "can't locate x86_64-xlate.pl";
+
+push(@INC,"${dir}","${dir}../../perlasm");
+require "x86_64-support.pl";
+
+$ptr_size=&pointer_size($flavour);
+
+$avx=0;
+
+if (`$ENV{CC} -Wa,-v -c -o /dev/null -x assembler /dev/null 2>&1`
+		=~ /GNU assembler version ([2-9]\.[0-9]+)/) {
+	$avx = ($1>=2.19) + ($1>=2.22) + ($1>=2.25);
+}
+
+if (!$avx && $win64 && ($flavour =~ /nasm/ || $ENV{ASM} =~ /nasm/) &&
+	   `nasm -v 2>&1` =~ /NASM version ([2-9]\.[0-9]+)/) {
+	$avx = ($1>=2.09) + ($1>=2.10) + ($1>=2.12);
+}
+
+if (!$avx && $win64 && ($flavour =~ /masm/ || $ENV{ASM} =~ /ml64/) &&
+	   `ml64 2>&1` =~ /Version ([0-9]+)\./) {
+	$avx = ($1>=10) + ($1>=12);
+}
+
+if (!$avx && `$ENV{CC} -v 2>&1` =~ /((?:clang|LLVM) version|.*based on LLVM) ([0-9]+\.[0-9]+)/) {
+	$avx = ($2>=3.0) + ($2>3.0);
+}
+
+open OUT,"| \"$^X\" \"$xlate\" $flavour \"$output\""
+    or die "can't call $xlate: $!";
+*STDOUT=*OUT;
+
+# void sha512_multi_block (
+#     struct {	unsigned long long A[8];
+#		unsigned long long B[8];
+#		unsigned long long C[8];
+#		unsigned long long D[8];
+#		unsigned long long E[8];
+#		unsigned long long F[8];
+#		unsigned long long G[8];
+#		unsigned long long H[8];	} *ctx,
+#     struct {	void *ptr; int blocks;	} inp[8],
+#     int num);		/* 1 or 2 */
+#
+# int sha512_multi_block_capable(void);	/* non-zero if AVX2 is there */
+#
+$ctx="%rdi";	# 1st arg
+$inp="%rsi";	# 2nd arg
+$num="%edx";	# 3rd arg
+@ptr=map("%r$_",(8..15));
+$Tbl="%rbp";
+$inp_elm_size=2*$ptr_size;
+
+if ($avx>1) {{{
+
+$REG_SZ=32;
+
+@V=($A,$B,$C,$D,$E,$F,$G,$H)=map("%ymm$_",(8..15));
+($t1,$t2,$t3,$axb,$bxc,$Xi,$Xn,$sigma)=map("%ymm$_",(0..7));
+
+sub Xi_off {
+my $off = shift;
+
+    $off %= 16; $off *= $REG_SZ;
+    $off<256 ? "$off-128(%rax)" : "$off-256-128(%rbx)";
+}
+
+sub xmm { my $r = shift; $r =~ s/%[yz]mm/%xmm/; $r; }
+
+sub ROUND_00_15_avx2 {
+my ($i,$a,$b,$c,$d,$e,$f,$g,$h)=@_;
+my ($xi,$xt)=(&xmm($Xi),&xmm($t1));
+
+$code.=<<___ if ($i<16);
+	vmovq		`8*$i`(@ptr[0]),$xi
+	vmovq		`8*$i`(@ptr[2]),$xt
+	vpinsrq		\$1,`8*$i`(@ptr[1]),$xi,$xi
+	vpinsrq		\$1,`8*$i`(@ptr[3]),$xt,$xt
+	vinserti128	\$1,$xt,$Xi,$Xi
+	vpshufb		$Xn,$Xi,$Xi
+___
+$code.=<<___ if ($i==15);
+	lea		`16*8`(@ptr[0]),@ptr[0]
+	lea		`16*8`(@ptr[1]),@ptr[1]
+	lea		`16*8`(@ptr[2]),@ptr[2]
+	lea		`16*8`(@ptr[3]),@ptr[3]
+___
+$code.=<<___;
+	vpsrlq	\$14,$e,$sigma
+	vpsllq	\$50,$e,$t3
+	vmovdqu	$Xi,`&Xi_off($i)`
+	 vpaddq	$h,$Xi,$Xi			# Xi+=h
+
+	vpsrlq	\$18,$e,$t2
+	vpxor	$t3,$sigma,$sigma
+	vpsllq	\$46,$e,$t3
+	 vpbroadcastq	`8*($i%16)`($Tbl),$t1
+	vpxor	$t2,$sigma,$sigma
+
+	vpsrlq	\$41,$e,$t2
+	vpxor	$t3,$sigma,$sigma
+	vpsllq	\$23,$e,$t3
+	 vpaddq	$t1,$Xi,$Xi			# Xi+=K[round]
+	vpxor	$t2,$sigma,$sigma
+	 vpandn	$g,$e,$t1
+	 vpand	$f,$e,$t2
+	vpxor	$t3,$sigma,$sigma		# Sigma1(e)
+	 vpxor	$t2,$t1,$t1			# Ch(e,f,g)
+	vpaddq	$sigma,$Xi,$Xi			# Xi+=Sigma1(e)
+	 vpaddq	$t1,$Xi,$Xi			# Xi+=Ch(e,f,g)
+
+	vpsrlq	\$28,$a,$sigma
+	vpsllq	\$36,$a,$t3
+	 vpxor	$a,$b,$axb			# a^b, b^c in next round
+	vpsrlq	\$34,$a,$t2
+	vpxor	$t3,$sigma,$sigma
+	vpsllq	\$30,$a,$t3
+	 vpand	$axb,$bxc,$bxc
+	vpxor	$t2,$sigma,$sigma
+
+	vpsrlq	\$39,$a,$t2
+	vpxor	$t3,$sigma,$sigma
+	vpsllq	\$25,$a,$t3
+	 vpxor	$bxc,$b,$h			# h=Maj(a,b,c)=Ch(a^b,c,b)
+	vpxor	$t2,$sigma,$sigma
+	 vpaddq	$Xi,$d,$d			# d+=Xi
+	vpxor	$t3,$sigma,$sigma		# Sigma0(a)
+
+	vpaddq	$Xi,$h,$h			# h+=Xi
+	vpaddq	$sigma,$h,$h			# h+=Sigma0(a)
+___
+$code.=<<___ if (($i%16)==15);
+	lea	`16*8`($Tbl),$Tbl
+___
+	($axb,$bxc)=($bxc,$axb);
+}
+
+sub ROUND_16_XX_avx2 {
+my $i=shift;
+
+$code.=<<___;
+	vmovdqu	`&Xi_off($i+1)`,$Xn
+	vpaddq	`&Xi_off($i+9)`,$Xi,$Xi		# Xi+=X[i+9]
+
+	vpsrlq	\$1,$Xn,$sigma
+	vpsllq	\$63,$Xn,$t3
+	vpsrlq	\$8,$Xn,$t2
+	vpxor	$t3,$sigma,$sigma
+	vpsllq	\$56,$Xn,$t3
+	vpxor	$t2,$sigma,$sigma
+	vpsrlq	\$7,$Xn,$t2
+	vpxor	$t3,$sigma,$sigma
+	vmovdqu	`&Xi_off($i+14)`,$t1
+	vpxor	$t2,$sigma,$sigma		# sigma0(X[i+1])
+
+	vpsrlq	\$19,$t1,$t2
+	 vpaddq	$sigma,$Xi,$Xi			# Xi+=sigma0(X[i+1])
+	vpsllq	\$45,$t1,$t3
+	vpxor	$t3,$t2,$sigma
+	vpsrlq	\$61,$t1,$t2
+	vpxor	$t2,$sigma,$sigma
+	vpsllq	\$3,$t1,$t3
+	vpxor	$t3,$sigma,$sigma
+	vpsrlq	\$6,$t1,$t2
+	vpxor	$t2,$sigma,$sigma		# sigma1(X[i+14])
+	vpaddq	$sigma,$Xi,$Xi			# Xi+=sigma1(X[i+14])
+___
+	&ROUND_00_15_avx2($i,@_);
+	($Xi,$Xn)=($Xn,$Xi);
+}
+
+$code.=<<___;
+.text
+
+.extern	OPENSSL_ia32cap_P
+
+.globl	sha512_multi_block_capable
+.type	sha512_multi_block_capable,\@abi-omnipotent
+.align	32
+sha512_multi_block_capable:
+.cfi_startproc
+	mov	OPENSSL_ia32cap_P+8(%rip),%eax
+	and	\$`1<<5`,%eax			# AVX2
+	ret
+.cfi_endproc
+.size	sha512_multi_block_capable,.-sha512_multi_block_capable
+
+.globl	sha512_multi_block
+.type	sha512_multi_block,\@function,3
+.align	32
+sha512_multi_block:
+.cfi_startproc
+	mov	%rsp,%rax
+.cfi_def_cfa_register	%rax
+	push	%rbx
+.cfi_push	%rbx
+	push	%rbp
+.cfi_push	%rbp
+	push	%r12
+.cfi_push	%r12
+	push	%r13
+.cfi_push	%r13
+	push	%r14
+.cfi_push	%r14
+	push	%r15
+.cfi_push	%r15
+___
+$code.=<<___ if ($win64);
+	lea	-0xa8(%rsp),%rsp
+	movaps	%xmm6,(%rsp)
+	movaps	%xmm7,0x10(%rsp)
+	movaps	%xmm8,0x20(%rsp)
+	movaps	%xmm9,0x30(%rsp)
+	movaps	%xmm10,0x40(%rsp)
+	movaps	%xmm11,0x50(%rsp)
+	movaps	%xmm12,-0x78(%rax)
+	movaps	%xmm13,-0x68(%rax)
+	movaps	%xmm14,-0x58(%rax)
+	movaps	%xmm15,-0x48(%rax)
+___
+$code.=<<___;
+	sub	\$`$REG_SZ*18`, %rsp
+	and	\$-256,%rsp
+	mov	%rax,`$REG_SZ*17`(%rsp)		# original %rsp
+.cfi_cfa_expression	%rsp+`$REG_SZ*17`,deref,+8
+.Lbody:
+	lea	K512(%rip),$Tbl
+	lea	0x80($ctx),$ctx			# size optimization
+___
+$code.=<<___ if ($avx>2);
+	cmp	\$2,$num
+	jb	.Loop_grande_avx2
+	mov	OPENSSL_ia32cap_P+8(%rip),%ecx
+	and	\$`1<<30|1<<16`,%ecx		# AVX512BW|AVX512F
+	cmp	\$`1<<30|1<<16`,%ecx
+	je	.Lavx512
+___
+$code.=<<___;
+.Loop_grande_avx2:
+	mov	$num,`$REG_SZ*17+8`(%rsp)	# original $num
+	xor	$num,$num
+	lea	`$REG_SZ*16`(%rsp),%rbx
+___
+for($i=0;$i<4;$i++) {
+    $ptr_reg=&pointer_register($flavour,@ptr[$i]);
+    $code.=<<___;
+	# input pointer
+	mov	`$inp_elm_size*$i+0`($inp),$ptr_reg
+	# number of blocks
+	mov	`$inp_elm_size*$i+$ptr_size`($inp),%ecx
+	cmp	$num,%ecx
+	cmovg	%ecx,$num			# find maximum
+	test	%ecx,%ecx
+	mov	%rcx,`8*$i`(%rbx)		# initialize counters
+	cmovle	$Tbl,@ptr[$i]			# cancel input
+___
+}
+$code.=<<___;
+	test	$num,$num
+	jz	.Lnext_grande_avx2
+
+	vmovdqu	0x00-0x80($ctx),$A		# load context
+	 lea	128(%rsp),%rax
+	vmovdqu	0x40-0x80($ctx),$B
+	 lea	256+128(%rsp),%rbx
+	vmovdqu	0x80-0x80($ctx),$C
+	vmovdqu	0xc0-0x80($ctx),$D
+	vmovdqu	0x100-0x80($ctx),$E
+	vmovdqu	0x140-0x80($ctx),$F
+	vmovdqu	0x180-0x80($ctx),$G
+	vmovdqu	0x1c0-0x80($ctx),$H
+	vmovdqu	.Lpbswap(%rip),$Xn
+	jmp	.Loop_avx2
+
+.align	32
+.Loop_avx2:
+	vpxor	$B,$C,$bxc			# magic seed
+___
+for($i=0;$i<16;$i++)	{ &ROUND_00_15_avx2($i,@V); unshift(@V,pop(@V)); }
+$code.=<<___;
+	vmovdqu	`&Xi_off($i)`,$Xi
+	mov	\$4,%ecx
+	jmp	.Loop_16_xx_avx2
+.align	32
+.Loop_16_xx_avx2:
+___
+for(;$i<32;$i++)	{ &ROUND_16_XX_avx2($i,@V); unshift(@V,pop(@V)); }
+$code.=<<___;
+	dec	%ecx
+	jnz	.Loop_16_xx_avx2
+
+	mov	\$1,%ecx
+	lea	`$REG_SZ*16`(%rsp),%rbx
+	lea	K512(%rip),$Tbl
+___
+for($i=0;$i<4;$i++) {
+    $code.=<<___;
+	cmp	`8*$i`(%rbx),%rcx		# examine counters
+	cmovge	$Tbl,@ptr[$i]			# cancel input
+___
+}
+$code.=<<___;
+	vmovdqa	(%rbx),$sigma			# pull counters
+	vpxor	$t1,$t1,$t1
+	vpcmpgtq $t1,$sigma,$Xn			# mask value
+	vpaddq	$Xn,$sigma,$sigma		# counters--
+
+	vpand	$Xn,$A,$A
+	vpand	$Xn,$B,$B
+	vpand	$Xn,$C,$C
+	vpand	$Xn,$D,$D
+	vpaddq	0x00-0x80($ctx),$A,$A
+	vpand	$Xn,$E,$E
+	vpaddq	0x40-0x80($ctx),$B,$B
+	vpand	$Xn,$F,$F
+	vpaddq	0x80-0x80($ctx),$C,$C
+	vpand	$Xn,$G,$G
+	vpaddq	0xc0-0x80($ctx),$D,$D
+	vpand	$Xn,$H,$H
+	vpaddq	0x100-0x80($ctx),$E,$E
+	vpaddq	0x140-0x80($ctx),$F,$F
+	vmovdqu	$A,0x00-0x80($ctx)
+	vpaddq	0x180-0x80($ctx),$G,$G
+	vmovdqu	$B,0x40-0x80($ctx)
+	vpaddq	0x1c0-0x80($ctx),$H,$H
+	vmovdqu	$C,0x80-0x80($ctx)
+	vmovdqu	$D,0xc0-0x80($ctx)
+	vmovdqu	$E,0x100-0x80($ctx)
+	vmovdqu	$F,0x140-0x80($ctx)
+	vmovdqu	$G,0x180-0x80($ctx)
+	vmovdqu	$H,0x1c0-0x80($ctx)
+
+	vmovdqa	$sigma,(%rbx)			# save counters
+	lea	256+128(%rsp),%rbx
+	vmovdqu	.Lpbswap(%rip),$Xn
+	dec	$num
+	jnz	.Loop_avx2
+
+.Lnext_grande_avx2:
+	mov	`$REG_SZ*17+8`(%rsp),$num
+	lea	$REG_SZ($ctx),$ctx
+	lea	`$inp_elm_size*4`($inp),$inp
+	dec	$num
+	jnz	.Loop_grande_avx2
+___
+						if ($avx>2) {
+@V=($A,$B,$C,$D,$E,$F,$G,$H)=map("%zmm$_",(0..7));
+($Xi,$t1,$t2,$t3)=map("%zmm$_",(8..11));
+@W=map("%zmm$_",(24..31,16..23));	# message schedule, see TRANSPOSE
+
+# Loads 8 words from each of 8 inputs at offset $off and transposes them,
+# so that word k of all lanes ends up in @$out[k]. @$rows is scratch.
+sub TRANSPOSE_avx512 {
+my ($off,$rows,$out)=@_;
+my (@r,@t,@u);
+
+    @r=@$rows; @t=@$out;
+    for (0..7) {
+	$code.="	vmovdqu64	$off(@ptr[$_]),$r[$_]\n";
+    }
+    for (0..3) {
+	$code.=<<___;
+	vpunpcklqdq	$r[2*$_+1],$r[2*$_],$t[2*$_]
+	vpunpckhqdq	$r[2*$_+1],$r[2*$_],$t[2*$_+1]
+___
+    }
+    @u=@r;		# words 0/4, 2/6, 1/5, 3/7 of lanes 0-3, then 4-7
+    for (0,4) {
+	$code.=<<___;
+	vshufi64x2	\$0x88,$t[$_+2],$t[$_],$u[$_]
+	vshufi64x2	\$0xdd,$t[$_+2],$t[$_],$u[$_+1]
+	vshufi64x2	\$0x88,$t[$_+3],$t[$_+1],$u[$_+2]
+	vshufi64x2	\$0xdd,$t[$_+3],$t[$_+1],$u[$_+3]
+___
+    }
+    for ([0,0,4],[1,2,6],[2,1,5],[3,3,7]) {
+	my ($j,$k,$l)=@$_;
+	$code.=<<___;
+	vshufi64x2	\$0x88,$u[$j+4],$u[$j],$t[$k]
+	vshufi64x2	\$0xdd,$u[$j+4],$u[$j],$t[$l]
+___
+    }
+    for (0..7) {
+	$code.="	vpshufb		.Lpbswap(%rip),$t[$_],$t[$_]\n";
+    }
+}
+
+sub ROUND_avx512 {
+my ($i,$a,$b,$c,$d,$e,$f,$g,$h)=@_;
+my @X=map($W[($i+$_)%16],(0,1,9,14));
+
+$code.=<<___ if ($i>=16);
+	vprorq	\$1,$X[1],$t1
+	vprorq	\$8,$X[1],$t2
+	vpsrlq	\$7,$X[1],$t3
+	vpaddq	$X[2],$X[0],$X[0]		# X[i]+=X[i+9]
+	vpternlogq	\$0x96,$t3,$t2,$t1		# sigma0(X[i+1])
+	vpaddq	$t1,$X[0],$X[0]
+	vprorq	\$19,$X[3],$t1
+	vprorq	\$61,$X[3],$t2
+	vpsrlq	\$6,$X[3],$t3
+	vpternlogq	\$0x96,$t3,$t2,$t1		# sigma1(X[i+14])
+	vpaddq	$t1,$X[0],$X[0]
+___
+$code.=<<___;
+	vpaddq	`8*($i%16)`($Tbl){1to8},$X[0],$Xi	# Xi=X[i]+K[round]
+	vprorq	\$14,$e,$t1
+	vprorq	\$18,$e,$t2
+	vprorq	\$41,$e,$t3
+	vpaddq	$h,$Xi,$Xi			# Xi+=h
+	vpternlogq	\$0x96,$t3,$t2,$t1		# Sigma1(e)
+	vmovdqa64	$e,$t2
+	vpternlogq	\$0xca,$g,$f,$t2		# Ch(e,f,g)
+	vpaddq	$t1,$Xi,$Xi			# Xi+=Sigma1(e)
+	vpaddq	$t2,$Xi,$Xi			# Xi+=Ch(e,f,g)
+
+	vprorq	\$28,$a,$t1
+	vprorq	\$34,$a,$t2
+	vprorq	\$39,$a,$t3
+	vmovdqa64	$a,$h
+	vpternlogq	\$0xe8,$c,$b,$h			# h=Maj(a,b,c)
+	vpternlogq	\$0x96,$t3,$t2,$t1		# Sigma0(a)
+	vpaddq	$Xi,$d,$d			# d+=Xi
+	vpaddq	$t1,$h,$h			# h+=Sigma0(a)
+	vpaddq	$Xi,$h,$h			# h+=Xi
+___
+$code.=<<___ if (($i%16)==15);
+	lea	`16*8`($Tbl),$Tbl
+___
+}
+
+$code.=<<___;
+	jmp	.Ldone
+
+.align	32
+.Lavx512:
+	xor	$num,$num
+___
+for($i=0;$i<8;$i++) {
+    $ptr_reg=&pointer_register($flavour,@ptr[$i]);
+    $code.=<<___;
+	# input pointer
+	mov	`$inp_elm_size*$i+0`($inp),$ptr_reg
+	# number of blocks
+	mov	`$inp_elm_size*$i+$ptr_size`($inp),%ecx
+	cmp	$num,%ecx
+	cmovg	%ecx,$num			# find maximum
+	test	%ecx,%ecx
+	mov	%rcx,`8*$i`(%rsp)		# initialize counters
+	cmovle	$Tbl,@ptr[$i]			# cancel input
+___
+}
+$code.=<<___;
+	test	$num,$num
+	jz	.Ldone
+
+	vmovdqu64	0x00-0x80($ctx),$A	# load context
+	vmovdqu64	0x40-0x80($ctx),$B
+	vmovdqu64	0x80-0x80($ctx),$C
+	vmovdqu64	0xc0-0x80($ctx),$D
+	vmovdqu64	0x100-0x80($ctx),$E
+	vmovdqu64	0x140-0x80($ctx),$F
+	vmovdqu64	0x180-0x80($ctx),$G
+	vmovdqu64	0x1c0-0x80($ctx),$H
+	jmp	.Loop_avx512
+
+.align	32
+.Loop_avx512:
+___
+	&TRANSPOSE_avx512(0, [map("%zmm$_",(16..23))], [@W[0..7]]);
+	&TRANSPOSE_avx512(64,[map("%zmm$_",(8..15))],  [@W[8..15]]);
+for($i=0;$i<8;$i++) {
+    $code.="	lea	`16*8`(@ptr[$i]),@ptr[$i]\n";
+}
+for($i=0;$i<16;$i++)	{ &ROUND_avx512($i,@V); unshift(@V,pop(@V)); }
+$code.=<<___;
+	mov	\$4,%ecx
+	jmp	.Loop_16_xx_avx512
+.align	32
+.Loop_16_xx_avx512:
+___
+for(;$i<32;$i++)	{ &ROUND_avx512($i,@V); unshift(@V,pop(@V)); }
+$code.=<<___;
+	dec	%ecx
+	jnz	.Loop_16_xx_avx512
+
+	mov	\$1,%ecx
+	lea	K512(%rip),$Tbl
+___
+for($i=0;$i<8;$i++) {
+    $code.=<<___;
+	cmp	`8*$i`(%rsp),%rcx		# examine counters
+	cmovge	$Tbl,@ptr[$i]			# cancel input
+___
+}
+$code.=<<___;
+	vmovdqa64	(%rsp),$t1		# pull counters
+	vpxorq	$t2,$t2,$t2
+	vpcmpgtq	$t2,$t1,%k1		# mask value
+	vpternlogq	\$0xff,$t2,$t2,$t2
+	vpaddq	$t2,$t1,${t1}{%k1}		# counters--
+	vmovdqa64	$t1,(%rsp)		# save counters
+
+	vmovdqa64	$A,${A}{%k1}{z}
+	vmovdqa64	$B,${B}{%k1}{z}
+	vmovdqa64	$C,${C}{%k1}{z}
+	vmovdqa64	$D,${D}{%k1}{z}
+	vpaddq	0x00-0x80($ctx),$A,$A
+	vmovdqa64	$E,${E}{%k1}{z}
+	vpaddq	0x40-0x80($ctx),$B,$B
+	vmovdqa64	$F,${F}{%k1}{z}
+	vpaddq	0x80-0x80($ctx),$C,$C
+	vmovdqa64	$G,${G}{%k1}{z}
+	vpaddq	0xc0-0x80($ctx),$D,$D
+	vmovdqa64	$H,${H}{%k1}{z}
+	vpaddq	0x100-0x80($ctx),$E,$E
+	vpaddq	0x140-0x80($ctx),$F,$F
+	vmovdqu64	$A,0x00-0x80($ctx)
+	vpaddq	0x180-0x80($ctx),$G,$G
+	vmovdqu64	$B,0x40-0x80($ctx)
+	vpaddq	0x1c0-0x80($ctx),$H,$H
+	vmovdqu64	$C,0x80-0x80($ctx)
+	vmovdqu64	$D,0xc0-0x80($ctx)
+	vmovdqu64	$E,0x100-0x80($ctx)
+	vmovdqu64	$F,0x140-0x80($ctx)
+	vmovdqu64	$G,0x180-0x80($ctx)
+	vmovdqu64	$H,0x1c0-0x80($ctx)
+
+	dec	$num
+	jnz	.Loop_avx512
+___
+						}
+$code.=<<___;
+
+.Ldone:
+	mov	`$REG_SZ*17`(%rsp),%rax		# original %rsp
+.cfi_def_cfa	%rax,8
+	vzeroupper
+___
+$code.=<<___ if ($win64);
+	movaps	-0xd8(%rax),%xmm6
+	movaps	-0xc8(%rax),%xmm7
+	movaps	-0xb8(%rax),%xmm8
+	movaps	-0xa8(%rax),%xmm9
+	movaps	-0x98(%rax),%xmm10
+	movaps	-0x88(%rax),%xmm11
+	movaps	-0x78(%rax),%xmm12
+	movaps	-0x68(%rax),%xmm13
+	movaps	-0x58(%rax),%xmm14
+	movaps	-0x48(%rax),%xmm15
+___
+$code.=<<___;
+	mov	-48(%rax),%r15
+.cfi_restore	%r15
+	mov	-40(%rax),%r14
+.cfi_restore	%r14
+	mov	-32(%rax),%r13
+.cfi_restore	%r13
+	mov	-24(%rax),%r12
+.cfi_restore	%r12
+	mov	-16(%rax),%rbp
+.cfi_restore	%rbp
+	mov	-8(%rax),%rbx
+.cfi_restore	%rbx
+	lea	(%rax),%rsp
+.cfi_def_cfa_register	%rsp
+.Lepilogue:
+	ret
+.cfi_endproc
+.size	sha512_multi_block,.-sha512_multi_block
+
+.align	64
+K512:
+	.quad	0x428a2f98d728ae22,0x7137449123ef65cd,0xb5c0fbcfec4d3b2f,0xe9b5dba58189dbbc
+	.quad	0x3956c25bf348b538,0x59f111f1b605d019,0x923f82a4af194f9b,0xab1c5ed5da6d8118
+	.quad	0xd807aa98a3030242,0x12835b0145706fbe,0x243185be4ee4b28c,0x550c7dc3d5ffb4e2
+	.quad	0x72be5d74f27b896f,0x80deb1fe3b1696b1,0x9bdc06a725c71235,0xc19bf174cf692694
+	.quad	0xe49b69c19ef14ad2,0xefbe4786384f25e3,0x0fc19dc68b8cd5b5,0x240ca1cc77ac9c65
+	.quad	0x2de92c6f592b0275,0x4a7484aa6ea6e483,0x5cb0a9dcbd41fbd4,0x76f988da831153b5
+	.quad	0x983e5152ee66dfab,0xa831c66d2db43210,0xb00327c898fb213f,0xbf597fc7beef0ee4
+	.quad	0xc6e00bf33da88fc2,0xd5a79147930aa725,0x06ca6351e003826f,0x142929670a0e6e70
+	.quad	0x27b70a8546d22ffc,0x2e1b21385c26c926,0x4d2c6dfc5ac42aed,0x53380d139d95b3df
+	.quad	0x650a73548baf63de,0x766a0abb3c77b2a8,0x81c2c92e47edaee6,0x92722c851482353b
+	.quad	0xa2bfe8a14cf10364,0xa81a664bbc423001,0xc24b8b70d0f89791,0xc76c51a30654be30
+	.quad	0xd192e819d6ef5218,0xd69906245565a910,0xf40e35855771202a,0x106aa07032bbd1b8
+	.quad	0x19a4c116b8d2d0c8,0x1e376c085141ab53,0x2748774cdf8eeb99,0x34b0bcb5e19b48a8
+	.quad	0x391c0cb3c5c95a63,0x4ed8aa4ae3418acb,0x5b9cca4f7763e373,0x682e6ff3d6b2b8a3
+	.quad	0x748f82ee5defb2fc,0x78a5636f43172f60,0x84c87814a1f0ab72,0x8cc702081a6439ec
+	.quad	0x90befffa23631e28,0xa4506cebde82bde9,0xbef9a3f7b2c67915,0xc67178f2e372532b
+	.quad	0xca273eceea26619c,0xd186b8c721c0c207,0xeada7dd6cde0eb1e,0xf57d4f7fee6ed178
+	.quad	0x06f067aa72176fba,0x0a637dc5a2c898a6,0x113f9804bef90dae,0x1b710b35131c471b
+	.quad	0x28db77f523047d84,0x32caab7b40c72493,0x3c9ebe0a15c9bebc,0x431d67c49c100d4c
+	.quad	0x4cc5d4becb3e42b6,0x597f299cfc657e2a,0x5fcb6fab3ad6faec,0x6c44198c4a475817
+.Lpbswap:
+	.quad	0x0001020304050607,0x08090a0b0c0d0e0f	# pbswap
+	.quad	0x0001020304050607,0x08090a0b0c0d0e0f
+	.quad	0x0001020304050607,0x08090a0b0c0d0e0f
+	.quad	0x0001020304050607,0x08090a0b0c0d0e0f
+	.asciz	"SHA512 multi-block transform for x86_64"
+___
+
+if ($win64) {
+# EXCEPTION_DISPOSITION handler (EXCEPTION_RECORD *rec,ULONG64 frame,
+#		CONTEXT *context,DISPATCHER_CONTEXT *disp)
+$rec="%rcx";
+$frame="%rdx";
+$context="%r8";
+$disp="%r9";
+
+$code.=<<___;
+.extern	__imp_RtlVirtualUnwind
+.type	se_handler,\@abi-omnipotent
+.align	16
+se_handler:
+	push	%rsi
+	push	%rdi
+	push	%rbx
+	push	%rbp
+	push	%r12
+	push	%r13
+	push	%r14
+	push	%r15
+	pushfq
+	sub	\$64,%rsp
+
+	mov	120($context),%rax	# pull context->Rax
+	mov	248($context),%rbx	# pull context->Rip
+
+	mov	8($disp),%rsi		# disp->ImageBase
+	mov	56($disp),%r11		# disp->HandlerData
+
+	mov	0(%r11),%r10d		# HandlerData[0]
+	lea	(%rsi,%r10),%r10	# end of prologue label
+	cmp	%r10,%rbx		# context->Rip<.Lbody
+	jb	.Lin_prologue
+
+	mov	152($context),%rax	# pull context->Rsp
+
+	mov	4(%r11),%r10d		# HandlerData[1]
+	lea	(%rsi,%r10),%r10	# epilogue label
+	cmp	%r10,%rbx		# context->Rip>=.Lepilogue
+	jae	.Lin_prologue
+
+	mov	`32*17`(%rax),%rax	# pull saved stack pointer
+
+	mov	-8(%rax),%rbx
+	mov	-16(%rax),%rbp
+	mov	-24(%rax),%r12
+	mov	-32(%rax),%r13
+	mov	-40(%rax),%r14
+	mov	-48(%rax),%r15
+	mov	%rbx,144($context)	# restore context->Rbx
+	mov	%rbp,160($context)	# restore context->Rbp
+	mov	%r12,216($context)	# restore context->R12
+	mov	%r13,224($context)	# restore context->R13
+	mov	%r14,232($context)	# restore context->R14
+	mov	%r15,240($context)	# restore context->R15
+
+	lea	-56-10*16(%rax),%rsi
+	lea	512($context),%rdi	# &context.Xmm6
+	mov	\$20,%ecx
+	.long	0xa548f3fc		# cld; rep movsq
+
+.Lin_prologue:
+	mov	8(%rax),%rdi
+	mov	16(%rax),%rsi
+	mov	%rax,152($context)	# restore context->Rsp
+	mov	%rsi,168($context)	# restore context->Rsi
+	mov	%rdi,176($context)	# restore context->Rdi
+
+	mov	40($disp),%rdi		# disp->ContextRecord
+	mov	$context,%rsi		# context
+	mov	\$154,%ecx		# sizeof(CONTEXT)
+	.long	0xa548f3fc		# cld; rep movsq
+
+	mov	$disp,%rsi
+	xor	%rcx,%rcx		# arg1, UNW_FLAG_NHANDLER
+	mov	8(%rsi),%rdx		# arg2, disp->ImageBase
+	mov	0(%rsi),%r8		# arg3, disp->ControlPc
+	mov	16(%rsi),%r9		# arg4, disp->FunctionEntry
+	mov	40(%rsi),%r10		# disp->ContextRecord
+	lea	56(%rsi),%r11		# &disp->HandlerData
+	lea	24(%rsi),%r12		# &disp->EstablisherFrame
+	mov	%r10,32(%rsp)		# arg5
+	mov	%r11,40(%rsp)		# arg6
+	mov	%r12,48(%rsp)		# arg7
+	mov	%rcx,56(%rsp)		# arg8, (NULL)
+	call	*__imp_RtlVirtualUnwind(%rip)
+
+	mov	\$1,%eax		# ExceptionContinueSearch
+	add	\$64,%rsp
+	popfq
+	pop	%r15
+	pop	%r14
+	pop	%r13
+	pop	%r12
+	pop	%rbp
+	pop	%rbx
+	pop	%rdi
+	pop	%rsi
+	ret
+.size	se_handler,.-se_handler
+
+.section	.pdata
+.align	4
+	.rva	.LSEH_begin_sha512_multi_block
+	.rva	.LSEH_end_sha512_multi_block
+	.rva	.LSEH_info_sha512_multi_block
+
+.section	.xdata
+.align	8
+.LSEH_info_sha512_multi_block:
+	.byte	9,0,0,0
+	.rva	se_handler
+	.rva	.Lbody,.Lepilogue			# HandlerData[]
+___
+}
+
+}}} else {
+# The assembler cannot encode AVX2, the subroutine is never called.
+$code.=<<___;
+.text
+
+.globl	sha512_multi_block_capable
+.type	sha512_multi_block_capable,\@abi-omnipotent
+sha512_multi_block_capable:
+	xor	%eax,%eax
+	ret
+.size	sha512_multi_block_capable,.-sha512_multi_block_capable
+
+.globl	sha512_multi_block
+.type	sha512_multi_block,\@abi-omnipotent
+sha512_multi_block:
+	.byte	0x0f,0x0b	# ud2
+	ret
+.size	sha512_multi_block,.-sha512_multi_block
+___
+}
+
+$code =~ s/\`([^\`]*)\`/eval $1/gem;
+print $code;
+close STDOUT or die "error closing STDOUT: $!";
@@ -0,0 +1,444 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * SHA low level APIs are deprecated for public use, but still ok for
+ * internal use.
+ */
+#include "internal/deprecated.h"
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/sha.h>
+#include "internal/sha3.h"
+#include "crypto/sha.h"
+
+/*
+ * Hashing of many independent messages.  On x86_64 up to eight messages
+ * are interleaved into the lanes of the multi-buffer kernels, and a lane is
+ * refilled with the next message as soon as its current one is done, so
+ * that messages of different lengths keep all lanes busy.  Elsewhere, or
+ * when there are too few messages to be worth interleaving, each message is
+ * hashed on its own.
+ */
+
+#if defined(SHA256_ASM) && (defined(__x86_64) || defined(_M_AMD64))
+# define SHA2_MB_ASM
+#endif
+#if defined(KECCAK1600_ASM) && (defined(__x86_64) || defined(_M_AMD64))
+# define KECCAK_MB_ASM
+#endif
+
+#if defined(SHA2_MB_ASM) || defined(KECCAK_MB_ASM)
+
+# define MB_LANES       8
+/* Fewer messages than this are hashed one by one */
+# define MB_MIN_NUM     4
+
+extern unsigned int OPENSSL_ia32cap_P[];
+
+#endif
+
+#ifdef SHA2_MB_ASM
+
+/* Keeps the per-lane block counts passed to the kernels within an int */
+# define MB_MAX_STEP    (1 << 20)
+
+typedef struct {
+    const unsigned char *ptr;
+    int blocks;
+} HASH_DESC;
+
+/* Lane i's chaining value is h[0][i], ..., h[7][i] */
+typedef struct {
+    SHA_LONG h[8][MB_LANES];
+} SHA256_MB_CTX;
+
+typedef struct {
+    SHA_LONG64 h[8][MB_LANES];
+} SHA512_MB_CTX;
+
+void sha256_multi_block(SHA256_MB_CTX *ctx, const HASH_DESC *inp, int num);
+void sha512_multi_block(SHA512_MB_CTX *ctx, const HASH_DESC *inp, int num);
+int sha512_multi_block_capable(void);
+
+typedef struct {
+    size_t block;               /* block size in bytes */
+    size_t lenbytes;            /* size of the trailing length field */
+    void (*compress)(void *mb, const HASH_DESC *desc);
+    void (*seed)(void *mb, int lane, const void *init);
+    void (*emit)(unsigned char *md, const void *mb, int lane, size_t mdlen);
+} SHA2_MB_METHOD;
+
+typedef struct {
+    int busy;
+    int last;                   /* processing the padded tail */
+    size_t msg;
+    const unsigned char *in;
+    size_t blocks;              /* blocks left in the current segment */
+    size_t tail_blocks;
+    unsigned char tail[2 * SHA512_CBLOCK];
+} SHA2_MB_LANE;
+
+static void sha256_mb_compress(void *mb, const HASH_DESC *desc)
+{
+    sha256_multi_block(mb, desc, MB_LANES / 4);
+}
+
+static void sha256_mb_seed(void *vmb, int lane, const void *vinit)
+{
+    SHA256_MB_CTX *mb = vmb;
+    const SHA256_CTX *init = vinit;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        mb->h[i][lane] = init->h[i];
+}
+
+static void sha256_mb_emit(unsigned char *md, const void *vmb, int lane,
+                           size_t mdlen)
+{
+    const SHA256_MB_CTX *mb = vmb;
+    unsigned char out[SHA256_DIGEST_LENGTH], *p = out;
+    int i;
+
+    for (i = 0; i < 8; i++, p += 4) {
+        SHA_LONG h = mb->h[i][lane];
+
+        p[0] = (unsigned char)(h >> 24);
+        p[1] = (unsigned char)(h >> 16);
+        p[2] = (unsigned char)(h >> 8);
+        p[3] = (unsigned char)h;
+    }
+    memcpy(md, out, mdlen);
+}
+
+static void sha512_mb_compress(void *mb, const HASH_DESC *desc)
+{
+    sha512_multi_block(mb, desc, MB_LANES / 4);
+}
+
+static void sha512_mb_seed(void *vmb, int lane, const void *vinit)
+{
+    SHA512_MB_CTX *mb = vmb;
+    const SHA512_CTX *init = vinit;
+    int i;
+
+    for (i = 0; i < 8; i++)
+        mb->h[i][lane] = init->h[i];
+}
+
+static void sha512_mb_emit(unsigned char *md, const void *vmb, int lane,
+                           size_t mdlen)
+{
+    const SHA512_MB_CTX *mb = vmb;
+    unsigned char out[SHA512_DIGEST_LENGTH], *p = out;
+    int i, j;
+
+    for (i = 0; i < 8; i++, p += 8) {
+        SHA_LONG64 h = mb->h[i][lane];
+
+        for (j = 7; j >= 0; j--, h >>= 8)
+            p[j] = (unsigned char)h;
+    }
+    memcpy(md, out, mdlen);
+}
+
+static const SHA2_MB_METHOD sha256_mb_meth = {
+    SHA256_CBLOCK, 8, sha256_mb_compress, sha256_mb_seed, sha256_mb_emit
+};
+
+static const SHA2_MB_METHOD sha512_mb_meth = {
+    SHA512_CBLOCK, 16, sha512_mb_compress, sha512_mb_seed, sha512_mb_emit
+};
+
+/*
+ * Starts message |msg| in |lane|: its whole blocks are hashed straight from
+ * the caller's buffer, the padded remainder from the lane's tail buffer.
+ */
+static void sha2_mb_start(const SHA2_MB_METHOD *meth, SHA2_MB_LANE *lane,
+                          size_t msg, const unsigned char *in, size_t inl)
+{
+    size_t bs = meth->block, rem = inl % bs, end;
+    uint64_t bits = (uint64_t)inl << 3;
+    int i;
+
+    lane->busy = 1;
+    lane->msg = msg;
+    lane->in = in;
+    lane->blocks = inl / bs;
+    lane->tail_blocks = rem + 1 + meth->lenbytes > bs ? 2 : 1;
+    end = lane->tail_blocks * bs;
+
+    memset(lane->tail, 0, end);
+    if (rem != 0)
+        memcpy(lane->tail, in + inl - rem, rem);
+    lane->tail[rem] = 0x80;
+    for (i = 1; i <= 8; i++, bits >>= 8)
+        lane->tail[end - i] = (unsigned char)bits;
+    if (meth->lenbytes > 8)
+        lane->tail[end - 9] = (unsigned char)((uint64_t)inl >> 61);
+
+    lane->last = lane->blocks == 0;
+    if (lane->last) {
+        lane->in = lane->tail;
+        lane->blocks = lane->tail_blocks;
+    }
+}
+
+static void sha2_mb(const SHA2_MB_METHOD *meth, void *mb, const void *init,
+                    size_t mdlen, size_t num, const unsigned char *const in[],
+                    const size_t inl[], unsigned char *const out[])
+{
+    SHA2_MB_LANE lane[MB_LANES];
+    HASH_DESC desc[MB_LANES];
+    const unsigned char *idle = NULL;
+    size_t next = 0, step;
+    int i, busy;
+
+    for (i = 0; i < MB_LANES; i++)
+        lane[i].busy = 0;
+
+    for (;;) {
+        step = MB_MAX_STEP;
+        busy = 0;
+        for (i = 0; i < MB_LANES; i++) {
+            if (!lane[i].busy && next < num) {
+                sha2_mb_start(meth, &lane[i], next, in[next], inl[next]);
+                meth->seed(mb, i, init);
+                next++;
+            }
+            if (lane[i].busy) {
+                busy++;
+                if (lane[i].blocks < step)
+                    step = lane[i].blocks;
+            }
+        }
+        if (busy == 0)
+            break;
+
+        /*
+         * Every busy lane advances by the same number of blocks, so that
+         * the lane that finishes first can be refilled straight away.  Idle
+         * lanes hash a copy of a busy lane's input rather than being given
+         * no blocks, as the kernels stop at the first group of lanes that
+         * has nothing to do.
+         */
+        for (i = 0; i < MB_LANES; i++)
+            if (lane[i].busy)
+                idle = lane[i].in;
+        for (i = 0; i < MB_LANES; i++) {
+            desc[i].ptr = lane[i].busy ? lane[i].in : idle;
+            desc[i].blocks = (int)step;
+        }
+        meth->compress(mb, desc);
+
+        for (i = 0; i < MB_LANES; i++) {
+            if (!lane[i].busy)
+                continue;
+            lane[i].in += step * meth->block;
+            lane[i].blocks -= step;
+            if (lane[i].blocks != 0)
+                continue;
+            if (lane[i].last) {
+                meth->emit(out[lane[i].msg], mb, i, mdlen);
+                lane[i].busy = 0;
+            } else {
+                lane[i].last = 1;
+                lane[i].in = lane[i].tail;
+                lane[i].blocks = lane[i].tail_blocks;
+            }
+        }
+    }
+    OPENSSL_cleanse(lane, sizeof(lane));
+}
+
+#endif                          /* SHA2_MB_ASM */
+
+/*
+ * The |init| contexts below must be freshly initialised: the messages are
+ * hashed as if each was the only input passed to a copy of |init|.
+ */
+void ossl_sha256_many(const SHA256_CTX *init, size_t num,
+                      const unsigned char *const in[], const size_t inl[],
+                      unsigned char *const out[])
+{
+    SHA256_CTX c;
+    size_t i;
+
+#ifdef SHA2_MB_ASM
+    /* The baseline code path of sha256_multi_block needs SSSE3 */
+    if (num >= MB_MIN_NUM && (OPENSSL_ia32cap_P[1] & (1 << (41 - 32)))) {
+        SHA256_MB_CTX mb;
+
+        sha2_mb(&sha256_mb_meth, &mb, init, init->md_len, num, in, inl, out);
+        OPENSSL_cleanse(&mb, sizeof(mb));
+        return;
+    }
+#endif
+
+    for (i = 0; i < num; i++) {
+        c = *init;
+        SHA256_Update(&c, in[i], inl[i]);
+        SHA256_Final(out[i], &c);
+    }
+    OPENSSL_cleanse(&c, sizeof(c));
+}
+
+void ossl_sha512_many(const SHA512_CTX *init, size_t num,
+                      const unsigned char *const in[], const size_t inl[],
+                      unsigned char *const out[])
+{
+    SHA512_CTX c;
+    size_t i;
+
+#ifdef SHA2_MB_ASM
+    if (num >= MB_MIN_NUM && sha512_multi_block_capable()) {
+        SHA512_MB_CTX mb;
+
+        sha2_mb(&sha512_mb_meth, &mb, init, init->md_len, num, in, inl, out);
+        OPENSSL_cleanse(&mb, sizeof(mb));
+        return;
+    }
+#endif
+
+    for (i = 0; i < num; i++) {
+        c = *init;
+        SHA512_Update(&c, in[i], inl[i]);
+        SHA512_Final(out[i], &c);
+    }
+    OPENSSL_cleanse(&c, sizeof(c));
+}
+
+#ifdef KECCAK_MB_ASM
+
+/* Lane i's state word A[y][x] is A[5 * y + x][i] */
+void KeccakF1600_x8(uint64_t A[25][MB_LANES]);
+int KeccakF1600_x8_capable(void);
+
+typedef struct {
+    int busy;
+    int last;                   /* the padded block has been absorbed */
+    size_t msg;
+    const unsigned char *in;
+    size_t len;
+    size_t done;                /* output bytes squeezed so far */
+} KECCAK_MB_LANE;
+
+static void keccak_mb_absorb(uint64_t A[25][MB_LANES], int lane,
+                             const unsigned char *in, size_t r)
+{
+    size_t i;
+    int j;
+
+    for (i = 0; i < r / 8; i++, in += 8) {
+        uint64_t w = 0;
+
+        for (j = 7; j >= 0; j--)
+            w = (w << 8) | in[j];
+        A[i][lane] ^= w;
+    }
+}
+
+static void keccak_mb(const KECCAK1600_CTX *init, size_t num,
+                      const unsigned char *const in[], const size_t inl[],
+                      unsigned char *const out[])
+{
+    uint64_t A[25][MB_LANES];
+    KECCAK_MB_LANE lane[MB_LANES];
+    unsigned char block[KECCAK1600_WIDTH / 8];
+    size_t r = init->block_size, next = 0, i, n;
+    unsigned char *md;
+    int l, busy;
+
+    memset(A, 0, sizeof(A));
+    for (l = 0; l < MB_LANES; l++)
+        lane[l].busy = 0;
+
+    for (;;) {
+        busy = 0;
+        for (l = 0; l < MB_LANES; l++) {
+            if (!lane[l].busy && next < num) {
+                for (i = 0; i < 25; i++)
+                    A[i][l] = 0;
+                lane[l].busy = 1;
+                lane[l].last = 0;
+                lane[l].msg = next;
+                lane[l].in = in[next];
+                lane[l].len = inl[next];
+                lane[l].done = 0;
+                next++;
+            }
+            if (!lane[l].busy)
+                continue;
+            busy++;
+
+            /* A lane that is squeezing only needs the permutation */
+            if (lane[l].last)
+                continue;
+            if (lane[l].len >= r) {
+                keccak_mb_absorb(A, l, lane[l].in, r);
+                lane[l].in += r;
+                lane[l].len -= r;
+            } else {
+                memset(block, 0, r);
+                if (lane[l].len != 0)
+                    memcpy(block, lane[l].in, lane[l].len);
+                block[lane[l].len] = init->pad;
+                block[r - 1] |= 0x80;
+                keccak_mb_absorb(A, l, block, r);
+                lane[l].last = 1;
+            }
+        }
+        if (busy == 0)
+            break;
+
+        KeccakF1600_x8(A);
+
+        for (l = 0; l < MB_LANES; l++) {
+            if (!lane[l].busy || !lane[l].last)
+                continue;
+            md = out[lane[l].msg] + lane[l].done;
+            n = init->md_size - lane[l].done;
+            if (n > r)
+                n = r;
+            for (i = 0; i < n; i++)
+                md[i] = (unsigned char)(A[i / 8][l] >> (8 * (i % 8)));
+            lane[l].done += n;
+            if (lane[l].done == init->md_size)
+                lane[l].busy = 0;
+        }
+    }
+    OPENSSL_cleanse(A, sizeof(A));
+    OPENSSL_cleanse(block, sizeof(block));
+}
+
+#endif                          /* KECCAK_MB_ASM */
+
+void ossl_sha3_many(const KECCAK1600_CTX *init, size_t num,
+                    const unsigned char *const in[], const size_t inl[],
+                    unsigned char *const out[])
+{
+    KECCAK1600_CTX c;
+    size_t i;
+
+#ifdef KECCAK_MB_ASM
+    if (num >= MB_MIN_NUM && KeccakF1600_x8_capable()) {
+        keccak_mb(init, num, in, inl, out);
+        return;
+    }
+#endif
+
+    for (i = 0; i < num; i++) {
+        c = *init;
+        ossl_sha3_update(&c, in[i], inl[i]);
+        ossl_sha3_final(out[i], &c);
+    }
+    OPENSSL_cleanse(&c, sizeof(c));
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <openssl/crypto.h>
+#include "internal/rcu.h"
+
+#if defined(__apple_build_version__) && __apple_build_version__ < 6000000
+/* See threads_pthread.c */
+# define BROKEN_CLANG_ATOMICS
+#endif
+
+#if defined(OPENSSL_THREADS) && !defined(CRYPTO_TDEBUG)
+# if defined(__GNUC__) && defined(__ATOMIC_SEQ_CST) \
+     && !defined(BROKEN_CLANG_ATOMICS) \
+     && defined(__GCC_ATOMIC_INT_LOCK_FREE) && __GCC_ATOMIC_INT_LOCK_FREE >= 2 \
+     && defined(__GCC_ATOMIC_POINTER_LOCK_FREE) \
+     && __GCC_ATOMIC_POINTER_LOCK_FREE >= 2
+#  define RCU_USE_ATOMICS
+# else
+/* Without usable atomics readers fall back to a read lock */
+#  define RCU_USE_RWLOCK
+# endif
+#endif
+
+#ifdef RCU_USE_ATOMICS
+
+/*
+ * Readers announce themselves by incrementing a counter belonging to the
+ * current epoch.  The counters are spread over a number of cache line sized
+ * slots, selected by a hash of the thread id, so that readers running on
+ * different CPUs rarely touch the same cache line.
+ *
+ * A writer flips the epoch and then waits for the counters of the previous
+ * epoch to drain.  Readers that enter after the flip count against the new
+ * epoch, so they cannot delay the writer indefinitely.  A reader rechecks
+ * the epoch after incrementing its counter and retries if it changed, which
+ * guarantees that any reader the writer does not wait for started after the
+ * flip and therefore sees the data published before it.  Writers waiting
+ * for a grace period take turns, as each one relies on the previous flip
+ * having drained.
+ */
+# define RCU_NUM_SLOTS      32
+# define RCU_CACHE_LINE     64
+
+typedef struct {
+    int count;
+    unsigned char pad[RCU_CACHE_LINE - sizeof(int)];
+} RCU_SLOT;
+
+struct rcu_lock_st {
+    /* 2 * RCU_NUM_SLOTS counters, indexed by epoch then slot */
+    RCU_SLOT *slots;
+    void *slots_mem;
+    /* Current epoch, 0 or 1 */
+    int epoch;
+    /* Serialises ossl_synchronize_rcu() */
+    CRYPTO_RWLOCK *sync_lock;
+};
+
+static unsigned int rcu_thread_slot(void)
+{
+    CRYPTO_THREAD_ID id = CRYPTO_THREAD_get_current_id();
+    const unsigned char *p = (const unsigned char *)&id;
+    uint32_t h = 0;
+    size_t i;
+
+    for (i = 0; i < sizeof(id); i++)
+        h = h * 31 + p[i];
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+    return h % RCU_NUM_SLOTS;
+}
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void)
+{
+    CRYPTO_RCU_LOCK *lock = OPENSSL_zalloc(sizeof(*lock));
+    size_t len = 2 * RCU_NUM_SLOTS * sizeof(RCU_SLOT) + RCU_CACHE_LINE - 1;
+
+    if (lock == NULL)
+        return NULL;
+    if ((lock->slots_mem = OPENSSL_zalloc(len)) == NULL
+            || (lock->sync_lock = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(lock->slots_mem);
+        OPENSSL_free(lock);
+        return NULL;
+    }
+    /* Align the slots to a cache line */
+    lock->slots = (RCU_SLOT *)(((size_t)lock->slots_mem + RCU_CACHE_LINE - 1)
+                               & ~(size_t)(RCU_CACHE_LINE - 1));
+    return lock;
+}
+
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock == NULL)
+        return;
+    CRYPTO_THREAD_lock_free(lock->sync_lock);
+    OPENSSL_free(lock->slots_mem);
+    OPENSSL_free(lock);
+}
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, unsigned int *token)
+{
+    unsigned int slot = rcu_thread_slot();
+    int epoch, *count;
+
+    for (;;) {
+        epoch = __atomic_load_n(&lock->epoch, __ATOMIC_SEQ_CST);
+        count = &lock->slots[epoch * RCU_NUM_SLOTS + slot].count;
+        __atomic_add_fetch(count, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&lock->epoch, __ATOMIC_SEQ_CST) == epoch)
+            break;
+        /* A writer flipped the epoch under us, count against the new one */
+        __atomic_sub_fetch(count, 1, __ATOMIC_SEQ_CST);
+    }
+    *token = epoch * RCU_NUM_SLOTS + slot;
+    return 1;
+}
+
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, unsigned int token)
+{
+    __atomic_sub_fetch(&lock->slots[token].count, 1, __ATOMIC_RELEASE);
+}
+
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock)
+{
+    int epoch, locked;
+    unsigned int i, spins;
+
+    /* Even if the lock can't be taken the caller must not go before readers */
+    locked = CRYPTO_THREAD_write_lock(lock->sync_lock);
+
+    epoch = __atomic_load_n(&lock->epoch, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&lock->epoch, epoch ^ 1, __ATOMIC_SEQ_CST);
+
+    for (i = 0; i < RCU_NUM_SLOTS; i++) {
+        int *count = &lock->slots[epoch * RCU_NUM_SLOTS + i].count;
+
+        for (spins = 0; __atomic_load_n(count, __ATOMIC_SEQ_CST) != 0; spins++) {
+# ifndef FIPS_MODULE
+            /* Read side critical sections are short, give the reader a go */
+            if (spins >= 1000)
+                OSSL_sleep(0);
+# endif
+        }
+    }
+
+    if (locked)
+        CRYPTO_THREAD_unlock(lock->sync_lock);
+}
+
+void *ossl_rcu_uptr_deref(void **p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+void ossl_rcu_assign_uptr(void **p, void *v)
+{
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+#else /* RCU_USE_ATOMICS */
+
+struct rcu_lock_st {
+# ifdef RCU_USE_RWLOCK
+    CRYPTO_RWLOCK *rwlock;
+# else
+    int dummy;
+# endif
+};
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void)
+{
+    CRYPTO_RCU_LOCK *lock = OPENSSL_zalloc(sizeof(*lock));
+
+# ifdef RCU_USE_RWLOCK
+    if (lock != NULL && (lock->rwlock = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(lock);
+        return NULL;
+    }
+# endif
+    return lock;
+}
+
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock)
+{
+    if (lock == NULL)
+        return;
+# ifdef RCU_USE_RWLOCK
+    CRYPTO_THREAD_lock_free(lock->rwlock);
+# endif
+    OPENSSL_free(lock);
+}
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, unsigned int *token)
+{
+    *token = 0;
+# ifdef RCU_USE_RWLOCK
+    return CRYPTO_THREAD_read_lock(lock->rwlock);
+# else
+    return 1;
+# endif
+}
+
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, unsigned int token)
+{
+# ifdef RCU_USE_RWLOCK
+    CRYPTO_THREAD_unlock(lock->rwlock);
+# endif
+}
+
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock)
+{
+# ifdef RCU_USE_RWLOCK
+    /* Taking the write lock waits for all current readers to finish */
+    if (CRYPTO_THREAD_write_lock(lock->rwlock))
+        CRYPTO_THREAD_unlock(lock->rwlock);
+# endif
+}
+
+void *ossl_rcu_uptr_deref(void **p)
+{
+    return *p;
+}
+
+void ossl_rcu_assign_uptr(void **p, void *v)
+{
+    *p = v;
+}
+
+#endif /* RCU_USE_ATOMICS */
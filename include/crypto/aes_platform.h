@@ -264,6 +264,39 @@ void gcm_ghash_avx(u64 Xi[2], const u128 Htable[16], const u8 *in, size_t len);
                                 ctx->gcm.funcs.ghash == gcm_ghash_avx)
 #  endif
 
+#  if defined(__x86_64) || defined(__x86_64__) || defined(_M_AMD64) || defined(_M_X64)
+/* VAES + VPCLMULQDQ wide-vector XTS and CTR, see aesni-vaes-x86_64.pl */
+int ossl_aes_vaes_avx512_capable(void);
+int ossl_aes_vaes_avx2_capable(void);
+#   define AESNI_VAES_AVX512_CAPABLE (ossl_aes_vaes_avx512_capable())
+#   define AESNI_VAES_AVX2_CAPABLE   (ossl_aes_vaes_avx2_capable())
+
+void ossl_aes_xts_encrypt_vaes_avx512(const unsigned char *in,
+                                      unsigned char *out, size_t length,
+                                      const AES_KEY *key1, const AES_KEY *key2,
+                                      const unsigned char iv[16]);
+void ossl_aes_xts_decrypt_vaes_avx512(const unsigned char *in,
+                                      unsigned char *out, size_t length,
+                                      const AES_KEY *key1, const AES_KEY *key2,
+                                      const unsigned char iv[16]);
+void ossl_aes_ctr32_encrypt_blocks_vaes_avx512(const unsigned char *in,
+                                               unsigned char *out,
+                                               size_t blocks, const void *key,
+                                               const unsigned char *ivec);
+void ossl_aes_xts_encrypt_vaes_avx2(const unsigned char *in,
+                                    unsigned char *out, size_t length,
+                                    const AES_KEY *key1, const AES_KEY *key2,
+                                    const unsigned char iv[16]);
+void ossl_aes_xts_decrypt_vaes_avx2(const unsigned char *in,
+                                    unsigned char *out, size_t length,
+                                    const AES_KEY *key1, const AES_KEY *key2,
+                                    const unsigned char iv[16]);
+void ossl_aes_ctr32_encrypt_blocks_vaes_avx2(const unsigned char *in,
+                                             unsigned char *out,
+                                             size_t blocks, const void *key,
+                                             const unsigned char *ivec);
+#  endif
+
 
 # elif defined(AES_ASM) && (defined(__sparc) || defined(__sparc__))
 
@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -16,4 +16,9 @@
 int async_init(void);
 void async_deinit(void);
 
+int ossl_async_wait_ctx_set_wake_fd(ASYNC_WAIT_CTX *ctx, const void *key,
+                                    void (*freed)(void *arg), void *arg);
+int ossl_async_wait_ctx_wake(ASYNC_WAIT_CTX *ctx, const void *key);
+void ossl_async_wait_ctx_clear_wake_fd(ASYNC_WAIT_CTX *ctx, const void *key);
+
 #endif
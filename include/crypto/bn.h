@@ -122,6 +122,12 @@ int ossl_bn_rsa_do_unblind(const BIGNUM *intermediate,
                            const BIGNUM *to_mod, BN_CTX *ctx,
                            unsigned char *buf, int num);
 
+int ossl_bn_mod_exp_mont_consttime_lanes(const BIGNUM *m);
+int ossl_bn_mod_exp_mont_consttime_many(BIGNUM *rr[], const BIGNUM *a[],
+                                        const BIGNUM *p[], const BIGNUM *m[],
+                                        BN_MONT_CTX *mont[], size_t num,
+                                        BN_CTX *ctx);
+
 #if defined(OPENSSL_SYS_LINUX) && !defined(FIPS_MODULE) && defined (__s390x__)
 # define S390X_MOD_EXP
 #endif
@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -63,6 +63,8 @@ typedef enum {
            ? EVP_PKEY_ED25519 \
            : EVP_PKEY_ED448)))
 
+typedef struct ed25519_precomp_st ED25519_PRECOMP;
+
 struct ecx_key_st {
     OSSL_LIB_CTX *libctx;
     char *propq;
@@ -73,6 +75,12 @@ struct ecx_key_st {
     ECX_KEY_TYPE type;
     CRYPTO_REF_COUNT references;
     CRYPTO_RWLOCK *lock;
+    /*
+     * Multiples of an Ed25519 public key for verification, only built when
+     * |precompute_verify| is set, see ossl_ecx_key_get0_ed25519_precomp()
+     */
+    int precompute_verify;
+    ED25519_PRECOMP *ed25519_precomp;
 };
 
 size_t ossl_ecx_key_length(ECX_KEY_TYPE type);
@@ -83,6 +91,7 @@ unsigned char *ossl_ecx_key_allocate_privkey(ECX_KEY *key);
 void ossl_ecx_key_free(ECX_KEY *key);
 int ossl_ecx_key_up_ref(ECX_KEY *key);
 ECX_KEY *ossl_ecx_key_dup(const ECX_KEY *key, int selection);
+const ED25519_PRECOMP *ossl_ecx_key_get0_ed25519_precomp(ECX_KEY *key);
 int ossl_ecx_compute_key(ECX_KEY *peer, ECX_KEY *priv, size_t keylen,
                          unsigned char *secret, size_t *secretlen,
                          size_t outlen);
@@ -102,13 +111,25 @@ ossl_ed25519_sign(uint8_t *out_sig, const uint8_t *tbs, size_t tbs_len,
                   const uint8_t dom2flag, const uint8_t phflag, const uint8_t csflag,
                   const uint8_t *context, size_t context_len,
                   OSSL_LIB_CTX *libctx, const char *propq);
+ED25519_PRECOMP *ossl_ed25519_precomp_new(const uint8_t public_key[32]);
+void ossl_ed25519_precomp_free(ED25519_PRECOMP *pre);
 int
 ossl_ed25519_verify(const uint8_t *tbs, size_t tbs_len,
                     const uint8_t signature[64], const uint8_t public_key[32],
+                    const ED25519_PRECOMP *precomp,
                     const uint8_t dom2flag, const uint8_t phflag, const uint8_t csflag,
                     const uint8_t *context, size_t context_len,
                     OSSL_LIB_CTX *libctx, const char *propq);
 int
+ossl_ed25519_verify_batch(size_t num, const uint8_t *const *tbs,
+                          const size_t *tbs_len,
+                          const uint8_t *const *signatures,
+                          const uint8_t public_key[32],
+                          const uint8_t dom2flag, const uint8_t phflag,
+                          const uint8_t csflag,
+                          const uint8_t *context, size_t context_len,
+                          OSSL_LIB_CTX *libctx, const char *propq);
+int
 ossl_ed448_public_from_private(OSSL_LIB_CTX *ctx, uint8_t out_public_key[57],
                                const uint8_t private_key[57], const char *propq);
 int
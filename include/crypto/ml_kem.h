@@ -0,0 +1,90 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/* Internal ML-KEM (NIST FIPS 203) functions for the providers */
+
+#ifndef OSSL_CRYPTO_ML_KEM_H
+# define OSSL_CRYPTO_ML_KEM_H
+# pragma once
+
+# include <openssl/e_os2.h>
+# include <openssl/types.h>
+
+# ifndef OPENSSL_NO_ML_KEM
+
+#  define ML_KEM_512     0
+#  define ML_KEM_768     1
+#  define ML_KEM_1024    2
+
+#  define ML_KEM_SEED_BYTES               64  /* d || z */
+#  define ML_KEM_RANDOM_BYTES             32  /* m, the encapsulation entropy */
+#  define ML_KEM_SHARED_SECRET_BYTES      32
+
+#  define ML_KEM_768_PUBLIC_KEY_BYTES     1184
+#  define ML_KEM_768_CIPHERTEXT_BYTES     1088
+
+typedef struct ml_kem_vinfo_st {
+    const char *algorithm_name;
+    int variant;
+    int bits;                   /* reported as the key's "bits" */
+    int secbits;
+    int k;                      /* module rank */
+    int eta1;
+    int du;
+    int dv;
+    size_t pubkey_bytes;
+    size_t prvkey_bytes;
+    size_t ctext_bytes;
+} ML_KEM_VINFO;
+
+typedef struct ml_kem_key_st ML_KEM_KEY;
+
+const ML_KEM_VINFO *ossl_ml_kem_get_vinfo(int variant);
+
+ML_KEM_KEY *ossl_ml_kem_key_new(OSSL_LIB_CTX *libctx, int variant);
+void ossl_ml_kem_key_free(ML_KEM_KEY *key);
+ML_KEM_KEY *ossl_ml_kem_key_dup(const ML_KEM_KEY *key, int selection);
+const ML_KEM_VINFO *ossl_ml_kem_key_vinfo(const ML_KEM_KEY *key);
+
+int ossl_ml_kem_have_pubkey(const ML_KEM_KEY *key);
+int ossl_ml_kem_have_prvkey(const ML_KEM_KEY *key);
+int ossl_ml_kem_have_seed(const ML_KEM_KEY *key);
+int ossl_ml_kem_pubkey_cmp(const ML_KEM_KEY *key1, const ML_KEM_KEY *key2);
+
+/*
+ * Key generation is deterministic when a seed was set beforehand, and uses
+ * fresh private randomness from the key's library context otherwise.
+ */
+int ossl_ml_kem_set_seed(const uint8_t *seed, size_t seedlen,
+                         ML_KEM_KEY *key);
+int ossl_ml_kem_genkey(ML_KEM_KEY *key);
+
+int ossl_ml_kem_parse_public_key(const uint8_t *in, size_t len,
+                                 ML_KEM_KEY *key);
+int ossl_ml_kem_parse_private_key(const uint8_t *in, size_t len,
+                                  ML_KEM_KEY *key);
+int ossl_ml_kem_encode_public_key(uint8_t *out, size_t len,
+                                  const ML_KEM_KEY *key);
+int ossl_ml_kem_encode_private_key(uint8_t *out, size_t len,
+                                   const ML_KEM_KEY *key);
+int ossl_ml_kem_encode_seed(uint8_t *out, size_t len, const ML_KEM_KEY *key);
+
+int ossl_ml_kem_encap_seed(uint8_t *ctext, size_t clen,
+                           uint8_t *shared_secret, size_t slen,
+                           const uint8_t *entropy, size_t elen,
+                           const ML_KEM_KEY *key);
+int ossl_ml_kem_encap_rand(uint8_t *ctext, size_t clen,
+                           uint8_t *shared_secret, size_t slen,
+                           const ML_KEM_KEY *key);
+int ossl_ml_kem_decap(uint8_t *shared_secret, size_t slen,
+                      const uint8_t *ctext, size_t clen,
+                      const ML_KEM_KEY *key);
+
+# endif /* OPENSSL_NO_ML_KEM */
+#endif /* OSSL_CRYPTO_ML_KEM_H */
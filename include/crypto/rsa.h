@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -129,4 +129,14 @@ void ossl_rsa_acvp_test_free(RSA_ACVP_TEST *t);
 # endif
 
 RSA *evp_pkey_get1_RSA_PSS(EVP_PKEY *pkey);
+
+# ifndef FIPS_MODULE
+int ossl_rsa_batch_active(void);
+int ossl_rsa_batch_mod_exp_x2(BIGNUM *rr1, const BIGNUM *a1, const BIGNUM *p1,
+                              const BIGNUM *m1, BN_MONT_CTX *mont1,
+                              BIGNUM *rr2, const BIGNUM *a2, const BIGNUM *p2,
+                              const BIGNUM *m2, BN_MONT_CTX *mont2,
+                              BN_CTX *ctx);
+void ossl_rsa_batch_cleanup(void);
+# endif
 #endif
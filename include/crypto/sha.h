@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2018-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2018, Oracle and/or its affiliates.  All rights reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -18,5 +18,11 @@ int sha512_224_init(SHA512_CTX *);
 int sha512_256_init(SHA512_CTX *);
 int ossl_sha1_ctrl(SHA_CTX *ctx, int cmd, int mslen, void *ms);
 unsigned char *ossl_sha1(const unsigned char *d, size_t n, unsigned char *md);
+void ossl_sha256_many(const SHA256_CTX *init, size_t num,
+                      const unsigned char *const in[], const size_t inl[],
+                      unsigned char *const out[]);
+void ossl_sha512_many(const SHA512_CTX *init, size_t num,
+                      const unsigned char *const in[], const size_t inl[],
+                      unsigned char *const out[]);
 
 #endif
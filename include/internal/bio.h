@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -44,6 +44,9 @@ int bread_conv(BIO *bio, char *data, size_t datal, size_t *read);
 # define BIO_CTRL_SET_KTLS_TX_SEND_CTRL_MSG     74
 # define BIO_CTRL_CLEAR_KTLS_TX_CTRL_MSG        75
 # define BIO_CTRL_SET_KTLS_TX_ZEROCOPY_SENDFILE 90
+# define BIO_CTRL_DGRAM_GET_SEG_CAP             92
+# define BIO_CTRL_DGRAM_GET_RX_SEG_ENABLE       93
+# define BIO_CTRL_DGRAM_SET_RX_SEG_ENABLE       94
 
 /*
  * This is used with socket BIOs:
@@ -81,6 +84,44 @@ int bread_conv(BIO *bio, char *data, size_t datal, size_t *read);
 # define BIO_set_ktls_tx_zerocopy_sendfile(b) \
      BIO_ctrl(b, BIO_CTRL_SET_KTLS_TX_ZEROCOPY_SENDFILE, 0, NULL)
 
+/*
+ * UDP segmentation offload for datagram BIOs.
+ *
+ * BIO_dgram_get_seg_cap() returns a mask of BIO_DGRAM_SEG_CAP_TX, meaning a
+ * BIO_MSG_SEG with a seg_len may be sent, and BIO_DGRAM_SEG_CAP_RX, meaning
+ * receive coalescing may be enabled with BIO_dgram_set_rx_seg_enable().
+ *
+ * Segment sizes are passed in a BIO_MSG_SEG, which extends a BIO_MSG, so the
+ * public BIO_MSG layout is unaffected. To use it, pass an array of BIO_MSG_SEG
+ * with a stride of sizeof(BIO_MSG_SEG) and the BIO_MMSG_FLAG_SEG flag to
+ * BIO_sendmmsg() or BIO_recvmmsg():
+ *
+ *   - on send, a message whose seg_len is nonzero and less than its data_len is
+ *     sent as datagrams of seg_len bytes, the last of which may be shorter;
+ *
+ *   - on receive, seg_len is written with the size of the datagrams coalesced
+ *     into the message, or 0 if the message holds a single datagram.
+ *
+ * A BIO on which receive coalescing is enabled must only be read in this way,
+ * with buffers large enough for a coalesced message.
+ */
+# define BIO_DGRAM_SEG_CAP_TX       (1U << 0)
+# define BIO_DGRAM_SEG_CAP_RX       (1U << 1)
+
+# define BIO_MMSG_FLAG_SEG          (((uint64_t)1) << 63)
+
+typedef struct bio_msg_seg_st {
+    BIO_MSG msg;
+    size_t  seg_len;
+} BIO_MSG_SEG;
+
+# define BIO_dgram_get_seg_cap(b) \
+     (uint32_t)BIO_ctrl((b), BIO_CTRL_DGRAM_GET_SEG_CAP, 0, NULL)
+# define BIO_dgram_get_rx_seg_enable(b, penable) \
+     (int)BIO_ctrl((b), BIO_CTRL_DGRAM_GET_RX_SEG_ENABLE, 0, (char *)(penable))
+# define BIO_dgram_set_rx_seg_enable(b, enable) \
+     (int)BIO_ctrl((b), BIO_CTRL_DGRAM_SET_RX_SEG_ENABLE, (enable), NULL)
+
 /* Functions to allow the core to offer the CORE_BIO type to providers */
 OSSL_CORE_BIO *ossl_core_bio_new_from_bio(BIO *bio);
 OSSL_CORE_BIO *ossl_core_bio_new_file(const char *filename, const char *mode);
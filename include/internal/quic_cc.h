@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -16,6 +16,14 @@
 
 typedef struct ossl_cc_data_st *OSSL_CC_DATA;
 
+/*
+ * Changeable parameters understood by the congestion controllers. Each is
+ * passed by address in the |changeables| argument of new() and is read again
+ * whenever the controller needs it.
+ */
+/* size_t: maximum datagram payload length in bytes. */
+#  define OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN    "max_dgram_payload_len"
+
 typedef struct ossl_cc_method_st {
     void *dummy;
 
@@ -114,8 +122,8 @@ typedef struct ossl_cc_method_st {
     /*
      * To be called when sent data was acked.
      * |time_now| is current time in microseconds.
-     * |largest_pn_acked| is the largest packet number of the acked
-     * packets.
+     * |last_sent_time| is the time at which the most recently sent of the
+     * acked packets was sent, in any packet number space.
      * |num_retransmittable_bytes| is the number of retransmittable
      * packet bytes that were newly acked.
      * Returns 1 if sending is unblocked (can_send returns 1), 0
@@ -123,23 +131,22 @@ typedef struct ossl_cc_method_st {
      */
     int (*on_data_acked)(OSSL_CC_DATA *ccdata,
                          OSSL_TIME time_now,
-                         uint64_t last_pn_acked,
+                         OSSL_TIME last_sent_time,
                          uint64_t num_retransmittable_bytes);
 
     /*
      * To be called when sent data is considered lost.
-     * |largest_pn_lost| is the largest packet number of the lost
-     * packets.
-     * |largest_pn_sent| is the largest packet number sent on this
-     * connection.
+     * |time_now| is current time in microseconds.
+     * |last_sent_time| is the time at which the most recently sent of the
+     * lost packets was sent, in any packet number space.
      * |num_retransmittable_bytes| is the number of retransmittable
      * packet bytes that are newly considered lost.
      * |persistent_congestion| is 1 if the congestion is considered
      * persistent (see RFC 9002 Section 7.6), 0 otherwise.
      */
     void (*on_data_lost)(OSSL_CC_DATA *ccdata,
-                         uint64_t largest_pn_lost,
-                         uint64_t largest_pn_sent,
+                         OSSL_TIME time_now,
+                         OSSL_TIME last_sent_time,
                          uint64_t num_retransmittable_bytes,
                          int persistent_congestion);
 
@@ -154,6 +161,8 @@ typedef struct ossl_cc_method_st {
 } OSSL_CC_METHOD;
 
 extern const OSSL_CC_METHOD ossl_cc_dummy_method;
+extern const OSSL_CC_METHOD ossl_cc_newreno_method;
+extern const OSSL_CC_METHOD ossl_cc_cubic_method;
 
 # endif
 
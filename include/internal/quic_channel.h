@@ -15,6 +15,9 @@
 # include "internal/quic_stream_map.h"
 # include "internal/quic_reactor.h"
 # include "internal/quic_statm.h"
+# include "internal/quic_cc.h"
+# include "internal/quic_demux.h"
+# include "internal/quic_record_rx.h"
 # include "internal/time.h"
 # include "internal/thread.h"
 
@@ -92,6 +95,12 @@
 #  define QUIC_CHANNEL_STATE_TERMINATING_DRAINING        3
 #  define QUIC_CHANNEL_STATE_TERMINATED                  4
 
+/*
+ * Length of the connection IDs issued by a server channel. A DEMUX shared by
+ * server channels must use this as its short connection ID length.
+ */
+#  define QUIC_CHANNEL_SERVER_CID_LEN     8
+
 typedef struct quic_channel_args_st {
     OSSL_LIB_CTX    *libctx;
     const char      *propq;
@@ -117,6 +126,22 @@ typedef struct quic_channel_args_st {
      */
     OSSL_TIME       (*now_cb)(void *arg);
     void            *now_cb_arg;
+
+    /*
+     * Optional congestion controller to use for this connection. If NULL,
+     * ossl_cc_newreno_method is used.
+     */
+    const OSSL_CC_METHOD *cc_method;
+
+    /*
+     * Optional DEMUX shared with other channels; servers only. If NULL, the
+     * channel creates and owns its own DEMUX. Otherwise, the channel registers
+     * its connection IDs with the given DEMUX but neither reads from the
+     * network with it nor frees it; the owner of the DEMUX (e.g. a QUIC
+     * listener) must pump it and handle packets for unknown DCIDs, and must
+     * ensure it outlives the channel.
+     */
+    QUIC_DEMUX      *demux;
 } QUIC_CHANNEL_ARGS;
 
 typedef struct quic_channel_st QUIC_CHANNEL;
@@ -185,6 +210,35 @@ int ossl_quic_channel_start(QUIC_CHANNEL *ch);
 /* Start a locally initiated connection shutdown. */
 void ossl_quic_channel_local_close(QUIC_CHANNEL *ch, uint64_t app_error_code);
 
+/*
+ * To be used by a QUIC listener. Accepts a new incoming connection on an idle
+ * server channel created with a shared DEMUX. peer_scid and peer_dcid are the
+ * SCID and DCID of the client's Initial packet. If the connection is being
+ * established after a Retry, odcid is the DCID of the client's first Initial
+ * packet, as recovered from the Retry token; otherwise it must be NULL.
+ *
+ * After a successful call, the datagram containing the Initial packet should
+ * be passed to ossl_quic_channel_inject_urxe().
+ */
+int ossl_quic_channel_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
+                                  const QUIC_CONN_ID *peer_scid,
+                                  const QUIC_CONN_ID *peer_dcid,
+                                  const QUIC_CONN_ID *odcid);
+
+/*
+ * Passes a datagram issued by a shared DEMUX directly to the channel's QRX,
+ * bypassing DCID-based routing. Takes ownership of the URXE.
+ */
+void ossl_quic_channel_inject_urxe(QUIC_CHANNEL *ch, QUIC_URXE *e);
+
+/*
+ * Sets a callback called whenever the DEMUX routes a datagram to the channel.
+ * See ossl_qrx_set_rx_notify_cb().
+ */
+int ossl_quic_channel_set_rx_notify_cb(QUIC_CHANNEL *ch,
+                                       ossl_qrx_rx_notify_cb *cb,
+                                       void *cb_arg);
+
 /*
  * Called when the handshake is confirmed.
  */
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -81,6 +81,11 @@
  * list to a pending list and vice versa). The buffer into which datagrams are
  * received immediately follows this URXE header structure and is part of the
  * same allocation.
+ *
+ * The one exception is when the network BIO coalesces several datagrams into a
+ * single buffer (UDP GRO). Each of those datagrams is then given a URXE without
+ * a buffer of its own, which refers to the relevant part of the URXE which
+ * received them, so that splitting them up does not involve copying.
  */
 
 typedef struct quic_urxe_st QUIC_URXE;
@@ -92,8 +97,8 @@ struct quic_urxe_st {
     OSSL_LIST_MEMBER(urxe, QUIC_URXE);
 
     /*
-     * The URXE data starts after this structure so we don't need a pointer.
-     * data_len stores the current length (i.e., the length of the received
+     * The URXE data starts after this structure (or after that of parent, see
+     * below) so we don't need a pointer. data_len stores the current length (i.e., the length of the received
      * datagram) and alloc_len stores the allocation length. The URXE will be
      * reallocated if we need a larger allocation than is available, though this
      * should not be common as we will have a good idea of worst-case MTUs up
@@ -127,17 +132,38 @@ struct quic_urxe_st {
      */
     char            deferred;
 
+    /*
+     * Used by the QRX to count references to the URXE. The QRX holds one
+     * reference while the URXE is on its pending or deferred lists, and each
+     * decrypted packet whose payload still lives in the URXE buffer holds
+     * another. Used by the QRX only; not used by the demuxer.
+     */
+    size_t          qrx_refs;
+
     /*
      * Used by the DEMUX to track if a URXE has been handed out. Used primarily
      * for debugging purposes.
      */
     char            demux_state;
+
+    /*
+     * If parent is set, the URXE holds one of several datagrams which were
+     * received coalesced into the buffer of parent, starting data_off bytes
+     * into it, and has no buffer of its own. child_refs counts the URXEs
+     * referring to the buffer of a URXE; it is not reused until all of them
+     * have been released. Used by the demuxer only.
+     */
+    QUIC_URXE       *parent;
+    size_t          data_off, child_refs;
 };
 
 /* Accessors for URXE buffer. */
 static ossl_unused ossl_inline unsigned char *
 ossl_quic_urxe_data(const QUIC_URXE *e)
 {
+    if (e->parent != NULL)
+        return (unsigned char *)&e->parent[1] + e->data_off;
+
     return (unsigned char *)&e[1];
 }
 
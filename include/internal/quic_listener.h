@@ -0,0 +1,152 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_QUIC_LISTENER_H
+# define OSSL_QUIC_LISTENER_H
+
+# include <openssl/ssl.h>
+# include "internal/quic_channel.h"
+# include "internal/quic_demux.h"
+# include "internal/quic_reactor.h"
+# include "internal/time.h"
+
+# ifndef OPENSSL_NO_QUIC
+
+/*
+ * QUIC Listener
+ * =============
+ *
+ * A QUIC listener accepts any number of incoming QUIC connections on a single
+ * network BIO (for example, one UDP socket). It owns a single DEMUX which is
+ * shared by the server channels it creates. Datagrams are routed to the right
+ * channel by the DEMUX's connection ID hash table; datagrams for unknown
+ * connection IDs are passed to the listener, which handles them as follows:
+ *
+ *   - Long header packets of an unsupported version in a datagram large
+ *     enough to be a client's first flight are answered with a Version
+ *     Negotiation packet;
+ *
+ *   - Initial packets for QUICv1 either cause a new channel to be created or,
+ *     if address validation is required and the packet does not carry a valid
+ *     Retry token, are answered with a Retry packet;
+ *
+ *   - anything else is discarded.
+ *
+ * Version Negotiation and Retry packets are generated without allocating any
+ * per-connection state. Retry tokens carry the DCID of the client's first
+ * Initial packet and are bound to the client's address by a MAC using a key
+ * generated when the listener is created, so a token is only accepted by the
+ * listener which issued it.
+ *
+ * The listener only ticks channels which have received a datagram or whose
+ * tick deadline has passed, so the cost of a tick does not grow with the
+ * number of idle connections.
+ *
+ * None of these functions are thread safe; the caller must hold the listener's
+ * mutex, which is also the mutex of every channel created by the listener.
+ *
+ * The listener is deliberately internal for now. The public QUIC API is
+ * client-only, and the SSL object model for the server side (a listener SSL
+ * object, how accepted connections and their streams are represented, and how
+ * blocking and polling behave across many connections) has not been settled.
+ * Exposing this interface as it stands would freeze those choices, so it
+ * remains the engine such an API will be built on.
+ */
+typedef struct quic_listener_st QUIC_LISTENER;
+typedef struct quic_listener_conn_st QUIC_LISTENER_CONN;
+
+typedef struct quic_listener_args_st {
+    OSSL_LIB_CTX    *libctx;
+    const char      *propq;
+
+    /*
+     * SSL_CTX used to create the TLS object for each incoming connection. The
+     * listener takes a reference to it.
+     */
+    SSL_CTX         *ctx;
+
+    /*
+     * The network BIOs. These are not freed by the listener and must outlive
+     * it.
+     */
+    BIO             *net_rbio, *net_wbio;
+
+    /* Optional time source. If NULL, ossl_time_now() is used. */
+    OSSL_TIME       (*now_cb)(void *arg);
+    void            *now_cb_arg;
+
+    /* Congestion controller to use, or NULL for the channel default. */
+    const OSSL_CC_METHOD *cc_method;
+
+    /*
+     * Maximum number of connections (including connections not yet accepted
+     * and connections which are terminating). Incoming connection attempts
+     * beyond this limit are ignored. 0 means no limit.
+     */
+    size_t          max_conns;
+
+    /*
+     * If non-zero, validate the address of every client with a Retry before
+     * creating any state for it.
+     */
+    int             require_retry;
+} QUIC_LISTENER_ARGS;
+
+/* Creates a new listener. Returns NULL on failure. */
+QUIC_LISTENER *ossl_quic_listener_new(const QUIC_LISTENER_ARGS *args);
+
+/*
+ * Frees the listener and all connections it owns, including connections which
+ * have been accepted but not released. No-op if ql is NULL.
+ */
+void ossl_quic_listener_free(QUIC_LISTENER *ql);
+
+/* Gets the reactor which can be used to tick/poll on the listener. */
+QUIC_REACTOR *ossl_quic_listener_get_reactor(QUIC_LISTENER *ql);
+
+/* Gets the mutex shared by the listener and all of its channels. */
+CRYPTO_MUTEX *ossl_quic_listener_get_mutex(QUIC_LISTENER *ql);
+
+/* Advances the state machine of the listener and all connections due. */
+int ossl_quic_listener_tick(QUIC_LISTENER *ql);
+
+/*
+ * Returns the next connection which has completed its handshake and has not
+ * yet been accepted, or NULL if there is none. The connection remains owned by
+ * the listener and must eventually be released with
+ * ossl_quic_listener_conn_release().
+ */
+QUIC_LISTENER_CONN *ossl_quic_listener_accept(QUIC_LISTENER *ql);
+
+/*
+ * Returns the number of connections currently owned by the listener, whether
+ * accepted or not.
+ */
+size_t ossl_quic_listener_get_num_conns(const QUIC_LISTENER *ql);
+
+/* Returns the channel implementing an accepted connection. */
+QUIC_CHANNEL *ossl_quic_listener_conn_get0_channel(QUIC_LISTENER_CONN *lc);
+
+/*
+ * Ticks an accepted connection immediately. This should be called after
+ * queueing data on one of the connection's streams.
+ */
+int ossl_quic_listener_conn_tick(QUIC_LISTENER_CONN *lc);
+
+/*
+ * Releases an accepted connection. The listener frees the connection once it
+ * has terminated, which may be immediately. lc must not be used after this
+ * call. To close the connection first, call ossl_quic_channel_local_close() on
+ * its channel.
+ */
+void ossl_quic_listener_conn_release(QUIC_LISTENER_CONN *lc);
+
+# endif
+
+#endif
@@ -330,6 +330,20 @@ int ossl_qrx_set_early_validation_cb(OSSL_QRX *qrx,
  */
 void ossl_qrx_inject_urxe(OSSL_QRX *qrx, QUIC_URXE *e);
 
+/*
+ * Sets an optional callback which will be called whenever the DEMUX routes a
+ * datagram to the QRX. This allows an owner of a DEMUX shared between many
+ * QRXs to find out which of them have work to do without polling each of
+ * them. It is not called for datagrams passed to ossl_qrx_inject_urxe().
+ *
+ * The callback is optional and can be unset by passing NULL for cb.
+ * cb_arg is an opaque value passed to cb.
+ */
+typedef void (ossl_qrx_rx_notify_cb)(void *arg);
+
+int ossl_qrx_set_rx_notify_cb(OSSL_QRX *qrx,
+                              ossl_qrx_rx_notify_cb *cb, void *cb_arg);
+
 /*
  * Key Update (RX)
  * ===============
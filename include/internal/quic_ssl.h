@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -28,10 +28,15 @@ __owur int ossl_quic_connect(SSL *s);
 __owur int ossl_quic_read(SSL *s, void *buf, size_t len, size_t *readbytes);
 __owur int ossl_quic_peek(SSL *s, void *buf, size_t len, size_t *readbytes);
 __owur int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written);
+__owur int ossl_quic_writev(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                           size_t *written);
 __owur long ossl_quic_ctrl(SSL *s, int cmd, long larg, void *parg);
 __owur long ossl_quic_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg);
 __owur long ossl_quic_callback_ctrl(SSL *s, int cmd, void (*fp) (void));
 __owur long ossl_quic_ctx_callback_ctrl(SSL_CTX *ctx, int cmd, void (*fp) (void));
+__owur int ossl_quic_read_borrow(SSL *s, const unsigned char **buf,
+                                 size_t *bytes_read);
+__owur int ossl_quic_read_release(SSL *s, size_t consumed);
 __owur size_t ossl_quic_pending(const SSL *s);
 __owur int ossl_quic_num_ciphers(void);
 __owur const SSL_CIPHER *ossl_quic_get_cipher(unsigned int u);
@@ -73,6 +78,12 @@ void ossl_quic_conn_set_override_now_cb(SSL *s,
                                         OSSL_TIME (*now_cb)(void *arg),
                                         void *now_cb_arg);
 
+/*
+ * Selects the congestion controller used for this connection. NULL selects the
+ * default. Must be called before connecting.
+ */
+int ossl_quic_conn_set_cc_method(SSL *s, const OSSL_CC_METHOD *cc_method);
+
 /*
  * Condvar waiting in the assist thread doesn't support time faking as it relies
  * on the OS's notion of time, thus this is used in test code to force a
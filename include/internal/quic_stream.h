@@ -1,5 +1,5 @@
 /*
-* Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+* Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
 *
 * Licensed under the Apache License 2.0 (the "License").  You may not use
 * this file except in compliance with the License.  You can obtain a copy
@@ -241,6 +241,20 @@ int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
                              size_t buf_len,
                              size_t *consumed);
 
+/*
+ * (Front end use.) As for ossl_quic_sstream_append(), but appends the data of
+ * the |iovcnt| segments in |iov|, skipping the first |skip| bytes of them.
+ * The data is appended as one contiguous range of the stream. As for
+ * ossl_quic_sstream_append(), *consumed may be short if the buffer fills up.
+ *
+ * Returns 1 on success or 0 on failure.
+ */
+int ossl_quic_sstream_appendv(QUIC_SSTREAM *qss,
+                              const SSL_IOVEC *iov,
+                              size_t iovcnt,
+                              size_t skip,
+                              size_t *consumed);
+
 /*
  * Marks a stream as finished. ossl_quic_sstream_append() may not be called anymore
  * after calling this.
@@ -101,6 +101,16 @@ struct quic_stream_st {
 
     /* A FIN has been retired from the rstream buffer. */
     unsigned int    recv_fin_retired        : 1;
+
+    /*
+     * The head of the rstream buffer has been lent to the application by
+     * SSL_read_borrow_ex() and not yet returned by SSL_read_release().
+     * borrow_fin indicates the borrowed data ends the stream and borrow_len
+     * is the length of the borrowed data.
+     */
+    unsigned int    read_borrowed           : 1;
+    unsigned int    borrow_fin              : 1;
+    size_t          borrow_len;
 };
 
 /*
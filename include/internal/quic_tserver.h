@@ -39,6 +39,8 @@ typedef struct quic_tserver_args_st {
     BIO *net_rbio, *net_wbio;
     OSSL_TIME (*now_cb)(void *arg);
     void *now_cb_arg;
+    /* Congestion controller to use, or NULL for the channel default. */
+    const OSSL_CC_METHOD *cc_method;
 } QUIC_TSERVER_ARGS;
 
 QUIC_TSERVER *ossl_quic_tserver_new(const QUIC_TSERVER_ARGS *args,
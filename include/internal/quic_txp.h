@@ -18,6 +18,7 @@
 # include "internal/quic_stream.h"
 # include "internal/quic_stream_map.h"
 # include "internal/quic_fc.h"
+# include "internal/quic_statm.h"
 # include "internal/bio_addr.h"
 # include "internal/time.h"
 
@@ -46,6 +47,7 @@ typedef struct ossl_quic_tx_packetiser_args_st {
     OSSL_CC_DATA    *cc_data;   /* QUIC Congestion Controller Instance */
     OSSL_TIME       (*now)(void *arg);  /* Callback to get current time. */
     void            *now_arg;
+    OSSL_STATM      *statm;     /* QUIC Statistics Manager; optional, enables pacing */
 
     /*
      * Injected dependencies - crypto streams.
@@ -105,6 +107,19 @@ int ossl_quic_tx_packetiser_has_pending(OSSL_QUIC_TX_PACKETISER *txp,
                                         uint32_t archetype,
                                         uint32_t flags);
 
+/*
+ * Returns the earliest time at which the TXP may be able to send more data
+ * which is currently being held back by congestion control or by pacing, or
+ * ossl_time_infinite() if there is no such time (for example because nothing
+ * is pending, or because we are waiting for ACKs).
+ *
+ * Pacing is only performed if a statistics manager was provided in the TXP
+ * arguments. Pacing credit accrues at 5/4 of the congestion window per
+ * smoothed RTT, and a burst of at most ten maximum-sized datagrams may be
+ * sent without waiting.
+ */
+OSSL_TIME ossl_quic_tx_packetiser_get_deadline(OSSL_QUIC_TX_PACKETISER *txp);
+
 /*
  * Set the token used in Initial packets. The callback is called when the buffer
  * is no longer needed; for example, when the TXP is freed or when this function
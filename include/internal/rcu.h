@@ -0,0 +1,47 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_INTERNAL_RCU_H
+# define OSSL_INTERNAL_RCU_H
+# pragma once
+
+# include <openssl/crypto.h>
+
+/*
+ * A minimal read-copy-update facility.
+ *
+ * Readers bracket their accesses to shared data with ossl_rcu_read_lock()
+ * and ossl_rcu_read_unlock() and load the pointers they follow with
+ * ossl_rcu_deref().  A read side critical section never blocks and must not
+ * wait for anything that could itself wait for a grace period.
+ *
+ * Writers are expected to serialise amongst themselves with a lock of their
+ * own.  They replace shared data by publishing a new version with
+ * ossl_rcu_assign_ptr() and may free the old version once
+ * ossl_synchronize_rcu() has returned, at which point no reader can still
+ * hold a reference to it.  ossl_synchronize_rcu() may be called without
+ * holding the writers' lock, so that the wait for the grace period does not
+ * block other writers.
+ */
+typedef struct rcu_lock_st CRYPTO_RCU_LOCK;
+
+CRYPTO_RCU_LOCK *ossl_rcu_lock_new(void);
+void ossl_rcu_lock_free(CRYPTO_RCU_LOCK *lock);
+
+int ossl_rcu_read_lock(CRYPTO_RCU_LOCK *lock, unsigned int *token);
+void ossl_rcu_read_unlock(CRYPTO_RCU_LOCK *lock, unsigned int token);
+void ossl_synchronize_rcu(CRYPTO_RCU_LOCK *lock);
+
+void *ossl_rcu_uptr_deref(void **p);
+void ossl_rcu_assign_uptr(void **p, void *v);
+
+# define ossl_rcu_deref(p) ossl_rcu_uptr_deref((void **)(p))
+# define ossl_rcu_assign_ptr(p, v) ossl_rcu_assign_uptr((void **)(p), (v))
+
+#endif
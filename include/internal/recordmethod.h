@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -61,12 +61,19 @@ typedef struct ossl_record_layer_st OSSL_RECORD_LAYER;
  * Template for creating a record. A record consists of the |type| of data it
  * will contain (e.g. alert, handshake, application data, etc) along with a
  * buffer of payload data in |buf| of length |buflen|.
+ *
+ * If |iov| is not NULL then |buf| is unused and the payload is instead
+ * gathered from the |iovcnt| segments in |iov|: it is the |buflen| bytes
+ * starting at offset |iovoff| into the first segment.
  */
 struct ossl_record_template_st {
     int type;
     unsigned int version;
     const unsigned char *buf;
     size_t buflen;
+    const SSL_IOVEC *iov;
+    size_t iovcnt;
+    size_t iovoff;
 };
 
 typedef struct ossl_record_template_st OSSL_RECORD_TEMPLATE;
@@ -56,5 +56,9 @@
 # define OSSL_TLS_GROUP_ID_ffdhe4096        0x0102
 # define OSSL_TLS_GROUP_ID_ffdhe6144        0x0103
 # define OSSL_TLS_GROUP_ID_ffdhe8192        0x0104
+# define OSSL_TLS_GROUP_ID_MLKEM512         0x0200
+# define OSSL_TLS_GROUP_ID_MLKEM768         0x0201
+# define OSSL_TLS_GROUP_ID_MLKEM1024        0x0202
+# define OSSL_TLS_GROUP_ID_X25519MLKEM768   0x11EC
 
 #endif
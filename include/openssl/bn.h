@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2002, Oracle and/or its affiliates. All rights reserved
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -328,6 +328,22 @@ int BN_mod_exp_mont_consttime_x2(BIGNUM *rr1, const BIGNUM *a1, const BIGNUM *p1
                                  const BIGNUM *m2, BN_MONT_CTX *in_mont2,
                                  BN_CTX *ctx);
 
+/*
+ * Code paths of BN_mod_exp_mont_consttime(), its _x2 variant and of the
+ * batched exponentiations of RSA_batch_enable(3)
+ */
+# define BN_MOD_EXP_PATH_GENERIC               0
+# define BN_MOD_EXP_PATH_MONT5                 1
+# define BN_MOD_EXP_PATH_SPARC_T4              2
+# define BN_MOD_EXP_PATH_RSAZ_512              3
+# define BN_MOD_EXP_PATH_RSAZ_AVX2             4
+# define BN_MOD_EXP_PATH_RSAZ_X2_AVX512_IFMA   5
+# define BN_MOD_EXP_PATH_RSAZ_X8_AVX512_IFMA   6
+# define BN_MOD_EXP_PATH_NUM                   7
+
+size_t BN_mod_exp_path_count(int path);
+const char *BN_mod_exp_path_name(int path);
+
 int BN_mask_bits(BIGNUM *a, int n);
 # ifndef OPENSSL_NO_STDIO
 int BN_print_fp(FILE *fp, const BIGNUM *a);
@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -137,6 +137,9 @@ extern "C" {
 #define OSSL_DIGEST_PARAM_SIZE         "size"          /* size_t */
 #define OSSL_DIGEST_PARAM_XOF          "xof"           /* int, 0 or 1 */
 #define OSSL_DIGEST_PARAM_ALGID_ABSENT "algid-absent"  /* int, 0 or 1 */
+#define OSSL_DIGEST_PARAM_CUSTOM       "custom"        /* octet string */
+#define OSSL_DIGEST_PARAM_CHUNK_SIZE   "chunk-size"    /* size_t */
+#define OSSL_DIGEST_PARAM_THREADS      "threads"       /* uint32_t */
 
 /* Known DIGEST names (not a complete list) */
 #define OSSL_DIGEST_NAME_MD5            "MD5"
@@ -430,6 +433,9 @@ extern "C" {
 /* EC, X25519 and X448 Key generation parameters */
 #define OSSL_PKEY_PARAM_DHKEM_IKM        "dhkem-ikm"
 
+/* ML-KEM key generation seed, d || z */
+#define OSSL_PKEY_PARAM_ML_KEM_SEED      "seed"
+
 /* Key generation parameters */
 #define OSSL_PKEY_PARAM_FFC_TYPE         "type"
 #define OSSL_PKEY_PARAM_FFC_PBITS        "pbits"
@@ -442,6 +448,9 @@ extern "C" {
 #define OSSL_PKEY_PARAM_EC_GROUP_CHECK_TYPE        "group-check"
 #define OSSL_PKEY_PARAM_EC_INCLUDE_PUBLIC          "include-public"
 
+/* EC and ED25519 verification keys */
+#define OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY          "precompute-verify"
+
 /* OSSL_PKEY_PARAM_EC_ENCODING values */
 #define OSSL_PKEY_EC_ENCODING_EXPLICIT  "explicit"
 #define OSSL_PKEY_EC_ENCODING_GROUP     "named_curve"
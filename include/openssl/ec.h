@@ -1,5 +1,5 @@
 /*
- * Copyright 2002-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2002-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2002, Oracle and/or its affiliates. All rights reserved
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -965,6 +965,7 @@ OSSL_DEPRECATEDIN_3_0 int ECPKParameters_print_fp(FILE *fp, const EC_GROUP *x,
 #  define EC_FLAG_CHECK_NAMED_GROUP_NIST 0x4000
 #  define EC_FLAG_CHECK_NAMED_GROUP_MASK \
     (EC_FLAG_CHECK_NAMED_GROUP | EC_FLAG_CHECK_NAMED_GROUP_NIST)
+#  define EC_FLAG_PRECOMPUTE_VERIFY      0x8000
 
 /* Deprecated flags -  it was using 0x01..0x02 */
 #  define EC_FLAG_NON_FIPS_ALLOW         0x0000
@@ -132,6 +132,11 @@ static const OSSL_ALGORITHM deflt_digests[] = {
     { PROV_NAMES_SHAKE_128, "provider=default", ossl_shake_128_functions },
     { PROV_NAMES_SHAKE_256, "provider=default", ossl_shake_256_functions },
 
+    { PROV_NAMES_PARALLELHASH_128, "provider=default",
+      ossl_parallelhash_128_functions },
+    { PROV_NAMES_PARALLELHASH_256, "provider=default",
+      ossl_parallelhash_256_functions },
+
 #ifndef OPENSSL_NO_BLAKE2
     /*
      * https://blake2.net/ doesn't specify size variants,
@@ -428,6 +433,18 @@ static const OSSL_ALGORITHM deflt_asym_kem[] = {
     { PROV_NAMES_X25519, "provider=default", ossl_ecx_asym_kem_functions },
     { PROV_NAMES_X448, "provider=default", ossl_ecx_asym_kem_functions },
     { PROV_NAMES_EC, "provider=default", ossl_ec_asym_kem_functions },
+#endif
+#ifndef OPENSSL_NO_ML_KEM
+    { PROV_NAMES_ML_KEM_512, "provider=default",
+      ossl_ml_kem_asym_kem_functions },
+    { PROV_NAMES_ML_KEM_768, "provider=default",
+      ossl_ml_kem_asym_kem_functions },
+    { PROV_NAMES_ML_KEM_1024, "provider=default",
+      ossl_ml_kem_asym_kem_functions },
+# ifndef OPENSSL_NO_EC
+    { PROV_NAMES_X25519MLKEM768, "provider=default",
+      ossl_mlx_kem_asym_kem_functions },
+# endif
 #endif
     { NULL, NULL, NULL }
 };
@@ -480,6 +497,18 @@ static const OSSL_ALGORITHM deflt_keymgmt[] = {
 #ifndef OPENSSL_NO_SM2
     { PROV_NAMES_SM2, "provider=default", ossl_sm2_keymgmt_functions,
       PROV_DESCS_SM2 },
+#endif
+#ifndef OPENSSL_NO_ML_KEM
+    { PROV_NAMES_ML_KEM_512, "provider=default",
+      ossl_ml_kem_512_keymgmt_functions, PROV_DESCS_ML_KEM_512 },
+    { PROV_NAMES_ML_KEM_768, "provider=default",
+      ossl_ml_kem_768_keymgmt_functions, PROV_DESCS_ML_KEM_768 },
+    { PROV_NAMES_ML_KEM_1024, "provider=default",
+      ossl_ml_kem_1024_keymgmt_functions, PROV_DESCS_ML_KEM_1024 },
+# ifndef OPENSSL_NO_EC
+    { PROV_NAMES_X25519MLKEM768, "provider=default",
+      ossl_mlx_kem_keymgmt_functions, PROV_DESCS_X25519MLKEM768 },
+# endif
 #endif
     { NULL, NULL, NULL }
 };
@@ -103,10 +103,22 @@ static int cipher_hw_aesni_xts_initkey(PROV_CIPHER_CTX *ctx,
                                        const unsigned char *key, size_t keylen)
 {
     PROV_AES_XTS_CTX *xctx = (PROV_AES_XTS_CTX *)ctx;
+    OSSL_xts_stream_fn stream_enc = aesni_xts_encrypt;
+    OSSL_xts_stream_fn stream_dec = aesni_xts_decrypt;
+
+# ifdef AESNI_VAES_AVX512_CAPABLE
+    if (AESNI_VAES_AVX512_CAPABLE) {
+        stream_enc = ossl_aes_xts_encrypt_vaes_avx512;
+        stream_dec = ossl_aes_xts_decrypt_vaes_avx512;
+    } else if (AESNI_VAES_AVX2_CAPABLE) {
+        stream_enc = ossl_aes_xts_encrypt_vaes_avx2;
+        stream_dec = ossl_aes_xts_decrypt_vaes_avx2;
+    }
+# endif /* AESNI_VAES_AVX512_CAPABLE */
 
     XTS_SET_KEY_FN(aesni_set_encrypt_key, aesni_set_decrypt_key,
                    aesni_encrypt, aesni_decrypt,
-                   aesni_xts_encrypt, aesni_xts_decrypt);
+                   stream_enc, stream_dec);
     return 1;
 }
 
@@ -25,6 +25,7 @@ typedef struct {
     struct { uint64_t aad, text; } len;
     unsigned int aad : 1;
     unsigned int mac_inited : 1;
+    unsigned int stitched : 1;  /* poly1305 is set up for the stitched kernel */
     size_t tag_len;
     size_t tls_payload_length;
     size_t tls_aad_pad_sz;
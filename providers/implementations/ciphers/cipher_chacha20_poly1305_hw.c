@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -110,8 +110,87 @@ static int chacha20_poly1305_initiv(PROV_CIPHER_CTX *bctx)
 void *xor128_encrypt_n_pad(void *out, const void *inp, void *otp, size_t len);
 void *xor128_decrypt_n_pad(void *out, const void *inp, void *otp, size_t len);
 static const unsigned char zero[4 * CHACHA_BLK_SIZE] = { 0 };
+
+void ossl_chacha20_poly1305_seal_avx2(unsigned char *out,
+                                      const unsigned char *inp, size_t len,
+                                      const unsigned int key[8],
+                                      const unsigned int counter[4],
+                                      void *poly);
+void ossl_chacha20_poly1305_open_avx2(unsigned char *out,
+                                      const unsigned char *inp, size_t len,
+                                      const unsigned int key[8],
+                                      const unsigned int counter[4],
+                                      void *poly);
+int ossl_chacha20_poly1305_avx2_capable(void);
+void poly1305_blocks(void *ctx, const unsigned char *inp, size_t len,
+                     unsigned int padbit);
+void poly1305_emit(void *ctx, unsigned char mac[16],
+                   const unsigned int nonce[4]);
+
+/*
+ * The stitched kernel hashes with the base 2^64 state of the scalar
+ * poly1305_blocks(), so use that instead of whatever Poly1305_Init() picked
+ * when the kernel can be used.
+ */
+static void chacha20_poly1305_mac_init(PROV_CHACHA20_POLY1305_CTX *ctx,
+                                       const unsigned char key[32])
+{
+    POLY1305 *poly = &ctx->poly1305;
+    uint64_t *st = (uint64_t *)poly->opaque, r[2];
+
+    Poly1305_Init(poly, key);
+    ctx->stitched = ossl_chacha20_poly1305_avx2_capable();
+    if (!ctx->stitched)
+        return;
+
+    memcpy(r, key, sizeof(r));
+    st[0] = st[1] = st[2] = 0;
+    st[3] = r[0] & 0x0ffffffc0fffffff;
+    st[4] = r[1] & 0x0ffffffc0ffffffc;
+    poly->func.blocks = poly1305_blocks;
+    poly->func.emit = poly1305_emit;
+}
+
+/*
+ * En- or decrypts and hashes the leading 512-byte chunks of |in| in a single
+ * pass and returns the number of bytes processed, which may be 0. The rest
+ * is left to the caller.
+ */
+static size_t chacha20_poly1305_stitch(PROV_CHACHA20_POLY1305_CTX *ctx,
+                                       unsigned char *out,
+                                       const unsigned char *in, size_t len)
+{
+    unsigned int *counter = ctx->chacha.counter;
+    size_t blocks;
+
+    len &= ~(size_t)(8 * CHACHA_BLK_SIZE - 1);
+    blocks = len / CHACHA_BLK_SIZE;
+
+    /*
+     * The Poly1305 input has to be block aligned, the key stream has to
+     * start at a block boundary, and the 32-bit counter must not wrap.
+     */
+    if (!ctx->stitched || len == 0
+            || ctx->poly1305.num != 0 || ctx->chacha.partial_len != 0
+            || blocks > 0xffffffffU - counter[0] + (size_t)1)
+        return 0;
+
+    if (ctx->base.enc)
+        ossl_chacha20_poly1305_seal_avx2(out, in, len, ctx->chacha.key.d,
+                                         counter, ctx->poly1305.opaque);
+    else
+        ossl_chacha20_poly1305_open_avx2(out, in, len, ctx->chacha.key.d,
+                                         counter, ctx->poly1305.opaque);
+    counter[0] += (unsigned int)blocks;
+    if (counter[0] == 0)
+        counter[1]++;
+    return len;
+}
 # else
 static const unsigned char zero[2 * CHACHA_BLK_SIZE] = { 0 };
+#  define chacha20_poly1305_mac_init(ctx, key) \
+    Poly1305_Init(&(ctx)->poly1305, key)
+#  define chacha20_poly1305_stitch(ctx, out, in, len) 0
 # endif
 
 static int chacha20_poly1305_tls_cipher(PROV_CIPHER_CTX *bctx,
@@ -121,7 +200,7 @@ static int chacha20_poly1305_tls_cipher(PROV_CIPHER_CTX *bctx,
 {
     PROV_CHACHA20_POLY1305_CTX *ctx = (PROV_CHACHA20_POLY1305_CTX *)bctx;
     POLY1305 *poly = &ctx->poly1305;
-    size_t tail, tohash_len, buf_len, plen = ctx->tls_payload_length;
+    size_t tail, tohash_len, buf_len, done, plen = ctx->tls_payload_length;
     unsigned char *buf, *tohash, *ctr, storage[sizeof(zero) + 32];
 
     DECLARE_IS_ENDIAN;
@@ -192,7 +271,7 @@ static int chacha20_poly1305_tls_cipher(PROV_CIPHER_CTX *bctx,
         ctx->chacha.counter[0] = 0;
         ChaCha20_ctr32(buf, zero, (buf_len = CHACHA_BLK_SIZE),
                        ctx->chacha.key.d, ctx->chacha.counter);
-        Poly1305_Init(poly, buf);
+        chacha20_poly1305_mac_init(ctx, buf);
         ctx->chacha.counter[0] = 1;
         ctx->chacha.partial_len = 0;
         Poly1305_Update(poly, ctx->tls_aad, POLY1305_BLOCK_SIZE);
@@ -201,16 +280,21 @@ static int chacha20_poly1305_tls_cipher(PROV_CIPHER_CTX *bctx,
         ctx->len.aad = EVP_AEAD_TLS1_AAD_LEN;
         ctx->len.text = plen;
 
+        done = chacha20_poly1305_stitch(ctx, out, in, plen);
+        in += done;
+        out += done;
         if (bctx->enc) {
-            ChaCha20_ctr32(out, in, plen, ctx->chacha.key.d, ctx->chacha.counter);
-            Poly1305_Update(poly, out, plen);
+            ChaCha20_ctr32(out, in, plen - done,
+                           ctx->chacha.key.d, ctx->chacha.counter);
+            Poly1305_Update(poly, out, plen - done);
         } else {
-            Poly1305_Update(poly, in, plen);
-            ChaCha20_ctr32(out, in, plen, ctx->chacha.key.d, ctx->chacha.counter);
+            Poly1305_Update(poly, in, plen - done);
+            ChaCha20_ctr32(out, in, plen - done,
+                           ctx->chacha.key.d, ctx->chacha.counter);
         }
 
-        in += plen;
-        out += plen;
+        in += plen - done;
+        out += plen - done;
         tail = (0 - plen) & (POLY1305_BLOCK_SIZE - 1);
         Poly1305_Update(poly, zero, tail);
     }
@@ -264,13 +348,19 @@ static int chacha20_poly1305_tls_cipher(PROV_CIPHER_CTX *bctx,
 static const unsigned char zero[CHACHA_BLK_SIZE] = { 0 };
 #endif /* OPENSSL_SMALL_FOOTPRINT */
 
+#ifdef OPENSSL_SMALL_FOOTPRINT
+# define chacha20_poly1305_mac_init(ctx, key) \
+    Poly1305_Init(&(ctx)->poly1305, key)
+# define chacha20_poly1305_stitch(ctx, out, in, len) 0
+#endif
+
 static int chacha20_poly1305_aead_cipher(PROV_CIPHER_CTX *bctx,
                                          unsigned char *out, size_t *outl,
                                          const unsigned char *in, size_t inl)
 {
     PROV_CHACHA20_POLY1305_CTX *ctx = (PROV_CHACHA20_POLY1305_CTX *)bctx;
     POLY1305 *poly = &ctx->poly1305;
-    size_t rem, plen = ctx->tls_payload_length;
+    size_t rem, done, plen = ctx->tls_payload_length;
     size_t olen = 0;
     int rv = 0;
 
@@ -288,7 +378,7 @@ static int chacha20_poly1305_aead_cipher(PROV_CIPHER_CTX *bctx,
         ctx->chacha.counter[0] = 0;
         ChaCha20_ctr32(ctx->chacha.buf, zero, CHACHA_BLK_SIZE,
                        ctx->chacha.key.d, ctx->chacha.counter);
-        Poly1305_Init(poly, ctx->chacha.buf);
+        chacha20_poly1305_mac_init(ctx, ctx->chacha.buf);
         ctx->chacha.counter[0] = 1;
         ctx->chacha.partial_len = 0;
         ctx->len.aad = ctx->len.text = 0;
@@ -319,15 +409,18 @@ static int chacha20_poly1305_aead_cipher(PROV_CIPHER_CTX *bctx,
             else if (inl != plen + POLY1305_BLOCK_SIZE)
                 goto err;
 
+            done = chacha20_poly1305_stitch(ctx, out, in, plen);
             if (bctx->enc) { /* plaintext */
-                ctx->chacha.base.hw->cipher(&ctx->chacha.base, out, in, plen);
-                Poly1305_Update(poly, out, plen);
+                ctx->chacha.base.hw->cipher(&ctx->chacha.base, out + done,
+                                            in + done, plen - done);
+                Poly1305_Update(poly, out + done, plen - done);
                 in += plen;
                 out += plen;
                 ctx->len.text += plen;
             } else { /* ciphertext */
-                Poly1305_Update(poly, in, plen);
-                ctx->chacha.base.hw->cipher(&ctx->chacha.base, out, in, plen);
+                Poly1305_Update(poly, in + done, plen - done);
+                ctx->chacha.base.hw->cipher(&ctx->chacha.base, out + done,
+                                            in + done, plen - done);
                 in += plen;
                 out += plen;
                 ctx->len.text += plen;
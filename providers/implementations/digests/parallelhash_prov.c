@@ -0,0 +1,629 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * ParallelHash128 and ParallelHash256, see NIST SP 800-185 section 6.
+ *
+ * The input is split into chunks of |chunk_size| bytes (B in SP 800-185).
+ * Every chunk is hashed on its own and the chunk digests are then hashed
+ * together with cSHAKE.  Chunks are collected into batches that are hashed
+ * with the multi-buffer Keccak code, and a batch is spread over several
+ * threads when the application has made threads available with
+ * OSSL_set_max_threads() and asked for them with the "threads" parameter.
+ */
+
+#include <string.h>
+#include <openssl/core_names.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/params.h>
+#include <openssl/proverr.h>
+#include "internal/sha3.h"
+#include "internal/thread.h"
+#include "prov/digestcommon.h"
+#include "prov/implementations.h"
+#include "prov/provider_ctx.h"
+
+#if defined(OPENSSL_NO_DEFAULT_THREAD_POOL) && defined(OPENSSL_NO_THREAD_POOL)
+# define PARALLELHASH_NO_THREADS
+#endif
+
+#if !defined(OPENSSL_THREADS)
+# define PARALLELHASH_NO_THREADS
+#endif
+
+#define PARALLELHASH_FLAGS              PROV_DIGEST_FLAG_XOF
+
+#define PARALLELHASH_DEFAULT_CHUNK_SIZE 8192
+#define PARALLELHASH_MAX_CHUNK_SIZE     (1 << 24)
+#define PARALLELHASH_MAX_CUSTOM         512
+#define PARALLELHASH_MAX_THREADS        1024
+/* Roughly how much input a single thread hashes per batch */
+#define PARALLELHASH_TASK_BYTES         (256 * 1024)
+/* Upper bound for the scratch space of a batch, pending input included */
+#define PARALLELHASH_MAX_SCRATCH        (64 * 1024 * 1024)
+
+/* The cSHAKE function name N */
+static const unsigned char parallelhash_name[] = "ParallelHash";
+
+static OSSL_FUNC_digest_freectx_fn parallelhash_freectx;
+static OSSL_FUNC_digest_dupctx_fn parallelhash_dupctx;
+static OSSL_FUNC_digest_init_fn parallelhash_init;
+static OSSL_FUNC_digest_update_fn parallelhash_update;
+static OSSL_FUNC_digest_final_fn parallelhash_final;
+static OSSL_FUNC_digest_set_ctx_params_fn parallelhash_set_ctx_params;
+static OSSL_FUNC_digest_settable_ctx_params_fn parallelhash_settable_ctx_params;
+
+typedef struct {
+    const KECCAK1600_CTX *leaf;
+    size_t num;
+    const unsigned char *const *in;
+    const size_t *inl;
+    unsigned char *const *out;
+} PARALLELHASH_TASK;
+
+typedef struct {
+    OSSL_LIB_CTX *libctx;
+    size_t bitlen;
+    size_t xoflen;
+    size_t chunk_size;
+    uint32_t threads;
+    unsigned char custom[PARALLELHASH_MAX_CUSTOM];
+    size_t custom_len;
+
+    /* Set once the first data has been absorbed */
+    int started;
+    uint64_t nchunks;
+    KECCAK1600_CTX outer;
+    KECCAK1600_CTX leaf;
+
+    /* Pending input, up to |batch| chunks, in |bufalloc| bytes */
+    unsigned char *buf;
+    size_t bufsz;
+    size_t bufalloc;
+    size_t batch;
+    size_t per_task;
+
+    /* Scratch space for hashing up to |nalloc| chunks */
+    size_t nalloc;
+    const unsigned char **in;
+    size_t *inl;
+    unsigned char **out;
+    unsigned char *leaves;
+    PARALLELHASH_TASK *tasks;
+    void **handles;
+} PARALLELHASH_CTX;
+
+static size_t left_encode(unsigned char *out, uint64_t x)
+{
+    size_t n = 1, i;
+
+    while (n < 8 && (x >> (8 * n)) != 0)
+        n++;
+    out[0] = (unsigned char)n;
+    for (i = 0; i < n; i++)
+        out[1 + i] = (unsigned char)(x >> (8 * (n - 1 - i)));
+    return n + 1;
+}
+
+static size_t right_encode(unsigned char *out, uint64_t x)
+{
+    size_t n = 1, i;
+
+    while (n < 8 && (x >> (8 * n)) != 0)
+        n++;
+    for (i = 0; i < n; i++)
+        out[i] = (unsigned char)(x >> (8 * (n - 1 - i)));
+    out[n] = (unsigned char)n;
+    return n + 1;
+}
+
+static size_t leaf_size(const PARALLELHASH_CTX *ctx)
+{
+    return ctx->bitlen / 4;
+}
+
+/* The scratch space needed for every chunk of a batch */
+static size_t chunk_scratch(const PARALLELHASH_CTX *ctx)
+{
+    return ctx->chunk_size + sizeof(*ctx->in) + sizeof(*ctx->inl)
+        + sizeof(*ctx->out) + leaf_size(ctx);
+}
+
+static void parallelhash_free_scratch(PARALLELHASH_CTX *ctx)
+{
+    if (ctx->buf != NULL)
+        OPENSSL_clear_free(ctx->buf, ctx->bufalloc);
+    OPENSSL_free(ctx->in);
+    OPENSSL_free(ctx->inl);
+    OPENSSL_free(ctx->out);
+    OPENSSL_free(ctx->leaves);
+    OPENSSL_free(ctx->tasks);
+    OPENSSL_free(ctx->handles);
+    ctx->buf = NULL;
+    ctx->bufalloc = 0;
+    ctx->nalloc = 0;
+    ctx->in = NULL;
+    ctx->inl = NULL;
+    ctx->out = NULL;
+    ctx->leaves = NULL;
+    ctx->tasks = NULL;
+    ctx->handles = NULL;
+}
+
+/*
+ * Sizes the batches for the chunk size and the number of threads, within
+ * PARALLELHASH_MAX_SCRATCH, and allocates the per thread scratch space.
+ * The rest grows with the input in parallelhash_grow().
+ */
+static int parallelhash_alloc_scratch(PARALLELHASH_CTX *ctx)
+{
+    size_t max;
+
+    ctx->per_task = PARALLELHASH_TASK_BYTES / ctx->chunk_size;
+    if (ctx->per_task == 0)
+        ctx->per_task = 1;
+    max = PARALLELHASH_MAX_SCRATCH / chunk_scratch(ctx);
+    if (max == 0)
+        max = 1;
+    if (ctx->per_task <= max / ctx->threads)
+        ctx->batch = ctx->per_task * ctx->threads;
+    else
+        ctx->batch = max;
+    if (ctx->per_task > ctx->batch)
+        ctx->per_task = ctx->batch;
+
+    ctx->tasks = OPENSSL_malloc(ctx->threads * sizeof(*ctx->tasks));
+    ctx->handles = OPENSSL_malloc(ctx->threads * sizeof(*ctx->handles));
+    if (ctx->tasks == NULL || ctx->handles == NULL) {
+        parallelhash_free_scratch(ctx);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * Makes room for |nchunks| chunks to hash and |nbytes| of pending input,
+ * both at most one batch.  The space at least doubles when it grows, so
+ * that short messages do not pay for a whole batch and long ones do not
+ * reallocate often.
+ */
+static int parallelhash_grow(PARALLELHASH_CTX *ctx, size_t nchunks,
+                             size_t nbytes)
+{
+    size_t batch_bytes = ctx->batch * ctx->chunk_size, n;
+    void *p;
+
+    if (nchunks > ctx->nalloc) {
+        n = ctx->nalloc < ctx->batch / 2 ? 2 * ctx->nalloc : ctx->batch;
+        if (n < nchunks)
+            n = nchunks;
+        if ((p = OPENSSL_realloc(ctx->in, n * sizeof(*ctx->in))) == NULL)
+            return 0;
+        ctx->in = p;
+        if ((p = OPENSSL_realloc(ctx->inl, n * sizeof(*ctx->inl))) == NULL)
+            return 0;
+        ctx->inl = p;
+        if ((p = OPENSSL_realloc(ctx->out, n * sizeof(*ctx->out))) == NULL)
+            return 0;
+        ctx->out = p;
+        if ((p = OPENSSL_realloc(ctx->leaves, n * leaf_size(ctx))) == NULL)
+            return 0;
+        ctx->leaves = p;
+        ctx->nalloc = n;
+    }
+    if (nbytes > ctx->bufalloc) {
+        n = ctx->bufalloc < batch_bytes / 2 ? 2 * ctx->bufalloc : batch_bytes;
+        if (n < nbytes)
+            n = nbytes;
+        if ((p = OPENSSL_clear_realloc(ctx->buf, ctx->bufalloc, n)) == NULL)
+            return 0;
+        ctx->buf = p;
+        ctx->bufalloc = n;
+    }
+    return 1;
+}
+
+static void parallelhash_reset(PARALLELHASH_CTX *ctx)
+{
+    parallelhash_free_scratch(ctx);
+    ctx->started = 0;
+    ctx->nchunks = 0;
+    ctx->bufsz = 0;
+}
+
+/*
+ * Absorbs bytepad(encode_string(N) || encode_string(S), rate) || left_encode(B)
+ * into the outer cSHAKE and sets up the chunk hash, which is cSHAKE with
+ * empty N and S, i.e. SHAKE.
+ */
+static int parallelhash_start(PARALLELHASH_CTX *ctx)
+{
+    static const unsigned char zeroes[KECCAK1600_WIDTH / 8] = { 0 };
+    unsigned char enc[9];
+    size_t rate, n, total;
+
+    if (ctx->threads > 1) {
+#ifdef PARALLELHASH_NO_THREADS
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_INVALID_THREAD_POOL_SIZE,
+                       "requested %u threads, single-threaded mode supported only",
+                       ctx->threads);
+        return 0;
+#else
+        if (ctx->threads - 1 > ossl_get_avail_threads(ctx->libctx)) {
+            ERR_raise_data(ERR_LIB_PROV, PROV_R_INVALID_THREAD_POOL_SIZE,
+                           "requested %u threads, available: %u",
+                           ctx->threads,
+                           (unsigned int)ossl_get_avail_threads(ctx->libctx)
+                           + 1);
+            return 0;
+        }
+#endif
+    }
+
+    if (!parallelhash_alloc_scratch(ctx))
+        return 0;
+
+    if (!ossl_sha3_init(&ctx->outer, '\x04', ctx->bitlen)
+            || !ossl_sha3_init(&ctx->leaf, '\x1f', ctx->bitlen)) {
+        parallelhash_free_scratch(ctx);
+        return 0;
+    }
+    ctx->leaf.md_size = leaf_size(ctx);
+    rate = ctx->outer.block_size;
+
+    n = left_encode(enc, rate);
+    ossl_sha3_update(&ctx->outer, enc, n);
+    total = n;
+    n = left_encode(enc, 8 * (sizeof(parallelhash_name) - 1));
+    ossl_sha3_update(&ctx->outer, enc, n);
+    ossl_sha3_update(&ctx->outer, parallelhash_name,
+                     sizeof(parallelhash_name) - 1);
+    total += n + sizeof(parallelhash_name) - 1;
+    n = left_encode(enc, 8 * (uint64_t)ctx->custom_len);
+    ossl_sha3_update(&ctx->outer, enc, n);
+    ossl_sha3_update(&ctx->outer, ctx->custom, ctx->custom_len);
+    total += n + ctx->custom_len;
+    if (total % rate != 0)
+        ossl_sha3_update(&ctx->outer, zeroes, rate - total % rate);
+
+    n = left_encode(enc, ctx->chunk_size);
+    ossl_sha3_update(&ctx->outer, enc, n);
+
+    ctx->started = 1;
+    return 1;
+}
+
+static uint32_t parallelhash_task(void *arg)
+{
+    PARALLELHASH_TASK *task = arg;
+
+    ossl_sha3_many(task->leaf, task->num, task->in, task->inl, task->out);
+    return 1;
+}
+
+/*
+ * Hashes the |len| bytes at |in|, which are at most one batch of chunks, and
+ * absorbs the chunk digests.  Only the last chunk may be short.
+ */
+static int parallelhash_chunks(PARALLELHASH_CTX *ctx, const unsigned char *in,
+                               size_t len)
+{
+    size_t num = (len + ctx->chunk_size - 1) / ctx->chunk_size;
+    size_t ntasks, per, i;
+    int ret = 1;
+
+    if (!parallelhash_grow(ctx, num, 0))
+        return 0;
+    for (i = 0; i < num; i++) {
+        ctx->in[i] = in + i * ctx->chunk_size;
+        ctx->inl[i] = i + 1 < num ? ctx->chunk_size
+                                  : len - i * ctx->chunk_size;
+        ctx->out[i] = ctx->leaves + i * leaf_size(ctx);
+    }
+
+    ntasks = (num + ctx->per_task - 1) / ctx->per_task;
+    per = (num + ntasks - 1) / ntasks;
+    for (i = 0; i < ntasks; i++) {
+        PARALLELHASH_TASK *task = &ctx->tasks[i];
+
+        task->leaf = &ctx->leaf;
+        task->num = i + 1 < ntasks ? per : num - i * per;
+        task->in = ctx->in + i * per;
+        task->inl = ctx->inl + i * per;
+        task->out = ctx->out + i * per;
+        ctx->handles[i] = NULL;
+    }
+
+#ifndef PARALLELHASH_NO_THREADS
+    /* If a thread cannot be started its chunks are hashed here instead */
+    for (i = 1; i < ntasks; i++)
+        ctx->handles[i] = ossl_crypto_thread_start(ctx->libctx,
+                                                   &parallelhash_task,
+                                                   &ctx->tasks[i]);
+#endif
+    for (i = 0; i < ntasks; i++)
+        if (ctx->handles[i] == NULL)
+            parallelhash_task(&ctx->tasks[i]);
+#ifndef PARALLELHASH_NO_THREADS
+    for (i = 1; i < ntasks; i++) {
+        if (ctx->handles[i] == NULL)
+            continue;
+        if (!ossl_crypto_thread_join(ctx->handles[i], NULL))
+            ret = 0;
+        if (!ossl_crypto_thread_clean(ctx->handles[i]))
+            ret = 0;
+    }
+#endif
+    if (!ret)
+        return 0;
+
+    ossl_sha3_update(&ctx->outer, ctx->leaves, num * leaf_size(ctx));
+    ctx->nchunks += num;
+    return 1;
+}
+
+static void *parallelhash_newctx(void *provctx, size_t bitlen)
+{
+    PARALLELHASH_CTX *ctx;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    ctx = OPENSSL_zalloc(sizeof(*ctx));
+    if (ctx == NULL)
+        return NULL;
+    ctx->libctx = PROV_LIBCTX_OF(provctx);
+    ctx->bitlen = bitlen;
+    ctx->xoflen = bitlen / 4;
+    ctx->chunk_size = PARALLELHASH_DEFAULT_CHUNK_SIZE;
+    ctx->threads = 1;
+    return ctx;
+}
+
+static void parallelhash_freectx(void *vctx)
+{
+    PARALLELHASH_CTX *ctx = vctx;
+
+    if (ctx == NULL)
+        return;
+    parallelhash_free_scratch(ctx);
+    OPENSSL_clear_free(ctx, sizeof(*ctx));
+}
+
+static void *parallelhash_dupctx(void *vctx)
+{
+    PARALLELHASH_CTX *in = vctx;
+    PARALLELHASH_CTX *ret;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    ret = OPENSSL_malloc(sizeof(*ret));
+    if (ret == NULL)
+        return NULL;
+    *ret = *in;
+    ret->buf = NULL;
+    ret->bufalloc = 0;
+    ret->nalloc = 0;
+    ret->in = NULL;
+    ret->inl = NULL;
+    ret->out = NULL;
+    ret->leaves = NULL;
+    ret->tasks = NULL;
+    ret->handles = NULL;
+    if (in->started) {
+        if (!parallelhash_alloc_scratch(ret)
+                || !parallelhash_grow(ret, 0, in->bufsz)) {
+            parallelhash_free_scratch(ret);
+            OPENSSL_clear_free(ret, sizeof(*ret));
+            return NULL;
+        }
+        if (in->bufsz != 0)
+            memcpy(ret->buf, in->buf, in->bufsz);
+    }
+    return ret;
+}
+
+static int parallelhash_init(void *vctx, const OSSL_PARAM params[])
+{
+    PARALLELHASH_CTX *ctx = vctx;
+
+    if (!ossl_prov_is_running())
+        return 0;
+    parallelhash_reset(ctx);
+    return parallelhash_set_ctx_params(ctx, params);
+}
+
+static int parallelhash_update(void *vctx, const unsigned char *in, size_t len)
+{
+    PARALLELHASH_CTX *ctx = vctx;
+    size_t batch_bytes, n;
+
+    if (len == 0)
+        return 1;
+    if (!ctx->started && !parallelhash_start(ctx))
+        return 0;
+    batch_bytes = ctx->batch * ctx->chunk_size;
+
+    if (ctx->bufsz != 0) {
+        n = batch_bytes - ctx->bufsz;
+        if (!parallelhash_grow(ctx, 0,
+                               len < n ? ctx->bufsz + len : batch_bytes))
+            return 0;
+        if (len < n) {
+            memcpy(ctx->buf + ctx->bufsz, in, len);
+            ctx->bufsz += len;
+            return 1;
+        }
+        memcpy(ctx->buf + ctx->bufsz, in, n);
+        in += n;
+        len -= n;
+        ctx->bufsz = 0;
+        if (!parallelhash_chunks(ctx, ctx->buf, batch_bytes))
+            return 0;
+    }
+    /* Whole batches are hashed straight from the input */
+    while (len >= batch_bytes) {
+        if (!parallelhash_chunks(ctx, in, batch_bytes))
+            return 0;
+        in += batch_bytes;
+        len -= batch_bytes;
+    }
+    if (len != 0) {
+        if (!parallelhash_grow(ctx, 0, len))
+            return 0;
+        memcpy(ctx->buf, in, len);
+    }
+    ctx->bufsz = len;
+    return 1;
+}
+
+static int parallelhash_final(void *vctx, unsigned char *out, size_t *outl,
+                              size_t outsz)
+{
+    PARALLELHASH_CTX *ctx = vctx;
+    unsigned char enc[9];
+    size_t n;
+
+    if (!ossl_prov_is_running())
+        return 0;
+    if (outsz < ctx->xoflen) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_OUTPUT_LENGTH);
+        return 0;
+    }
+    if (!ctx->started && !parallelhash_start(ctx))
+        return 0;
+    if (ctx->bufsz != 0 && !parallelhash_chunks(ctx, ctx->buf, ctx->bufsz))
+        return 0;
+    ctx->bufsz = 0;
+
+    n = right_encode(enc, ctx->nchunks);
+    ossl_sha3_update(&ctx->outer, enc, n);
+    n = right_encode(enc, 8 * (uint64_t)ctx->xoflen);
+    ossl_sha3_update(&ctx->outer, enc, n);
+    ctx->outer.md_size = ctx->xoflen;
+    if (!ossl_sha3_final(out, &ctx->outer))
+        return 0;
+    *outl = ctx->xoflen;
+    return 1;
+}
+
+static const OSSL_PARAM known_parallelhash_settable_ctx_params[] = {
+    OSSL_PARAM_size_t(OSSL_DIGEST_PARAM_XOFLEN, NULL),
+    OSSL_PARAM_octet_string(OSSL_DIGEST_PARAM_CUSTOM, NULL, 0),
+    OSSL_PARAM_size_t(OSSL_DIGEST_PARAM_CHUNK_SIZE, NULL),
+    OSSL_PARAM_uint32(OSSL_DIGEST_PARAM_THREADS, NULL),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *
+parallelhash_settable_ctx_params(ossl_unused void *ctx,
+                                 ossl_unused void *provctx)
+{
+    return known_parallelhash_settable_ctx_params;
+}
+
+static int parallelhash_set_ctx_params(void *vctx, const OSSL_PARAM params[])
+{
+    PARALLELHASH_CTX *ctx = vctx;
+    const OSSL_PARAM *p;
+    void *custom;
+    size_t sz;
+    uint32_t threads;
+
+    if (ctx == NULL)
+        return 0;
+    if (params == NULL)
+        return 1;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_DIGEST_PARAM_XOFLEN);
+    if (p != NULL && !OSSL_PARAM_get_size_t(p, &ctx->xoflen)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+        return 0;
+    }
+
+    /* The remaining parameters shape the encoding of the whole input */
+    p = OSSL_PARAM_locate_const(params, OSSL_DIGEST_PARAM_CUSTOM);
+    if (p != NULL) {
+        if (ctx->started) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_STATE);
+            return 0;
+        }
+        if (p->data_size > PARALLELHASH_MAX_CUSTOM) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_CUSTOM_LENGTH);
+            return 0;
+        }
+        custom = ctx->custom;
+        if (!OSSL_PARAM_get_octet_string(p, &custom, sizeof(ctx->custom),
+                                         &ctx->custom_len))
+            return 0;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_DIGEST_PARAM_CHUNK_SIZE);
+    if (p != NULL) {
+        if (ctx->started) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_STATE);
+            return 0;
+        }
+        if (!OSSL_PARAM_get_size_t(p, &sz)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            return 0;
+        }
+        if (sz == 0 || sz > PARALLELHASH_MAX_CHUNK_SIZE) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_BAD_LENGTH);
+            return 0;
+        }
+        ctx->chunk_size = sz;
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_DIGEST_PARAM_THREADS);
+    if (p != NULL) {
+        if (ctx->started) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_STATE);
+            return 0;
+        }
+        if (!OSSL_PARAM_get_uint32(p, &threads)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_TO_GET_PARAMETER);
+            return 0;
+        }
+        if (threads == 0 || threads > PARALLELHASH_MAX_THREADS) {
+            ERR_raise_data(ERR_LIB_PROV, PROV_R_INVALID_THREAD_POOL_SIZE,
+                           "threads: %u", threads);
+            return 0;
+        }
+        ctx->threads = threads;
+    }
+    return 1;
+}
+
+#define IMPLEMENT_PARALLELHASH_functions(bitlen)                               \
+static OSSL_FUNC_digest_newctx_fn parallelhash_##bitlen##_newctx;              \
+static void *parallelhash_##bitlen##_newctx(void *provctx)                     \
+{                                                                              \
+    return parallelhash_newctx(provctx, bitlen);                               \
+}                                                                              \
+PROV_FUNC_DIGEST_GET_PARAM(parallelhash_##bitlen, SHA3_BLOCKSIZE(bitlen),      \
+                           (bitlen) / 4, PARALLELHASH_FLAGS)                   \
+const OSSL_DISPATCH ossl_parallelhash_##bitlen##_functions[] = {               \
+    { OSSL_FUNC_DIGEST_NEWCTX,                                                 \
+      (void (*)(void))parallelhash_##bitlen##_newctx },                        \
+    { OSSL_FUNC_DIGEST_INIT, (void (*)(void))parallelhash_init },              \
+    { OSSL_FUNC_DIGEST_UPDATE, (void (*)(void))parallelhash_update },          \
+    { OSSL_FUNC_DIGEST_FINAL, (void (*)(void))parallelhash_final },            \
+    { OSSL_FUNC_DIGEST_FREECTX, (void (*)(void))parallelhash_freectx },        \
+    { OSSL_FUNC_DIGEST_DUPCTX, (void (*)(void))parallelhash_dupctx },          \
+    { OSSL_FUNC_DIGEST_SET_CTX_PARAMS,                                         \
+      (void (*)(void))parallelhash_set_ctx_params },                           \
+    { OSSL_FUNC_DIGEST_SETTABLE_CTX_PARAMS,                                    \
+      (void (*)(void))parallelhash_settable_ctx_params },                      \
+    PROV_DISPATCH_FUNC_DIGEST_GET_PARAMS(parallelhash_##bitlen),               \
+    { 0, NULL }                                                                \
+};
+
+/* ossl_parallelhash_128_functions */
+IMPLEMENT_PARALLELHASH_functions(128)
+/* ossl_parallelhash_256_functions */
+IMPLEMENT_PARALLELHASH_functions(256)
@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -282,6 +282,33 @@ static void *uname##_newctx(void *provctx)                                     \
     return ctx;                                                                \
 }
 
+/*
+ * The multi-message entry point hashes with the generic code, so it is not
+ * offered where the CPU has its own SHA-3 instructions.
+ */
+#if defined(S390_SHA3)
+# define SHA3_digest_many(name, bitlen, pad)
+# define PROV_DISPATCH_FUNC_SHA3_DIGEST_MANY(name)
+#else
+# define SHA3_digest_many(name, bitlen, pad)                                   \
+static OSSL_FUNC_digest_digest_many_fn name##_digest_many;                     \
+static int name##_digest_many(ossl_unused void *provctx, size_t num,           \
+                              const unsigned char *const *in,                  \
+                              const size_t *inl, unsigned char *const *out,    \
+                              size_t outsz)                                    \
+{                                                                              \
+    KECCAK1600_CTX ctx;                                                        \
+                                                                               \
+    if (!ossl_prov_is_running() || outsz < SHA3_MDSIZE(bitlen)                 \
+            || !ossl_sha3_init(&ctx, pad, bitlen))                             \
+        return 0;                                                              \
+    ossl_sha3_many(&ctx, num, in, inl, out);                                   \
+    return 1;                                                                  \
+}
+# define PROV_DISPATCH_FUNC_SHA3_DIGEST_MANY(name)                             \
+    { OSSL_FUNC_DIGEST_DIGEST_MANY, (void (*)(void))name##_digest_many },
+#endif /* S390_SHA3 */
+
 #define PROV_FUNC_SHA3_DIGEST_COMMON(name, bitlen, blksize, dgstsize, flags)   \
 PROV_FUNC_DIGEST_GET_PARAM(name, blksize, dgstsize, flags)                     \
 const OSSL_DISPATCH ossl_##name##_functions[] = {                              \
@@ -295,6 +322,16 @@ const OSSL_DISPATCH ossl_##name##_functions[] = {                              \
 #define PROV_FUNC_SHA3_DIGEST(name, bitlen, blksize, dgstsize, flags)          \
     PROV_FUNC_SHA3_DIGEST_COMMON(name, bitlen, blksize, dgstsize, flags),      \
     { OSSL_FUNC_DIGEST_INIT, (void (*)(void))keccak_init },                    \
+    PROV_DISPATCH_FUNC_SHA3_DIGEST_MANY(name)                                  \
+    PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_END
+
+#define PROV_FUNC_SHAKE_DIGEST_MANY(name, bitlen, blksize, dgstsize, flags)    \
+    PROV_FUNC_SHA3_DIGEST_COMMON(name, bitlen, blksize, dgstsize, flags),      \
+    { OSSL_FUNC_DIGEST_INIT, (void (*)(void))keccak_init_params },             \
+    { OSSL_FUNC_DIGEST_SET_CTX_PARAMS, (void (*)(void))shake_set_ctx_params }, \
+    { OSSL_FUNC_DIGEST_SETTABLE_CTX_PARAMS,                                    \
+     (void (*)(void))shake_settable_ctx_params },                              \
+    PROV_DISPATCH_FUNC_SHA3_DIGEST_MANY(name)                                  \
     PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_END
 
 #define PROV_FUNC_SHAKE_DIGEST(name, bitlen, blksize, dgstsize, flags)         \
@@ -353,21 +390,24 @@ static int shake_set_ctx_params(void *vctx, const OSSL_PARAM params[])
 
 #define IMPLEMENT_SHA3_functions(bitlen)                                       \
     SHA3_newctx(sha3, SHA3_##bitlen, sha3_##bitlen, bitlen, '\x06')            \
+    SHA3_digest_many(sha3_##bitlen, bitlen, '\x06')                            \
     PROV_FUNC_SHA3_DIGEST(sha3_##bitlen, bitlen,                               \
                           SHA3_BLOCKSIZE(bitlen), SHA3_MDSIZE(bitlen),         \
                           SHA3_FLAGS)
 
 #define IMPLEMENT_KECCAK_functions(bitlen)                                     \
     SHA3_newctx(keccak, KECCAK_##bitlen, keccak_##bitlen, bitlen, '\x01')      \
+    SHA3_digest_many(keccak_##bitlen, bitlen, '\x01')                          \
     PROV_FUNC_SHA3_DIGEST(keccak_##bitlen, bitlen,                             \
                           SHA3_BLOCKSIZE(bitlen), SHA3_MDSIZE(bitlen),         \
                           SHA3_FLAGS)
 
 #define IMPLEMENT_SHAKE_functions(bitlen)                                      \
     SHA3_newctx(shake, SHAKE_##bitlen, shake_##bitlen, bitlen, '\x1f')         \
-    PROV_FUNC_SHAKE_DIGEST(shake_##bitlen, bitlen,                             \
-                          SHA3_BLOCKSIZE(bitlen), SHA3_MDSIZE(bitlen),         \
-                          SHAKE_FLAGS)
+    SHA3_digest_many(shake_##bitlen, bitlen, '\x1f')                           \
+    PROV_FUNC_SHAKE_DIGEST_MANY(shake_##bitlen, bitlen,                        \
+                                SHA3_BLOCKSIZE(bitlen), SHA3_MDSIZE(bitlen),   \
+                                SHAKE_FLAGS)
 #define IMPLEMENT_KMAC_functions(bitlen)                                       \
     KMAC_newctx(keccak_kmac_##bitlen, bitlen, '\x04')                          \
     PROV_FUNC_SHAKE_DIGEST(keccak_kmac_##bitlen, bitlen,                       \
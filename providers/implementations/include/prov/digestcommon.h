@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -47,6 +47,21 @@ static int name##_internal_final(void *ctx, unsigned char *out, size_t *outl,  \
     return 0;                                                                  \
 }
 
+# define PROV_FUNC_DIGEST_DIGEST_MANY(name, CTX, dgstsize, init, many)        \
+static OSSL_FUNC_digest_digest_many_fn name##_digest_many;                     \
+static int name##_digest_many(ossl_unused void *provctx, size_t num,           \
+                              const unsigned char *const *in,                  \
+                              const size_t *inl, unsigned char *const *out,    \
+                              size_t outsz)                                    \
+{                                                                              \
+    CTX ctx;                                                                   \
+                                                                               \
+    if (!ossl_prov_is_running() || outsz < dgstsize || !init(&ctx))            \
+        return 0;                                                              \
+    many(&ctx, num, in, inl, out);                                             \
+    return 1;                                                                  \
+}
+
 # define PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_START(                            \
     name, CTX, blksize, dgstsize, flags, upd, fin)                             \
 static OSSL_FUNC_digest_newctx_fn name##_newctx;                               \
@@ -97,6 +112,21 @@ PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_START(name, CTX, blksize, dgstsize, flags, \
     { OSSL_FUNC_DIGEST_INIT, (void (*)(void))name##_internal_init },           \
 PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_END
 
+# define IMPLEMENT_digest_functions_with_many(                                 \
+    name, CTX, blksize, dgstsize, flags, init, upd, fin, many)                 \
+static OSSL_FUNC_digest_init_fn name##_internal_init;                          \
+static int name##_internal_init(void *ctx,                                     \
+                                ossl_unused const OSSL_PARAM params[])         \
+{                                                                              \
+    return ossl_prov_is_running() && init(ctx);                                \
+}                                                                              \
+PROV_FUNC_DIGEST_DIGEST_MANY(name, CTX, dgstsize, init, many)                  \
+PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_START(name, CTX, blksize, dgstsize, flags, \
+                                          upd, fin),                           \
+    { OSSL_FUNC_DIGEST_INIT, (void (*)(void))name##_internal_init },           \
+    { OSSL_FUNC_DIGEST_DIGEST_MANY, (void (*)(void))name##_digest_many },      \
+PROV_DISPATCH_FUNC_DIGEST_CONSTRUCT_END
+
 # define IMPLEMENT_digest_functions_with_settable_ctx(                         \
     name, CTX, blksize, dgstsize, flags, init, upd, fin,                       \
     settable_ctx_params, set_ctx_params)                                       \
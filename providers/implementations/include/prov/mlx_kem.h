@@ -0,0 +1,40 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_PROV_MLX_KEM_H
+# define OSSL_PROV_MLX_KEM_H
+# pragma once
+
+# include <openssl/opensslconf.h>
+
+# if !defined(OPENSSL_NO_ML_KEM) && !defined(OPENSSL_NO_EC)
+#  include "crypto/ecx.h"
+#  include "crypto/ml_kem.h"
+
+/*
+ * The X25519MLKEM768 hybrid of draft-kwiatkowski-tls-ecdhe-mlkem.  All
+ * encodings put the ML-KEM component first: the public key is ek || X25519
+ * public key, the ciphertext is ct || ephemeral X25519 public key and the
+ * shared secret is the ML-KEM secret followed by the X25519 one.
+ */
+#  define MLX_KEM_PUBLIC_KEY_BYTES \
+    (ML_KEM_768_PUBLIC_KEY_BYTES + X25519_KEYLEN)
+#  define MLX_KEM_CIPHERTEXT_BYTES \
+    (ML_KEM_768_CIPHERTEXT_BYTES + X25519_KEYLEN)
+#  define MLX_KEM_SHARED_SECRET_BYTES \
+    (ML_KEM_SHARED_SECRET_BYTES + X25519_KEYLEN)
+
+typedef struct {
+    OSSL_LIB_CTX *libctx;
+    ML_KEM_KEY *mkey;
+    ECX_KEY *xkey;
+} MLX_KEY;
+
+# endif
+#endif
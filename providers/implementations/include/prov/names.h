@@ -233,6 +233,9 @@
 #define PROV_NAMES_SHAKE_128 "SHAKE-128:SHAKE128:2.16.840.1.101.3.4.2.11"
 #define PROV_NAMES_SHAKE_256 "SHAKE-256:SHAKE256:2.16.840.1.101.3.4.2.12"
 
+#define PROV_NAMES_PARALLELHASH_128 "PARALLELHASH-128:PARALLELHASH128"
+#define PROV_NAMES_PARALLELHASH_256 "PARALLELHASH-256:PARALLELHASH256"
+
 /*
  * KECCAK-KMAC-128 and KECCAK-KMAC-256 as hashes are mostly useful for 
  * KMAC128 and KMAC256.
@@ -341,3 +344,11 @@
 #define PROV_DESCS_RSA_PSS "OpenSSL RSA-PSS implementation"
 #define PROV_NAMES_SM2 "SM2:1.2.156.10197.1.301"
 #define PROV_DESCS_SM2 "OpenSSL SM2 implementation"
+#define PROV_NAMES_ML_KEM_512 "ML-KEM-512:MLKEM512:2.16.840.1.101.3.4.4.1"
+#define PROV_DESCS_ML_KEM_512 "OpenSSL ML-KEM-512 implementation"
+#define PROV_NAMES_ML_KEM_768 "ML-KEM-768:MLKEM768:2.16.840.1.101.3.4.4.2"
+#define PROV_DESCS_ML_KEM_768 "OpenSSL ML-KEM-768 implementation"
+#define PROV_NAMES_ML_KEM_1024 "ML-KEM-1024:MLKEM1024:2.16.840.1.101.3.4.4.3"
+#define PROV_DESCS_ML_KEM_1024 "OpenSSL ML-KEM-1024 implementation"
+#define PROV_NAMES_X25519MLKEM768 "X25519MLKEM768"
+#define PROV_DESCS_X25519MLKEM768 "OpenSSL X25519MLKEM768 hybrid implementation"
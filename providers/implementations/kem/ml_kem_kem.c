@@ -0,0 +1,232 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/* ML-KEM, NIST FIPS 203, for all three parameter sets */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#include <openssl/err.h>
+#include <openssl/proverr.h>
+#include "crypto/ml_kem.h"
+#include "prov/provider_ctx.h"
+#include "prov/implementations.h"
+#include "prov/providercommon.h"
+
+static OSSL_FUNC_kem_newctx_fn ml_kem_newctx;
+static OSSL_FUNC_kem_encapsulate_init_fn ml_kem_encapsulate_init;
+static OSSL_FUNC_kem_encapsulate_fn ml_kem_encapsulate;
+static OSSL_FUNC_kem_decapsulate_init_fn ml_kem_decapsulate_init;
+static OSSL_FUNC_kem_decapsulate_fn ml_kem_decapsulate;
+static OSSL_FUNC_kem_freectx_fn ml_kem_freectx;
+static OSSL_FUNC_kem_dupctx_fn ml_kem_dupctx;
+static OSSL_FUNC_kem_set_ctx_params_fn ml_kem_set_ctx_params;
+static OSSL_FUNC_kem_settable_ctx_params_fn ml_kem_settable_ctx_params;
+
+/*
+ * The key is owned by the EVP_PKEY the operation was initialised with,
+ * which outlives the context.
+ */
+typedef struct {
+    OSSL_LIB_CTX *libctx;
+    const ML_KEM_KEY *key;
+    uint8_t entropy[ML_KEM_RANDOM_BYTES];
+    int have_entropy;
+} PROV_ML_KEM_CTX;
+
+static void *ml_kem_newctx(void *provctx)
+{
+    PROV_ML_KEM_CTX *ctx;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    if ((ctx = OPENSSL_zalloc(sizeof(*ctx))) == NULL)
+        return NULL;
+    ctx->libctx = PROV_LIBCTX_OF(provctx);
+    return ctx;
+}
+
+static void ml_kem_freectx(void *vctx)
+{
+    OPENSSL_clear_free(vctx, sizeof(PROV_ML_KEM_CTX));
+}
+
+static void *ml_kem_dupctx(void *vctx)
+{
+    PROV_ML_KEM_CTX *srcctx = vctx;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    return OPENSSL_memdup(srcctx, sizeof(*srcctx));
+}
+
+static int ml_kem_init(void *vctx, void *vkey, const OSSL_PARAM params[])
+{
+    PROV_ML_KEM_CTX *ctx = vctx;
+
+    if (!ossl_prov_is_running() || ctx == NULL || vkey == NULL)
+        return 0;
+    ctx->key = vkey;
+    ctx->have_entropy = 0;
+    return ml_kem_set_ctx_params(ctx, params);
+}
+
+static int ml_kem_encapsulate_init(void *vctx, void *vkey,
+                                   const OSSL_PARAM params[])
+{
+    if (!ossl_ml_kem_have_pubkey(vkey)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PUBLIC_KEY);
+        return 0;
+    }
+    return ml_kem_init(vctx, vkey, params);
+}
+
+static int ml_kem_decapsulate_init(void *vctx, void *vkey,
+                                   const OSSL_PARAM params[])
+{
+    if (!ossl_ml_kem_have_prvkey(vkey)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PRIVATE_KEY);
+        return 0;
+    }
+    return ml_kem_init(vctx, vkey, params);
+}
+
+static int ml_kem_set_ctx_params(void *vctx, const OSSL_PARAM params[])
+{
+    PROV_ML_KEM_CTX *ctx = vctx;
+    const OSSL_PARAM *p;
+
+    if (ctx == NULL)
+        return 0;
+    if (params == NULL)
+        return 1;
+
+    /* Encapsulation entropy, for known answer tests */
+    p = OSSL_PARAM_locate_const(params, OSSL_KEM_PARAM_IKME);
+    if (p != NULL) {
+        void *entropy = ctx->entropy;
+        size_t len = 0;
+
+        ctx->have_entropy = 0;
+        if (p->data == NULL || p->data_size == 0)
+            return 1;
+        if (!OSSL_PARAM_get_octet_string(p, &entropy, sizeof(ctx->entropy),
+                                         &len)
+                || len != sizeof(ctx->entropy)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH);
+            return 0;
+        }
+        ctx->have_entropy = 1;
+    }
+    return 1;
+}
+
+static const OSSL_PARAM known_settable_ml_kem_ctx_params[] = {
+    OSSL_PARAM_octet_string(OSSL_KEM_PARAM_IKME, NULL, 0),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *ml_kem_settable_ctx_params(ossl_unused void *vctx,
+                                                   ossl_unused void *provctx)
+{
+    return known_settable_ml_kem_ctx_params;
+}
+
+static int ml_kem_encapsulate(void *vctx, unsigned char *out, size_t *outlen,
+                              unsigned char *secret, size_t *secretlen)
+{
+    PROV_ML_KEM_CTX *ctx = vctx;
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(ctx->key);
+    int ret;
+
+    if (out == NULL) {
+        if (outlen == NULL && secretlen == NULL)
+            return 0;
+        if (outlen != NULL)
+            *outlen = vinfo->ctext_bytes;
+        if (secretlen != NULL)
+            *secretlen = ML_KEM_SHARED_SECRET_BYTES;
+        return 1;
+    }
+    if (secret == NULL || *secretlen < ML_KEM_SHARED_SECRET_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*secretlen too small");
+        return 0;
+    }
+    if (*outlen < vinfo->ctext_bytes) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*outlen too small");
+        return 0;
+    }
+
+    if (ctx->have_entropy)
+        ret = ossl_ml_kem_encap_seed(out, vinfo->ctext_bytes,
+                                     secret, ML_KEM_SHARED_SECRET_BYTES,
+                                     ctx->entropy, sizeof(ctx->entropy),
+                                     ctx->key);
+    else
+        ret = ossl_ml_kem_encap_rand(out, vinfo->ctext_bytes,
+                                     secret, ML_KEM_SHARED_SECRET_BYTES,
+                                     ctx->key);
+    if (!ret)
+        return 0;
+    *outlen = vinfo->ctext_bytes;
+    *secretlen = ML_KEM_SHARED_SECRET_BYTES;
+    return 1;
+}
+
+/*
+ * A well formed ciphertext never fails to decapsulate: tampered ones yield
+ * the implicit rejection secret instead.
+ */
+static int ml_kem_decapsulate(void *vctx, unsigned char *out, size_t *outlen,
+                              const unsigned char *in, size_t inlen)
+{
+    PROV_ML_KEM_CTX *ctx = vctx;
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(ctx->key);
+
+    if (out == NULL) {
+        if (outlen == NULL)
+            return 0;
+        *outlen = ML_KEM_SHARED_SECRET_BYTES;
+        return 1;
+    }
+    if (*outlen < ML_KEM_SHARED_SECRET_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*outlen too small");
+        return 0;
+    }
+    if (inlen != vinfo->ctext_bytes) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH,
+                       "ciphertext length is %zu, should be %zu",
+                       inlen, vinfo->ctext_bytes);
+        return 0;
+    }
+    if (!ossl_ml_kem_decap(out, ML_KEM_SHARED_SECRET_BYTES, in, inlen,
+                           ctx->key))
+        return 0;
+    *outlen = ML_KEM_SHARED_SECRET_BYTES;
+    return 1;
+}
+
+const OSSL_DISPATCH ossl_ml_kem_asym_kem_functions[] = {
+    { OSSL_FUNC_KEM_NEWCTX, (void (*)(void))ml_kem_newctx },
+    { OSSL_FUNC_KEM_ENCAPSULATE_INIT,
+      (void (*)(void))ml_kem_encapsulate_init },
+    { OSSL_FUNC_KEM_ENCAPSULATE, (void (*)(void))ml_kem_encapsulate },
+    { OSSL_FUNC_KEM_DECAPSULATE_INIT,
+      (void (*)(void))ml_kem_decapsulate_init },
+    { OSSL_FUNC_KEM_DECAPSULATE, (void (*)(void))ml_kem_decapsulate },
+    { OSSL_FUNC_KEM_FREECTX, (void (*)(void))ml_kem_freectx },
+    { OSSL_FUNC_KEM_DUPCTX, (void (*)(void))ml_kem_dupctx },
+    { OSSL_FUNC_KEM_SET_CTX_PARAMS,
+      (void (*)(void))ml_kem_set_ctx_params },
+    { OSSL_FUNC_KEM_SETTABLE_CTX_PARAMS,
+      (void (*)(void))ml_kem_settable_ctx_params },
+    { 0, NULL }
+};
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/* The X25519MLKEM768 hybrid KEM, see prov/mlx_kem.h for the encodings */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#include <openssl/err.h>
+#include <openssl/proverr.h>
+#include <openssl/rand.h>
+#include "prov/provider_ctx.h"
+#include "prov/implementations.h"
+#include "prov/providercommon.h"
+#include "prov/mlx_kem.h"
+
+static OSSL_FUNC_kem_newctx_fn mlx_kem_newctx;
+static OSSL_FUNC_kem_encapsulate_init_fn mlx_kem_encapsulate_init;
+static OSSL_FUNC_kem_encapsulate_fn mlx_kem_encapsulate;
+static OSSL_FUNC_kem_decapsulate_init_fn mlx_kem_decapsulate_init;
+static OSSL_FUNC_kem_decapsulate_fn mlx_kem_decapsulate;
+static OSSL_FUNC_kem_freectx_fn mlx_kem_freectx;
+static OSSL_FUNC_kem_dupctx_fn mlx_kem_dupctx;
+
+typedef struct {
+    OSSL_LIB_CTX *libctx;
+    const MLX_KEY *key;
+} PROV_MLX_KEM_CTX;
+
+static void *mlx_kem_newctx(void *provctx)
+{
+    PROV_MLX_KEM_CTX *ctx;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    if ((ctx = OPENSSL_zalloc(sizeof(*ctx))) == NULL)
+        return NULL;
+    ctx->libctx = PROV_LIBCTX_OF(provctx);
+    return ctx;
+}
+
+static void mlx_kem_freectx(void *vctx)
+{
+    OPENSSL_free(vctx);
+}
+
+static void *mlx_kem_dupctx(void *vctx)
+{
+    PROV_MLX_KEM_CTX *srcctx = vctx;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+    return OPENSSL_memdup(srcctx, sizeof(*srcctx));
+}
+
+static int mlx_kem_encapsulate_init(void *vctx, void *vkey,
+                                    ossl_unused const OSSL_PARAM params[])
+{
+    PROV_MLX_KEM_CTX *ctx = vctx;
+    const MLX_KEY *key = vkey;
+
+    if (!ossl_prov_is_running() || ctx == NULL || key == NULL)
+        return 0;
+    if (!ossl_ml_kem_have_pubkey(key->mkey) || !key->xkey->haspubkey) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PUBLIC_KEY);
+        return 0;
+    }
+    ctx->key = key;
+    return 1;
+}
+
+static int mlx_kem_decapsulate_init(void *vctx, void *vkey,
+                                    ossl_unused const OSSL_PARAM params[])
+{
+    PROV_MLX_KEM_CTX *ctx = vctx;
+    const MLX_KEY *key = vkey;
+
+    if (!ossl_prov_is_running() || ctx == NULL || key == NULL)
+        return 0;
+    if (!ossl_ml_kem_have_prvkey(key->mkey) || key->xkey->privkey == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_NOT_A_PRIVATE_KEY);
+        return 0;
+    }
+    ctx->key = key;
+    return 1;
+}
+
+/*
+ * The X25519 half is an ephemeral-static DH, whose public value goes out
+ * after the ML-KEM ciphertext.
+ */
+static int mlx_kem_encapsulate(void *vctx, unsigned char *out, size_t *outlen,
+                               unsigned char *secret, size_t *secretlen)
+{
+    PROV_MLX_KEM_CTX *ctx = vctx;
+    uint8_t eprv[X25519_KEYLEN];
+    int ret = 0;
+
+    if (out == NULL) {
+        if (outlen == NULL && secretlen == NULL)
+            return 0;
+        if (outlen != NULL)
+            *outlen = MLX_KEM_CIPHERTEXT_BYTES;
+        if (secretlen != NULL)
+            *secretlen = MLX_KEM_SHARED_SECRET_BYTES;
+        return 1;
+    }
+    if (secret == NULL || *secretlen < MLX_KEM_SHARED_SECRET_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*secretlen too small");
+        return 0;
+    }
+    if (*outlen < MLX_KEM_CIPHERTEXT_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*outlen too small");
+        return 0;
+    }
+
+    if (!ossl_ml_kem_encap_rand(out, ML_KEM_768_CIPHERTEXT_BYTES,
+                                secret, ML_KEM_SHARED_SECRET_BYTES,
+                                ctx->key->mkey)
+        || RAND_priv_bytes_ex(ctx->libctx, eprv, sizeof(eprv), 0) <= 0)
+        goto err;
+    eprv[0] &= 248;
+    eprv[X25519_KEYLEN - 1] &= 127;
+    eprv[X25519_KEYLEN - 1] |= 64;
+    ossl_x25519_public_from_private(out + ML_KEM_768_CIPHERTEXT_BYTES, eprv);
+    if (!ossl_x25519(secret + ML_KEM_SHARED_SECRET_BYTES, eprv,
+                     ctx->key->xkey->pubkey)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_DURING_DERIVATION);
+        goto err;
+    }
+    *outlen = MLX_KEM_CIPHERTEXT_BYTES;
+    *secretlen = MLX_KEM_SHARED_SECRET_BYTES;
+    ret = 1;
+ err:
+    OPENSSL_cleanse(eprv, sizeof(eprv));
+    if (!ret)
+        OPENSSL_cleanse(secret, MLX_KEM_SHARED_SECRET_BYTES);
+    return ret;
+}
+
+static int mlx_kem_decapsulate(void *vctx, unsigned char *out, size_t *outlen,
+                               const unsigned char *in, size_t inlen)
+{
+    PROV_MLX_KEM_CTX *ctx = vctx;
+
+    if (out == NULL) {
+        if (outlen == NULL)
+            return 0;
+        *outlen = MLX_KEM_SHARED_SECRET_BYTES;
+        return 1;
+    }
+    if (*outlen < MLX_KEM_SHARED_SECRET_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_BAD_LENGTH, "*outlen too small");
+        return 0;
+    }
+    if (inlen != MLX_KEM_CIPHERTEXT_BYTES) {
+        ERR_raise_data(ERR_LIB_PROV, PROV_R_INVALID_INPUT_LENGTH,
+                       "ciphertext length is %zu, should be %d",
+                       inlen, MLX_KEM_CIPHERTEXT_BYTES);
+        return 0;
+    }
+
+    if (!ossl_ml_kem_decap(out, ML_KEM_SHARED_SECRET_BYTES,
+                           in, ML_KEM_768_CIPHERTEXT_BYTES, ctx->key->mkey))
+        return 0;
+    if (!ossl_x25519(out + ML_KEM_SHARED_SECRET_BYTES, ctx->key->xkey->privkey,
+                     in + ML_KEM_768_CIPHERTEXT_BYTES)) {
+        OPENSSL_cleanse(out, MLX_KEM_SHARED_SECRET_BYTES);
+        ERR_raise(ERR_LIB_PROV, PROV_R_FAILED_DURING_DERIVATION);
+        return 0;
+    }
+    *outlen = MLX_KEM_SHARED_SECRET_BYTES;
+    return 1;
+}
+
+const OSSL_DISPATCH ossl_mlx_kem_asym_kem_functions[] = {
+    { OSSL_FUNC_KEM_NEWCTX, (void (*)(void))mlx_kem_newctx },
+    { OSSL_FUNC_KEM_ENCAPSULATE_INIT,
+      (void (*)(void))mlx_kem_encapsulate_init },
+    { OSSL_FUNC_KEM_ENCAPSULATE, (void (*)(void))mlx_kem_encapsulate },
+    { OSSL_FUNC_KEM_DECAPSULATE_INIT,
+      (void (*)(void))mlx_kem_decapsulate_init },
+    { OSSL_FUNC_KEM_DECAPSULATE, (void (*)(void))mlx_kem_decapsulate },
+    { OSSL_FUNC_KEM_FREECTX, (void (*)(void))mlx_kem_freectx },
+    { OSSL_FUNC_KEM_DUPCTX, (void (*)(void))mlx_kem_dupctx },
+    { 0, NULL }
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -328,6 +328,13 @@ static int x448_get_params(void *key, OSSL_PARAM params[])
 
 static int ed25519_get_params(void *key, OSSL_PARAM params[])
 {
+    ECX_KEY *ecxkey = key;
+    OSSL_PARAM *p;
+
+    if ((p = OSSL_PARAM_locate(params,
+                               OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY)) != NULL
+        && !OSSL_PARAM_set_int(p, ecxkey->precompute_verify))
+        return 0;
     return ecx_get_params(key, params, ED25519_BITS, ED25519_SECURITY_BITS,
                           ED25519_SIGSIZE)
         && ed_get_params(key, params);
@@ -358,6 +365,15 @@ static const OSSL_PARAM ed_gettable_params[] = {
     OSSL_PARAM_END
 };
 
+static const OSSL_PARAM ed25519_gettable_params_list[] = {
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY, NULL),
+    ECX_KEY_TYPES(),
+    OSSL_PARAM_END
+};
+
 static const OSSL_PARAM *x25519_gettable_params(void *provctx)
 {
     return ecx_gettable_params;
@@ -370,7 +386,7 @@ static const OSSL_PARAM *x448_gettable_params(void *provctx)
 
 static const OSSL_PARAM *ed25519_gettable_params(void *provctx)
 {
-    return ed_gettable_params;
+    return ed25519_gettable_params_list;
 }
 
 static const OSSL_PARAM *ed448_gettable_params(void *provctx)
@@ -432,6 +448,16 @@ static int x448_set_params(void *key, const OSSL_PARAM params[])
 
 static int ed25519_set_params(void *key, const OSSL_PARAM params[])
 {
+    ECX_KEY *ecxkey = key;
+    const OSSL_PARAM *p;
+
+    if (params == NULL)
+        return 1;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY);
+    if (p != NULL && !OSSL_PARAM_get_int(p, &ecxkey->precompute_verify))
+        return 0;
+
     return 1;
 }
 
@@ -446,6 +472,11 @@ static const OSSL_PARAM ecx_settable_params[] = {
     OSSL_PARAM_END
 };
 
+static const OSSL_PARAM ed25519_settable_params_list[] = {
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY, NULL),
+    OSSL_PARAM_END
+};
+
 static const OSSL_PARAM ed_settable_params[] = {
     OSSL_PARAM_END
 };
@@ -462,7 +493,7 @@ static const OSSL_PARAM *x448_settable_params(void *provctx)
 
 static const OSSL_PARAM *ed25519_settable_params(void *provctx)
 {
-    return ed_settable_params;
+    return ed25519_settable_params_list;
 }
 
 static const OSSL_PARAM *ed448_settable_params(void *provctx)
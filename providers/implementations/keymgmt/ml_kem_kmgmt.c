@@ -0,0 +1,562 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <string.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#include <openssl/err.h>
+#include <openssl/proverr.h>
+#include <openssl/param_build.h>
+#include "internal/param_build_set.h"
+#include "crypto/ml_kem.h"
+#include "prov/implementations.h"
+#include "prov/providercommon.h"
+#include "prov/provider_ctx.h"
+
+static OSSL_FUNC_keymgmt_new_fn ml_kem_512_new;
+static OSSL_FUNC_keymgmt_new_fn ml_kem_768_new;
+static OSSL_FUNC_keymgmt_new_fn ml_kem_1024_new;
+static OSSL_FUNC_keymgmt_gen_init_fn ml_kem_512_gen_init;
+static OSSL_FUNC_keymgmt_gen_init_fn ml_kem_768_gen_init;
+static OSSL_FUNC_keymgmt_gen_init_fn ml_kem_1024_gen_init;
+static OSSL_FUNC_keymgmt_gen_fn ml_kem_gen;
+static OSSL_FUNC_keymgmt_gen_cleanup_fn ml_kem_gen_cleanup;
+static OSSL_FUNC_keymgmt_gen_set_params_fn ml_kem_gen_set_params;
+static OSSL_FUNC_keymgmt_gen_settable_params_fn ml_kem_gen_settable_params;
+static OSSL_FUNC_keymgmt_load_fn ml_kem_load;
+static OSSL_FUNC_keymgmt_get_params_fn ml_kem_get_params;
+static OSSL_FUNC_keymgmt_gettable_params_fn ml_kem_gettable_params;
+static OSSL_FUNC_keymgmt_set_params_fn ml_kem_set_params;
+static OSSL_FUNC_keymgmt_settable_params_fn ml_kem_settable_params;
+static OSSL_FUNC_keymgmt_has_fn ml_kem_has;
+static OSSL_FUNC_keymgmt_match_fn ml_kem_match;
+static OSSL_FUNC_keymgmt_validate_fn ml_kem_validate;
+static OSSL_FUNC_keymgmt_import_fn ml_kem_import;
+static OSSL_FUNC_keymgmt_import_types_fn ml_kem_imexport_types;
+static OSSL_FUNC_keymgmt_export_fn ml_kem_export;
+static OSSL_FUNC_keymgmt_export_types_fn ml_kem_imexport_types;
+static OSSL_FUNC_keymgmt_dup_fn ml_kem_dup;
+
+#define ML_KEM_POSSIBLE_SELECTIONS (OSSL_KEYMGMT_SELECT_KEYPAIR)
+
+struct ml_kem_gen_ctx {
+    OSSL_LIB_CTX *libctx;
+    int variant;
+    int selection;
+    uint8_t seed[ML_KEM_SEED_BYTES];
+    int have_seed;
+};
+
+static void *ml_kem_new(void *provctx, int variant)
+{
+    if (!ossl_prov_is_running())
+        return NULL;
+    return ossl_ml_kem_key_new(PROV_LIBCTX_OF(provctx), variant);
+}
+
+static void *ml_kem_512_new(void *provctx)
+{
+    return ml_kem_new(provctx, ML_KEM_512);
+}
+
+static void *ml_kem_768_new(void *provctx)
+{
+    return ml_kem_new(provctx, ML_KEM_768);
+}
+
+static void *ml_kem_1024_new(void *provctx)
+{
+    return ml_kem_new(provctx, ML_KEM_1024);
+}
+
+static void ml_kem_free(void *keydata)
+{
+    ossl_ml_kem_key_free(keydata);
+}
+
+static int ml_kem_has(const void *keydata, int selection)
+{
+    const ML_KEM_KEY *key = keydata;
+    int ok = 0;
+
+    if (ossl_prov_is_running() && key != NULL) {
+        /* There are no domain parameters beyond the variant */
+        ok = 1;
+
+        if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0)
+            ok = ok && ossl_ml_kem_have_pubkey(key);
+        if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0)
+            ok = ok && ossl_ml_kem_have_prvkey(key);
+    }
+    return ok;
+}
+
+/* The public key is part of every private key, so it decides both */
+static int ml_kem_match(const void *keydata1, const void *keydata2,
+                        int selection)
+{
+    const ML_KEM_KEY *key1 = keydata1;
+    const ML_KEM_KEY *key2 = keydata2;
+    int ok = 1;
+
+    if (!ossl_prov_is_running())
+        return 0;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_DOMAIN_PARAMETERS) != 0)
+        ok = ok && ossl_ml_kem_key_vinfo(key1) == ossl_ml_kem_key_vinfo(key2);
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0)
+        ok = ok && ossl_ml_kem_pubkey_cmp(key1, key2);
+    return ok;
+}
+
+/*
+ * A seed takes precedence over the other key material, which must then
+ * match the key generated from it.
+ */
+static int ml_kem_key_fromdata(ML_KEM_KEY *key, const OSSL_PARAM params[],
+                               int include_private)
+{
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(key);
+    const OSSL_PARAM *pub, *prv = NULL, *seed = NULL;
+    const void *pubdata = NULL, *prvdata = NULL, *seeddata = NULL;
+    size_t publen = 0, prvlen = 0, seedlen = 0;
+    uint8_t *buf = NULL;
+    int ret = 0;
+
+    pub = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PUB_KEY);
+    if (include_private) {
+        prv = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PRIV_KEY);
+        seed = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_ML_KEM_SEED);
+    }
+    if (pub == NULL && prv == NULL && seed == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_MISSING_KEY);
+        return 0;
+    }
+    if ((pub != NULL
+         && !OSSL_PARAM_get_octet_string_ptr(pub, &pubdata, &publen))
+        || (prv != NULL
+            && !OSSL_PARAM_get_octet_string_ptr(prv, &prvdata, &prvlen))
+        || (seed != NULL
+            && !OSSL_PARAM_get_octet_string_ptr(seed, &seeddata, &seedlen)))
+        return 0;
+    if ((pub != NULL && publen != vinfo->pubkey_bytes)
+        || (prv != NULL && prvlen != vinfo->prvkey_bytes)
+        || (seed != NULL && seedlen != ML_KEM_SEED_BYTES)) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+        return 0;
+    }
+
+    if ((buf = OPENSSL_malloc(vinfo->prvkey_bytes)) == NULL)
+        return 0;
+    if (seed != NULL) {
+        if (!ossl_ml_kem_set_seed(seeddata, seedlen, key)
+            || !ossl_ml_kem_genkey(key)
+            || (prv != NULL
+                && (!ossl_ml_kem_encode_private_key(buf, prvlen, key)
+                    || memcmp(buf, prvdata, prvlen) != 0)))
+            goto err;
+    } else if (prv != NULL) {
+        if (!ossl_ml_kem_parse_private_key(prvdata, prvlen, key))
+            goto err;
+    } else if (!ossl_ml_kem_parse_public_key(pubdata, publen, key)) {
+        goto err;
+    }
+    /* A public key given with the private key material must match it */
+    if ((seed != NULL || prv != NULL) && pub != NULL
+        && (!ossl_ml_kem_encode_public_key(buf, publen, key)
+            || memcmp(buf, pubdata, publen) != 0))
+        goto err;
+    ret = 1;
+ err:
+    if (!ret)
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+    OPENSSL_clear_free(buf, vinfo->prvkey_bytes);
+    return ret;
+}
+
+static int ml_kem_import(void *keydata, int selection,
+                         const OSSL_PARAM params[])
+{
+    ML_KEM_KEY *key = keydata;
+    int include_private;
+
+    if (!ossl_prov_is_running() || key == NULL)
+        return 0;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return 0;
+
+    include_private = selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY ? 1 : 0;
+    return ml_kem_key_fromdata(key, params, include_private);
+}
+
+/*
+ * The encodings are written to |buf|, which must have room for the public
+ * key, the private key and the seed, and stay live until |tmpl| is turned
+ * into parameters.
+ */
+static int key_to_params(const ML_KEM_KEY *key, OSSL_PARAM_BLD *tmpl,
+                         OSSL_PARAM params[], int include_private,
+                         uint8_t *buf)
+{
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(key);
+    uint8_t *prv = buf + vinfo->pubkey_bytes;
+    uint8_t *seed = prv + vinfo->prvkey_bytes;
+
+    if (!ossl_ml_kem_have_pubkey(key))
+        return 1;
+    if (!ossl_ml_kem_encode_public_key(buf, vinfo->pubkey_bytes, key)
+        || !ossl_param_build_set_octet_string(tmpl, params,
+                                              OSSL_PKEY_PARAM_PUB_KEY,
+                                              buf, vinfo->pubkey_bytes))
+        return 0;
+    if (!include_private || !ossl_ml_kem_have_prvkey(key))
+        return 1;
+    if (!ossl_ml_kem_encode_private_key(prv, vinfo->prvkey_bytes, key)
+        || !ossl_param_build_set_octet_string(tmpl, params,
+                                              OSSL_PKEY_PARAM_PRIV_KEY,
+                                              prv, vinfo->prvkey_bytes))
+        return 0;
+    if (ossl_ml_kem_have_seed(key)
+        && (!ossl_ml_kem_encode_seed(seed, ML_KEM_SEED_BYTES, key)
+            || !ossl_param_build_set_octet_string(tmpl, params,
+                                                  OSSL_PKEY_PARAM_ML_KEM_SEED,
+                                                  seed, ML_KEM_SEED_BYTES)))
+        return 0;
+    return 1;
+}
+
+static size_t key_to_params_bufsize(const ML_KEM_KEY *key)
+{
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(key);
+
+    return vinfo->pubkey_bytes + vinfo->prvkey_bytes + ML_KEM_SEED_BYTES;
+}
+
+static int ml_kem_export(void *keydata, int selection, OSSL_CALLBACK *param_cb,
+                         void *cbarg)
+{
+    ML_KEM_KEY *key = keydata;
+    OSSL_PARAM_BLD *tmpl;
+    OSSL_PARAM *params = NULL;
+    uint8_t *buf = NULL;
+    size_t buflen;
+    int ret = 0;
+
+    if (!ossl_prov_is_running() || key == NULL)
+        return 0;
+
+    tmpl = OSSL_PARAM_BLD_new();
+    if (tmpl == NULL)
+        return 0;
+    buflen = key_to_params_bufsize(key);
+    if ((buf = OPENSSL_secure_malloc(buflen)) == NULL)
+        goto err;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0) {
+        int include_private = ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0);
+
+        if (!key_to_params(key, tmpl, NULL, include_private, buf))
+            goto err;
+    }
+
+    params = OSSL_PARAM_BLD_to_param(tmpl);
+    if (params == NULL)
+        goto err;
+
+    ret = param_cb(params, cbarg);
+    OSSL_PARAM_free(params);
+err:
+    OPENSSL_secure_clear_free(buf, buflen);
+    OSSL_PARAM_BLD_free(tmpl);
+    return ret;
+}
+
+#define ML_KEM_KEY_TYPES()                                                     \
+OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),                     \
+OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0),                    \
+OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ML_KEM_SEED, NULL, 0)
+
+static const OSSL_PARAM ml_kem_key_types[] = {
+    ML_KEM_KEY_TYPES(),
+    OSSL_PARAM_END
+};
+static const OSSL_PARAM *ml_kem_imexport_types(int selection)
+{
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0)
+        return ml_kem_key_types;
+    return NULL;
+}
+
+static int ml_kem_get_params(void *keydata, OSSL_PARAM params[])
+{
+    ML_KEM_KEY *key = keydata;
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(key);
+    OSSL_PARAM *p;
+    uint8_t *buf;
+    size_t buflen;
+    int ret;
+
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, vinfo->bits))
+        return 0;
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_SECURITY_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, vinfo->secbits))
+        return 0;
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_MAX_SIZE)) != NULL
+        && !OSSL_PARAM_set_int(p, (int)vinfo->ctext_bytes))
+        return 0;
+
+    buflen = key_to_params_bufsize(key);
+    if ((buf = OPENSSL_secure_malloc(buflen)) == NULL)
+        return 0;
+    ret = key_to_params(key, NULL, params, 1, buf);
+    p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+    if (ret && p != NULL && ossl_ml_kem_have_pubkey(key))
+        ret = OSSL_PARAM_set_octet_string(p, buf, vinfo->pubkey_bytes);
+    OPENSSL_secure_clear_free(buf, buflen);
+    return ret;
+}
+
+static const OSSL_PARAM ml_kem_gettable_params_list[] = {
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+    OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+    ML_KEM_KEY_TYPES(),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *ml_kem_gettable_params(void *provctx)
+{
+    return ml_kem_gettable_params_list;
+}
+
+/* Only used by TLS, which sets the peer's public key on an empty key */
+static int ml_kem_set_params(void *keydata, const OSSL_PARAM params[])
+{
+    ML_KEM_KEY *key = keydata;
+    const OSSL_PARAM *p;
+    const void *pub;
+    size_t publen;
+
+    if (params == NULL)
+        return 1;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_octet_string_ptr(p, &pub, &publen))
+            return 0;
+        if (ossl_ml_kem_have_pubkey(key)
+            || !ossl_ml_kem_parse_public_key(pub, publen, key)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static const OSSL_PARAM ml_kem_settable_params_list[] = {
+    OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *ml_kem_settable_params(void *provctx)
+{
+    return ml_kem_settable_params_list;
+}
+
+static void *ml_kem_gen_init(void *provctx, int selection,
+                             const OSSL_PARAM params[], int variant)
+{
+    struct ml_kem_gen_ctx *gctx = NULL;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+
+    if ((gctx = OPENSSL_zalloc(sizeof(*gctx))) != NULL) {
+        gctx->libctx = PROV_LIBCTX_OF(provctx);
+        gctx->variant = variant;
+        gctx->selection = selection;
+    }
+    if (!ml_kem_gen_set_params(gctx, params)) {
+        OPENSSL_free(gctx);
+        gctx = NULL;
+    }
+    return gctx;
+}
+
+static void *ml_kem_512_gen_init(void *provctx, int selection,
+                                 const OSSL_PARAM params[])
+{
+    return ml_kem_gen_init(provctx, selection, params, ML_KEM_512);
+}
+
+static void *ml_kem_768_gen_init(void *provctx, int selection,
+                                 const OSSL_PARAM params[])
+{
+    return ml_kem_gen_init(provctx, selection, params, ML_KEM_768);
+}
+
+static void *ml_kem_1024_gen_init(void *provctx, int selection,
+                                  const OSSL_PARAM params[])
+{
+    return ml_kem_gen_init(provctx, selection, params, ML_KEM_1024);
+}
+
+static int ml_kem_gen_set_params(void *genctx, const OSSL_PARAM params[])
+{
+    struct ml_kem_gen_ctx *gctx = genctx;
+    const OSSL_PARAM *p;
+
+    if (gctx == NULL)
+        return 0;
+
+    /*
+     * As for X25519 a group name may be given, but it can only name the
+     * variant of the key manager.
+     */
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_GROUP_NAME);
+    if (p != NULL) {
+        const char *name = ossl_ml_kem_get_vinfo(gctx->variant)->algorithm_name;
+
+        if (p->data_type != OSSL_PARAM_UTF8_STRING
+                || OPENSSL_strcasecmp(p->data, name) != 0) {
+            ERR_raise(ERR_LIB_PROV, ERR_R_PASSED_INVALID_ARGUMENT);
+            return 0;
+        }
+    }
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_ML_KEM_SEED);
+    if (p != NULL) {
+        void *seed = gctx->seed;
+        size_t seedlen = 0;
+
+        if (!OSSL_PARAM_get_octet_string(p, &seed, sizeof(gctx->seed),
+                                         &seedlen)
+                || seedlen != sizeof(gctx->seed)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_SEED_LENGTH);
+            return 0;
+        }
+        gctx->have_seed = 1;
+    }
+    return 1;
+}
+
+static const OSSL_PARAM *ml_kem_gen_settable_params(ossl_unused void *genctx,
+                                                    ossl_unused void *provctx)
+{
+    static OSSL_PARAM settable[] = {
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, NULL, 0),
+        OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ML_KEM_SEED, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+static void *ml_kem_gen(void *genctx, OSSL_CALLBACK *osslcb, void *cbarg)
+{
+    struct ml_kem_gen_ctx *gctx = genctx;
+    ML_KEM_KEY *key;
+
+    if (!ossl_prov_is_running() || gctx == NULL)
+        return NULL;
+    if ((key = ossl_ml_kem_key_new(gctx->libctx, gctx->variant)) == NULL)
+        return NULL;
+
+    /* If we're doing parameter generation then we just return a blank key */
+    if ((gctx->selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return key;
+
+    if ((gctx->have_seed
+         && !ossl_ml_kem_set_seed(gctx->seed, sizeof(gctx->seed), key))
+        || !ossl_ml_kem_genkey(key)) {
+        ossl_ml_kem_key_free(key);
+        return NULL;
+    }
+    return key;
+}
+
+static void ml_kem_gen_cleanup(void *genctx)
+{
+    OPENSSL_clear_free(genctx, sizeof(struct ml_kem_gen_ctx));
+}
+
+static void *ml_kem_load(const void *reference, size_t reference_sz)
+{
+    ML_KEM_KEY *key = NULL;
+
+    if (ossl_prov_is_running() && reference_sz == sizeof(key)) {
+        /* The contents of the reference is the address to our object */
+        key = *(ML_KEM_KEY **)reference;
+        /* We grabbed, so we detach it */
+        *(ML_KEM_KEY **)reference = NULL;
+        return key;
+    }
+    return NULL;
+}
+
+static void *ml_kem_dup(const void *keydata_from, int selection)
+{
+    if (ossl_prov_is_running())
+        return ossl_ml_kem_key_dup(keydata_from, selection);
+    return NULL;
+}
+
+/*
+ * Keys are checked when they are parsed and private keys always carry
+ * their public key, so there is nothing to validate beyond their presence.
+ */
+static int ml_kem_validate(const void *keydata, int selection, int checktype)
+{
+    const ML_KEM_KEY *key = keydata;
+    int ok = 1;
+
+    if (!ossl_prov_is_running())
+        return 0;
+
+    if ((selection & ML_KEM_POSSIBLE_SELECTIONS) == 0)
+        return 1; /* nothing to validate */
+
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0)
+        ok = ok && ossl_ml_kem_have_pubkey(key);
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0)
+        ok = ok && ossl_ml_kem_have_prvkey(key);
+    return ok;
+}
+
+#define MAKE_KEYMGMT_FUNCTIONS(alg) \
+    const OSSL_DISPATCH ossl_##alg##_keymgmt_functions[] = { \
+        { OSSL_FUNC_KEYMGMT_NEW, (void (*)(void))alg##_new }, \
+        { OSSL_FUNC_KEYMGMT_FREE, (void (*)(void))ml_kem_free }, \
+        { OSSL_FUNC_KEYMGMT_GET_PARAMS, (void (*) (void))ml_kem_get_params }, \
+        { OSSL_FUNC_KEYMGMT_GETTABLE_PARAMS, (void (*) (void))ml_kem_gettable_params }, \
+        { OSSL_FUNC_KEYMGMT_SET_PARAMS, (void (*) (void))ml_kem_set_params }, \
+        { OSSL_FUNC_KEYMGMT_SETTABLE_PARAMS, (void (*) (void))ml_kem_settable_params }, \
+        { OSSL_FUNC_KEYMGMT_HAS, (void (*)(void))ml_kem_has }, \
+        { OSSL_FUNC_KEYMGMT_MATCH, (void (*)(void))ml_kem_match }, \
+        { OSSL_FUNC_KEYMGMT_VALIDATE, (void (*)(void))ml_kem_validate }, \
+        { OSSL_FUNC_KEYMGMT_IMPORT, (void (*)(void))ml_kem_import }, \
+        { OSSL_FUNC_KEYMGMT_IMPORT_TYPES, (void (*)(void))ml_kem_imexport_types }, \
+        { OSSL_FUNC_KEYMGMT_EXPORT, (void (*)(void))ml_kem_export }, \
+        { OSSL_FUNC_KEYMGMT_EXPORT_TYPES, (void (*)(void))ml_kem_imexport_types }, \
+        { OSSL_FUNC_KEYMGMT_GEN_INIT, (void (*)(void))alg##_gen_init }, \
+        { OSSL_FUNC_KEYMGMT_GEN_SET_PARAMS, (void (*)(void))ml_kem_gen_set_params }, \
+        { OSSL_FUNC_KEYMGMT_GEN_SETTABLE_PARAMS, \
+          (void (*)(void))ml_kem_gen_settable_params }, \
+        { OSSL_FUNC_KEYMGMT_GEN, (void (*)(void))ml_kem_gen }, \
+        { OSSL_FUNC_KEYMGMT_GEN_CLEANUP, (void (*)(void))ml_kem_gen_cleanup }, \
+        { OSSL_FUNC_KEYMGMT_LOAD, (void (*)(void))ml_kem_load }, \
+        { OSSL_FUNC_KEYMGMT_DUP, (void (*)(void))ml_kem_dup }, \
+        { 0, NULL } \
+    };
+
+MAKE_KEYMGMT_FUNCTIONS(ml_kem_512)
+MAKE_KEYMGMT_FUNCTIONS(ml_kem_768)
+MAKE_KEYMGMT_FUNCTIONS(ml_kem_1024)
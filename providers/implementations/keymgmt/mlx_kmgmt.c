@@ -0,0 +1,554 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/* Key management for the X25519MLKEM768 hybrid */
+
+#include <string.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#include <openssl/err.h>
+#include <openssl/proverr.h>
+#include <openssl/rand.h>
+#include <openssl/param_build.h>
+#include "internal/param_build_set.h"
+#include "prov/implementations.h"
+#include "prov/providercommon.h"
+#include "prov/provider_ctx.h"
+#include "prov/mlx_kem.h"
+
+static OSSL_FUNC_keymgmt_new_fn mlx_kem_new;
+static OSSL_FUNC_keymgmt_free_fn mlx_kem_free;
+static OSSL_FUNC_keymgmt_gen_init_fn mlx_kem_gen_init;
+static OSSL_FUNC_keymgmt_gen_fn mlx_kem_gen;
+static OSSL_FUNC_keymgmt_gen_cleanup_fn mlx_kem_gen_cleanup;
+static OSSL_FUNC_keymgmt_gen_set_params_fn mlx_kem_gen_set_params;
+static OSSL_FUNC_keymgmt_gen_settable_params_fn mlx_kem_gen_settable_params;
+static OSSL_FUNC_keymgmt_load_fn mlx_kem_load;
+static OSSL_FUNC_keymgmt_get_params_fn mlx_kem_get_params;
+static OSSL_FUNC_keymgmt_gettable_params_fn mlx_kem_gettable_params;
+static OSSL_FUNC_keymgmt_set_params_fn mlx_kem_set_params;
+static OSSL_FUNC_keymgmt_settable_params_fn mlx_kem_settable_params;
+static OSSL_FUNC_keymgmt_has_fn mlx_kem_has;
+static OSSL_FUNC_keymgmt_match_fn mlx_kem_match;
+static OSSL_FUNC_keymgmt_validate_fn mlx_kem_validate;
+static OSSL_FUNC_keymgmt_import_fn mlx_kem_import;
+static OSSL_FUNC_keymgmt_import_types_fn mlx_kem_imexport_types;
+static OSSL_FUNC_keymgmt_export_fn mlx_kem_export;
+static OSSL_FUNC_keymgmt_export_types_fn mlx_kem_imexport_types;
+static OSSL_FUNC_keymgmt_dup_fn mlx_kem_dup;
+
+#define MLX_KEM_POSSIBLE_SELECTIONS (OSSL_KEYMGMT_SELECT_KEYPAIR)
+#define MLX_KEM_NAME                "X25519MLKEM768"
+
+struct mlx_kem_gen_ctx {
+    OSSL_LIB_CTX *libctx;
+    int selection;
+};
+
+static void mlx_kem_key_free(MLX_KEY *key)
+{
+    if (key == NULL)
+        return;
+    ossl_ml_kem_key_free(key->mkey);
+    ossl_ecx_key_free(key->xkey);
+    OPENSSL_free(key);
+}
+
+static MLX_KEY *mlx_kem_key_new(OSSL_LIB_CTX *libctx)
+{
+    MLX_KEY *key = OPENSSL_zalloc(sizeof(*key));
+
+    if (key == NULL)
+        return NULL;
+    key->libctx = libctx;
+    key->mkey = ossl_ml_kem_key_new(libctx, ML_KEM_768);
+    key->xkey = ossl_ecx_key_new(libctx, ECX_KEY_TYPE_X25519, 0, NULL);
+    if (key->mkey == NULL || key->xkey == NULL) {
+        mlx_kem_key_free(key);
+        return NULL;
+    }
+    return key;
+}
+
+static void *mlx_kem_new(void *provctx)
+{
+    if (!ossl_prov_is_running())
+        return NULL;
+    return mlx_kem_key_new(PROV_LIBCTX_OF(provctx));
+}
+
+static void mlx_kem_free(void *keydata)
+{
+    mlx_kem_key_free(keydata);
+}
+
+static int mlx_have_pubkey(const MLX_KEY *key)
+{
+    return ossl_ml_kem_have_pubkey(key->mkey) && key->xkey->haspubkey;
+}
+
+static int mlx_have_prvkey(const MLX_KEY *key)
+{
+    return ossl_ml_kem_have_prvkey(key->mkey) && key->xkey->privkey != NULL;
+}
+
+static int mlx_kem_has(const void *keydata, int selection)
+{
+    const MLX_KEY *key = keydata;
+    int ok = 0;
+
+    if (ossl_prov_is_running() && key != NULL) {
+        ok = 1;
+
+        if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0)
+            ok = ok && mlx_have_pubkey(key);
+        if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0)
+            ok = ok && mlx_have_prvkey(key);
+    }
+    return ok;
+}
+
+static int mlx_kem_match(const void *keydata1, const void *keydata2,
+                         int selection)
+{
+    const MLX_KEY *key1 = keydata1;
+    const MLX_KEY *key2 = keydata2;
+
+    if (!ossl_prov_is_running())
+        return 0;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return 1;
+    return mlx_have_pubkey(key1) && mlx_have_pubkey(key2)
+        && ossl_ml_kem_pubkey_cmp(key1->mkey, key2->mkey)
+        && CRYPTO_memcmp(key1->xkey->pubkey, key2->xkey->pubkey,
+                         X25519_KEYLEN) == 0;
+}
+
+static int mlx_parse_public_key(const uint8_t *in, size_t len, MLX_KEY *key)
+{
+    if (len != MLX_KEM_PUBLIC_KEY_BYTES
+        || !ossl_ml_kem_parse_public_key(in, ML_KEM_768_PUBLIC_KEY_BYTES,
+                                         key->mkey))
+        return 0;
+    memcpy(key->xkey->pubkey, in + ML_KEM_768_PUBLIC_KEY_BYTES,
+           X25519_KEYLEN);
+    key->xkey->haspubkey = 1;
+    return 1;
+}
+
+static void mlx_encode_public_key(uint8_t *out, const MLX_KEY *key)
+{
+    ossl_ml_kem_encode_public_key(out, ML_KEM_768_PUBLIC_KEY_BYTES, key->mkey);
+    memcpy(out + ML_KEM_768_PUBLIC_KEY_BYTES, key->xkey->pubkey,
+           X25519_KEYLEN);
+}
+
+static size_t mlx_prvkey_bytes(const MLX_KEY *key)
+{
+    return ossl_ml_kem_key_vinfo(key->mkey)->prvkey_bytes + X25519_KEYLEN;
+}
+
+/*
+ * The private key is the ML-KEM decapsulation key followed by the X25519
+ * scalar; the public key, when present as well, must match it.
+ */
+static int mlx_kem_key_fromdata(MLX_KEY *key, const OSSL_PARAM params[],
+                                int include_private)
+{
+    const OSSL_PARAM *pub, *prv = NULL;
+    const void *pubdata = NULL, *prvdata = NULL;
+    size_t publen = 0, prvlen = 0;
+    size_t mprvlen = mlx_prvkey_bytes(key) - X25519_KEYLEN;
+    uint8_t buf[MLX_KEM_PUBLIC_KEY_BYTES];
+    unsigned char *xprv;
+
+    pub = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PUB_KEY);
+    if (include_private)
+        prv = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_PRIV_KEY);
+    if (pub == NULL && prv == NULL) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_MISSING_KEY);
+        return 0;
+    }
+    if ((pub != NULL
+         && !OSSL_PARAM_get_octet_string_ptr(pub, &pubdata, &publen))
+        || (prv != NULL
+            && !OSSL_PARAM_get_octet_string_ptr(prv, &prvdata, &prvlen)))
+        return 0;
+    if ((pub != NULL && publen != MLX_KEM_PUBLIC_KEY_BYTES)
+        || (prv != NULL && prvlen != mlx_prvkey_bytes(key))) {
+        ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY_LENGTH);
+        return 0;
+    }
+
+    if (prv == NULL) {
+        if (!mlx_parse_public_key(pubdata, publen, key))
+            goto err;
+        return 1;
+    }
+
+    if (!ossl_ml_kem_parse_private_key(prvdata, mprvlen, key->mkey)
+        || (xprv = ossl_ecx_key_allocate_privkey(key->xkey)) == NULL)
+        goto err;
+    memcpy(xprv, (const uint8_t *)prvdata + mprvlen, X25519_KEYLEN);
+    ossl_x25519_public_from_private(key->xkey->pubkey, xprv);
+    key->xkey->haspubkey = 1;
+    if (pub != NULL) {
+        mlx_encode_public_key(buf, key);
+        if (memcmp(buf, pubdata, publen) != 0)
+            goto err;
+    }
+    return 1;
+ err:
+    ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+    return 0;
+}
+
+static int mlx_kem_import(void *keydata, int selection,
+                          const OSSL_PARAM params[])
+{
+    MLX_KEY *key = keydata;
+    int include_private;
+
+    if (!ossl_prov_is_running() || key == NULL)
+        return 0;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return 0;
+
+    include_private = selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY ? 1 : 0;
+    return mlx_kem_key_fromdata(key, params, include_private);
+}
+
+/*
+ * |buf| must have room for the public and the private key, and stay live
+ * until |tmpl| is turned into parameters.
+ */
+static int key_to_params(const MLX_KEY *key, OSSL_PARAM_BLD *tmpl,
+                         OSSL_PARAM params[], int include_private,
+                         uint8_t *buf)
+{
+    uint8_t *prv = buf + MLX_KEM_PUBLIC_KEY_BYTES;
+    size_t prvlen = mlx_prvkey_bytes(key);
+
+    if (!mlx_have_pubkey(key))
+        return 1;
+    mlx_encode_public_key(buf, key);
+    if (!ossl_param_build_set_octet_string(tmpl, params,
+                                           OSSL_PKEY_PARAM_PUB_KEY,
+                                           buf, MLX_KEM_PUBLIC_KEY_BYTES))
+        return 0;
+    if (!include_private || !mlx_have_prvkey(key))
+        return 1;
+    if (!ossl_ml_kem_encode_private_key(prv, prvlen - X25519_KEYLEN,
+                                        key->mkey))
+        return 0;
+    memcpy(prv + prvlen - X25519_KEYLEN, key->xkey->privkey, X25519_KEYLEN);
+    return ossl_param_build_set_octet_string(tmpl, params,
+                                             OSSL_PKEY_PARAM_PRIV_KEY,
+                                             prv, prvlen);
+}
+
+static size_t key_to_params_bufsize(const MLX_KEY *key)
+{
+    return MLX_KEM_PUBLIC_KEY_BYTES + mlx_prvkey_bytes(key);
+}
+
+static int mlx_kem_export(void *keydata, int selection,
+                          OSSL_CALLBACK *param_cb, void *cbarg)
+{
+    MLX_KEY *key = keydata;
+    OSSL_PARAM_BLD *tmpl;
+    OSSL_PARAM *params = NULL;
+    uint8_t *buf = NULL;
+    size_t buflen;
+    int ret = 0;
+
+    if (!ossl_prov_is_running() || key == NULL)
+        return 0;
+
+    tmpl = OSSL_PARAM_BLD_new();
+    if (tmpl == NULL)
+        return 0;
+    buflen = key_to_params_bufsize(key);
+    if ((buf = OPENSSL_secure_malloc(buflen)) == NULL)
+        goto err;
+
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0) {
+        int include_private = ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0);
+
+        if (!key_to_params(key, tmpl, NULL, include_private, buf))
+            goto err;
+    }
+
+    params = OSSL_PARAM_BLD_to_param(tmpl);
+    if (params == NULL)
+        goto err;
+
+    ret = param_cb(params, cbarg);
+    OSSL_PARAM_free(params);
+err:
+    OPENSSL_secure_clear_free(buf, buflen);
+    OSSL_PARAM_BLD_free(tmpl);
+    return ret;
+}
+
+#define MLX_KEM_KEY_TYPES()                                                    \
+OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PUB_KEY, NULL, 0),                     \
+OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_PRIV_KEY, NULL, 0)
+
+static const OSSL_PARAM mlx_kem_key_types[] = {
+    MLX_KEM_KEY_TYPES(),
+    OSSL_PARAM_END
+};
+static const OSSL_PARAM *mlx_kem_imexport_types(int selection)
+{
+    if ((selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0)
+        return mlx_kem_key_types;
+    return NULL;
+}
+
+static int mlx_kem_get_params(void *keydata, OSSL_PARAM params[])
+{
+    MLX_KEY *key = keydata;
+    const ML_KEM_VINFO *vinfo = ossl_ml_kem_key_vinfo(key->mkey);
+    OSSL_PARAM *p;
+    uint8_t *buf;
+    size_t buflen;
+    int ret;
+
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, vinfo->bits))
+        return 0;
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_SECURITY_BITS)) != NULL
+        && !OSSL_PARAM_set_int(p, vinfo->secbits))
+        return 0;
+    if ((p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_MAX_SIZE)) != NULL
+        && !OSSL_PARAM_set_int(p, MLX_KEM_CIPHERTEXT_BYTES))
+        return 0;
+
+    buflen = key_to_params_bufsize(key);
+    if ((buf = OPENSSL_secure_malloc(buflen)) == NULL)
+        return 0;
+    ret = key_to_params(key, NULL, params, 1, buf);
+    p = OSSL_PARAM_locate(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+    if (ret && p != NULL && mlx_have_pubkey(key))
+        ret = OSSL_PARAM_set_octet_string(p, buf, MLX_KEM_PUBLIC_KEY_BYTES);
+    OPENSSL_secure_clear_free(buf, buflen);
+    return ret;
+}
+
+static const OSSL_PARAM mlx_kem_gettable_params_list[] = {
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_SECURITY_BITS, NULL),
+    OSSL_PARAM_int(OSSL_PKEY_PARAM_MAX_SIZE, NULL),
+    OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+    MLX_KEM_KEY_TYPES(),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *mlx_kem_gettable_params(void *provctx)
+{
+    return mlx_kem_gettable_params_list;
+}
+
+/* Only used by TLS, which sets the peer's key share on an empty key */
+static int mlx_kem_set_params(void *keydata, const OSSL_PARAM params[])
+{
+    MLX_KEY *key = keydata;
+    const OSSL_PARAM *p;
+    const void *pub;
+    size_t publen;
+
+    if (params == NULL)
+        return 1;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY);
+    if (p != NULL) {
+        if (!OSSL_PARAM_get_octet_string_ptr(p, &pub, &publen))
+            return 0;
+        if (ossl_ml_kem_have_pubkey(key->mkey)
+            || !mlx_parse_public_key(pub, publen, key)) {
+            ERR_raise(ERR_LIB_PROV, PROV_R_INVALID_KEY);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static const OSSL_PARAM mlx_kem_settable_params_list[] = {
+    OSSL_PARAM_octet_string(OSSL_PKEY_PARAM_ENCODED_PUBLIC_KEY, NULL, 0),
+    OSSL_PARAM_END
+};
+
+static const OSSL_PARAM *mlx_kem_settable_params(void *provctx)
+{
+    return mlx_kem_settable_params_list;
+}
+
+static void *mlx_kem_gen_init(void *provctx, int selection,
+                              const OSSL_PARAM params[])
+{
+    struct mlx_kem_gen_ctx *gctx = NULL;
+
+    if (!ossl_prov_is_running())
+        return NULL;
+
+    if ((gctx = OPENSSL_zalloc(sizeof(*gctx))) != NULL) {
+        gctx->libctx = PROV_LIBCTX_OF(provctx);
+        gctx->selection = selection;
+    }
+    if (!mlx_kem_gen_set_params(gctx, params)) {
+        OPENSSL_free(gctx);
+        gctx = NULL;
+    }
+    return gctx;
+}
+
+static int mlx_kem_gen_set_params(void *genctx, const OSSL_PARAM params[])
+{
+    struct mlx_kem_gen_ctx *gctx = genctx;
+    const OSSL_PARAM *p;
+
+    if (gctx == NULL)
+        return 0;
+
+    p = OSSL_PARAM_locate_const(params, OSSL_PKEY_PARAM_GROUP_NAME);
+    if (p != NULL) {
+        if (p->data_type != OSSL_PARAM_UTF8_STRING
+                || OPENSSL_strcasecmp(p->data, MLX_KEM_NAME) != 0) {
+            ERR_raise(ERR_LIB_PROV, ERR_R_PASSED_INVALID_ARGUMENT);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static const OSSL_PARAM *mlx_kem_gen_settable_params(ossl_unused void *genctx,
+                                                     ossl_unused void *provctx)
+{
+    static OSSL_PARAM settable[] = {
+        OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, NULL, 0),
+        OSSL_PARAM_END
+    };
+    return settable;
+}
+
+static void *mlx_kem_gen(void *genctx, OSSL_CALLBACK *osslcb, void *cbarg)
+{
+    struct mlx_kem_gen_ctx *gctx = genctx;
+    MLX_KEY *key;
+    unsigned char *xprv;
+
+    if (!ossl_prov_is_running() || gctx == NULL)
+        return NULL;
+    if ((key = mlx_kem_key_new(gctx->libctx)) == NULL)
+        return NULL;
+
+    /* If we're doing parameter generation then we just return a blank key */
+    if ((gctx->selection & OSSL_KEYMGMT_SELECT_KEYPAIR) == 0)
+        return key;
+
+    if (!ossl_ml_kem_genkey(key->mkey)
+        || (xprv = ossl_ecx_key_allocate_privkey(key->xkey)) == NULL
+        || RAND_priv_bytes_ex(gctx->libctx, xprv, X25519_KEYLEN, 0) <= 0) {
+        mlx_kem_key_free(key);
+        return NULL;
+    }
+    xprv[0] &= 248;
+    xprv[X25519_KEYLEN - 1] &= 127;
+    xprv[X25519_KEYLEN - 1] |= 64;
+    ossl_x25519_public_from_private(key->xkey->pubkey, xprv);
+    key->xkey->haspubkey = 1;
+    return key;
+}
+
+static void mlx_kem_gen_cleanup(void *genctx)
+{
+    OPENSSL_free(genctx);
+}
+
+static void *mlx_kem_load(const void *reference, size_t reference_sz)
+{
+    MLX_KEY *key = NULL;
+
+    if (ossl_prov_is_running() && reference_sz == sizeof(key)) {
+        /* The contents of the reference is the address to our object */
+        key = *(MLX_KEY **)reference;
+        /* We grabbed, so we detach it */
+        *(MLX_KEY **)reference = NULL;
+        return key;
+    }
+    return NULL;
+}
+
+static void *mlx_kem_dup(const void *keydata_from, int selection)
+{
+    const MLX_KEY *from = keydata_from;
+    MLX_KEY *key;
+
+    if (!ossl_prov_is_running()
+        || (key = OPENSSL_zalloc(sizeof(*key))) == NULL)
+        return NULL;
+    key->libctx = from->libctx;
+    key->mkey = ossl_ml_kem_key_dup(from->mkey, selection);
+    key->xkey = ossl_ecx_key_dup(from->xkey, selection);
+    if (key->mkey == NULL || key->xkey == NULL) {
+        mlx_kem_key_free(key);
+        return NULL;
+    }
+    return key;
+}
+
+static int mlx_kem_validate(const void *keydata, int selection, int checktype)
+{
+    const MLX_KEY *key = keydata;
+    int ok = 1;
+
+    if (!ossl_prov_is_running())
+        return 0;
+
+    if ((selection & MLX_KEM_POSSIBLE_SELECTIONS) == 0)
+        return 1; /* nothing to validate */
+
+    if ((selection & OSSL_KEYMGMT_SELECT_PUBLIC_KEY) != 0)
+        ok = ok && mlx_have_pubkey(key);
+    if ((selection & OSSL_KEYMGMT_SELECT_PRIVATE_KEY) != 0)
+        ok = ok && mlx_have_prvkey(key);
+    return ok;
+}
+
+const OSSL_DISPATCH ossl_mlx_kem_keymgmt_functions[] = {
+    { OSSL_FUNC_KEYMGMT_NEW, (void (*)(void))mlx_kem_new },
+    { OSSL_FUNC_KEYMGMT_FREE, (void (*)(void))mlx_kem_free },
+    { OSSL_FUNC_KEYMGMT_GET_PARAMS, (void (*) (void))mlx_kem_get_params },
+    { OSSL_FUNC_KEYMGMT_GETTABLE_PARAMS,
+      (void (*) (void))mlx_kem_gettable_params },
+    { OSSL_FUNC_KEYMGMT_SET_PARAMS, (void (*) (void))mlx_kem_set_params },
+    { OSSL_FUNC_KEYMGMT_SETTABLE_PARAMS,
+      (void (*) (void))mlx_kem_settable_params },
+    { OSSL_FUNC_KEYMGMT_HAS, (void (*)(void))mlx_kem_has },
+    { OSSL_FUNC_KEYMGMT_MATCH, (void (*)(void))mlx_kem_match },
+    { OSSL_FUNC_KEYMGMT_VALIDATE, (void (*)(void))mlx_kem_validate },
+    { OSSL_FUNC_KEYMGMT_IMPORT, (void (*)(void))mlx_kem_import },
+    { OSSL_FUNC_KEYMGMT_IMPORT_TYPES, (void (*)(void))mlx_kem_imexport_types },
+    { OSSL_FUNC_KEYMGMT_EXPORT, (void (*)(void))mlx_kem_export },
+    { OSSL_FUNC_KEYMGMT_EXPORT_TYPES, (void (*)(void))mlx_kem_imexport_types },
+    { OSSL_FUNC_KEYMGMT_GEN_INIT, (void (*)(void))mlx_kem_gen_init },
+    { OSSL_FUNC_KEYMGMT_GEN_SET_PARAMS,
+      (void (*)(void))mlx_kem_gen_set_params },
+    { OSSL_FUNC_KEYMGMT_GEN_SETTABLE_PARAMS,
+      (void (*)(void))mlx_kem_gen_settable_params },
+    { OSSL_FUNC_KEYMGMT_GEN, (void (*)(void))mlx_kem_gen },
+    { OSSL_FUNC_KEYMGMT_GEN_CLEANUP, (void (*)(void))mlx_kem_gen_cleanup },
+    { OSSL_FUNC_KEYMGMT_LOAD, (void (*)(void))mlx_kem_load },
+    { OSSL_FUNC_KEYMGMT_DUP, (void (*)(void))mlx_kem_dup },
+    { 0, NULL }
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -44,6 +44,7 @@ static OSSL_FUNC_signature_digest_sign_final_fn ecdsa_digest_sign_final;
 static OSSL_FUNC_signature_digest_verify_init_fn ecdsa_digest_verify_init;
 static OSSL_FUNC_signature_digest_verify_update_fn ecdsa_digest_signverify_update;
 static OSSL_FUNC_signature_digest_verify_final_fn ecdsa_digest_verify_final;
+static OSSL_FUNC_signature_digest_verify_batch_fn ecdsa_digest_verify_batch;
 static OSSL_FUNC_signature_freectx_fn ecdsa_freectx;
 static OSSL_FUNC_signature_dupctx_fn ecdsa_dupctx;
 static OSSL_FUNC_signature_get_ctx_params_fn ecdsa_get_ctx_params;
@@ -380,6 +381,44 @@ int ecdsa_digest_verify_final(void *vctx, const unsigned char *sig,
     return ecdsa_verify(ctx, sig, siglen, digest, (size_t)dlen);
 }
 
+/*
+ * Verify a batch of signatures, hashing each message on a copy of the freshly
+ * initialised digest context.  This saves duplicating the whole signature
+ * context for every message and leaves |vctx| ready for the next batch.
+ */
+static int ecdsa_digest_verify_batch(void *vctx,
+                                     const unsigned char *const *sigs,
+                                     const size_t *siglens,
+                                     const unsigned char *const *tbs,
+                                     const size_t *tbslens, size_t num)
+{
+    PROV_ECDSA_CTX *ctx = (PROV_ECDSA_CTX *)vctx;
+    EVP_MD_CTX *mdctx;
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int dlen = 0;
+    size_t i;
+    int ret = 0;
+
+    if (!ossl_prov_is_running() || ctx == NULL || ctx->mdctx == NULL)
+        return 0;
+
+    if ((mdctx = EVP_MD_CTX_new()) == NULL)
+        return 0;
+
+    for (i = 0; i < num; i++) {
+        if (!EVP_MD_CTX_copy_ex(mdctx, ctx->mdctx)
+                || !EVP_DigestUpdate(mdctx, tbs[i], tbslens[i])
+                || !EVP_DigestFinal_ex(mdctx, digest, &dlen)
+                || ecdsa_verify(ctx, sigs[i], siglens[i], digest,
+                                (size_t)dlen) <= 0)
+            goto err;
+    }
+    ret = 1;
+ err:
+    EVP_MD_CTX_free(mdctx);
+    return ret;
+}
+
 static void ecdsa_freectx(void *vctx)
 {
     PROV_ECDSA_CTX *ctx = (PROV_ECDSA_CTX *)vctx;
@@ -619,6 +658,8 @@ const OSSL_DISPATCH ossl_ecdsa_signature_functions[] = {
       (void (*)(void))ecdsa_digest_signverify_update },
     { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_FINAL,
       (void (*)(void))ecdsa_digest_verify_final },
+    { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_BATCH,
+      (void (*)(void))ecdsa_digest_verify_batch },
     { OSSL_FUNC_SIGNATURE_FREECTX, (void (*)(void))ecdsa_freectx },
     { OSSL_FUNC_SIGNATURE_DUPCTX, (void (*)(void))ecdsa_dupctx },
     { OSSL_FUNC_SIGNATURE_GET_CTX_PARAMS, (void (*)(void))ecdsa_get_ctx_params },
@@ -1,5 +1,5 @@
 /*
- * Copyright 2020-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2020-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -67,6 +67,8 @@ static OSSL_FUNC_signature_digest_sign_fn ed25519_digest_sign;
 static OSSL_FUNC_signature_digest_sign_fn ed448_digest_sign;
 static OSSL_FUNC_signature_digest_verify_fn ed25519_digest_verify;
 static OSSL_FUNC_signature_digest_verify_fn ed448_digest_verify;
+static OSSL_FUNC_signature_digest_verify_batch_fn ed25519_digest_verify_batch;
+static OSSL_FUNC_signature_digest_verify_batch_fn ed448_digest_verify_batch;
 static OSSL_FUNC_signature_freectx_fn eddsa_freectx;
 static OSSL_FUNC_signature_dupctx_fn eddsa_dupctx;
 static OSSL_FUNC_signature_get_ctx_params_fn eddsa_get_ctx_params;
@@ -407,6 +409,7 @@ int ed25519_digest_verify(void *vpeddsactx, const unsigned char *sig,
     }
 
     return ossl_ed25519_verify(tbs, tbslen, sig, edkey->pubkey,
+                               ossl_ecx_key_get0_ed25519_precomp(peddsactx->key),
                                peddsactx->dom2_flag, peddsactx->prehash_flag, peddsactx->context_string_flag,
                                peddsactx->context_string, peddsactx->context_string_len,
                                peddsactx->libctx, edkey->propq);
@@ -446,6 +449,66 @@ int ed448_digest_verify(void *vpeddsactx, const unsigned char *sig,
                              peddsactx->prehash_flag, edkey->propq);
 }
 
+static int ed25519_digest_verify_batch(void *vpeddsactx,
+                                       const unsigned char *const *sigs,
+                                       const size_t *siglens,
+                                       const unsigned char *const *tbs,
+                                       const size_t *tbslens, size_t num)
+{
+    PROV_EDDSA_CTX *peddsactx = (PROV_EDDSA_CTX *)vpeddsactx;
+    const ECX_KEY *edkey = peddsactx->key;
+    size_t i;
+    int batch = !peddsactx->prehash_flag;
+
+    if (!ossl_prov_is_running())
+        return 0;
+
+    for (i = 0; i < num; i++)
+        if (siglens[i] != ED25519_SIGSIZE)
+            return 0;
+
+#ifdef S390X_EC_ASM
+    /* Verifying one by one with hardware support beats batching in software */
+    if (S390X_CAN_SIGN(ED25519)
+            && !peddsactx->dom2_flag
+            && !peddsactx->context_string_flag
+            && peddsactx->context_string_len == 0)
+        batch = 0;
+#endif /* S390X_EC_ASM */
+
+    if (!batch) {
+        for (i = 0; i < num; i++)
+            if (ed25519_digest_verify(vpeddsactx, sigs[i], siglens[i],
+                                      tbs[i], tbslens[i]) <= 0)
+                return 0;
+        return 1;
+    }
+
+    return ossl_ed25519_verify_batch(num, tbs, tbslens, sigs, edkey->pubkey,
+                                     peddsactx->dom2_flag,
+                                     peddsactx->prehash_flag,
+                                     peddsactx->context_string_flag,
+                                     peddsactx->context_string,
+                                     peddsactx->context_string_len,
+                                     peddsactx->libctx, edkey->propq);
+}
+
+static int ed448_digest_verify_batch(void *vpeddsactx,
+                                     const unsigned char *const *sigs,
+                                     const size_t *siglens,
+                                     const unsigned char *const *tbs,
+                                     const size_t *tbslens, size_t num)
+{
+    size_t i;
+
+    /* There is no batch verification for Ed448, but we save the EVP overhead */
+    for (i = 0; i < num; i++)
+        if (ed448_digest_verify(vpeddsactx, sigs[i], siglens[i],
+                                tbs[i], tbslens[i]) <= 0)
+            return 0;
+    return 1;
+}
+
 static void eddsa_freectx(void *vpeddsactx)
 {
     PROV_EDDSA_CTX *peddsactx = (PROV_EDDSA_CTX *)vpeddsactx;
@@ -599,6 +662,8 @@ const OSSL_DISPATCH ossl_ed25519_signature_functions[] = {
       (void (*)(void))eddsa_digest_signverify_init },
     { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY,
       (void (*)(void))ed25519_digest_verify },
+    { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_BATCH,
+      (void (*)(void))ed25519_digest_verify_batch },
     { OSSL_FUNC_SIGNATURE_FREECTX, (void (*)(void))eddsa_freectx },
     { OSSL_FUNC_SIGNATURE_DUPCTX, (void (*)(void))eddsa_dupctx },
     { OSSL_FUNC_SIGNATURE_GET_CTX_PARAMS, (void (*)(void))eddsa_get_ctx_params },
@@ -620,6 +685,8 @@ const OSSL_DISPATCH ossl_ed448_signature_functions[] = {
       (void (*)(void))eddsa_digest_signverify_init },
     { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY,
       (void (*)(void))ed448_digest_verify },
+    { OSSL_FUNC_SIGNATURE_DIGEST_VERIFY_BATCH,
+      (void (*)(void))ed448_digest_verify_batch },
     { OSSL_FUNC_SIGNATURE_FREECTX, (void (*)(void))eddsa_freectx },
     { OSSL_FUNC_SIGNATURE_DUPCTX, (void (*)(void))eddsa_dupctx },
     { OSSL_FUNC_SIGNATURE_GET_CTX_PARAMS, (void (*)(void))eddsa_get_ctx_params },
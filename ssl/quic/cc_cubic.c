@@ -0,0 +1,257 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "cc_local.h"
+
+/*
+ * CUBIC Congestion Controller
+ * ===========================
+ *
+ * This implements CUBIC as described in RFC 9438. Slow start, recovery and
+ * persistent congestion handling are shared with NewReno (see cc_loss.c); only
+ * the congestion avoidance window growth and the multiplicative decrease factor
+ * differ.
+ *
+ * All arithmetic is done in integers. Windows are tracked in bytes and the
+ * cubic function is evaluated in milliseconds. The target window is computed
+ * for the time of the current ACK rather than one RTT ahead, as the
+ * OSSL_CC_METHOD interface does not give us an RTT estimate; this makes growth
+ * slightly more conservative than the RFC.
+ */
+typedef struct ossl_cc_cubic_st {
+    OSSL_CC_LOSS    loss;
+
+    /* Window before the last reduction and the time to regain it. */
+    uint64_t        w_max;
+    uint64_t        k_ms;
+    /* Reno-friendly window estimate (RFC 9438 s. 4.3). */
+    uint64_t        w_est;
+    /* Start of the current congestion avoidance epoch, or zero. */
+    OSSL_TIME       epoch_start;
+
+    /* State saved at the start of recovery for a spurious congestion event. */
+    uint64_t        prior_w_max;
+    uint64_t        prior_k_ms;
+    OSSL_TIME       prior_epoch_start;
+} OSSL_CC_CUBIC;
+
+/* beta_cubic = 0.7 */
+#define CUBIC_BETA_NUM              7
+#define CUBIC_BETA_DEN              10
+/* alpha_cubic = 3 * (1 - beta) / (1 + beta) = 9 / 17 */
+#define CUBIC_ALPHA_NUM             9
+#define CUBIC_ALPHA_DEN             17
+/* Clamp on |t - K| to keep the cubic term within 64 bits. */
+#define CUBIC_MAX_DELTA_MS          100000
+
+/* Integer cube root, rounded down. */
+static uint64_t cubic_cbrt(uint64_t x)
+{
+    uint64_t lo = 0, hi = 2642245, mid; /* 2642245^3 < 2^64 */
+
+    while (lo < hi) {
+        mid = (lo + hi + 1) / 2;
+        if (mid * mid * mid <= x)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/*
+ * K = cbrt((W_max - cwnd) / C) seconds, with C = 0.4 segments/s^3.
+ * In milliseconds, K^3 = (W_max - cwnd) / MDPL * 2.5 * 10^9.
+ */
+static uint64_t cubic_calc_k(OSSL_CC_CUBIC *cu)
+{
+    uint64_t segs_milli;
+
+    if (cu->w_max <= cu->loss.cong_wnd)
+        return 0;
+
+    segs_milli = (cu->w_max - cu->loss.cong_wnd) * 1000
+                 / ossl_cc_loss_mdpl(&cu->loss);
+    if (segs_milli > UINT64_MAX / 2500000)
+        segs_milli = UINT64_MAX / 2500000;
+
+    return cubic_cbrt(segs_milli * 2500000);
+}
+
+/* W_cubic(t) = C * (t - K)^3 + W_max, in bytes, for t in milliseconds. */
+static uint64_t cubic_w_cubic(OSSL_CC_CUBIC *cu, uint64_t t_ms)
+{
+    uint64_t d, delta;
+    int neg = (t_ms < cu->k_ms);
+
+    d = neg ? cu->k_ms - t_ms : t_ms - cu->k_ms;
+    if (d > CUBIC_MAX_DELTA_MS)
+        d = CUBIC_MAX_DELTA_MS;
+
+    /* 0.4 * MDPL * d^3 / 10^9 */
+    delta = (d * d * d / 1000) * 4 * ossl_cc_loss_mdpl(&cu->loss) / 10000000;
+
+    if (!neg)
+        return cu->w_max + delta;
+
+    return delta < cu->w_max ? cu->w_max - delta : 0;
+}
+
+static void cubic_reset(OSSL_CC_DATA *cc, int flags)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    ossl_cc_loss_reset(&cu->loss);
+    cu->w_max       = 0;
+    cu->k_ms        = 0;
+    cu->w_est       = 0;
+    cu->epoch_start = ossl_time_zero();
+}
+
+static OSSL_CC_DATA *cubic_new(OSSL_PARAM *settings, OSSL_PARAM *options,
+                               OSSL_PARAM *changeables)
+{
+    OSSL_CC_CUBIC *cu;
+
+    if ((cu = OPENSSL_zalloc(sizeof(*cu))) == NULL)
+        return NULL;
+
+    if (!ossl_cc_loss_init(&cu->loss, changeables)) {
+        OPENSSL_free(cu);
+        return NULL;
+    }
+
+    return (OSSL_CC_DATA *)cu;
+}
+
+static void cubic_avoid_congestion(OSSL_CC_CUBIC *cu, OSSL_TIME time_now,
+                                   uint64_t num_bytes)
+{
+    OSSL_CC_LOSS *l = &cu->loss;
+    uint64_t mdpl = ossl_cc_loss_mdpl(l), t_ms, target, inc;
+
+    if (ossl_time_is_zero(cu->epoch_start)) {
+        /* First ACK of a new epoch, e.g. on leaving slow start or recovery. */
+        cu->epoch_start = time_now;
+        if (cu->w_max < l->cong_wnd)
+            cu->w_max = l->cong_wnd;
+        cu->k_ms  = cubic_calc_k(cu);
+        cu->w_est = l->cong_wnd;
+    }
+
+    t_ms = ossl_time2ms(ossl_time_subtract(time_now, cu->epoch_start));
+
+    cu->w_est += num_bytes * mdpl * CUBIC_ALPHA_NUM
+                 / (l->cong_wnd * CUBIC_ALPHA_DEN);
+
+    target = cubic_w_cubic(cu, t_ms);
+
+    if (target < cu->w_est) {
+        /* Reno-friendly region. */
+        if (cu->w_est > l->cong_wnd)
+            l->cong_wnd = cu->w_est;
+        return;
+    }
+
+    /* Limit growth to 1.5x the current window per RTT. */
+    if (target > l->cong_wnd + l->cong_wnd / 2)
+        target = l->cong_wnd + l->cong_wnd / 2;
+
+    if (target <= l->cong_wnd)
+        return;
+
+    inc = (target - l->cong_wnd) * num_bytes / l->cong_wnd;
+    l->cong_wnd += inc;
+}
+
+static int cubic_on_data_acked(OSSL_CC_DATA *cc, OSSL_TIME time_now,
+                               OSSL_TIME last_sent_time,
+                               uint64_t num_retransmittable_bytes)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    if (!ossl_cc_loss_on_acked(&cu->loss, last_sent_time,
+                               num_retransmittable_bytes))
+        goto out;
+
+    if (cu->loss.cong_wnd < cu->loss.slow_start_thresh)
+        cu->loss.cong_wnd += num_retransmittable_bytes;
+    else
+        cubic_avoid_congestion(cu, time_now, num_retransmittable_bytes);
+
+out:
+    return ossl_cc_loss_can_send(cc);
+}
+
+static void cubic_on_data_lost(OSSL_CC_DATA *cc, OSSL_TIME time_now,
+                               OSSL_TIME last_sent_time,
+                               uint64_t num_retransmittable_bytes,
+                               int persistent_congestion)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    if (ossl_cc_loss_on_lost(&cu->loss, time_now, last_sent_time,
+                             num_retransmittable_bytes)) {
+        cu->prior_w_max         = cu->w_max;
+        cu->prior_k_ms          = cu->k_ms;
+        cu->prior_epoch_start   = cu->epoch_start;
+
+        /* Fast convergence (RFC 9438 s. 4.7). */
+        if (cu->loss.cong_wnd < cu->w_max)
+            cu->w_max = cu->loss.cong_wnd * (CUBIC_BETA_DEN + CUBIC_BETA_NUM)
+                        / (2 * CUBIC_BETA_DEN);
+        else
+            cu->w_max = cu->loss.cong_wnd;
+
+        ossl_cc_loss_reduce(&cu->loss, CUBIC_BETA_NUM, CUBIC_BETA_DEN);
+        cu->epoch_start = ossl_time_zero();
+    }
+
+    if (persistent_congestion) {
+        /*
+         * RFC 9438 s. 4.8: the next congestion avoidance epoch starts with
+         * K = 0 and W_max set to the window at its beginning.
+         */
+        ossl_cc_loss_collapse(&cu->loss);
+        cu->w_max       = 0;
+        cu->epoch_start = ossl_time_zero();
+    }
+}
+
+static int cubic_on_spurious_congestion_event(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_CUBIC *cu = (OSSL_CC_CUBIC *)cc;
+
+    if (ossl_cc_loss_undo(&cu->loss)) {
+        cu->w_max       = cu->prior_w_max;
+        cu->k_ms        = cu->prior_k_ms;
+        cu->epoch_start = cu->prior_epoch_start;
+    }
+
+    return ossl_cc_loss_can_send(cc);
+}
+
+const OSSL_CC_METHOD ossl_cc_cubic_method = {
+    NULL,
+    cubic_new,
+    ossl_cc_loss_free,
+    cubic_reset,
+    ossl_cc_loss_set_exemption,
+    ossl_cc_loss_get_exemption,
+    ossl_cc_loss_can_send,
+    ossl_cc_loss_get_send_allowance,
+    ossl_cc_loss_get_bytes_in_flight_max,
+    ossl_cc_loss_get_next_credit_time,
+    ossl_cc_loss_on_data_sent,
+    ossl_cc_loss_on_data_invalidated,
+    cubic_on_data_acked,
+    cubic_on_data_lost,
+    cubic_on_spurious_congestion_event,
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -74,15 +74,14 @@ static int dummy_on_data_invalidated(OSSL_CC_DATA *cc,
 }
 
 static int dummy_on_data_acked(OSSL_CC_DATA *cc, OSSL_TIME time_now,
-                               uint64_t last_pn_acked,
+                               OSSL_TIME last_sent_time,
                                uint64_t num_retransmittable_bytes)
 {
     return 1;
 }
 
-static void dummy_on_data_lost(OSSL_CC_DATA *cc,
-                              uint64_t largest_pn_lost,
-                              uint64_t largest_pn_sent,
+static void dummy_on_data_lost(OSSL_CC_DATA *cc, OSSL_TIME time_now,
+                              OSSL_TIME last_sent_time,
                               uint64_t num_retransmittable_bytes,
                               int persistent_congestion)
 {
@@ -0,0 +1,103 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_QUIC_CC_LOCAL_H
+# define OSSL_QUIC_CC_LOCAL_H
+
+# include "internal/quic_cc.h"
+
+# ifndef OPENSSL_NO_QUIC
+
+/*
+ * Loss-Based Congestion Controller Base
+ * =====================================
+ *
+ * State and logic shared by the loss-based congestion controllers (NewReno and
+ * CUBIC): window accounting, probe exemptions, and the recovery period of RFC
+ * 9002 s. 7.3.2. Each controller embeds an OSSL_CC_LOSS as the first member of
+ * its own structure, so the ossl_cc_loss_*() functions taking an OSSL_CC_DATA
+ * can be used directly in its OSSL_CC_METHOD.
+ *
+ * A recovery period starts at the time of the congestion event, and a packet
+ * is part of it if it was sent no later than that. As in RFC 9002, this is
+ * based on send times rather than on packet numbers, which are not comparable
+ * between packet number spaces.
+ */
+typedef struct ossl_cc_loss_st {
+    /* Pointer to a changeable MDPL value, or NULL. */
+    const size_t    *p_mdpl;
+    size_t          mdpl;
+
+    uint64_t        bytes_in_flight;
+    uint64_t        cong_wnd;
+    uint64_t        slow_start_thresh;
+
+    /* Time the current recovery period began, or zero if not in recovery. */
+    OSSL_TIME       recovery_start_time;
+
+    /* State saved at the start of recovery for a spurious congestion event. */
+    uint64_t        prior_cong_wnd;
+    uint64_t        prior_slow_start_thresh;
+
+    int             exemptions;
+    unsigned int    have_prior          : 1;
+} OSSL_CC_LOSS;
+
+int ossl_cc_loss_init(OSSL_CC_LOSS *l, OSSL_PARAM *changeables);
+void ossl_cc_loss_reset(OSSL_CC_LOSS *l);
+size_t ossl_cc_loss_mdpl(OSSL_CC_LOSS *l);
+
+/*
+ * Called by a controller's on_data_acked(). Returns 1 if the window may grow
+ * in response to the ACK, or 0 if the acked packets were sent before the
+ * current recovery period began.
+ */
+int ossl_cc_loss_on_acked(OSSL_CC_LOSS *l, OSSL_TIME last_sent_time,
+                          uint64_t num_bytes);
+
+/*
+ * Called by a controller's on_data_lost(). Returns 1 if the loss starts a new
+ * congestion event, in which case the controller must reduce its window,
+ * usually with ossl_cc_loss_reduce(). The state needed to undo the reduction
+ * on a spurious congestion event has already been saved.
+ */
+int ossl_cc_loss_on_lost(OSSL_CC_LOSS *l, OSSL_TIME time_now,
+                         OSSL_TIME last_sent_time, uint64_t num_bytes);
+
+/* Set the slow start threshold to num/den of the window and enter it. */
+void ossl_cc_loss_reduce(OSSL_CC_LOSS *l, uint64_t num, uint64_t den);
+
+/* RFC 9002 s. 7.6.2: collapse the window and end the recovery period. */
+void ossl_cc_loss_collapse(OSSL_CC_LOSS *l);
+
+/*
+ * Called by a controller's on_spurious_congestion_event(). Returns 1 if the
+ * window and slow start threshold were restored, in which case the controller
+ * restores any state of its own.
+ */
+int ossl_cc_loss_undo(OSSL_CC_LOSS *l);
+
+/* Shared OSSL_CC_METHOD entries. */
+void ossl_cc_loss_free(OSSL_CC_DATA *cc);
+int ossl_cc_loss_set_exemption(OSSL_CC_DATA *cc, int numpackets);
+int ossl_cc_loss_get_exemption(OSSL_CC_DATA *cc);
+int ossl_cc_loss_can_send(OSSL_CC_DATA *cc);
+uint64_t ossl_cc_loss_get_send_allowance(OSSL_CC_DATA *cc,
+                                         OSSL_TIME time_since_last_send,
+                                         int time_valid);
+uint64_t ossl_cc_loss_get_bytes_in_flight_max(OSSL_CC_DATA *cc);
+OSSL_TIME ossl_cc_loss_get_next_credit_time(OSSL_CC_DATA *cc);
+int ossl_cc_loss_on_data_sent(OSSL_CC_DATA *cc,
+                              uint64_t num_retransmittable_bytes);
+int ossl_cc_loss_on_data_invalidated(OSSL_CC_DATA *cc,
+                                     uint64_t num_retransmittable_bytes);
+
+# endif
+
+#endif
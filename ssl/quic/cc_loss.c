@@ -0,0 +1,223 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "internal/quic_types.h"
+#include "cc_local.h"
+
+int ossl_cc_loss_init(OSSL_CC_LOSS *l, OSSL_PARAM *changeables)
+{
+    const OSSL_PARAM *p;
+
+    l->mdpl = QUIC_MIN_INITIAL_DGRAM_LEN;
+
+    if (changeables != NULL) {
+        p = OSSL_PARAM_locate_const(changeables,
+                                    OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN);
+        if (p != NULL) {
+            if (p->data_type != OSSL_PARAM_UNSIGNED_INTEGER
+                || p->data_size != sizeof(size_t))
+                return 0;
+
+            l->p_mdpl = p->data;
+        }
+    }
+
+    ossl_cc_loss_reset(l);
+    return 1;
+}
+
+size_t ossl_cc_loss_mdpl(OSSL_CC_LOSS *l)
+{
+    if (l->p_mdpl != NULL && *l->p_mdpl >= QUIC_MIN_INITIAL_DGRAM_LEN)
+        l->mdpl = *l->p_mdpl;
+
+    return l->mdpl;
+}
+
+/* RFC 9002 s. 7.2: Initial and Minimum Congestion Window */
+static uint64_t cc_loss_initial_wnd(OSSL_CC_LOSS *l)
+{
+    uint64_t mdpl = ossl_cc_loss_mdpl(l);
+    uint64_t lim = 2 * mdpl > 14720 ? 2 * mdpl : 14720;
+
+    return 10 * mdpl < lim ? 10 * mdpl : lim;
+}
+
+static uint64_t cc_loss_min_wnd(OSSL_CC_LOSS *l)
+{
+    return 2 * (uint64_t)ossl_cc_loss_mdpl(l);
+}
+
+void ossl_cc_loss_reset(OSSL_CC_LOSS *l)
+{
+    l->bytes_in_flight      = 0;
+    l->cong_wnd             = cc_loss_initial_wnd(l);
+    l->slow_start_thresh    = UINT64_MAX;
+    l->recovery_start_time  = ossl_time_zero();
+    l->exemptions           = 0;
+    l->have_prior           = 0;
+}
+
+static void cc_loss_remove_in_flight(OSSL_CC_LOSS *l, uint64_t num_bytes)
+{
+    if (num_bytes > l->bytes_in_flight)
+        l->bytes_in_flight = 0;
+    else
+        l->bytes_in_flight -= num_bytes;
+}
+
+static int cc_loss_in_recovery(OSSL_CC_LOSS *l, OSSL_TIME sent_time)
+{
+    return !ossl_time_is_zero(l->recovery_start_time)
+        && ossl_time_compare(sent_time, l->recovery_start_time) <= 0;
+}
+
+int ossl_cc_loss_on_acked(OSSL_CC_LOSS *l, OSSL_TIME last_sent_time,
+                          uint64_t num_bytes)
+{
+    cc_loss_remove_in_flight(l, num_bytes);
+
+    if (!ossl_time_is_zero(l->recovery_start_time)) {
+        /*
+         * Packets sent before the congestion event do not grow the window
+         * (RFC 9002 s. 7.3.2). An ACK for a packet sent after the event ends
+         * the recovery period.
+         */
+        if (cc_loss_in_recovery(l, last_sent_time))
+            return 0;
+
+        l->recovery_start_time  = ossl_time_zero();
+        l->have_prior           = 0;
+    }
+
+    return 1;
+}
+
+int ossl_cc_loss_on_lost(OSSL_CC_LOSS *l, OSSL_TIME time_now,
+                         OSSL_TIME last_sent_time, uint64_t num_bytes)
+{
+    cc_loss_remove_in_flight(l, num_bytes);
+
+    /* At most one window reduction per round trip. */
+    if (cc_loss_in_recovery(l, last_sent_time))
+        return 0;
+
+    l->prior_cong_wnd           = l->cong_wnd;
+    l->prior_slow_start_thresh  = l->slow_start_thresh;
+    l->have_prior               = 1;
+    l->recovery_start_time      = time_now;
+    return 1;
+}
+
+void ossl_cc_loss_reduce(OSSL_CC_LOSS *l, uint64_t num, uint64_t den)
+{
+    uint64_t min_wnd = cc_loss_min_wnd(l);
+
+    l->slow_start_thresh    = l->cong_wnd * num / den;
+    l->cong_wnd             = l->slow_start_thresh > min_wnd
+                              ? l->slow_start_thresh : min_wnd;
+}
+
+void ossl_cc_loss_collapse(OSSL_CC_LOSS *l)
+{
+    l->cong_wnd             = cc_loss_min_wnd(l);
+    l->recovery_start_time  = ossl_time_zero();
+    l->have_prior           = 0;
+}
+
+int ossl_cc_loss_undo(OSSL_CC_LOSS *l)
+{
+    if (!l->have_prior)
+        return 0;
+
+    l->cong_wnd             = l->prior_cong_wnd;
+    l->slow_start_thresh    = l->prior_slow_start_thresh;
+    l->recovery_start_time  = ossl_time_zero();
+    l->have_prior           = 0;
+    return 1;
+}
+
+void ossl_cc_loss_free(OSSL_CC_DATA *cc)
+{
+    OPENSSL_free(cc);
+}
+
+int ossl_cc_loss_set_exemption(OSSL_CC_DATA *cc, int numpackets)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    if (numpackets < 0)
+        return 0;
+
+    l->exemptions = numpackets;
+    return 1;
+}
+
+int ossl_cc_loss_get_exemption(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    return l->exemptions;
+}
+
+int ossl_cc_loss_can_send(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    return l->exemptions > 0 || l->bytes_in_flight < l->cong_wnd;
+}
+
+uint64_t ossl_cc_loss_get_send_allowance(OSSL_CC_DATA *cc,
+                                         OSSL_TIME time_since_last_send,
+                                         int time_valid)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    if (l->exemptions > 0)
+        return ossl_cc_loss_mdpl(l);
+
+    if (l->bytes_in_flight >= l->cong_wnd)
+        return 0;
+
+    return l->cong_wnd - l->bytes_in_flight;
+}
+
+uint64_t ossl_cc_loss_get_bytes_in_flight_max(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    return l->cong_wnd;
+}
+
+OSSL_TIME ossl_cc_loss_get_next_credit_time(OSSL_CC_DATA *cc)
+{
+    /* Credit is only ever released in response to ACKs. */
+    return ossl_time_infinite();
+}
+
+int ossl_cc_loss_on_data_sent(OSSL_CC_DATA *cc,
+                              uint64_t num_retransmittable_bytes)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    l->bytes_in_flight += num_retransmittable_bytes;
+    if (l->exemptions > 0)
+        --l->exemptions;
+
+    return 1;
+}
+
+int ossl_cc_loss_on_data_invalidated(OSSL_CC_DATA *cc,
+                                     uint64_t num_retransmittable_bytes)
+{
+    OSSL_CC_LOSS *l = (OSSL_CC_LOSS *)cc;
+
+    cc_loss_remove_in_flight(l, num_retransmittable_bytes);
+    return ossl_cc_loss_can_send(cc);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "cc_local.h"
+
+/*
+ * NewReno Congestion Controller
+ * =============================
+ *
+ * This is the loss-based congestion controller described in RFC 9002 Section 7
+ * and Appendix B. Slow start, recovery and persistent congestion handling are
+ * shared with CUBIC (see cc_loss.c); only congestion avoidance is specific to
+ * NewReno.
+ */
+typedef struct ossl_cc_newreno_st {
+    OSSL_CC_LOSS    loss;
+
+    /* Counter used for congestion avoidance window growth. */
+    uint64_t        bytes_acked;
+} OSSL_CC_NEWRENO;
+
+static void newreno_reset(OSSL_CC_DATA *cc, int flags)
+{
+    OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
+
+    ossl_cc_loss_reset(&nr->loss);
+    nr->bytes_acked = 0;
+}
+
+static OSSL_CC_DATA *newreno_new(OSSL_PARAM *settings, OSSL_PARAM *options,
+                                 OSSL_PARAM *changeables)
+{
+    OSSL_CC_NEWRENO *nr;
+
+    if ((nr = OPENSSL_zalloc(sizeof(*nr))) == NULL)
+        return NULL;
+
+    if (!ossl_cc_loss_init(&nr->loss, changeables)) {
+        OPENSSL_free(nr);
+        return NULL;
+    }
+
+    return (OSSL_CC_DATA *)nr;
+}
+
+static int newreno_on_data_acked(OSSL_CC_DATA *cc, OSSL_TIME time_now,
+                                 OSSL_TIME last_sent_time,
+                                 uint64_t num_retransmittable_bytes)
+{
+    OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
+    OSSL_CC_LOSS *l = &nr->loss;
+
+    if (!ossl_cc_loss_on_acked(l, last_sent_time, num_retransmittable_bytes))
+        goto out;
+
+    if (l->cong_wnd < l->slow_start_thresh) {
+        /* Slow start. */
+        l->cong_wnd += num_retransmittable_bytes;
+    } else {
+        /* Congestion avoidance: grow by one MDPL per window acknowledged. */
+        nr->bytes_acked += num_retransmittable_bytes;
+        if (nr->bytes_acked >= l->cong_wnd) {
+            nr->bytes_acked -= l->cong_wnd;
+            l->cong_wnd += ossl_cc_loss_mdpl(l);
+        }
+    }
+
+out:
+    return ossl_cc_loss_can_send(cc);
+}
+
+static void newreno_on_data_lost(OSSL_CC_DATA *cc, OSSL_TIME time_now,
+                                 OSSL_TIME last_sent_time,
+                                 uint64_t num_retransmittable_bytes,
+                                 int persistent_congestion)
+{
+    OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
+
+    if (ossl_cc_loss_on_lost(&nr->loss, time_now, last_sent_time,
+                             num_retransmittable_bytes)) {
+        ossl_cc_loss_reduce(&nr->loss, 1, 2);
+        nr->bytes_acked = 0;
+    }
+
+    if (persistent_congestion) {
+        ossl_cc_loss_collapse(&nr->loss);
+        nr->bytes_acked = 0;
+    }
+}
+
+static int newreno_on_spurious_congestion_event(OSSL_CC_DATA *cc)
+{
+    OSSL_CC_NEWRENO *nr = (OSSL_CC_NEWRENO *)cc;
+
+    ossl_cc_loss_undo(&nr->loss);
+    return ossl_cc_loss_can_send(cc);
+}
+
+const OSSL_CC_METHOD ossl_cc_newreno_method = {
+    NULL,
+    newreno_new,
+    ossl_cc_loss_free,
+    newreno_reset,
+    ossl_cc_loss_set_exemption,
+    ossl_cc_loss_get_exemption,
+    ossl_cc_loss_can_send,
+    ossl_cc_loss_get_send_allowance,
+    ossl_cc_loss_get_bytes_in_flight_max,
+    ossl_cc_loss_get_next_credit_time,
+    ossl_cc_loss_on_data_sent,
+    ossl_cc_loss_on_data_invalidated,
+    newreno_on_data_acked,
+    newreno_on_data_lost,
+    newreno_on_spurious_congestion_event,
+};
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -920,7 +920,7 @@ static void ackm_on_pkts_lost(OSSL_ACKM *ackm, int pkt_space,
 {
     const OSSL_ACKM_TX_PKT *p, *pnext;
     OSSL_RTT_INFO rtt;
-    QUIC_PN largest_pn_lost = 0;
+    OSSL_TIME last_sent_time = ossl_time_zero();
     uint64_t num_bytes = 0;
 
     for (p = lpkt; p != NULL; p = pnext) {
@@ -932,8 +932,7 @@ static void ackm_on_pkts_lost(OSSL_ACKM *ackm, int pkt_space,
                 ackm->ack_eliciting_bytes_in_flight[p->pkt_space]
                     -= p->num_bytes;
 
-            if (p->pkt_num > largest_pn_lost)
-                largest_pn_lost = p->pkt_num;
+            last_sent_time = ossl_time_max(last_sent_time, p->time);
 
             num_bytes += p->num_bytes;
         }
@@ -959,8 +958,8 @@ static void ackm_on_pkts_lost(OSSL_ACKM *ackm, int pkt_space,
         return;
 
     ackm->cc_method->on_data_lost(ackm->cc_data,
-        largest_pn_lost,
-        ackm->tx_history[pkt_space].highest_sent,
+        ackm->now(ackm->now_arg),
+        last_sent_time,
         num_bytes,
         ackm_in_persistent_congestion(ackm, lpkt));
 }
@@ -969,8 +968,8 @@ static void ackm_on_pkts_acked(OSSL_ACKM *ackm, const OSSL_ACKM_TX_PKT *apkt)
 {
     const OSSL_ACKM_TX_PKT *anext;
     OSSL_TIME now;
+    OSSL_TIME last_sent_time = ossl_time_zero();
     uint64_t num_retransmittable_bytes = 0;
-    QUIC_PN last_pn_acked = 0;
 
     now = ackm->now(ackm->now_arg);
 
@@ -982,8 +981,7 @@ static void ackm_on_pkts_acked(OSSL_ACKM *ackm, const OSSL_ACKM_TX_PKT *apkt)
                     -= apkt->num_bytes;
 
             num_retransmittable_bytes += apkt->num_bytes;
-            if (apkt->pkt_num > last_pn_acked)
-                last_pn_acked = apkt->pkt_num;
+            last_sent_time = ossl_time_max(last_sent_time, apkt->time);
 
             if (apkt->largest_acked != QUIC_PN_INVALID)
                 /*
@@ -1000,7 +998,7 @@ static void ackm_on_pkts_acked(OSSL_ACKM *ackm, const OSSL_ACKM_TX_PKT *apkt)
     }
 
     ackm->cc_method->on_data_acked(ackm->cc_data, now,
-        last_pn_acked, num_retransmittable_bytes);
+        last_sent_time, num_retransmittable_bytes);
 }
 
 OSSL_ACKM *ossl_ackm_new(OSSL_TIME (*now)(void *arg),
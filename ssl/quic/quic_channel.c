@@ -83,7 +83,8 @@ static void ch_start_terminating(QUIC_CHANNEL *ch,
 static void ch_default_packet_handler(QUIC_URXE *e, void *arg);
 static int ch_server_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
                                  const QUIC_CONN_ID *peer_scid,
-                                 const QUIC_CONN_ID *peer_dcid);
+                                 const QUIC_CONN_ID *peer_dcid,
+                                 const QUIC_CONN_ID *odcid);
 
 static int gen_rand_conn_id(OSSL_LIB_CTX *libctx, size_t len, QUIC_CONN_ID *cid)
 {
@@ -110,8 +111,9 @@ static int ch_init(QUIC_CHANNEL *ch)
     OSSL_QTX_ARGS qtx_args = {0};
     OSSL_QRX_ARGS qrx_args = {0};
     QUIC_TLS_ARGS tls_args = {0};
+    OSSL_PARAM cc_changeables[2];
     uint32_t pn_space;
-    size_t rx_short_cid_len = ch->is_server ? INIT_DCID_LEN : 0;
+    size_t rx_short_cid_len = ch->is_server ? QUIC_CHANNEL_SERVER_CID_LEN : 0;
 
     /* For clients, generate our initial DCID. */
     if (!ch->is_server
@@ -148,8 +150,16 @@ static int ch_init(QUIC_CHANNEL *ch)
         goto err;
 
     ch->have_statm = 1;
-    ch->cc_method = &ossl_cc_dummy_method;
-    if ((ch->cc_data = ch->cc_method->new(NULL, NULL, NULL)) == NULL)
+    if (ch->cc_method == NULL)
+        ch->cc_method = &ossl_cc_newreno_method;
+
+    ch->cc_mdpl = qtx_args.mdpl;
+    cc_changeables[0]
+        = OSSL_PARAM_construct_size_t(OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                                      &ch->cc_mdpl);
+    cc_changeables[1] = OSSL_PARAM_construct_end();
+
+    if ((ch->cc_data = ch->cc_method->new(NULL, NULL, cc_changeables)) == NULL)
         goto err;
 
     if ((ch->ackm = ossl_ackm_new(get_time, ch, &ch->statm,
@@ -175,6 +185,7 @@ static int ch_init(QUIC_CHANNEL *ch)
     txp_args.cc_data            = ch->cc_data;
     txp_args.now                = get_time;
     txp_args.now_arg            = ch;
+    txp_args.statm              = &ch->statm;
     for (pn_space = QUIC_PN_SPACE_INITIAL; pn_space < QUIC_PN_SPACE_NUM; ++pn_space) {
         ch->crypto_send[pn_space] = ossl_quic_sstream_new(INIT_CRYPTO_BUF_LEN);
         if (ch->crypto_send[pn_space] == NULL)
@@ -187,20 +198,24 @@ static int ch_init(QUIC_CHANNEL *ch)
     if (ch->txp == NULL)
         goto err;
 
-    if ((ch->demux = ossl_quic_demux_new(/*BIO=*/NULL,
-                                         /*Short CID Len=*/rx_short_cid_len,
-                                         get_time, ch)) == NULL)
-        goto err;
+    if (ch->demux == NULL) {
+        if ((ch->demux = ossl_quic_demux_new(/*BIO=*/NULL,
+                                             /*Short CID Len=*/rx_short_cid_len,
+                                             get_time, ch)) == NULL)
+            goto err;
 
-    /*
-     * If we are a server, setup our handler for packets not corresponding to
-     * any known DCID on our end. This is for handling clients establishing new
-     * connections.
-     */
-    if (ch->is_server)
-        ossl_quic_demux_set_default_handler(ch->demux,
-                                            ch_default_packet_handler,
-                                            ch);
+        ch->own_demux = 1;
+
+        /*
+         * If we are a server, setup our handler for packets not corresponding
+         * to any known DCID on our end. This is for handling clients
+         * establishing new connections.
+         */
+        if (ch->is_server)
+            ossl_quic_demux_set_default_handler(ch->demux,
+                                                ch_default_packet_handler,
+                                                ch);
+    }
 
     qrx_args.libctx             = ch->libctx;
     qrx_args.demux              = ch->demux;
@@ -325,8 +340,22 @@ static void ch_cleanup(QUIC_CHANNEL *ch)
     ch->qrx_pkt = NULL;
 
     ossl_quic_tls_free(ch->qtls);
+
+    /*
+     * When sharing a DEMUX, unregister the DCIDs we registered in
+     * ch_server_on_new_conn() individually, so that freeing the QRX does not
+     * need to search the entire DEMUX for them.
+     */
+    if (!ch->own_demux && ch->state != QUIC_CHANNEL_STATE_IDLE) {
+        ossl_qrx_remove_dst_conn_id(ch->qrx, &ch->cur_local_dcid);
+        ossl_qrx_remove_dst_conn_id(ch->qrx, ch->doing_retry
+                                             ? &ch->retry_scid
+                                             : &ch->init_dcid);
+    }
+
     ossl_qrx_free(ch->qrx);
-    ossl_quic_demux_free(ch->demux);
+    if (ch->own_demux)
+        ossl_quic_demux_free(ch->demux);
     OPENSSL_free(ch->local_transport_params);
 }
 
@@ -344,6 +373,15 @@ QUIC_CHANNEL *ossl_quic_channel_new(const QUIC_CHANNEL_ARGS *args)
     ch->mutex       = args->mutex;
     ch->now_cb      = args->now_cb;
     ch->now_cb_arg  = args->now_cb_arg;
+    ch->cc_method   = args->cc_method;
+
+    /* A shared DEMUX is only supported for servers. */
+    if (args->demux != NULL && !args->is_server) {
+        OPENSSL_free(ch);
+        return NULL;
+    }
+
+    ch->demux       = args->demux;
 
     if (!ch_init(ch)) {
         OPENSSL_free(ch);
@@ -1143,6 +1181,11 @@ static int ch_generate_transport_params(QUIC_CHANNEL *ch)
         if (!ossl_quic_wire_encode_transport_param_cid(&wpkt, QUIC_TPARAM_INITIAL_SCID,
                                                        &ch->cur_local_dcid))
             goto err;
+
+        if (ch->doing_retry
+            && !ossl_quic_wire_encode_transport_param_cid(&wpkt, QUIC_TPARAM_RETRY_SCID,
+                                                          &ch->retry_scid))
+            goto err;
     } else {
         /* Client always uses an empty SCID. */
         if (ossl_quic_wire_encode_transport_param_bytes(&wpkt, QUIC_TPARAM_INITIAL_SCID,
@@ -1348,6 +1391,10 @@ static void ch_rx_pre(QUIC_CHANNEL *ch)
     if (!ch->is_server && !ch->have_sent_any_pkt)
         return;
 
+    /* A shared DEMUX is pumped by its owner. */
+    if (!ch->own_demux)
+        return;
+
     /*
      * Get DEMUX to BIO_recvmmsg from the network and queue incoming datagrams
      * to the appropriate QRX instance.
@@ -1569,7 +1616,8 @@ static void ch_default_packet_handler(QUIC_URXE *e, void *arg)
      */
     if (!ch_server_on_new_conn(ch, &e->peer,
                                &hdr.src_conn_id,
-                               &hdr.dst_conn_id))
+                               &hdr.dst_conn_id,
+                               /*odcid=*/NULL))
         goto err;
 
     ossl_qrx_inject_urxe(ch->qrx, e);
@@ -1582,10 +1630,17 @@ undesirable:
     ossl_quic_demux_release_urxe(ch->demux, e);
 }
 
+/*
+ * Upper bound on the number of datagrams we generate in one call to ch_tx().
+ * In practice the CC and pacer stop us well before this.
+ */
+#define MAX_DGRAMS_PER_TX   64
+
 /* Try to generate packets and if possible, flush them to the network. */
 static int ch_tx(QUIC_CHANNEL *ch)
 {
-    int sent_ack_eliciting = 0;
+    int sent_ack_eliciting = 0, done = 0;
+    size_t num_dgrams = 0;
 
     if (ch->state == QUIC_CHANNEL_STATE_TERMINATING_CLOSING) {
         /*
@@ -1601,37 +1656,48 @@ static int ch_tx(QUIC_CHANNEL *ch)
     }
 
     /*
-     * Send a packet, if we need to. Best effort. The TXP consults the CC and
-     * applies any limitations imposed by it, so we don't need to do it here.
+     * Send packets, if we need to. The TXP consults the CC and the pacer and
+     * applies any limitations imposed by them, so we don't need to do it here.
+     * We keep generating datagrams until the TXP has nothing more it is allowed
+     * to send; if the pacer is holding data back, the tick deadline is set so
+     * that we are called again when it may be sent.
      *
      * Best effort. In particular if TXP fails for some reason we should still
      * flush any queued packets which we already generated.
      */
-    switch (ossl_quic_tx_packetiser_generate(ch->txp,
-                                             TX_PACKETISER_ARCHETYPE_NORMAL,
-                                             &sent_ack_eliciting)) {
-    case TX_PACKETISER_RES_SENT_PKT:
-        ch->have_sent_any_pkt = 1; /* Packet was sent */
+    while (!done && num_dgrams++ < MAX_DGRAMS_PER_TX) {
+        switch (ossl_quic_tx_packetiser_generate(ch->txp,
+                                                 TX_PACKETISER_ARCHETYPE_NORMAL,
+                                                 &sent_ack_eliciting)) {
+        case TX_PACKETISER_RES_SENT_PKT:
+            ch->have_sent_any_pkt = 1; /* Packet was sent */
 
-        /*
-         * RFC 9000 s. 10.1. 'An endpoint also restarts its idle timer when
-         * sending an ack-eliciting packet if no other ack-eliciting packets
-         * have been sent since last receiving and processing a packet.'
-         */
-        if (sent_ack_eliciting && !ch->have_sent_ack_eliciting_since_rx) {
-            ch_update_idle(ch);
-            ch->have_sent_ack_eliciting_since_rx = 1;
-        }
+            /*
+             * RFC 9000 s. 10.1. 'An endpoint also restarts its idle timer when
+             * sending an ack-eliciting packet if no other ack-eliciting packets
+             * have been sent since last receiving and processing a packet.'
+             */
+            if (sent_ack_eliciting && !ch->have_sent_ack_eliciting_since_rx) {
+                ch_update_idle(ch);
+                ch->have_sent_ack_eliciting_since_rx = 1;
+            }
 
-        ch_update_ping_deadline(ch);
-        break;
+            ch_update_ping_deadline(ch);
 
-    case TX_PACKETISER_RES_NO_PKT:
-        break; /* No packet was sent */
-    default:
-        ossl_quic_channel_raise_protocol_error(ch, QUIC_ERR_INTERNAL_ERROR, 0,
-                                               "internal error");
-        break; /* Internal failure (e.g.  allocation, assertion) */
+            /* Once closing, every datagram is a CONN_CLOSE; send only one. */
+            if (ch->state != QUIC_CHANNEL_STATE_ACTIVE)
+                done = 1;
+            break;
+
+        case TX_PACKETISER_RES_NO_PKT:
+            done = 1; /* No packet was sent */
+            break;
+        default:
+            ossl_quic_channel_raise_protocol_error(ch, QUIC_ERR_INTERNAL_ERROR, 0,
+                                                   "internal error");
+            done = 1; /* Internal failure (e.g.  allocation, assertion) */
+            break;
+        }
     }
 
     /* Flush packets to network. */
@@ -1668,11 +1734,9 @@ static OSSL_TIME ch_determine_next_tick_deadline(QUIC_CHANNEL *ch)
         deadline = ossl_time_min(deadline,
                                  ossl_ackm_get_ack_deadline(ch->ackm, pn_space));
 
-    /* When will CC let us send more? */
-    if (ossl_quic_tx_packetiser_has_pending(ch->txp, TX_PACKETISER_ARCHETYPE_NORMAL,
-                                            TX_PACKETISER_BYPASS_CC))
-        deadline = ossl_time_min(deadline,
-                                 ch->cc_method->get_next_credit_time(ch->cc_data));
+    /* When will CC or the pacer let us send more? */
+    deadline = ossl_time_min(deadline,
+                             ossl_quic_tx_packetiser_get_deadline(ch->txp));
 
     /* Is the terminating timer armed? */
     if (ossl_quic_channel_is_terminating(ch))
@@ -1740,7 +1804,8 @@ int ossl_quic_channel_set_net_rbio(QUIC_CHANNEL *ch, BIO *net_rbio)
     }
 
     ossl_quic_reactor_set_poll_r(&ch->rtor, &d);
-    ossl_quic_demux_set_bio(ch->demux, net_rbio);
+    if (ch->own_demux)
+        ossl_quic_demux_set_bio(ch->demux, net_rbio);
     ch->net_rbio = net_rbio;
     return 1;
 }
@@ -2130,23 +2195,35 @@ static void ch_on_idle_timeout(QUIC_CHANNEL *ch)
     ch->state = QUIC_CHANNEL_STATE_TERMINATED;
 }
 
-/* Called when we, as a server, get a new incoming connection. */
+/*
+ * Called when we, as a server, get a new incoming connection. odcid is non-NULL
+ * if the client is responding to a Retry we sent, in which case it is the DCID
+ * of the client's first Initial packet and peer_dcid is the SCID we put in the
+ * Retry packet.
+ */
 static int ch_server_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
                                  const QUIC_CONN_ID *peer_scid,
-                                 const QUIC_CONN_ID *peer_dcid)
+                                 const QUIC_CONN_ID *peer_dcid,
+                                 const QUIC_CONN_ID *odcid)
 {
     if (!ossl_assert(ch->state == QUIC_CHANNEL_STATE_IDLE && ch->is_server))
         return 0;
 
     /* Generate a SCID we will use for the connection. */
-    if (!gen_rand_conn_id(ch->libctx, INIT_DCID_LEN,
+    if (!gen_rand_conn_id(ch->libctx, QUIC_CHANNEL_SERVER_CID_LEN,
                           &ch->cur_local_dcid))
         return 0;
 
     /* Note our newly learnt peer address and CIDs. */
     ch->cur_peer_addr   = *peer;
-    ch->init_dcid       = *peer_dcid;
     ch->cur_remote_dcid = *peer_scid;
+    if (odcid != NULL) {
+        ch->init_dcid   = *odcid;
+        ch->retry_scid  = *peer_dcid;
+        ch->doing_retry = 1;
+    } else {
+        ch->init_dcid   = *peer_dcid;
+    }
 
     /* Inform QTX of peer address. */
     if (!ossl_quic_tx_packetiser_set_peer(ch->txp, &ch->cur_peer_addr))
@@ -2159,10 +2236,13 @@ static int ch_server_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
     if (!ossl_quic_tx_packetiser_set_cur_scid(ch->txp, &ch->cur_local_dcid))
         return 0;
 
-    /* Plug in secrets for the Initial EL. */
+    /*
+     * Plug in secrets for the Initial EL. These are always derived from the
+     * DCID of the Initial packet we are responding to.
+     */
     if (!ossl_quic_provide_initial_secret(ch->libctx,
                                           ch->propq,
-                                          &ch->init_dcid,
+                                          peer_dcid,
                                           /*is_server=*/1,
                                           ch->qrx, ch->qtx))
         return 0;
@@ -2171,12 +2251,43 @@ static int ch_server_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
     if (!ossl_qrx_add_dst_conn_id(ch->qrx, &ch->cur_local_dcid))
         return 0;
 
+    /*
+     * When sharing a DEMUX, also route any further Initial packets the client
+     * sends before it learns our SCID to us, rather than to the DEMUX's
+     * default handler.
+     */
+    if (!ch->own_demux && !ossl_qrx_add_dst_conn_id(ch->qrx, peer_dcid))
+        return 0;
+
     /* Change state. */
     ch->state                   = QUIC_CHANNEL_STATE_ACTIVE;
     ch->doing_proactive_ver_neg = 0; /* not currently supported */
     return 1;
 }
 
+int ossl_quic_channel_on_new_conn(QUIC_CHANNEL *ch, const BIO_ADDR *peer,
+                                  const QUIC_CONN_ID *peer_scid,
+                                  const QUIC_CONN_ID *peer_dcid,
+                                  const QUIC_CONN_ID *odcid)
+{
+    if (ch->own_demux || ch->state != QUIC_CHANNEL_STATE_IDLE)
+        return 0;
+
+    return ch_server_on_new_conn(ch, peer, peer_scid, peer_dcid, odcid);
+}
+
+void ossl_quic_channel_inject_urxe(QUIC_CHANNEL *ch, QUIC_URXE *e)
+{
+    ossl_qrx_inject_urxe(ch->qrx, e);
+}
+
+int ossl_quic_channel_set_rx_notify_cb(QUIC_CHANNEL *ch,
+                                       ossl_qrx_rx_notify_cb *cb,
+                                       void *cb_arg)
+{
+    return ossl_qrx_set_rx_notify_cb(ch->qrx, cb, cb_arg);
+}
+
 SSL *ossl_quic_channel_get0_ssl(QUIC_CHANNEL *ch)
 {
     return ch->tls;
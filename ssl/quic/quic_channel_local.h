@@ -76,12 +76,15 @@ struct quic_channel_st {
     OSSL_STATM                      statm;
     OSSL_CC_DATA                    *cc_data;
     const OSSL_CC_METHOD            *cc_method;
+    /* MDPL as seen by the CC; passed to it by address as a changeable. */
+    size_t                          cc_mdpl;
     OSSL_ACKM                       *ackm;
 
     /*
-     * RX demuxer. We register incoming DCIDs with this. Since we currently only
-     * support client operation and use one L4 port per connection, we own the
-     * demuxer and register a single zero-length DCID with it.
+     * RX demuxer. We register incoming DCIDs with this. Usually we use one L4
+     * port per connection, in which case we own the demuxer. A server channel
+     * created by a QUIC listener instead shares the listener's demuxer, which
+     * the listener owns and pumps (see own_demux).
      */
     QUIC_DEMUX                      *demux;
 
@@ -119,8 +122,11 @@ struct quic_channel_st {
     QUIC_CONN_ID                    init_scid;
 
     /*
-     * Client only: The SCID found in an incoming Retry packet we handled.
-     * Not valid for servers.
+     * Client: The SCID found in an incoming Retry packet we handled.
+     * Server: The SCID we put in the Retry packet we sent, which the client
+     *         used as the DCID of the Initial packet which established the
+     *         connection.
+     * Valid if doing_retry is set.
      */
     QUIC_CONN_ID                    retry_scid;
 
@@ -234,8 +240,9 @@ struct quic_channel_st {
     unsigned int                    handshake_confirmed     : 1;
 
     /*
-     * We are sending Initial packets based on a Retry. This means we definitely
-     * should not receive another Retry, and if we do it is an error.
+     * Client: We are sending Initial packets based on a Retry. This means we
+     * definitely should not receive another Retry, and if we do it is an error.
+     * Server: The connection was established after we sent a Retry.
      */
     unsigned int                    doing_retry             : 1;
 
@@ -271,6 +278,12 @@ struct quic_channel_st {
     /* Are we in server mode? Never changes after instantiation. */
     unsigned int                    is_server               : 1;
 
+    /*
+     * Do we own our demuxer? If not, it is shared with other channels and we
+     * must neither free it nor pump it. Never changes after instantiation.
+     */
+    unsigned int                    own_demux               : 1;
+
     /*
      * Set temporarily when the handshake layer has given us a new RX secret.
      * Used to determine if we need to check our RX queues again.
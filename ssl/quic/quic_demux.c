@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -10,15 +10,36 @@
 #include "internal/quic_demux.h"
 #include "internal/quic_wire_pkt.h"
 #include "internal/common.h"
+#include "internal/bio.h"
 #include <openssl/lhash.h>
 #include <openssl/err.h>
 
 #define URXE_DEMUX_STATE_FREE       0 /* on urx_free list */
 #define URXE_DEMUX_STATE_PENDING    1 /* on urx_pending list */
 #define URXE_DEMUX_STATE_ISSUED     2 /* on neither list */
+#define URXE_DEMUX_STATE_SPLIT      3 /* on neither list, buffer referenced */
 
 #define DEMUX_MAX_MSGS_PER_CALL    32
 
+/*
+ * When receive coalescing is in use, each message received from the network
+ * may hold up to a maximum sized UDP payload made up of many datagrams, so we
+ * receive fewer messages at a time into correspondingly larger URXEs. At most
+ * DEMUX_MAX_SEG_MSGS_PER_CALL of these are kept on the free list; any others
+ * are freed once released. A datagram which was not coalesced is copied into a
+ * URXE of its own, so only the datagrams which were coalesced keep a large
+ * URXE in use for as long as the QRX holds on to them.
+ *
+ * Coalescing is only turned on while datagrams arrive faster than we read
+ * them, which is when a receive fills all DEMUX_MAX_MSGS_PER_CALL URXEs, and
+ * turned off again after DEMUX_SEG_IDLE_CALLS receives in a row which did not
+ * return any coalesced datagrams. Traffic at a lower rate, or from many peers,
+ * is thus received in MTU-sized batches as without coalescing.
+ */
+#define DEMUX_MAX_SEG_MSGS_PER_CALL 2
+#define DEMUX_SEG_URXE_LEN          65535
+#define DEMUX_SEG_IDLE_CALLS        8
+
 #define DEMUX_DEFAULT_MTU        1500
 
 /* Structure used to track a given connection ID. */
@@ -95,10 +116,38 @@ struct quic_demux_st {
      */
     QUIC_URXE_LIST              urx_pending;
 
+    /*
+     * List of URXEs without a buffer, used to refer to the datagrams coalesced
+     * into the buffer of another URXE.
+     */
+    QUIC_URXE_LIST              urx_free_ref;
+
     /* Whether to use local address support. */
     char                        use_local_addr;
+
+    /* Whether the BIO can coalesce received datagrams. */
+    char                        seg_cap;
+
+    /*
+     * Whether the BIO may return several datagrams coalesced into a single
+     * message, which we split up again after receiving them.
+     */
+    char                        use_seg;
+
+    /* Receives in a row without coalesced datagrams while use_seg is set. */
+    unsigned char               seg_idle;
 };
 
+static void demux_update_seg(QUIC_DEMUX *demux)
+{
+    demux->seg_cap = demux->net_bio != NULL
+        && (BIO_dgram_get_seg_cap(demux->net_bio) & BIO_DGRAM_SEG_CAP_RX) != 0;
+    demux->use_seg  = 0;
+    demux->seg_idle = 0;
+    if (demux->seg_cap)
+        (void)BIO_dgram_set_rx_seg_enable(demux->net_bio, 0);
+}
+
 QUIC_DEMUX *ossl_quic_demux_new(BIO *net_bio,
                                 size_t short_conn_id_len,
                                 OSSL_TIME (*now)(void *arg),
@@ -129,6 +178,7 @@ QUIC_DEMUX *ossl_quic_demux_new(BIO *net_bio,
         && BIO_dgram_set_local_addr_enable(net_bio, 1))
         demux->use_local_addr = 1;
 
+    demux_update_seg(demux);
     return demux;
 }
 
@@ -144,6 +194,8 @@ static void demux_free_urxl(QUIC_URXE_LIST *l)
     for (e = ossl_list_urxe_head(l); e != NULL; e = enext) {
         enext = ossl_list_urxe_next(e);
         ossl_list_urxe_remove(l, e);
+        if (e->parent != NULL && --e->parent->child_refs == 0)
+            OPENSSL_free(e->parent);
         OPENSSL_free(e);
     }
 }
@@ -160,6 +212,7 @@ void ossl_quic_demux_free(QUIC_DEMUX *demux)
     /* Free all URXEs we are holding. */
     demux_free_urxl(&demux->urx_free);
     demux_free_urxl(&demux->urx_pending);
+    demux_free_urxl(&demux->urx_free_ref);
 
     OPENSSL_free(demux);
 }
@@ -169,6 +222,7 @@ void ossl_quic_demux_set_bio(QUIC_DEMUX *demux, BIO *net_bio)
     unsigned int mtu;
 
     demux->net_bio = net_bio;
+    demux_update_seg(demux);
 
     if (net_bio != NULL) {
         /*
@@ -311,6 +365,9 @@ static QUIC_URXE *demux_alloc_urxe(size_t alloc_len)
     ossl_list_urxe_init_elem(e);
     e->alloc_len   = alloc_len;
     e->data_len    = 0;
+    e->parent      = NULL;
+    e->data_off    = 0;
+    e->child_refs  = 0;
     return e;
 }
 
@@ -368,6 +425,175 @@ static int demux_ensure_free_urxe(QUIC_DEMUX *demux, size_t min_num_free)
     return 1;
 }
 
+/* Returns 1 if we already keep as many large URXEs as we receive into. */
+static int demux_have_seg_urxes(QUIC_DEMUX *demux)
+{
+    QUIC_URXE *e;
+    size_t n = 0;
+
+    /* Large URXEs are used for receiving first, so are kept at the head. */
+    for (e = ossl_list_urxe_head(&demux->urx_free);
+         e != NULL && e->alloc_len >= DEMUX_SEG_URXE_LEN;
+         e = ossl_list_urxe_next(e))
+        if (++n >= DEMUX_MAX_SEG_MSGS_PER_CALL)
+            return 1;
+
+    return 0;
+}
+
+/*
+ * Returns a URXE which is no longer in use to the free list. If e refers to
+ * the buffer of another URXE, it drops its reference, and the other URXE is
+ * returned once it is no longer referenced.
+ */
+static void demux_recycle_urxe(QUIC_DEMUX *demux, QUIC_URXE *e)
+{
+    QUIC_URXE *parent = e->parent;
+
+    if (parent != NULL) {
+        e->parent = NULL;
+        ossl_list_urxe_insert_tail(&demux->urx_free_ref, e);
+        e->demux_state = URXE_DEMUX_STATE_FREE;
+
+        assert(parent->demux_state == URXE_DEMUX_STATE_SPLIT);
+        if (--parent->child_refs > 0)
+            return;
+
+        e = parent;
+    }
+
+    if (e->alloc_len >= DEMUX_SEG_URXE_LEN) {
+        if (!demux->use_seg || demux_have_seg_urxes(demux)) {
+            OPENSSL_free(e);
+            return;
+        }
+
+        ossl_list_urxe_insert_head(&demux->urx_free, e);
+    } else {
+        ossl_list_urxe_insert_tail(&demux->urx_free, e);
+    }
+
+    e->demux_state = URXE_DEMUX_STATE_FREE;
+}
+
+/*
+ * Queues the datagrams which the BIO coalesced into the buffer of e, each of
+ * seg_len bytes except for the last, which may be shorter. Each datagram is
+ * given a URXE of its own which refers to its part of the buffer of e rather
+ * than copying it. e is not reused until all of them have been released.
+ */
+static int demux_split_urxe(QUIC_DEMUX *demux, QUIC_URXE *e, size_t seg_len)
+{
+    QUIC_URXE *e2;
+    size_t off, len;
+
+    ossl_list_urxe_remove(&demux->urx_free, e);
+    e->demux_state  = URXE_DEMUX_STATE_SPLIT;
+    e->child_refs   = 0;
+
+    for (off = 0; off < e->data_len; off += len) {
+        len = e->data_len - off;
+        if (len > seg_len)
+            len = seg_len;
+
+        e2 = ossl_list_urxe_head(&demux->urx_free_ref);
+        if (e2 != NULL) {
+            ossl_list_urxe_remove(&demux->urx_free_ref, e2);
+        } else if ((e2 = demux_alloc_urxe(0)) == NULL) {
+            if (e->child_refs == 0) {
+                ossl_list_urxe_insert_head(&demux->urx_free, e);
+                e->demux_state = URXE_DEMUX_STATE_FREE;
+            }
+            return 0;
+        }
+
+        e2->parent      = e;
+        e2->data_off    = off;
+        e2->data_len    = len;
+        e2->peer        = e->peer;
+        e2->local       = e->local;
+        e2->time        = e->time;
+        ++e->child_refs;
+
+        ossl_list_urxe_insert_tail(&demux->urx_pending, e2);
+        e2->demux_state = URXE_DEMUX_STATE_PENDING;
+    }
+
+    return 1;
+}
+
+/*
+ * Copies the datagram which was received into the large URXE e, and was not
+ * coalesced with others, into a URXE of its own. e stays on the free list to
+ * be received into again.
+ */
+static QUIC_URXE *demux_copy_urxe(QUIC_DEMUX *demux, QUIC_URXE *e)
+{
+    QUIC_URXE *e2 = ossl_list_urxe_tail(&demux->urx_free);
+
+    /* Large URXEs are kept at the head, so e is never the one taken here. */
+    if (e2 != NULL && e2->alloc_len < DEMUX_SEG_URXE_LEN
+        && e2->alloc_len >= e->data_len) {
+        ossl_list_urxe_remove(&demux->urx_free, e2);
+    } else {
+        e2 = demux_alloc_urxe(e->data_len > demux->mtu ? e->data_len
+                                                       : demux->mtu);
+        if (e2 == NULL)
+            return NULL;
+    }
+
+    memcpy(ossl_quic_urxe_data(e2), ossl_quic_urxe_data(e), e->data_len);
+    e2->data_len    = e->data_len;
+    e2->peer        = e->peer;
+    e2->local       = e->local;
+    e2->time        = e->time;
+    return e2;
+}
+
+/*
+ * Turns receive coalescing on or off as described for
+ * DEMUX_MAX_SEG_MSGS_PER_CALL, given that the last receive asked for num_req
+ * messages, got num_rd of them and found coalesced datagrams if coalesced is
+ * set. Once coalescing has been turned off, a message which the BIO coalesced
+ * before may still be waiting to be received. It is then received as a single
+ * datagram which is not valid, and lost, which is why coalescing is only
+ * turned off once it has not been seen in use for a while.
+ */
+static void demux_adapt_seg(QUIC_DEMUX *demux, size_t num_req, size_t num_rd,
+                            int coalesced)
+{
+    QUIC_URXE *e;
+
+    if (!demux->use_seg) {
+        if (demux->seg_cap && num_rd == DEMUX_MAX_MSGS_PER_CALL
+            && num_rd == num_req
+            && BIO_dgram_set_rx_seg_enable(demux->net_bio, 1)) {
+            demux->use_seg  = 1;
+            demux->seg_idle = 0;
+        }
+        return;
+    }
+
+    if (coalesced) {
+        demux->seg_idle = 0;
+        return;
+    }
+
+    if (++demux->seg_idle < DEMUX_SEG_IDLE_CALLS
+        || !BIO_dgram_set_rx_seg_enable(demux->net_bio, 0))
+        return;
+
+    demux->use_seg  = 0;
+    demux->seg_idle = 0;
+
+    /* Large URXEs are kept at the head, and are no longer needed. */
+    while ((e = ossl_list_urxe_head(&demux->urx_free)) != NULL
+           && e->alloc_len >= DEMUX_SEG_URXE_LEN) {
+        ossl_list_urxe_remove(&demux->urx_free, e);
+        OPENSSL_free(e);
+    }
+}
+
 /*
  * Receive datagrams from network, placing them into URXEs.
  *
@@ -378,10 +604,12 @@ static int demux_ensure_free_urxe(QUIC_DEMUX *demux, size_t min_num_free)
  */
 static int demux_recv(QUIC_DEMUX *demux)
 {
-    BIO_MSG msg[DEMUX_MAX_MSGS_PER_CALL];
-    size_t rd, i;
-    QUIC_URXE *urxe = ossl_list_urxe_head(&demux->urx_free), *unext;
+    BIO_MSG msg[DEMUX_MAX_MSGS_PER_CALL], *m;
+    BIO_MSG_SEG seg_msg[DEMUX_MAX_SEG_MSGS_PER_CALL];
+    size_t rd, i, num_req, max_msgs, alloc_len, seg_len;
+    QUIC_URXE *urxe = ossl_list_urxe_head(&demux->urx_free), *unext, *copy;
     OSSL_TIME now;
+    int coalesced = 0;
 
     /* This should never be called when we have any pending URXE. */
     assert(ossl_list_urxe_head(&demux->urx_pending) == NULL);
@@ -393,12 +621,19 @@ static int demux_recv(QUIC_DEMUX *demux)
          */
         return QUIC_DEMUX_PUMP_RES_TRANSIENT_FAIL;
 
+    if (demux->use_seg) {
+        max_msgs  = DEMUX_MAX_SEG_MSGS_PER_CALL;
+        alloc_len = DEMUX_SEG_URXE_LEN;
+    } else {
+        max_msgs  = OSSL_NELEM(msg);
+        alloc_len = demux->mtu;
+    }
+
     /*
      * Opportunistically receive as many messages as possible in a single
      * syscall, determined by how many free URXEs are available.
      */
-    for (i = 0; i < (ossl_ssize_t)OSSL_NELEM(msg);
-            ++i, urxe = ossl_list_urxe_next(urxe)) {
+    for (i = 0; i < max_msgs; ++i, urxe = ossl_list_urxe_next(urxe)) {
         if (urxe == NULL) {
             /* We need at least one URXE to receive into. */
             if (!ossl_assert(i > 0))
@@ -408,25 +643,37 @@ static int demux_recv(QUIC_DEMUX *demux)
         }
 
         /* Ensure the URXE is big enough. */
-        urxe = demux_reserve_urxe(demux, urxe, demux->mtu);
+        urxe = demux_reserve_urxe(demux, urxe, alloc_len);
         if (urxe == NULL)
             /* Allocation error, fail. */
             return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
 
         /* Ensure we zero any fields added to BIO_MSG at a later date. */
-        memset(&msg[i], 0, sizeof(BIO_MSG));
-        msg[i].data     = ossl_quic_urxe_data(urxe);
-        msg[i].data_len = urxe->alloc_len;
-        msg[i].peer     = &urxe->peer;
+        if (demux->use_seg) {
+            memset(&seg_msg[i], 0, sizeof(BIO_MSG_SEG));
+            m = &seg_msg[i].msg;
+        } else {
+            memset(&msg[i], 0, sizeof(BIO_MSG));
+            m = &msg[i];
+        }
+
+        m->data     = ossl_quic_urxe_data(urxe);
+        m->data_len = urxe->alloc_len;
+        m->peer     = &urxe->peer;
         BIO_ADDR_clear(&urxe->peer);
         if (demux->use_local_addr)
-            msg[i].local = &urxe->local;
+            m->local = &urxe->local;
         else
             BIO_ADDR_clear(&urxe->local);
     }
 
+    num_req = i;
     ERR_set_mark();
-    if (!BIO_recvmmsg(demux->net_bio, msg, sizeof(BIO_MSG), i, 0, &rd)) {
+    if (demux->use_seg ? !BIO_recvmmsg(demux->net_bio, &seg_msg[0].msg,
+                                       sizeof(BIO_MSG_SEG), i,
+                                       BIO_MMSG_FLAG_SEG, &rd)
+                       : !BIO_recvmmsg(demux->net_bio, msg, sizeof(BIO_MSG),
+                                       i, 0, &rd)) {
         if (BIO_err_is_non_fatal(ERR_peek_last_error())) {
             /* Transient error, clear the error and stop. */
             ERR_pop_to_mark();
@@ -445,15 +692,38 @@ static int demux_recv(QUIC_DEMUX *demux)
     for (i = 0; i < rd; ++i, urxe = unext) {
         unext = ossl_list_urxe_next(urxe);
         /* Set URXE with actual length of received datagram. */
-        urxe->data_len      = msg[i].data_len;
+        urxe->data_len      = demux->use_seg ? seg_msg[i].msg.data_len
+                                             : msg[i].data_len;
         /* Time we received datagram. */
         urxe->time          = now;
+
+        seg_len = demux->use_seg ? seg_msg[i].seg_len : 0;
+        if (seg_len > 0 && seg_len < urxe->data_len) {
+            /* Several datagrams were coalesced, refer to each of them. */
+            if (!demux_split_urxe(demux, urxe, seg_len))
+                return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+
+            coalesced = 1;
+            continue;
+        }
+
+        if (demux->use_seg) {
+            /* Do not hold on to a large URXE for a single datagram. */
+            if ((copy = demux_copy_urxe(demux, urxe)) == NULL)
+                return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
+
+            ossl_list_urxe_insert_tail(&demux->urx_pending, copy);
+            copy->demux_state = URXE_DEMUX_STATE_PENDING;
+            continue;
+        }
+
         /* Move from free list to pending list. */
         ossl_list_urxe_remove(&demux->urx_free, urxe);
         ossl_list_urxe_insert_tail(&demux->urx_pending, urxe);
         urxe->demux_state = URXE_DEMUX_STATE_PENDING;
     }
 
+    demux_adapt_seg(demux, num_req, rd, coalesced);
     return QUIC_DEMUX_PUMP_RES_OK;
 }
 
@@ -508,8 +778,7 @@ static int demux_process_pending_urxe(QUIC_DEMUX *demux, QUIC_URXE *e)
             demux->default_cb(e, demux->default_cb_arg);
         } else {
             /* Discard. */
-            ossl_list_urxe_insert_tail(&demux->urx_free, e);
-            e->demux_state = URXE_DEMUX_STATE_FREE;
+            demux_recycle_urxe(demux, e);
         }
         return 1; /* keep processing pending URXEs */
     }
@@ -545,7 +814,9 @@ int ossl_quic_demux_pump(QUIC_DEMUX *demux)
     int ret;
 
     if (ossl_list_urxe_head(&demux->urx_pending) == NULL) {
-        ret = demux_ensure_free_urxe(demux, DEMUX_MAX_MSGS_PER_CALL);
+        ret = demux_ensure_free_urxe(demux,
+                                     demux->use_seg ? DEMUX_MAX_SEG_MSGS_PER_CALL
+                                                    : DEMUX_MAX_MSGS_PER_CALL);
         if (ret != 1)
             return QUIC_DEMUX_PUMP_RES_PERMANENT_FAIL;
 
@@ -617,8 +888,7 @@ void ossl_quic_demux_release_urxe(QUIC_DEMUX *demux,
 {
     assert(ossl_list_urxe_prev(e) == NULL && ossl_list_urxe_next(e) == NULL);
     assert(e->demux_state == URXE_DEMUX_STATE_ISSUED);
-    ossl_list_urxe_insert_tail(&demux->urx_free, e);
-    e->demux_state = URXE_DEMUX_STATE_FREE;
+    demux_recycle_urxe(demux, e);
 }
 
 void ossl_quic_demux_reinject_urxe(QUIC_DEMUX *demux,
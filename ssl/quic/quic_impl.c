@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -257,6 +257,21 @@ void ossl_quic_conn_set_override_now_cb(SSL *s,
     qc->override_now_cb_arg = now_cb_arg;
 }
 
+int ossl_quic_conn_set_cc_method(SSL *s, const OSSL_CC_METHOD *cc_method)
+{
+    QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
+
+    if (!expect_quic_conn(qc))
+        return 0;
+
+    /* Cannot be changed once the channel exists. */
+    if (qc->started)
+        return 0;
+
+    qc->cc_method = cc_method;
+    return 1;
+}
+
 void ossl_quic_conn_force_assist_thread_wake(SSL *s)
 {
     QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
@@ -703,6 +718,7 @@ static int ensure_channel(QUIC_CONNECTION *qc)
     args.mutex      = qc->mutex;
     args.now_cb     = qc->override_now_cb;
     args.now_cb_arg = qc->override_now_cb_arg;
+    args.cc_method  = qc->cc_method;
 
     qc->ch = ossl_quic_channel_new(&args);
     if (qc->ch == NULL)
@@ -875,6 +891,7 @@ int ossl_quic_accept(SSL *s)
  *         SSL_get_error        => partially implemented by ossl_quic_get_error
  *   (BIO/)SSL_read             => ossl_quic_read
  *   (BIO/)SSL_write            => ossl_quic_write
+ *         SSL_writev_ex        => ossl_quic_writev
  *         SSL_pending          => ossl_quic_pending
  *         SSL_stream_conclude  => ossl_quic_conn_stream_conclude
  */
@@ -921,11 +938,41 @@ static void quic_post_write(QUIC_CONNECTION *qc, int did_append, int do_tick)
         ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(qc->ch), 0);
 }
 
-struct quic_write_again_args {
-    QUIC_CONNECTION     *qc;
+/*
+ * The data of an SSL_write() or SSL_writev_ex() call: |len| bytes either at
+ * |buf| or, if |iov| is not NULL, in the |iovcnt| segments at |iov|.
+ */
+typedef struct quic_write_src_st {
     const unsigned char *buf;
+    const SSL_IOVEC     *iov;
+    size_t              iovcnt;
     size_t              len;
-    size_t              total_written;
+} QUIC_WRITE_SRC;
+
+/* The pointer which identifies the data of |src| for write retries */
+static const void *quic_write_src_id(const QUIC_WRITE_SRC *src)
+{
+    return src->iov != NULL ? (const void *)src->iov : (const void *)src->buf;
+}
+
+/* Append the data of |src| from offset |pos| on to the send stream */
+QUIC_NEEDS_LOCK
+static int quic_write_src_append(QUIC_CONNECTION *qc, const QUIC_WRITE_SRC *src,
+                                 size_t pos, size_t *consumed)
+{
+    if (src->iov != NULL)
+        return ossl_quic_sstream_appendv(qc->stream0->sstream, src->iov,
+                                         src->iovcnt, pos, consumed);
+
+    return ossl_quic_sstream_append(qc->stream0->sstream, src->buf + pos,
+                                    src->len - pos, consumed);
+}
+
+struct quic_write_again_args {
+    QUIC_CONNECTION         *qc;
+    const QUIC_WRITE_SRC    *src;
+    size_t                  pos;
+    size_t                  total_written;
 };
 
 QUIC_NEEDS_LOCK
@@ -938,17 +985,16 @@ static int quic_write_again(void *arg)
         /* If connection is torn down due to an error while blocking, stop. */
         return -2;
 
-    if (!ossl_quic_sstream_append(args->qc->stream0->sstream,
-                                  args->buf, args->len, &actual_written))
+    if (!quic_write_src_append(args->qc, args->src, args->pos,
+                               &actual_written))
         return -2;
 
     quic_post_write(args->qc, actual_written > 0, 0);
 
-    args->buf           += actual_written;
-    args->len           -= actual_written;
+    args->pos           += actual_written;
     args->total_written += actual_written;
 
-    if (args->len == 0)
+    if (args->pos == args->src->len)
         /* Written everything, done. */
         return 1;
 
@@ -957,7 +1003,7 @@ static int quic_write_again(void *arg)
 }
 
 QUIC_NEEDS_LOCK
-static int quic_write_blocking(QUIC_CONNECTION *qc, const void *buf, size_t len,
+static int quic_write_blocking(QUIC_CONNECTION *qc, const QUIC_WRITE_SRC *src,
                                size_t *written)
 {
     int res;
@@ -965,8 +1011,7 @@ static int quic_write_blocking(QUIC_CONNECTION *qc, const void *buf, size_t len,
     size_t actual_written = 0;
 
     /* First make a best effort to append as much of the data as possible. */
-    if (!ossl_quic_sstream_append(qc->stream0->sstream, buf, len,
-                                  &actual_written)) {
+    if (!quic_write_src_append(qc, src, 0, &actual_written)) {
         /* Stream already finished or allocation error. */
         *written = 0;
         return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
@@ -974,7 +1019,7 @@ static int quic_write_blocking(QUIC_CONNECTION *qc, const void *buf, size_t len,
 
     quic_post_write(qc, actual_written > 0, 1);
 
-    if (actual_written == len) {
+    if (actual_written == src->len) {
         /* Managed to append everything on the first try. */
         *written = actual_written;
         return 1;
@@ -986,8 +1031,8 @@ static int quic_write_blocking(QUIC_CONNECTION *qc, const void *buf, size_t len,
      * it is freed up.
      */
     args.qc             = qc;
-    args.buf            = (const unsigned char *)buf + actual_written;
-    args.len            = len - actual_written;
+    args.src            = src;
+    args.pos            = actual_written;
     args.total_written  = 0;
 
     res = block_until_pred(qc, quic_write_again, &args, 0);
@@ -1026,11 +1071,11 @@ static void aon_write_finish(QUIC_CONNECTION *qc)
 }
 
 QUIC_NEEDS_LOCK
-static int quic_write_nonblocking_aon(QUIC_CONNECTION *qc, const void *buf,
-                                      size_t len, size_t *written)
+static int quic_write_nonblocking_aon(QUIC_CONNECTION *qc,
+                                      const QUIC_WRITE_SRC *src,
+                                      size_t *written)
 {
-    const void *actual_buf;
-    size_t actual_len, actual_written = 0;
+    size_t actual_pos, actual_len, actual_written = 0;
     int accept_moving_buffer
         = ((qc->ssl_mode & SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER) != 0);
 
@@ -1040,25 +1085,25 @@ static int quic_write_nonblocking_aon(QUIC_CONNECTION *qc, const void *buf,
          * manage to append all data to the SSTREAM and we have Enable Partial
          * Write (EPW) mode disabled.)
          */
-        if ((!accept_moving_buffer && qc->aon_buf_base != buf)
-            || len != qc->aon_buf_len)
+        if ((!accept_moving_buffer
+             && (const void *)qc->aon_buf_base != quic_write_src_id(src))
+            || src->len != qc->aon_buf_len)
             /*
              * Pointer must not have changed if we are not in accept moving
              * buffer mode. Length must never change.
              */
             return QUIC_RAISE_NON_NORMAL_ERROR(qc, SSL_R_BAD_WRITE_RETRY, NULL);
 
-        actual_buf = (unsigned char *)buf + qc->aon_buf_pos;
-        actual_len = len - qc->aon_buf_pos;
+        actual_pos = qc->aon_buf_pos;
+        actual_len = src->len - qc->aon_buf_pos;
         assert(actual_len > 0);
     } else {
-        actual_buf = buf;
-        actual_len = len;
+        actual_pos = 0;
+        actual_len = src->len;
     }
 
     /* First make a best effort to append as much of the data as possible. */
-    if (!ossl_quic_sstream_append(qc->stream0->sstream, actual_buf, actual_len,
-                                  &actual_written)) {
+    if (!quic_write_src_append(qc, src, actual_pos, &actual_written)) {
         /* Stream already finished or allocation error. */
         *written = 0;
         return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
@@ -1102,7 +1147,7 @@ static int quic_write_nonblocking_aon(QUIC_CONNECTION *qc, const void *buf,
      * actually append anything.
      */
     if (actual_written > 0)
-        aon_write_begin(qc, buf, len, actual_written);
+        aon_write_begin(qc, quic_write_src_id(src), src->len, actual_written);
 
     /*
      * AON - We do not publicly admit to having appended anything until AON
@@ -1113,11 +1158,12 @@ static int quic_write_nonblocking_aon(QUIC_CONNECTION *qc, const void *buf,
 }
 
 QUIC_NEEDS_LOCK
-static int quic_write_nonblocking_epw(QUIC_CONNECTION *qc, const void *buf, size_t len,
+static int quic_write_nonblocking_epw(QUIC_CONNECTION *qc,
+                                      const QUIC_WRITE_SRC *src,
                                       size_t *written)
 {
     /* Simple best effort operation. */
-    if (!ossl_quic_sstream_append(qc->stream0->sstream, buf, len, written)) {
+    if (!quic_write_src_append(qc, src, 0, written)) {
         /* Stream already finished or allocation error. */
         *written = 0;
         return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
@@ -1128,7 +1174,7 @@ static int quic_write_nonblocking_epw(QUIC_CONNECTION *qc, const void *buf, size
 }
 
 QUIC_TAKES_LOCK
-int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written)
+static int quic_write(SSL *s, const QUIC_WRITE_SRC *src, size_t *written)
 {
     int ret;
     QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
@@ -1161,17 +1207,46 @@ int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written)
     }
 
     if (blocking_mode(qc))
-        ret = quic_write_blocking(qc, buf, len, written);
+        ret = quic_write_blocking(qc, src, written);
     else if (partial_write)
-        ret = quic_write_nonblocking_epw(qc, buf, len, written);
+        ret = quic_write_nonblocking_epw(qc, src, written);
     else
-        ret = quic_write_nonblocking_aon(qc, buf, len, written);
+        ret = quic_write_nonblocking_aon(qc, src, written);
 
 out:
     quic_unlock(qc);
     return ret;
 }
 
+QUIC_TAKES_LOCK
+int ossl_quic_write(SSL *s, const void *buf, size_t len, size_t *written)
+{
+    QUIC_WRITE_SRC src;
+
+    src.buf     = buf;
+    src.iov     = NULL;
+    src.iovcnt  = 0;
+    src.len     = len;
+    return quic_write(s, &src, written);
+}
+
+/* SSL_writev_ex */
+QUIC_TAKES_LOCK
+int ossl_quic_writev(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                     size_t *written)
+{
+    QUIC_WRITE_SRC src;
+    size_t i;
+
+    src.buf     = NULL;
+    src.iov     = iov;
+    src.iovcnt  = iovcnt;
+    src.len     = 0;
+    for (i = 0; i < iovcnt; i++)
+        src.len += iov[i].data_len;
+    return quic_write(s, &src, written);
+}
+
 /*
  * SSL_read
  * --------
@@ -1185,6 +1260,33 @@ struct quic_read_again_args {
     int             peek;
 };
 
+/*
+ * Informs the stream-level RXFC of the retirement of num_bytes bytes of stream
+ * data by the application and updates the active stream status, as the RXFC
+ * may now want to emit a frame granting more credit to the peer. The RSTREAM of
+ * an application stream has no RXFC of its own, so every path which consumes
+ * received stream data (SSL_read and SSL_read_release) must call this.
+ */
+QUIC_NEEDS_LOCK
+static int quic_retire_recv(QUIC_CONNECTION *qc, QUIC_STREAM *stream,
+                            size_t num_bytes)
+{
+    OSSL_RTT_INFO rtt_info;
+
+    if (num_bytes == 0)
+        return 1;
+
+    ossl_statm_get_rtt_info(ossl_quic_channel_get_statm(qc->ch), &rtt_info);
+
+    if (!ossl_quic_rxfc_on_retire(&stream->rxfc, num_bytes,
+                                  rtt_info.smoothed_rtt))
+        return 0;
+
+    ossl_quic_stream_map_update_state(ossl_quic_channel_get_qsm(qc->ch),
+                                      stream);
+    return 1;
+}
+
 QUIC_NEEDS_LOCK
 static int quic_read_actual(QUIC_CONNECTION *qc,
                             QUIC_STREAM *stream,
@@ -1201,6 +1303,11 @@ static int quic_read_actual(QUIC_CONNECTION *qc,
     if (stream->rstream == NULL)
         return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
 
+    /* Borrowed data must be released before the stream can be read again. */
+    if (stream->read_borrowed)
+        return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           NULL);
+
     if (peek) {
         if (!ossl_quic_rstream_peek(stream->rstream, buf, buf_len,
                                     bytes_read, &is_fin))
@@ -1213,28 +1320,11 @@ static int quic_read_actual(QUIC_CONNECTION *qc,
     }
 
     if (!peek) {
-        if (*bytes_read > 0) {
-            /*
-             * We have read at least one byte from the stream. Inform stream-level
-             * RXFC of the retirement of controlled bytes. Update the active stream
-             * status (the RXFC may now want to emit a frame granting more credit to
-             * the peer).
-             */
-            OSSL_RTT_INFO rtt_info;
-
-            ossl_statm_get_rtt_info(ossl_quic_channel_get_statm(qc->ch), &rtt_info);
-
-            if (!ossl_quic_rxfc_on_retire(&qc->stream0->rxfc, *bytes_read,
-                                          rtt_info.smoothed_rtt))
-                return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
-        }
-
         if (is_fin)
             stream->recv_fin_retired = 1;
 
-        if (*bytes_read > 0)
-            ossl_quic_stream_map_update_state(ossl_quic_channel_get_qsm(qc->ch),
-                                              qc->stream0);
+        if (!quic_retire_recv(qc, stream, *bytes_read))
+            return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
     }
 
     return 1;
@@ -1348,6 +1438,200 @@ int ossl_quic_peek(SSL *s, void *buf, size_t len, size_t *bytes_read)
     return quic_read(s, buf, len, bytes_read, 1);
 }
 
+/*
+ * SSL_read_borrow_ex
+ * ------------------
+ */
+struct quic_borrow_again_args {
+    QUIC_CONNECTION     *qc;
+    QUIC_STREAM         *stream;
+    const unsigned char **buf;
+    size_t              *bytes_read;
+};
+
+QUIC_NEEDS_LOCK
+static int quic_borrow_actual(QUIC_CONNECTION *qc,
+                              QUIC_STREAM *stream,
+                              const unsigned char **buf,
+                              size_t *bytes_read)
+{
+    int is_fin = 0;
+
+    /* If the receive part of the stream is over, issue EOF. */
+    if (stream->recv_fin_retired)
+        return QUIC_RAISE_NORMAL_ERROR(qc, SSL_ERROR_ZERO_RETURN);
+
+    if (stream->rstream == NULL)
+        return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+
+    if (stream->read_borrowed)
+        return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED,
+                                           NULL);
+
+    /*
+     * Lock the first contiguous chunk of stream data. This references the
+     * decrypted packet directly, so no data is copied.
+     */
+    if (!ossl_quic_rstream_get_record(stream->rstream, buf, bytes_read,
+                                      &is_fin))
+        return QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+
+    if (*bytes_read == 0) {
+        /*
+         * Either there is nothing to read yet, or we hit an empty final frame,
+         * which ossl_quic_rstream_get_record() has already dropped.
+         */
+        *buf = NULL;
+        if (is_fin) {
+            stream->recv_fin_retired = 1;
+            return QUIC_RAISE_NORMAL_ERROR(qc, SSL_ERROR_ZERO_RETURN);
+        }
+
+        return 1;
+    }
+
+    stream->read_borrowed   = 1;
+    stream->borrow_fin      = is_fin;
+    stream->borrow_len      = *bytes_read;
+    return 1;
+}
+
+QUIC_NEEDS_LOCK
+static int quic_borrow_again(void *arg)
+{
+    struct quic_borrow_again_args *args = arg;
+
+    if (!ossl_quic_channel_is_active(args->qc->ch)) {
+        /* If connection is torn down due to an error while blocking, stop. */
+        QUIC_RAISE_NON_NORMAL_ERROR(args->qc, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        return -1;
+    }
+
+    if (!quic_borrow_actual(args->qc, args->stream, args->buf,
+                            args->bytes_read))
+        return -1;
+
+    return *args->bytes_read > 0;
+}
+
+QUIC_TAKES_LOCK
+int ossl_quic_read_borrow(SSL *s, const unsigned char **buf,
+                          size_t *bytes_read)
+{
+    int ret, res;
+    QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
+    struct quic_borrow_again_args args;
+
+    *buf        = NULL;
+    *bytes_read = 0;
+
+    if (!expect_quic_conn(qc))
+        return 0;
+
+    quic_lock(qc);
+
+    if (qc->ch != NULL && ossl_quic_channel_is_term_any(qc->ch)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, SSL_R_PROTOCOL_IS_SHUTDOWN, NULL);
+        goto out;
+    }
+
+    /* If we haven't finished the handshake, try to advance it. */
+    if (quic_do_handshake(qc) < 1) {
+        ret = 0; /* ossl_quic_do_handshake raised error here */
+        goto out;
+    }
+
+    if (qc->stream0 == NULL) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    if (!quic_borrow_actual(qc, qc->stream0, buf, bytes_read)) {
+        ret = 0; /* quic_borrow_actual raised error here */
+        goto out;
+    }
+
+    if (*bytes_read > 0) {
+        ret = 1;
+    } else if (blocking_mode(qc)) {
+        args.qc         = qc;
+        args.stream     = qc->stream0;
+        args.buf        = buf;
+        args.bytes_read = bytes_read;
+
+        res = block_until_pred(qc, quic_borrow_again, &args, 0);
+        if (res == 0) {
+            ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        } else if (res < 0) {
+            ret = 0; /* quic_borrow_again raised error here */
+            goto out;
+        }
+
+        ret = 1;
+    } else {
+        /* We did not get any bytes and are not in blocking mode. */
+        ret = QUIC_RAISE_NORMAL_ERROR(qc, SSL_ERROR_WANT_READ);
+    }
+
+out:
+    quic_unlock(qc);
+    return ret;
+}
+
+/*
+ * SSL_read_release
+ * ----------------
+ */
+QUIC_TAKES_LOCK
+int ossl_quic_read_release(SSL *s, size_t consumed)
+{
+    int ret = 1;
+    QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
+    QUIC_STREAM *stream;
+
+    if (!expect_quic_conn(qc))
+        return 0;
+
+    quic_lock(qc);
+
+    stream = qc->stream0;
+    if (stream == NULL || !stream->read_borrowed
+        || consumed > stream->borrow_len) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_PASSED_INVALID_ARGUMENT,
+                                          NULL);
+        goto out;
+    }
+
+    /*
+     * Whatever happens, the borrow is over; any part of the data which was
+     * not consumed remains in the stream and is returned by the next read.
+     */
+    stream->read_borrowed = 0;
+    if (!ossl_quic_rstream_release_record(stream->rstream, consumed)) {
+        ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+        goto out;
+    }
+
+    if (consumed > 0) {
+        if (stream->borrow_fin && consumed == stream->borrow_len)
+            stream->recv_fin_retired = 1;
+
+        /* Return flow control credit for the consumed bytes to the peer. */
+        if (!quic_retire_recv(qc, stream, consumed)) {
+            ret = QUIC_RAISE_NON_NORMAL_ERROR(qc, ERR_R_INTERNAL_ERROR, NULL);
+            goto out;
+        }
+
+        /* Tick the reactor as SSL_read does after reading data. */
+        ossl_quic_reactor_tick(ossl_quic_channel_get_reactor(qc->ch), 0);
+    }
+
+out:
+    quic_unlock(qc);
+    return ret;
+}
+
 /*
  * SSL_pending
  * -----------
@@ -0,0 +1,796 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <openssl/rand.h>
+#include <openssl/evp.h>
+#include <openssl/core_names.h>
+#include <openssl/err.h>
+#include "internal/quic_listener.h"
+#include "internal/quic_wire_pkt.h"
+#include "internal/priority_queue.h"
+#include "internal/packet.h"
+#include "internal/list.h"
+#include "internal/common.h"
+
+/*
+ * QUIC Listener
+ * =============
+ */
+
+/* Maximum number of times we pump the DEMUX in a single tick. */
+#define LISTENER_MAX_PUMPS_PER_TICK     16
+
+/* RFC 9000 s. 7.2: the DCID of a client's first Initial is at least 8 bytes. */
+#define LISTENER_MIN_ODCID_LEN          8
+
+/*
+ * Retry tokens have the following format:
+ *
+ *   Magic (1 byte)
+ *   Issue Time (8 bytes, milliseconds, network byte order)
+ *   Original DCID Length (1 byte)
+ *   Original DCID (0..20 bytes)
+ *   Tag (16 bytes)
+ *
+ * The tag is a truncated HMAC-SHA256 over the preceding fields, the DCID the
+ * client uses to respond to the Retry (which is the SCID of the Retry packet)
+ * and the client's address.
+ */
+#define RETRY_TOKEN_MAGIC               0x52
+#define RETRY_TOKEN_KEY_LEN             32
+#define RETRY_TOKEN_TAG_LEN             16
+#define RETRY_TOKEN_MAX_LEN             (1 + 8 + 1 + QUIC_MAX_CONN_ID_LEN \
+                                         + RETRY_TOKEN_TAG_LEN)
+#define RETRY_TOKEN_LIFETIME_MS         10000
+
+struct quic_listener_conn_st {
+    /* All connections. */
+    OSSL_LIST_MEMBER(conn, QUIC_LISTENER_CONN);
+    /* Connections due to be ticked. */
+    OSSL_LIST_MEMBER(ready, QUIC_LISTENER_CONN);
+    /* Connections waiting to be able to write to the network. */
+    OSSL_LIST_MEMBER(blocked, QUIC_LISTENER_CONN);
+    /* Connections which have completed the handshake but not been accepted. */
+    OSSL_LIST_MEMBER(accept, QUIC_LISTENER_CONN);
+
+    QUIC_LISTENER   *ql;
+    QUIC_CHANNEL    *ch;
+    SSL             *tls;
+
+    /* Tick deadline, and our handle in the deadline queue if in_pq is set. */
+    OSSL_TIME       deadline;
+    size_t          pq_elem;
+
+    unsigned int    in_pq       : 1;
+    unsigned int    on_ready    : 1;
+    unsigned int    on_blocked  : 1;
+    unsigned int    on_accept   : 1;
+    unsigned int    accepted    : 1;
+    unsigned int    released    : 1;
+};
+
+DEFINE_LIST_OF(conn, QUIC_LISTENER_CONN);
+DEFINE_LIST_OF(ready, QUIC_LISTENER_CONN);
+DEFINE_LIST_OF(blocked, QUIC_LISTENER_CONN);
+DEFINE_LIST_OF(accept, QUIC_LISTENER_CONN);
+DEFINE_PRIORITY_QUEUE_OF(QUIC_LISTENER_CONN);
+
+struct quic_listener_st {
+    QUIC_LISTENER_ARGS                      args;
+
+    /* The mutex we give to all of our channels. */
+    CRYPTO_MUTEX                            *mutex;
+
+    /* The DEMUX shared by all of our channels. */
+    QUIC_DEMUX                              *demux;
+
+    QUIC_REACTOR                            rtor;
+
+    OSSL_LIST(conn)                         conns;
+    OSSL_LIST(ready)                        ready;
+    OSSL_LIST(blocked)                      blocked;
+    OSSL_LIST(accept)                       accept;
+
+    /* Connections with a finite tick deadline, ordered by that deadline. */
+    PRIORITY_QUEUE_OF(QUIC_LISTENER_CONN)   *pq;
+
+    /* Keyed HMAC context used to authenticate Retry tokens. */
+    EVP_MAC_CTX                             *token_mac;
+};
+
+static void ql_tick(QUIC_TICK_RESULT *res, void *arg, uint32_t flags);
+static void ql_on_unknown_dcid(QUIC_URXE *e, void *arg);
+static void ql_conn_free(QUIC_LISTENER_CONN *lc);
+
+static OSSL_TIME get_time(void *arg)
+{
+    QUIC_LISTENER *ql = arg;
+
+    if (ql->args.now_cb == NULL)
+        return ossl_time_now();
+
+    return ql->args.now_cb(ql->args.now_cb_arg);
+}
+
+static int conn_deadline_cmp(const QUIC_LISTENER_CONN *a,
+                             const QUIC_LISTENER_CONN *b)
+{
+    return ossl_time_compare(a->deadline, b->deadline);
+}
+
+static int ql_init_token_mac(QUIC_LISTENER *ql)
+{
+    int ok = 0;
+    EVP_MAC *mac = NULL;
+    unsigned char key[RETRY_TOKEN_KEY_LEN];
+    OSSL_PARAM params[2];
+
+    if (RAND_priv_bytes_ex(ql->args.libctx, key, sizeof(key), 0) != 1)
+        goto err;
+
+    if ((mac = EVP_MAC_fetch(ql->args.libctx, OSSL_MAC_NAME_HMAC,
+                             ql->args.propq)) == NULL)
+        goto err;
+
+    if ((ql->token_mac = EVP_MAC_CTX_new(mac)) == NULL)
+        goto err;
+
+    params[0] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                                 (char *)OSSL_DIGEST_NAME_SHA2_256,
+                                                 0);
+    params[1] = OSSL_PARAM_construct_end();
+
+    if (!EVP_MAC_init(ql->token_mac, key, sizeof(key), params))
+        goto err;
+
+    ok = 1;
+err:
+    OPENSSL_cleanse(key, sizeof(key));
+    EVP_MAC_free(mac);
+    return ok;
+}
+
+static int validate_poll_descriptor(const BIO_POLL_DESCRIPTOR *d)
+{
+    if (d->type == BIO_POLL_DESCRIPTOR_TYPE_SOCK_FD && d->value.fd < 0)
+        return 0;
+
+    return 1;
+}
+
+QUIC_LISTENER *ossl_quic_listener_new(const QUIC_LISTENER_ARGS *args)
+{
+    QUIC_LISTENER *ql = NULL;
+    BIO_POLL_DESCRIPTOR d = {0};
+
+    if (args->ctx == NULL || args->net_rbio == NULL || args->net_wbio == NULL)
+        return NULL;
+
+    if ((ql = OPENSSL_zalloc(sizeof(*ql))) == NULL)
+        return NULL;
+
+    ql->args = *args;
+    if (!SSL_CTX_up_ref(ql->args.ctx)) {
+        OPENSSL_free(ql);
+        return NULL;
+    }
+
+    if ((ql->mutex = ossl_crypto_mutex_new()) == NULL)
+        goto err;
+
+    if ((ql->demux = ossl_quic_demux_new(ql->args.net_rbio,
+                                         QUIC_CHANNEL_SERVER_CID_LEN,
+                                         get_time, ql)) == NULL)
+        goto err;
+
+    ossl_quic_demux_set_default_handler(ql->demux, ql_on_unknown_dcid, ql);
+
+    if ((ql->pq = ossl_pqueue_QUIC_LISTENER_CONN_new(conn_deadline_cmp)) == NULL)
+        goto err;
+
+    if (!ql_init_token_mac(ql))
+        goto err;
+
+    ossl_quic_reactor_init(&ql->rtor, ql_tick, ql, ossl_time_infinite());
+
+    if (!BIO_get_rpoll_descriptor(ql->args.net_rbio, &d))
+        d.type = BIO_POLL_DESCRIPTOR_TYPE_NONE;
+    if (!validate_poll_descriptor(&d))
+        goto err;
+    ossl_quic_reactor_set_poll_r(&ql->rtor, &d);
+
+    if (!BIO_get_wpoll_descriptor(ql->args.net_wbio, &d))
+        d.type = BIO_POLL_DESCRIPTOR_TYPE_NONE;
+    if (!validate_poll_descriptor(&d))
+        goto err;
+    ossl_quic_reactor_set_poll_w(&ql->rtor, &d);
+
+    return ql;
+
+err:
+    ossl_quic_listener_free(ql);
+    return NULL;
+}
+
+void ossl_quic_listener_free(QUIC_LISTENER *ql)
+{
+    QUIC_LISTENER_CONN *lc, *lc_next;
+
+    if (ql == NULL)
+        return;
+
+    for (lc = ossl_list_conn_head(&ql->conns); lc != NULL; lc = lc_next) {
+        lc_next = ossl_list_conn_next(lc);
+        ql_conn_free(lc);
+    }
+
+    EVP_MAC_CTX_free(ql->token_mac);
+    ossl_pqueue_QUIC_LISTENER_CONN_free(ql->pq);
+    ossl_quic_demux_free(ql->demux);
+    ossl_crypto_mutex_free(&ql->mutex);
+    SSL_CTX_free(ql->args.ctx);
+    OPENSSL_free(ql);
+}
+
+QUIC_REACTOR *ossl_quic_listener_get_reactor(QUIC_LISTENER *ql)
+{
+    return &ql->rtor;
+}
+
+CRYPTO_MUTEX *ossl_quic_listener_get_mutex(QUIC_LISTENER *ql)
+{
+    return ql->mutex;
+}
+
+size_t ossl_quic_listener_get_num_conns(const QUIC_LISTENER *ql)
+{
+    return ossl_list_conn_num(&ql->conns);
+}
+
+/*
+ * QUIC Listener: Connection Management
+ * ====================================
+ */
+static void ql_conn_on_rx(void *arg)
+{
+    QUIC_LISTENER_CONN *lc = arg;
+
+    if (!lc->on_ready) {
+        ossl_list_ready_insert_tail(&lc->ql->ready, lc);
+        lc->on_ready = 1;
+    }
+}
+
+static QUIC_LISTENER_CONN *ql_conn_new(QUIC_LISTENER *ql)
+{
+    QUIC_LISTENER_CONN *lc;
+    QUIC_CHANNEL_ARGS ch_args = {0};
+
+    if ((lc = OPENSSL_zalloc(sizeof(*lc))) == NULL)
+        return NULL;
+
+    lc->ql = ql;
+
+    if ((lc->tls = SSL_new(ql->args.ctx)) == NULL)
+        goto err;
+
+    ch_args.libctx      = ql->args.libctx;
+    ch_args.propq       = ql->args.propq;
+    ch_args.tls         = lc->tls;
+    ch_args.mutex       = ql->mutex;
+    ch_args.is_server   = 1;
+    ch_args.now_cb      = ql->args.now_cb;
+    ch_args.now_cb_arg  = ql->args.now_cb_arg;
+    ch_args.cc_method   = ql->args.cc_method;
+    ch_args.demux       = ql->demux;
+
+    if ((lc->ch = ossl_quic_channel_new(&ch_args)) == NULL)
+        goto err;
+
+    if (!ossl_quic_channel_set_net_rbio(lc->ch, ql->args.net_rbio)
+        || !ossl_quic_channel_set_net_wbio(lc->ch, ql->args.net_wbio)
+        || !ossl_quic_channel_set_rx_notify_cb(lc->ch, ql_conn_on_rx, lc))
+        goto err;
+
+    ossl_list_conn_insert_tail(&ql->conns, lc);
+    return lc;
+
+err:
+    ossl_quic_channel_free(lc->ch);
+    SSL_free(lc->tls);
+    OPENSSL_free(lc);
+    return NULL;
+}
+
+static void ql_conn_free(QUIC_LISTENER_CONN *lc)
+{
+    QUIC_LISTENER *ql = lc->ql;
+
+    if (lc->in_pq)
+        ossl_pqueue_QUIC_LISTENER_CONN_remove(ql->pq, lc->pq_elem);
+    if (lc->on_ready)
+        ossl_list_ready_remove(&ql->ready, lc);
+    if (lc->on_blocked)
+        ossl_list_blocked_remove(&ql->blocked, lc);
+    if (lc->on_accept)
+        ossl_list_accept_remove(&ql->accept, lc);
+    ossl_list_conn_remove(&ql->conns, lc);
+
+    ossl_quic_channel_free(lc->ch);
+    SSL_free(lc->tls);
+    OPENSSL_free(lc);
+}
+
+/* (Re)schedule a connection in the deadline queue. */
+static int ql_conn_schedule(QUIC_LISTENER_CONN *lc, OSSL_TIME deadline)
+{
+    QUIC_LISTENER *ql = lc->ql;
+
+    if (lc->in_pq) {
+        ossl_pqueue_QUIC_LISTENER_CONN_remove(ql->pq, lc->pq_elem);
+        lc->in_pq = 0;
+    }
+
+    lc->deadline = deadline;
+    if (ossl_time_is_infinite(deadline))
+        return 1;
+
+    if (!ossl_pqueue_QUIC_LISTENER_CONN_push(ql->pq, lc, &lc->pq_elem))
+        return 0;
+
+    lc->in_pq = 1;
+    return 1;
+}
+
+/*
+ * Tick a single connection and update our records of it. The connection may be
+ * freed by this call.
+ */
+static int ql_conn_tick(QUIC_LISTENER_CONN *lc)
+{
+    QUIC_LISTENER *ql = lc->ql;
+    QUIC_REACTOR *rtor = ossl_quic_channel_get_reactor(lc->ch);
+
+    ossl_quic_reactor_tick(rtor, 0); /* best effort */
+
+    /*
+     * Free terminated connections, unless the application still holds a
+     * reference to them.
+     */
+    if (ossl_quic_channel_is_terminated(lc->ch)
+        && (!lc->accepted || lc->released)) {
+        ql_conn_free(lc);
+        return 1;
+    }
+
+    /* A connection can be accepted once its handshake is complete. */
+    if (!lc->accepted && !lc->on_accept
+        && ossl_quic_channel_is_active(lc->ch)
+        && ossl_quic_channel_is_handshake_complete(lc->ch)) {
+        ossl_list_accept_insert_tail(&ql->accept, lc);
+        lc->on_accept = 1;
+    }
+
+    if (ossl_quic_reactor_net_write_desired(rtor) && !lc->on_blocked) {
+        ossl_list_blocked_insert_tail(&ql->blocked, lc);
+        lc->on_blocked = 1;
+    }
+
+    return ql_conn_schedule(lc, ossl_quic_reactor_get_tick_deadline(rtor));
+}
+
+QUIC_LISTENER_CONN *ossl_quic_listener_accept(QUIC_LISTENER *ql)
+{
+    QUIC_LISTENER_CONN *lc = ossl_list_accept_head(&ql->accept);
+
+    if (lc == NULL)
+        return NULL;
+
+    ossl_list_accept_remove(&ql->accept, lc);
+    lc->on_accept = 0;
+    lc->accepted  = 1;
+    return lc;
+}
+
+QUIC_CHANNEL *ossl_quic_listener_conn_get0_channel(QUIC_LISTENER_CONN *lc)
+{
+    return lc->ch;
+}
+
+int ossl_quic_listener_conn_tick(QUIC_LISTENER_CONN *lc)
+{
+    if (!ossl_assert(lc->accepted && !lc->released))
+        return 0;
+
+    return ql_conn_tick(lc);
+}
+
+void ossl_quic_listener_conn_release(QUIC_LISTENER_CONN *lc)
+{
+    if (lc == NULL || !ossl_assert(lc->accepted && !lc->released))
+        return;
+
+    lc->released = 1;
+    ql_conn_tick(lc);
+}
+
+/*
+ * QUIC Listener: Ticking
+ * ======================
+ */
+static void ql_tick(QUIC_TICK_RESULT *res, void *arg, uint32_t flags)
+{
+    QUIC_LISTENER *ql = arg;
+    QUIC_LISTENER_CONN *lc;
+    OSSL_TIME now;
+    size_t i;
+
+    /*
+     * Read from the network. The DEMUX routes datagrams for known DCIDs to the
+     * QRX of the corresponding channel, which causes ql_conn_on_rx() to mark
+     * the connection as ready, and passes anything else to
+     * ql_on_unknown_dcid().
+     */
+    for (i = 0; i < LISTENER_MAX_PUMPS_PER_TICK; ++i)
+        if (ossl_quic_demux_pump(ql->demux) != QUIC_DEMUX_PUMP_RES_OK)
+            break;
+
+    /* Connections whose deadline has passed are ready. */
+    now = get_time(ql);
+    while ((lc = ossl_pqueue_QUIC_LISTENER_CONN_peek(ql->pq)) != NULL
+           && ossl_time_compare(lc->deadline, now) <= 0) {
+        ossl_pqueue_QUIC_LISTENER_CONN_pop(ql->pq);
+        lc->in_pq = 0;
+        ql_conn_on_rx(lc);
+    }
+
+    /* Connections waiting to write may be able to do so now. */
+    while ((lc = ossl_list_blocked_head(&ql->blocked)) != NULL) {
+        ossl_list_blocked_remove(&ql->blocked, lc);
+        lc->on_blocked = 0;
+        ql_conn_on_rx(lc);
+    }
+
+    while ((lc = ossl_list_ready_head(&ql->ready)) != NULL) {
+        ossl_list_ready_remove(&ql->ready, lc);
+        lc->on_ready = 0;
+        ql_conn_tick(lc); /* best effort */
+    }
+
+    lc = ossl_pqueue_QUIC_LISTENER_CONN_peek(ql->pq);
+    res->tick_deadline      = lc != NULL ? lc->deadline : ossl_time_infinite();
+    res->net_read_desired   = 1;
+    res->net_write_desired  = !ossl_list_blocked_is_empty(&ql->blocked);
+}
+
+int ossl_quic_listener_tick(QUIC_LISTENER *ql)
+{
+    return ossl_quic_reactor_tick(&ql->rtor, 0);
+}
+
+/*
+ * QUIC Listener: Stateless Responses
+ * ==================================
+ */
+static int ql_send_dgram(QUIC_LISTENER *ql, const unsigned char *buf,
+                         size_t buf_len, const BIO_ADDR *peer)
+{
+    BIO_MSG msg = {0};
+    size_t written;
+    int ok;
+
+    msg.data        = (unsigned char *)buf;
+    msg.data_len    = buf_len;
+    msg.peer        = BIO_ADDR_family(peer) != AF_UNSPEC
+                      ? (BIO_ADDR *)peer : NULL;
+
+    /*
+     * Best effort: stateless responses are never retransmitted by us, and if
+     * one is lost the peer simply retransmits the packet which caused it. So
+     * callers ignore a failure to send and any error it raised is discarded.
+     */
+    ERR_set_mark();
+    ok = BIO_sendmmsg(ql->args.net_wbio, &msg, sizeof(msg), 1, 0, &written);
+    ERR_pop_to_mark();
+    return ok;
+}
+
+/* RFC 9000 s. 6.1, 17.2.1 */
+static void ql_send_version_neg(QUIC_LISTENER *ql, QUIC_URXE *e)
+{
+    PACKET pkt;
+    WPACKET wpkt;
+    QUIC_PKT_HDR hdr = {0};
+    unsigned int dcid_len, scid_len;
+    unsigned char buf[64];
+    size_t written = 0;
+
+    /*
+     * We cannot use the usual header decoder as the packet is of an unknown
+     * version. Only the version-independent fields (RFC 8999) can be parsed.
+     * The client's SCID and DCID become our DCID and SCID, respectively.
+     */
+    if (!PACKET_buf_init(&pkt, ossl_quic_urxe_data(e), e->data_len)
+        || !PACKET_forward(&pkt, 1 + 4)
+        || !PACKET_get_1(&pkt, &dcid_len)
+        || dcid_len > QUIC_MAX_CONN_ID_LEN
+        || !PACKET_copy_bytes(&pkt, hdr.src_conn_id.id, dcid_len)
+        || !PACKET_get_1(&pkt, &scid_len)
+        || scid_len > QUIC_MAX_CONN_ID_LEN
+        || !PACKET_copy_bytes(&pkt, hdr.dst_conn_id.id, scid_len))
+        return;
+
+    hdr.type                = QUIC_PKT_TYPE_VERSION_NEG;
+    hdr.version             = QUIC_VERSION_NONE;
+    hdr.fixed               = 1;
+    hdr.dst_conn_id.id_len  = (unsigned char)scid_len;
+    hdr.src_conn_id.id_len  = (unsigned char)dcid_len;
+
+    if (!WPACKET_init_static_len(&wpkt, buf, sizeof(buf), 0))
+        return;
+
+    if (!ossl_quic_wire_encode_pkt_hdr(&wpkt, scid_len, &hdr, NULL)
+        || !WPACKET_put_bytes_u32(&wpkt, QUIC_VERSION_1)
+        || !WPACKET_get_total_written(&wpkt, &written)
+        || !WPACKET_finish(&wpkt)) {
+        WPACKET_cleanup(&wpkt);
+        return;
+    }
+
+    ql_send_dgram(ql, buf, written, &e->peer);
+}
+
+/*
+ * Compute the tag for a Retry token whose other fields are in token[0..len).
+ * retry_scid is the SCID of the Retry packet the token is sent in.
+ */
+static int ql_retry_token_tag(QUIC_LISTENER *ql,
+                              const unsigned char *token, size_t len,
+                              const QUIC_CONN_ID *retry_scid,
+                              const BIO_ADDR *peer,
+                              unsigned char *tag)
+{
+    unsigned char addr[32], info[4], md[EVP_MAX_MD_SIZE];
+    size_t addr_len = 0, md_len = 0;
+    int family = BIO_ADDR_family(peer);
+    unsigned short port = 0;
+
+    if (family != AF_UNSPEC) {
+        if (!BIO_ADDR_rawaddress(peer, NULL, &addr_len)
+            || addr_len > sizeof(addr)
+            || !BIO_ADDR_rawaddress(peer, addr, &addr_len))
+            return 0;
+
+        port = BIO_ADDR_rawport(peer);
+    }
+
+    info[0] = (unsigned char)(family >> 8);
+    info[1] = (unsigned char)family;
+    info[2] = (unsigned char)(port >> 8);
+    info[3] = (unsigned char)port;
+
+    if (!EVP_MAC_init(ql->token_mac, NULL, 0, NULL)
+        || !EVP_MAC_update(ql->token_mac, token, len)
+        || !EVP_MAC_update(ql->token_mac, &retry_scid->id_len, 1)
+        || !EVP_MAC_update(ql->token_mac, retry_scid->id, retry_scid->id_len)
+        || !EVP_MAC_update(ql->token_mac, info, sizeof(info))
+        || !EVP_MAC_update(ql->token_mac, addr, addr_len)
+        || !EVP_MAC_final(ql->token_mac, md, &md_len, sizeof(md))
+        || md_len < RETRY_TOKEN_TAG_LEN)
+        return 0;
+
+    memcpy(tag, md, RETRY_TOKEN_TAG_LEN);
+    return 1;
+}
+
+static int ql_generate_retry_token(QUIC_LISTENER *ql,
+                                   const QUIC_CONN_ID *odcid,
+                                   const QUIC_CONN_ID *retry_scid,
+                                   const BIO_ADDR *peer,
+                                   unsigned char *token, size_t *token_len)
+{
+    uint64_t issued = ossl_time2ms(get_time(ql));
+    size_t len = 0;
+    int i;
+
+    token[len++] = RETRY_TOKEN_MAGIC;
+    for (i = 7; i >= 0; --i)
+        token[len++] = (unsigned char)(issued >> (i * 8));
+
+    token[len++] = odcid->id_len;
+    memcpy(token + len, odcid->id, odcid->id_len);
+    len += odcid->id_len;
+
+    if (!ql_retry_token_tag(ql, token, len, retry_scid, peer, token + len))
+        return 0;
+
+    *token_len = len + RETRY_TOKEN_TAG_LEN;
+    return 1;
+}
+
+/*
+ * Validates a Retry token received in an Initial packet with the given DCID.
+ * On success, writes the DCID of the client's first Initial packet to *odcid.
+ */
+static int ql_validate_retry_token(QUIC_LISTENER *ql,
+                                   const unsigned char *token, size_t token_len,
+                                   const QUIC_CONN_ID *dcid,
+                                   const BIO_ADDR *peer,
+                                   QUIC_CONN_ID *odcid)
+{
+    unsigned char tag[RETRY_TOKEN_TAG_LEN];
+    uint64_t issued = 0, now;
+    size_t len, i;
+
+    if (token_len < 1 + 8 + 1 + RETRY_TOKEN_TAG_LEN
+        || token_len > RETRY_TOKEN_MAX_LEN
+        || token[0] != RETRY_TOKEN_MAGIC)
+        return 0;
+
+    len = token_len - RETRY_TOKEN_TAG_LEN;
+    if (token[9] != len - 10)
+        return 0;
+
+    if (!ql_retry_token_tag(ql, token, len, dcid, peer, tag)
+        || CRYPTO_memcmp(tag, token + len, RETRY_TOKEN_TAG_LEN) != 0)
+        return 0;
+
+    for (i = 1; i < 9; ++i)
+        issued = (issued << 8) | token[i];
+
+    now = ossl_time2ms(get_time(ql));
+    if (issued > now || now - issued > RETRY_TOKEN_LIFETIME_MS)
+        return 0;
+
+    odcid->id_len = token[9];
+    memcpy(odcid->id, token + 10, odcid->id_len);
+    return 1;
+}
+
+/* RFC 9000 s. 8.1.2, 17.2.5 */
+static void ql_send_retry(QUIC_LISTENER *ql, QUIC_URXE *e,
+                          const QUIC_PKT_HDR *init_hdr)
+{
+    WPACKET wpkt;
+    QUIC_PKT_HDR hdr = {0};
+    unsigned char buf[128], *body, *tag;
+    unsigned char token[RETRY_TOKEN_MAX_LEN];
+    size_t token_len = 0, written = 0;
+
+    hdr.src_conn_id.id_len = QUIC_CHANNEL_SERVER_CID_LEN;
+    if (RAND_bytes_ex(ql->args.libctx, hdr.src_conn_id.id,
+                      hdr.src_conn_id.id_len, 0) != 1)
+        return;
+
+    if (!ql_generate_retry_token(ql, &init_hdr->dst_conn_id, &hdr.src_conn_id,
+                                 &e->peer, token, &token_len))
+        return;
+
+    hdr.type        = QUIC_PKT_TYPE_RETRY;
+    hdr.version     = QUIC_VERSION_1;
+    hdr.fixed       = 1;
+    hdr.dst_conn_id = init_hdr->src_conn_id;
+    hdr.len         = token_len + QUIC_RETRY_INTEGRITY_TAG_LEN;
+
+    if (!WPACKET_init_static_len(&wpkt, buf, sizeof(buf), 0))
+        return;
+
+    if (!ossl_quic_wire_encode_pkt_hdr(&wpkt, hdr.dst_conn_id.id_len,
+                                       &hdr, NULL)
+        || (body = WPACKET_get_curr(&wpkt)) == NULL
+        || !WPACKET_memcpy(&wpkt, token, token_len)
+        || !WPACKET_allocate_bytes(&wpkt, QUIC_RETRY_INTEGRITY_TAG_LEN, &tag)
+        || !WPACKET_get_total_written(&wpkt, &written)
+        || !WPACKET_finish(&wpkt)) {
+        WPACKET_cleanup(&wpkt);
+        return;
+    }
+
+    hdr.data = body;
+    if (!ossl_quic_calculate_retry_integrity_tag(ql->args.libctx,
+                                                 ql->args.propq, &hdr,
+                                                 &init_hdr->dst_conn_id, tag))
+        return;
+
+    ql_send_dgram(ql, buf, written, &e->peer);
+}
+
+/*
+ * Called by the DEMUX for a datagram with a DCID not belonging to any of our
+ * connections.
+ */
+static void ql_on_unknown_dcid(QUIC_URXE *e, void *arg)
+{
+    QUIC_LISTENER *ql = arg;
+    QUIC_LISTENER_CONN *lc;
+    const unsigned char *data = ossl_quic_urxe_data(e);
+    PACKET pkt;
+    QUIC_PKT_HDR hdr;
+    QUIC_CONN_ID odcid;
+    uint32_t version;
+    int have_odcid = 0;
+
+    /*
+     * Only a client's first flight can establish a connection, and it is
+     * always padded to at least this size. Not responding to anything smaller
+     * also means our stateless responses are never larger than the datagram
+     * which elicited them.
+     */
+    if (e->data_len < QUIC_MIN_INITIAL_DGRAM_LEN || (data[0] & 0x80) == 0)
+        goto undesirable;
+
+    version = ((uint32_t)data[1] << 24) | ((uint32_t)data[2] << 16)
+              | ((uint32_t)data[3] << 8) | data[4];
+
+    /* Never respond to a Version Negotiation packet. */
+    if (version == QUIC_VERSION_NONE)
+        goto undesirable;
+
+    if (version != QUIC_VERSION_1) {
+        ql_send_version_neg(ql, e);
+        goto undesirable;
+    }
+
+    /*
+     * We set short_conn_id_len to SIZE_MAX here which will cause the decode
+     * operation to fail if we get a 1-RTT packet. This is fine since we only
+     * care about Initial packets.
+     */
+    if (!PACKET_buf_init(&pkt, data, e->data_len)
+        || !ossl_quic_wire_decode_pkt_hdr(&pkt, SIZE_MAX, 1, &hdr, NULL)
+        || hdr.type != QUIC_PKT_TYPE_INITIAL)
+        goto undesirable;
+
+    if (hdr.token_len > 0) {
+        /*
+         * We only issue tokens in Retry packets, so any other token (or a
+         * stale one) is invalid. Drop the packet; the client will eventually
+         * give up or start again without a token.
+         */
+        if (!ql_validate_retry_token(ql, hdr.token, hdr.token_len,
+                                     &hdr.dst_conn_id, &e->peer, &odcid))
+            goto undesirable;
+
+        have_odcid = 1;
+    } else {
+        if (hdr.dst_conn_id.id_len < LISTENER_MIN_ODCID_LEN)
+            goto undesirable;
+
+        if (ql->args.require_retry) {
+            ql_send_retry(ql, e, &hdr);
+            goto undesirable;
+        }
+    }
+
+    if (ql->args.max_conns > 0
+        && ossl_list_conn_num(&ql->conns) >= ql->args.max_conns)
+        goto undesirable;
+
+    if ((lc = ql_conn_new(ql)) == NULL)
+        goto undesirable;
+
+    /*
+     * The DCID in the client's Initial packet is not registered with the
+     * DEMUX until after the channel has provisioned the Initial keys derived
+     * from it, so the datagram is passed to the channel directly.
+     */
+    if (!ossl_quic_channel_on_new_conn(lc->ch, &e->peer,
+                                       &hdr.src_conn_id, &hdr.dst_conn_id,
+                                       have_odcid ? &odcid : NULL)) {
+        ql_conn_free(lc);
+        goto undesirable;
+    }
+
+    ossl_quic_channel_inject_urxe(lc->ch, e);
+    ql_conn_on_rx(lc);
+    return;
+
+undesirable:
+    ossl_quic_demux_release_urxe(ql->demux, e);
+}
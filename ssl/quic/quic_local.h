@@ -75,6 +75,9 @@ struct quic_conn_st {
     OSSL_TIME                       (*override_now_cb)(void *arg);
     void                            *override_now_cb_arg;
 
+    /* Congestion controller for the channel, or NULL for the default. */
+    const OSSL_CC_METHOD            *cc_method;
+
     /* Have we started? */
     unsigned int                    started                 : 1;
 
@@ -36,7 +36,9 @@ static ossl_inline int pkt_is_marked(const uint64_t *bitf, size_t pkt_idx)
  * ===
  *
  * RX Entries (RXEs) store processed (i.e., decrypted) data received from the
- * network. One RXE is used per received QUIC packet.
+ * network. One RXE is used per received QUIC packet. Encrypted packets are
+ * decrypted in place, so the payload of an RXE normally lives in the URXE it
+ * was received in, which is kept alive for as long as the RXE references it.
  */
 typedef struct rxe_st RXE;
 
@@ -60,6 +62,12 @@ struct rxe_st {
     /* Total length of the datagram which contained this packet. */
     size_t              datagram_len;
 
+    /*
+     * URXE holding the decrypted payload, or NULL if the payload was copied
+     * into the RXE buffer.
+     */
+    QUIC_URXE           *urxe;
+
     /*
      * alloc_len allocated bytes (of which data_len bytes are valid) follow this
      * structure.
@@ -143,6 +151,17 @@ struct ossl_qrx_st {
     ossl_qrx_key_update_cb         *key_update_cb;
     void                           *key_update_cb_arg;
 
+    /* RX notification callback. */
+    ossl_qrx_rx_notify_cb          *rx_notify_cb;
+    void                           *rx_notify_cb_arg;
+
+    /*
+     * Number of DCIDs currently registered with the DEMUX by us. If all of them
+     * have been removed explicitly, we can avoid walking the DEMUX's entire
+     * connection table on free, which matters when it is shared by many QRXs.
+     */
+    size_t                          num_dst_conn_ids;
+
     /* Initial key phase. For debugging use only; always 0 in real use. */
     unsigned char                   init_key_phase_bit;
 };
@@ -173,13 +192,26 @@ OSSL_QRX *ossl_qrx_new(const OSSL_QRX_ARGS *args)
     return qrx;
 }
 
-static void qrx_cleanup_rxl(RXE_LIST *l)
+/*
+ * Drops a reference to a URXE. The URXE is returned to the demuxer once the QRX
+ * has finished processing it and no RXE references its buffer any longer.
+ */
+static void qrx_urxe_unref(OSSL_QRX *qrx, QUIC_URXE *e)
+{
+    assert(e->qrx_refs > 0);
+    if (--e->qrx_refs == 0)
+        ossl_quic_demux_release_urxe(qrx->demux, e);
+}
+
+static void qrx_cleanup_rxl(OSSL_QRX *qrx, RXE_LIST *l)
 {
     RXE *e, *enext;
 
     for (e = ossl_list_rxe_head(l); e != NULL; e = enext) {
         enext = ossl_list_rxe_next(e);
         ossl_list_rxe_remove(l, e);
+        if (e->urxe != NULL)
+            qrx_urxe_unref(qrx, e->urxe);
         OPENSSL_free(e);
     }
 }
@@ -190,7 +222,8 @@ static void qrx_cleanup_urxl(OSSL_QRX *qrx, QUIC_URXE_LIST *l)
 
     for (e = ossl_list_urxe_head(l); e != NULL; e = enext) {
         enext = ossl_list_urxe_next(e);
-        ossl_quic_demux_release_urxe(qrx->demux, e);
+        ossl_list_urxe_remove(l, e);
+        qrx_urxe_unref(qrx, e);
     }
 }
 
@@ -202,11 +235,12 @@ void ossl_qrx_free(OSSL_QRX *qrx)
         return;
 
     /* Unregister from the RX DEMUX. */
-    ossl_quic_demux_unregister_by_cb(qrx->demux, qrx_on_rx, qrx);
+    if (qrx->num_dst_conn_ids > 0)
+        ossl_quic_demux_unregister_by_cb(qrx->demux, qrx_on_rx, qrx);
 
     /* Free RXE queue data. */
-    qrx_cleanup_rxl(&qrx->rx_free);
-    qrx_cleanup_rxl(&qrx->rx_pending);
+    qrx_cleanup_rxl(qrx, &qrx->rx_free);
+    qrx_cleanup_rxl(qrx, &qrx->rx_pending);
     qrx_cleanup_urxl(qrx, &qrx->urx_pending);
     qrx_cleanup_urxl(qrx, &qrx->urx_deferred);
 
@@ -223,6 +257,7 @@ void ossl_qrx_inject_urxe(OSSL_QRX *qrx, QUIC_URXE *urxe)
     urxe->processed     = 0;
     urxe->hpr_removed   = 0;
     urxe->deferred      = 0;
+    urxe->qrx_refs      = 1;
     ossl_list_urxe_insert_tail(&qrx->urx_pending, urxe);
 }
 
@@ -230,21 +265,33 @@ static void qrx_on_rx(QUIC_URXE *urxe, void *arg)
 {
     OSSL_QRX *qrx = arg;
     ossl_qrx_inject_urxe(qrx, urxe);
+
+    if (qrx->rx_notify_cb != NULL)
+        qrx->rx_notify_cb(qrx->rx_notify_cb_arg);
 }
 
 int ossl_qrx_add_dst_conn_id(OSSL_QRX *qrx,
                              const QUIC_CONN_ID *dst_conn_id)
 {
-    return ossl_quic_demux_register(qrx->demux,
-                                    dst_conn_id,
-                                    qrx_on_rx,
-                                    qrx);
+    if (!ossl_quic_demux_register(qrx->demux,
+                                  dst_conn_id,
+                                  qrx_on_rx,
+                                  qrx))
+        return 0;
+
+    ++qrx->num_dst_conn_ids;
+    return 1;
 }
 
 int ossl_qrx_remove_dst_conn_id(OSSL_QRX *qrx,
                                 const QUIC_CONN_ID *dst_conn_id)
 {
-    return ossl_quic_demux_unregister(qrx->demux, dst_conn_id);
+    if (!ossl_quic_demux_unregister(qrx->demux, dst_conn_id))
+        return 0;
+
+    if (qrx->num_dst_conn_ids > 0)
+        --qrx->num_dst_conn_ids;
+    return 1;
 }
 
 static void qrx_requeue_deferred(OSSL_QRX *qrx)
@@ -335,6 +382,7 @@ static RXE *qrx_alloc_rxe(size_t alloc_len)
     rxe->alloc_len = alloc_len;
     rxe->data_len  = 0;
     rxe->refcount  = 0;
+    rxe->urxe      = NULL;
     return rxe;
 }
 
@@ -428,37 +476,13 @@ static void qrx_recycle_rxe(OSSL_QRX *qrx, RXE *rxe)
     rxe->pkt.hdr    = NULL;
     rxe->pkt.peer   = NULL;
     rxe->pkt.local  = NULL;
+    if (rxe->urxe != NULL) {
+        qrx_urxe_unref(qrx, rxe->urxe);
+        rxe->urxe = NULL;
+    }
     ossl_list_rxe_insert_tail(&qrx->rx_free, rxe);
 }
 
-/*
- * Given a pointer to a pointer pointing to a buffer and the size of that
- * buffer, copy the buffer into *prxe, expanding the RXE if necessary (its
- * pointer may change due to realloc). *pi is the offset in bytes to copy the
- * buffer to, and on success is updated to be the offset pointing after the
- * copied buffer. *pptr is updated to point to the new location of the buffer.
- */
-static int qrx_relocate_buffer(OSSL_QRX *qrx, RXE **prxe, size_t *pi,
-                               const unsigned char **pptr, size_t buf_len)
-{
-    RXE *rxe;
-    unsigned char *dst;
-
-    if (!buf_len)
-        return 1;
-
-    if ((rxe = qrx_reserve_rxe(&qrx->rx_free, *prxe, *pi + buf_len)) == NULL)
-        return 0;
-
-    *prxe = rxe;
-    dst = (unsigned char *)rxe_data(rxe) + *pi;
-
-    memcpy(dst, *pptr, buf_len);
-    *pi += buf_len;
-    *pptr = dst;
-    return 1;
-}
-
 static uint32_t qrx_determine_enc_level(const QUIC_PKT_HDR *hdr)
 {
     switch (hdr->type) {
@@ -581,9 +605,9 @@ static size_t qrx_get_cipher_ctx_idx(OSSL_QRX *qrx, OSSL_QRL_ENC_LEVEL *el,
  *
  * Returns 1 on success or 0 on failure (which is permanent). The payload is
  * decrypted from src and written to dst. The buffer dst must be of at least
- * src_len bytes in length. The actual length of the output in bytes is written
- * to *dec_len on success, which will always be equal to or less than (usually
- * less than) src_len.
+ * src_len bytes in length and may be the same as src for in-place decryption.
+ * The actual length of the output in bytes is written to *dec_len on success,
+ * which will always be equal to or less than (usually less than) src_len.
  */
 static int qrx_decrypt_pkt_body(OSSL_QRX *qrx, unsigned char *dst,
                                 const unsigned char *src,
@@ -683,7 +707,7 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
 {
     RXE *rxe;
     const unsigned char *eop = NULL;
-    size_t i, aad_len = 0, dec_len = 0;
+    size_t aad_len = 0, dec_len = 0;
     PACKET orig_pkt = *pkt;
     const unsigned char *sop = PACKET_data(pkt);
     unsigned char *dst;
@@ -693,10 +717,11 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
     OSSL_QRL_ENC_LEVEL *el = NULL;
 
     /*
-     * Get a free RXE. If we need to allocate a new one, use the packet length
-     * as a good ballpark figure.
+     * Get a free RXE. Encrypted payloads are decrypted in place in the URXE, so
+     * an RXE only needs a buffer for the rare unencrypted packet types, which
+     * is reserved on demand below.
      */
-    rxe = qrx_ensure_free_rxe(qrx, PACKET_remaining(pkt));
+    rxe = qrx_ensure_free_rxe(qrx, 0);
     if (rxe == NULL)
         return 0;
 
@@ -784,29 +809,13 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
             goto malformed;
     }
 
-    /*
-     * We will copy any token included in the packet to the start of our RXE
-     * data buffer (so that we don't reference the URXE buffer any more and can
-     * recycle it). Track our position in the RXE buffer by index instead of
-     * pointer as the pointer may change as reallocs occur.
-     */
-    i = 0;
-
     /*
      * rxe->hdr.data is now pointing at the (encrypted) packet payload. rxe->hdr
-     * also has fields pointing into the PACKET buffer which will be going away
-     * soon (the URXE will be reused for another incoming packet).
-     *
-     * Firstly, relocate some of these fields into the RXE as needed.
+     * also has fields (such as the token) pointing into the URXE buffer. This
+     * is fine as the URXE is kept alive for as long as the RXE is in use.
      *
-     * Relocate token buffer and fix pointer.
+     * Now remove header protection.
      */
-    if (rxe->hdr.type == QUIC_PKT_TYPE_INITIAL
-        && !qrx_relocate_buffer(qrx, &rxe, &i, &rxe->hdr.token,
-                                rxe->hdr.token_len))
-        goto malformed;
-
-    /* Now remove header protection. */
     *pkt = orig_pkt;
 
     el = ossl_qrl_enc_level_set_get(&qrx->el_set, enc_level, 1);
@@ -839,31 +848,19 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
      */
     aad_len = rxe->hdr.data - sop;
 
-    /* Ensure the RXE buffer size is adequate for our payload. */
-    if ((rxe = qrx_reserve_rxe(&qrx->rx_free, rxe, rxe->hdr.len + i)) == NULL) {
-        /*
-         * Allocation failure, treat as malformed and do not bother processing
-         * any further packets in the datagram as they are likely to also
-         * encounter allocation failures.
-         */
-        eop = NULL;
-        goto malformed;
-    }
-
     /*
-     * We decrypt the packet body to immediately after the token at the start of
-     * the RXE buffer (where present).
-     *
-     * Do the decryption from the PACKET (which points into URXE memory) to our
-     * RXE payload (single-copy decryption), then fixup the pointers in the
-     * header to point to our new buffer.
+     * Decrypt the packet body in place in the URXE buffer (zero-copy
+     * decryption). The RXE then references the URXE, which is not returned to
+     * the demuxer until the RXE is released, so that consumers such as the
+     * stream receive buffers can reference the payload without copying it.
      *
      * If decryption fails this is considered a permanent error; we defer
      * packets we don't yet have decryption keys for above, so if this fails,
      * something has gone wrong with the handshake process or a packet has been
-     * corrupted.
+     * corrupted. The packet is never processed again, so it does not matter
+     * that the ciphertext has been overwritten.
      */
-    dst = (unsigned char *)rxe_data(rxe) + i;
+    dst = (unsigned char *)rxe->hdr.data;
     if (!qrx_decrypt_pkt_body(qrx, dst, rxe->hdr.data, rxe->hdr.len,
                               &dec_len, sop, aad_len, rxe->pn, enc_level,
                               rxe->hdr.key_phase))
@@ -896,13 +893,14 @@ static int qrx_process_pkt(OSSL_QRX *qrx, QUIC_URXE *urxe,
     pkt_mark(&urxe->processed, pkt_idx);
 
     /*
-     * Update header to point to the decrypted buffer, which may be shorter
-     * due to AEAD tags, block padding, etc.
+     * Update header length, as the decrypted payload is shorter due to AEAD
+     * tags, block padding, etc.
      */
-    rxe->hdr.data       = dst;
     rxe->hdr.len        = dec_len;
-    rxe->data_len       = dec_len;
+    rxe->data_len       = 0;
     rxe->datagram_len   = datagram_len;
+    rxe->urxe           = urxe;
+    ++urxe->qrx_refs;
 
     /* We processed the PN successfully, so update largest processed PN. */
     pn_space = rxe_determine_pn_space(rxe);
@@ -1045,7 +1043,7 @@ static int qrx_process_one_urxe(OSSL_QRX *qrx, QUIC_URXE *e)
             e->deferred = 0;
             --qrx->num_deferred;
         }
-        ossl_quic_demux_release_urxe(qrx->demux, e);
+        qrx_urxe_unref(qrx, e);
     }
 
     return 1;
@@ -1144,6 +1142,15 @@ int ossl_qrx_set_key_update_cb(OSSL_QRX *qrx,
     return 1;
 }
 
+int ossl_qrx_set_rx_notify_cb(OSSL_QRX *qrx,
+                              ossl_qrx_rx_notify_cb *cb,
+                              void *cb_arg)
+{
+    qrx->rx_notify_cb       = cb;
+    qrx->rx_notify_cb_arg   = cb_arg;
+    return 1;
+}
+
 uint64_t ossl_qrx_get_key_epoch(OSSL_QRX *qrx)
 {
     OSSL_QRL_ENC_LEVEL *el = ossl_qrl_enc_level_set_get(&qrx->el_set,
@@ -9,6 +9,7 @@
 
 #include "internal/quic_record_tx.h"
 #include "internal/bio_addr.h"
+#include "internal/bio.h"
 #include "internal/common.h"
 #include "quic_record_shared.h"
 #include "internal/list.h"
@@ -60,6 +61,15 @@ struct ossl_qtx_st {
     /* TX BIO. */
     BIO                        *bio;
 
+    /*
+     * Whether the BIO supports segmentation offload. If so, runs of datagrams
+     * of the same size to the same destination are copied into seg_buf and
+     * passed to the BIO as a single BIO_MSG, which the kernel splits back into
+     * individual datagrams. seg_buf is allocated when first needed.
+     */
+    int                         use_seg;
+    unsigned char              *seg_buf;
+
     /* TX maximum datagram payload length. */
     size_t                      mdpl;
 
@@ -110,8 +120,8 @@ OSSL_QTX *ossl_qtx_new(const OSSL_QTX_ARGS *args)
 
     qtx->libctx             = args->libctx;
     qtx->propq              = args->propq;
-    qtx->bio                = args->bio;
     qtx->mdpl               = args->mdpl;
+    ossl_qtx_set_bio(qtx, args->bio);
     return qtx;
 }
 
@@ -137,6 +147,7 @@ void ossl_qtx_free(OSSL_QTX *qtx)
     qtx_cleanup_txl(&qtx->pending);
     qtx_cleanup_txl(&qtx->free);
     OPENSSL_free(qtx->cons);
+    OPENSSL_free(qtx->seg_buf);
 
     /* Drop keying material and crypto resources. */
     for (i = 0; i < QUIC_ENC_LEVEL_NUM; ++i)
@@ -845,12 +856,69 @@ static void txe_to_msg(TXE *txe, BIO_MSG *msg)
 
 #define MAX_MSGS_PER_SEND   32
 
+/*
+ * Limits on a single segmented BIO_MSG. Linux accepts at most 64 segments, and
+ * the total cannot exceed the maximum UDP payload size over IPv6.
+ */
+#define MAX_SEGS_PER_MSG    64
+#define SEG_BUF_LEN         (65535 - 40 - 8)
+
+/*
+ * Fills msg with the longest run of pending datagrams starting at txe which can
+ * be sent as a single segmented message: all datagrams in the run have the
+ * same destination and the same length, except that the last may be shorter.
+ * If the run has more than one datagram it is copied into buf, which has
+ * buf_len bytes available. Returns the number of TXEs covered by msg.
+ */
+static size_t txe_run_to_msg(TXE *txe, BIO_MSG_SEG *msg,
+                             unsigned char *buf, size_t buf_len)
+{
+    TXE *t;
+    size_t i, n = 1, len = txe->data_len, seg_len = txe->data_len;
+
+    txe_to_msg(txe, &msg->msg);
+    msg->seg_len = 0;
+
+    for (t = ossl_list_txe_next(txe);
+         t != NULL && n < MAX_SEGS_PER_MSG;
+         t = ossl_list_txe_next(t)) {
+        if (t->data_len > seg_len
+            || len + t->data_len > buf_len
+            || !addr_eq(&t->peer, &txe->peer)
+            || !addr_eq(&t->local, &txe->local))
+            break;
+
+        ++n;
+        len += t->data_len;
+
+        /* A shorter datagram can only be the last segment. */
+        if (t->data_len < seg_len)
+            break;
+    }
+
+    if (n == 1)
+        return 1;
+
+    msg->msg.data       = buf;
+    msg->msg.data_len   = len;
+    msg->seg_len        = seg_len;
+
+    for (t = txe, i = 0; i < n; t = ossl_list_txe_next(t), ++i) {
+        memcpy(buf, txe_data(t), t->data_len);
+        buf += t->data_len;
+    }
+
+    return n;
+}
+
 int ossl_qtx_flush_net(OSSL_QTX *qtx)
 {
     BIO_MSG msg[MAX_MSGS_PER_SEND];
-    size_t wr, i, total_written = 0;
+    BIO_MSG_SEG seg_msg[MAX_MSGS_PER_SEND];
+    size_t msg_txes[MAX_MSGS_PER_SEND];
+    size_t wr, i, j, n, seg_buf_used, total_written = 0;
     TXE *txe;
-    int res;
+    int res, use_seg;
 
     if (ossl_list_txe_head(&qtx->pending) == NULL)
         return QTX_FLUSH_NET_RES_OK; /* Nothing to send. */
@@ -858,18 +926,47 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
     if (qtx->bio == NULL)
         return QTX_FLUSH_NET_RES_PERMANENT_FAIL;
 
+    if (qtx->use_seg && qtx->seg_buf == NULL
+        && (qtx->seg_buf = OPENSSL_malloc(SEG_BUF_LEN)) == NULL)
+        qtx->use_seg = 0;
+
     for (;;) {
+        /* Only pass segment sizes to the BIO if the batch has a run. */
+        seg_buf_used = 0;
+        use_seg      = 0;
         for (txe = ossl_list_txe_head(&qtx->pending), i = 0;
              txe != NULL && i < OSSL_NELEM(msg);
-             txe = ossl_list_txe_next(txe), ++i)
-            txe_to_msg(txe, &msg[i]);
+             ++i) {
+            if (qtx->use_seg) {
+                n = txe_run_to_msg(txe, &seg_msg[i],
+                                   qtx->seg_buf + seg_buf_used,
+                                   SEG_BUF_LEN - seg_buf_used);
+                if (n > 1) {
+                    seg_buf_used += seg_msg[i].msg.data_len;
+                    use_seg = 1;
+                }
+                msg[i] = seg_msg[i].msg;
+            } else {
+                txe_to_msg(txe, &msg[i]);
+                n = 1;
+            }
+
+            msg_txes[i] = n;
+            for (j = 0; j < n; ++j)
+                txe = ossl_list_txe_next(txe);
+        }
 
         if (!i)
             /* Nothing to send. */
             break;
 
         ERR_set_mark();
-        res = BIO_sendmmsg(qtx->bio, msg, sizeof(BIO_MSG), i, 0, &wr);
+        if (use_seg)
+            res = BIO_sendmmsg(qtx->bio, &seg_msg[0].msg, sizeof(BIO_MSG_SEG),
+                               i, BIO_MMSG_FLAG_SEG, &wr);
+        else
+            res = BIO_sendmmsg(qtx->bio, msg, sizeof(BIO_MSG), i, 0, &wr);
+
         if (res && wr == 0) {
             /*
              * Treat 0 messages sent as a transient error and just stop for now.
@@ -885,6 +982,15 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
                 /* Transient error, just stop for now, clearing the error. */
                 ERR_pop_to_mark();
                 break;
+            } else if (use_seg) {
+                /*
+                 * Segmentation offload can fail at send time, for example if
+                 * the route changes to a device which does not support it.
+                 * Stop using it and try again.
+                 */
+                ERR_pop_to_mark();
+                qtx->use_seg = 0;
+                continue;
             } else {
                 /* Non-transient error, fail and do not clear the error. */
                 ERR_clear_last_mark();
@@ -897,10 +1003,12 @@ int ossl_qtx_flush_net(OSSL_QTX *qtx)
         /*
          * Remove everything which was successfully sent from the pending queue.
          */
-        for (i = 0; i < wr; ++i)
-            qtx_pending_to_free(qtx);
+        for (i = 0; i < wr; ++i) {
+            for (j = 0; j < msg_txes[i]; ++j)
+                qtx_pending_to_free(qtx);
 
-        total_written += wr;
+            total_written += msg[i].data_len;
+        }
     }
 
     return total_written > 0
@@ -922,7 +1030,9 @@ int ossl_qtx_pop_net(OSSL_QTX *qtx, BIO_MSG *msg)
 
 void ossl_qtx_set_bio(OSSL_QTX *qtx, BIO *bio)
 {
-    qtx->bio = bio;
+    qtx->bio     = bio;
+    qtx->use_seg = bio != NULL
+        && (BIO_dgram_get_seg_cap(bio) & BIO_DGRAM_SEG_CAP_TX) != 0;
 }
 
 int ossl_qtx_set_mdpl(OSSL_QTX *qtx, size_t mdpl)
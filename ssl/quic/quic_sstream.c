@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -278,13 +278,37 @@ int ossl_quic_sstream_get_final_size(QUIC_SSTREAM *qss, uint64_t *final_size)
     return 1;
 }
 
+/*
+ * Record the |consumed_| bytes just pushed to the ring buffer as new data to
+ * be sent, or roll the ring buffer back to |old_ring_buf| on failure.
+ */
+static int qss_commit_append(QUIC_SSTREAM *qss,
+                             const struct ring_buf *old_ring_buf,
+                             size_t consumed_, size_t *consumed)
+{
+    UINT_RANGE r;
+
+    if (consumed_ > 0) {
+        r.start = old_ring_buf->head_offset;
+        r.end   = r.start + consumed_ - 1;
+        assert(r.end + 1 == qss->ring_buf.head_offset);
+        if (!ossl_uint_set_insert(&qss->new_set, &r)) {
+            qss->ring_buf = *old_ring_buf;
+            *consumed = 0;
+            return 0;
+        }
+    }
+
+    *consumed = consumed_;
+    return 1;
+}
+
 int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
                              const unsigned char *buf,
                              size_t buf_len,
                              size_t *consumed)
 {
     size_t l, consumed_ = 0;
-    UINT_RANGE r;
     struct ring_buf old_ring_buf = qss->ring_buf;
 
     if (qss->have_final_size) {
@@ -313,19 +337,50 @@ int ossl_quic_sstream_append(QUIC_SSTREAM *qss,
         consumed_   += l;
     }
 
-    if (consumed_ > 0) {
-        r.start = old_ring_buf.head_offset;
-        r.end   = r.start + consumed_ - 1;
-        assert(r.end + 1 == qss->ring_buf.head_offset);
-        if (!ossl_uint_set_insert(&qss->new_set, &r)) {
-            qss->ring_buf = old_ring_buf;
-            *consumed = 0;
-            return 0;
+    return qss_commit_append(qss, &old_ring_buf, consumed_, consumed);
+}
+
+int ossl_quic_sstream_appendv(QUIC_SSTREAM *qss,
+                              const SSL_IOVEC *iov,
+                              size_t iovcnt,
+                              size_t skip,
+                              size_t *consumed)
+{
+    size_t i, l, len, consumed_ = 0;
+    const unsigned char *p;
+    struct ring_buf old_ring_buf = qss->ring_buf;
+
+    if (qss->have_final_size) {
+        *consumed = 0;
+        return 0;
+    }
+
+    for (i = 0; i < iovcnt && skip >= iov[i].data_len; i++)
+        skip -= iov[i].data_len;
+
+    /*
+     * The segments are copied one after the other into the ring buffer, so
+     * that they form a single new range of the stream.
+     */
+    for (; i < iovcnt; i++, skip = 0) {
+        p   = (const unsigned char *)iov[i].data + skip;
+        len = iov[i].data_len - skip;
+
+        while (len > 0) {
+            l = ring_buf_push(&qss->ring_buf, p, len);
+            if (l == 0)
+                break;
+
+            p           += l;
+            len         -= l;
+            consumed_   += l;
         }
+
+        if (len > 0)
+            break;
     }
 
-    *consumed = consumed_;
-    return 1;
+    return qss_commit_append(qss, &old_ring_buf, consumed_, consumed);
 }
 
 static void qss_cull(QUIC_SSTREAM *qss)
@@ -96,6 +96,7 @@ QUIC_TSERVER *ossl_quic_tserver_new(const QUIC_TSERVER_ARGS *args,
     ch_args.is_server   = 1;
     ch_args.now_cb      = srv->args.now_cb;
     ch_args.now_cb_arg  = srv->args.now_cb_arg;
+    ch_args.cc_method   = srv->args.cc_method;
 
     if ((srv->ch = ossl_quic_channel_new(&ch_args)) == NULL)
         goto err;
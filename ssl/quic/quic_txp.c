@@ -10,6 +10,7 @@
 #include "internal/quic_txp.h"
 #include "internal/quic_fifd.h"
 #include "internal/quic_stream_map.h"
+#include "internal/quic_statm.h"
 #include "internal/common.h"
 #include <openssl/err.h>
 
@@ -23,6 +24,16 @@
 #define MIN_FRAME_SIZE_MAX_STREAMS_BIDI 2
 #define MIN_FRAME_SIZE_MAX_STREAMS_UNI  2
 
+/*
+ * Pacing parameters (RFC 9002 s. 7.7). Credit accrues at N * cwnd / srtt with
+ * N = 5/4, so that pacing alone does not limit throughput, and at most an
+ * initial window's worth of credit may be accumulated.
+ */
+#define PACING_GAIN_NUM                 5
+#define PACING_GAIN_DEN                 4
+#define PACING_BURST_PKTS               10
+#define PACING_MAX_CWND                 UINT32_MAX
+
 struct ossl_quic_tx_packetiser_st {
     OSSL_QUIC_TX_PACKETISER_ARGS args;
 
@@ -42,6 +53,10 @@ struct ossl_quic_tx_packetiser_st {
     uint64_t        next_pn[QUIC_PN_SPACE_NUM]; /* Next PN to use in given PN space. */
     OSSL_TIME       last_tx_time;               /* Last time a packet was generated, or 0. */
 
+    /* Internal state - pacing. */
+    uint64_t        pacing_credit;              /* Bytes we may send now. */
+    OSSL_TIME       pacing_credit_time;         /* Time credit was last updated. */
+
     /* Internal state - frame (re)generation flags. */
     unsigned int    want_handshake_done     : 1;
     unsigned int    want_max_data           : 1;
@@ -329,6 +344,8 @@ static int txp_determine_ppl_from_pl(OSSL_QUIC_TX_PACKETISER *txp,
                                      size_t hdr_len,
                                      size_t *r);
 static size_t txp_get_mdpl(OSSL_QUIC_TX_PACKETISER *txp);
+static void txp_pacing_update(OSSL_QUIC_TX_PACKETISER *txp, OSSL_TIME now);
+static int txp_pacing_can_send(OSSL_QUIC_TX_PACKETISER *txp);
 static int txp_generate_for_el_actual(OSSL_QUIC_TX_PACKETISER *txp,
                                       uint32_t enc_level,
                                       uint32_t archetype,
@@ -361,6 +378,7 @@ OSSL_QUIC_TX_PACKETISER *ossl_quic_tx_packetiser_new(const OSSL_QUIC_TX_PACKETIS
 
     txp->args           = *args;
     txp->last_tx_time   = ossl_time_zero();
+    txp->pacing_credit  = PACING_BURST_PKTS * (uint64_t)txp_get_mdpl(txp);
 
     if (!ossl_quic_fifd_init(&txp->fifd,
                              txp->args.cfq, txp->args.ackm, txp->args.txpim,
@@ -482,8 +500,12 @@ int ossl_quic_tx_packetiser_has_pending(OSSL_QUIC_TX_PACKETISER *txp,
     int bypass_cc = ((flags & TX_PACKETISER_BYPASS_CC) != 0);
     int cc_can_send;
 
+    if (!bypass_cc)
+        txp_pacing_update(txp, txp->args.now(txp->args.now_arg));
+
     cc_can_send
-        = (bypass_cc || txp->args.cc_method->can_send(txp->args.cc_data));
+        = (bypass_cc || (txp->args.cc_method->can_send(txp->args.cc_data)
+                         && txp_pacing_can_send(txp)));
 
     for (enc_level = QUIC_ENC_LEVEL_INITIAL;
          enc_level < QUIC_ENC_LEVEL_NUM;
@@ -506,13 +528,18 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
 {
     uint32_t enc_level, conn_close_enc_level = QUIC_ENC_LEVEL_NUM;
     int have_pkt_for_el[QUIC_ENC_LEVEL_NUM], is_last_in_dgram, cc_can_send;
-    size_t num_el_in_dgram = 0, pkts_done = 0;
+    size_t num_el_in_dgram = 0, pkts_done = 0, queued_bytes;
+    OSSL_TIME now = txp->args.now(txp->args.now_arg);
     int rc;
 
     /*
      * If CC says we cannot send we still may be able to send any queued probes.
+     * The pacer is treated the same way: if we have not yet accrued enough
+     * pacing credit, only probes, ACKs and the like may be sent.
      */
-    cc_can_send = txp->args.cc_method->can_send(txp->args.cc_data);
+    txp_pacing_update(txp, now);
+    cc_can_send = txp->args.cc_method->can_send(txp->args.cc_data)
+                  && txp_pacing_can_send(txp);
 
     for (enc_level = QUIC_ENC_LEVEL_INITIAL;
          enc_level < QUIC_ENC_LEVEL_NUM;
@@ -532,6 +559,7 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
      * using the QTX.
      */
     ossl_qtx_finish_dgram(txp->args.qtx);
+    queued_bytes = ossl_qtx_get_queue_len_bytes(txp->args.qtx);
 
     for (enc_level = QUIC_ENC_LEVEL_INITIAL;
          enc_level < QUIC_ENC_LEVEL_NUM;
@@ -561,9 +589,119 @@ int ossl_quic_tx_packetiser_generate(OSSL_QUIC_TX_PACKETISER *txp,
     }
 
     ossl_qtx_finish_dgram(txp->args.qtx);
+
+    /* Charge the datagram against our pacing credit. */
+    queued_bytes = ossl_qtx_get_queue_len_bytes(txp->args.qtx) - queued_bytes;
+    if (queued_bytes > txp->pacing_credit)
+        txp->pacing_credit = 0;
+    else
+        txp->pacing_credit -= queued_bytes;
+
+    txp->last_tx_time = now;
     return TX_PACKETISER_RES_SENT_PKT;
 }
 
+/*
+ * Pacing
+ * ======
+ *
+ * Rather than sending everything the CC allows as soon as it allows it, we
+ * spread datagrams over the RTT using a credit (token bucket) scheme. Pacing
+ * requires an RTT estimate, so it is only done when the TXP has been given a
+ * statistics manager, and only while the CC imposes a finite window.
+ */
+static int txp_pacing_get_params(OSSL_QUIC_TX_PACKETISER *txp,
+                                 uint64_t *cwnd, uint64_t *srtt_us)
+{
+    OSSL_RTT_INFO rtt;
+
+    if (txp->args.statm == NULL)
+        return 0;
+
+    *cwnd = txp->args.cc_method->get_bytes_in_flight_max(txp->args.cc_data);
+    if (*cwnd == 0 || *cwnd > PACING_MAX_CWND)
+        return 0;
+
+    ossl_statm_get_rtt_info(txp->args.statm, &rtt);
+    *srtt_us = ossl_time2us(rtt.smoothed_rtt);
+    if (*srtt_us == 0)
+        *srtt_us = 1;
+
+    return 1;
+}
+
+static uint64_t txp_pacing_max_credit(OSSL_QUIC_TX_PACKETISER *txp)
+{
+    return PACING_BURST_PKTS * (uint64_t)txp_get_mdpl(txp);
+}
+
+static void txp_pacing_update(OSSL_QUIC_TX_PACKETISER *txp, OSSL_TIME now)
+{
+    uint64_t cwnd, srtt_us, elapsed_us, credit;
+    uint64_t max_credit = txp_pacing_max_credit(txp);
+
+    if (!txp_pacing_get_params(txp, &cwnd, &srtt_us)) {
+        txp->pacing_credit      = max_credit;
+        txp->pacing_credit_time = now;
+        return;
+    }
+
+    if (ossl_time_compare(now, txp->pacing_credit_time) <= 0)
+        return;
+
+    elapsed_us = ossl_time2us(ossl_time_subtract(now, txp->pacing_credit_time));
+
+    /* The bucket cannot refill by more than a window per RTT anyway. */
+    if (elapsed_us > srtt_us)
+        elapsed_us = srtt_us;
+
+    credit = elapsed_us * cwnd * PACING_GAIN_NUM / (srtt_us * PACING_GAIN_DEN);
+
+    /*
+     * If not enough time has passed to earn a whole byte of credit, leave the
+     * timestamp alone so that the elapsed time is not lost.
+     */
+    if (credit == 0)
+        return;
+
+    txp->pacing_credit     += credit;
+    txp->pacing_credit_time = now;
+    if (txp->pacing_credit > max_credit)
+        txp->pacing_credit = max_credit;
+}
+
+static int txp_pacing_can_send(OSSL_QUIC_TX_PACKETISER *txp)
+{
+    return txp->pacing_credit >= txp_get_mdpl(txp);
+}
+
+OSSL_TIME ossl_quic_tx_packetiser_get_deadline(OSSL_QUIC_TX_PACKETISER *txp)
+{
+    uint64_t cwnd, srtt_us, need;
+    OSSL_TIME deadline
+        = txp->args.cc_method->get_next_credit_time(txp->args.cc_data);
+
+    if (!ossl_quic_tx_packetiser_has_pending(txp, TX_PACKETISER_ARCHETYPE_NORMAL,
+                                             TX_PACKETISER_BYPASS_CC))
+        return ossl_time_infinite();
+
+    /*
+     * If the CC is blocking us, the pacer is irrelevant; we will be woken by
+     * ACK processing or by the CC's own credit time.
+     */
+    if (!txp->args.cc_method->can_send(txp->args.cc_data)
+        || txp_pacing_can_send(txp)
+        || !txp_pacing_get_params(txp, &cwnd, &srtt_us))
+        return deadline;
+
+    need = txp_get_mdpl(txp) - txp->pacing_credit;
+    need = need * srtt_us * PACING_GAIN_DEN / (cwnd * PACING_GAIN_NUM) + 1;
+
+    return ossl_time_min(deadline,
+                         ossl_time_add(txp->pacing_credit_time,
+                                       ossl_us2time(need)));
+}
+
 struct archetype_data {
     unsigned int allow_ack                  : 1;
     unsigned int allow_ping                 : 1;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2018-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -297,6 +297,20 @@ static int ktls_set_crypto_state(OSSL_RECORD_LAYER *rl, int level,
                                  COMP_METHOD *comp)
 {
     ktls_crypto_info_t crypto_info;
+    int rekey, unsuitable;
+
+    /*
+     * If the kernel already handles this direction then these are the keys of
+     * a TLSv1.3 KeyUpdate and they must replace the kernel's ones: whatever we
+     * do, the kernel would keep processing the records with its old keys. So
+     * we cannot fall back to another record layer in that case.
+     */
+    if (rl->direction == OSSL_RECORD_DIRECTION_WRITE)
+        rekey = BIO_get_ktls_send(rl->bio);
+    else
+        rekey = BIO_get_ktls_recv(rl->bio);
+    unsuitable = rekey ? OSSL_RECORD_RETURN_FATAL
+                       : OSSL_RECORD_RETURN_NON_FATAL_ERR;
 
     /*
      * Check if we are suitable for KTLS. If not suitable we return
@@ -305,34 +319,38 @@ static int ktls_set_crypto_state(OSSL_RECORD_LAYER *rl, int level,
      */
 
     if (comp != NULL)
-        return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+        return unsuitable;
 
     /* ktls supports only the maximum fragment size */
     if (rl->max_frag_len != SSL3_RT_MAX_PLAIN_LENGTH)
-        return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+        return unsuitable;
 
     /* check that cipher is supported */
     if (!ktls_int_check_supported_cipher(rl, ciph, md, taglen))
-        return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+        return unsuitable;
 
     /* All future data will get encrypted by ktls. Flush the BIO or skip ktls */
     if (rl->direction == OSSL_RECORD_DIRECTION_WRITE) {
         if (BIO_flush(rl->bio) <= 0)
-            return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+            return unsuitable;
 
         /* KTLS does not support record padding */
         if (rl->padding != NULL || rl->block_padding > 0)
-            return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+            return unsuitable;
     }
 
     if (!ktls_configure_crypto(rl->libctx, rl->version, ciph, md, rl->sequence,
                                &crypto_info,
                                rl->direction == OSSL_RECORD_DIRECTION_WRITE,
                                iv, ivlen, key, keylen, mackey, mackeylen))
-       return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+       return unsuitable;
 
-    if (!BIO_set_ktls(rl->bio, &crypto_info, rl->direction))
-        return OSSL_RECORD_RETURN_NON_FATAL_ERR;
+    if (!BIO_set_ktls(rl->bio, &crypto_info, rl->direction)) {
+        /* Older kernels cannot change the keys of a connection */
+        if (rekey)
+            ERR_raise(ERR_LIB_SSL, SSL_R_KTLS_REKEY_FAILED);
+        return unsuitable;
+    }
 
     if (rl->direction == OSSL_RECORD_DIRECTION_WRITE &&
         (rl->options & SSL_OP_ENABLE_KTLS_TX_ZEROCOPY_SENDFILE) != 0)
@@ -432,7 +450,7 @@ ktls_new_record_layer(OSSL_LIB_CTX *libctx, const char *propq, int vers,
                                             taglen, mactype, md, comp);
 
     if (ret != OSSL_RECORD_RETURN_SUCCESS) {
-        OPENSSL_free(*retrl);
+        tls_free(*retrl);
         *retrl = NULL;
     } else {
         /*
@@ -448,13 +466,29 @@ static int ktls_allocate_write_buffers(OSSL_RECORD_LAYER *rl,
                                        OSSL_RECORD_TEMPLATE *templates,
                                        size_t numtempl, size_t *prefix)
 {
+    TLS_BUFFER *wb = &rl->wbuf[0];
+
     if (!ossl_assert(numtempl == 1))
         return 0;
 
+    /* Never free an application buffer left from a previous write */
+    if (TLS_BUFFER_is_app_buffer(wb)) {
+        TLS_BUFFER_set_app_buffer(wb, 0);
+        TLS_BUFFER_set_buf(wb, NULL);
+    }
+
     /*
-     * We just use the end application buffer in the case of KTLS, so nothing
-     * to do. We pretend we set up one buffer.
+     * A payload gathered from several segments must be copied into a buffer
+     * of our own for the kernel to send it in one record.
      */
+    if (templates[0].iov != NULL)
+        return tls_setup_write_buffer(rl, 1, templates[0].buflen, 0);
+
+    /*
+     * Otherwise we just use the end application buffer in the case of KTLS, so
+     * nothing to do. We pretend we set up one buffer.
+     */
+    tls_buffer_free(rl, wb);
     rl->numwpipes = 1;
 
     return 1;
@@ -477,6 +511,15 @@ static int ktls_initialise_write_packets(OSSL_RECORD_LAYER *rl,
     wb = &bufs[0];
     wb->type = templates[0].type;
 
+    if (templates[0].iov != NULL) {
+        TLS_BUFFER_set_offset(wb, 0);
+        if (!tls_gather_template(&templates[0], TLS_BUFFER_get_buf(wb))) {
+            RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+            return 0;
+        }
+        return 1;
+    }
+
     /*
     * ktls doesn't modify the buffer, but to avoid a warning we need
     * to discard the const qualifier.
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -365,6 +365,12 @@ struct ossl_record_layer_st
     OSSL_FUNC_rlayer_msg_callback_fn *msg_callback;
     OSSL_FUNC_rlayer_security_fn *security;
     OSSL_FUNC_rlayer_padding_fn *padding;
+    /*
+     * Buffer pool of the SSL_CTX, if any. Buffers from the pool are released
+     * as soon as they are empty, as with SSL_MODE_RELEASE_BUFFERS.
+     */
+    OSSL_FUNC_rlayer_alloc_buffer_fn *alloc_buffer;
+    OSSL_FUNC_rlayer_free_buffer_fn *free_buffer;
 
     size_t max_pipelines;
 
@@ -475,6 +481,8 @@ void tls_set_max_frag_len(OSSL_RECORD_LAYER *rl, size_t max_frag_len);
 int tls_setup_read_buffer(OSSL_RECORD_LAYER *rl);
 int tls_setup_write_buffer(OSSL_RECORD_LAYER *rl, size_t numwpipes,
                            size_t firstlen, size_t nextlen);
+void tls_buffer_free(OSSL_RECORD_LAYER *rl, TLS_BUFFER *b);
+int tls_gather_template(const OSSL_RECORD_TEMPLATE *templ, unsigned char *out);
 
 int tls_write_records_multiblock(OSSL_RECORD_LAYER *rl,
                                  OSSL_RECORD_TEMPLATE *templates,
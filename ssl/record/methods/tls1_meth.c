@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -607,6 +607,7 @@ int tls1_initialise_write_packets(OSSL_RECORD_LAYER *rl,
          * http://www.openssl.org/~bodo/tls-cbc.txt)
          */
         prefixtempl->buf = NULL;
+        prefixtempl->iov = NULL;
         prefixtempl->version = templates[0].version;
         prefixtempl->buflen = 0;
         prefixtempl->type = SSL3_RT_APPLICATION_DATA;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -120,6 +120,29 @@ static int tls_allow_compression(OSSL_RECORD_LAYER *rl)
 }
 #endif
 
+static unsigned char *tls_buffer_alloc(OSSL_RECORD_LAYER *rl, size_t len)
+{
+    if (rl->alloc_buffer != NULL)
+        return rl->alloc_buffer(rl->cbarg, len);
+    return OPENSSL_malloc(len);
+}
+
+void tls_buffer_free(OSSL_RECORD_LAYER *rl, TLS_BUFFER *b)
+{
+    if (b->buf != NULL && rl->free_buffer != NULL)
+        rl->free_buffer(rl->cbarg, b->buf, b->len);
+    else
+        OPENSSL_free(b->buf);
+    b->buf = NULL;
+}
+
+/* Whether to release buffers as soon as they are empty */
+static int tls_release_empty_buffers(OSSL_RECORD_LAYER *rl)
+{
+    return (rl->mode & SSL_MODE_RELEASE_BUFFERS) != 0
+           || rl->free_buffer != NULL;
+}
+
 static void tls_release_write_buffer_int(OSSL_RECORD_LAYER *rl, size_t start)
 {
     TLS_BUFFER *wb;
@@ -133,7 +156,7 @@ static void tls_release_write_buffer_int(OSSL_RECORD_LAYER *rl, size_t start)
         if (TLS_BUFFER_is_app_buffer(wb))
             TLS_BUFFER_set_app_buffer(wb, 0);
         else
-            OPENSSL_free(wb->buf);
+            tls_buffer_free(rl, wb);
         wb->buf = NULL;
         pipes--;
     }
@@ -180,14 +203,12 @@ int tls_setup_write_buffer(OSSL_RECORD_LAYER *rl, size_t numwpipes,
         if (len == 0)
             len = defltlen;
 
-        if (thiswb->len != len) {
-            OPENSSL_free(thiswb->buf);
-            thiswb->buf = NULL;         /* force reallocation */
-        }
+        if (thiswb->len != len)
+            tls_buffer_free(rl, thiswb); /* force reallocation */
 
         p = thiswb->buf;
         if (p == NULL) {
-            p = OPENSSL_malloc(len);
+            p = tls_buffer_alloc(rl, len);
             if (p == NULL) {
                 if (rl->numwpipes < currpipe)
                     rl->numwpipes = currpipe;
@@ -252,7 +273,7 @@ int tls_setup_read_buffer(OSSL_RECORD_LAYER *rl)
         if (b->default_len > len)
             len = b->default_len;
 
-        if ((p = OPENSSL_malloc(len)) == NULL) {
+        if ((p = tls_buffer_alloc(rl, len)) == NULL) {
             /*
              * We've got a malloc failure, and we're still initialising buffers.
              * We assume we're so doomed that we won't even be able to send an
@@ -275,8 +296,7 @@ static int tls_release_read_buffer(OSSL_RECORD_LAYER *rl)
     b = &rl->rbuf;
     if ((rl->options & SSL_OP_CLEANSE_PLAINTEXT) != 0)
         OPENSSL_cleanse(b->buf, b->len);
-    OPENSSL_free(b->buf);
-    b->buf = NULL;
+    tls_buffer_free(rl, b);
     return 1;
 }
 
@@ -416,7 +436,7 @@ int tls_default_read_n(OSSL_RECORD_LAYER *rl, size_t n, size_t max, int extend,
 
         if (ret <= OSSL_RECORD_RETURN_RETRY) {
             rb->left = left;
-            if ((rl->mode & SSL_MODE_RELEASE_BUFFERS) != 0 && !rl->isdtls)
+            if (tls_release_empty_buffers(rl) && !rl->isdtls)
                 if (len + left == 0)
                     tls_release_read_buffer(rl);
             return ret;
@@ -1144,7 +1164,7 @@ int tls_release_record(OSSL_RECORD_LAYER *rl, void *rechandle)
     rl->num_released++;
 
     if (rl->curr_rec == rl->num_released
-            && (rl->mode & SSL_MODE_RELEASE_BUFFERS) != 0
+            && tls_release_empty_buffers(rl)
             && TLS_BUFFER_get_left(&rl->rbuf) == 0)
         tls_release_read_buffer(rl);
 
@@ -1309,6 +1329,13 @@ tls_int_new_record_layer(OSSL_LIB_CTX *libctx, const char *propq, int vers,
                 break;
             case OSSL_FUNC_RLAYER_PADDING:
                 rl->padding = OSSL_FUNC_rlayer_padding(fns);
+                break;
+            case OSSL_FUNC_RLAYER_ALLOC_BUFFER:
+                rl->alloc_buffer = OSSL_FUNC_rlayer_alloc_buffer(fns);
+                break;
+            case OSSL_FUNC_RLAYER_FREE_BUFFER:
+                rl->free_buffer = OSSL_FUNC_rlayer_free_buffer(fns);
+                break;
             default:
                 /* Just ignore anything we don't understand */
                 break;
@@ -1316,6 +1343,12 @@ tls_int_new_record_layer(OSSL_LIB_CTX *libctx, const char *propq, int vers,
         }
     }
 
+    /* Buffers are either allocated and freed by libssl or by us */
+    if (rl->alloc_buffer == NULL || rl->free_buffer == NULL) {
+        rl->alloc_buffer = NULL;
+        rl->free_buffer = NULL;
+    }
+
     if (!tls_set_options(rl, options)) {
         ERR_raise(ERR_LIB_SSL, SSL_R_FAILED_TO_GET_PARAMETER);
         goto err;
@@ -1404,7 +1437,7 @@ static void tls_int_free(OSSL_RECORD_LAYER *rl)
     BIO_free(rl->prev);
     BIO_free(rl->bio);
     BIO_free(rl->next);
-    ossl_tls_buffer_release(&rl->rbuf);
+    tls_buffer_free(rl, &rl->rbuf);
 
     tls_release_write_buffer(rl);
 
@@ -1699,6 +1732,29 @@ int tls_post_encryption_processing_default(OSSL_RECORD_LAYER *rl,
     return 1;
 }
 
+/*
+ * Copy the payload of |templ| into |out| when it is to be gathered from the
+ * segments of templ->iov. Returns 1 on success or 0 if the segments hold less
+ * than templ->buflen bytes.
+ */
+int tls_gather_template(const OSSL_RECORD_TEMPLATE *templ, unsigned char *out)
+{
+    size_t i, n, off = templ->iovoff, left = templ->buflen;
+
+    for (i = 0; left > 0 && i < templ->iovcnt; i++, off = 0) {
+        if (templ->iov[i].data_len <= off)
+            continue;
+        n = templ->iov[i].data_len - off;
+        if (n > left)
+            n = left;
+        memcpy(out, (unsigned char *)templ->iov[i].data + off, n);
+        out += n;
+        left -= n;
+    }
+
+    return left == 0;
+}
+
 int tls_write_records_default(OSSL_RECORD_LAYER *rl,
                               OSSL_RECORD_TEMPLATE *templates,
                               size_t numtempl)
@@ -1712,6 +1768,7 @@ int tls_write_records_default(OSSL_RECORD_LAYER *rl,
     size_t j, prefix = 0;
     OSSL_RECORD_TEMPLATE prefixtempl;
     OSSL_RECORD_TEMPLATE *thistempl;
+    unsigned char *gathered = NULL;
 
     if (rl->md_ctx != NULL && EVP_MD_CTX_get0_md(rl->md_ctx) != NULL) {
         mac_size = EVP_MD_CTX_get_size(rl->md_ctx);
@@ -1774,13 +1831,39 @@ int tls_write_records_default(OSSL_RECORD_LAYER *rl,
 
         /* first we compress */
         if (rl->compctx != NULL) {
+            /* The compressor needs a gathered payload in one piece */
+            if (thistempl->iov != NULL && thistempl->buflen > 0) {
+                if ((gathered = OPENSSL_malloc(thistempl->buflen)) == NULL) {
+                    RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_CRYPTO_LIB);
+                    goto err;
+                }
+                if (!tls_gather_template(thistempl, gathered)) {
+                    RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+                    goto err;
+                }
+                TLS_RL_RECORD_set_input(thiswr, gathered);
+            }
             if (!tls_do_compress(rl, thiswr)
                     || !WPACKET_allocate_bytes(thispkt, thiswr->length, NULL)) {
                 RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, SSL_R_COMPRESSION_FAILURE);
                 goto err;
             }
+            OPENSSL_free(gathered);
+            gathered = NULL;
         } else if (compressdata != NULL) {
-            if (!WPACKET_memcpy(thispkt, thiswr->input, thiswr->length)) {
+            /*
+             * A gathered payload is copied segment by segment straight into
+             * the record, there is no intermediate copy
+             */
+            if (thistempl->iov != NULL) {
+                if (!tls_gather_template(thistempl, compressdata)
+                        || !WPACKET_allocate_bytes(thispkt, thiswr->length,
+                                                   NULL)) {
+                    RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
+                    goto err;
+                }
+            } else if (!WPACKET_memcpy(thispkt, thiswr->input,
+                                       thiswr->length)) {
                 RLAYERfatal(rl, SSL_AD_INTERNAL_ERROR, ERR_R_INTERNAL_ERROR);
                 goto err;
             }
@@ -1833,6 +1916,7 @@ int tls_write_records_default(OSSL_RECORD_LAYER *rl,
 
     ret = 1;
  err:
+    OPENSSL_free(gathered);
     for (j = 0; j < wpinited; j++)
         WPACKET_cleanup(&pkt[j]);
     return ret;
@@ -1913,7 +1997,7 @@ int tls_retry_write_records(OSSL_RECORD_LAYER *rl)
                 continue;
 
             if (rl->nextwbuf == rl->numwpipes
-                    && (rl->mode & SSL_MODE_RELEASE_BUFFERS) != 0)
+                    && tls_release_empty_buffers(rl))
                 tls_release_write_buffer(rl);
             return OSSL_RECORD_RETURN_SUCCESS;
         } else if (i <= 0) {
@@ -1924,7 +2008,7 @@ int tls_retry_write_records(OSSL_RECORD_LAYER *rl)
                  */
                 TLS_BUFFER_set_left(thiswb, 0);
                 if (++(rl->nextwbuf) == rl->numwpipes
-                        && (rl->mode & SSL_MODE_RELEASE_BUFFERS) != 0)
+                        && tls_release_empty_buffers(rl))
                     tls_release_write_buffer(rl);
 
             }
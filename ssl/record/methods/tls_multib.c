@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -80,11 +80,13 @@ static int tls_write_records_multiblock_int(OSSL_RECORD_LAYER *rl,
 
     /*
      * Check templates have contiguous buffers and are all the same type and
-     * length
+     * length. Payloads gathered from several segments are never contiguous.
      */
     for (i = 1; i < numtempl; i++) {
         if (templates[i - 1].type != templates[i].type
                 || templates[i - 1].buflen != templates[i].buflen
+                || templates[i - 1].iov != NULL
+                || templates[i].iov != NULL
                 || templates[i - 1].buf + templates[i - 1].buflen
                    != templates[i].buf)
             return 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright 2005-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2005-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -647,8 +647,12 @@ int do_dtls1_write(SSL_CONNECTION *sc, int type, const unsigned char *buf,
         tmpl.version = DTLS1_VERSION;
     else
         tmpl.version = sc->version;
-    tmpl.buf = buf;
-    tmpl.buflen = len;
+    /* Application data of SSL_writev_ex() comes from its segments */
+    if (type == SSL3_RT_APPLICATION_DATA)
+        ossl_rlayer_set_template_data(&tmpl, buf, sc->rlayer.wiov,
+                                      sc->rlayer.wiovcnt, 0, len);
+    else
+        ossl_rlayer_set_template_data(&tmpl, buf, NULL, 0, 0, len);
 
     ret = HANDLE_RLAYER_WRITE_RETURN(sc,
               sc->rlayer.wrlmethod->write_records(sc->rlayer.wrl, &tmpl, 1));
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -32,6 +32,8 @@ void RECORD_LAYER_clear(RECORD_LAYER *rl)
     rl->wpend_type = 0;
     rl->wpend_ret = 0;
     rl->wpend_buf = NULL;
+    rl->wiov = NULL;
+    rl->wiovcnt = 0;
 
     if (rl->rrlmethod != NULL)
         rl->rrlmethod->free(rl->rrl); /* Ignore return value */
@@ -215,6 +217,42 @@ static int tls_write_check_pending(SSL_CONNECTION *s, int type,
     return 1;
 }
 
+/*
+ * Point |tmpl| at the |len| bytes at offset |off| of the data being written,
+ * which is either |buf| or, if |iov| is not NULL, the concatenation of the
+ * |iovcnt| segments in |iov|. A record that lies within a single segment is
+ * taken from it directly, one that spans segments is gathered by the record
+ * layer while it builds the record.
+ */
+void ossl_rlayer_set_template_data(OSSL_RECORD_TEMPLATE *tmpl,
+                                   const unsigned char *buf,
+                                   const SSL_IOVEC *iov, size_t iovcnt,
+                                   size_t off, size_t len)
+{
+    size_t i = 0;
+
+    tmpl->buflen = len;
+    tmpl->iov = NULL;
+    if (iov == NULL) {
+        tmpl->buf = buf + off;
+        return;
+    }
+
+    while (i < iovcnt && off >= iov[i].data_len) {
+        off -= iov[i].data_len;
+        i++;
+    }
+    if (i < iovcnt && iov[i].data_len - off >= len) {
+        tmpl->buf = (const unsigned char *)iov[i].data + off;
+        return;
+    }
+
+    tmpl->buf = NULL;
+    tmpl->iov = iov + i;
+    tmpl->iovcnt = iovcnt - i;
+    tmpl->iovoff = off;
+}
+
 /*
  * Call this to write data in records of type 'type' It will return <= 0 if
  * not all data has been sent or non-blocking IO.
@@ -229,10 +267,18 @@ int ssl3_write_bytes(SSL *ssl, int type, const void *buf_, size_t len,
     SSL_CONNECTION *s = SSL_CONNECTION_FROM_SSL_ONLY(ssl);
     OSSL_RECORD_TEMPLATE tmpls[SSL_MAX_PIPELINES];
     unsigned int recversion;
+    const SSL_IOVEC *iov;
 
     if (s == NULL)
         return -1;
 
+    /*
+     * For SSL_writev_ex() the application data comes from the segments in
+     * s->rlayer.wiov and |buf| is not to be dereferenced. Handshake messages
+     * written in the meantime still come from |buf|.
+     */
+    iov = (type == SSL3_RT_APPLICATION_DATA) ? s->rlayer.wiov : NULL;
+
     s->rwstate = SSL_NOTHING;
     tot = s->rlayer.wnum;
     /*
@@ -387,8 +433,10 @@ int ssl3_write_bytes(SSL *ssl, int type, const void *buf_, size_t len,
             for (j = 0; j < maxpipes; j++) {
                 tmpls[j].type = type;
                 tmpls[j].version = recversion;
-                tmpls[j].buf = &(buf[tot]) + (j * split_send_fragment);
-                tmpls[j].buflen = split_send_fragment;
+                ossl_rlayer_set_template_data(&tmpls[j], buf, iov,
+                                              s->rlayer.wiovcnt,
+                                              tot + j * split_send_fragment,
+                                              split_send_fragment);
             }
             /* Remember how much data we are going to be sending */
             s->rlayer.wpend_tot = maxpipes * split_send_fragment;
@@ -405,8 +453,9 @@ int ssl3_write_bytes(SSL *ssl, int type, const void *buf_, size_t len,
             for (j = 0; j < maxpipes; j++) {
                 tmpls[j].type = type;
                 tmpls[j].version = recversion;
-                tmpls[j].buf = &(buf[tot]) + lensofar;
-                tmpls[j].buflen = tmppipelen;
+                ossl_rlayer_set_template_data(&tmpls[j], buf, iov,
+                                              s->rlayer.wiovcnt,
+                                              tot + lensofar, tmppipelen);
                 lensofar += tmppipelen;
                 if (j + 1 == remain)
                     tmppipelen--;
@@ -1078,11 +1127,41 @@ static size_t rlayer_padding_wrapper(void *cbarg, int type, size_t len)
                                        s->rlayer.record_padding_arg);
 }
 
+/*
+ * The record buffer pool wrappers look the pool up on every call because
+ * SSL_set_SSL_CTX() may move the connection to an SSL_CTX without one.  Any
+ * pool accepts any buffer.
+ */
+static OSSL_FUNC_rlayer_alloc_buffer_fn rlayer_alloc_buffer_wrapper;
+static void *rlayer_alloc_buffer_wrapper(void *cbarg, size_t len)
+{
+    SSL_CONNECTION *s = cbarg;
+    SSL_CTX *sctx = SSL_CONNECTION_GET_CTX(s);
+
+    if (sctx->rbuf_pool == NULL)
+        return OPENSSL_malloc(len);
+    return ossl_record_buffer_pool_alloc(sctx->rbuf_pool, len);
+}
+
+static OSSL_FUNC_rlayer_free_buffer_fn rlayer_free_buffer_wrapper;
+static void rlayer_free_buffer_wrapper(void *cbarg, void *buf, size_t len)
+{
+    SSL_CONNECTION *s = cbarg;
+    SSL_CTX *sctx = SSL_CONNECTION_GET_CTX(s);
+
+    if (sctx->rbuf_pool == NULL)
+        OPENSSL_free(buf);
+    else
+        ossl_record_buffer_pool_release(sctx->rbuf_pool, buf, len);
+}
+
 static const OSSL_DISPATCH rlayer_dispatch[] = {
     { OSSL_FUNC_RLAYER_SKIP_EARLY_DATA, (void (*)(void))ossl_statem_skip_early_data },
     { OSSL_FUNC_RLAYER_MSG_CALLBACK, (void (*)(void))rlayer_msg_callback_wrapper },
     { OSSL_FUNC_RLAYER_SECURITY, (void (*)(void))rlayer_security_wrapper },
     { OSSL_FUNC_RLAYER_PADDING, (void (*)(void))rlayer_padding_wrapper },
+    { OSSL_FUNC_RLAYER_ALLOC_BUFFER, (void (*)(void))rlayer_alloc_buffer_wrapper },
+    { OSSL_FUNC_RLAYER_FREE_BUFFER, (void (*)(void))rlayer_free_buffer_wrapper },
     { 0, NULL }
 };
 
@@ -1094,6 +1173,15 @@ void ossl_ssl_set_custom_record_layer(SSL_CONNECTION *s,
     s->rlayer.rlarg = rlarg;
 }
 
+#ifndef OPENSSL_NO_KTLS
+/* Checks if records of the next read epoch have already been read ahead */
+static int ssl_read_data_buffered(SSL_CONNECTION *s)
+{
+    return s->rlayer.rrlmethod != NULL
+           && s->rlayer.rrlmethod->unprocessed_read_pending(s->rlayer.rrl);
+}
+#endif
+
 static const OSSL_RECORD_METHOD *ssl_select_next_record_layer(SSL_CONNECTION *s,
                                                               int direction,
                                                               int level)
@@ -1109,10 +1197,17 @@ static const OSSL_RECORD_METHOD *ssl_select_next_record_layer(SSL_CONNECTION *s,
     }
 
 #ifndef OPENSSL_NO_KTLS
-    /* KTLS does not support renegotiation */
+    /*
+     * KTLS does not support renegotiation. Nor can the kernel start reading
+     * while data already read from the socket is buffered here: it would
+     * never see it. In that case we stay with the current record layer for
+     * now and try again with the next TLSv1.3 KeyUpdate.
+     */
     if (level == OSSL_RECORD_PROTECTION_LEVEL_APPLICATION
             && (s->options & SSL_OP_ENABLE_KTLS) != 0
-            && (SSL_CONNECTION_IS_TLS13(s) || SSL_IS_FIRST_HANDSHAKE(s)))
+            && (SSL_CONNECTION_IS_TLS13(s) || SSL_IS_FIRST_HANDSHAKE(s))
+            && (direction == OSSL_RECORD_DIRECTION_WRITE
+                || !ssl_read_data_buffered(s)))
         return &ossl_ktls_record_method;
 #endif
 
@@ -1325,6 +1420,14 @@ int ssl_set_new_record_layer(SSL_CONNECTION *s, int version,
                 if (s->rlayer.record_padding_cb == NULL)
                     continue;
                 break;
+            case OSSL_FUNC_RLAYER_ALLOC_BUFFER:
+            case OSSL_FUNC_RLAYER_FREE_BUFFER:
+                /* DTLS keeps records in their buffers, see dtls_meth.c */
+                if (sctx->rbuf_pool == NULL
+                        || ossl_record_buffer_pool_get_size(sctx->rbuf_pool) == 0
+                        || SSL_CONNECTION_IS_DTLS(s))
+                    continue;
+                break;
             default:
                 break;
             }
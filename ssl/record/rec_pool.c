@@ -0,0 +1,276 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * A pool of record layer buffers shared by the connections of an SSL_CTX.
+ *
+ * Record layers borrow their read and write buffers from the pool while
+ * data is in flight and return them as soon as they are empty, so that idle
+ * connections hold no buffers at all.  Returned buffers are kept for reuse,
+ * up to a configurable number, in one of RECORD_BUFFER_POOL_NUM_SHARDS
+ * independently locked caches chosen by the calling thread.  Threads that
+ * serve their own set of connections thus mostly reuse their own buffers
+ * without contending with each other.
+ *
+ * Idle buffers are kept in singly linked lists, one per buffer length,
+ * threaded through the first bytes of the buffers themselves.
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../ssl_local.h"
+
+/* Number of independently locked caches */
+#define RECORD_BUFFER_POOL_NUM_SHARDS   16
+
+/*
+ * Number of distinct buffer lengths kept in each cache.  Connections using
+ * default settings need one read and one write buffer length.
+ */
+#define RECORD_BUFFER_POOL_NUM_LENS     4
+
+typedef struct {
+    size_t len;                 /* 0 if the slot is unused */
+    void *head;                 /* the idle buffers of length len */
+    size_t count;
+} RECORD_BUFFER_POOL_LIST;
+
+typedef struct {
+    CRYPTO_RWLOCK *lock;
+    RECORD_BUFFER_POOL_LIST lists[RECORD_BUFFER_POOL_NUM_LENS];
+    /* Most idle buffers kept, 0 to keep none */
+    size_t size;
+    size_t idle;
+    size_t idle_bytes;
+    /* Buffers taken from this cache minus those returned, may go negative */
+    long in_use;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t discards;
+} RECORD_BUFFER_POOL_SHARD;
+
+struct record_buffer_pool_st {
+    RECORD_BUFFER_POOL_SHARD shards[RECORD_BUFFER_POOL_NUM_SHARDS];
+};
+
+RECORD_BUFFER_POOL *ossl_record_buffer_pool_new(void)
+{
+    RECORD_BUFFER_POOL *pool = OPENSSL_zalloc(sizeof(*pool));
+    size_t i;
+
+    if (pool == NULL)
+        return NULL;
+    for (i = 0; i < RECORD_BUFFER_POOL_NUM_SHARDS; i++)
+        if ((pool->shards[i].lock = CRYPTO_THREAD_lock_new()) == NULL) {
+            ossl_record_buffer_pool_free(pool);
+            return NULL;
+        }
+    return pool;
+}
+
+/* Free all idle buffers of |list|, the shard lock must be held */
+static void pool_list_flush(RECORD_BUFFER_POOL_SHARD *shard,
+                            RECORD_BUFFER_POOL_LIST *list)
+{
+    void *buf, *next;
+
+    for (buf = list->head; buf != NULL; buf = next) {
+        memcpy(&next, buf, sizeof(next));
+        OPENSSL_free(buf);
+    }
+    shard->idle -= list->count;
+    shard->idle_bytes -= list->count * list->len;
+    list->head = NULL;
+    list->count = 0;
+    list->len = 0;
+}
+
+void ossl_record_buffer_pool_free(RECORD_BUFFER_POOL *pool)
+{
+    size_t i, j;
+
+    if (pool == NULL)
+        return;
+    for (i = 0; i < RECORD_BUFFER_POOL_NUM_SHARDS; i++) {
+        for (j = 0; j < RECORD_BUFFER_POOL_NUM_LENS; j++)
+            pool_list_flush(&pool->shards[i], &pool->shards[i].lists[j]);
+        CRYPTO_THREAD_lock_free(pool->shards[i].lock);
+    }
+    OPENSSL_free(pool);
+}
+
+/* The cache of the calling thread */
+static RECORD_BUFFER_POOL_SHARD *pool_shard(RECORD_BUFFER_POOL *pool)
+{
+    CRYPTO_THREAD_ID id = CRYPTO_THREAD_get_current_id();
+    const unsigned char *p = (const unsigned char *)&id;
+    size_t i, h = 0;
+
+    for (i = 0; i < sizeof(id); i++)
+        h = h * 31 + p[i];
+    h ^= h >> 7;
+    return &pool->shards[h % RECORD_BUFFER_POOL_NUM_SHARDS];
+}
+
+/*
+ * Set the number of idle buffers kept in each cache of |pool|, freeing
+ * those in excess.  Shrinking drops the idle buffers of a cache altogether.
+ */
+int ossl_record_buffer_pool_set_size(RECORD_BUFFER_POOL *pool, size_t size)
+{
+    RECORD_BUFFER_POOL_SHARD *shard;
+    size_t i, j;
+
+    for (i = 0; i < RECORD_BUFFER_POOL_NUM_SHARDS; i++) {
+        shard = &pool->shards[i];
+        if (!CRYPTO_THREAD_write_lock(shard->lock))
+            return 0;
+        shard->size = size;
+        if (shard->idle > size)
+            for (j = 0; j < RECORD_BUFFER_POOL_NUM_LENS; j++)
+                pool_list_flush(shard, &shard->lists[j]);
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+    return 1;
+}
+
+size_t ossl_record_buffer_pool_get_size(RECORD_BUFFER_POOL *pool)
+{
+    RECORD_BUFFER_POOL_SHARD *shard = &pool->shards[0];
+    size_t size;
+
+    if (!CRYPTO_THREAD_read_lock(shard->lock))
+        return 0;
+    size = shard->size;
+    CRYPTO_THREAD_unlock(shard->lock);
+    return size;
+}
+
+/* Take a buffer of |len| bytes from the pool or allocate a new one */
+void *ossl_record_buffer_pool_alloc(RECORD_BUFFER_POOL *pool, size_t len)
+{
+    RECORD_BUFFER_POOL_SHARD *shard = pool_shard(pool);
+    RECORD_BUFFER_POOL_LIST *list;
+    void *buf = NULL;
+    size_t i;
+
+    if (!CRYPTO_THREAD_write_lock(shard->lock))
+        return NULL;
+    for (i = 0; i < RECORD_BUFFER_POOL_NUM_LENS; i++) {
+        list = &shard->lists[i];
+        if (list->len == len && list->head != NULL) {
+            buf = list->head;
+            memcpy(&list->head, buf, sizeof(list->head));
+            list->count--;
+            shard->idle--;
+            shard->idle_bytes -= len;
+            break;
+        }
+    }
+    if (buf != NULL)
+        shard->hits++;
+    else
+        shard->misses++;
+    shard->in_use++;
+    CRYPTO_THREAD_unlock(shard->lock);
+
+    if (buf == NULL && (buf = OPENSSL_malloc(len)) == NULL) {
+        if (CRYPTO_THREAD_write_lock(shard->lock)) {
+            shard->in_use--;
+            CRYPTO_THREAD_unlock(shard->lock);
+        }
+    }
+    return buf;
+}
+
+/*
+ * Return a buffer of |len| bytes obtained from ossl_record_buffer_pool_alloc()
+ * to the pool, or free it if the cache of the calling thread is full.
+ */
+void ossl_record_buffer_pool_release(RECORD_BUFFER_POOL *pool, void *buf,
+                                     size_t len)
+{
+    RECORD_BUFFER_POOL_SHARD *shard = pool_shard(pool);
+    RECORD_BUFFER_POOL_LIST *list = NULL;
+    size_t i;
+
+    if (buf == NULL)
+        return;
+    if (!CRYPTO_THREAD_write_lock(shard->lock)) {
+        OPENSSL_free(buf);
+        return;
+    }
+    shard->in_use--;
+    if (len >= sizeof(list->head) && shard->idle < shard->size) {
+        for (i = 0; i < RECORD_BUFFER_POOL_NUM_LENS; i++) {
+            if (shard->lists[i].len == len) {
+                list = &shard->lists[i];
+                break;
+            }
+            if (list == NULL && shard->lists[i].count == 0)
+                list = &shard->lists[i];
+        }
+    }
+    if (list == NULL) {
+        shard->discards++;
+        CRYPTO_THREAD_unlock(shard->lock);
+        OPENSSL_free(buf);
+        return;
+    }
+    list->len = len;
+    memcpy(buf, &list->head, sizeof(list->head));
+    list->head = buf;
+    list->count++;
+    shard->idle++;
+    shard->idle_bytes += len;
+    CRYPTO_THREAD_unlock(shard->lock);
+}
+
+/* One of the SSL_RECORD_BUFFER_POOL_STAT_* statistics summed over all caches */
+long ossl_record_buffer_pool_stat(RECORD_BUFFER_POOL *pool, int stat)
+{
+    RECORD_BUFFER_POOL_SHARD *shard;
+    uint64_t sum = 0;
+    long in_use = 0;
+    size_t i;
+
+    for (i = 0; i < RECORD_BUFFER_POOL_NUM_SHARDS; i++) {
+        shard = &pool->shards[i];
+        if (!CRYPTO_THREAD_read_lock(shard->lock))
+            return -1;
+        switch (stat) {
+        case SSL_RECORD_BUFFER_POOL_STAT_IDLE:
+            sum += shard->idle;
+            break;
+        case SSL_RECORD_BUFFER_POOL_STAT_IDLE_BYTES:
+            sum += shard->idle_bytes;
+            break;
+        case SSL_RECORD_BUFFER_POOL_STAT_IN_USE:
+            in_use += shard->in_use;
+            break;
+        case SSL_RECORD_BUFFER_POOL_STAT_HITS:
+            sum += shard->hits;
+            break;
+        case SSL_RECORD_BUFFER_POOL_STAT_MISSES:
+            sum += shard->misses;
+            break;
+        case SSL_RECORD_BUFFER_POOL_STAT_DISCARDS:
+            sum += shard->discards;
+            break;
+        default:
+            CRYPTO_THREAD_unlock(shard->lock);
+            return -1;
+        }
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+    if (stat == SSL_RECORD_BUFFER_POOL_STAT_IN_USE)
+        return in_use;
+    return sum > LONG_MAX ? LONG_MAX : (long)sum;
+}
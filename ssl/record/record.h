@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2020 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -106,6 +106,13 @@ typedef struct record_layer_st {
     /* number of bytes submitted */
     size_t wpend_ret;
     const unsigned char *wpend_buf;
+    /*
+     * The segments of the application data being written by SSL_writev_ex(),
+     * NULL for other writes. The buffer passed to the write functions then
+     * only identifies the write for retries.
+     */
+    const SSL_IOVEC *wiov;
+    size_t wiovcnt;
 
     /* Count of the number of consecutive warning alerts received */
     unsigned int alert_count;
@@ -159,6 +166,10 @@ __owur int dtls1_write_bytes(SSL_CONNECTION *s, int type, const void *buf,
                              size_t len, size_t *written);
 int do_dtls1_write(SSL_CONNECTION *s, int type, const unsigned char *buf,
                    size_t len, size_t *written);
+void ossl_rlayer_set_template_data(OSSL_RECORD_TEMPLATE *tmpl,
+                                   const unsigned char *buf,
+                                   const SSL_IOVEC *iov, size_t iovcnt,
+                                   size_t off, size_t len);
 void dtls1_increment_epoch(SSL_CONNECTION *s, int rw);
 void ssl_release_record(SSL_CONNECTION *s, TLS_RECORD *rr);
 
@@ -194,3 +205,20 @@ OSSL_CORE_MAKE_FUNC(int, rlayer_security, (void *cbarg, int op, int bits,
                                            int nid, void *other))
 # define OSSL_FUNC_RLAYER_PADDING                4
 OSSL_CORE_MAKE_FUNC(size_t, rlayer_padding, (void *cbarg, int type, size_t len))
+# define OSSL_FUNC_RLAYER_ALLOC_BUFFER           5
+OSSL_CORE_MAKE_FUNC(void *, rlayer_alloc_buffer, (void *cbarg, size_t len))
+# define OSSL_FUNC_RLAYER_FREE_BUFFER            6
+OSSL_CORE_MAKE_FUNC(void, rlayer_free_buffer, (void *cbarg, void *buf,
+                                               size_t len))
+
+/* Record buffer pool shared by the connections of an SSL_CTX */
+typedef struct record_buffer_pool_st RECORD_BUFFER_POOL;
+
+RECORD_BUFFER_POOL *ossl_record_buffer_pool_new(void);
+void ossl_record_buffer_pool_free(RECORD_BUFFER_POOL *pool);
+int ossl_record_buffer_pool_set_size(RECORD_BUFFER_POOL *pool, size_t size);
+size_t ossl_record_buffer_pool_get_size(RECORD_BUFFER_POOL *pool);
+void *ossl_record_buffer_pool_alloc(RECORD_BUFFER_POOL *pool, size_t len);
+void ossl_record_buffer_pool_release(RECORD_BUFFER_POOL *pool, void *buf,
+                                     size_t len);
+long ossl_record_buffer_pool_stat(RECORD_BUFFER_POOL *pool, int stat);
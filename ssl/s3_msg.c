@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -102,6 +102,7 @@ int ssl3_dispatch_alert(SSL *s)
     }
     templ.buf = &sc->s3.send_alert[0];
     templ.buflen = 2;
+    templ.iov = NULL;
 
     if (RECORD_LAYER_write_pending(&sc->rlayer)) {
         if (sc->s3.alert_dispatch != SSL_ALERT_DISPATCH_RETRY) {
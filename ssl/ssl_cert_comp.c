@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -158,6 +158,221 @@ int OSSL_COMP_CERT_up_ref(OSSL_COMP_CERT *cc)
     return ((i > 1) ? 1 : 0);
 }
 
+/*
+ * Compressed certificate chains are cached in the SSL_CTX, keyed by the
+ * uncompressed chain and the algorithm. SSL objects that use the same chain,
+ * such as those given their certificate by an SNI callback, thus share a
+ * single compression of it. When the cache is full, the least recently used
+ * entry is evicted.
+ */
+# define COMP_CERT_CACHE_DEFAULT_SIZE   64
+
+typedef struct comp_cert_cache_entry_st COMP_CERT_CACHE_ENTRY;
+
+struct comp_cert_cache_entry_st {
+    unsigned long hash;
+    int alg;
+    unsigned char *orig;        /* the uncompressed chain */
+    size_t orig_len;
+    OSSL_COMP_CERT *cc;
+    /* LRU list, most recently used first */
+    COMP_CERT_CACHE_ENTRY *prev, *next;
+};
+
+DEFINE_LHASH_OF_EX(COMP_CERT_CACHE_ENTRY);
+
+struct ossl_comp_cert_cache_st {
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(COMP_CERT_CACHE_ENTRY) *entries;
+    COMP_CERT_CACHE_ENTRY *head, *tail;
+    size_t size;                /* maximum number of entries */
+};
+
+static unsigned long comp_cert_cache_entry_hash(const COMP_CERT_CACHE_ENTRY *e)
+{
+    return e->hash;
+}
+
+static int comp_cert_cache_entry_cmp(const COMP_CERT_CACHE_ENTRY *a,
+                                     const COMP_CERT_CACHE_ENTRY *b)
+{
+    if (a->alg != b->alg || a->orig_len != b->orig_len)
+        return 1;
+    return memcmp(a->orig, b->orig, a->orig_len);
+}
+
+static void comp_cert_cache_entry_free(COMP_CERT_CACHE_ENTRY *e)
+{
+    if (e == NULL)
+        return;
+    OSSL_COMP_CERT_free(e->cc);
+    OPENSSL_free(e->orig);
+    OPENSSL_free(e);
+}
+
+/* FNV-1a over the chain and the algorithm */
+static unsigned long comp_cert_cache_hash(const unsigned char *data,
+                                          size_t len, int alg)
+{
+    uint32_t h = 0x811c9dc5;
+    size_t i;
+
+    for (i = 0; i < len; i++)
+        h = (h ^ data[i]) * 0x01000193;
+    return (unsigned long)((h ^ (uint32_t)alg) * 0x01000193);
+}
+
+/* The LRU list is only accessed with the write lock held */
+static void comp_cert_cache_list_remove(OSSL_COMP_CERT_CACHE *cache,
+                                        COMP_CERT_CACHE_ENTRY *e)
+{
+    if (e->prev != NULL)
+        e->prev->next = e->next;
+    else
+        cache->head = e->next;
+    if (e->next != NULL)
+        e->next->prev = e->prev;
+    else
+        cache->tail = e->prev;
+    e->prev = e->next = NULL;
+}
+
+static void comp_cert_cache_list_add(OSSL_COMP_CERT_CACHE *cache,
+                                     COMP_CERT_CACHE_ENTRY *e)
+{
+    e->prev = NULL;
+    e->next = cache->head;
+    if (cache->head != NULL)
+        cache->head->prev = e;
+    else
+        cache->tail = e;
+    cache->head = e;
+}
+
+/* Evict the least recently used entries until there are at most |n| */
+static void comp_cert_cache_trim(OSSL_COMP_CERT_CACHE *cache, size_t n)
+{
+    COMP_CERT_CACHE_ENTRY *e;
+
+    while (lh_COMP_CERT_CACHE_ENTRY_num_items(cache->entries) > n
+           && (e = cache->tail) != NULL) {
+        comp_cert_cache_list_remove(cache, e);
+        lh_COMP_CERT_CACHE_ENTRY_delete(cache->entries, e);
+        comp_cert_cache_entry_free(e);
+    }
+}
+
+OSSL_COMP_CERT_CACHE *ossl_comp_cert_cache_new(void)
+{
+    OSSL_COMP_CERT_CACHE *cache = OPENSSL_zalloc(sizeof(*cache));
+
+    if (cache == NULL)
+        return NULL;
+    cache->size = COMP_CERT_CACHE_DEFAULT_SIZE;
+    if ((cache->lock = CRYPTO_THREAD_lock_new()) == NULL
+            || (cache->entries
+                = lh_COMP_CERT_CACHE_ENTRY_new(comp_cert_cache_entry_hash,
+                                               comp_cert_cache_entry_cmp)) == NULL) {
+        ossl_comp_cert_cache_free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void ossl_comp_cert_cache_free(OSSL_COMP_CERT_CACHE *cache)
+{
+    if (cache == NULL)
+        return;
+    lh_COMP_CERT_CACHE_ENTRY_doall(cache->entries, comp_cert_cache_entry_free);
+    lh_COMP_CERT_CACHE_ENTRY_free(cache->entries);
+    CRYPTO_THREAD_lock_free(cache->lock);
+    OPENSSL_free(cache);
+}
+
+/*
+ * Look up the compression of |tmpl| and make it the most recently used
+ * entry. Returns a new reference, or NULL if there is none. The write lock
+ * must be held.
+ */
+static OSSL_COMP_CERT *comp_cert_cache_lookup(OSSL_COMP_CERT_CACHE *cache,
+                                              COMP_CERT_CACHE_ENTRY *tmpl)
+{
+    COMP_CERT_CACHE_ENTRY *found;
+
+    found = lh_COMP_CERT_CACHE_ENTRY_retrieve(cache->entries, tmpl);
+    if (found == NULL || !OSSL_COMP_CERT_up_ref(found->cc))
+        return NULL;
+    if (found != cache->head) {
+        comp_cert_cache_list_remove(cache, found);
+        comp_cert_cache_list_add(cache, found);
+    }
+    return found->cc;
+}
+
+/*
+ * Compress the |len| bytes of the chain at |data| with |alg|, reusing the
+ * result cached in |cache| if there is one. Failing to add a new result to
+ * the cache is not an error.
+ */
+static OSSL_COMP_CERT *comp_cert_cache_get(OSSL_COMP_CERT_CACHE *cache,
+                                           unsigned char *data, size_t len,
+                                           int alg)
+{
+    COMP_CERT_CACHE_ENTRY tmpl, *ent;
+    OSSL_COMP_CERT *cc = NULL, *found;
+
+    if (cache == NULL)
+        return OSSL_COMP_CERT_from_uncompressed_data(data, len, alg);
+
+    tmpl.hash = comp_cert_cache_hash(data, len, alg);
+    tmpl.alg = alg;
+    tmpl.orig = data;
+    tmpl.orig_len = len;
+
+    /* A hit updates the LRU list, so even lookups need the write lock */
+    if (!CRYPTO_THREAD_write_lock(cache->lock))
+        return NULL;
+    cc = comp_cert_cache_lookup(cache, &tmpl);
+    CRYPTO_THREAD_unlock(cache->lock);
+    if (cc != NULL)
+        return cc;
+
+    /* Compress outside of the lock, the cache is only updated afterwards */
+    if ((cc = OSSL_COMP_CERT_from_uncompressed_data(data, len, alg)) == NULL)
+        return NULL;
+
+    if ((ent = OPENSSL_zalloc(sizeof(*ent))) == NULL
+            || (ent->orig = OPENSSL_memdup(data, len)) == NULL
+            || !OSSL_COMP_CERT_up_ref(cc)) {
+        comp_cert_cache_entry_free(ent);
+        return cc;
+    }
+    ent->hash = tmpl.hash;
+    ent->alg = alg;
+    ent->orig_len = len;
+    ent->cc = cc;
+
+    if (!CRYPTO_THREAD_write_lock(cache->lock)) {
+        comp_cert_cache_entry_free(ent);
+        return cc;
+    }
+    if ((found = comp_cert_cache_lookup(cache, &tmpl)) != NULL) {
+        /* Another thread got there first, share its result */
+        OSSL_COMP_CERT_free(cc);
+        cc = found;
+    } else if (cache->size > 0) {
+        comp_cert_cache_trim(cache, cache->size - 1);
+        lh_COMP_CERT_CACHE_ENTRY_insert(cache->entries, ent);
+        if (!lh_COMP_CERT_CACHE_ENTRY_error(cache->entries)) {
+            comp_cert_cache_list_add(cache, ent);
+            ent = NULL;
+        }
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+    comp_cert_cache_entry_free(ent);
+    return cc;
+}
+
 static int ssl_set_cert_comp_pref(int *prefs, int *algs, size_t len)
 {
     size_t j = 0;
@@ -243,7 +458,8 @@ static int ssl_compress_one_cert(SSL *ssl, CERT_PKEY *cpk, int alg)
 
     if ((length = ssl_get_cert_to_compress(ssl, cpk, &cert_data)) == 0)
         return 0;
-    comp_cert = OSSL_COMP_CERT_from_uncompressed_data(cert_data, length, alg);
+    comp_cert = comp_cert_cache_get(ssl->ctx->comp_cert_cache, cert_data,
+                                    length, alg);
     OPENSSL_free(cert_data);
     if (comp_cert == NULL)
         return 0;
@@ -319,15 +535,17 @@ static size_t ssl_get_compressed_cert(SSL *ssl, CERT_PKEY *cpk, int alg, unsigne
     if ((cert_len = ssl_get_cert_to_compress(ssl, cpk, &cert_data)) == 0)
         goto err;
 
-    comp_cert = OSSL_COMP_CERT_from_uncompressed_data(cert_data, cert_len, alg);
+    comp_cert = comp_cert_cache_get(ssl->ctx->comp_cert_cache, cert_data,
+                                    cert_len, alg);
     OPENSSL_free(cert_data);
     if (comp_cert == NULL)
         goto err;
 
+    /* The compressed data may be shared with the cache, so copy it */
+    if ((*data = OPENSSL_memdup(comp_cert->data, comp_cert->len)) == NULL)
+        goto err;
     comp_len = comp_cert->len;
     *orig_len = comp_cert->orig_len;
-    *data = comp_cert->data;
-    comp_cert->data = NULL;
  err:
     OSSL_COMP_CERT_free(comp_cert);
     return comp_len;
@@ -464,3 +682,35 @@ int SSL_set1_compressed_cert(SSL *ssl, int algorithm, unsigned char *comp_data,
     return 0;
 #endif
 }
+
+int SSL_CTX_set_cert_comp_cache_size(SSL_CTX *ctx, size_t size)
+{
+#ifndef OPENSSL_NO_COMP_ALG
+    OSSL_COMP_CERT_CACHE *cache = ctx->comp_cert_cache;
+
+    if (cache == NULL || !CRYPTO_THREAD_write_lock(cache->lock))
+        return 0;
+    cache->size = size;
+    comp_cert_cache_trim(cache, size);
+    CRYPTO_THREAD_unlock(cache->lock);
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+size_t SSL_CTX_get_cert_comp_cache_size(const SSL_CTX *ctx)
+{
+#ifndef OPENSSL_NO_COMP_ALG
+    OSSL_COMP_CERT_CACHE *cache = ctx->comp_cert_cache;
+    size_t size;
+
+    if (cache == NULL || !CRYPTO_THREAD_read_lock(cache->lock))
+        return 0;
+    size = cache->size;
+    CRYPTO_THREAD_unlock(cache->lock);
+    return size;
+#else
+    return 0;
+#endif
+}
@@ -79,6 +79,9 @@ struct ssl_async_args {
     SSL *s;
     void *buf;
     size_t num;
+    /* The segments of SSL_writev_ex(), NULL otherwise */
+    const SSL_IOVEC *iov;
+    size_t iovcnt;
     enum { READFUNC, WRITEFUNC, OTHERFUNC } type;
     union {
         int (*func_read) (SSL *, void *, size_t, size_t *);
@@ -1038,6 +1041,7 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
      */
     SSL_SESSION r, *p;
     const SSL_CONNECTION *sc = SSL_CONNECTION_FROM_CONST_SSL(ssl);
+    SSL_SESS_CACHE_SHARD *shard;
 
     if (sc == NULL || id_len > sizeof(r.session_id))
         return 0;
@@ -1046,10 +1050,11 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
     r.session_id_length = id_len;
     memcpy(r.session_id, id, id_len);
 
-    if (!CRYPTO_THREAD_read_lock(sc->session_ctx->lock))
+    shard = ssl_sess_cache_lock_shard(sc->session_ctx, &r, 0);
+    if (shard == NULL)
         return 0;
-    p = lh_SSL_SESSION_retrieve(sc->session_ctx->sessions, &r);
-    CRYPTO_THREAD_unlock(sc->session_ctx->lock);
+    p = lh_SSL_SESSION_retrieve(shard->sessions, &r);
+    CRYPTO_THREAD_unlock(shard->lock);
     return (p != NULL);
 }
 
@@ -2221,6 +2226,7 @@ static int ssl_io_intern(void *vargs)
     void *buf;
     size_t num;
     SSL_CONNECTION *sc;
+    int ret;
 
     args = (struct ssl_async_args *)vargs;
     s = args->s;
@@ -2233,7 +2239,13 @@ static int ssl_io_intern(void *vargs)
     case READFUNC:
         return args->f.func_read(s, buf, num, &sc->asyncrw);
     case WRITEFUNC:
-        return args->f.func_write(s, buf, num, &sc->asyncrw);
+        /* The segments must stay set while the job is paused */
+        sc->rlayer.wiov = args->iov;
+        sc->rlayer.wiovcnt = args->iovcnt;
+        ret = args->f.func_write(s, buf, num, &sc->asyncrw);
+        sc->rlayer.wiov = NULL;
+        sc->rlayer.wiovcnt = 0;
+        return ret;
     case OTHERFUNC:
         return args->f.func_other(s);
     }
@@ -2323,6 +2335,43 @@ int SSL_read_ex(SSL *s, void *buf, size_t num, size_t *readbytes)
     return ret;
 }
 
+int SSL_readv_ex(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                 size_t *readbytes)
+{
+    size_t i, n, total;
+    int ret, full;
+
+    if (iov == NULL && iovcnt > 0) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_NULL_PARAMETER);
+        return 0;
+    }
+
+    /* Only the first non-empty segment may wait for data */
+    for (i = 0; i + 1 < iovcnt && iov[i].data_len == 0; i++)
+        continue;
+    ret = ssl_read_internal(s, iovcnt > 0 ? iov[i].data : NULL,
+                            iovcnt > 0 ? iov[i].data_len : 0, &total);
+    if (ret <= 0)
+        return 0;
+
+    /*
+     * Scatter whatever data has already been processed into the following
+     * segments, without reading any more from the network.
+     */
+    full = iovcnt > 0 && total == iov[i].data_len;
+    for (i++; full && i < iovcnt && SSL_pending(s) > 0; i++) {
+        if (iov[i].data_len == 0)
+            continue;
+        if (ssl_read_internal(s, iov[i].data, iov[i].data_len, &n) <= 0)
+            break;
+        total += n;
+        full = n == iov[i].data_len;
+    }
+
+    *readbytes = total;
+    return 1;
+}
+
 int SSL_read_early_data(SSL *s, void *buf, size_t num, size_t *readbytes)
 {
     int ret;
@@ -2464,14 +2513,53 @@ int SSL_peek_ex(SSL *s, void *buf, size_t num, size_t *readbytes)
     return ret;
 }
 
-int ssl_write_internal(SSL *s, const void *buf, size_t num, size_t *written)
+int SSL_read_borrow_ex(SSL *s, const unsigned char **buf, size_t *readbytes)
+{
+#ifndef OPENSSL_NO_QUIC
+    QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
+
+    if (qc != NULL)
+        return ossl_quic_read_borrow(s, buf, readbytes);
+#endif
+
+    *buf = NULL;
+    *readbytes = 0;
+    ERR_raise(ERR_LIB_SSL, ERR_R_UNSUPPORTED);
+    return 0;
+}
+
+int SSL_read_release(SSL *s, size_t consumed)
 {
-    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL(s);
 #ifndef OPENSSL_NO_QUIC
     QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
 
     if (qc != NULL)
+        return ossl_quic_read_release(s, consumed);
+#endif
+
+    ERR_raise(ERR_LIB_SSL, ERR_R_UNSUPPORTED);
+    return 0;
+}
+
+/*
+ * Write |num| bytes from |buf|, or for SSL_writev_ex() from the |iovcnt|
+ * segments in |iov|, in which case |buf| only identifies the write so that
+ * retries can be checked.
+ */
+static int ssl_write_iov_internal(SSL *s, const void *buf,
+                                  const SSL_IOVEC *iov, size_t iovcnt,
+                                  size_t num, size_t *written)
+{
+    SSL_CONNECTION *sc = SSL_CONNECTION_FROM_SSL(s);
+    int ret;
+#ifndef OPENSSL_NO_QUIC
+    QUIC_CONNECTION *qc = QUIC_CONNECTION_FROM_SSL(s);
+
+    if (qc != NULL) {
+        if (iov != NULL)
+            return ossl_quic_writev(s, iov, iovcnt, written);
         return s->method->ssl_write(s, buf, num, written);
+    }
 #endif
 
     if (sc == NULL)
@@ -2498,12 +2586,13 @@ int ssl_write_internal(SSL *s, const void *buf, size_t num, size_t *written)
     ossl_statem_check_finish_init(sc, 1);
 
     if ((sc->mode & SSL_MODE_ASYNC) && ASYNC_get_current_job() == NULL) {
-        int ret;
         struct ssl_async_args args;
 
         args.s = s;
         args.buf = (void *)buf;
         args.num = num;
+        args.iov = iov;
+        args.iovcnt = iovcnt;
         args.type = WRITEFUNC;
         args.f.func_write = s->method->ssl_write;
 
@@ -2511,10 +2600,20 @@ int ssl_write_internal(SSL *s, const void *buf, size_t num, size_t *written)
         *written = sc->asyncrw;
         return ret;
     } else {
-        return s->method->ssl_write(s, buf, num, written);
+        sc->rlayer.wiov = iov;
+        sc->rlayer.wiovcnt = iovcnt;
+        ret = s->method->ssl_write(s, buf, num, written);
+        sc->rlayer.wiov = NULL;
+        sc->rlayer.wiovcnt = 0;
+        return ret;
     }
 }
 
+int ssl_write_internal(SSL *s, const void *buf, size_t num, size_t *written)
+{
+    return ssl_write_iov_internal(s, buf, NULL, 0, num, written);
+}
+
 ossl_ssize_t SSL_sendfile(SSL *s, int fd, off_t offset, size_t size, int flags)
 {
     ossl_ssize_t ret;
@@ -2614,6 +2713,35 @@ int SSL_write_ex(SSL *s, const void *buf, size_t num, size_t *written)
     return ret;
 }
 
+int SSL_writev_ex(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                  size_t *written)
+{
+    size_t i, num = 0;
+    int ret;
+
+    if (iov == NULL && iovcnt > 0) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_NULL_PARAMETER);
+        return 0;
+    }
+    for (i = 0; i < iovcnt; i++) {
+        if (iov[i].data == NULL && iov[i].data_len > 0) {
+            ERR_raise(ERR_LIB_SSL, ERR_R_PASSED_NULL_PARAMETER);
+            return 0;
+        }
+        if (iov[i].data_len > SIZE_MAX - num) {
+            ERR_raise(ERR_LIB_SSL, SSL_R_BAD_LENGTH);
+            return 0;
+        }
+        num += iov[i].data_len;
+    }
+
+    /* The segment array stands for the buffer in write retry checks */
+    ret = ssl_write_iov_internal(s, iov, iov, iovcnt, num, written);
+    if (ret < 0)
+        ret = 0;
+    return ret;
+}
+
 int SSL_write_early_data(SSL *s, const void *buf, size_t num, size_t *written)
 {
     int ret, early_data_state;
@@ -2992,7 +3120,12 @@ long SSL_callback_ctrl(SSL *s, int cmd, void (*fp) (void))
 
 LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx)
 {
-    return ctx->sessions;
+    SSL_SESS_CACHE *cache = ssl_ctx_get0_sess_cache(ctx);
+
+    /* A sharded cache has no single hash table to return */
+    if (cache == NULL || cache->num_shards != 1)
+        return NULL;
+    return cache->shards[0].sessions;
 }
 
 static int ssl_tsan_load(SSL_CTX *ctx, TSAN_QUALIFIER int *stat)
@@ -3009,6 +3142,8 @@ static int ssl_tsan_load(SSL_CTX *ctx, TSAN_QUALIFIER int *stat)
 long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
 {
     long l;
+    size_t i;
+    SSL_SESS_CACHE *cache;
     /* For some cases with ctx == NULL perform syntax checks */
     if (ctx == NULL) {
         switch (cmd) {
@@ -3053,13 +3188,27 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         return (long)ctx->session_cache_size;
     case SSL_CTRL_SET_SESS_CACHE_MODE:
         l = ctx->session_cache_mode;
+        /*
+         * Changing between a sharded and an unsharded cache moves the cached
+         * sessions to the other layout. If that fails keep the current layout
+         * and report it.
+         */
+        if (((l ^ larg) & SSL_SESS_CACHE_SHARDED) != 0
+            && !ssl_ctx_sess_cache_set_sharded(ctx,
+                                               (larg & SSL_SESS_CACHE_SHARDED)
+                                               != 0))
+            larg ^= SSL_SESS_CACHE_SHARDED;
         ctx->session_cache_mode = larg;
         return l;
     case SSL_CTRL_GET_SESS_CACHE_MODE:
         return ctx->session_cache_mode;
 
     case SSL_CTRL_SESS_NUMBER:
-        return lh_SSL_SESSION_num_items(ctx->sessions);
+        if ((cache = ssl_ctx_get0_sess_cache(ctx)) == NULL)
+            return 0;
+        for (l = 0, i = 0; i < cache->num_shards; i++)
+            l += lh_SSL_SESSION_num_items(cache->shards[i].sessions);
+        return l;
     case SSL_CTRL_SESS_CONNECT:
         return ssl_tsan_load(ctx, &ctx->stats.sess_connect);
     case SSL_CTRL_SESS_CONNECT_GOOD:
@@ -3103,6 +3252,24 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
             return 0;
         ctx->max_pipelines = larg;
         return 1;
+    case SSL_CTRL_SET_RECORD_BUFFER_POOL_SIZE:
+        if (larg < 0)
+            return 0;
+        if (ctx->rbuf_pool == NULL) {
+            if (larg == 0)
+                return 1;
+            if ((ctx->rbuf_pool = ossl_record_buffer_pool_new()) == NULL)
+                return 0;
+        }
+        return ossl_record_buffer_pool_set_size(ctx->rbuf_pool, (size_t)larg);
+    case SSL_CTRL_GET_RECORD_BUFFER_POOL_SIZE:
+        if (ctx->rbuf_pool == NULL)
+            return 0;
+        return (long)ossl_record_buffer_pool_get_size(ctx->rbuf_pool);
+    case SSL_CTRL_GET_RECORD_BUFFER_POOL_STAT:
+        if (ctx->rbuf_pool == NULL)
+            return 0;
+        return ossl_record_buffer_pool_stat(ctx->rbuf_pool, (int)larg);
     case SSL_CTRL_CERT_FLAGS:
         return (ctx->cert->cert_flags |= larg);
     case SSL_CTRL_CLEAR_CERT_FLAGS:
@@ -3771,6 +3938,63 @@ static int ssl_session_cmp(const SSL_SESSION *a, const SSL_SESSION *b)
     return memcmp(a->session_id, b->session_id, a->session_id_length);
 }
 
+/*
+ * Creates an empty internal session cache layout with num_shards shards. If
+ * lock is not NULL it protects the only shard, otherwise each shard is given a
+ * lock of its own.
+ */
+SSL_SESS_CACHE *ssl_sess_cache_new(size_t num_shards, CRYPTO_RWLOCK *lock)
+{
+    SSL_SESS_CACHE *cache;
+    size_t i;
+
+    if (!ossl_assert(lock == NULL || num_shards == 1)
+            || (cache = OPENSSL_zalloc(sizeof(*cache))) == NULL)
+        return NULL;
+
+    if ((cache->shards = OPENSSL_zalloc(num_shards
+                                        * sizeof(*cache->shards))) == NULL) {
+        OPENSSL_free(cache);
+        return NULL;
+    }
+    cache->num_shards = num_shards;
+
+    for (i = 0; i < num_shards; i++) {
+        cache->shards[i].lock = lock != NULL ? lock : CRYPTO_THREAD_lock_new();
+        cache->shards[i].sessions = lh_SSL_SESSION_new(ssl_session_hash,
+                                                       ssl_session_cmp);
+        if (cache->shards[i].lock == NULL
+                || cache->shards[i].sessions == NULL) {
+            ERR_raise(ERR_LIB_SSL, ERR_R_CRYPTO_LIB);
+            if (lock != NULL)
+                cache->shards[i].lock = NULL;
+            ssl_sess_cache_free(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+/*
+ * Frees an internal session cache layout, which must be empty. The lock of a
+ * single shard layout belongs to the SSL_CTX and is not freed.
+ */
+void ssl_sess_cache_free(SSL_SESS_CACHE *cache)
+{
+    size_t i;
+
+    if (cache == NULL)
+        return;
+
+    for (i = 0; i < cache->num_shards; i++) {
+        lh_SSL_SESSION_free(cache->shards[i].sessions);
+        if (cache->num_shards > 1)
+            CRYPTO_THREAD_lock_free(cache->shards[i].lock);
+    }
+    OPENSSL_free(cache->shards);
+    OPENSSL_free(cache);
+}
+
 /*
  * These wrapper functions should remain rather than redeclaring
  * SSL_SESSION_hash and SSL_SESSION_cmp for void* types and casting each
@@ -3836,11 +4060,9 @@ SSL_CTX *SSL_CTX_new_ex(OSSL_LIB_CTX *libctx, const char *propq,
     ret->max_cert_list = SSL_MAX_CERT_LIST_DEFAULT;
     ret->verify_mode = SSL_VERIFY_NONE;
 
-    ret->sessions = lh_SSL_SESSION_new(ssl_session_hash, ssl_session_cmp);
-    if (ret->sessions == NULL) {
-        ERR_raise(ERR_LIB_SSL, ERR_R_CRYPTO_LIB);
+    if ((ret->sess_cache_single = ssl_sess_cache_new(1, ret->lock)) == NULL)
         goto err;
-    }
+    ret->sess_cache = ret->sess_cache_single;
     ret->cert_store = X509_STORE_new();
     if (ret->cert_store == NULL) {
         ERR_raise(ERR_LIB_SSL, ERR_R_X509_LIB);
@@ -3987,6 +4209,10 @@ SSL_CTX *SSL_CTX_new_ex(OSSL_LIB_CTX *libctx, const char *propq,
         ret->cert_comp_prefs[i++] = TLSEXT_comp_cert_zlib;
     if (ossl_comp_has_alg(TLSEXT_comp_cert_zstd))
         ret->cert_comp_prefs[i++] = TLSEXT_comp_cert_zstd;
+    if ((ret->comp_cert_cache = ossl_comp_cert_cache_new()) == NULL) {
+        ERR_raise(ERR_LIB_SSL, ERR_R_CRYPTO_LIB);
+        goto err;
+    }
 #endif
     /*
      * Disable compression by default to prevent CRIME. Applications can
@@ -4082,11 +4308,12 @@ void SSL_CTX_free(SSL_CTX *a)
      * free ex_data, then finally free the cache.
      * (See ticket [openssl.org #212].)
      */
-    if (a->sessions != NULL)
+    if (a->sess_cache != NULL)
         SSL_CTX_flush_sessions(a, 0);
 
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_SSL_CTX, a, &a->ex_data);
-    lh_SSL_SESSION_free(a->sessions);
+    ssl_sess_cache_free(a->sess_cache_single);
+    ssl_sess_cache_free(a->sess_cache_sharded);
     X509_STORE_free(a->cert_store);
 #ifndef OPENSSL_NO_CT
     CTLOG_STORE_free(a->ctlog_store);
@@ -4148,6 +4375,11 @@ void SSL_CTX_free(SSL_CTX *a)
     OPENSSL_free(a->client_cert_type);
     OPENSSL_free(a->server_cert_type);
 
+    ossl_record_buffer_pool_free(a->rbuf_pool);
+#ifndef OPENSSL_NO_COMP_ALG
+    ossl_comp_cert_cache_free(a->comp_cert_cache);
+#endif
+
     CRYPTO_THREAD_lock_free(a->lock);
 #ifdef TSAN_REQUIRES_LOCKING
     CRYPTO_THREAD_lock_free(a->tsan_lock);
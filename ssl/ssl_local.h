@@ -799,6 +799,27 @@ typedef struct {
 
 # define TLS_GROUP_FFDHE_FOR_TLS1_3 (TLS_GROUP_FFDHE|TLS_GROUP_ONLY_FOR_TLS1_3)
 
+/* Number of shards used by the internal session cache if it is sharded */
+# define SSL_SESS_CACHE_NUM_SHARDS  16
+
+/*
+ * One shard of the internal session cache: a hash table of sessions and a
+ * doubly linked list of the same sessions ordered by timeout, both protected
+ * by lock.
+ */
+typedef struct ssl_sess_cache_shard_st {
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(SSL_SESSION) *sessions;
+    struct ssl_session_st *session_cache_head;
+    struct ssl_session_st *session_cache_tail;
+} SSL_SESS_CACHE_SHARD;
+
+/* A layout of the internal session cache */
+typedef struct ssl_sess_cache_st {
+    size_t num_shards;
+    SSL_SESS_CACHE_SHARD *shards;
+} SSL_SESS_CACHE;
+
 struct ssl_ctx_st {
     OSSL_LIB_CTX *libctx;
 
@@ -809,14 +830,23 @@ struct ssl_ctx_st {
     /* TLSv1.3 specific ciphersuites */
     STACK_OF(SSL_CIPHER) *tls13_ciphersuites;
     struct x509_store_st /* X509_STORE */ *cert_store;
-    LHASH_OF(SSL_SESSION) *sessions;
+    /*
+     * The internal session cache. Sessions are distributed over the shards of
+     * sess_cache by session ID. sess_cache is sess_cache_single, a single
+     * shard whose lock is the SSL_CTX lock, unless SSL_SESS_CACHE_SHARDED is
+     * set, in which case it is sess_cache_sharded, which has
+     * SSL_SESS_CACHE_NUM_SHARDS shards with their own locks. sess_cache is
+     * only changed while every shard of both layouts is write locked, and
+     * neither layout is freed before the SSL_CTX.
+     */
+    SSL_SESS_CACHE *sess_cache;
+    SSL_SESS_CACHE *sess_cache_single;
+    SSL_SESS_CACHE *sess_cache_sharded;
     /*
      * Most session-ids that will be cached, default is
      * SSL_SESSION_CACHE_MAX_SIZE_DEFAULT. 0 is unlimited.
      */
     size_t session_cache_size;
-    struct ssl_session_st *session_cache_head;
-    struct ssl_session_st *session_cache_tail;
     /*
      * This can have one of 2 values, ored together, SSL_SESS_CACHE_CLIENT,
      * SSL_SESS_CACHE_SERVER, Default is SSL_SESSION_CACHE_SERVER, which
@@ -983,6 +1013,12 @@ struct ssl_ctx_st {
     /* The default read buffer length to use (0 means not set) */
     size_t default_read_buf_len;
 
+    /*
+     * Pool that TLS record layers borrow their buffers from while data is in
+     * flight, NULL until SSL_CTX_set_record_buffer_pool_size() enables it
+     */
+    RECORD_BUFFER_POOL *rbuf_pool;
+
 # ifndef OPENSSL_NO_ENGINE
     /*
      * Engine to pass requests for client certs to
@@ -1178,6 +1214,8 @@ struct ssl_ctx_st {
 #ifndef OPENSSL_NO_COMP_ALG
     /* certificate compression preferences */
     int cert_comp_prefs[TLSEXT_comp_cert_limit];
+    /* compressed certificate chains shared by the SSL objects */
+    struct ossl_comp_cert_cache_st *comp_cert_cache;
 #endif
 
     /* Certificate Type stuff - for RPK vs X.509 */
@@ -1969,6 +2007,11 @@ typedef struct ossl_comp_cert_st OSSL_COMP_CERT;
 
 void OSSL_COMP_CERT_free(OSSL_COMP_CERT *c);
 int OSSL_COMP_CERT_up_ref(OSSL_COMP_CERT *c);
+
+typedef struct ossl_comp_cert_cache_st OSSL_COMP_CERT_CACHE;
+
+OSSL_COMP_CERT_CACHE *ossl_comp_cert_cache_new(void);
+void ossl_comp_cert_cache_free(OSSL_COMP_CERT_CACHE *cache);
 # endif
 
 struct cert_pkey_st {
@@ -2477,6 +2520,14 @@ void ssl_cert_clear_certs(CERT *c);
 void ssl_cert_free(CERT *c);
 __owur int ssl_generate_session_id(SSL_CONNECTION *s, SSL_SESSION *ss);
 __owur int ssl_get_new_session(SSL_CONNECTION *s, int session);
+__owur SSL_SESS_CACHE *ssl_sess_cache_new(size_t num_shards,
+                                          CRYPTO_RWLOCK *lock);
+void ssl_sess_cache_free(SSL_SESS_CACHE *cache);
+__owur int ssl_ctx_sess_cache_set_sharded(SSL_CTX *ctx, int sharded);
+__owur SSL_SESS_CACHE *ssl_ctx_get0_sess_cache(SSL_CTX *ctx);
+__owur SSL_SESS_CACHE_SHARD *ssl_sess_cache_lock_shard(SSL_CTX *ctx,
+                                                       const SSL_SESSION *s,
+                                                       int write);
 __owur SSL_SESSION *lookup_sess_in_cache(SSL_CONNECTION *s,
                                          const unsigned char *sess_id,
                                          size_t sess_id_len);
@@ -17,12 +17,16 @@
 #include <openssl/engine.h>
 #include "internal/refcount.h"
 #include "internal/cryptlib.h"
+#include "internal/tsan_assist.h"
 #include "ssl_local.h"
 #include "statem/statem_local.h"
 
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s);
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s);
-static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck);
+static void SSL_SESSION_list_remove(SSL_SESS_CACHE_SHARD *shard,
+                                    SSL_SESSION *s);
+static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESS_CACHE_SHARD *shard,
+                                 SSL_SESSION *s);
+static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c,
+                               SSL_SESS_CACHE_SHARD *locked);
 
 DEFINE_STACK_OF(SSL_SESSION)
 
@@ -482,6 +486,7 @@ SSL_SESSION *lookup_sess_in_cache(SSL_CONNECTION *s,
     if ((s->session_ctx->session_cache_mode
          & SSL_SESS_CACHE_NO_INTERNAL_LOOKUP) == 0) {
         SSL_SESSION data;
+        SSL_SESS_CACHE_SHARD *shard;
 
         data.ssl_version = s->version;
         if (!ossl_assert(sess_id_len <= SSL_MAX_SSL_SESSION_ID_LENGTH))
@@ -490,14 +495,15 @@ SSL_SESSION *lookup_sess_in_cache(SSL_CONNECTION *s,
         memcpy(data.session_id, sess_id, sess_id_len);
         data.session_id_length = sess_id_len;
 
-        if (!CRYPTO_THREAD_read_lock(s->session_ctx->lock))
+        shard = ssl_sess_cache_lock_shard(s->session_ctx, &data, 0);
+        if (shard == NULL)
             return NULL;
-        ret = lh_SSL_SESSION_retrieve(s->session_ctx->sessions, &data);
+        ret = lh_SSL_SESSION_retrieve(shard->sessions, &data);
         if (ret != NULL) {
             /* don't allow other threads to steal it: */
             SSL_SESSION_up_ref(ret);
         }
-        CRYPTO_THREAD_unlock(s->session_ctx->lock);
+        CRYPTO_THREAD_unlock(shard->lock);
         if (ret == NULL)
             ssl_tsan_counter(s->session_ctx, &s->session_ctx->stats.sess_miss);
     }
@@ -697,6 +703,8 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 {
     int ret = 0;
     SSL_SESSION *s;
+    SSL_SESS_CACHE_SHARD *shard;
+    size_t shard_size;
 
     /*
      * add just 1 reference count for the SSL_CTX's session cache even though
@@ -708,20 +716,20 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
      * if session c is in already in cache, we take back the increment later
      */
 
-    if (!CRYPTO_THREAD_write_lock(ctx->lock)) {
+    if ((shard = ssl_sess_cache_lock_shard(ctx, c, 1)) == NULL) {
         SSL_SESSION_free(c);
         return 0;
     }
-    s = lh_SSL_SESSION_insert(ctx->sessions, c);
+    s = lh_SSL_SESSION_insert(shard->sessions, c);
 
     /*
      * s != NULL iff we already had a session with the given PID. In this
      * case, s == c should hold (then we did not really modify
-     * ctx->sessions), or we're in trouble.
+     * the cache), or we're in trouble.
      */
     if (s != NULL && s != c) {
         /* We *are* in trouble ... */
-        SSL_SESSION_list_remove(ctx, s);
+        SSL_SESSION_list_remove(shard, s);
         SSL_SESSION_free(s);
         /*
          * ... so pretend the other session did not exist in cache (we cannot
@@ -731,7 +739,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
          */
         s = NULL;
     } else if (s == NULL &&
-               lh_SSL_SESSION_retrieve(ctx->sessions, c) == NULL) {
+               lh_SSL_SESSION_retrieve(shard->sessions, c) == NULL) {
         /* s == NULL can also mean OOM error in lh_SSL_SESSION_insert ... */
 
         /*
@@ -755,9 +763,18 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
         ret = 1;
 
-        if (SSL_CTX_sess_get_cache_size(ctx) > 0) {
-            while (SSL_CTX_sess_number(ctx) >= SSL_CTX_sess_get_cache_size(ctx)) {
-                if (!remove_session_lock(ctx, ctx->session_cache_tail, 0))
+        /*
+         * The cache size limit is applied to each shard in proportion, so that
+         * only the shard we are adding to needs to be locked. The layout
+         * cannot change while it is locked.
+         */
+        shard_size = SSL_CTX_sess_get_cache_size(ctx);
+        if (shard_size > 0) {
+            shard_size = (shard_size + ctx->sess_cache->num_shards - 1)
+                         / ctx->sess_cache->num_shards;
+            while (lh_SSL_SESSION_num_items(shard->sessions) >= shard_size) {
+                if (!remove_session_lock(ctx, shard->session_cache_tail,
+                                         shard))
                     break;
                 else
                     ssl_tsan_counter(ctx, &ctx->stats.sess_cache_full);
@@ -765,7 +782,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
         }
     }
 
-    SSL_SESSION_list_add(ctx, c);
+    SSL_SESSION_list_add(ctx, shard, c);
 
     if (s != NULL) {
         /*
@@ -776,34 +793,39 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
         SSL_SESSION_free(s);    /* s == c */
         ret = 0;
     }
-    CRYPTO_THREAD_unlock(ctx->lock);
+    CRYPTO_THREAD_unlock(shard->lock);
     return ret;
 }
 
 int SSL_CTX_remove_session(SSL_CTX *ctx, SSL_SESSION *c)
 {
-    return remove_session_lock(ctx, c, 1);
+    return remove_session_lock(ctx, c, NULL);
 }
 
-static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck)
+/*
+ * Removes c from the internal session cache of ctx. If locked is not NULL it
+ * is the shard holding c, which the caller has already write locked.
+ */
+static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c,
+                               SSL_SESS_CACHE_SHARD *locked)
 {
     SSL_SESSION *r;
+    SSL_SESS_CACHE_SHARD *shard = locked;
     int ret = 0;
 
     if ((c != NULL) && (c->session_id_length != 0)) {
-        if (lck) {
-            if (!CRYPTO_THREAD_write_lock(ctx->lock))
-                return 0;
-        }
-        if ((r = lh_SSL_SESSION_retrieve(ctx->sessions, c)) != NULL) {
+        if (locked == NULL
+                && (shard = ssl_sess_cache_lock_shard(ctx, c, 1)) == NULL)
+            return 0;
+        if ((r = lh_SSL_SESSION_retrieve(shard->sessions, c)) != NULL) {
             ret = 1;
-            r = lh_SSL_SESSION_delete(ctx->sessions, r);
-            SSL_SESSION_list_remove(ctx, r);
+            r = lh_SSL_SESSION_delete(shard->sessions, r);
+            SSL_SESSION_list_remove(shard, r);
         }
         c->not_resumable = 1;
 
-        if (lck)
-            CRYPTO_THREAD_unlock(ctx->lock);
+        if (locked == NULL)
+            CRYPTO_THREAD_unlock(shard->lock);
 
         if (ctx->remove_session_cb != NULL)
             ctx->remove_session_cb(ctx, c);
@@ -886,29 +908,56 @@ int SSL_set_session(SSL *s, SSL_SESSION *session)
 int SSL_SESSION_set1_id(SSL_SESSION *s, const unsigned char *sid,
                         unsigned int sid_len)
 {
+    SSL_CTX *owner = s->owner;
+    SSL_SESS_CACHE_SHARD *shard;
+    int cached = 0;
+
     if (sid_len > SSL_MAX_SSL_SESSION_ID_LENGTH) {
       ERR_raise(ERR_LIB_SSL, SSL_R_SSL_SESSION_ID_TOO_LONG);
       return 0;
     }
+
+    /*
+     * The internal session cache finds sessions by their ID, so a cached
+     * session is taken out of the cache while its ID changes and then added
+     * back, keeping the reference the cache holds.
+     */
+    if (owner != NULL) {
+        if ((shard = ssl_sess_cache_lock_shard(owner, s, 1)) == NULL)
+            return 0;
+        if (lh_SSL_SESSION_retrieve(shard->sessions, s) == s) {
+            lh_SSL_SESSION_delete(shard->sessions, s);
+            SSL_SESSION_list_remove(shard, s);
+            cached = 1;
+        }
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+
     s->session_id_length = sid_len;
     if (sid != s->session_id)
         memcpy(s->session_id, sid, sid_len);
+
+    if (cached) {
+        SSL_CTX_add_session(owner, s);
+        SSL_SESSION_free(s);
+    }
     return 1;
 }
 
 long SSL_SESSION_set_timeout(SSL_SESSION *s, long t)
 {
     OSSL_TIME new_timeout = ossl_seconds2time(t);
+    SSL_SESS_CACHE_SHARD *shard;
 
     if (s == NULL || t < 0)
         return 0;
     if (s->owner != NULL) {
-        if (!CRYPTO_THREAD_write_lock(s->owner->lock))
+        if ((shard = ssl_sess_cache_lock_shard(s->owner, s, 1)) == NULL)
             return 0;
         s->timeout = new_timeout;
         ssl_session_calculate_timeout(s);
-        SSL_SESSION_list_add(s->owner, s);
-        CRYPTO_THREAD_unlock(s->owner->lock);
+        SSL_SESSION_list_add(s->owner, shard, s);
+        CRYPTO_THREAD_unlock(shard->lock);
     } else {
         s->timeout = new_timeout;
         ssl_session_calculate_timeout(s);
@@ -933,16 +982,17 @@ long SSL_SESSION_get_time(const SSL_SESSION *s)
 long SSL_SESSION_set_time(SSL_SESSION *s, long t)
 {
     OSSL_TIME new_time = ossl_time_from_time_t((time_t)t);
+    SSL_SESS_CACHE_SHARD *shard;
 
     if (s == NULL)
         return 0;
     if (s->owner != NULL) {
-        if (!CRYPTO_THREAD_write_lock(s->owner->lock))
+        if ((shard = ssl_sess_cache_lock_shard(s->owner, s, 1)) == NULL)
             return 0;
         s->time = new_time;
         ssl_session_calculate_timeout(s);
-        SSL_SESSION_list_add(s->owner, s);
-        CRYPTO_THREAD_unlock(s->owner->lock);
+        SSL_SESSION_list_add(s->owner, shard, s);
+        CRYPTO_THREAD_unlock(shard->lock);
     } else {
         s->time = new_time;
         ssl_session_calculate_timeout(s);
@@ -1159,47 +1209,63 @@ void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
 {
     STACK_OF(SSL_SESSION) *sk;
     SSL_SESSION *current;
+    SSL_SESS_CACHE *cache;
+    SSL_SESS_CACHE_SHARD *shard;
     unsigned long i;
+    size_t j;
     const OSSL_TIME timeout = ossl_time_from_time_t(t);
 
-    if (!CRYPTO_THREAD_write_lock(s->lock))
-        return;
-
     sk = sk_SSL_SESSION_new_null();
-    i = lh_SSL_SESSION_get_down_load(s->sessions);
-    lh_SSL_SESSION_set_down_load(s->sessions, 0);
 
-    /*
-     * Iterate over the list from the back (oldest), and stop
-     * when a session can no longer be removed.
-     * Add the session to a temporary list to be freed outside
-     * the SSL_CTX lock.
-     * But still do the remove_session_cb() within the lock.
-     */
-    while (s->session_cache_tail != NULL) {
-        current = s->session_cache_tail;
-        if (t == 0 || sess_timedout(timeout, current)) {
-            lh_SSL_SESSION_delete(s->sessions, current);
-            SSL_SESSION_list_remove(s, current);
-            current->not_resumable = 1;
-            if (s->remove_session_cb != NULL)
-                s->remove_session_cb(s, current);
-            /*
-             * Throw the session on a stack, it's entirely plausible
-             * that while freeing outside the critical section, the
-             * session could be re-added, so avoid using the next/prev
-             * pointers. If the stack failed to create, or the session
-             * couldn't be put on the stack, just free it here
-             */
-            if (sk == NULL || !sk_SSL_SESSION_push(sk, current))
-                SSL_SESSION_free(current);
-        } else {
-            break;
+    cache = ssl_ctx_get0_sess_cache(s);
+    j = 0;
+    while (cache != NULL && j < cache->num_shards) {
+        shard = &cache->shards[j++];
+        if (!CRYPTO_THREAD_write_lock(shard->lock))
+            continue;
+        if (s->sess_cache != cache) {
+            /* The sessions have moved to the other layout, start over */
+            CRYPTO_THREAD_unlock(shard->lock);
+            cache = ssl_ctx_get0_sess_cache(s);
+            j = 0;
+            continue;
+        }
+
+        i = lh_SSL_SESSION_get_down_load(shard->sessions);
+        lh_SSL_SESSION_set_down_load(shard->sessions, 0);
+
+        /*
+         * Iterate over the list from the back (oldest), and stop
+         * when a session can no longer be removed.
+         * Add the session to a temporary list to be freed outside
+         * the shard lock.
+         * But still do the remove_session_cb() within the lock.
+         */
+        while (shard->session_cache_tail != NULL) {
+            current = shard->session_cache_tail;
+            if (t == 0 || sess_timedout(timeout, current)) {
+                lh_SSL_SESSION_delete(shard->sessions, current);
+                SSL_SESSION_list_remove(shard, current);
+                current->not_resumable = 1;
+                if (s->remove_session_cb != NULL)
+                    s->remove_session_cb(s, current);
+                /*
+                 * Throw the session on a stack, it's entirely plausible
+                 * that while freeing outside the critical section, the
+                 * session could be re-added, so avoid using the next/prev
+                 * pointers. If the stack failed to create, or the session
+                 * couldn't be put on the stack, just free it here
+                 */
+                if (sk == NULL || !sk_SSL_SESSION_push(sk, current))
+                    SSL_SESSION_free(current);
+            } else {
+                break;
+            }
         }
-    }
 
-    lh_SSL_SESSION_set_down_load(s->sessions, i);
-    CRYPTO_THREAD_unlock(s->lock);
+        lh_SSL_SESSION_set_down_load(shard->sessions, i);
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
 
     sk_SSL_SESSION_pop_free(sk, SSL_SESSION_free);
 }
@@ -1216,27 +1282,173 @@ int ssl_clear_bad_session(SSL_CONNECTION *s)
         return 0;
 }
 
-/* locked by SSL_CTX in the calling function */
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
+/*
+ * Selects the shard of cache a session belongs to. All bytes of the session ID
+ * are mixed in, as the low bits of ssl_session_hash() already select the
+ * bucket within the hash table of each shard.
+ */
+static SSL_SESS_CACHE_SHARD *sess_cache_shard(const SSL_SESS_CACHE *cache,
+                                              const SSL_SESSION *s)
+{
+    size_t i;
+    unsigned int h = 0;
+
+    if (cache->num_shards == 1)
+        return &cache->shards[0];
+
+    for (i = 0; i < s->session_id_length; i++)
+        h = h * 31 + s->session_id[i];
+    return &cache->shards[h % cache->num_shards];
+}
+
+/*
+ * Returns the current layout of the internal session cache of ctx. It may be
+ * switched at any time, so it must be checked again once a shard is locked.
+ */
+SSL_SESS_CACHE *ssl_ctx_get0_sess_cache(SSL_CTX *ctx)
+{
+    SSL_SESS_CACHE *cache;
+
+#ifdef tsan_ld_acq
+    cache = tsan_ld_acq((SSL_SESS_CACHE *TSAN_QUALIFIER *)&ctx->sess_cache);
+#else
+    if (!CRYPTO_THREAD_read_lock(ctx->lock))
+        return NULL;
+    cache = ctx->sess_cache;
+    CRYPTO_THREAD_unlock(ctx->lock);
+#endif
+    return cache;
+}
+
+/*
+ * Locks the shard of the internal session cache of ctx that s belongs to, for
+ * reading or writing. Returns the locked shard, or NULL on error.
+ */
+SSL_SESS_CACHE_SHARD *ssl_sess_cache_lock_shard(SSL_CTX *ctx,
+                                                const SSL_SESSION *s,
+                                                int write)
+{
+    SSL_SESS_CACHE *cache;
+    SSL_SESS_CACHE_SHARD *shard;
+
+    for (;;) {
+        if ((cache = ssl_ctx_get0_sess_cache(ctx)) == NULL)
+            return NULL;
+        shard = sess_cache_shard(cache, s);
+        if (!(write ? CRYPTO_THREAD_write_lock(shard->lock)
+                    : CRYPTO_THREAD_read_lock(shard->lock)))
+            return NULL;
+        /* The layout cannot be switched while one of its shards is locked */
+        if (ctx->sess_cache == cache)
+            return shard;
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+}
+
+static void sess_cache_unlock_all(SSL_SESS_CACHE *cache, size_t num_locked)
+{
+    while (num_locked-- > 0)
+        CRYPTO_THREAD_unlock(cache->shards[num_locked].lock);
+}
+
+static int sess_cache_lock_all(SSL_SESS_CACHE *cache)
+{
+    size_t i;
+
+    for (i = 0; cache != NULL && i < cache->num_shards; i++) {
+        if (!CRYPTO_THREAD_write_lock(cache->shards[i].lock)) {
+            sess_cache_unlock_all(cache, i);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Switches the internal session cache of ctx to the sharded or to the single
+ * shard layout, moving the cached sessions across. Every shard of both
+ * layouts is write locked while this happens, so that threads using the cache
+ * wait for the switch to complete and then find the sessions in the new
+ * layout.
+ */
+int ssl_ctx_sess_cache_set_sharded(SSL_CTX *ctx, int sharded)
+{
+    SSL_SESS_CACHE *from = ctx->sess_cache, *to;
+    SSL_SESS_CACHE_SHARD *src, *dst;
+    SSL_SESSION *s;
+    size_t i;
+
+    if (sharded && ctx->sess_cache_sharded == NULL
+            && (ctx->sess_cache_sharded
+                = ssl_sess_cache_new(SSL_SESS_CACHE_NUM_SHARDS, NULL)) == NULL)
+        return 0;
+
+    to = sharded ? ctx->sess_cache_sharded : ctx->sess_cache_single;
+    if (from == to)
+        return 1;
+
+    /* The single shard layout is always locked first */
+    if (!sess_cache_lock_all(ctx->sess_cache_single))
+        return 0;
+    if (!sess_cache_lock_all(ctx->sess_cache_sharded)) {
+        sess_cache_unlock_all(ctx->sess_cache_single, 1);
+        return 0;
+    }
+
+    for (i = 0; i < from->num_shards; i++) {
+        src = &from->shards[i];
+        /* Oldest first, so that each session goes to the head of its list */
+        while ((s = src->session_cache_tail) != NULL) {
+            lh_SSL_SESSION_delete(src->sessions, s);
+            SSL_SESSION_list_remove(src, s);
+            dst = sess_cache_shard(to, s);
+            if (lh_SSL_SESSION_insert(dst->sessions, s) == NULL
+                    && lh_SSL_SESSION_retrieve(dst->sessions, s) == NULL) {
+                /* Out of memory, so the session drops out of the cache */
+                s->not_resumable = 1;
+                if (ctx->remove_session_cb != NULL)
+                    ctx->remove_session_cb(ctx, s);
+                SSL_SESSION_free(s);
+                continue;
+            }
+            SSL_SESSION_list_add(ctx, dst, s);
+        }
+    }
+
+#ifdef tsan_st_rel
+    tsan_st_rel((SSL_SESS_CACHE *TSAN_QUALIFIER *)&ctx->sess_cache, to);
+#else
+    ctx->sess_cache = to;
+#endif
+
+    sess_cache_unlock_all(ctx->sess_cache_sharded,
+                          ctx->sess_cache_sharded->num_shards);
+    sess_cache_unlock_all(ctx->sess_cache_single, 1);
+    return 1;
+}
+
+/* locked by the session cache shard in the calling function */
+static void SSL_SESSION_list_remove(SSL_SESS_CACHE_SHARD *shard,
+                                    SSL_SESSION *s)
 {
     if ((s->next == NULL) || (s->prev == NULL))
         return;
 
-    if (s->next == (SSL_SESSION *)&(ctx->session_cache_tail)) {
+    if (s->next == (SSL_SESSION *)&(shard->session_cache_tail)) {
         /* last element in list */
-        if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head)) {
+        if (s->prev == (SSL_SESSION *)&(shard->session_cache_head)) {
             /* only one element in list */
-            ctx->session_cache_head = NULL;
-            ctx->session_cache_tail = NULL;
+            shard->session_cache_head = NULL;
+            shard->session_cache_tail = NULL;
         } else {
-            ctx->session_cache_tail = s->prev;
-            s->prev->next = (SSL_SESSION *)&(ctx->session_cache_tail);
+            shard->session_cache_tail = s->prev;
+            s->prev->next = (SSL_SESSION *)&(shard->session_cache_tail);
         }
     } else {
-        if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head)) {
+        if (s->prev == (SSL_SESSION *)&(shard->session_cache_head)) {
             /* first element in list */
-            ctx->session_cache_head = s->next;
-            s->next->prev = (SSL_SESSION *)&(ctx->session_cache_head);
+            shard->session_cache_head = s->next;
+            s->next->prev = (SSL_SESSION *)&(shard->session_cache_head);
         } else {
             /* middle of list */
             s->next->prev = s->prev;
@@ -1247,41 +1459,42 @@ static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
     s->owner = NULL;
 }
 
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s)
+static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESS_CACHE_SHARD *shard,
+                                 SSL_SESSION *s)
 {
     SSL_SESSION *next;
 
     if ((s->next != NULL) && (s->prev != NULL))
-        SSL_SESSION_list_remove(ctx, s);
+        SSL_SESSION_list_remove(shard, s);
 
-    if (ctx->session_cache_head == NULL) {
-        ctx->session_cache_head = s;
-        ctx->session_cache_tail = s;
-        s->prev = (SSL_SESSION *)&(ctx->session_cache_head);
-        s->next = (SSL_SESSION *)&(ctx->session_cache_tail);
+    if (shard->session_cache_head == NULL) {
+        shard->session_cache_head = s;
+        shard->session_cache_tail = s;
+        s->prev = (SSL_SESSION *)&(shard->session_cache_head);
+        s->next = (SSL_SESSION *)&(shard->session_cache_tail);
     } else {
-        if (timeoutcmp(s, ctx->session_cache_head) >= 0) {
+        if (timeoutcmp(s, shard->session_cache_head) >= 0) {
             /*
              * if we timeout after (or the same time as) the first
              * session, put us first - usual case
              */
-            s->next = ctx->session_cache_head;
+            s->next = shard->session_cache_head;
             s->next->prev = s;
-            s->prev = (SSL_SESSION *)&(ctx->session_cache_head);
-            ctx->session_cache_head = s;
-        } else if (timeoutcmp(s, ctx->session_cache_tail) < 0) {
+            s->prev = (SSL_SESSION *)&(shard->session_cache_head);
+            shard->session_cache_head = s;
+        } else if (timeoutcmp(s, shard->session_cache_tail) < 0) {
             /* if we timeout before the last session, put us last */
-            s->prev = ctx->session_cache_tail;
+            s->prev = shard->session_cache_tail;
             s->prev->next = s;
-            s->next = (SSL_SESSION *)&(ctx->session_cache_tail);
-            ctx->session_cache_tail = s;
+            s->next = (SSL_SESSION *)&(shard->session_cache_tail);
+            shard->session_cache_tail = s;
         } else {
             /*
              * we timeout somewhere in-between - if there is only
              * one session in the cache it will be caught above
              */
-            next = ctx->session_cache_head->next;
-            while (next != (SSL_SESSION*)&(ctx->session_cache_tail)) {
+            next = shard->session_cache_head->next;
+            while (next != (SSL_SESSION*)&(shard->session_cache_tail)) {
                 if (timeoutcmp(s, next) >= 0) {
                     s->next = next;
                     s->prev = next->prev;
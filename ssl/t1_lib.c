@@ -215,6 +215,7 @@ static const uint16_t supported_groups_default[] = {
     OSSL_TLS_GROUP_ID_ffdhe4096,     /* ffdhe4096 (0x102) */
     OSSL_TLS_GROUP_ID_ffdhe6144,     /* ffdhe6144 (0x103) */
     OSSL_TLS_GROUP_ID_ffdhe8192,     /* ffdhe8192 (0x104) */
+    OSSL_TLS_GROUP_ID_X25519MLKEM768, /* X25519MLKEM768 (0x11EC) */
 };
 
 static const uint16_t suiteb_curves[] = {
@@ -12,6 +12,7 @@
 #include <openssl/rand.h>
 #include "testutil.h"
 #include "internal/sockets.h"
+#include "internal/bio.h"
 
 #if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
 
@@ -451,6 +452,113 @@ static int test_bio_dgram(int idx)
                                bio_dgram_cases[idx].local);
 }
 
+/*
+ * Sends a single BIO_MSG split into several datagrams by segmentation offload
+ * and checks they are received correctly, either as individual datagrams or,
+ * if use_rx_seg is set, possibly coalesced again.
+ */
+static int test_bio_dgram_seg(int use_rx_seg)
+{
+    int testresult = 0;
+    int fd1 = -1, fd2 = -1;
+    BIO *b1 = NULL, *b2 = NULL;
+    BIO_ADDR *addr1 = NULL, *addr2 = NULL;
+    union BIO_sock_info_u info = {0};
+    struct in_addr ina;
+    unsigned char tx_buf[250], rx_buf[sizeof(tx_buf)];
+    BIO_MSG_SEG tx_msg = {0}, rx_msg = {0};
+    size_t i, num_processed = 0, total = 0, num_dgrams = 0;
+    uint32_t caps;
+    int enabled = 0;
+
+    ina.s_addr = htonl(0x7f000001UL);
+
+    for (i = 0; i < sizeof(tx_buf); ++i)
+        tx_buf[i] = (unsigned char)i;
+
+    if (!TEST_ptr(addr1 = BIO_ADDR_new())
+        || !TEST_ptr(addr2 = BIO_ADDR_new())
+        || !TEST_true(BIO_ADDR_rawmake(addr1, AF_INET, &ina, sizeof(ina), 0))
+        || !TEST_true(BIO_ADDR_rawmake(addr2, AF_INET, &ina, sizeof(ina), 0))
+        || !TEST_int_ge(fd1 = BIO_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, 0), 0)
+        || !TEST_int_ge(fd2 = BIO_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, 0), 0)
+        || !TEST_int_gt(BIO_bind(fd1, addr1, 0), 0)
+        || !TEST_int_gt(BIO_bind(fd2, addr2, 0), 0))
+        goto err;
+
+    info.addr = addr2;
+    if (!TEST_int_gt(BIO_sock_info(fd2, BIO_SOCK_INFO_ADDRESS, &info), 0)
+        || !TEST_ptr(b1 = BIO_new_dgram(fd1, 0))
+        || !TEST_ptr(b2 = BIO_new_dgram(fd2, 0)))
+        goto err;
+
+    caps = BIO_dgram_get_seg_cap(b1);
+    if ((caps & BIO_DGRAM_SEG_CAP_TX) == 0
+        || (use_rx_seg && (caps & BIO_DGRAM_SEG_CAP_RX) == 0)) {
+        testresult = TEST_skip("segmentation offload not supported");
+        goto err;
+    }
+
+    if (use_rx_seg) {
+        if (!TEST_true(BIO_dgram_set_rx_seg_enable(b2, 1))
+            || !TEST_true(BIO_dgram_get_rx_seg_enable(b2, &enabled))
+            || !TEST_int_eq(enabled, 1))
+            goto err;
+    }
+
+    tx_msg.msg.data     = tx_buf;
+    tx_msg.msg.data_len = sizeof(tx_buf);
+    tx_msg.msg.peer     = addr2;
+    tx_msg.seg_len      = 100;
+    if (!TEST_true(BIO_sendmmsg(b1, &tx_msg.msg, sizeof(BIO_MSG_SEG), 1,
+                                BIO_MMSG_FLAG_SEG, &num_processed))
+        || !TEST_size_t_eq(num_processed, 1))
+        goto err;
+
+    while (total < sizeof(rx_buf)) {
+        memset(&rx_msg, 0, sizeof(rx_msg));
+        rx_msg.msg.data     = rx_buf + total;
+        rx_msg.msg.data_len = sizeof(rx_buf) - total;
+        if (!TEST_true(BIO_recvmmsg(b2, &rx_msg.msg, sizeof(BIO_MSG_SEG), 1,
+                                    BIO_MMSG_FLAG_SEG, &num_processed))
+            || !TEST_size_t_eq(num_processed, 1))
+            goto err;
+
+        if (rx_msg.seg_len == 0) {
+            /* Must be a single datagram. */
+            if (!TEST_size_t_eq(rx_msg.msg.data_len,
+                                total < 200 ? (size_t)100 : (size_t)50))
+                goto err;
+
+            ++num_dgrams;
+        } else {
+            if (!TEST_true(use_rx_seg)
+                || !TEST_size_t_eq(rx_msg.seg_len, 100))
+                goto err;
+
+            num_dgrams += (rx_msg.msg.data_len + 99) / 100;
+        }
+
+        total += rx_msg.msg.data_len;
+    }
+
+    if (!TEST_size_t_eq(num_dgrams, 3)
+        || !TEST_mem_eq(rx_buf, sizeof(rx_buf), tx_buf, sizeof(tx_buf)))
+        goto err;
+
+    testresult = 1;
+err:
+    BIO_free(b1);
+    BIO_free(b2);
+    if (fd1 >= 0)
+        BIO_closesocket(fd1);
+    if (fd2 >= 0)
+        BIO_closesocket(fd2);
+    BIO_ADDR_free(addr1);
+    BIO_ADDR_free(addr2);
+    return testresult;
+}
+
 # if !defined(OPENSSL_NO_CHACHA)
 static int random_data(const uint32_t *key, uint8_t *data, size_t data_len, size_t offset)
 {
@@ -765,6 +873,7 @@ int setup_tests(void)
 
 #if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
     ADD_ALL_TESTS(test_bio_dgram, OSSL_NELEM(bio_dgram_cases));
+    ADD_ALL_TESTS(test_bio_dgram_seg, 2);
 # if !defined(OPENSSL_NO_CHACHA)
     ADD_ALL_TESTS(test_bio_dgram_pair, 2);
 # endif
@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -86,6 +86,68 @@ err:
     return ret;
 }
 
+/*
+ * ossl_bn_mod_exp_mont_consttime_many() with 1024-bit odd moduli matches
+ * BN_mod_exp(), for counts that fill the multi-lane kernel, leave a partial
+ * chunk or leave a pair or a single exponentiation to the other paths
+ */
+#define MOD_EXP_MANY_MAX 11
+
+static int test_mod_exp_many(int idx)
+{
+    BIGNUM *r[MOD_EXP_MANY_MAX], *a[MOD_EXP_MANY_MAX], *p[MOD_EXP_MANY_MAX];
+    BIGNUM *m[MOD_EXP_MANY_MAX];
+    BN_MONT_CTX *mont[MOD_EXP_MANY_MAX];
+    BIGNUM *expected = NULL;
+    size_t i, num = idx + 1;
+    int ret = 0;
+
+    memset(r, 0, sizeof(r));
+    memset(a, 0, sizeof(a));
+    memset(p, 0, sizeof(p));
+    memset(m, 0, sizeof(m));
+    memset(mont, 0, sizeof(mont));
+    if (!TEST_ptr(expected = BN_new()))
+        goto err;
+    for (i = 0; i < num; i++) {
+        if (!TEST_ptr(r[i] = BN_new())
+            || !TEST_ptr(a[i] = BN_new())
+            || !TEST_ptr(p[i] = BN_new())
+            || !TEST_ptr(m[i] = BN_new())
+            || !TEST_ptr(mont[i] = BN_MONT_CTX_new())
+            || !TEST_true(BN_rand(m[i], 1024, BN_RAND_TOP_ONE,
+                                  BN_RAND_BOTTOM_ODD))
+            || !TEST_true(BN_rand_range(a[i], m[i]))
+            || !TEST_true(BN_rand(p[i], 1024, BN_RAND_TOP_ANY,
+                                  BN_RAND_BOTTOM_ANY))
+            || !TEST_true(BN_MONT_CTX_set(mont[i], m[i], ctx)))
+            goto err;
+    }
+    if (!TEST_true(ossl_bn_mod_exp_mont_consttime_many(r,
+                                                       (const BIGNUM **)a,
+                                                       (const BIGNUM **)p,
+                                                       (const BIGNUM **)m,
+                                                       mont, num, ctx)))
+        goto err;
+    for (i = 0; i < num; i++)
+        if (!TEST_true(BN_mod_exp(expected, a[i], p[i], m[i], ctx))
+            || !TEST_BN_eq(r[i], expected)) {
+            TEST_info("exponentiation %zu of %zu", i, num);
+            goto err;
+        }
+    ret = 1;
+err:
+    for (i = 0; i < num; i++) {
+        BN_free(r[i]);
+        BN_free(a[i]);
+        BN_free(p[i]);
+        BN_free(m[i]);
+        BN_MONT_CTX_free(mont[i]);
+    }
+    BN_free(expected);
+    return ret;
+}
+
 int setup_tests(void)
 {
     if (!TEST_ptr(ctx = BN_CTX_new()))
@@ -94,6 +156,7 @@ int setup_tests(void)
     ADD_TEST(test_is_prime_enhanced);
     ADD_ALL_TESTS(test_is_composite_enhanced, (int)OSSL_NELEM(composites));
     ADD_TEST(test_bn_small_factors);
+    ADD_ALL_TESTS(test_mod_exp_many, MOD_EXP_MANY_MAX);
 
     return 1;
 }
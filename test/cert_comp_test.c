@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -243,6 +243,167 @@ static int test_ssl_cert_comp(int test)
 
     return testresult;
 }
+
+/*
+ * Two SSL objects each given their own copy of the same certificate, as from
+ * an SNI callback, share a single compression of it.
+ */
+static int test_ssl_cert_comp_cache(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL, *otherssl = NULL;
+    SSL_CONNECTION *sc, *othersc;
+    int testresult = 0;
+    int alg = TLSEXT_comp_cert_none;
+    int client_seen = 0;
+
+#ifndef OPENSSL_NO_ZSTD
+    alg = TLSEXT_comp_cert_zstd;
+#endif
+#ifndef OPENSSL_NO_ZLIB
+    alg = TLSEXT_comp_cert_zlib;
+#endif
+#ifndef OPENSSL_NO_BROTLI
+    alg = TLSEXT_comp_cert_brotli;
+#endif
+
+    if (!TEST_true(create_ssl_ctx_pair(NULL, TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_3_VERSION, 0,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    if (!TEST_ptr(otherssl = SSL_new(sctx))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_int_eq(SSL_use_certificate_file(otherssl, cert,
+                                                     SSL_FILETYPE_PEM), 1)
+            || !TEST_int_eq(SSL_use_certificate_file(serverssl, cert,
+                                                     SSL_FILETYPE_PEM), 1)
+            || !TEST_ptr(sc = SSL_CONNECTION_FROM_SSL(serverssl))
+            || !TEST_ptr(othersc = SSL_CONNECTION_FROM_SSL(otherssl))
+            || !TEST_ptr_ne(sc->cert->key->x509, othersc->cert->key->x509))
+        goto end;
+
+    if (!TEST_true(SSL_compress_certs(otherssl, alg))
+            || !TEST_true(SSL_compress_certs(serverssl, alg))
+            || !TEST_ptr(sc->cert->key->comp_cert[alg])
+            || !TEST_ptr_eq(sc->cert->key->comp_cert[alg],
+                            othersc->cert->key->comp_cert[alg]))
+        goto end;
+
+    /* The shared compression must be usable by both */
+    SSL_free(otherssl);
+    otherssl = NULL;
+
+    if (!TEST_true(SSL_set_app_data(clientssl, &client_seen)))
+        goto end;
+    SSL_set_info_callback(clientssl, cert_comp_info_cb);
+
+    if (!TEST_true(create_ssl_connection(serverssl, clientssl, SSL_ERROR_NONE))
+            || !TEST_int_gt(sc->cert->key->cert_comp_used, 0)
+            || !TEST_true(client_seen))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    SSL_free(otherssl);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+/*
+ * Compress |file| with |alg| on a new SSL object of |sctx|, which is returned
+ * in |*ssl|. Returns the compressed certificate, which |*ssl| keeps alive.
+ */
+static OSSL_COMP_CERT *comp_cert_with(SSL_CTX *sctx, const char *file,
+                                      int alg, SSL **ssl)
+{
+    SSL_CONNECTION *sc;
+
+    if (!TEST_ptr(*ssl = SSL_new(sctx))
+            || !TEST_int_eq(SSL_use_certificate_file(*ssl, file,
+                                                     SSL_FILETYPE_PEM), 1)
+            || !TEST_true(SSL_compress_certs(*ssl, alg))
+            || !TEST_ptr(sc = SSL_CONNECTION_FROM_SSL(*ssl)))
+        return NULL;
+    return sc->cert->key->comp_cert[alg];
+}
+
+/*
+ * A full cache evicts the least recently used compression only, and a cache
+ * size of 0 disables it.
+ */
+static int test_ssl_cert_comp_cache_evict(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *ssl[8] = { NULL };
+    OSSL_COMP_CERT *cc[8] = { NULL };
+    char *root = NULL, *ee = NULL;
+    int testresult = 0, i;
+    int alg = TLSEXT_comp_cert_none;
+
+#ifndef OPENSSL_NO_ZSTD
+    alg = TLSEXT_comp_cert_zstd;
+#endif
+#ifndef OPENSSL_NO_ZLIB
+    alg = TLSEXT_comp_cert_zlib;
+#endif
+#ifndef OPENSSL_NO_BROTLI
+    alg = TLSEXT_comp_cert_brotli;
+#endif
+
+    if (!TEST_ptr(root = test_mk_file_path(certsdir, "rootcert.pem"))
+            || !TEST_ptr(ee = test_mk_file_path(certsdir, "ee-cert.pem"))
+            || !TEST_true(create_ssl_ctx_pair(NULL, TLS_server_method(),
+                                              TLS_client_method(),
+                                              TLS1_3_VERSION, 0,
+                                              &sctx, &cctx, cert, privkey))
+            || !TEST_size_t_eq(SSL_CTX_get_cert_comp_cache_size(sctx), 64)
+            || !TEST_true(SSL_CTX_set_cert_comp_cache_size(sctx, 2))
+            || !TEST_size_t_eq(SSL_CTX_get_cert_comp_cache_size(sctx), 2))
+        goto end;
+
+    /* cert and root fill the cache, using cert again makes root the LRU */
+    if (!TEST_ptr(cc[0] = comp_cert_with(sctx, cert, alg, &ssl[0]))
+            || !TEST_ptr(cc[1] = comp_cert_with(sctx, root, alg, &ssl[1]))
+            || !TEST_ptr(cc[2] = comp_cert_with(sctx, cert, alg, &ssl[2]))
+            || !TEST_ptr_eq(cc[2], cc[0]))
+        goto end;
+
+    /* ee evicts root, but not cert */
+    if (!TEST_ptr(cc[3] = comp_cert_with(sctx, ee, alg, &ssl[3]))
+            || !TEST_ptr(cc[4] = comp_cert_with(sctx, cert, alg, &ssl[4]))
+            || !TEST_ptr_eq(cc[4], cc[0])
+            || !TEST_ptr(cc[5] = comp_cert_with(sctx, root, alg, &ssl[5]))
+            || !TEST_ptr_ne(cc[5], cc[1]))
+        goto end;
+
+    /* Without a cache each SSL object compresses the chain itself */
+    if (!TEST_true(SSL_CTX_set_cert_comp_cache_size(sctx, 0))
+            || !TEST_ptr(cc[6] = comp_cert_with(sctx, cert, alg, &ssl[6]))
+            || !TEST_ptr(cc[7] = comp_cert_with(sctx, cert, alg, &ssl[7]))
+            || !TEST_ptr_ne(cc[6], cc[0])
+            || !TEST_ptr_ne(cc[7], cc[6]))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    for (i = 0; i < (int)OSSL_NELEM(ssl); i++)
+        SSL_free(ssl[i]);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    OPENSSL_free(root);
+    OPENSSL_free(ee);
+
+    return testresult;
+}
 #endif
 
 OPT_TEST_DECLARE_USAGE("certdir\n")
@@ -267,6 +428,8 @@ int setup_tests(void)
         goto err;
 
     ADD_ALL_TESTS(test_ssl_cert_comp, 4);
+    ADD_TEST(test_ssl_cert_comp_cache);
+    ADD_TEST(test_ssl_cert_comp_cache_evict);
     return 1;
 
  err:
@@ -1,5 +1,5 @@
 /*
- * Copyright 2017-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2017-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -10,8 +10,10 @@
 #include <string.h>
 #include <openssl/e_os2.h>
 #include <openssl/evp.h>
+#include <openssl/bn.h>
 #include "crypto/ecx.h"
 #include "curve448_local.h"
+#include "field.h"
 #include "testutil.h"
 
 static unsigned int max = 1000;
@@ -687,6 +689,91 @@ static int test_x448(void)
     return 1;
 }
 
+static void random_field_element(gf x, unsigned int iter)
+{
+    unsigned int i;
+    uint64_t limb;
+
+    for (i = 0; i < NLIMBS; i++) {
+        limb = ((uint64_t)test_random() << 32) | test_random();
+        /* Start with the largest and the smallest limbs */
+        if (iter == 0)
+            limb = ~(uint64_t)0;
+        else if (iter == 1)
+            limb = 0;
+        x->limb[i] = (word_t)(limb & LIMB_MASK(i));
+    }
+}
+
+static int field_element_to_bn(BIGNUM *bn, const gf x)
+{
+    uint8_t ser[SER_BYTES];
+
+    gf_serialize(ser, x, 1);
+    return BN_lebin2bn(ser, sizeof(ser), bn) != NULL;
+}
+
+/*
+ * gf_mul and gf_sqr may be implemented in assembler, check them against
+ * BIGNUM arithmetic modulo p = 2^448 - 2^224 - 1.  The recipe also runs this
+ * with the assembler disabled, so both implementations get compared to the
+ * same reference.
+ */
+static int test_field_mul(void)
+{
+    BN_CTX *ctx = NULL;
+    BIGNUM *p, *a, *b, *r;
+    uint8_t got[SER_BYTES], expected[SER_BYTES];
+    gf x, y, z;
+    unsigned int i;
+    int ret = 0;
+
+    if (!TEST_ptr(ctx = BN_CTX_new()))
+        return 0;
+    BN_CTX_start(ctx);
+    p = BN_CTX_get(ctx);
+    a = BN_CTX_get(ctx);
+    b = BN_CTX_get(ctx);
+    r = BN_CTX_get(ctx);
+    if (!TEST_ptr(r)
+            || !TEST_true(BN_set_bit(p, 448))
+            || !TEST_true(BN_set_bit(r, 224))
+            || !TEST_true(BN_sub(p, p, r))
+            || !TEST_true(BN_sub_word(p, 1)))
+        goto err;
+
+    for (i = 0; i < max; i++) {
+        random_field_element(x, i);
+        random_field_element(y, i + 1);
+
+        gf_mul(z, x, y);
+        gf_serialize(got, z, 1);
+        if (!TEST_true(field_element_to_bn(a, x))
+                || !TEST_true(field_element_to_bn(b, y))
+                || !TEST_true(BN_mod_mul(r, a, b, p, ctx))
+                || !TEST_int_eq(BN_bn2lebinpad(r, expected, sizeof(expected)),
+                                (int)sizeof(expected))
+                || !TEST_mem_eq(got, sizeof(got), expected, sizeof(expected)))
+            goto err;
+
+        gf_sqr(z, x);
+        gf_serialize(got, z, 1);
+        if (!TEST_true(BN_mod_sqr(r, a, p, ctx))
+                || !TEST_int_eq(BN_bn2lebinpad(r, expected, sizeof(expected)),
+                                (int)sizeof(expected))
+                || !TEST_mem_eq(got, sizeof(got), expected, sizeof(expected))) {
+            TEST_info("Failed at iteration %u", i);
+            goto err;
+        }
+    }
+    ret = 1;
+
+ err:
+    BN_CTX_end(ctx);
+    BN_CTX_free(ctx);
+    return ret;
+}
+
 typedef enum OPTION_choice {
     OPT_ERR = -1,
     OPT_EOF = 0,
@@ -731,6 +818,7 @@ int setup_tests(void)
         }
     }
 
+    ADD_TEST(test_field_mul);
     ADD_TEST(test_x448);
     ADD_TEST(test_ed448);
     return 1;
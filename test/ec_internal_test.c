@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -257,6 +257,148 @@ static int underflow_test(void)
 
     return testresult;
 }
+
+/*
+ * Checks one point multiplication of the P-384 method against the generic wNAF
+ * implementation.  The latter runs on |ref|, a copy of the group without
+ * precomputation, as it would mistake the P-384 tables for its own.
+ */
+static int nistp384_check_mul(const EC_GROUP *grp, const EC_GROUP *ref,
+                              const BIGNUM *scalar,
+                              size_t num, const EC_POINT *points[],
+                              const BIGNUM *scalars[], BN_CTX *ctx)
+{
+    EC_POINT *R = NULL, *S = NULL;
+    int ret = 0;
+
+    if (TEST_ptr(R = EC_POINT_new(grp))
+            && TEST_ptr(S = EC_POINT_new(grp))
+            && TEST_true(grp->meth->mul(grp, R, scalar, num, points,
+                                        scalars, ctx))
+            && TEST_true(ossl_ec_wNAF_mul(ref, S, scalar, num, points,
+                                          scalars, ctx))
+            && TEST_int_eq(EC_POINT_cmp(grp, R, S, ctx), 0))
+        ret = 1;
+    EC_POINT_free(R);
+    EC_POINT_free(S);
+    return ret;
+}
+
+/*
+ * Compares the P-384 point multiplication with the generic implementation
+ * using the built-in generator table, a generator that needs its own
+ * precomputation, enough points for the affine tables to be used, and
+ * scalars that need reducing.
+ */
+static int nistp384_points_mul_test(void)
+{
+    BN_CTX *ctx = NULL;
+    EC_GROUP *grp = NULL, *ref = NULL;
+    EC_POINT *P[3] = { NULL, NULL, NULL };
+    const EC_POINT *points[4];
+    const BIGNUM *scalars[4];
+    BIGNUM *k[4] = { NULL, NULL, NULL, NULL };
+    BIGNUM *big = NULL;
+    const BIGNUM *order;
+    int i, round, testresult = 0;
+    size_t num;
+
+    if (!TEST_ptr(grp = EC_GROUP_new_by_curve_name(NID_secp384r1)))
+        return 0;
+    if (grp->meth != ossl_ec_GFp_nistp384_method()) {
+        EC_GROUP_free(grp);
+        return TEST_skip("P-384 does not use ecp_nistp384.c here");
+    }
+
+    if (!TEST_ptr(ctx = BN_CTX_new())
+            || !TEST_ptr(ref = EC_GROUP_new_by_curve_name(NID_secp384r1))
+            || !TEST_ptr(order = EC_GROUP_get0_order(grp))
+            || !TEST_ptr(big = BN_new())
+            /* 2^385 - 1 is larger than the order and needs reducing */
+            || !TEST_true(BN_set_bit(big, 385))
+            || !TEST_true(BN_sub_word(big, 1)))
+        goto err;
+    for (i = 0; i < 4; i++)
+        if (!TEST_ptr(k[i] = BN_new()))
+            goto err;
+    for (i = 0; i < 3; i++) {
+        if (!TEST_ptr(P[i] = EC_POINT_new(grp))
+                || !TEST_true(BN_rand_range(k[0], order))
+                || !TEST_true(EC_POINT_mul(grp, P[i], k[0], NULL, NULL, ctx)))
+            goto err;
+        points[i + 1] = P[i];
+        scalars[i + 1] = k[i + 1];
+    }
+    /*
+     * The generator with the generator's scalar as the first point makes the
+     * final addition of a single point multiplication a doubling
+     */
+    points[0] = EC_GROUP_get0_generator(grp);
+    scalars[0] = k[0];
+
+    for (round = 0; round < 2; round++) {
+        if (round == 1) {
+            /* Switch to a generator that is not covered by the table */
+            if (!TEST_true(EC_GROUP_set_generator(grp, P[0], order,
+                                                  BN_value_one()))
+                    || !TEST_true(EC_GROUP_set_generator(ref, P[0], order,
+                                                         BN_value_one()))
+                    || !TEST_false(EC_GROUP_have_precompute_mult(grp))
+                    || !nistp384_check_mul(grp, ref, k[0], 0, NULL, NULL, ctx)
+                    || !TEST_true(EC_GROUP_precompute_mult(grp, ctx))
+                    || !TEST_true(EC_GROUP_have_precompute_mult(grp)))
+                goto err;
+            points[0] = P[0];
+        }
+
+        for (i = 0; i < 8; i++) {
+            int j;
+
+            for (j = 0; j < 4; j++)
+                if (!TEST_true(BN_rand_range(k[j], order)))
+                    goto err;
+            if (!nistp384_check_mul(grp, ref, k[0], 0, NULL, NULL, ctx))
+                goto err;
+            for (num = 1; num <= 4; num++) {
+                if (!nistp384_check_mul(grp, ref, k[0], num, points,
+                                        scalars, ctx)
+                        || !nistp384_check_mul(grp, ref, NULL, num, points,
+                                               scalars, ctx))
+                    goto err;
+            }
+        }
+
+        /* Edge case scalars */
+        if (!nistp384_check_mul(grp, ref, big, 0, NULL, NULL, ctx)
+                || !TEST_true(BN_sub(k[0], order, BN_value_one()))
+                || !nistp384_check_mul(grp, ref, k[0], 0, NULL, NULL, ctx)
+                || !nistp384_check_mul(grp, ref, order, 0, NULL, NULL, ctx)
+                || !nistp384_check_mul(grp, ref, BN_value_one(), 0, NULL, NULL,
+                                       ctx))
+            goto err;
+        BN_zero(k[0]);
+        if (!nistp384_check_mul(grp, ref, k[0], 0, NULL, NULL, ctx))
+            goto err;
+        BN_set_negative(big, 1);
+        scalars[1] = big;
+        if (!nistp384_check_mul(grp, ref, NULL, 2, points, scalars, ctx))
+            goto err;
+        BN_set_negative(big, 0);
+        scalars[1] = k[1];
+    }
+
+    testresult = 1;
+ err:
+    for (i = 0; i < 3; i++)
+        EC_POINT_free(P[i]);
+    for (i = 0; i < 4; i++)
+        BN_free(k[i]);
+    BN_free(big);
+    EC_GROUP_free(grp);
+    EC_GROUP_free(ref);
+    BN_CTX_free(ctx);
+    return testresult;
+}
 #endif
 
 /*
@@ -448,6 +590,7 @@ int setup_tests(void)
     ADD_ALL_TESTS(field_tests_default, crv_len);
 #ifndef OPENSSL_NO_EC_NISTP_64_GCC_128
     ADD_TEST(underflow_test);
+    ADD_TEST(nistp384_points_mul_test);
 #endif
     ADD_TEST(set_private_key);
     ADD_TEST(decoded_flag_test);
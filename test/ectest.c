@@ -1,5 +1,5 @@
 /*
- * Copyright 2001-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2001-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2002, Oracle and/or its affiliates. All rights reserved
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -1266,6 +1266,38 @@ static const struct nistp_test_params nistp_tests_params[] = {
      /* d */
      "c477f9f65c22cce20657faa5b2d1d8122336f851a508a1ed04e479c34985bf96",
      },
+    {
+     /* P-384 */
+     NID_secp384r1,
+     384,
+     /* p */
+     "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+     "ffffffff0000000000000000ffffffff",
+     /* a */
+     "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+     "ffffffff0000000000000000fffffffc",
+     /* b */
+     "b3312fa7e23ee7e4988e056be3f82d19181d9c6efe8141120314088f5013875a"
+     "c656398d8a2ed19d2a85c8edd3ec2aef",
+     /* Qx */
+     "97d68e9bdfdf840f26a8f7884134f772655abd30087774836f37e6f0001c34d6"
+     "7a58a84aca23932ff3b109f1a76472b2",
+     /* Qy */
+     "e1d6cb83874156f06c555e194a841770eb3ee1fc639d18391c96c27237a0b105"
+     "f2fdf24663120e2207154327f1046204",
+     /* Gx */
+     "aa87ca22be8b05378eb1c71ef320ad746e1d3b628ba79b9859f741e082542a38"
+     "5502f25dbf55296c3a545e3872760ab7",
+     /* Gy */
+     "3617de4a96262c6f5d9e98bf9292dc29f8f41dbd289a147ce9da3113b5f0b8c0"
+     "0a60b1ce1d7e819d7a431d7c90ea0e5f",
+     /* order */
+     "ffffffffffffffffffffffffffffffffffffffffffffffffc7634d81f4372ddf"
+     "581a0db248b0a77aecec196accc52973",
+     /* d */
+     "a492ce8fa90084c227e1a32f7974d39e9ff67a7e8705ec3419b35fb607582beb"
+     "d461e0b1520ac76ec2dd4e9b63ebae70",
+     },
     {
      /* P-521 */
      NID_secp521r1,
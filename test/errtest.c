@@ -1,5 +1,5 @@
 /*
- * Copyright 2018-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2018-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -7,6 +7,7 @@
  * https://www.openssl.org/source/license.html
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <openssl/opensslconf.h>
 #include <openssl/err.h>
@@ -334,6 +335,84 @@ static int test_clear_error(void)
     return res;
 }
 
+/*
+ * File and function names are normally kept in the error state itself, but
+ * overlong ones have to be stored separately.  Check that both are reported
+ * correctly and survive the slot being reused.
+ */
+static int test_debug_strings(void)
+{
+    char file[300], func[200];
+    const char *f, *fn, *data;
+    int i, line, flags, res = 0;
+
+    memset(file, 'f', sizeof(file) - 1);
+    file[sizeof(file) - 1] = '\0';
+    memset(func, 'g', sizeof(func) - 1);
+    func[sizeof(func) - 1] = '\0';
+
+    for (i = 0; i < 20; i++) {
+        ERR_new();
+        if (i % 2 == 0)
+            ERR_set_debug(file, i, func);
+        else
+            ERR_set_debug("short.c", i, "short");
+        ERR_set_error(ERR_LIB_NONE, ERR_R_INTERNAL_ERROR, NULL);
+
+        if (!TEST_ulong_ne(ERR_get_error_all(&f, &line, &fn, &data, &flags),
+                           0)
+                || !TEST_int_eq(line, i)
+                || !TEST_str_eq(f, i % 2 == 0 ? file : "short.c")
+                || !TEST_str_eq(fn, i % 2 == 0 ? func : "short"))
+            goto err;
+    }
+
+    res = 1;
+ err:
+    ERR_clear_error();
+    return res;
+}
+
+/*
+ * Raise and pop errors with data of varying lengths, so that the buffers
+ * kept by the error slots are reused, grown and shrunk again.
+ */
+static int test_data_reuse(void)
+{
+    char big[1000];
+    const char *data = NULL;
+    int i, flags = 0, res = 0;
+
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+
+    ERR_raise(ERR_LIB_CRYPTO, ERR_R_MALLOC_FAILURE);
+    for (i = 0; i < 100; i++) {
+        int len = (i * 37) % (int)(sizeof(big) - 1);
+
+        if (!TEST_true(ERR_set_mark()))
+            goto err;
+        ERR_raise_data(ERR_LIB_CRYPTO, ERR_R_INTERNAL_ERROR, "%d:%.*s",
+                       i, len, big);
+        ERR_add_error_data(1, "+");
+        ERR_peek_last_error_data(&data, &flags);
+        if (!TEST_ptr(data)
+                || !TEST_int_eq(flags, ERR_TXT_STRING | ERR_TXT_MALLOCED)
+                || !TEST_int_eq(atoi(data), i)
+                || !TEST_size_t_eq(strlen(strchr(data, ':')), len + 2)
+                || !TEST_char_eq(data[strlen(data) - 1], '+')
+                || !TEST_true(ERR_pop_to_mark())
+                || !TEST_int_eq(ERR_GET_REASON(ERR_peek_last_error()),
+                                ERR_R_MALLOC_FAILURE))
+            goto err;
+    }
+
+    res = 1;
+ err:
+    ERR_clear_error();
+    return res;
+}
+
 int setup_tests(void)
 {
     ADD_TEST(preserves_system_error);
@@ -344,5 +423,7 @@ int setup_tests(void)
 #endif
     ADD_TEST(test_marks);
     ADD_TEST(test_clear_error);
+    ADD_TEST(test_debug_strings);
+    ADD_TEST(test_data_reuse);
     return 1;
 }
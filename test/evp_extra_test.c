@@ -1,5 +1,5 @@
 /*
- * Copyright 2015-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2015-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -1559,6 +1559,437 @@ static int test_EVP_DigestVerifyInit(void)
     return ret;
 }
 
+#define BATCH_NUM_SIGS    70
+#define BATCH_MSG_LEN     80
+
+static const struct {
+    const char *keytype;
+    const char *mdname;
+} batch_verify_tests[] = {
+#ifndef OPENSSL_NO_EC
+    { "ED25519", NULL },
+    { "ED448", NULL },
+    { "EC", "SHA256" },
+#endif
+    { "RSA", "SHA256" }
+};
+
+/*
+ * Sign a batch of messages and check that EVP_DigestVerifyBatch() accepts
+ * them all, rejects the batch once a single signature or message has been
+ * tampered with, and leaves the context usable for further batches.  The
+ * batch is larger than the chunk size used for Ed25519 batch verification.
+ */
+static int test_EVP_DigestVerifyBatch(int idx)
+{
+    int ret = 0;
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *sctx = NULL, *vctx = NULL;
+    unsigned char *sigbuf = NULL;
+    unsigned char msgbuf[BATCH_NUM_SIGS][BATCH_MSG_LEN];
+    const unsigned char *sigs[BATCH_NUM_SIGS], *tbs[BATCH_NUM_SIGS];
+    size_t siglens[BATCH_NUM_SIGS], tbslens[BATCH_NUM_SIGS];
+    const char *keytype = batch_verify_tests[idx].keytype;
+    const char *mdname = batch_verify_tests[idx].mdname;
+    size_t i, j, maxsig;
+    int sigsize;
+
+    if (strcmp(keytype, "RSA") == 0)
+        pkey = load_example_rsa_key();
+    else if (strcmp(keytype, "EC") == 0)
+        pkey = EVP_PKEY_Q_keygen(testctx, testpropq, "EC", "P-256");
+    else
+        pkey = EVP_PKEY_Q_keygen(testctx, testpropq, keytype);
+    if (!TEST_ptr(pkey)
+            || !TEST_int_gt(sigsize = EVP_PKEY_get_size(pkey), 0))
+        goto out;
+    maxsig = (size_t)sigsize;
+    if (!TEST_ptr(sigbuf = OPENSSL_malloc(maxsig * BATCH_NUM_SIGS))
+            || !TEST_ptr(sctx = EVP_MD_CTX_new())
+            || !TEST_ptr(vctx = EVP_MD_CTX_new()))
+        goto out;
+
+    for (i = 0; i < BATCH_NUM_SIGS; i++) {
+        for (j = 0; j < BATCH_MSG_LEN; j++)
+            msgbuf[i][j] = (unsigned char)(i * 7 + j);
+        tbs[i] = msgbuf[i];
+        tbslens[i] = i % BATCH_MSG_LEN;
+        sigs[i] = sigbuf + i * maxsig;
+        siglens[i] = maxsig;
+        if (!TEST_int_eq(EVP_DigestSignInit_ex(sctx, NULL, mdname, testctx,
+                                               testpropq, pkey, NULL), 1)
+                || !TEST_int_eq(EVP_DigestSign(sctx, sigbuf + i * maxsig,
+                                               &siglens[i], tbs[i],
+                                               tbslens[i]), 1))
+            goto out;
+    }
+
+    if (!TEST_int_eq(EVP_DigestVerifyInit_ex(vctx, NULL, mdname, testctx,
+                                             testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                                  tbslens, BATCH_NUM_SIGS), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                                  tbslens, 1), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                                  tbslens, 0), 1))
+        goto out;
+
+    /* A single bad signature fails the whole batch */
+    sigbuf[37 * maxsig + siglens[37] / 2] ^= 0x01;
+    if (!TEST_int_le(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                           tbslens, BATCH_NUM_SIGS), 0))
+        goto out;
+    sigbuf[37 * maxsig + siglens[37] / 2] ^= 0x01;
+
+    /* So does a single modified message */
+    msgbuf[65][3] ^= 0x80;
+    if (!TEST_int_le(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                           tbslens, BATCH_NUM_SIGS), 0))
+        goto out;
+    msgbuf[65][3] ^= 0x80;
+
+    /* The context is still usable after a failed batch */
+    if (!TEST_int_eq(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                           tbslens, BATCH_NUM_SIGS), 1))
+        goto out;
+
+    /* A batch is refused once data was passed with EVP_DigestVerifyUpdate() */
+    (void)EVP_DigestVerifyUpdate(vctx, msgbuf[0], BATCH_MSG_LEN);
+    if (!TEST_int_le(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                           tbslens, BATCH_NUM_SIGS), 0)
+            || !TEST_int_eq(EVP_DigestVerifyInit_ex(vctx, NULL, mdname, testctx,
+                                                    testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(vctx, sigs, siglens, tbs,
+                                                  tbslens, BATCH_NUM_SIGS), 1))
+        goto out;
+    ret = 1;
+
+ out:
+    ERR_clear_error();
+    EVP_MD_CTX_free(sctx);
+    EVP_MD_CTX_free(vctx);
+    OPENSSL_free(sigbuf);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+
+#ifndef OPENSSL_NO_EC
+/*
+ * Ed25519 signatures by the key of RFC 8032 test 1 over the message
+ * "small order R", with R the neutral element, a point of order 8 and a
+ * non-canonical encoding of the neutral element.  S = k * a, so that
+ * [S]B - [k]A is the neutral element, which is why each of them passed one of
+ * the cofactored or the cofactorless verification equations.
+ */
+static const unsigned char ed25519_small_order_priv[] = {
+    0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60, 0xba, 0x84, 0x4a, 0xf4,
+    0x92, 0xec, 0x2c, 0xc4, 0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32, 0x69, 0x19,
+    0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60
+};
+
+static const unsigned char ed25519_small_order_sigs[][64] = {
+    {
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xa6, 0x9d, 0xde,
+        0xbb, 0x80, 0x2c, 0x89, 0xe4, 0x05, 0x56, 0x1d, 0x33, 0x15, 0xc1, 0x91,
+        0xf2, 0xa6, 0xa9, 0x84, 0xf8, 0xb7, 0x99, 0x9f, 0x1f, 0x27, 0x1e, 0x28,
+        0xc0, 0xa9, 0x85, 0x0d
+    },
+    {
+        0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89,
+        0xf2, 0xef, 0x98, 0xf0, 0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39,
+        0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05, 0x98, 0x11, 0x93, 0x22,
+        0x33, 0xdb, 0x52, 0xf0, 0x21, 0xf8, 0x4f, 0xaf, 0xf2, 0x00, 0xec, 0x29,
+        0x10, 0xa0, 0xea, 0xf2, 0xbe, 0x47, 0xfc, 0xb8, 0x70, 0x8f, 0xcd, 0xc0,
+        0x42, 0x63, 0x35, 0x05
+    },
+    {
+        0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3a, 0x35, 0x19, 0xe8,
+        0x54, 0xfe, 0x89, 0xc4, 0xb2, 0x29, 0x07, 0x2f, 0x95, 0x93, 0xae, 0x2b,
+        0x40, 0xd6, 0x52, 0x90, 0xe6, 0x2d, 0xe6, 0xfd, 0x24, 0x3b, 0xa8, 0xa4,
+        0x51, 0x92, 0x49, 0x05
+    }
+};
+
+/*
+ * Each signature must be rejected by EVP_DigestVerify() and by
+ * EVP_DigestVerifyBatch(), both on its own and next to a valid signature.
+ */
+static int test_ed25519_small_order_R(int idx)
+{
+    static const unsigned char msg[] = "small order R";
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *ctx = NULL;
+    unsigned char goodsig[64];
+    const unsigned char *sigs[2], *tbs[2];
+    size_t siglens[2], tbslens[2];
+    size_t goodsiglen = sizeof(goodsig);
+    int ret = 0;
+
+    sigs[0] = goodsig;
+    sigs[1] = ed25519_small_order_sigs[idx];
+    siglens[0] = siglens[1] = 64;
+    tbs[0] = tbs[1] = msg;
+    tbslens[0] = tbslens[1] = sizeof(msg) - 1;
+
+    if (!TEST_ptr(pkey = EVP_PKEY_new_raw_private_key_ex(testctx, "ED25519",
+                                                         testpropq,
+                                                         ed25519_small_order_priv,
+                                                         sizeof(ed25519_small_order_priv)))
+            || !TEST_ptr(ctx = EVP_MD_CTX_new())
+            || !TEST_int_eq(EVP_DigestSignInit_ex(ctx, NULL, NULL, testctx,
+                                                  testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestSign(ctx, goodsig, &goodsiglen, msg,
+                                           sizeof(msg) - 1), 1)
+            || !TEST_int_eq(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                                    testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, 1), 1)
+            || !TEST_int_le(EVP_DigestVerifyBatch(ctx, sigs + 1, siglens + 1,
+                                                  tbs + 1, tbslens + 1, 1), 0)
+            || !TEST_int_le(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, 2), 0)
+            || !TEST_int_le(EVP_DigestVerify(ctx, sigs[1], siglens[1], tbs[1],
+                                             tbslens[1]), 0))
+        goto out;
+    ret = 1;
+
+ out:
+    ERR_clear_error();
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+
+/*
+ * A signature by the same key over the message "torsion R", whose R is
+ * [r]B plus a point of order 8, with S = r + k * a.  It passes the
+ * cofactored verification equation of EVP_DigestVerifyBatch() but not the
+ * cofactorless one of EVP_DigestVerify().
+ */
+static const unsigned char ed25519_torsion_sig[] = {
+    0xcb, 0x11, 0xc9, 0xb7, 0xaa, 0x99, 0xa4, 0x3d, 0xec, 0xff, 0x19, 0x85,
+    0xe4, 0x6b, 0x50, 0x1e, 0x9b, 0xbb, 0x41, 0xf4, 0xb0, 0x43, 0x78, 0x4a,
+    0xd4, 0x99, 0x7b, 0x18, 0x3c, 0x23, 0xf1, 0x7d, 0xdd, 0x34, 0x66, 0x9f,
+    0x9f, 0x5e, 0x87, 0xa6, 0xaa, 0x32, 0xdb, 0x69, 0xe3, 0x42, 0xa2, 0xeb,
+    0x46, 0xa1, 0x4c, 0x7d, 0x80, 0xfd, 0xa3, 0x78, 0x15, 0x3f, 0x4a, 0x45,
+    0x34, 0xf9, 0x06, 0x02
+};
+
+static int test_ed25519_torsion_R(void)
+{
+    static const unsigned char msg[] = "torsion R";
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *ctx = NULL;
+    unsigned char goodsig[64];
+    const unsigned char *sigs[2], *tbs[2];
+    size_t siglens[2], tbslens[2];
+    size_t goodsiglen = sizeof(goodsig);
+    int ret = 0;
+
+    sigs[0] = goodsig;
+    sigs[1] = ed25519_torsion_sig;
+    siglens[0] = siglens[1] = 64;
+    tbs[0] = tbs[1] = msg;
+    tbslens[0] = tbslens[1] = sizeof(msg) - 1;
+
+    if (!TEST_ptr(pkey = EVP_PKEY_new_raw_private_key_ex(testctx, "ED25519",
+                                                         testpropq,
+                                                         ed25519_small_order_priv,
+                                                         sizeof(ed25519_small_order_priv)))
+            || !TEST_ptr(ctx = EVP_MD_CTX_new())
+            || !TEST_int_eq(EVP_DigestSignInit_ex(ctx, NULL, NULL, testctx,
+                                                  testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestSign(ctx, goodsig, &goodsiglen, msg,
+                                           sizeof(msg) - 1), 1)
+            || !TEST_int_eq(EVP_DigestVerifyInit_ex(ctx, NULL, NULL, testctx,
+                                                    testpropq, pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs + 1, siglens + 1,
+                                                  tbs + 1, tbslens + 1, 1), 1)
+            || !TEST_int_eq(EVP_DigestVerifyBatch(ctx, sigs, siglens, tbs,
+                                                  tbslens, 2), 1)
+            || !TEST_int_le(EVP_DigestVerify(ctx, sigs[1], siglens[1], tbs[1],
+                                             tbslens[1]), 0))
+        goto out;
+    ret = 1;
+
+ out:
+    ERR_clear_error();
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+#endif
+
+#define MANY_NUM_MSGS     21
+#define MANY_MAX_LEN      300
+
+static const char *digest_many_tests[] = {
+    "SHA1", "SHA224", "SHA256", "SHA384", "SHA512", "SHA512-224",
+    "SHA512-256", "SHA3-224", "SHA3-256", "SHA3-512", "KECCAK-256",
+    "SHAKE128", "SHAKE256"
+};
+
+/*
+ * Check EVP_Digest_many() against EVP_Digest() for a batch of messages with
+ * lengths around the padding boundaries.  The batch is large enough that
+ * lanes of the multi-buffer kernels get refilled, and is also hashed in
+ * sizes for which the messages are hashed one at a time.
+ */
+static int test_EVP_Digest_many(int idx)
+{
+    int ret = 0;
+    EVP_MD *md = NULL;
+    unsigned char *msgbuf = NULL;
+    unsigned char out[MANY_NUM_MSGS][EVP_MAX_MD_SIZE];
+    unsigned char ref[EVP_MAX_MD_SIZE];
+    const void *data[MANY_NUM_MSGS];
+    size_t count[MANY_NUM_MSGS];
+    unsigned char *mds[MANY_NUM_MSGS];
+    size_t i, n;
+    int mdsize;
+
+    if (!TEST_ptr(md = EVP_MD_fetch(testctx, digest_many_tests[idx],
+                                    testpropq))
+            || !TEST_int_gt(mdsize = EVP_MD_get_size(md), 0)
+            || !TEST_ptr(msgbuf = OPENSSL_malloc(MANY_MAX_LEN)))
+        goto out;
+    for (i = 0; i < MANY_MAX_LEN; i++)
+        msgbuf[i] = (unsigned char)(i * 13 + 5);
+
+    for (i = 0; i < MANY_NUM_MSGS; i++) {
+        data[i] = msgbuf + i;
+        count[i] = (i * 71 + (i & 1) * 55) % (MANY_MAX_LEN - i);
+        mds[i] = out[i];
+    }
+    /* Messages that are empty or straddle the SHA-2 length field */
+    count[3] = 0;
+    count[5] = 55;
+    count[6] = 56;
+    count[9] = 111;
+    count[10] = 112;
+    count[12] = MANY_MAX_LEN - 12;
+
+    for (n = 0; n <= MANY_NUM_MSGS; n += (n < 9 ? 1 : 6)) {
+        memset(out, 0, sizeof(out));
+        if (!TEST_true(EVP_Digest_many(data, count, mds, n, md, NULL)))
+            goto out;
+        for (i = 0; i < n; i++) {
+            if (!TEST_true(EVP_Digest(data[i], count[i], ref, NULL, md, NULL))
+                    || !TEST_mem_eq(out[i], mdsize, ref, mdsize)) {
+                TEST_info("%s: message %zu of %zu, length %zu",
+                          digest_many_tests[idx], i, n, count[i]);
+                goto out;
+            }
+        }
+    }
+    ret = 1;
+
+ out:
+    EVP_MD_free(md);
+    OPENSSL_free(msgbuf);
+    return ret;
+}
+
+#ifndef OPENSSL_NO_EC
+#define PRECOMP_NUM_SIGS  20
+
+static const struct {
+    const char *keytype;
+    const char *curve;
+    const char *mdname;
+} precompute_verify_tests[] = {
+    { "ED25519", NULL, NULL },
+    { "EC", "secp256k1", "SHA256" },
+    { "EC", "P-256", "SHA256" },
+    { "EC", "P-384", "SHA384" }
+};
+
+/*
+ * Check that signatures verify the same way with and without the verification
+ * tables of OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY, including the first one which
+ * builds them.
+ */
+static int test_EVP_PKEY_precompute_verify(int idx)
+{
+    int ret = 0;
+    EVP_PKEY *pkey = NULL;
+    EVP_MD_CTX *mctx = NULL;
+    unsigned char msg[PRECOMP_NUM_SIGS][32];
+    unsigned char sig[PRECOMP_NUM_SIGS][256];
+    size_t siglen[PRECOMP_NUM_SIGS];
+    const char *mdname = precompute_verify_tests[idx].mdname;
+    int i, pass, precompute = -1;
+
+    if (precompute_verify_tests[idx].curve != NULL)
+        pkey = EVP_PKEY_Q_keygen(testctx, testpropq, "EC",
+                                 precompute_verify_tests[idx].curve);
+    else
+        pkey = EVP_PKEY_Q_keygen(testctx, testpropq,
+                                 precompute_verify_tests[idx].keytype);
+    if (!TEST_ptr(pkey)
+            || !TEST_int_le(EVP_PKEY_get_size(pkey), (int)sizeof(sig[0]))
+            || !TEST_ptr(mctx = EVP_MD_CTX_new()))
+        goto out;
+
+    for (i = 0; i < PRECOMP_NUM_SIGS; i++) {
+        memset(msg[i], i, sizeof(msg[i]));
+        siglen[i] = sizeof(sig[i]);
+        if (!TEST_int_eq(EVP_DigestSignInit_ex(mctx, NULL, mdname, testctx,
+                                               testpropq, pkey, NULL), 1)
+                || !TEST_int_eq(EVP_DigestSign(mctx, sig[i], &siglen[i],
+                                               msg[i], sizeof(msg[i])), 1))
+            goto out;
+    }
+
+    for (pass = 0; pass < 2; pass++) {
+        if (pass == 1
+                && (!TEST_true(EVP_PKEY_set_int_param(pkey,
+                                                      OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY,
+                                                      1))
+                    || !TEST_true(EVP_PKEY_get_int_param(pkey,
+                                                         OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY,
+                                                         &precompute))
+                    || !TEST_int_eq(precompute, 1)))
+            goto out;
+
+        for (i = 0; i < PRECOMP_NUM_SIGS; i++) {
+            if (!TEST_int_eq(EVP_DigestVerifyInit_ex(mctx, NULL, mdname,
+                                                     testctx, testpropq, pkey,
+                                                     NULL), 1)
+                    || !TEST_int_eq(EVP_DigestVerify(mctx, sig[i], siglen[i],
+                                                     msg[i], sizeof(msg[i])),
+                                    1))
+                goto out;
+        }
+
+        /* A signature for another message or a modified one must fail */
+        if (!TEST_int_eq(EVP_DigestVerifyInit_ex(mctx, NULL, mdname, testctx,
+                                                 testpropq, pkey, NULL), 1)
+                || !TEST_int_le(EVP_DigestVerify(mctx, sig[1], siglen[1],
+                                                 msg[2], sizeof(msg[2])), 0))
+            goto out;
+        sig[3][siglen[3] / 2] ^= 0x04;
+        if (!TEST_int_eq(EVP_DigestVerifyInit_ex(mctx, NULL, mdname, testctx,
+                                                 testpropq, pkey, NULL), 1)
+                || !TEST_int_le(EVP_DigestVerify(mctx, sig[3], siglen[3],
+                                                 msg[3], sizeof(msg[3])), 0))
+            goto out;
+        sig[3][siglen[3] / 2] ^= 0x04;
+    }
+    ret = 1;
+
+ out:
+    ERR_clear_error();
+    EVP_MD_CTX_free(mctx);
+    EVP_PKEY_free(pkey);
+    return ret;
+}
+#endif
+
 #ifndef OPENSSL_NO_SIPHASH
 /* test SIPHASH MAC via EVP_PKEY with non-default parameters and reinit */
 static int test_siphash_digestsign(void)
@@ -1715,6 +2146,93 @@ static int test_d2i_AutoPrivateKey(int i)
     return ret;
 }
 
+static int decode_rsa_key(OSSL_LIB_CTX *libctx, int *num_decoders)
+{
+    const unsigned char *data = kExampleRSAKeyDER;
+    size_t data_len = sizeof(kExampleRSAKeyDER);
+    EVP_PKEY *pkey = NULL;
+    OSSL_DECODER_CTX *dctx = NULL;
+    int ret = 0;
+
+    dctx = OSSL_DECODER_CTX_new_for_pkey(&pkey, "DER", NULL, "RSA", 0,
+                                         libctx, NULL);
+    if (!TEST_ptr(dctx))
+        goto err;
+    *num_decoders = OSSL_DECODER_CTX_get_num_decoders(dctx);
+    if (*num_decoders > 0
+            && (!TEST_true(OSSL_DECODER_from_data(dctx, &data, &data_len))
+                || !TEST_ptr(pkey)
+                || !TEST_true(EVP_PKEY_is_a(pkey, "RSA"))))
+        goto err;
+
+    ret = 1;
+ err:
+    EVP_PKEY_free(pkey);
+    OSSL_DECODER_CTX_free(dctx);
+    return ret;
+}
+
+/*
+ * Decoder chains built by OSSL_DECODER_CTX_new_for_pkey() are cached. Check
+ * that a cached chain decodes just like a fresh one, and that the cache is
+ * invalidated when providers are loaded or unloaded and when the default
+ * properties change.
+ */
+static int test_decoder_ctx_cache(void)
+{
+    OSSL_LIB_CTX *tmpctx = OSSL_LIB_CTX_new(), *freshctx = NULL;
+    OSSL_PROVIDER *tmpnullprov = NULL, *tmpdefprov = NULL;
+    OSSL_PROVIDER *freshdefprov = NULL;
+    int num_first, num_second, num, ret = 0;
+
+    if (!TEST_ptr(tmpctx)
+            || !TEST_ptr(tmpnullprov = OSSL_PROVIDER_load(tmpctx, "null"))
+            || !TEST_true(decode_rsa_key(tmpctx, &num))
+            || !TEST_int_eq(num, 0))
+        goto err;
+
+    if (!TEST_ptr(tmpdefprov = OSSL_PROVIDER_load(tmpctx, "default"))
+            || !TEST_true(decode_rsa_key(tmpctx, &num_first))
+            || !TEST_int_gt(num_first, 0)
+            || !TEST_true(decode_rsa_key(tmpctx, &num_second))
+            || !TEST_int_eq(num_first, num_second))
+        goto err;
+
+    /*
+     * After the default properties change the chain must be the one a fresh
+     * library context with the same default properties would build.
+     */
+    if (!TEST_ptr(freshctx = OSSL_LIB_CTX_new())
+            || !TEST_ptr(freshdefprov = OSSL_PROVIDER_load(freshctx, "default"))
+            || !TEST_true(EVP_set_default_properties(freshctx,
+                                                     "provider=fizzbang"))
+            || !TEST_true(decode_rsa_key(freshctx, &num_second))
+            || !TEST_true(EVP_set_default_properties(tmpctx,
+                                                     "provider=fizzbang"))
+            || !TEST_true(decode_rsa_key(tmpctx, &num))
+            || !TEST_int_eq(num, num_second)
+            || !TEST_true(EVP_set_default_properties(tmpctx, NULL))
+            || !TEST_true(decode_rsa_key(tmpctx, &num))
+            || !TEST_int_eq(num, num_first))
+        goto err;
+
+    if (!TEST_true(OSSL_PROVIDER_unload(tmpdefprov)))
+        goto err;
+    tmpdefprov = NULL;
+    if (!TEST_true(decode_rsa_key(tmpctx, &num))
+            || !TEST_int_eq(num, 0))
+        goto err;
+
+    ret = 1;
+ err:
+    OSSL_PROVIDER_unload(freshdefprov);
+    OSSL_LIB_CTX_free(freshctx);
+    OSSL_PROVIDER_unload(tmpdefprov);
+    OSSL_PROVIDER_unload(tmpnullprov);
+    OSSL_LIB_CTX_free(tmpctx);
+    return ret;
+}
+
 #ifndef OPENSSL_NO_EC
 
 static const unsigned char ec_public_sect163k1_validxy[] = {
@@ -4934,6 +5452,17 @@ int setup_tests(void)
     ADD_TEST(test_EVP_set_default_properties);
     ADD_ALL_TESTS(test_EVP_DigestSignInit, 30);
     ADD_TEST(test_EVP_DigestVerifyInit);
+    ADD_ALL_TESTS(test_EVP_DigestVerifyBatch, OSSL_NELEM(batch_verify_tests));
+#ifndef OPENSSL_NO_EC
+    ADD_ALL_TESTS(test_ed25519_small_order_R,
+                  OSSL_NELEM(ed25519_small_order_sigs));
+    ADD_TEST(test_ed25519_torsion_R);
+#endif
+    ADD_ALL_TESTS(test_EVP_Digest_many, OSSL_NELEM(digest_many_tests));
+#ifndef OPENSSL_NO_EC
+    ADD_ALL_TESTS(test_EVP_PKEY_precompute_verify,
+                  OSSL_NELEM(precompute_verify_tests));
+#endif
 #ifndef OPENSSL_NO_SIPHASH
     ADD_TEST(test_siphash_digestsign);
 #endif
@@ -4942,6 +5471,7 @@ int setup_tests(void)
     ADD_ALL_TESTS(test_EVP_PKEY_sign, 3);
     ADD_ALL_TESTS(test_EVP_Enveloped, 2);
     ADD_ALL_TESTS(test_d2i_AutoPrivateKey, OSSL_NELEM(keydata));
+    ADD_TEST(test_decoder_ctx_cache);
     ADD_TEST(test_privatekey_to_pkcs8);
     ADD_TEST(test_EVP_PKCS82PKEY_wrong_tag);
 #ifndef OPENSSL_NO_EC
@@ -325,6 +325,12 @@ static int parse_bin(const char *value, unsigned char **buf, size_t *buflen)
  **  MESSAGE DIGEST TESTS
  **/
 
+/* Because OPENSSL_free is a macro, it can't be passed as a function pointer */
+static void openssl_free(char *m)
+{
+    OPENSSL_free(m);
+}
+
 typedef struct digest_data_st {
     /* Digest this test is for */
     const EVP_MD *digest;
@@ -338,6 +344,8 @@ typedef struct digest_data_st {
     int pad_type;
     /* XOF mode? */
     int xof;
+    /* Collection of controls */
+    STACK_OF(OPENSSL_STRING) *controls;
 } DIGEST_DATA;
 
 static int digest_test_init(EVP_TEST *t, const char *alg)
@@ -357,6 +365,11 @@ static int digest_test_init(EVP_TEST *t, const char *alg)
         return 0;
     if (!TEST_ptr(mdat = OPENSSL_zalloc(sizeof(*mdat))))
         return 0;
+    if (!TEST_ptr(mdat->controls = sk_OPENSSL_STRING_new_null())) {
+        OPENSSL_free(mdat);
+        EVP_MD_free(fetched_digest);
+        return 0;
+    }
     t->data = mdat;
     mdat->digest = digest;
     mdat->fetched_digest = fetched_digest;
@@ -372,6 +385,7 @@ static void digest_test_cleanup(EVP_TEST *t)
     DIGEST_DATA *mdat = t->data;
 
     sk_EVP_TEST_BUFFER_pop_free(mdat->input, evp_test_buffer_free);
+    sk_OPENSSL_STRING_pop_free(mdat->controls, openssl_free);
     OPENSSL_free(mdat->output);
     EVP_MD_free(mdat->fetched_digest);
 }
@@ -393,6 +407,13 @@ static int digest_test_parse(EVP_TEST *t,
         return (mdata->pad_type = atoi(value)) > 0;
     if (strcmp(keyword, "XOF") == 0)
         return (mdata->xof = atoi(value)) > 0;
+    if (strcmp(keyword, "Ctrl") == 0) {
+        char *data = OPENSSL_strdup(value);
+
+        if (data == NULL)
+            return -1;
+        return sk_OPENSSL_STRING_push(mdata->controls, data) != 0;
+    }
     return 0;
 }
 
@@ -429,8 +450,8 @@ static int digest_test_run(EVP_TEST *t)
     unsigned char *got = NULL;
     unsigned int got_len;
     size_t size = 0;
-    int xof = 0;
-    OSSL_PARAM params[3], *p = &params[0];
+    int xof = 0, i;
+    OSSL_PARAM params[8], *p = &params[0], *allocstart = &params[0];
 
     t->err = "TEST_FAILURE";
     if (!TEST_ptr(mctx = EVP_MD_CTX_new()))
@@ -449,7 +470,38 @@ static int digest_test_run(EVP_TEST *t)
     if (expected->pad_type > 0)
         *p++ = OSSL_PARAM_construct_int(OSSL_DIGEST_PARAM_PAD_TYPE,
                                         &expected->pad_type);
-    *p++ = OSSL_PARAM_construct_end();
+
+    /* Unknown controls.  They must match parameters the digest recognizes */
+    allocstart = p;
+    if (p - params + sk_OPENSSL_STRING_num(expected->controls)
+        >= (int)OSSL_NELEM(params)) {
+        t->err = "DIGEST_TOO_MANY_PARAMETERS";
+        goto err;
+    }
+    for (i = 0; i < sk_OPENSSL_STRING_num(expected->controls); i++) {
+        char *tmpkey, *tmpval;
+        char *value = sk_OPENSSL_STRING_value(expected->controls, i);
+
+        if (!TEST_ptr(tmpkey = OPENSSL_strdup(value))) {
+            t->err = "DIGEST_PARAM_ERROR";
+            goto err;
+        }
+        tmpval = strchr(tmpkey, ':');
+        if (tmpval != NULL)
+            *tmpval++ = '\0';
+
+        if (tmpval == NULL
+            || !OSSL_PARAM_allocate_from_text(p,
+                    EVP_MD_settable_ctx_params(expected->digest),
+                    tmpkey, tmpval, strlen(tmpval), NULL)) {
+            OPENSSL_free(tmpkey);
+            t->err = "DIGEST_PARAM_ERROR";
+            goto err;
+        }
+        p++;
+        OPENSSL_free(tmpkey);
+    }
+    *p = OSSL_PARAM_construct_end();
 
     if (!EVP_DigestInit_ex2(mctx, expected->digest, params)) {
         t->err = "DIGESTINIT_ERROR";
@@ -519,6 +571,8 @@ static int digest_test_run(EVP_TEST *t)
     }
 
  err:
+    while (p > allocstart)
+        OPENSSL_free((--p)->data);
     OPENSSL_free(got);
     EVP_MD_CTX_free(mctx);
     return 1;
@@ -1243,12 +1297,6 @@ static int mac_test_init(EVP_TEST *t, const char *alg)
     return 1;
 }
 
-/* Because OPENSSL_free is a macro, it can't be passed as a function pointer */
-static void openssl_free(char *m)
-{
-    OPENSSL_free(m);
-}
-
 static void mac_test_cleanup(EVP_TEST *t)
 {
     MAC_DATA *mdat = t->data;
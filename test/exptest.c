@@ -1,5 +1,5 @@
 /*
- * Copyright 1995-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1995-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -329,10 +329,79 @@ static int test_mod_exp_x2(int idx)
     return ret;
 }
 
+static size_t mod_exp_path_total(void)
+{
+    size_t total = 0;
+    int i;
+
+    for (i = 0; i < BN_MOD_EXP_PATH_NUM; i++)
+        total += BN_mod_exp_path_count(i);
+    return total;
+}
+
+/*
+ * Whatever code path serves them, the counters grow by one per single and
+ * by two per dual exponentiation.
+ */
+static int test_mod_exp_path_count(void)
+{
+    BN_CTX *ctx = NULL;
+    BIGNUM *r1 = NULL, *r2 = NULL, *a = NULL, *p = NULL, *m = NULL;
+    size_t before;
+    int i, ret = 0;
+
+    for (i = 0; i < BN_MOD_EXP_PATH_NUM; i++)
+        if (!TEST_ptr(BN_mod_exp_path_name(i)))
+            return 0;
+    if (!TEST_ptr_null(BN_mod_exp_path_name(BN_MOD_EXP_PATH_NUM))
+        || !TEST_ptr_null(BN_mod_exp_path_name(-1))
+        || !TEST_size_t_eq(BN_mod_exp_path_count(BN_MOD_EXP_PATH_NUM), 0))
+        return 0;
+
+    if (!TEST_ptr(ctx = BN_CTX_new())
+        || !TEST_ptr(r1 = BN_new())
+        || !TEST_ptr(r2 = BN_new())
+        || !TEST_ptr(a = BN_new())
+        || !TEST_ptr(p = BN_new())
+        || !TEST_ptr(m = BN_new())
+        || !TEST_true(BN_rand(m, 2048, BN_RAND_TOP_ONE, BN_RAND_BOTTOM_ODD))
+        || !TEST_true(BN_rand_range(a, m))
+        || !TEST_true(BN_rand_range(p, m)))
+        goto err;
+
+    /* The earlier tests have already been counted, unless unsupported */
+    if ((before = mod_exp_path_total()) == 0) {
+        ret = TEST_skip("modular exponentiation counters are not available");
+        goto err;
+    }
+    if (!TEST_true(BN_mod_exp_mont_consttime(r1, a, p, m, ctx, NULL))
+        || !TEST_size_t_eq(mod_exp_path_total(), before + 1))
+        goto err;
+    before = mod_exp_path_total();
+    if (!TEST_true(BN_mod_exp_mont_consttime_x2(r1, a, p, m, NULL,
+                                                r2, a, p, m, NULL, ctx))
+        || !TEST_size_t_eq(mod_exp_path_total(), before + 2))
+        goto err;
+
+    for (i = 0; i < BN_MOD_EXP_PATH_NUM; i++)
+        TEST_note("%s: %zu", BN_mod_exp_path_name(i),
+                  BN_mod_exp_path_count(i));
+    ret = 1;
+ err:
+    BN_free(r1);
+    BN_free(r2);
+    BN_free(a);
+    BN_free(p);
+    BN_free(m);
+    BN_CTX_free(ctx);
+    return ret;
+}
+
 int setup_tests(void)
 {
     ADD_TEST(test_mod_exp_zero);
     ADD_ALL_TESTS(test_mod_exp, 200);
     ADD_ALL_TESTS(test_mod_exp_x2, 300);
+    ADD_TEST(test_mod_exp_path_count);
     return 1;
 }
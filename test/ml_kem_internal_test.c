@@ -0,0 +1,252 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <string.h>
+#include <openssl/core_dispatch.h>
+#include <openssl/evp.h>
+#include "crypto/ml_kem.h"
+#include "testutil.h"
+
+/*
+ * Known answers for ML-KEM-512, 768 and 1024 computed with an independent
+ * FIPS 203 implementation.  The inputs are
+ *
+ *      seed[i] = i * 13 + n * 7 + 1, i = 0..63
+ *      m[i]    = i * 29 + n * 3 + 5, i = 0..31
+ *
+ * with n = 1, 2, 3 for the three variants.  The long outputs are checked
+ * through their SHA3-256 digests.  The rejected ciphertext has bit 0 of its
+ * byte n flipped.
+ */
+static const struct {
+    int variant;
+    const char *ek_hash;
+    const char *dk_hash;
+    const char *ct_hash;
+    const char *ss;
+    const char *rejss;
+} kats[] = {
+    {
+        ML_KEM_512,
+        "ff16ab704a060a36f2724f5d8da699d96a578ab7573712dc726c42a8c404ec05",
+        "642825a2a70241c322f98c5c0659d4c4cb1889c17f10088d98346067f3d03593",
+        "9bc816bd734530a242dc414a99ab1d187e230df98aaacd2098bdeb49ff3dd8d9",
+        "4fda88922a2dd8e7589d0ebc1b090355e1d7f5eaeb02e282d8c1bc46c4c2b014",
+        "56a233bfbd71625f255090b4d50066b631575bcabc6896529fcfdf62feebce93"
+    },
+    {
+        ML_KEM_768,
+        "00b5ba2dd7f3a573a82cdf87998beabe65c8bfea3eefaf111c364af30d54c1b8",
+        "4793b6ee1e79acfbdf1c9e1714332c79101127e724a96de21b8caa3862276995",
+        "3fc7526d830b2b69e2dc7a57ce12f0a39806c3dbf078c7622f315dd9c69a6b11",
+        "ec8b4e23ff7ddef5816d5b2eddc3334d4e8a954980757e592656bfdd24806216",
+        "de776a36c3c7106363b8755e1e8175c8873d6f0de9c85d399cf0d44d1fed1c05"
+    },
+    {
+        ML_KEM_1024,
+        "e4dc42c33e5505763c218db3e7e161d228f53677ec12b54b616dd636f1a21861",
+        "81aefa9aadfa754b246b080a0108a0b70bd7aa201d73d6a5eb608638fa909dd7",
+        "27fc795bee77355b070042afc09af6c603e02c72c8d2639350505e1b794de78f",
+        "aa78ff2167653d8e7666bb27369ea71dd5318582607e0333059cc9e49e246502",
+        "7ff371a4e1d11429f16b5cd4f400a7e5dd384e2b79c27018cd8bb420c2a4be8a"
+    }
+};
+
+static int check_hash(const char *what, const uint8_t *buf, size_t len,
+                      const char *expected)
+{
+    unsigned char md[32], *exp = NULL;
+    long explen;
+    int ret;
+
+    ret = TEST_true(EVP_Q_digest(NULL, "SHA3-256", NULL, buf, len, md, NULL))
+          && TEST_ptr(exp = OPENSSL_hexstr2buf(expected, &explen))
+          && TEST_mem_eq(md, sizeof(md), exp, explen);
+    if (!ret)
+        TEST_info("%s", what);
+    OPENSSL_free(exp);
+    return ret;
+}
+
+static int check_bytes(const uint8_t *buf, size_t len, const char *expected)
+{
+    unsigned char *exp = NULL;
+    long explen;
+    int ret;
+
+    ret = TEST_ptr(exp = OPENSSL_hexstr2buf(expected, &explen))
+          && TEST_mem_eq(buf, len, exp, explen);
+    OPENSSL_free(exp);
+    return ret;
+}
+
+static int test_ml_kem_kat(int idx)
+{
+    const ML_KEM_VINFO *v = ossl_ml_kem_get_vinfo(kats[idx].variant);
+    ML_KEM_KEY *key = NULL, *pub = NULL, *prv = NULL;
+    uint8_t seed[ML_KEM_SEED_BYTES], m[ML_KEM_RANDOM_BYTES];
+    uint8_t ss[ML_KEM_SHARED_SECRET_BYTES], ss2[ML_KEM_SHARED_SECRET_BYTES];
+    uint8_t *ek = NULL, *dk = NULL, *ct = NULL, *ct2 = NULL;
+    int n = idx + 1, i, ret = 0;
+
+    for (i = 0; i < (int)sizeof(seed); i++)
+        seed[i] = (uint8_t)(i * 13 + n * 7 + 1);
+    for (i = 0; i < (int)sizeof(m); i++)
+        m[i] = (uint8_t)(i * 29 + n * 3 + 5);
+
+    if (!TEST_ptr(v)
+            || !TEST_ptr(ek = OPENSSL_malloc(v->pubkey_bytes))
+            || !TEST_ptr(dk = OPENSSL_malloc(v->prvkey_bytes))
+            || !TEST_ptr(ct = OPENSSL_malloc(v->ctext_bytes))
+            || !TEST_ptr(ct2 = OPENSSL_malloc(v->ctext_bytes))
+            || !TEST_ptr(key = ossl_ml_kem_key_new(NULL, v->variant))
+            || !TEST_true(ossl_ml_kem_set_seed(seed, sizeof(seed), key))
+            || !TEST_true(ossl_ml_kem_genkey(key))
+            || !TEST_true(ossl_ml_kem_encode_public_key(ek, v->pubkey_bytes,
+                                                        key))
+            || !TEST_true(ossl_ml_kem_encode_private_key(dk, v->prvkey_bytes,
+                                                         key))
+            || !check_hash("ek", ek, v->pubkey_bytes, kats[idx].ek_hash)
+            || !check_hash("dk", dk, v->prvkey_bytes, kats[idx].dk_hash))
+        goto err;
+
+    /* Encapsulation to the public key alone */
+    if (!TEST_ptr(pub = ossl_ml_kem_key_new(NULL, v->variant))
+            || !TEST_true(ossl_ml_kem_parse_public_key(ek, v->pubkey_bytes,
+                                                       pub))
+            || !TEST_true(ossl_ml_kem_pubkey_cmp(key, pub))
+            || !TEST_true(ossl_ml_kem_encap_seed(ct, v->ctext_bytes,
+                                                 ss, sizeof(ss),
+                                                 m, sizeof(m), pub))
+            || !check_hash("ct", ct, v->ctext_bytes, kats[idx].ct_hash)
+            || !check_bytes(ss, sizeof(ss), kats[idx].ss)
+            || !TEST_true(ossl_ml_kem_encap_seed(ct2, v->ctext_bytes,
+                                                 ss2, sizeof(ss2),
+                                                 m, sizeof(m), key))
+            || !TEST_mem_eq(ct, v->ctext_bytes, ct2, v->ctext_bytes))
+        goto err;
+
+    /* Decapsulation with the generated and with the parsed private key */
+    memset(ss, 0, sizeof(ss));
+    if (!TEST_ptr(prv = ossl_ml_kem_key_new(NULL, v->variant))
+            || !TEST_true(ossl_ml_kem_parse_private_key(dk, v->prvkey_bytes,
+                                                        prv))
+            || !TEST_false(ossl_ml_kem_have_seed(prv))
+            || !TEST_true(ossl_ml_kem_decap(ss, sizeof(ss), ct,
+                                            v->ctext_bytes, key))
+            || !check_bytes(ss, sizeof(ss), kats[idx].ss)
+            || !TEST_true(ossl_ml_kem_decap(ss, sizeof(ss), ct,
+                                            v->ctext_bytes, prv))
+            || !check_bytes(ss, sizeof(ss), kats[idx].ss))
+        goto err;
+
+    /* Implicit rejection */
+    ct[n] ^= 1;
+    if (!TEST_true(ossl_ml_kem_decap(ss, sizeof(ss), ct, v->ctext_bytes,
+                                     prv))
+            || !check_bytes(ss, sizeof(ss), kats[idx].rejss))
+        goto err;
+
+    /* Public keys cannot decapsulate */
+    if (!TEST_false(ossl_ml_kem_decap(ss, sizeof(ss), ct, v->ctext_bytes,
+                                      pub)))
+        goto err;
+    ret = 1;
+ err:
+    ossl_ml_kem_key_free(key);
+    ossl_ml_kem_key_free(pub);
+    ossl_ml_kem_key_free(prv);
+    OPENSSL_free(ek);
+    OPENSSL_free(dk);
+    OPENSSL_free(ct);
+    OPENSSL_free(ct2);
+    return ret;
+}
+
+static int test_ml_kem_roundtrip(int idx)
+{
+    const ML_KEM_VINFO *v = ossl_ml_kem_get_vinfo(idx);
+    ML_KEM_KEY *key = NULL, *dup = NULL;
+    uint8_t ss[ML_KEM_SHARED_SECRET_BYTES], ss2[ML_KEM_SHARED_SECRET_BYTES];
+    uint8_t *ct = NULL;
+    int i, ret = 0;
+
+    if (!TEST_ptr(v)
+            || !TEST_ptr(ct = OPENSSL_malloc(v->ctext_bytes))
+            || !TEST_ptr(key = ossl_ml_kem_key_new(NULL, idx))
+            || !TEST_true(ossl_ml_kem_genkey(key))
+            || !TEST_true(ossl_ml_kem_have_seed(key))
+            || !TEST_ptr(dup = ossl_ml_kem_key_dup(key,
+                                                   OSSL_KEYMGMT_SELECT_KEYPAIR)))
+        goto err;
+
+    for (i = 0; i < 16; i++) {
+        if (!TEST_true(ossl_ml_kem_encap_rand(ct, v->ctext_bytes,
+                                              ss, sizeof(ss), key))
+                || !TEST_true(ossl_ml_kem_decap(ss2, sizeof(ss2), ct,
+                                                v->ctext_bytes, dup))
+                || !TEST_mem_eq(ss, sizeof(ss), ss2, sizeof(ss2)))
+            goto err;
+    }
+    ret = 1;
+ err:
+    ossl_ml_kem_key_free(key);
+    ossl_ml_kem_key_free(dup);
+    OPENSSL_free(ct);
+    return ret;
+}
+
+/* FIPS 203, section 7.2 and 7.3 input checks */
+static int test_ml_kem_bad_keys(void)
+{
+    const ML_KEM_VINFO *v = ossl_ml_kem_get_vinfo(ML_KEM_768);
+    ML_KEM_KEY *key = NULL, *bad = NULL;
+    uint8_t ek[ML_KEM_768_PUBLIC_KEY_BYTES], *dk = NULL;
+    int ret = 0;
+
+    if (!TEST_ptr(dk = OPENSSL_malloc(v->prvkey_bytes))
+            || !TEST_ptr(key = ossl_ml_kem_key_new(NULL, ML_KEM_768))
+            || !TEST_true(ossl_ml_kem_genkey(key))
+            || !TEST_true(ossl_ml_kem_encode_public_key(ek, sizeof(ek), key))
+            || !TEST_true(ossl_ml_kem_encode_private_key(dk, v->prvkey_bytes,
+                                                         key))
+            || !TEST_ptr(bad = ossl_ml_kem_key_new(NULL, ML_KEM_768)))
+        goto err;
+
+    /* Wrong lengths */
+    if (!TEST_false(ossl_ml_kem_parse_public_key(ek, sizeof(ek) - 1, bad))
+            || !TEST_false(ossl_ml_kem_parse_private_key(dk, v->prvkey_bytes + 1,
+                                                         bad)))
+        goto err;
+
+    /* A first coefficient of q fails the modulus check */
+    ek[0] = 0x01;
+    ek[1] = (ek[1] & 0xf0) | 0x0d;
+    if (!TEST_false(ossl_ml_kem_parse_public_key(ek, sizeof(ek), bad)))
+        goto err;
+
+    /* A modified public key in the private key fails the hash check */
+    dk[3 * 384 + 100] ^= 0x80;
+    if (!TEST_false(ossl_ml_kem_parse_private_key(dk, v->prvkey_bytes, bad)))
+        goto err;
+    ret = 1;
+ err:
+    ossl_ml_kem_key_free(key);
+    ossl_ml_kem_key_free(bad);
+    OPENSSL_free(dk);
+    return ret;
+}
+
+int setup_tests(void)
+{
+    ADD_ALL_TESTS(test_ml_kem_kat, OSSL_NELEM(kats));
+    ADD_ALL_TESTS(test_ml_kem_roundtrip, 3);
+    ADD_TEST(test_ml_kem_bad_keys);
+    return 1;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright 2019-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2019-2023 The OpenSSL Project Authors. All Rights Reserved.
  * Copyright (c) 2019, Oracle and/or its affiliates.  All rights reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
@@ -13,7 +13,11 @@
 #include "testutil.h"
 #include "internal/nelem.h"
 #include "internal/property.h"
+#include "internal/tsan_assist.h"
 #include "../crypto/property/property_local.h"
+#if defined(OPENSSL_THREADS) && !defined(CRYPTO_TDEBUG)
+# include "threadstest.h"
+#endif
 
 /*
  * We make our OSSL_PROVIDER for testing purposes.  All we really need is
@@ -596,6 +600,180 @@ err:
     return res;
 }
 
+/*
+ * Test that query cache entries which are added, replaced and removed one at
+ * a time are seen by the lookups.
+ */
+static int test_query_cache_update(void)
+{
+    const int num = 100;
+    OSSL_METHOD_STORE *store;
+    OSSL_PROVIDER prov = { 1 };
+    int v[100], w[100];
+    char buf[20];
+    void *result;
+    int i, res = 0;
+
+    if (!TEST_ptr(store = ossl_method_store_new(NULL))
+            || !add_property_names("n", NULL)
+            || !TEST_true(ossl_method_store_add(store, &prov, 1, "n=1", "abc",
+                                                &up_ref, &down_ref)))
+        goto err;
+
+    for (i = 0; i < num; i++) {
+        BIO_snprintf(buf, sizeof(buf), "n=%d", i);
+        if (!TEST_true(ossl_method_store_cache_set(store, &prov, 1, buf, v + i,
+                                                   &up_ref, &down_ref)))
+            goto err;
+    }
+
+    /* Replace the even entries and remove every third */
+    for (i = 0; i < num; i++) {
+        BIO_snprintf(buf, sizeof(buf), "n=%d", i);
+        if ((i % 2 == 0
+             && !TEST_true(ossl_method_store_cache_set(store, &prov, 1, buf,
+                                                       w + i, &up_ref,
+                                                       &down_ref)))
+                || (i % 3 == 0
+                    && !TEST_true(ossl_method_store_cache_set(store, &prov, 1,
+                                                              buf, NULL, NULL,
+                                                              NULL))))
+            goto err;
+    }
+    for (i = 0; i < num; i++) {
+        BIO_snprintf(buf, sizeof(buf), "n=%d", i);
+        result = NULL;
+        if (i % 3 == 0) {
+            if (!TEST_false(ossl_method_store_cache_get(store, &prov, 1, buf,
+                                                        &result)))
+                goto err;
+        } else if (!TEST_true(ossl_method_store_cache_get(store, &prov, 1, buf,
+                                                          &result))
+                   || !TEST_ptr_eq(result, i % 2 == 0 ? w + i : v + i)) {
+            goto err;
+        }
+    }
+
+    /* Put the removed entries back */
+    for (i = 0; i < num; i += 3) {
+        BIO_snprintf(buf, sizeof(buf), "n=%d", i);
+        if (!TEST_true(ossl_method_store_cache_set(store, &prov, 1, buf, v + i,
+                                                   &up_ref, &down_ref))
+                || !TEST_true(ossl_method_store_cache_get(store, &prov, 1, buf,
+                                                          &result))
+                || !TEST_ptr_eq(result, v + i))
+            goto err;
+    }
+    res = 1;
+
+err:
+    ossl_method_store_free(store);
+    return res;
+}
+
+/*
+ * The churn thread runs until the fetch threads are done, so this needs real
+ * threads: with CRYPTO_TDEBUG run_thread() would run it to completion first.
+ */
+#if defined(OPENSSL_THREADS) && !defined(CRYPTO_TDEBUG)
+# define MT_NID          42
+# define MT_CHURN_NID    43
+# define MT_THREADS      4
+# define MT_ITERATIONS   20000
+
+static OSSL_METHOD_STORE *mt_store = NULL;
+static OSSL_PROVIDER mt_provider = { 1 };
+static char mt_method[] = "mt";
+static char mt_churn_method[] = "churn";
+static TSAN_QUALIFIER int mt_errors;
+static TSAN_QUALIFIER int mt_done;
+
+/* Look up a method the way the EVP fetch code does */
+static void mt_fetch_worker(void)
+{
+    const OSSL_PROVIDER *prov;
+    void *result;
+    int i;
+
+    for (i = 0; i < MT_ITERATIONS; i++) {
+        result = NULL;
+        if (!ossl_method_store_cache_get(mt_store, NULL, MT_NID, "mt=1",
+                                         &result)) {
+            prov = NULL;
+            if (!ossl_method_store_fetch(mt_store, MT_NID, "mt=1", &prov,
+                                         &result)
+                    || !ossl_method_store_cache_set(mt_store, &mt_provider,
+                                                    MT_NID, "mt=1", result,
+                                                    &up_ref, &down_ref)) {
+                tsan_counter(&mt_errors);
+                continue;
+            }
+        }
+        if (result != mt_method)
+            tsan_counter(&mt_errors);
+    }
+}
+
+/* Keep modifying the store while the fetch workers are running */
+static void mt_churn_worker(void)
+{
+    while (!tsan_load(&mt_done)) {
+        if (!ossl_method_store_add(mt_store, &mt_provider, MT_CHURN_NID,
+                                   "mt=1", mt_churn_method, &up_ref,
+                                   &down_ref)
+                || !ossl_method_store_cache_set(mt_store, &mt_provider,
+                                                MT_CHURN_NID, "mt=1",
+                                                mt_churn_method, &up_ref,
+                                                &down_ref)
+                || !ossl_method_store_remove(mt_store, MT_CHURN_NID,
+                                             mt_churn_method)
+                || !ossl_method_store_cache_flush_all(mt_store))
+            tsan_counter(&mt_errors);
+    }
+}
+
+/*
+ * Fetch and look up the query cache from several threads while another thread
+ * keeps adding and removing methods and flushing the cache.
+ */
+static int test_query_cache_mt(void)
+{
+    thread_t threads[MT_THREADS], churn_thread;
+    int i, res = 0;
+
+    mt_errors = 0;
+    mt_done = 0;
+    if (!TEST_ptr(mt_store = ossl_method_store_new(NULL))
+            || !add_property_names("mt", NULL)
+            || !TEST_true(ossl_method_store_add(mt_store, &mt_provider, MT_NID,
+                                                "mt=1", mt_method, &up_ref,
+                                                &down_ref))
+            || !TEST_true(ossl_method_store_add(mt_store, &mt_provider, MT_NID,
+                                                "mt=2", "other", &up_ref,
+                                                &down_ref))
+            || !TEST_true(run_thread(&churn_thread, mt_churn_worker)))
+        goto err;
+
+    res = 1;
+    for (i = 0; i < MT_THREADS; i++)
+        if (!TEST_true(run_thread(&threads[i], mt_fetch_worker))) {
+            res = 0;
+            break;
+        }
+    while (i-- > 0)
+        if (!TEST_true(wait_for_thread(threads[i])))
+            res = 0;
+    tsan_store(&mt_done, 1);
+    if (!TEST_true(wait_for_thread(churn_thread)))
+        res = 0;
+    res = res && TEST_int_eq(mt_errors, 0);
+err:
+    ossl_method_store_free(mt_store);
+    mt_store = NULL;
+    return res;
+}
+#endif
+
 static int test_fips_mode(void)
 {
     int ret = 0;
@@ -689,6 +867,10 @@ int setup_tests(void)
     ADD_TEST(test_register_deregister);
     ADD_TEST(test_property);
     ADD_TEST(test_query_cache_stochastic);
+    ADD_TEST(test_query_cache_update);
+#if defined(OPENSSL_THREADS) && !defined(CRYPTO_TDEBUG)
+    ADD_TEST(test_query_cache_mt);
+#endif
     ADD_TEST(test_fips_mode);
     ADD_ALL_TESTS(test_property_list_to_string, OSSL_NELEM(to_string_tests));
     return 1;
@@ -0,0 +1,398 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "testutil.h"
+#include <openssl/ssl.h>
+#include "internal/quic_cc.h"
+#include "internal/quic_types.h"
+
+#define MDPL        QUIC_MIN_INITIAL_DGRAM_LEN
+
+#define TIME_BASE   (ossl_ticks2time(5 * OSSL_TIME_SECOND))
+
+static const struct {
+    const char              *name;
+    const OSSL_CC_METHOD    *method;
+    /* Window after a single loss event, as a fraction of the prior window. */
+    uint64_t                beta_num, beta_den;
+} cc_methods[] = {
+    { "newreno",  &ossl_cc_newreno_method, 1, 2  },
+    { "cubic",    &ossl_cc_cubic_method,   7, 10 },
+};
+
+static size_t cur_mdpl;
+
+static OSSL_CC_DATA *cc_new(const OSSL_CC_METHOD *method)
+{
+    OSSL_PARAM changeables[2];
+
+    cur_mdpl = MDPL;
+    changeables[0]
+        = OSSL_PARAM_construct_size_t(OSSL_CC_OPTION_MAX_DGRAM_PAYLOAD_LEN,
+                                      &cur_mdpl);
+    changeables[1] = OSSL_PARAM_construct_end();
+
+    return method->new(NULL, NULL, changeables);
+}
+
+static OSSL_TIME at_ms(uint64_t ms)
+{
+    return ossl_time_add(TIME_BASE, ossl_ms2time(ms));
+}
+
+/*
+ * Check the basic window mechanics: initial window, slow start, reduction on
+ * loss, persistent congestion, spurious congestion event handling and probe
+ * exemptions. Packets are sent at the time given in milliseconds after
+ * TIME_BASE, and acknowledged or declared lost one millisecond later.
+ */
+static int test_cc_basic(int idx)
+{
+    int testresult = 0;
+    const OSSL_CC_METHOD *method = cc_methods[idx].method;
+    uint64_t beta_num = cc_methods[idx].beta_num;
+    uint64_t beta_den = cc_methods[idx].beta_den;
+    OSSL_CC_DATA *cc = NULL;
+    uint64_t cwnd, prior_cwnd, ssthresh;
+    size_t i, n;
+
+    if (!TEST_ptr(cc = cc_new(method)))
+        goto err;
+
+    /* RFC 9002 s. 7.2: min(10 * MDPL, max(14720, 2 * MDPL)) */
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), 10 * MDPL))
+        goto err;
+
+    /* Fill the window. */
+    for (n = 0; method->can_send(cc); ++n)
+        if (!TEST_true(method->on_data_sent(cc, MDPL)))
+            goto err;
+
+    if (!TEST_size_t_eq(n, 10)
+        || !TEST_uint64_t_eq(method->get_send_allowance(cc, ossl_time_zero(),
+                                                        0), 0))
+        goto err;
+
+    /* ACK the whole window; slow start doubles it. */
+    for (i = 0; i < n; ++i)
+        method->on_data_acked(cc, at_ms(1), at_ms(0), MDPL);
+
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), 20 * MDPL)
+        || !TEST_uint64_t_eq(method->get_send_allowance(cc, ossl_time_zero(),
+                                                        0), 20 * MDPL))
+        goto err;
+
+    /* Lose one packet out of the next window. */
+    for (i = 0; i < 20; ++i)
+        method->on_data_sent(cc, MDPL);
+
+    prior_cwnd = method->get_bytes_in_flight_max(cc);
+    method->on_data_lost(cc, at_ms(2), at_ms(1), MDPL, 0);
+    cwnd = method->get_bytes_in_flight_max(cc);
+    if (!TEST_uint64_t_eq(cwnd, prior_cwnd * beta_num / beta_den))
+        goto err;
+
+    /*
+     * Further losses of packets sent before the congestion event do not
+     * reduce the window again, whatever their packet number space.
+     */
+    method->on_data_lost(cc, at_ms(3), at_ms(1), MDPL, 0);
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), cwnd))
+        goto err;
+
+    /* ACKs for packets sent before the congestion event do not grow it. */
+    for (i = 2; i < 20; ++i)
+        method->on_data_acked(cc, at_ms(3), at_ms(1), MDPL);
+
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), cwnd))
+        goto err;
+
+    /* Spurious congestion event restores the prior window. */
+    method->on_data_sent(cc, MDPL);
+    method->on_data_lost(cc, at_ms(5), at_ms(4), MDPL, 0);
+    if (!TEST_uint64_t_lt(method->get_bytes_in_flight_max(cc), cwnd)
+        || !TEST_true(method->on_spurious_congestion_event(cc))
+        || !TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), cwnd))
+        goto err;
+
+    /* Persistent congestion collapses the window to the minimum. */
+    method->on_data_sent(cc, MDPL);
+    method->on_data_lost(cc, at_ms(7), at_ms(6), MDPL, 1);
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), 2 * MDPL))
+        goto err;
+
+    /*
+     * The slow start threshold was reduced before the window collapsed, so
+     * slow start ends there.
+     */
+    ssthresh = cwnd * beta_num / beta_den;
+    method->on_data_sent(cc, ssthresh);
+    method->on_data_acked(cc, at_ms(9), at_ms(8), ssthresh - 2 * MDPL);
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), ssthresh))
+        goto err;
+
+    method->on_data_acked(cc, at_ms(9), at_ms(8), MDPL);
+    if (!TEST_uint64_t_lt(method->get_bytes_in_flight_max(cc),
+                          ssthresh + MDPL))
+        goto err;
+
+    /* Probes are exempt from the window. */
+    method->on_data_invalidated(cc, UINT64_MAX);
+    method->on_data_sent(cc, method->get_bytes_in_flight_max(cc));
+    if (!TEST_false(method->can_send(cc))
+        || !TEST_true(method->set_exemption(cc, 2))
+        || !TEST_int_eq(method->get_exemption(cc), 2)
+        || !TEST_true(method->can_send(cc))
+        || !TEST_uint64_t_eq(method->get_send_allowance(cc, ossl_time_zero(),
+                                                        0), MDPL))
+        goto err;
+
+    method->on_data_sent(cc, MDPL);
+    method->on_data_sent(cc, MDPL);
+    if (!TEST_int_eq(method->get_exemption(cc), 0)
+        || !TEST_false(method->can_send(cc)))
+        goto err;
+
+    /* Invalidated data no longer counts as in flight. */
+    if (!TEST_true(method->on_data_invalidated(cc, UINT64_MAX)))
+        goto err;
+
+    /* A changed MDPL is picked up by a reset. */
+    cur_mdpl = 1500;
+    method->reset(cc, 0);
+    if (!TEST_uint64_t_eq(method->get_bytes_in_flight_max(cc), 14720))
+        goto err;
+
+    testresult = 1;
+err:
+    if (cc != NULL)
+        method->free(cc);
+    return testresult;
+}
+
+/*
+ * Deterministic path simulation
+ * =============================
+ *
+ * A single flow is sent through a bottleneck link with a fixed service rate, a
+ * drop-tail queue and a fixed propagation delay in each direction. Optionally,
+ * packets are also dropped at random on the forward path using a fixed-seed
+ * generator, so that every run is identical. The receiver ACKs each packet
+ * immediately and the ACK path is lossless.
+ *
+ * The sender declares a packet lost once a packet sent at least three packets
+ * later has been acknowledged (RFC 9002 s. 6.1.1), or when no ACK has been seen
+ * for a probe timeout. The simulation advances in steps of one millisecond.
+ */
+#define SIM_DURATION_MS     10000
+#define SIM_MAX_SEND        64      /* maximum packets sent per step */
+#define SIM_PKT_THRESH      3
+#define SIM_RING            65536
+
+enum {
+    PKT_IN_FLIGHT,
+    PKT_DROPPED,
+    PKT_ACKED,
+    PKT_LOST
+};
+
+struct sim_path {
+    uint32_t    rate;           /* bottleneck packets per ms */
+    uint32_t    delay_ms;       /* one-way propagation delay */
+    uint32_t    queue_len;      /* bottleneck queue capacity in packets */
+    uint32_t    loss_ppm;       /* random forward-path loss, parts per million */
+};
+
+struct sim_result {
+    uint64_t    sent, delivered, dropped;
+    uint64_t    stalled_ms;     /* longest time without any ACK */
+};
+
+static const struct sim_path sim_paths[] = {
+    /* ~10 Mbit/s, 40ms RTT, queue of one BDP, no random loss. */
+    { 1,  20, 40,    0     },
+    /* ~10 Mbit/s, 40ms RTT, short queue, 1% random loss. */
+    { 1,  20, 10,    10000 },
+    /* ~100 Mbit/s, 100ms RTT, queue of one BDP. */
+    { 10, 50, 1000,  0     },
+};
+
+static uint32_t lcg_state;
+
+static uint32_t sim_rand(void)
+{
+    lcg_state = lcg_state * 1103515245 + 12345;
+    return (lcg_state >> 8) & 0xffffff;
+}
+
+static int run_sim(const OSSL_CC_METHOD *method, const struct sim_path *path,
+                   struct sim_result *res)
+{
+    int ok = 0;
+    OSSL_CC_DATA *cc = NULL;
+    unsigned char *state = NULL;
+    uint32_t *sent_ms = NULL;
+    uint64_t *queue = NULL, *ack_pn = NULL, *ack_time = NULL;
+    uint64_t q_head = 0, q_tail = 0, a_head = 0, a_tail = 0;
+    uint64_t next_pn = 0, scan_pn = 0, largest_acked = 0;
+    uint64_t t, last_ack_t = 0, i, lost_bytes, last_lost_ms;
+    size_t max_pkts = (size_t)SIM_DURATION_MS * SIM_MAX_SEND;
+    int have_acked = 0, sent;
+
+    memset(res, 0, sizeof(*res));
+    lcg_state = 0x5eed;
+
+    if (!TEST_ptr(cc = cc_new(method))
+        || !TEST_ptr(state = OPENSSL_zalloc(max_pkts))
+        || !TEST_ptr(sent_ms = OPENSSL_malloc(sizeof(uint32_t) * max_pkts))
+        || !TEST_ptr(queue = OPENSSL_malloc(sizeof(uint64_t) * SIM_RING))
+        || !TEST_ptr(ack_pn = OPENSSL_malloc(sizeof(uint64_t) * SIM_RING))
+        || !TEST_ptr(ack_time = OPENSSL_malloc(sizeof(uint64_t) * SIM_RING)))
+        goto err;
+
+    for (t = 0; t < SIM_DURATION_MS; ++t) {
+        OSSL_TIME now = at_ms(t);
+
+        /* Deliver ACKs due by now. */
+        while (a_head != a_tail && ack_time[a_head % SIM_RING] <= t) {
+            i = ack_pn[a_head++ % SIM_RING];
+            state[i] = PKT_ACKED;
+            ++res->delivered;
+            if (i > largest_acked || !have_acked)
+                largest_acked = i;
+            have_acked = 1;
+            if (t - last_ack_t > res->stalled_ms)
+                res->stalled_ms = t - last_ack_t;
+            last_ack_t = t;
+            method->on_data_acked(cc, now, at_ms(sent_ms[i]), MDPL);
+        }
+
+        /* Loss detection. */
+        lost_bytes = last_lost_ms = 0;
+        for (; scan_pn < next_pn; ++scan_pn) {
+            if (state[scan_pn] == PKT_ACKED)
+                continue;
+            if (state[scan_pn] == PKT_IN_FLIGHT)
+                break;
+
+            /* Dropped: only detectable by the packet threshold or PTO. */
+            if ((!have_acked || scan_pn + SIM_PKT_THRESH > largest_acked)
+                && t - last_ack_t < 3 * 2 * path->delay_ms)
+                break;
+
+            state[scan_pn] = PKT_LOST;
+            lost_bytes += MDPL;
+            last_lost_ms = sent_ms[scan_pn];
+        }
+
+        if (lost_bytes > 0) {
+            method->on_data_lost(cc, now, at_ms(last_lost_ms), lost_bytes, 0);
+            if (t - last_ack_t >= 3 * 2 * path->delay_ms)
+                last_ack_t = t;
+        }
+
+        /* Serve the bottleneck queue. */
+        for (i = 0; i < path->rate && q_head != q_tail; ++i) {
+            ack_pn[a_tail % SIM_RING] = queue[q_head++ % SIM_RING];
+            ack_time[a_tail++ % SIM_RING] = t + 2 * path->delay_ms;
+        }
+
+        /* Send as much as the congestion controller allows. */
+        for (sent = 0; sent < SIM_MAX_SEND && method->can_send(cc); ++sent) {
+            if (!TEST_size_t_lt(next_pn, max_pkts))
+                goto err;
+
+            method->on_data_sent(cc, MDPL);
+            sent_ms[next_pn] = (uint32_t)t;
+            ++res->sent;
+
+            if ((path->loss_ppm > 0
+                 && sim_rand() % 1000000 < path->loss_ppm)
+                || q_tail - q_head >= path->queue_len) {
+                state[next_pn] = PKT_DROPPED;
+                ++res->dropped;
+            } else {
+                state[next_pn] = PKT_IN_FLIGHT;
+                queue[q_tail++ % SIM_RING] = next_pn;
+            }
+
+            ++next_pn;
+        }
+    }
+
+    ok = 1;
+err:
+    if (cc != NULL)
+        method->free(cc);
+    OPENSSL_free(state);
+    OPENSSL_free(sent_ms);
+    OPENSSL_free(queue);
+    OPENSSL_free(ack_pn);
+    OPENSSL_free(ack_time);
+    return ok;
+}
+
+static int test_cc_sim(int idx)
+{
+    const OSSL_CC_METHOD *method = cc_methods[idx % OSSL_NELEM(cc_methods)].method;
+    const struct sim_path *path = &sim_paths[idx / OSSL_NELEM(cc_methods)];
+    struct sim_result res, res2;
+    uint64_t capacity = (uint64_t)path->rate * SIM_DURATION_MS;
+
+    if (!TEST_true(run_sim(method, path, &res)))
+        return 0;
+
+    TEST_info("%s: rate %u/ms, RTT %ums, queue %u, loss %u ppm: "
+              "sent %llu, delivered %llu, dropped %llu",
+              cc_methods[idx % OSSL_NELEM(cc_methods)].name,
+              path->rate, 2 * path->delay_ms, path->queue_len, path->loss_ppm,
+              (unsigned long long)res.sent,
+              (unsigned long long)res.delivered,
+              (unsigned long long)res.dropped);
+
+    /* The flow never stalls for long. */
+    if (!TEST_uint64_t_le(res.stalled_ms, 10 * 2 * path->delay_ms))
+        return 0;
+
+    /* Reasonable utilisation of the bottleneck. */
+    if (!TEST_uint64_t_ge(res.delivered * 100,
+                          capacity * (path->loss_ppm > 0 ? 20 : 50)))
+        return 0;
+
+    /* Congestion losses are kept low. */
+    if (!TEST_uint64_t_le(res.dropped * 100,
+                          res.sent * (5 + path->loss_ppm / 10000)))
+        return 0;
+
+    /* The simulation is deterministic. */
+    if (!TEST_true(run_sim(method, path, &res2))
+        || !TEST_mem_eq(&res, sizeof(res), &res2, sizeof(res2)))
+        return 0;
+
+    return 1;
+}
+
+/* Without congestion control the same path is overwhelmed. */
+static int test_cc_sim_dummy(void)
+{
+    struct sim_result res;
+
+    if (!TEST_true(run_sim(&ossl_cc_dummy_method, &sim_paths[0], &res)))
+        return 0;
+
+    return TEST_uint64_t_gt(res.dropped * 2, res.sent);
+}
+
+int setup_tests(void)
+{
+    ADD_ALL_TESTS(test_cc_basic, OSSL_NELEM(cc_methods));
+    ADD_ALL_TESTS(test_cc_sim, OSSL_NELEM(cc_methods) * OSSL_NELEM(sim_paths));
+    ADD_TEST(test_cc_sim_dummy);
+    return 1;
+}
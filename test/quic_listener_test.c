@@ -0,0 +1,429 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+#include <openssl/ssl.h>
+#include <openssl/quic.h>
+#include <openssl/bio.h>
+#include "internal/common.h"
+#include "internal/sockets.h"
+#include "internal/quic_listener.h"
+#include "internal/quic_stream_map.h"
+#include "internal/quic_wire_pkt.h"
+#include "internal/time.h"
+#include "testutil.h"
+
+#define NUM_CLIENTS     8
+
+static const char msg1[] = "The quick brown fox jumped over the lazy dogs.";
+static const unsigned char alpn[] = { 8, 'o', 's', 's', 'l', 't', 'e', 's', 't' };
+
+static const char *certfile, *keyfile;
+
+static int is_want(SSL *s, int ret)
+{
+    int ec = SSL_get_error(s, ret);
+
+    return ec == SSL_ERROR_WANT_READ || ec == SSL_ERROR_WANT_WRITE;
+}
+
+static int alpn_select_cb(SSL *ssl, const unsigned char **out,
+                          unsigned char *outlen, const unsigned char *in,
+                          unsigned int inlen, void *arg)
+{
+    if (SSL_select_next_proto((unsigned char **)out, outlen, alpn, sizeof(alpn),
+                              in, inlen) != OPENSSL_NPN_NEGOTIATED)
+        return SSL_TLSEXT_ERR_ALERT_FATAL;
+
+    return SSL_TLSEXT_ERR_OK;
+}
+
+/* Create a non-blocking UDP socket bound to an ephemeral port on localhost. */
+static int make_socket(BIO_ADDR *addr)
+{
+    int fd;
+    struct in_addr ina = {0};
+    union BIO_sock_info_u info;
+
+    ina.s_addr = htonl(0x7f000001UL);
+
+    fd = BIO_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP, 0);
+    if (!TEST_int_ge(fd, 0))
+        return -1;
+
+    if (!TEST_true(BIO_socket_nbio(fd, 1))
+        || !TEST_true(BIO_ADDR_rawmake(addr, AF_INET, &ina, sizeof(ina), 0))
+        || !TEST_true(BIO_bind(fd, addr, 0)))
+        goto err;
+
+    info.addr = addr;
+    if (!TEST_true(BIO_sock_info(fd, BIO_SOCK_INFO_ADDRESS, &info))
+        || !TEST_int_gt(BIO_ADDR_rawport(addr), 0))
+        goto err;
+
+    return fd;
+
+err:
+    BIO_closesocket(fd);
+    return -1;
+}
+
+struct server_conn {
+    QUIC_LISTENER_CONN  *lc;
+    QUIC_STREAM         *stream;
+    unsigned char       buf[sizeof(msg1)];
+    size_t              read;
+    int                 done;
+};
+
+/*
+ * Reads everything the client sent on stream 0, and once the client has
+ * finished, echoes it back and concludes the stream.
+ */
+static int server_conn_service(struct server_conn *sc)
+{
+    size_t l = 0, written = 0;
+    int is_fin = 0;
+    QUIC_CHANNEL *ch = ossl_quic_listener_conn_get0_channel(sc->lc);
+
+    if (sc->done)
+        return 1;
+
+    if (!TEST_true(ossl_quic_rstream_read(sc->stream->rstream,
+                                          sc->buf + sc->read,
+                                          sizeof(sc->buf) - sc->read,
+                                          &l, &is_fin)))
+        return 0;
+
+    sc->read += l;
+    if (!is_fin)
+        return 1;
+
+    if (!TEST_mem_eq(sc->buf, sc->read, msg1, sizeof(msg1) - 1)
+        || !TEST_true(ossl_quic_sstream_append(sc->stream->sstream,
+                                               sc->buf, sc->read, &written))
+        || !TEST_size_t_eq(written, sc->read))
+        return 0;
+
+    ossl_quic_sstream_fin(sc->stream->sstream);
+    ossl_quic_stream_map_update_state(ossl_quic_channel_get_qsm(ch),
+                                      sc->stream);
+    sc->done = 1;
+    return ossl_quic_listener_conn_tick(sc->lc);
+}
+
+static int test_listener(int require_retry)
+{
+    int testresult = 0, ret;
+    int s_fd = -1, c_fd[NUM_CLIENTS];
+    BIO *s_net_bio = NULL;
+    BIO_ADDR *s_addr = NULL, *c_addr = NULL;
+    SSL_CTX *s_ctx = NULL, *c_ctx = NULL;
+    SSL *c_ssl[NUM_CLIENTS] = {0};
+    QUIC_LISTENER_ARGS args = {0};
+    QUIC_LISTENER *ql = NULL;
+    QUIC_LISTENER_CONN *lc;
+    struct server_conn sc[NUM_CLIENTS] = {{0}};
+    size_t i, l, num_accepted = 0, num_done = 0;
+    int c_state[NUM_CLIENTS] = {0};
+    size_t c_read[NUM_CLIENTS] = {0};
+    char c_buf[NUM_CLIENTS][sizeof(msg1)];
+    OSSL_TIME deadline;
+
+    for (i = 0; i < NUM_CLIENTS; ++i)
+        c_fd[i] = -1;
+
+    if (!TEST_ptr(s_addr = BIO_ADDR_new())
+        || !TEST_ptr(c_addr = BIO_ADDR_new()))
+        goto err;
+
+    /* Setup listener. */
+    if (!TEST_int_ge(s_fd = make_socket(s_addr), 0)
+        || !TEST_ptr(s_net_bio = BIO_new_dgram(s_fd, 0)))
+        goto err;
+
+    if (!TEST_ptr(s_ctx = SSL_CTX_new(TLS_method()))
+        || !TEST_int_gt(SSL_CTX_use_certificate_file(s_ctx, certfile,
+                                                     SSL_FILETYPE_PEM), 0)
+        || !TEST_int_gt(SSL_CTX_use_PrivateKey_file(s_ctx, keyfile,
+                                                    SSL_FILETYPE_PEM), 0))
+        goto err;
+
+    SSL_CTX_set_alpn_select_cb(s_ctx, alpn_select_cb, NULL);
+
+    args.ctx            = s_ctx;
+    args.net_rbio       = s_net_bio;
+    args.net_wbio       = s_net_bio;
+    args.require_retry  = require_retry;
+
+    if (!TEST_ptr(ql = ossl_quic_listener_new(&args)))
+        goto err;
+
+    /* Setup clients, each with its own socket. */
+    if (!TEST_ptr(c_ctx = SSL_CTX_new(OSSL_QUIC_client_method())))
+        goto err;
+
+    for (i = 0; i < NUM_CLIENTS; ++i) {
+        BIO *c_net_bio;
+
+        if (!TEST_int_ge(c_fd[i] = make_socket(c_addr), 0)
+            || !TEST_ptr(c_net_bio = BIO_new_dgram(c_fd[i], 0)))
+            goto err;
+
+        if (!TEST_true(BIO_dgram_set_peer(c_net_bio, s_addr))
+            || !TEST_ptr(c_ssl[i] = SSL_new(c_ctx))
+            || !TEST_true(BIO_up_ref(c_net_bio))) {
+            BIO_free(c_net_bio);
+            goto err;
+        }
+
+        SSL_set0_rbio(c_ssl[i], c_net_bio);
+        SSL_set0_wbio(c_ssl[i], c_net_bio);
+
+        /* 0 is a success for SSL_set_alpn_protos() */
+        if (!TEST_false(SSL_set_alpn_protos(c_ssl[i], alpn, sizeof(alpn)))
+            || !TEST_true(SSL_set_blocking_mode(c_ssl[i], 0)))
+            goto err;
+    }
+
+    deadline = ossl_time_add(ossl_time_now(), ossl_ms2time(10000));
+
+    while (num_done < NUM_CLIENTS) {
+        if (ossl_time_compare(ossl_time_now(), deadline) >= 0) {
+            TEST_error("timeout while running QUIC listener test");
+            goto err;
+        }
+
+        for (i = 0; i < NUM_CLIENTS; ++i) {
+            switch (c_state[i]) {
+            case 0: /* Connecting */
+                ret = SSL_connect(c_ssl[i]);
+                if (!TEST_true(ret == 1 || is_want(c_ssl[i], ret)))
+                    goto err;
+
+                if (ret != 1)
+                    break;
+
+                if (!TEST_int_eq(SSL_write(c_ssl[i], msg1, sizeof(msg1) - 1),
+                                 (int)sizeof(msg1) - 1)
+                    || !TEST_true(SSL_stream_conclude(c_ssl[i], 0)))
+                    goto err;
+
+                c_state[i] = 1;
+                break;
+
+            case 1: /* Reading echo */
+                l = 0;
+                ret = SSL_read_ex(c_ssl[i], c_buf[i] + c_read[i],
+                                  sizeof(c_buf[i]) - c_read[i], &l);
+                if (ret) {
+                    c_read[i] += l;
+                } else if (SSL_get_error(c_ssl[i], ret) == SSL_ERROR_ZERO_RETURN) {
+                    if (!TEST_mem_eq(c_buf[i], c_read[i],
+                                     msg1, sizeof(msg1) - 1))
+                        goto err;
+
+                    c_state[i] = 2;
+                    ++num_done;
+                } else if (!TEST_true(is_want(c_ssl[i], ret))) {
+                    goto err;
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            /* Non-blocking reads do not tick the connection for us. */
+            SSL_tick(c_ssl[i]);
+        }
+
+        if (!TEST_true(ossl_quic_listener_tick(ql)))
+            goto err;
+
+        while ((lc = ossl_quic_listener_accept(ql)) != NULL) {
+            QUIC_CHANNEL *ch = ossl_quic_listener_conn_get0_channel(lc);
+
+            if (!TEST_size_t_lt(num_accepted, NUM_CLIENTS))
+                goto err;
+
+            sc[num_accepted].lc     = lc;
+            sc[num_accepted].stream = ossl_quic_channel_get_stream_by_id(ch, 0);
+            if (!TEST_ptr(sc[num_accepted].stream))
+                goto err;
+
+            ++num_accepted;
+        }
+
+        for (i = 0; i < num_accepted; ++i)
+            if (!server_conn_service(&sc[i]))
+                goto err;
+    }
+
+    /*
+     * Every client connected exactly once, even though with Retry each client
+     * sent two different first Initial packets.
+     */
+    if (!TEST_size_t_eq(num_accepted, NUM_CLIENTS)
+        || !TEST_size_t_eq(ossl_quic_listener_get_num_conns(ql), NUM_CLIENTS))
+        goto err;
+
+    /* Releasing a connection which is still open keeps it alive until closed. */
+    for (i = 0; i < num_accepted; ++i) {
+        ossl_quic_channel_local_close(ossl_quic_listener_conn_get0_channel(sc[i].lc),
+                                      0);
+        ossl_quic_listener_conn_release(sc[i].lc);
+        sc[i].lc = NULL;
+    }
+
+    testresult = 1;
+err:
+    for (i = 0; i < NUM_CLIENTS; ++i) {
+        SSL_free(c_ssl[i]);
+        if (c_fd[i] >= 0)
+            BIO_closesocket(c_fd[i]);
+    }
+    SSL_CTX_free(c_ctx);
+    ossl_quic_listener_free(ql);
+    SSL_CTX_free(s_ctx);
+    BIO_free(s_net_bio);
+    if (s_fd >= 0)
+        BIO_closesocket(s_fd);
+    BIO_ADDR_free(s_addr);
+    BIO_ADDR_free(c_addr);
+    return testresult;
+}
+
+static int test_listener_conns(int idx)
+{
+    return test_listener(idx);
+}
+
+/*
+ * An Initial-sized datagram of an unknown version must elicit a Version
+ * Negotiation packet listing QUICv1, without creating a connection.
+ */
+static int test_listener_version_neg(void)
+{
+    int testresult = 0;
+    int s_fd = -1, c_fd = -1;
+    BIO *s_net_bio = NULL, *c_net_bio = NULL;
+    BIO_ADDR *s_addr = NULL, *c_addr = NULL;
+    SSL_CTX *s_ctx = NULL;
+    QUIC_LISTENER_ARGS args = {0};
+    QUIC_LISTENER *ql = NULL;
+    unsigned char buf[QUIC_MIN_INITIAL_DGRAM_LEN] = {0};
+    BIO_MSG msg = {0};
+    size_t i, processed = 0;
+    PACKET pkt;
+    QUIC_PKT_HDR hdr;
+    size_t version;
+    int found_v1 = 0;
+    static const unsigned char dcid[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    static const unsigned char scid[] = { 9, 10, 11, 12 };
+
+    if (!TEST_ptr(s_addr = BIO_ADDR_new())
+        || !TEST_ptr(c_addr = BIO_ADDR_new())
+        || !TEST_int_ge(s_fd = make_socket(s_addr), 0)
+        || !TEST_ptr(s_net_bio = BIO_new_dgram(s_fd, 0))
+        || !TEST_int_ge(c_fd = make_socket(c_addr), 0)
+        || !TEST_ptr(c_net_bio = BIO_new_dgram(c_fd, 0))
+        || !TEST_true(BIO_dgram_set_peer(c_net_bio, s_addr))
+        || !TEST_ptr(s_ctx = SSL_CTX_new(TLS_method())))
+        goto err;
+
+    args.ctx        = s_ctx;
+    args.net_rbio   = s_net_bio;
+    args.net_wbio   = s_net_bio;
+
+    if (!TEST_ptr(ql = ossl_quic_listener_new(&args)))
+        goto err;
+
+    /* Long header packet with a reserved version. */
+    buf[0] = 0xc0;
+    buf[1] = 0x1a;
+    buf[2] = 0x2a;
+    buf[3] = 0x3a;
+    buf[4] = 0x4a;
+    buf[5] = sizeof(dcid);
+    memcpy(buf + 6, dcid, sizeof(dcid));
+    buf[6 + sizeof(dcid)] = sizeof(scid);
+    memcpy(buf + 7 + sizeof(dcid), scid, sizeof(scid));
+
+    if (!TEST_int_eq(BIO_write(c_net_bio, buf, sizeof(buf)), (int)sizeof(buf)))
+        goto err;
+
+    for (i = 0; i < 100; ++i) {
+        if (!TEST_true(ossl_quic_listener_tick(ql)))
+            goto err;
+
+        msg.data        = buf;
+        msg.data_len    = sizeof(buf);
+        if (BIO_recvmmsg(c_net_bio, &msg, sizeof(msg), 1, 0, &processed)
+            && processed == 1)
+            break;
+
+        OSSL_sleep(10);
+    }
+
+    if (!TEST_size_t_eq(processed, 1))
+        goto err;
+
+    if (!TEST_true(PACKET_buf_init(&pkt, buf, msg.data_len))
+        || !TEST_true(ossl_quic_wire_decode_pkt_hdr(&pkt, 0, 0, &hdr, NULL))
+        || !TEST_int_eq(hdr.type, QUIC_PKT_TYPE_VERSION_NEG)
+        || !TEST_mem_eq(hdr.dst_conn_id.id, hdr.dst_conn_id.id_len,
+                        scid, sizeof(scid))
+        || !TEST_mem_eq(hdr.src_conn_id.id, hdr.src_conn_id.id_len,
+                        dcid, sizeof(dcid))
+        || !TEST_size_t_gt(hdr.len, 0)
+        || !TEST_size_t_eq(hdr.len % 4, 0))
+        goto err;
+
+    if (!TEST_true(PACKET_buf_init(&pkt, hdr.data, hdr.len)))
+        goto err;
+
+    while (PACKET_get_net_4_len(&pkt, &version))
+        if (version == QUIC_VERSION_1)
+            found_v1 = 1;
+
+    if (!TEST_true(found_v1)
+        || !TEST_size_t_eq(ossl_quic_listener_get_num_conns(ql), 0))
+        goto err;
+
+    testresult = 1;
+err:
+    ossl_quic_listener_free(ql);
+    SSL_CTX_free(s_ctx);
+    BIO_free(s_net_bio);
+    BIO_free(c_net_bio);
+    if (s_fd >= 0)
+        BIO_closesocket(s_fd);
+    if (c_fd >= 0)
+        BIO_closesocket(c_fd);
+    BIO_ADDR_free(s_addr);
+    BIO_ADDR_free(c_addr);
+    return testresult;
+}
+
+OPT_TEST_DECLARE_USAGE("certfile privkeyfile\n")
+
+int setup_tests(void)
+{
+    if (!test_skip_common_options()) {
+        TEST_error("Error parsing test options\n");
+        return 0;
+    }
+
+    if (!TEST_ptr(certfile = test_get_argument(0))
+            || !TEST_ptr(keyfile = test_get_argument(1)))
+        return 0;
+
+    ADD_ALL_TESTS(test_listener_conns, 2);
+    ADD_TEST(test_listener_version_neg);
+    return 1;
+}
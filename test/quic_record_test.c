@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -13,6 +13,7 @@
 #include "internal/quic_ackm.h"
 #include "internal/quic_cc.h"
 #include "internal/quic_ssl.h"
+#include "internal/bio.h"
 #include "testutil.h"
 #include "quic_record_test_util.h"
 
@@ -3406,6 +3407,200 @@ static int test_tx_script(int idx)
     return tx_run_script(tx_scripts[idx]);
 }
 
+/*
+ * Demuxer Coalesced Datagram Tests
+ * ================================
+ *
+ * A BIO which claims to support receive coalescing. Without coalescing it
+ * fills every message it is offered with a datagram of 80 bytes, as a busy
+ * socket would. With coalescing it first returns three datagrams of 100, 100
+ * and 50 bytes in a single message, then single datagrams of 80 bytes.
+ */
+#define SEG_TEST_MAX_DGRAMS 32
+
+static int seg_bio_calls;
+static int seg_bio_enabled;
+
+static unsigned char seg_dgram_byte(size_t i)
+{
+    /* The first byte of each datagram is that of a 1-RTT packet. */
+    return i % 100 == 0 ? 0x40 : (unsigned char)i;
+}
+
+static long seg_bio_ctrl(BIO *b, int cmd, long num, void *ptr)
+{
+    switch (cmd) {
+    case BIO_CTRL_DGRAM_GET_SEG_CAP:
+        return BIO_DGRAM_SEG_CAP_RX;
+    case BIO_CTRL_DGRAM_SET_RX_SEG_ENABLE:
+        seg_bio_enabled = num != 0;
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int seg_bio_fill(BIO_MSG *m, size_t len)
+{
+    size_t i;
+
+    if (!TEST_size_t_ge(m->data_len, len))
+        return 0;
+
+    for (i = 0; i < len; ++i)
+        ((unsigned char *)m->data)[i] = seg_dgram_byte(i);
+
+    m->data_len = len;
+    BIO_ADDR_clear(m->peer);
+    return 1;
+}
+
+static int seg_bio_recvmmsg(BIO *b, BIO_MSG *msg, size_t stride,
+                            size_t num_msg, uint64_t flags,
+                            size_t *num_processed)
+{
+    BIO_MSG_SEG *m = (BIO_MSG_SEG *)msg;
+    size_t i;
+
+    *num_processed = 0;
+    if (!TEST_int_eq((flags & BIO_MMSG_FLAG_SEG) != 0, seg_bio_enabled)
+        || !TEST_size_t_ge(num_msg, 1))
+        return 0;
+
+    if (!seg_bio_enabled) {
+        if (!TEST_size_t_eq(stride, sizeof(BIO_MSG)))
+            return 0;
+
+        for (i = 0; i < num_msg; ++i)
+            if (!seg_bio_fill(&msg[i], 80))
+                return 0;
+
+        *num_processed = num_msg;
+        return 1;
+    }
+
+    if (!TEST_size_t_eq(stride, sizeof(BIO_MSG_SEG))
+        || !seg_bio_fill(&m->msg, seg_bio_calls == 0 ? 250 : 80))
+        return 0;
+
+    m->seg_len = seg_bio_calls == 0 ? 100 : 0;
+    ++seg_bio_calls;
+    *num_processed = 1;
+    return 1;
+}
+
+static int seg_bio_create(BIO *b)
+{
+    BIO_set_init(b, 1);
+    return 1;
+}
+
+struct seg_rx_state {
+    QUIC_URXE   *e[SEG_TEST_MAX_DGRAMS];
+    size_t      num;
+};
+
+static void seg_rx_cb(QUIC_URXE *e, void *arg)
+{
+    struct seg_rx_state *s = arg;
+
+    if (s->num < OSSL_NELEM(s->e))
+        s->e[s->num++] = e;
+}
+
+static void seg_rx_release(QUIC_DEMUX *demux, struct seg_rx_state *s)
+{
+    size_t i;
+
+    for (i = 0; i < s->num; ++i)
+        ossl_quic_demux_release_urxe(demux, s->e[i]);
+    s->num = 0;
+}
+
+static int test_demux_seg(void)
+{
+    int testresult = 0;
+    BIO_METHOD *meth = NULL;
+    BIO *bio = NULL;
+    QUIC_DEMUX *demux = NULL;
+    struct seg_rx_state s = {0};
+    unsigned char *first = NULL;
+    size_t i, j, off = 0;
+    static const size_t lens[3] = { 100, 100, 50 };
+
+    seg_bio_calls = 0;
+    seg_bio_enabled = 1;
+    if (!TEST_ptr(meth = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK,
+                                      "seg"))
+        || !TEST_true(BIO_meth_set_ctrl(meth, seg_bio_ctrl))
+        || !TEST_true(BIO_meth_set_recvmmsg(meth, seg_bio_recvmmsg))
+        || !TEST_true(BIO_meth_set_create(meth, seg_bio_create))
+        || !TEST_ptr(bio = BIO_new(meth))
+        || !TEST_ptr(demux = ossl_quic_demux_new(bio, 0, fake_time, NULL))
+        || !TEST_false(seg_bio_enabled)
+        || !TEST_true(ossl_quic_demux_register(demux, &empty_conn_id,
+                                               seg_rx_cb, &s)))
+        goto err;
+
+    /* Datagrams are received in MTU-sized batches until one fills up. */
+    if (!TEST_int_eq(ossl_quic_demux_pump(demux), QUIC_DEMUX_PUMP_RES_OK)
+        || !TEST_size_t_eq(s.num, SEG_TEST_MAX_DGRAMS)
+        || !TEST_true(seg_bio_enabled))
+        goto err;
+
+    seg_rx_release(demux, &s);
+    if (!TEST_int_eq(ossl_quic_demux_pump(demux), QUIC_DEMUX_PUMP_RES_OK)
+        || !TEST_size_t_eq(s.num, 3))
+        goto err;
+
+    /* Each datagram refers to its part of the receive buffer. */
+    first = ossl_quic_urxe_data(s.e[0]);
+    for (i = 0; i < 3; ++i) {
+        if (!TEST_size_t_eq(s.e[i]->data_len, lens[i])
+            || !TEST_ptr_eq(ossl_quic_urxe_data(s.e[i]), first + off))
+            goto err;
+
+        for (j = 0; j < lens[i]; ++j)
+            if (!TEST_uchar_eq(ossl_quic_urxe_data(s.e[i])[j],
+                               seg_dgram_byte(off + j)))
+                goto err;
+
+        off += lens[i];
+    }
+
+    /* The buffer is only reused once every datagram has been released. */
+    seg_rx_release(demux, &s);
+
+    /*
+     * A datagram which was not coalesced is copied out of the buffer, and
+     * coalescing is turned off after a run of them.
+     */
+    for (i = 0; seg_bio_enabled; ++i) {
+        if (!TEST_size_t_lt(i, 100)
+            || !TEST_int_eq(ossl_quic_demux_pump(demux),
+                            QUIC_DEMUX_PUMP_RES_OK)
+            || !TEST_size_t_eq(s.num, 1)
+            || !TEST_size_t_eq(s.e[0]->data_len, 80)
+            || !TEST_ptr_ne(ossl_quic_urxe_data(s.e[0]), first)
+            || !TEST_uchar_eq(ossl_quic_urxe_data(s.e[0])[79],
+                              seg_dgram_byte(79)))
+            goto err;
+
+        seg_rx_release(demux, &s);
+    }
+
+    if (!TEST_size_t_gt(i, 1))
+        goto err;
+
+    testresult = 1;
+err:
+    seg_rx_release(demux, &s);
+    ossl_quic_demux_free(demux);
+    BIO_free(bio);
+    BIO_meth_free(meth);
+    return testresult;
+}
+
 int setup_tests(void)
 {
     ADD_ALL_TESTS(test_rx_script, OSSL_NELEM(rx_scripts));
@@ -3420,5 +3615,6 @@ int setup_tests(void)
      */
     ADD_ALL_TESTS(test_wire_pkt_hdr, NUM_WIRE_PKT_HDR_TESTS + 1);
     ADD_ALL_TESTS(test_tx_script, OSSL_NELEM(tx_scripts));
+    ADD_TEST(test_demux_seg);
     return 1;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -202,6 +202,56 @@ static int test_sstream_simple(void)
     return testresult;
 }
 
+static int test_sstream_appendv(void)
+{
+    int testresult = 0;
+    QUIC_SSTREAM *sstream = NULL;
+    OSSL_QUIC_FRAME_STREAM hdr;
+    OSSL_QTX_IOVEC iov[2];
+    SSL_IOVEC segs[4];
+    size_t num_iov = 0, wr = 0;
+
+    if (!TEST_ptr(sstream = ossl_quic_sstream_new(8192)))
+        goto err;
+
+    segs[0].data = (void *)data_1;
+    segs[0].data_len = 3;
+    segs[1].data = NULL;
+    segs[1].data_len = 0;
+    segs[2].data = (void *)(data_1 + 3);
+    segs[2].data_len = 6;
+    segs[3].data = (void *)(data_1 + 9);
+    segs[3].data_len = sizeof(data_1) - 9;
+
+    /* Skip the first segment and part of the third */
+    if (!TEST_true(ossl_quic_sstream_appendv(sstream, segs, OSSL_NELEM(segs),
+                                             5, &wr))
+        || !TEST_size_t_eq(wr, sizeof(data_1) - 5))
+        goto err;
+
+    /* The segments form a single range of the stream */
+    num_iov = OSSL_NELEM(iov);
+    if (!TEST_true(ossl_quic_sstream_get_stream_frame(sstream, 0, &hdr, iov,
+                                                      &num_iov))
+        || !TEST_uint64_t_eq(hdr.offset, 0)
+        || !TEST_uint64_t_eq(hdr.len, sizeof(data_1) - 5)
+        || !TEST_true(compare_iov(data_1 + 5, sizeof(data_1) - 5, iov,
+                                  num_iov)))
+        goto err;
+
+    /* Nothing is appended once the stream is finished */
+    ossl_quic_sstream_fin(sstream);
+    if (!TEST_false(ossl_quic_sstream_appendv(sstream, segs, OSSL_NELEM(segs),
+                                              0, &wr))
+        || !TEST_size_t_eq(wr, 0))
+        goto err;
+
+    testresult = 1;
+ err:
+    ossl_quic_sstream_free(sstream);
+    return testresult;
+}
+
 static int test_sstream_bulk(int idx)
 {
     int testresult = 0;
@@ -570,6 +620,7 @@ static int test_rstream_random(int idx)
 int setup_tests(void)
 {
     ADD_TEST(test_sstream_simple);
+    ADD_TEST(test_sstream_appendv);
     ADD_ALL_TESTS(test_sstream_bulk, 100);
     ADD_ALL_TESTS(test_rstream_simple, 4);
     ADD_ALL_TESTS(test_rstream_random, 100);
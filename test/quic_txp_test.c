@@ -1,5 +1,5 @@
 /*
- * Copyright 2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2022-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -35,8 +35,14 @@ static const unsigned char secret_1[32] = {
     0x01
 };
 
+/* If non-zero, the time returned by fake_now() (used by the pacing test). */
+static OSSL_TIME fake_time;
+
 static OSSL_TIME fake_now(void *arg)
 {
+    if (!ossl_time_is_zero(fake_time))
+        return fake_time;
+
     return ossl_time_now(); /* TODO */
 }
 
@@ -107,7 +113,7 @@ static void helper_cleanup(struct helper *h)
     BIO_free(h->bio2);
 }
 
-static int helper_init(struct helper *h)
+static int helper_init(struct helper *h, int pacing)
 {
     int rc = 0;
     size_t i;
@@ -152,7 +158,7 @@ static int helper_init(struct helper *h)
 
     h->have_statm = 1;
 
-    h->cc_method = &ossl_cc_dummy_method;
+    h->cc_method = pacing ? &ossl_cc_newreno_method : &ossl_cc_dummy_method;
     if (!TEST_ptr(h->cc_data = h->cc_method->new(NULL, NULL, NULL)))
         goto err;
 
@@ -179,6 +185,8 @@ static int helper_init(struct helper *h)
     h->args.cc_method  = h->cc_method;
     h->args.cc_data    = h->cc_data;
     h->args.now        = fake_now;
+    if (pacing)
+        h->args.statm  = &h->statm;
 
     if (!TEST_ptr(h->txp = ossl_quic_tx_packetiser_new(&h->args)))
         goto err;
@@ -1210,7 +1218,7 @@ static int run_script(const struct script_op *script)
     struct helper h;
     const struct script_op *op;
 
-    if (!helper_init(&h))
+    if (!helper_init(&h, 0))
         goto err;
 
     have_helper = 1;
@@ -1520,8 +1528,139 @@ static int test_script(int idx)
     return run_script(scripts[idx]);
 }
 
+/* Generate as many datagrams as the TXP allows, returning the count. */
+static int pacing_generate_all(struct helper *h, size_t *count)
+{
+    int res, sent_ack_eliciting = 0;
+
+    *count = 0;
+    for (;;) {
+        res = ossl_quic_tx_packetiser_generate(h->txp, TX_PACKETISER_ARCHETYPE_NORMAL,
+                                               &sent_ack_eliciting);
+        if (res == TX_PACKETISER_RES_NO_PKT)
+            return 1;
+        if (!TEST_int_eq(res, TX_PACKETISER_RES_SENT_PKT))
+            return 0;
+
+        ossl_qtx_finish_dgram(h->args.qtx);
+        ossl_qtx_flush_net(h->args.qtx);
+        ++*count;
+
+        /* Drain the receiving side so the BIO pair never fills up. */
+        ossl_quic_demux_pump(h->demux);
+        while (ossl_qrx_read_pkt(h->qrx, &h->qrx_pkt)) {
+            ossl_qrx_pkt_release(h->qrx_pkt);
+            h->qrx_pkt = NULL;
+        }
+
+        if (!TEST_size_t_lt(*count, 1000))
+            return 0;
+    }
+}
+
+static int test_pacing(void)
+{
+    int testresult = 0, have_helper = 0;
+    struct helper h;
+    QUIC_STREAM *s;
+    static unsigned char buf[256 * 1024];
+    size_t consumed = 0, count = 0;
+    OSSL_TIME deadline, srtt = ossl_ms2time(100);
+
+    fake_time = ossl_ms2time(1000);
+
+    if (!helper_init(&h, 1))
+        goto err;
+
+    have_helper = 1;
+
+    /*
+     * Open the congestion window well beyond the pacing burst size so that any
+     * limit we observe is due to pacing, and take an RTT sample of 100ms.
+     */
+    h.cc_method->on_data_acked(h.cc_data, fake_time, fake_time, 256 * 1200);
+    ossl_statm_update_rtt(&h.statm, ossl_time_zero(), srtt);
+
+    if (!TEST_true(ossl_qtx_provide_secret(h.args.qtx, QUIC_ENC_LEVEL_1RTT,
+                                           QRL_SUITE_AES128GCM, NULL,
+                                           secret_1, sizeof(secret_1)))
+        || !TEST_true(ossl_qrx_provide_secret(h.qrx, QUIC_ENC_LEVEL_1RTT,
+                                              QRL_SUITE_AES128GCM, NULL,
+                                              secret_1, sizeof(secret_1))))
+        goto err;
+
+    ossl_quic_tx_packetiser_notify_handshake_complete(h.txp);
+
+    if (!TEST_ptr(s = ossl_quic_stream_map_alloc(h.args.qsm, 0,
+                                                 QUIC_STREAM_DIR_BIDI)))
+        goto err;
+
+    if (!TEST_ptr(s->sstream = ossl_quic_sstream_new(sizeof(buf)))
+        || !TEST_true(ossl_quic_txfc_init(&s->txfc, &h.conn_txfc))
+        || !TEST_true(ossl_quic_rxfc_init(&s->rxfc, &h.conn_rxfc,
+                                          1 * 1024 * 1024,
+                                          16 * 1024 * 1024,
+                                          fake_now, NULL))) {
+        ossl_quic_sstream_free(s->sstream);
+        ossl_quic_stream_map_release(h.args.qsm, s);
+        goto err;
+    }
+
+    if (!TEST_true(ossl_quic_txfc_bump_cwm(&h.conn_txfc, sizeof(buf)))
+        || !TEST_true(ossl_quic_txfc_bump_cwm(&s->txfc, sizeof(buf)))
+        || !TEST_true(ossl_quic_sstream_append(s->sstream, buf, sizeof(buf),
+                                               &consumed))
+        || !TEST_size_t_eq(consumed, sizeof(buf)))
+        goto err;
+
+    ossl_quic_stream_map_update_state(h.args.qsm, s);
+
+    /* Nothing to wait for until we have been blocked by pacing. */
+    if (!TEST_true(ossl_time_is_infinite(ossl_quic_tx_packetiser_get_deadline(h.txp))))
+        goto err;
+
+    /* The initial burst is limited to ten datagrams. */
+    if (!TEST_true(pacing_generate_all(&h, &count))
+        || !TEST_size_t_eq(count, 10))
+        goto err;
+
+    /* We must now wait for a finite amount of time less than one RTT. */
+    deadline = ossl_quic_tx_packetiser_get_deadline(h.txp);
+    if (!TEST_false(ossl_time_is_infinite(deadline))
+        || !TEST_true(ossl_time_compare(deadline, fake_time) > 0)
+        || !TEST_true(ossl_time_compare(deadline,
+                                        ossl_time_add(fake_time, srtt)) < 0))
+        goto err;
+
+    /* Nothing more can be sent just before the deadline. */
+    fake_time = ossl_time_subtract(deadline, ossl_us2time(1));
+    if (!TEST_true(pacing_generate_all(&h, &count))
+        || !TEST_size_t_eq(count, 0))
+        goto err;
+
+    /* Exactly one more datagram can be sent at the deadline. */
+    fake_time = deadline;
+    if (!TEST_true(pacing_generate_all(&h, &count))
+        || !TEST_size_t_eq(count, 1))
+        goto err;
+
+    /* After an idle period, the burst size is again limited. */
+    fake_time = ossl_time_add(fake_time, ossl_time_multiply(srtt, 10));
+    if (!TEST_true(pacing_generate_all(&h, &count))
+        || !TEST_size_t_eq(count, 10))
+        goto err;
+
+    testresult = 1;
+err:
+    if (have_helper)
+        helper_cleanup(&h);
+    fake_time = ossl_time_zero();
+    return testresult;
+}
+
 int setup_tests(void)
 {
     ADD_ALL_TESTS(test_script, OSSL_NELEM(scripts));
+    ADD_TEST(test_pacing);
     return 1;
 }
@@ -113,6 +113,177 @@ static int test_quic_write_read(int idx)
     return ret;
 }
 
+/*
+ * Test that stream data can be borrowed from a QUIC connection without copying
+ * it and is released correctly, both partially and up to the end of the stream.
+ */
+static int test_quic_read_borrow(void)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    int i, ret = 0;
+    unsigned char buf[20];
+    static char *msg = "A test message";
+    size_t msglen = strlen(msg);
+    size_t numbytes = 0;
+    const unsigned char *data = NULL;
+
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, cert, privkey,
+                                                    0, &qtserv, &clientquic,
+                                                    NULL))
+            || !TEST_true(SSL_set_tlsext_host_name(clientquic, "localhost"))
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto end;
+
+    /* Nothing to borrow yet */
+    if (!TEST_false(SSL_read_borrow_ex(clientquic, &data, &numbytes))
+            || !TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_WANT_READ)
+            || !TEST_ptr_null(data)
+            || !TEST_false(SSL_read_release(clientquic, 0)))
+        goto end;
+
+    if (!TEST_true(ossl_quic_tserver_write(qtserv, (unsigned char *)msg,
+                                           msglen, &numbytes)))
+        goto end;
+    ossl_quic_tserver_tick(qtserv);
+    SSL_tick(clientquic);
+
+    /* Borrow the data and check it cannot be read while it is borrowed */
+    if (!TEST_true(SSL_read_borrow_ex(clientquic, &data, &numbytes))
+            || !TEST_mem_eq(data, numbytes, msg, msglen)
+            || !TEST_false(SSL_read_ex(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_false(SSL_read_borrow_ex(clientquic, &data, &numbytes))
+            || !TEST_false(SSL_read_release(clientquic, msglen + 1)))
+        goto end;
+
+    /* Consume part of the data; the rest must remain readable */
+    if (!TEST_true(SSL_read_release(clientquic, 5))
+            || !TEST_false(SSL_read_release(clientquic, 0))
+            || !TEST_int_eq(SSL_pending(clientquic), msglen - 5)
+            || !TEST_true(SSL_read_ex(clientquic, buf, sizeof(buf), &numbytes))
+            || !TEST_mem_eq(buf, numbytes, msg + 5, msglen - 5))
+        goto end;
+
+    /* Send the data again and end the stream */
+    if (!TEST_true(ossl_quic_tserver_write(qtserv, (unsigned char *)msg,
+                                           msglen, &numbytes))
+            || !TEST_true(ossl_quic_tserver_conclude(qtserv)))
+        goto end;
+
+    for (i = 0, numbytes = 0; numbytes == 0; ++i) {
+        if (!TEST_int_lt(i, 100))
+            goto end;
+
+        ossl_quic_tserver_tick(qtserv);
+        SSL_tick(clientquic);
+
+        if (!SSL_read_borrow_ex(clientquic, &data, &numbytes)
+                && !TEST_int_eq(SSL_get_error(clientquic, 0),
+                                SSL_ERROR_WANT_READ))
+            goto end;
+    }
+
+    if (!TEST_mem_eq(data, numbytes, msg, msglen)
+            || !TEST_true(SSL_read_release(clientquic, numbytes)))
+        goto end;
+
+    /* Once the FIN has been reached, further borrows must report EOF */
+    for (i = 0; ; ++i) {
+        if (!TEST_int_lt(i, 100))
+            goto end;
+
+        ossl_quic_tserver_tick(qtserv);
+        SSL_tick(clientquic);
+
+        if (!TEST_false(SSL_read_borrow_ex(clientquic, &data, &numbytes)))
+            goto end;
+        if (SSL_get_error(clientquic, 0) == SSL_ERROR_ZERO_RETURN)
+            break;
+        if (!TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_WANT_READ))
+            goto end;
+    }
+
+    ret = 1;
+
+ end:
+    ossl_quic_tserver_free(qtserv);
+    SSL_free(clientquic);
+    SSL_CTX_free(cctx);
+
+    return ret;
+}
+
+/*
+ * Test that releasing borrowed data returns flow control credit to the peer.
+ * The server sends more than the initial receive window of the stream, so the
+ * transfer can only complete if the window advances as data is released.
+ */
+#define BORROW_FC_TOTAL     (3 * 1024 * 1024 / 2)
+
+static int test_quic_read_borrow_fc(void)
+{
+    SSL_CTX *cctx = SSL_CTX_new_ex(libctx, NULL, OSSL_QUIC_client_method());
+    SSL *clientquic = NULL;
+    QUIC_TSERVER *qtserv = NULL;
+    int ret = 0;
+    unsigned char buf[4096];
+    size_t i, j, n, numbytes = 0, sent = 0, received = 0;
+    const unsigned char *data = NULL;
+
+    if (!TEST_ptr(cctx)
+            || !TEST_true(qtest_create_quic_objects(libctx, cctx, cert, privkey,
+                                                    0, &qtserv, &clientquic,
+                                                    NULL))
+            || !TEST_true(SSL_set_tlsext_host_name(clientquic, "localhost"))
+            || !TEST_true(qtest_create_quic_connection(qtserv, clientquic)))
+        goto end;
+
+    for (i = 0; received < BORROW_FC_TOTAL; ++i) {
+        if (!TEST_size_t_lt(i, 200000))
+            goto end;
+
+        if (sent < BORROW_FC_TOTAL) {
+            n = BORROW_FC_TOTAL - sent;
+            if (n > sizeof(buf))
+                n = sizeof(buf);
+            for (j = 0; j < n; ++j)
+                buf[j] = (unsigned char)((sent + j) % 251);
+
+            if (!TEST_true(ossl_quic_tserver_write(qtserv, buf, n, &numbytes)))
+                goto end;
+            sent += numbytes;
+        }
+
+        ossl_quic_tserver_tick(qtserv);
+        SSL_tick(clientquic);
+
+        if (!SSL_read_borrow_ex(clientquic, &data, &numbytes)) {
+            if (!TEST_int_eq(SSL_get_error(clientquic, 0), SSL_ERROR_WANT_READ))
+                goto end;
+            continue;
+        }
+
+        for (j = 0; j < numbytes; ++j)
+            if (!TEST_uchar_eq(data[j], (unsigned char)((received + j) % 251)))
+                goto end;
+
+        if (!TEST_true(SSL_read_release(clientquic, numbytes)))
+            goto end;
+        received += numbytes;
+    }
+
+    ret = 1;
+
+ end:
+    ossl_quic_tserver_free(qtserv);
+    SSL_free(clientquic);
+    SSL_CTX_free(cctx);
+
+    return ret;
+}
+
 /* Test that a vanilla QUIC SSL object has the expected ciphersuites available */
 static int test_ciphersuites(void)
 {
@@ -256,6 +427,8 @@ int setup_tests(void)
         goto err;
 
     ADD_ALL_TESTS(test_quic_write_read, 2);
+    ADD_TEST(test_quic_read_borrow);
+    ADD_TEST(test_quic_read_borrow_fc);
     ADD_TEST(test_ciphersuites);
     ADD_TEST(test_version);
 
@@ -1,5 +1,5 @@
 #! /usr/bin/env perl
-# Copyright 2015-2018 The OpenSSL Project Authors. All Rights Reserved.
+# Copyright 2015-2023 The OpenSSL Project Authors. All Rights Reserved.
 #
 # Licensed under the Apache License 2.0 (the "License").  You may not use
 # this file except in compliance with the License.  You can obtain a copy
@@ -8,7 +8,6 @@
 
 use strict;
 use OpenSSL::Test;              # get 'plan'
-use OpenSSL::Test::Simple;
 use OpenSSL::Test::Utils;
 
 setup("test_internal_curve448");
@@ -16,4 +15,13 @@ setup("test_internal_curve448");
 plan skip_all => "This test is unsupported in a no-ec build"
     if disabled("ec");
 
-simple_test("test_internal_curve448", "curve448_internal_test");
+plan tests => 2;
+
+ok(run(test(["curve448_internal_test"])), "running curve448_internal_test");
+
+# Again without the MULX/ADX field arithmetic on x86_64
+{
+    local $ENV{OPENSSL_ia32cap} = "~0x0:~0x80100";
+    ok(run(test(["curve448_internal_test"])),
+       "running curve448_internal_test without BMI2 and ADX");
+}
@@ -0,0 +1,27 @@
+#! /usr/bin/env perl
+# Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+#
+# Licensed under the Apache License 2.0 (the "License").  You may not use
+# this file except in compliance with the License.  You can obtain a copy
+# in the file LICENSE in the source distribution or at
+# https://www.openssl.org/source/license.html
+
+use strict;
+use OpenSSL::Test;              # get 'plan'
+use OpenSSL::Test::Utils;
+
+setup("test_internal_ml_kem");
+
+plan skip_all => "ML-KEM is not supported by this OpenSSL build"
+    if disabled("ml-kem");
+
+plan tests => 2;
+
+ok(run(test(["ml_kem_internal_test"])), "running ml_kem_internal_test");
+
+# Again without the AVX2 polynomial arithmetic on x86_64
+{
+    local $ENV{OPENSSL_ia32cap} = "~0x0:~0x20";
+    ok(run(test(["ml_kem_internal_test"])),
+       "running ml_kem_internal_test without AVX2");
+}
@@ -1,5 +1,5 @@
 #! /usr/bin/env perl
-# Copyright 2015-2021 The OpenSSL Project Authors. All Rights Reserved.
+# Copyright 2015-2023 The OpenSSL Project Authors. All Rights Reserved.
 #
 # Licensed under the Apache License 2.0 (the "License").  You may not use
 # this file except in compliance with the License.  You can obtain a copy
@@ -112,6 +112,7 @@ my @defltfiles = qw(
                      evpmd_blake.txt
                      evpmd_md.txt
                      evpmd_mdc2.txt
+                     evpmd_parallelhash.txt
                      evpmd_ripemd.txt
                      evpmd_sm3.txt
                      evpmd_whirlpool.txt
@@ -132,6 +133,7 @@ push @defltfiles, qw(evpkdf_argon2.txt) unless $no_argon2;
 plan tests =>
     + (scalar(@configs) * scalar(@files))
     + scalar(@defltfiles)
+    + 2  # AES and ChaCha20 with AVX-512 masked
     + 3; # error output tests
 
 foreach (@configs) {
@@ -153,6 +155,26 @@ foreach my $f ( @defltfiles ) {
        "running evp_test -config $conf $f");
 }
 
+# Mask AVX512F, AVX512IFMA, AVX512BW and AVX512VL so that the AES vectors are
+# also run through the 256-bit VAES code paths on CPUs that have AVX-512
+{
+    local $ENV{OPENSSL_ia32cap} = ":~0xC0210000";
+    ok(run(test(["evp_test",
+                 "-config", $conf,
+                 data_file("evpciph_aes_common.txt")])),
+       "running evp_test -config $conf evpciph_aes_common.txt without AVX-512");
+}
+
+# Mask AVX512F so that the stitched x86_64 ChaCha20-Poly1305 code path is
+# also used on CPUs with AVX512 IFMA
+{
+    local $ENV{OPENSSL_ia32cap} = ":~0x10000";
+    ok(run(test(["evp_test",
+                 "-config", $conf,
+                 data_file("evpciph_chacha.txt")])),
+       "running evp_test -config $conf evpciph_chacha.txt without AVX512F");
+}
+
 # test_errors OPTIONS
 #
 # OPTIONS may include:
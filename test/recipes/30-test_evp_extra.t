@@ -1,5 +1,5 @@
 #! /usr/bin/env perl
-# Copyright 2015-2021 The OpenSSL Project Authors. All Rights Reserved.
+# Copyright 2015-2023 The OpenSSL Project Authors. All Rights Reserved.
 #
 # Licensed under the Apache License 2.0 (the "License").  You may not use
 # this file except in compliance with the License.  You can obtain a copy
@@ -14,7 +14,7 @@ use OpenSSL::Test qw/:DEFAULT bldtop_dir/;
 
 setup("test_evp_extra");
 
-plan tests => 3;
+plan tests => 5;
 
 ok(run(test(["evp_extra_test"])), "running evp_extra_test");
 
@@ -22,3 +22,19 @@ ok(run(test(["evp_extra_test"])), "running evp_extra_test");
 ok(run(test(["evp_extra_test", "-context"])), "running evp_extra_test with a non-default library context");
 
 ok(run(test(["evp_extra_test2"])), "running evp_extra_test2");
+
+# Mask AVX512F, AVX512IFMA, AVX512BW and AVX512VL so that EVP_Digest_many()
+# also runs through the AVX2 multi-buffer kernels on CPUs that have AVX-512
+{
+    local $ENV{OPENSSL_ia32cap} = ":~0xC0210000";
+    ok(run(test(["evp_extra_test", "-test", "test_EVP_Digest_many"])),
+       "running test_EVP_Digest_many without AVX-512");
+}
+
+# Mask FXSR, SSSE3, AVX and all later extensions so that EVP_Digest_many()
+# falls back to hashing one message at a time
+{
+    local $ENV{OPENSSL_ia32cap} = "~0x1000020001000000:0";
+    ok(run(test(["evp_extra_test", "-test", "test_EVP_Digest_many"])),
+       "running test_EVP_Digest_many without SIMD");
+}
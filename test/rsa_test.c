@@ -1,5 +1,5 @@
 /*
- * Copyright 1999-2021 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 1999-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -24,7 +24,9 @@
 #include <openssl/err.h>
 #include <openssl/rand.h>
 #include <openssl/bn.h>
+#include <openssl/async.h>
 
+#include "crypto/bn.h"
 #include "testutil.h"
 
 #include <openssl/rsa.h>
@@ -594,11 +596,201 @@ err:
     return ret;
 }
 
+#define RSA_BATCH_JOBS 6
+
+typedef struct {
+    RSA *rsa;
+    const unsigned char *in;
+    unsigned char out[256];
+} RSA_BATCH_JOB_ARGS;
+
+static int rsa_batch_job(void *arg)
+{
+    RSA_BATCH_JOB_ARGS *args = *(RSA_BATCH_JOB_ARGS **)arg;
+
+    return RSA_private_encrypt(RSA_size(args->rsa), args->in, args->out,
+                               args->rsa, RSA_NO_PADDING);
+}
+
+/*
+ * Private key operations of ASYNC jobs with batching on match those without,
+ * including a partial batch that runs on RSA_batch_flush()
+ */
+static int test_rsa_batch(void)
+{
+    int ret = 0, i, jobret, paused = 0;
+    RSA *rsa = NULL;
+    BIGNUM *e = NULL;
+    const BIGNUM *p = NULL;
+    unsigned char in[RSA_BATCH_JOBS][256], expected[RSA_BATCH_JOBS][256];
+    RSA_BATCH_JOB_ARGS args[RSA_BATCH_JOBS], *argp;
+    ASYNC_JOB *job[RSA_BATCH_JOBS] = { NULL };
+    ASYNC_WAIT_CTX *waitctx[RSA_BATCH_JOBS] = { NULL };
+    size_t x8_before = BN_mod_exp_path_count(BN_MOD_EXP_PATH_RSAZ_X8_AVX512_IFMA);
+    size_t numfds;
+    int lanes;
+
+    if (!ASYNC_is_capable())
+        return TEST_skip("ASYNC is not supported");
+    /* A key with CRT parameters */
+    if (!TEST_ptr(e = BN_new())
+        || !TEST_true(BN_set_word(e, RSA_F4))
+        || !TEST_ptr(rsa = RSA_new())
+        || !TEST_true(RSA_generate_key_ex(rsa, 2048, e, NULL)))
+        goto err;
+    RSA_get0_factors(rsa, &p, NULL);
+    lanes = ossl_bn_mod_exp_mont_consttime_lanes(p);
+
+    for (i = 0; i < RSA_BATCH_JOBS; i++) {
+        if (!TEST_int_gt(RAND_bytes(in[i], sizeof(in[i])), 0))
+            goto err;
+        in[i][0] = 0;
+        if (!TEST_int_eq(RSA_private_encrypt(sizeof(in[i]), in[i],
+                                             expected[i], rsa,
+                                             RSA_NO_PADDING), 256)
+            || !TEST_ptr(waitctx[i] = ASYNC_WAIT_CTX_new()))
+            goto err;
+        args[i].rsa = rsa;
+        args[i].in = in[i];
+    }
+
+    if (!TEST_true(RSA_batch_enable(1)))
+        goto err;
+    for (i = 0; i < RSA_BATCH_JOBS; i++) {
+        argp = &args[i];
+        switch (ASYNC_start_job(&job[i], waitctx[i], &jobret, rsa_batch_job,
+                                &argp, sizeof(argp))) {
+        case ASYNC_PAUSE:
+            paused++;
+            break;
+        case ASYNC_FINISH:
+            if (!TEST_int_eq(jobret, 256))
+                goto err;
+            job[i] = NULL;
+            break;
+        default:
+            TEST_error("ASYNC_start_job failed");
+            goto err;
+        }
+    }
+    /* Four complete a batch, the fifth and sixth wait for the next one */
+    if (!TEST_int_eq(paused, lanes > 0 ? 5 : 0)
+        || !TEST_int_eq(RSA_batch_flush(), lanes > 0 ? 2 : 0)
+        || !TEST_int_eq(RSA_batch_flush(), 0))
+        goto err;
+    for (i = 0; i < RSA_BATCH_JOBS; i++) {
+        if (job[i] == NULL)
+            continue;
+        /* Paused jobs have a wake-up fd, which goes away once they resume */
+        if (!TEST_true(ASYNC_WAIT_CTX_get_all_fds(waitctx[i], NULL, &numfds))
+            || !TEST_size_t_eq(numfds, 1)
+            || !TEST_int_eq(ASYNC_start_job(&job[i], waitctx[i], &jobret,
+                                            rsa_batch_job, &argp,
+                                            sizeof(argp)),
+                            ASYNC_FINISH)
+            || !TEST_int_eq(jobret, 256)
+            || !TEST_true(ASYNC_WAIT_CTX_get_all_fds(waitctx[i], NULL,
+                                                     &numfds))
+            || !TEST_size_t_eq(numfds, 0))
+            goto err;
+        job[i] = NULL;
+    }
+    for (i = 0; i < RSA_BATCH_JOBS; i++)
+        if (!TEST_mem_eq(args[i].out, 256, expected[i], 256))
+            goto err;
+    if (lanes > 0
+        && !TEST_size_t_eq(BN_mod_exp_path_count(BN_MOD_EXP_PATH_RSAZ_X8_AVX512_IFMA)
+                           - x8_before, 2 * RSA_BATCH_JOBS))
+        goto err;
+
+    ret = 1;
+err:
+    RSA_batch_enable(0);
+    for (i = 0; i < RSA_BATCH_JOBS; i++)
+        ASYNC_WAIT_CTX_free(waitctx[i]);
+    RSA_free(rsa);
+    BN_free(e);
+    return ret;
+}
+
+static int rsa_batch_wake_cb(void *arg)
+{
+    (*(int *)arg)++;
+    return 1;
+}
+
+/*
+ * A job whose wait context is freed while it waits for its batch is taken
+ * out of the batch, with and without a wake-up callback.  It runs on its
+ * own when resumed with another wait context.
+ */
+static int test_rsa_batch_free_wait_ctx(int idx)
+{
+    int ret = 0, jobret, woken = 0;
+    RSA *rsa = NULL;
+    BIGNUM *e = NULL;
+    const BIGNUM *p = NULL;
+    unsigned char in[256], expected[256];
+    RSA_BATCH_JOB_ARGS args, *argp = &args;
+    ASYNC_JOB *job = NULL;
+    ASYNC_WAIT_CTX *waitctx = NULL;
+
+    if (!ASYNC_is_capable())
+        return TEST_skip("ASYNC is not supported");
+    if (!TEST_ptr(e = BN_new())
+        || !TEST_true(BN_set_word(e, RSA_F4))
+        || !TEST_ptr(rsa = RSA_new())
+        || !TEST_true(RSA_generate_key_ex(rsa, 2048, e, NULL)))
+        goto err;
+    RSA_get0_factors(rsa, &p, NULL);
+    if (ossl_bn_mod_exp_mont_consttime_lanes(p) == 0) {
+        ret = TEST_skip("no multi-lane exponentiation");
+        goto err;
+    }
+    if (!TEST_int_gt(RAND_bytes(in, sizeof(in)), 0))
+        goto err;
+    in[0] = 0;
+    if (!TEST_int_eq(RSA_private_encrypt(sizeof(in), in, expected, rsa,
+                                         RSA_NO_PADDING), 256)
+        || !TEST_ptr(waitctx = ASYNC_WAIT_CTX_new())
+        || (idx == 1
+            && !TEST_true(ASYNC_WAIT_CTX_set_callback(waitctx,
+                                                      rsa_batch_wake_cb,
+                                                      &woken))))
+        goto err;
+    args.rsa = rsa;
+    args.in = in;
+
+    if (!TEST_true(RSA_batch_enable(1))
+        || !TEST_int_eq(ASYNC_start_job(&job, waitctx, &jobret, rsa_batch_job,
+                                        &argp, sizeof(argp)), ASYNC_PAUSE))
+        goto err;
+    ASYNC_WAIT_CTX_free(waitctx);
+    if (!TEST_ptr(waitctx = ASYNC_WAIT_CTX_new())
+        || !TEST_int_eq(RSA_batch_flush(), 0)
+        || !TEST_int_eq(ASYNC_start_job(&job, waitctx, &jobret, rsa_batch_job,
+                                        &argp, sizeof(argp)), ASYNC_FINISH)
+        || !TEST_int_eq(jobret, 256)
+        || !TEST_mem_eq(args.out, 256, expected, 256)
+        || !TEST_int_eq(woken, 0))
+        goto err;
+
+    ret = 1;
+err:
+    RSA_batch_enable(0);
+    ASYNC_WAIT_CTX_free(waitctx);
+    RSA_free(rsa);
+    BN_free(e);
+    return ret;
+}
+
 int setup_tests(void)
 {
     ADD_ALL_TESTS(test_rsa_pkcs1, 3);
     ADD_ALL_TESTS(test_rsa_oaep, 3);
     ADD_ALL_TESTS(test_rsa_security_bit, OSSL_NELEM(rsa_security_bits_cases));
     ADD_TEST(test_rsa_saos);
+    ADD_TEST(test_rsa_batch);
+    ADD_ALL_TESTS(test_rsa_batch_free_wait_ctx, 2);
     return 1;
 }
@@ -0,0 +1,448 @@
+/*
+ * Copyright 2023 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License 2.0 (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * Tests for the sharded internal session cache, together with a simple
+ * multi-threaded resumption benchmark which can be used to compare the
+ * sharded and unsharded caches:
+ *
+ *   ssl_sess_cache_test -threads 32 -conns 2000 -test test_mt_resumption \
+ *       test/certs
+ */
+
+#include <string.h>
+#include <openssl/ssl.h>
+#include "internal/time.h"
+#include "internal/tsan_assist.h"
+#include "helpers/ssltestlib.h"
+#include "testutil.h"
+#include "threadstest.h"
+
+#define MAXIMUM_THREADS     64
+
+static char *cert = NULL;
+static char *privkey = NULL;
+static int num_threads = 4;
+static int num_conns = 16;
+
+static SSL_CTX *bench_sctx = NULL, *bench_cctx = NULL;
+static TSAN_QUALIFIER int bench_failed;
+static TSAN_QUALIFIER int bench_reused;
+
+static void make_sid(unsigned char *sid, unsigned int id)
+{
+    memset(sid, 0, SSL_MAX_SSL_SESSION_ID_LENGTH);
+    memcpy(sid, &id, sizeof(id));
+}
+
+static SSL_SESSION *new_session_ex(unsigned int id, int version)
+{
+    SSL_SESSION *sess = SSL_SESSION_new();
+    unsigned char sid[SSL_MAX_SSL_SESSION_ID_LENGTH];
+
+    make_sid(sid, id);
+    if (sess == NULL
+            || !SSL_SESSION_set_protocol_version(sess, version)
+            || !SSL_SESSION_set1_id(sess, sid, sizeof(sid))) {
+        SSL_SESSION_free(sess);
+        return NULL;
+    }
+    return sess;
+}
+
+static SSL_SESSION *new_session(unsigned int id)
+{
+    return new_session_ex(id, TLS1_2_VERSION);
+}
+
+static int has_session(SSL *ssl, unsigned int id)
+{
+    unsigned char sid[SSL_MAX_SSL_SESSION_ID_LENGTH];
+
+    make_sid(sid, id);
+    return SSL_has_matching_session_id(ssl, sid, sizeof(sid));
+}
+
+/*
+ * Test that the sharded cache enforces the cache size, supports removal and
+ * flushing, and that switching the cache layout keeps the cached sessions.
+ */
+static int test_sharded_cache(void)
+{
+    SSL_CTX *ctx = NULL;
+    SSL_SESSION *sess[64];
+    unsigned int i;
+    long num;
+    int testresult = 0;
+
+    memset(sess, 0, sizeof(sess));
+
+    if (!TEST_ptr(ctx = SSL_CTX_new(TLS_server_method()))
+            || !TEST_ptr(SSL_CTX_sessions(ctx)))
+        goto end;
+
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER
+                                        | SSL_SESS_CACHE_SHARDED);
+    if (!TEST_long_eq(SSL_CTX_get_session_cache_mode(ctx),
+                      SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_SHARDED)
+            || !TEST_ptr_null(SSL_CTX_sessions(ctx)))
+        goto end;
+
+    SSL_CTX_sess_set_cache_size(ctx, 32);
+    for (i = 0; i < OSSL_NELEM(sess); i++)
+        if (!TEST_ptr(sess[i] = new_session(i))
+                || !TEST_int_eq(SSL_CTX_add_session(ctx, sess[i]), 1))
+            goto end;
+
+    /* Adding a session twice is not an error but adds nothing */
+    num = SSL_CTX_sess_number(ctx);
+    if (!TEST_long_gt(num, 0)
+            || !TEST_long_le(num, 32)
+            || !TEST_int_eq(SSL_CTX_add_session(ctx, sess[63]), 0)
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), num)
+            || !TEST_long_gt(SSL_CTX_sess_cache_full(ctx), 0))
+        goto end;
+
+    /* The most recently added session is cached and can be removed */
+    if (!TEST_true(SSL_CTX_remove_session(ctx, sess[63]))
+            || !TEST_false(SSL_CTX_remove_session(ctx, sess[63]))
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), num - 1))
+        goto end;
+
+    SSL_CTX_flush_sessions(ctx, 0);
+    if (!TEST_long_eq(SSL_CTX_sess_number(ctx), 0))
+        goto end;
+
+    /* Switching between the layouts moves the sessions across */
+    for (i = 0; i < 8; i++)
+        if (!TEST_int_eq(SSL_CTX_add_session(ctx, sess[i]), 1))
+            goto end;
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    if (!TEST_long_eq(SSL_CTX_sess_number(ctx), 8)
+            || !TEST_ptr(SSL_CTX_sessions(ctx)))
+        goto end;
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER
+                                        | SSL_SESS_CACHE_SHARDED);
+    if (!TEST_long_eq(SSL_CTX_sess_number(ctx), 8))
+        goto end;
+    for (i = 0; i < 8; i++)
+        if (!TEST_int_eq(SSL_CTX_add_session(ctx, sess[i]), 0)
+                || !TEST_true(SSL_CTX_remove_session(ctx, sess[i])))
+            goto end;
+
+    testresult = 1;
+ end:
+    SSL_CTX_free(ctx);
+    for (i = 0; i < OSSL_NELEM(sess); i++)
+        SSL_SESSION_free(sess[i]);
+    return testresult;
+}
+
+/*
+ * Test that changing the ID of a cached session moves it within the cache.
+ * Test 0: Unsharded cache
+ * Test 1: Sharded cache
+ */
+static int test_set1_id_cached(int idx)
+{
+    SSL_CTX *ctx = NULL;
+    SSL *ssl = NULL;
+    SSL_SESSION *sess = NULL;
+    unsigned char sid[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    unsigned int i;
+    int testresult = 0;
+
+    if (!TEST_ptr(ctx = SSL_CTX_new(TLS_server_method()))
+            || !TEST_ptr(ssl = SSL_new(ctx)))
+        goto end;
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER
+                                   | (idx == 1 ? SSL_SESS_CACHE_SHARDED : 0));
+
+    if (!TEST_ptr(sess = new_session_ex(1, SSL_version(ssl)))
+            || !TEST_int_eq(SSL_CTX_add_session(ctx, sess), 1)
+            || !TEST_true(has_session(ssl, 1)))
+        goto end;
+
+    /* Try enough IDs that some of them belong to a different shard */
+    for (i = 2; i < 34; i++) {
+        make_sid(sid, i);
+        if (!TEST_true(SSL_SESSION_set1_id(sess, sid, sizeof(sid)))
+                || !TEST_false(has_session(ssl, i - 1))
+                || !TEST_true(has_session(ssl, i))
+                || !TEST_long_eq(SSL_CTX_sess_number(ctx), 1))
+            goto end;
+    }
+
+    if (!TEST_true(SSL_CTX_remove_session(ctx, sess))
+            || !TEST_false(has_session(ssl, i - 1))
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), 0))
+        goto end;
+
+    /* A session that is not cached is not added by changing its ID */
+    make_sid(sid, 1);
+    if (!TEST_true(SSL_SESSION_set1_id(sess, sid, sizeof(sid)))
+            || !TEST_false(has_session(ssl, 1))
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), 0))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_SESSION_free(sess);
+    SSL_free(ssl);
+    SSL_CTX_free(ctx);
+    return testresult;
+}
+
+static SSL_CTX *switch_ctx = NULL;
+static TSAN_QUALIFIER int switch_failed;
+static TSAN_QUALIFIER int switch_next_id;
+
+/*
+ * Each worker adds sessions to the shared SSL_CTX, looks them up and removes
+ * them again while the main thread switches the cache layout.
+ */
+static void switch_worker(void)
+{
+    SSL *ssl = SSL_new(switch_ctx);
+    SSL_SESSION *sess = NULL;
+    unsigned int id;
+    int i;
+
+    if (ssl == NULL)
+        goto err;
+
+    for (i = 0; i < num_conns * 8; i++) {
+        id = (unsigned int)tsan_add(&switch_next_id, 1);
+        if ((sess = new_session_ex(id, SSL_version(ssl))) == NULL
+                || SSL_CTX_add_session(switch_ctx, sess) != 1
+                || !has_session(ssl, id)
+                || !SSL_CTX_remove_session(switch_ctx, sess)
+                || has_session(ssl, id))
+            goto err;
+        SSL_SESSION_free(sess);
+        sess = NULL;
+    }
+
+    SSL_free(ssl);
+    return;
+
+ err:
+    SSL_SESSION_free(sess);
+    SSL_free(ssl);
+    tsan_store(&switch_failed, 1);
+}
+
+/*
+ * Test that switching the cache layout while other threads use the cache
+ * neither loses nor corrupts cached sessions.
+ */
+static int test_mt_layout_switch(void)
+{
+    thread_t threads[MAXIMUM_THREADS];
+    int i, testresult = 0;
+
+    if (!TEST_ptr(switch_ctx = SSL_CTX_new(TLS_server_method())))
+        goto end;
+    SSL_CTX_sess_set_cache_size(switch_ctx, 0);
+
+    switch_failed = 0;
+    switch_next_id = 0;
+    for (i = 0; i < num_threads; i++)
+        if (!TEST_true(run_thread(&threads[i], switch_worker)))
+            goto end;
+    for (i = 0; i < 64; i++)
+        SSL_CTX_set_session_cache_mode(switch_ctx, SSL_SESS_CACHE_SERVER
+                                       | (i % 2 == 0 ? SSL_SESS_CACHE_SHARDED
+                                                     : 0));
+    for (i = 0; i < num_threads; i++)
+        if (!TEST_true(wait_for_thread(threads[i])))
+            goto end;
+
+    if (!TEST_false(switch_failed)
+            || !TEST_long_eq(SSL_CTX_sess_number(switch_ctx), 0))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_CTX_free(switch_ctx);
+    switch_ctx = NULL;
+    return testresult;
+}
+
+/*
+ * Each worker repeatedly connects to the shared server SSL_CTX, resuming the
+ * session from its previous connection. Every eighth connection is a full
+ * handshake, which adds a new session to the cache.
+ */
+static void resumption_worker(void)
+{
+    SSL *serverssl = NULL, *clientssl = NULL;
+    SSL_SESSION *sess = NULL;
+    int i;
+
+    for (i = 0; i < num_conns; i++) {
+        if (i % 8 == 0) {
+            SSL_SESSION_free(sess);
+            sess = NULL;
+        }
+
+        if (!create_ssl_objects(bench_sctx, bench_cctx, &serverssl,
+                                &clientssl, NULL, NULL)
+                || (sess != NULL && !SSL_set_session(clientssl, sess))
+                || !create_ssl_connection(serverssl, clientssl,
+                                          SSL_ERROR_NONE))
+            goto err;
+
+        if (sess != NULL) {
+            if (!SSL_session_reused(clientssl))
+                goto err;
+            tsan_counter(&bench_reused);
+        }
+
+        SSL_SESSION_free(sess);
+        if ((sess = SSL_get1_session(clientssl)) == NULL)
+            goto err;
+
+        shutdown_ssl_connection(serverssl, clientssl);
+        serverssl = clientssl = NULL;
+    }
+
+    SSL_SESSION_free(sess);
+    return;
+
+ err:
+    SSL_SESSION_free(sess);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    tsan_store(&bench_failed, 1);
+}
+
+/*
+ * Test 0: Resumption from multiple threads with the unsharded cache
+ * Test 1: Resumption from multiple threads with the sharded cache
+ */
+static int test_mt_resumption(int idx)
+{
+    thread_t threads[MAXIMUM_THREADS];
+    OSSL_TIME start, duration;
+    int i, testresult = 0;
+    int expected = (num_conns - (num_conns + 7) / 8) * num_threads;
+
+    if (!TEST_true(create_ssl_ctx_pair(NULL, TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION, 0,
+                                       &bench_sctx, &bench_cctx, cert,
+                                       privkey)))
+        goto end;
+
+    /*
+     * Use stateful resumption so that every resumption looks the session up
+     * in the server's internal cache.
+     */
+    SSL_CTX_set_options(bench_sctx, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(bench_sctx, SSL_SESS_CACHE_SERVER
+                                   | (idx == 1 ? SSL_SESS_CACHE_SHARDED : 0));
+    SSL_CTX_set_session_cache_mode(bench_cctx, SSL_SESS_CACHE_CLIENT
+                                   | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+
+    bench_failed = 0;
+    bench_reused = 0;
+    start = ossl_time_now();
+
+    for (i = 0; i < num_threads; i++)
+        if (!TEST_true(run_thread(&threads[i], resumption_worker)))
+            goto end;
+    for (i = 0; i < num_threads; i++)
+        if (!TEST_true(wait_for_thread(threads[i])))
+            goto end;
+
+    duration = ossl_time_subtract(ossl_time_now(), start);
+    TEST_info("%s cache: %d threads, %d connections in %llu ms",
+              idx == 1 ? "sharded" : "unsharded", num_threads,
+              num_threads * num_conns,
+              (unsigned long long)ossl_time2ms(duration));
+
+    if (!TEST_false(bench_failed)
+            || !TEST_int_eq(bench_reused, expected)
+            || !TEST_long_gt(SSL_CTX_sess_number(bench_sctx), 0))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_CTX_free(bench_sctx);
+    SSL_CTX_free(bench_cctx);
+    bench_sctx = bench_cctx = NULL;
+    return testresult;
+}
+
+typedef enum OPTION_choice {
+    OPT_ERR = -1,
+    OPT_EOF = 0,
+    OPT_THREADS,
+    OPT_CONNS,
+    OPT_TEST_ENUM
+} OPTION_CHOICE;
+
+const OPTIONS *test_get_options(void)
+{
+    static const OPTIONS options[] = {
+        OPT_TEST_OPTIONS_WITH_EXTRA_USAGE("certdir\n"),
+        { "threads", OPT_THREADS, 'p', "Number of threads (default 4)" },
+        { "conns", OPT_CONNS, 'p',
+          "Number of connections per thread (default 16)" },
+        { NULL }
+    };
+    return options;
+}
+
+int setup_tests(void)
+{
+    OPTION_CHOICE o;
+    char *certsdir;
+
+    while ((o = opt_next()) != OPT_EOF) {
+        switch (o) {
+        case OPT_THREADS:
+            num_threads = opt_int_arg();
+            break;
+        case OPT_CONNS:
+            num_conns = opt_int_arg();
+            break;
+        case OPT_TEST_CASES:
+            break;
+        default:
+            return 0;
+        }
+    }
+
+    if (!TEST_int_gt(num_threads, 0)
+            || !TEST_int_le(num_threads, MAXIMUM_THREADS)
+            || !TEST_int_gt(num_conns, 0)
+            || !TEST_ptr(certsdir = test_get_argument(0)))
+        return 0;
+
+    cert = test_mk_file_path(certsdir, "servercert.pem");
+    if (cert == NULL)
+        return 0;
+
+    privkey = test_mk_file_path(certsdir, "serverkey.pem");
+    if (privkey == NULL)
+        return 0;
+
+    ADD_TEST(test_sharded_cache);
+    ADD_ALL_TESTS(test_set1_id_cached, 2);
+    ADD_TEST(test_mt_layout_switch);
+    ADD_ALL_TESTS(test_mt_resumption, 2);
+    return 1;
+}
+
+void cleanup_tests(void)
+{
+    OPENSSL_free(cert);
+    OPENSSL_free(privkey);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -15,8 +15,19 @@
 # define OPENSSL_SUPPRESS_DEPRECATED
 #endif
 
+/*
+ * The kTLS tests use splice() on Linux, which needs _GNU_SOURCE before any
+ * system header is included.  <openssl/configuration.h> includes none.
+ */
+#include <openssl/configuration.h>
+#if defined(__linux__) && !defined(OPENSSL_NO_KTLS) \
+    && !defined(OPENSSL_NO_SOCK) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE
+#endif
+
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include <openssl/opensslconf.h>
 #include <openssl/bio.h>
@@ -1052,6 +1063,12 @@ static int execute_test_large_message(const SSL_METHOD *smeth,
 
 #if !defined(OPENSSL_NO_SOCK) && !defined(OPENSSL_NO_KTLS) && \
     !(defined(OSSL_NO_USABLE_TLS1_3) && defined(OPENSSL_NO_TLS1_2))
+# include <poll.h>
+# if defined(OPENSSL_SYS_LINUX)
+#  include <fcntl.h>
+#  include <unistd.h>
+# endif
+
 /* sock must be connected */
 static int ktls_chk_platform(int sock)
 {
@@ -1442,6 +1459,231 @@ end:
     return testresult;
 }
 
+#define KEY_UPDATE_XFER_SZ              (64 * SENDFILE_CHUNK)
+/* How long to wait for a socket to become ready before giving up */
+#define KTLS_WAIT_MS                    10000
+
+static int ktls_wait_fd(int fd, short events)
+{
+    struct pollfd pfd;
+
+    pfd.fd = fd;
+    pfd.events = events;
+    pfd.revents = 0;
+    return TEST_int_gt(poll(&pfd, 1, KTLS_WAIT_MS), 0);
+}
+
+/*
+ * Receive |len| bytes on |fd| with KTLS. On Linux the data is moved into a
+ * pipe with splice() so that it never goes through a userspace buffer before
+ * we read it back to check it.
+ */
+static int ktls_recv_chunk(SSL *ssl, int fd, int *pipefd, unsigned char *buf,
+                           size_t len)
+{
+    size_t got = 0;
+    ossl_ssize_t n;
+#if defined(OPENSSL_SYS_LINUX)
+    ossl_ssize_t r;
+
+    while (got < len) {
+        n = splice(fd, NULL, pipefd[1], NULL, len - got, SPLICE_F_NONBLOCK);
+        if (n < 0 && errno == EAGAIN) {
+            if (!ktls_wait_fd(fd, POLLIN))
+                return 0;
+            continue;
+        }
+        if (!TEST_int_gt(n, 0))
+            return 0;
+        while (n > 0) {
+            r = read(pipefd[0], buf + got, n);
+            if (!TEST_int_gt(r, 0))
+                return 0;
+            got += r;
+            n -= r;
+        }
+    }
+#else
+    int ret;
+
+    while (got < len) {
+        ret = SSL_read(ssl, buf + got, len - got);
+        if (ret <= 0) {
+            if (SSL_get_error(ssl, ret) != SSL_ERROR_WANT_READ
+                || !ktls_wait_fd(fd, POLLIN))
+                return 0;
+            continue;
+        }
+        got += ret;
+    }
+#endif
+    return 1;
+}
+
+/*
+ * Check that both directions stay in the kernel across a TLSv1.3 KeyUpdate,
+ * then send a file with sendfile() and receive it with splice() to report the
+ * throughput of the zero-copy path with the new keys.
+ */
+static int execute_test_ktls_key_update(const char *cipher)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    unsigned char *buf, *buf_dst;
+    BIO *out = NULL, *in = NULL;
+    int cfd = -1, sfd = -1, ffd, err;
+    int pipefd[2] = { -1, -1 };
+    ossl_ssize_t chunk_size;
+    off_t chunk_off = 0;
+    struct timespec start, end;
+    double secs;
+    int testresult = 0;
+    FILE *ffdp;
+    SSL_CONNECTION *clientsc, *serversc;
+
+    buf = OPENSSL_zalloc(KEY_UPDATE_XFER_SZ);
+    buf_dst = OPENSSL_zalloc(KEY_UPDATE_XFER_SZ);
+    if (!TEST_ptr(buf) || !TEST_ptr(buf_dst)
+        || !TEST_true(create_test_sockets(&cfd, &sfd, SOCK_STREAM, NULL)))
+        goto end;
+
+    /* Skip this test if the platform does not support ktls */
+    if (!ktls_chk_platform(cfd) || !ktls_chk_platform(sfd)) {
+        testresult = TEST_skip("Kernel does not support KTLS");
+        goto end;
+    }
+
+    if (is_fips && strstr(cipher, "CHACHA") != NULL) {
+        testresult = TEST_skip("CHACHA is not supported in FIPS");
+        goto end;
+    }
+
+#if defined(OPENSSL_SYS_LINUX)
+    if (!TEST_int_eq(pipe(pipefd), 0))
+        goto end;
+#endif
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_3_VERSION, TLS1_3_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+        || !TEST_true(SSL_CTX_set_ciphersuites(cctx, cipher))
+        || !TEST_true(SSL_CTX_set_ciphersuites(sctx, cipher))
+        || !TEST_true(SSL_CTX_set_options(cctx, SSL_OP_ENABLE_KTLS))
+        || !TEST_true(SSL_CTX_set_options(sctx, SSL_OP_ENABLE_KTLS)))
+        goto end;
+
+    if (!TEST_true(create_ssl_objects2(sctx, cctx, &serverssl,
+                                       &clientssl, sfd, cfd))
+        || !TEST_ptr(clientsc = SSL_CONNECTION_FROM_SSL_ONLY(clientssl))
+        || !TEST_ptr(serversc = SSL_CONNECTION_FROM_SSL_ONLY(serverssl))
+        || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                            SSL_ERROR_NONE)))
+        goto end;
+
+    if (!BIO_get_ktls_send(clientsc->wbio) || !BIO_get_ktls_recv(clientsc->rbio)
+        || !BIO_get_ktls_send(serversc->wbio)
+        || !BIO_get_ktls_recv(serversc->rbio)) {
+        testresult = TEST_skip("KTLS not supported in both directions for "
+                               "TLS 1.3 cipher %s", cipher);
+        goto end;
+    }
+
+    if (!TEST_true(ping_pong_query(clientssl, serverssl)))
+        goto end;
+
+    /*
+     * Update the client keys and request an update of the server ones. Kernels
+     * that cannot change the keys of a connection fail here.
+     */
+    ERR_clear_error();
+    if (!TEST_true(SSL_key_update(clientssl, SSL_KEY_UPDATE_REQUESTED)))
+        goto end;
+    if (SSL_do_handshake(clientssl) <= 0) {
+        if (TEST_int_eq(ERR_GET_REASON(ERR_peek_error()),
+                        SSL_R_KTLS_REKEY_FAILED))
+            testresult = TEST_skip("Kernel cannot change the KTLS keys");
+        goto end;
+    }
+
+    /* The server processes both KeyUpdate messages here */
+    if (!TEST_true(ping_pong_query(clientssl, serverssl)))
+        goto end;
+
+    if (!TEST_true(BIO_get_ktls_send(clientsc->wbio))
+        || !TEST_true(BIO_get_ktls_recv(clientsc->rbio))
+        || !TEST_true(BIO_get_ktls_send(serversc->wbio))
+        || !TEST_true(BIO_get_ktls_recv(serversc->rbio)))
+        goto end;
+
+    if (!TEST_int_gt(RAND_bytes_ex(libctx, buf, KEY_UPDATE_XFER_SZ, 0), 0))
+        goto end;
+
+    out = BIO_new_file(tmpfilename, "wb");
+    if (!TEST_ptr(out)
+        || !TEST_int_eq(BIO_write(out, buf, KEY_UPDATE_XFER_SZ),
+                        KEY_UPDATE_XFER_SZ))
+        goto end;
+    BIO_free(out);
+    out = NULL;
+    in = BIO_new_file(tmpfilename, "rb");
+    if (!TEST_ptr(in))
+        goto end;
+    BIO_get_fp(in, &ffdp);
+    ffd = fileno(ffdp);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (chunk_off < KEY_UPDATE_XFER_SZ) {
+        chunk_size = min(SENDFILE_CHUNK, KEY_UPDATE_XFER_SZ - chunk_off);
+        while ((err = SSL_sendfile(serverssl, ffd, chunk_off, chunk_size,
+                                   0)) != chunk_size) {
+            if (SSL_get_error(serverssl, err) != SSL_ERROR_WANT_WRITE
+                || !ktls_wait_fd(sfd, POLLOUT))
+                goto end;
+        }
+        if (!TEST_true(ktls_recv_chunk(clientssl, cfd, pipefd,
+                                       buf_dst + chunk_off, chunk_size)))
+            goto end;
+        chunk_off += chunk_size;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (!TEST_mem_eq(buf_dst, KEY_UPDATE_XFER_SZ, buf, KEY_UPDATE_XFER_SZ))
+        goto end;
+
+    secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    if (secs > 0)
+        TEST_info("%s: %d bytes sent with sendfile() after KeyUpdate at "
+                  "%.1f MB/s", cipher, KEY_UPDATE_XFER_SZ,
+                  KEY_UPDATE_XFER_SZ / secs / 1e6);
+
+    testresult = 1;
+end:
+    if (clientssl) {
+        SSL_shutdown(clientssl);
+        SSL_free(clientssl);
+    }
+    if (serverssl) {
+        SSL_shutdown(serverssl);
+        SSL_free(serverssl);
+    }
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    BIO_free(out);
+    BIO_free(in);
+    if (cfd != -1)
+        close(cfd);
+    if (sfd != -1)
+        close(sfd);
+    if (pipefd[0] != -1)
+        close(pipefd[0]);
+    if (pipefd[1] != -1)
+        close(pipefd[1]);
+    OPENSSL_free(buf);
+    OPENSSL_free(buf_dst);
+    return testresult;
+}
+
 static struct ktls_test_cipher {
     int tls_version;
     const char *cipher;
@@ -1507,6 +1749,19 @@ static int test_ktls_sendfile(int test)
     return execute_test_ktls_sendfile(cipher->tls_version, cipher->cipher,
                                       test & 1);
 }
+
+static int test_ktls_key_update(int test)
+{
+    struct ktls_test_cipher *cipher;
+
+    OPENSSL_assert(test < (int)NUM_KTLS_TEST_CIPHERS);
+    cipher = &ktls_test_ciphers[test];
+
+    if (cipher->tls_version != TLS1_3_VERSION)
+        return TEST_skip("KeyUpdate is a TLS 1.3 message");
+
+    return execute_test_ktls_key_update(cipher->cipher);
+}
 #endif
 
 static int test_large_message_tls(void)
@@ -5050,6 +5305,58 @@ static int test_key_exchange(int idx)
     return testresult;
 }
 
+# ifndef OPENSSL_NO_ML_KEM
+/*
+ * Test the ML-KEM groups and the X25519MLKEM768 hybrid, which are TLSv1.3
+ * only KEM groups of the default provider.
+ */
+static const char *ml_kem_kexch_groups[] = {
+#  ifndef OPENSSL_NO_EC
+    "X25519MLKEM768",
+#  endif
+    "MLKEM512", "MLKEM768", "MLKEM1024"
+};
+
+static int test_ml_kem_key_exchange(int idx)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *serverssl = NULL, *clientssl = NULL;
+    const char *group = ml_kem_kexch_groups[idx];
+    int testresult = 0;
+
+    if (is_fips)
+        return TEST_skip("No ML-KEM in the FIPS provider");
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), TLS1_3_VERSION,
+                                       TLS1_3_VERSION, &sctx, &cctx, cert,
+                                       privkey))
+            || !TEST_true(SSL_CTX_set1_groups_list(sctx, group))
+            || !TEST_true(SSL_CTX_set1_groups_list(cctx, group))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+
+    if (!TEST_str_eq(SSL_group_to_name(serverssl,
+                                       SSL_get_negotiated_group(serverssl)),
+                     group)
+            || !TEST_str_eq(SSL_group_to_name(clientssl,
+                                              SSL_get_negotiated_group(clientssl)),
+                            group))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+# endif
+
 # if !defined(OPENSSL_NO_TLS1_2) \
      && !defined(OPENSSL_NO_EC)  \
      && !defined(OPENSSL_NO_DH)
@@ -10411,6 +10718,239 @@ static int test_inherit_verify_param(void)
     return testresult;
 }
 
+/*
+ * Test the record buffer pool of an SSL_CTX
+ * Test 0: TLSv1.2
+ * Test 1: TLSv1.3
+ */
+#define POOL_TEST_CONNS 3
+static int test_record_buffer_pool(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl[POOL_TEST_CONNS], *serverssl[POOL_TEST_CONNS];
+    int testresult = 0, version = tst == 0 ? TLS1_2_VERSION : TLS1_3_VERSION;
+    const char msg[] = "Hello";
+    char buf[sizeof(msg)];
+    size_t written, readbytes;
+    long discards;
+    int i;
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (tst == 0)
+        return TEST_skip("TLSv1.2 is disabled");
+#endif
+#ifdef OSSL_NO_USABLE_TLS1_3
+    if (tst == 1)
+        return TEST_skip("No usable TLSv1.3");
+#endif
+
+    memset(clientssl, 0, sizeof(clientssl));
+    memset(serverssl, 0, sizeof(serverssl));
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), version, version,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    if (!TEST_long_eq(SSL_CTX_get_record_buffer_pool_size(sctx), 0)
+            || !TEST_long_eq(SSL_CTX_set_record_buffer_pool_size(sctx, 8), 1)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_size(sctx), 8)
+            || !TEST_long_eq(SSL_CTX_set_record_buffer_pool_size(sctx, -1), 0))
+        goto end;
+
+    for (i = 0; i < POOL_TEST_CONNS; i++) {
+        if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl[i],
+                                          &clientssl[i], NULL, NULL))
+                || !TEST_true(create_ssl_connection(serverssl[i], clientssl[i],
+                                                    SSL_ERROR_NONE)))
+            goto end;
+    }
+
+    /* Handshakes are done, idle connections hold no pooled buffers */
+    if (!TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                              SSL_RECORD_BUFFER_POOL_STAT_IN_USE), 0)
+            || !TEST_long_gt(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE), 0)
+            || !TEST_long_le(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE), 8)
+            || !TEST_long_gt(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE_BYTES), 0)
+            || !TEST_long_gt(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_HITS), 0)
+            || !TEST_long_gt(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_MISSES), 0)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(cctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_MISSES), 0)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx, 0), -1))
+        goto end;
+
+    for (i = 0; i < POOL_TEST_CONNS; i++) {
+        if (!TEST_true(SSL_write_ex(clientssl[i], msg, sizeof(msg), &written))
+                || !TEST_true(SSL_read_ex(serverssl[i], buf, sizeof(buf),
+                                          &readbytes))
+                || !TEST_mem_eq(buf, readbytes, msg, sizeof(msg))
+                || !TEST_true(SSL_write_ex(serverssl[i], msg, sizeof(msg),
+                                           &written))
+                || !TEST_true(SSL_read_ex(clientssl[i], buf, sizeof(buf),
+                                          &readbytes))
+                || !TEST_mem_eq(buf, readbytes, msg, sizeof(msg)))
+            goto end;
+    }
+    if (!TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                              SSL_RECORD_BUFFER_POOL_STAT_IN_USE), 0))
+        goto end;
+
+    /* A pool without room discards the buffers returned to it */
+    discards = SSL_CTX_get_record_buffer_pool_stat(sctx,
+                   SSL_RECORD_BUFFER_POOL_STAT_DISCARDS);
+    if (!TEST_long_eq(SSL_CTX_set_record_buffer_pool_size(sctx, 0), 1)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE), 0)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE_BYTES), 0)
+            || !TEST_true(SSL_write_ex(clientssl[0], msg, sizeof(msg),
+                                       &written))
+            || !TEST_true(SSL_read_ex(serverssl[0], buf, sizeof(buf),
+                                      &readbytes))
+            || !TEST_long_gt(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_DISCARDS),
+                             discards)
+            || !TEST_long_eq(SSL_CTX_get_record_buffer_pool_stat(sctx,
+                                 SSL_RECORD_BUFFER_POOL_STAT_IDLE), 0))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    for (i = 0; i < POOL_TEST_CONNS; i++) {
+        SSL_free(serverssl[i]);
+        SSL_free(clientssl[i]);
+    }
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+static void count_records_cb(int write_p, int version, int content_type,
+                             const void *buf, size_t len, SSL *ssl, void *arg)
+{
+    if (write_p && content_type == SSL3_RT_HEADER)
+        (*(int *)arg)++;
+}
+
+/*
+ * Test SSL_writev_ex() and SSL_readv_ex(). Test 0 uses TLSv1.2, test 1 uses
+ * TLSv1.3.
+ */
+static int test_writev_readv(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0, version = tst == 0 ? TLS1_2_VERSION : TLS1_3_VERSION;
+    int records = 0;
+    unsigned char *msg = NULL, *buf = NULL;
+    size_t msglen = SSL3_RT_MAX_PLAIN_LENGTH + 3616;
+    size_t written, readbytes, total, i;
+    SSL_IOVEC wiov[5], riov[4], small[10];
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (tst == 0)
+        return TEST_skip("TLSv1.2 is disabled");
+#endif
+#ifdef OSSL_NO_USABLE_TLS1_3
+    if (tst == 1)
+        return TEST_skip("No usable TLSv1.3");
+#endif
+
+    if (!TEST_ptr(msg = OPENSSL_malloc(msglen))
+            || !TEST_ptr(buf = OPENSSL_zalloc(msglen)))
+        goto end;
+    for (i = 0; i < msglen; i++)
+        msg[i] = (unsigned char)(i * 7);
+
+    if (!TEST_true(create_ssl_ctx_pair(libctx, TLS_server_method(),
+                                       TLS_client_method(), version, version,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    SSL_CTX_set_msg_callback(cctx, count_records_cb);
+    SSL_CTX_set_msg_callback_arg(cctx, &records);
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+    records = 0;
+
+    /*
+     * The first record spans all segments, the second one lies within the
+     * last segment.
+     */
+    wiov[0].data = msg;
+    wiov[0].data_len = 1;
+    wiov[1].data = NULL;
+    wiov[1].data_len = 0;
+    wiov[2].data = msg + 1;
+    wiov[2].data_len = 99;
+    wiov[3].data = msg + 100;
+    wiov[3].data_len = 900;
+    wiov[4].data = msg + 1000;
+    wiov[4].data_len = msglen - 1000;
+    if (!TEST_true(SSL_writev_ex(clientssl, wiov, OSSL_NELEM(wiov), &written))
+            || !TEST_size_t_eq(written, msglen)
+            || !TEST_int_eq(records, 2))
+        goto end;
+
+    /* A read scatters the data of a record over the following segments */
+    riov[0].data = buf;
+    riov[0].data_len = 5000;
+    riov[1].data = NULL;
+    riov[1].data_len = 0;
+    riov[2].data = buf + 5000;
+    riov[2].data_len = 10000;
+    riov[3].data = buf + 15000;
+    riov[3].data_len = msglen - 15000;
+    if (!TEST_true(SSL_readv_ex(serverssl, riov, OSSL_NELEM(riov),
+                                &readbytes))
+            || !TEST_size_t_eq(readbytes, SSL3_RT_MAX_PLAIN_LENGTH))
+        goto end;
+    for (total = readbytes, i = 0; total < msglen; total += readbytes) {
+        riov[0].data = buf + total;
+        riov[0].data_len = msglen - total;
+        if (!TEST_true(SSL_readv_ex(serverssl, riov, 1, &readbytes))
+                || !TEST_size_t_le(++i, 10))
+            goto end;
+    }
+    if (!TEST_mem_eq(buf, msglen, msg, msglen))
+        goto end;
+
+    /* Small segments are packed into a single record */
+    records = 0;
+    for (i = 0; i < OSSL_NELEM(small); i++) {
+        small[i].data = msg + 10 * i;
+        small[i].data_len = 10;
+    }
+    if (!TEST_true(SSL_writev_ex(clientssl, small, OSSL_NELEM(small),
+                                 &written))
+            || !TEST_size_t_eq(written, 100)
+            || !TEST_int_eq(records, 1)
+            || !TEST_true(SSL_read_ex(serverssl, buf, msglen, &readbytes))
+            || !TEST_mem_eq(buf, readbytes, msg, 100))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(msg);
+    OPENSSL_free(buf);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
 static int test_load_dhfile(void)
 {
 #ifndef OPENSSL_NO_DH
@@ -11121,6 +11661,7 @@ int setup_tests(void)
 # if !defined(OPENSSL_NO_TLS1_2) || !defined(OSSL_NO_USABLE_TLS1_3)
     ADD_ALL_TESTS(test_ktls, NUM_KTLS_TEST_CIPHERS * 4);
     ADD_ALL_TESTS(test_ktls_sendfile, NUM_KTLS_TEST_CIPHERS * 2);
+    ADD_ALL_TESTS(test_ktls_key_update, NUM_KTLS_TEST_CIPHERS);
 # endif
 #endif
     ADD_TEST(test_large_message_tls);
@@ -11202,6 +11743,9 @@ int setup_tests(void)
 # else
     /* Test with only TLSv1.3 versions */
     ADD_ALL_TESTS(test_key_exchange, 12);
+# endif
+# ifndef OPENSSL_NO_ML_KEM
+    ADD_ALL_TESTS(test_ml_kem_key_exchange, OSSL_NELEM(ml_kem_kexch_groups));
 # endif
     ADD_ALL_TESTS(test_custom_exts, 6);
     ADD_TEST(test_stateless);
@@ -11266,6 +11810,8 @@ int setup_tests(void)
     ADD_TEST(test_set_verify_cert_store_ssl_ctx);
     ADD_TEST(test_set_verify_cert_store_ssl);
     ADD_ALL_TESTS(test_session_timeout, 1);
+    ADD_ALL_TESTS(test_record_buffer_pool, 2);
+    ADD_ALL_TESTS(test_writev_readv, 2);
     ADD_TEST(test_load_dhfile);
 #ifndef OSSL_NO_USABLE_TLS1_3
     ADD_TEST(test_read_ahead_key_change);
@@ -1,5 +1,5 @@
 /*
- * Copyright 2016-2022 The OpenSSL Project Authors. All Rights Reserved.
+ * Copyright 2016-2023 The OpenSSL Project Authors. All Rights Reserved.
  *
  * Licensed under the Apache License 2.0 (the "License").  You may not use
  * this file except in compliance with the License.  You can obtain a copy
@@ -25,6 +25,8 @@
 #include <openssl/aes.h>
 #include <openssl/err.h>
 #include <openssl/rand.h>
+#include <openssl/evp.h>
+#include <openssl/core_names.h>
 #include "internal/tsan_assist.h"
 #include "internal/nelem.h"
 #include "testutil.h"
@@ -562,6 +564,73 @@ static int test_multi_shared_pkey(void)
     return test_multi_shared_pkey_common(&thread_shared_evp_pkey);
 }
 
+#ifndef OPENSSL_NO_EC
+static unsigned char precomp_sig[256];
+static size_t precomp_siglen;
+
+static void thread_precompute_verify(void)
+{
+    static const unsigned char msg[] = "Hello World";
+    EVP_MD_CTX *mctx = EVP_MD_CTX_new();
+    int i;
+
+    for (i = 0; i < 20; i++)
+        if (!TEST_ptr(mctx)
+                || !TEST_int_eq(EVP_DigestVerifyInit_ex(mctx, NULL, "SHA256",
+                                                        multi_libctx, NULL,
+                                                        shared_evp_pkey, NULL),
+                                1)
+                || !TEST_int_eq(EVP_DigestVerify(mctx, precomp_sig,
+                                                 precomp_siglen, msg,
+                                                 sizeof(msg) - 1), 1)) {
+            multi_set_success(0);
+            break;
+        }
+    EVP_MD_CTX_free(mctx);
+}
+
+/*
+ * Verify with a shared EC key that has verification tables enabled, so that
+ * the threads race to build them and then use them concurrently.
+ */
+static int test_multi_precompute_verify(void)
+{
+    static const unsigned char msg[] = "Hello World";
+    EVP_MD_CTX *mctx = NULL;
+    int testresult = 0;
+
+    multi_intialise();
+    precomp_siglen = sizeof(precomp_sig);
+    if (!thread_setup_libctx(1, default_provider)
+            || !TEST_ptr(shared_evp_pkey = EVP_PKEY_Q_keygen(multi_libctx, NULL,
+                                                             "EC", "P-256"))
+            || !TEST_true(EVP_PKEY_set_int_param(shared_evp_pkey,
+                                                 OSSL_PKEY_PARAM_PRECOMPUTE_VERIFY,
+                                                 1))
+            || !TEST_ptr(mctx = EVP_MD_CTX_new())
+            || !TEST_int_eq(EVP_DigestSignInit_ex(mctx, NULL, "SHA256",
+                                                  multi_libctx, NULL,
+                                                  shared_evp_pkey, NULL), 1)
+            || !TEST_int_eq(EVP_DigestSign(mctx, precomp_sig, &precomp_siglen,
+                                           msg, sizeof(msg) - 1), 1)
+            || !start_threads(4, &thread_precompute_verify))
+        goto err;
+
+    thread_precompute_verify();
+
+    if (!teardown_threads()
+            || !TEST_true(multi_success))
+        goto err;
+    testresult = 1;
+ err:
+    EVP_MD_CTX_free(mctx);
+    EVP_PKEY_free(shared_evp_pkey);
+    shared_evp_pkey = NULL;
+    thead_teardown_libctx();
+    return testresult;
+}
+#endif
+
 static int test_multi_load_unload_provider(void)
 {
     EVP_MD *sha256 = NULL;
@@ -809,6 +878,9 @@ int setup_tests(void)
     ADD_TEST(test_multi_shared_pkey);
 #ifndef OPENSSL_NO_DEPRECATED_3_0
     ADD_TEST(test_multi_downgrade_shared_pkey);
+#endif
+#ifndef OPENSSL_NO_EC
+    ADD_TEST(test_multi_precompute_verify);
 #endif
     ADD_TEST(test_multi_load_unload_provider);
     ADD_TEST(test_obj_add);